@@ -0,0 +1,32 @@
+/**
+ * @file Allocations.h
+ * @brief Heap allocations per iteration as benchmark counters
+ * @details Shares the replaced operator new of the test suite (test/AllocationCounter.h), so the
+ *          same rule applies: include from one translation unit per benchmark executable.
+ */
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include "../test/AllocationCounter.h"
+
+namespace nfx::string::benchmark
+{
+	//=====================================================================
+	// Allocation counters
+	//=====================================================================
+
+	/**
+	 * @brief Reports allocs/op and bytes/op for the allocations counted so far
+	 * @param state Benchmark state, after its measurement loop
+	 * @param allocations Counter constructed right before the measurement loop
+	 * @details Call before SetItemsProcessed()/SetBytesProcessed(): adding a counter allocates.
+	 */
+	inline void reportAllocations( ::benchmark::State& state, const nfx::string::test::AllocationCounter& allocations )
+	{
+		const auto stats = allocations.stats();
+		state.counters["allocs/op"] = ::benchmark::Counter( static_cast<double>( stats.count ), ::benchmark::Counter::kAvgIterations );
+		state.counters["bytes/op"] = ::benchmark::Counter( static_cast<double>( stats.bytes ), ::benchmark::Counter::kAvgIterations );
+	}
+} // namespace nfx::string::benchmark
@@ -0,0 +1,144 @@
+/**
+ * @file BM_FixedString.cpp
+ * @brief Benchmark FixedString storage and non-allocating operations vs std::string
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nfx/string/FixedString.h>
+#include <nfx/string/Utils.h>
+
+namespace nfx::string::benchmark
+{
+	//=====================================================================
+	// FixedString benchmark suite
+	//=====================================================================
+
+	//----------------------------------------------
+	// Test data
+	//----------------------------------------------
+
+	/** @brief Hostnames past the small-string limit of std::string */
+	static std::vector<std::string> makeHosts( std::size_t count )
+	{
+		std::vector<std::string> hosts;
+		hosts.reserve( count );
+		for ( std::size_t i = 0; i < count; ++i )
+		{
+			hosts.push_back( "  Node-" + std::to_string( i ) + ".EU-West.Example.com  " );
+		}
+		return hosts;
+	}
+
+	/** @brief Record holding a hostname as a struct member would */
+	template <typename String>
+	struct Endpoint
+	{
+		String host;
+		std::uint16_t port;
+	};
+
+	//----------------------------------------------
+	// Storing hostnames
+	//----------------------------------------------
+
+	static void BM_STD_string_store( ::benchmark::State& state )
+	{
+		const auto hosts = makeHosts( static_cast<std::size_t>( state.range( 0 ) ) );
+		std::vector<Endpoint<std::string>> endpoints( hosts.size() );
+		for ( auto _ : state )
+		{
+			for ( std::size_t i = 0; i < hosts.size(); ++i )
+			{
+				endpoints[i].host = std::string{ nfx::string::trim( hosts[i] ) };
+			}
+			::benchmark::DoNotOptimize( endpoints.data() );
+		}
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * state.range( 0 ) );
+	}
+
+	static void BM_NFX_FixedString_store( ::benchmark::State& state )
+	{
+		const auto hosts = makeHosts( static_cast<std::size_t>( state.range( 0 ) ) );
+		std::vector<Endpoint<nfx::string::FixedString<253>>> endpoints( hosts.size() );
+		for ( auto _ : state )
+		{
+			for ( std::size_t i = 0; i < hosts.size(); ++i )
+			{
+				bool stored = nfx::string::trim( hosts[i], endpoints[i].host );
+				::benchmark::DoNotOptimize( stored );
+			}
+			::benchmark::DoNotOptimize( endpoints.data() );
+		}
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * state.range( 0 ) );
+	}
+
+	//----------------------------------------------
+	// Case conversion
+	//----------------------------------------------
+
+	static void BM_STD_string_toLower( ::benchmark::State& state )
+	{
+		const auto hosts = makeHosts( static_cast<std::size_t>( state.range( 0 ) ) );
+		for ( auto _ : state )
+		{
+			for ( const std::string& host : hosts )
+			{
+				std::string lowered = nfx::string::toLower( host );
+				::benchmark::DoNotOptimize( lowered );
+			}
+		}
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * state.range( 0 ) );
+	}
+
+	static void BM_NFX_FixedString_toLower( ::benchmark::State& state )
+	{
+		const auto hosts = makeHosts( static_cast<std::size_t>( state.range( 0 ) ) );
+		nfx::string::FixedString<253> lowered;
+		for ( auto _ : state )
+		{
+			for ( const std::string& host : hosts )
+			{
+				bool converted = nfx::string::toLower( host, lowered );
+				::benchmark::DoNotOptimize( converted );
+				::benchmark::DoNotOptimize( lowered );
+			}
+		}
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * state.range( 0 ) );
+	}
+} // namespace nfx::string::benchmark
+
+//=====================================================================
+// Benchmarks registration
+//=====================================================================
+
+//----------------------------------------------
+// Storing hostnames
+//----------------------------------------------
+
+BENCHMARK( nfx::string::benchmark::BM_STD_string_store )
+	->Range( 8, 1 << 12 )
+	->Unit( benchmark::kNanosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_FixedString_store )
+	->Range( 8, 1 << 12 )
+	->Unit( benchmark::kNanosecond );
+
+//----------------------------------------------
+// Case conversion
+//----------------------------------------------
+
+BENCHMARK( nfx::string::benchmark::BM_STD_string_toLower )
+	->Range( 8, 1 << 12 )
+	->Unit( benchmark::kNanosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_FixedString_toLower )
+	->Range( 8, 1 << 12 )
+	->Unit( benchmark::kNanosecond );
+
+BENCHMARK_MAIN();
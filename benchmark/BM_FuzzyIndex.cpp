@@ -0,0 +1,137 @@
+/**
+ * @file BM_FuzzyIndex.cpp
+ * @brief Benchmark FuzzyIndex approximate lookup vs a linear scan with the bounded
+ *        Levenshtein distance
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nfx/string/FuzzyIndex.h>
+
+namespace nfx::string::benchmark
+{
+	//=====================================================================
+	// FuzzyIndex benchmark suite
+	//=====================================================================
+
+	//----------------------------------------------
+	// Test data
+	//----------------------------------------------
+
+	/** @brief Number of queries per benchmark iteration */
+	static constexpr std::size_t queryCount = 16;
+
+	/** @brief Maximum edit distance of every query */
+	static constexpr std::size_t maxDistance = 2;
+
+	/** @brief Seeded host-name-like dictionary of the given size */
+	static std::vector<std::string> makeDictionary( std::size_t size )
+	{
+		static const std::vector<std::string> regions{ "eu-west", "eu-central", "us-east", "ap-south" };
+		std::mt19937 rng{ 42 };
+		std::vector<std::string> dictionary;
+		dictionary.reserve( size );
+		for ( std::size_t i = 0; i < size; ++i )
+		{
+			dictionary.push_back( "node-" + std::to_string( rng() % ( size * 4 ) ) + "." + regions[rng() % regions.size()] + ".example.com" );
+		}
+		return dictionary;
+	}
+
+	/** @brief Dictionary entries with one substitution and one deletion applied */
+	static std::vector<std::string> makeQueries( const std::vector<std::string>& dictionary )
+	{
+		std::mt19937 rng{ 7 };
+		std::vector<std::string> queries;
+		for ( std::size_t i = 0; i < queryCount; ++i )
+		{
+			std::string query = dictionary[rng() % dictionary.size()];
+			query[rng() % query.size()] = 'x';
+			query.erase( rng() % query.size(), 1 );
+			queries.push_back( std::move( query ) );
+		}
+		return queries;
+	}
+
+	//----------------------------------------------
+	// Approximate lookup
+	//----------------------------------------------
+
+	static void BM_Manual_linearScan( ::benchmark::State& state )
+	{
+		const auto dictionary = makeDictionary( static_cast<std::size_t>( state.range( 0 ) ) );
+		const auto queries = makeQueries( dictionary );
+		for ( auto _ : state )
+		{
+			std::size_t matches = 0;
+			for ( const std::string& query : queries )
+			{
+				for ( const std::string& entry : dictionary )
+				{
+					matches += nfx::string::levenshteinDistance( query, entry, maxDistance ) <= maxDistance;
+				}
+			}
+			::benchmark::DoNotOptimize( matches );
+		}
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( queryCount ) );
+	}
+
+	static void BM_NFX_FuzzyIndex_find( ::benchmark::State& state )
+	{
+		const auto dictionary = makeDictionary( static_cast<std::size_t>( state.range( 0 ) ) );
+		const auto queries = makeQueries( dictionary );
+		const nfx::string::FuzzyIndex index{ dictionary };
+		for ( auto _ : state )
+		{
+			std::size_t matches = 0;
+			for ( const std::string& query : queries )
+			{
+				matches += index.find( query, maxDistance ).size();
+			}
+			::benchmark::DoNotOptimize( matches );
+		}
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( queryCount ) );
+	}
+
+	static void BM_NFX_FuzzyIndex_build( ::benchmark::State& state )
+	{
+		const auto dictionary = makeDictionary( static_cast<std::size_t>( state.range( 0 ) ) );
+		for ( auto _ : state )
+		{
+			const nfx::string::FuzzyIndex index{ dictionary };
+			::benchmark::DoNotOptimize( index.size() );
+		}
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * state.range( 0 ) );
+	}
+} // namespace nfx::string::benchmark
+
+//=====================================================================
+// Benchmarks registration
+//=====================================================================
+
+//----------------------------------------------
+// Approximate lookup
+//----------------------------------------------
+
+BENCHMARK( nfx::string::benchmark::BM_Manual_linearScan )
+	->RangeMultiplier( 16 )
+	->Range( 1 << 10, 1 << 18 )
+	->Unit( benchmark::kMicrosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_FuzzyIndex_find )
+	->RangeMultiplier( 16 )
+	->Range( 1 << 10, 1 << 20 )
+	->Unit( benchmark::kMicrosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_FuzzyIndex_build )
+	->RangeMultiplier( 16 )
+	->Range( 1 << 10, 1 << 20 )
+	->Unit( benchmark::kMillisecond );
+
+BENCHMARK_MAIN();
@@ -0,0 +1,248 @@
+/**
+ * @file BM_Glob.cpp
+ * @brief Benchmark GlobPattern and GlobSet vs a backtracking glob matcher, hand-written
+ *        startsWith/endsWith checks, and one-pattern-at-a-time loops
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nfx/string/Glob.h>
+#include <nfx/string/Utils.h>
+
+namespace nfx::string::benchmark
+{
+	//=====================================================================
+	// Glob benchmark suite
+	//=====================================================================
+
+	//----------------------------------------------
+	// Test data
+	//----------------------------------------------
+
+	/** @brief Seeded host names, about half of them under example.com */
+	static std::vector<std::string> makeHosts( std::size_t count )
+	{
+		static const std::vector<std::string> domains{ ".eu-west.example.com", ".us-east.example.com", ".example.org", ".internal.corp" };
+		std::mt19937 rng{ 42 };
+		std::vector<std::string> hosts;
+		hosts.reserve( count );
+		for ( std::size_t i = 0; i < count; ++i )
+		{
+			hosts.push_back( "node-" + std::to_string( rng() % 100000 ) + domains[rng() % domains.size()] );
+		}
+		return hosts;
+	}
+
+	/** @brief Classic recursive glob matcher for '*' and '?' */
+	static bool backtrackingMatch( std::string_view pattern, std::string_view str )
+	{
+		while ( !pattern.empty() && pattern.front() != '*' )
+		{
+			if ( str.empty() || ( pattern.front() != '?' && pattern.front() != str.front() ) )
+			{
+				return false;
+			}
+			pattern.remove_prefix( 1 );
+			str.remove_prefix( 1 );
+		}
+		if ( pattern.empty() )
+		{
+			return str.empty();
+		}
+		for ( std::size_t skip = 0; skip <= str.size(); ++skip )
+		{
+			if ( backtrackingMatch( pattern.substr( 1 ), str.substr( skip ) ) )
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	static constexpr std::size_t hostCount = 4096;
+
+	//----------------------------------------------
+	// Single pattern
+	//----------------------------------------------
+
+	static void BM_Manual_startsWithEndsWith( ::benchmark::State& state )
+	{
+		const auto hosts = makeHosts( hostCount );
+		for ( auto _ : state )
+		{
+			std::size_t matches = 0;
+			for ( const std::string& host : hosts )
+			{
+				matches += nfx::string::startsWith( host, "node-" ) && nfx::string::endsWith( host, ".example.com" ) &&
+						   host.find( ".eu-", 5 ) != std::string::npos;
+			}
+			::benchmark::DoNotOptimize( matches );
+		}
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( hostCount ) );
+	}
+
+	static void BM_Manual_backtrackingGlob( ::benchmark::State& state )
+	{
+		const auto hosts = makeHosts( hostCount );
+		for ( auto _ : state )
+		{
+			std::size_t matches = 0;
+			for ( const std::string& host : hosts )
+			{
+				matches += backtrackingMatch( "node-*.eu-*.example.com", host );
+			}
+			::benchmark::DoNotOptimize( matches );
+		}
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( hostCount ) );
+	}
+
+	static void BM_NFX_GlobPattern_matches( ::benchmark::State& state )
+	{
+		const auto hosts = makeHosts( hostCount );
+		const nfx::string::GlobPattern pattern{ "node-*.eu-*.example.com" };
+		for ( auto _ : state )
+		{
+			std::size_t matches = 0;
+			for ( const std::string& host : hosts )
+			{
+				matches += pattern.matches( host );
+			}
+			::benchmark::DoNotOptimize( matches );
+		}
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( hostCount ) );
+	}
+
+	static void BM_NFX_GlobPattern_matchesIgnoreCase( ::benchmark::State& state )
+	{
+		const auto hosts = makeHosts( hostCount );
+		const nfx::string::GlobPattern pattern{ "NODE-*.EU-*.EXAMPLE.COM", nfx::string::GlobCase::Insensitive };
+		for ( auto _ : state )
+		{
+			std::size_t matches = 0;
+			for ( const std::string& host : hosts )
+			{
+				matches += pattern.matches( host );
+			}
+			::benchmark::DoNotOptimize( matches );
+		}
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( hostCount ) );
+	}
+
+	//----------------------------------------------
+	// Pattern sets
+	//----------------------------------------------
+
+	/** @brief Rule list mixing exact hosts, suffix rules and a few unanchored rules */
+	static std::vector<std::string> makeRules( std::size_t count )
+	{
+		std::vector<std::string> rules;
+		for ( std::size_t i = 0; i < count; ++i )
+		{
+			switch ( i % 4 )
+			{
+				case 0:
+					rules.push_back( "node-" + std::to_string( i ) + ".eu-west.example.com" );
+					break;
+				case 1:
+					rules.push_back( "*.svc" + std::to_string( i ) + ".example.net" );
+					break;
+				case 2:
+					rules.push_back( "node-" + std::to_string( i ) + "?.*" );
+					break;
+				default:
+					rules.push_back( i == 3 ? "*canary*" : "*.zone" + std::to_string( i ) + ".corp" );
+					break;
+			}
+		}
+		return rules;
+	}
+
+	static void BM_NFX_GlobPattern_loop( ::benchmark::State& state )
+	{
+		const auto hosts = makeHosts( hostCount );
+		std::vector<nfx::string::GlobPattern> patterns;
+		for ( const std::string& rule : makeRules( static_cast<std::size_t>( state.range( 0 ) ) ) )
+		{
+			patterns.emplace_back( rule );
+		}
+		for ( auto _ : state )
+		{
+			std::size_t matches = 0;
+			for ( const std::string& host : hosts )
+			{
+				for ( const auto& pattern : patterns )
+				{
+					if ( pattern.matches( host ) )
+					{
+						++matches;
+						break;
+					}
+				}
+			}
+			::benchmark::DoNotOptimize( matches );
+		}
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( hostCount ) );
+	}
+
+	static void BM_NFX_GlobSet_matchesAny( ::benchmark::State& state )
+	{
+		const auto hosts = makeHosts( hostCount );
+		nfx::string::GlobSet set;
+		for ( const std::string& rule : makeRules( static_cast<std::size_t>( state.range( 0 ) ) ) )
+		{
+			set.add( rule );
+		}
+		for ( auto _ : state )
+		{
+			std::size_t matches = 0;
+			for ( const std::string& host : hosts )
+			{
+				matches += set.matchesAny( host );
+			}
+			::benchmark::DoNotOptimize( matches );
+		}
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( hostCount ) );
+	}
+} // namespace nfx::string::benchmark
+
+//=====================================================================
+// Benchmarks registration
+//=====================================================================
+
+//----------------------------------------------
+// Single pattern
+//----------------------------------------------
+
+BENCHMARK( nfx::string::benchmark::BM_Manual_startsWithEndsWith )
+	->Unit( benchmark::kMicrosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_Manual_backtrackingGlob )
+	->Unit( benchmark::kMicrosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_GlobPattern_matches )
+	->Unit( benchmark::kMicrosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_GlobPattern_matchesIgnoreCase )
+	->Unit( benchmark::kMicrosecond );
+
+//----------------------------------------------
+// Pattern sets
+//----------------------------------------------
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_GlobPattern_loop )
+	->RangeMultiplier( 8 )
+	->Range( 8, 1 << 12 )
+	->Unit( benchmark::kMicrosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_GlobSet_matchesAny )
+	->RangeMultiplier( 8 )
+	->Range( 8, 1 << 12 )
+	->Unit( benchmark::kMicrosecond );
+
+BENCHMARK_MAIN();
@@ -0,0 +1,206 @@
+/**
+ * @file BM_Levenshtein.cpp
+ * @brief Benchmark bit-parallel Levenshtein distance vs the textbook dynamic programming table
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nfx/string/Levenshtein.h>
+
+namespace nfx::string::benchmark
+{
+	//=====================================================================
+	// Levenshtein benchmark suite
+	//=====================================================================
+
+	//----------------------------------------------
+	// Textbook implementation
+	//----------------------------------------------
+
+	class ManualLevenshtein
+	{
+	public:
+		static std::size_t distance( std::string_view lhs, std::string_view rhs )
+		{
+			std::vector<std::size_t> row( rhs.size() + 1 );
+			for ( std::size_t j = 0; j <= rhs.size(); ++j )
+			{
+				row[j] = j;
+			}
+			for ( std::size_t i = 1; i <= lhs.size(); ++i )
+			{
+				std::size_t diagonal = row[0];
+				row[0] = i;
+				for ( std::size_t j = 1; j <= rhs.size(); ++j )
+				{
+					const std::size_t above = row[j];
+					row[j] = std::min( { above + 1, row[j - 1] + 1, diagonal + ( lhs[i - 1] == rhs[j - 1] ? 0 : 1 ) } );
+					diagonal = above;
+				}
+			}
+			return row[rhs.size()];
+		}
+	};
+
+	//----------------------------------------------
+	// Test data
+	//----------------------------------------------
+
+	/** @brief Random lowercase text of the given size */
+	static std::string makeText( std::mt19937& rng, std::size_t size )
+	{
+		std::string text( size, ' ' );
+		for ( char& c : text )
+		{
+			c = static_cast<char>( 'a' + rng() % 26 );
+		}
+		return text;
+	}
+
+	/** @brief Copy of text with roughly one substitution per ten bytes */
+	static std::string makeVariant( std::mt19937& rng, std::string text )
+	{
+		for ( std::size_t i = 0; i < text.size() / 10 + 1; ++i )
+		{
+			text[rng() % text.size()] = static_cast<char>( 'a' + rng() % 26 );
+		}
+		return text;
+	}
+
+	/** @brief Product names of about 20 bytes, a tenth of them near-duplicates of the query */
+	static std::vector<std::string> makeCandidates( std::mt19937& rng, std::string_view query, std::size_t count )
+	{
+		std::vector<std::string> candidates;
+		candidates.reserve( count );
+		for ( std::size_t i = 0; i < count; ++i )
+		{
+			candidates.push_back( i % 10 == 0 ? makeVariant( rng, std::string{ query } ) : makeText( rng, 16 + rng() % 8 ) );
+		}
+		return candidates;
+	}
+
+	//----------------------------------------------
+	// Pairwise distance
+	//----------------------------------------------
+
+	static void BM_Manual_levenshteinDistance( ::benchmark::State& state )
+	{
+		std::mt19937 rng{ 42 };
+		const std::string lhs = makeText( rng, static_cast<std::size_t>( state.range( 0 ) ) );
+		const std::string rhs = makeVariant( rng, lhs );
+		for ( auto _ : state )
+		{
+			std::size_t distance = ManualLevenshtein::distance( lhs, rhs );
+			::benchmark::DoNotOptimize( distance );
+		}
+	}
+
+	static void BM_NFX_levenshteinDistance( ::benchmark::State& state )
+	{
+		std::mt19937 rng{ 42 };
+		const std::string lhs = makeText( rng, static_cast<std::size_t>( state.range( 0 ) ) );
+		const std::string rhs = makeVariant( rng, lhs );
+		for ( auto _ : state )
+		{
+			std::size_t distance = nfx::string::levenshteinDistance( lhs, rhs );
+			::benchmark::DoNotOptimize( distance );
+		}
+	}
+
+	//----------------------------------------------
+	// One query against many candidates
+	//----------------------------------------------
+
+	static void BM_Manual_levenshteinDistance_Batch( ::benchmark::State& state )
+	{
+		std::mt19937 rng{ 42 };
+		const std::string query = makeText( rng, 20 );
+		const auto candidates = makeCandidates( rng, query, static_cast<std::size_t>( state.range( 0 ) ) );
+		for ( auto _ : state )
+		{
+			std::size_t matches = 0;
+			for ( const std::string& candidate : candidates )
+			{
+				matches += ManualLevenshtein::distance( query, candidate ) <= 3;
+			}
+			::benchmark::DoNotOptimize( matches );
+		}
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * state.range( 0 ) );
+	}
+
+	static void BM_NFX_levenshteinDistance_Bounded( ::benchmark::State& state )
+	{
+		std::mt19937 rng{ 42 };
+		const std::string query = makeText( rng, 20 );
+		const auto candidates = makeCandidates( rng, query, static_cast<std::size_t>( state.range( 0 ) ) );
+		for ( auto _ : state )
+		{
+			std::size_t matches = 0;
+			for ( const std::string& candidate : candidates )
+			{
+				matches += nfx::string::levenshteinDistance( query, candidate, 3 ) <= 3;
+			}
+			::benchmark::DoNotOptimize( matches );
+		}
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * state.range( 0 ) );
+	}
+
+	static void BM_NFX_LevenshteinMatcher_Batch( ::benchmark::State& state )
+	{
+		std::mt19937 rng{ 42 };
+		const std::string query = makeText( rng, 20 );
+		const auto candidates = makeCandidates( rng, query, static_cast<std::size_t>( state.range( 0 ) ) );
+		const nfx::string::LevenshteinMatcher matcher{ query };
+		for ( auto _ : state )
+		{
+			std::size_t matches = 0;
+			for ( const std::string& candidate : candidates )
+			{
+				matches += matcher.distance( candidate, 3 ) <= 3;
+			}
+			::benchmark::DoNotOptimize( matches );
+		}
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * state.range( 0 ) );
+	}
+} // namespace nfx::string::benchmark
+
+//=====================================================================
+// Benchmarks registration
+//=====================================================================
+
+//----------------------------------------------
+// Pairwise distance
+//----------------------------------------------
+
+BENCHMARK( nfx::string::benchmark::BM_Manual_levenshteinDistance )
+	->Range( 8, 1 << 10 )
+	->Unit( benchmark::kNanosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_levenshteinDistance )
+	->Range( 8, 1 << 10 )
+	->Unit( benchmark::kNanosecond );
+
+//----------------------------------------------
+// One query against many candidates
+//----------------------------------------------
+
+BENCHMARK( nfx::string::benchmark::BM_Manual_levenshteinDistance_Batch )
+	->Range( 64, 1 << 12 )
+	->Unit( benchmark::kNanosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_levenshteinDistance_Bounded )
+	->Range( 64, 1 << 12 )
+	->Unit( benchmark::kNanosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_LevenshteinMatcher_Batch )
+	->Range( 64, 1 << 12 )
+	->Unit( benchmark::kNanosecond );
+
+BENCHMARK_MAIN();
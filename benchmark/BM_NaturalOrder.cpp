@@ -0,0 +1,107 @@
+/**
+ * @file BM_NaturalOrder.cpp
+ * @brief Benchmark natural-order sorting: naturalSort vs std::sort with naturalLess, with plain
+ *        lexicographic std::sort as the reference
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nfx/string/NaturalOrder.h>
+
+namespace nfx::string::benchmark
+{
+	//=====================================================================
+	// Natural order benchmark suite
+	//=====================================================================
+
+	//----------------------------------------------
+	// Test data
+	//----------------------------------------------
+
+	/** @brief Seeded versioned artifact and shard names */
+	static std::vector<std::string> makeNames( std::size_t count )
+	{
+		static const std::vector<std::string> products{ "api-gateway", "billing", "search-indexer", "auth" };
+		std::mt19937 rng{ 42 };
+		std::vector<std::string> names;
+		names.reserve( count );
+		for ( std::size_t i = 0; i < count; ++i )
+		{
+			names.push_back( products[rng() % products.size()] + "-" + std::to_string( rng() % 4 ) + "." + std::to_string( rng() % 30 ) + "." +
+							 std::to_string( rng() % 200 ) + "-shard" + std::to_string( rng() % 512 ) + ".tar.gz" );
+		}
+		return names;
+	}
+
+	//----------------------------------------------
+	// Sorting
+	//----------------------------------------------
+
+	static void BM_STD_sort_lexicographic( ::benchmark::State& state )
+	{
+		const auto names = makeNames( static_cast<std::size_t>( state.range( 0 ) ) );
+		for ( auto _ : state )
+		{
+			std::vector<std::string_view> views( names.begin(), names.end() );
+			std::sort( views.begin(), views.end() );
+			::benchmark::DoNotOptimize( views.data() );
+		}
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * state.range( 0 ) );
+	}
+
+	static void BM_NFX_sort_naturalLess( ::benchmark::State& state )
+	{
+		const auto names = makeNames( static_cast<std::size_t>( state.range( 0 ) ) );
+		for ( auto _ : state )
+		{
+			std::vector<std::string_view> views( names.begin(), names.end() );
+			std::sort( views.begin(), views.end(), nfx::string::naturalLess );
+			::benchmark::DoNotOptimize( views.data() );
+		}
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * state.range( 0 ) );
+	}
+
+	static void BM_NFX_naturalSort( ::benchmark::State& state )
+	{
+		const auto names = makeNames( static_cast<std::size_t>( state.range( 0 ) ) );
+		for ( auto _ : state )
+		{
+			std::vector<std::string_view> views( names.begin(), names.end() );
+			nfx::string::naturalSort( views );
+			::benchmark::DoNotOptimize( views.data() );
+		}
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * state.range( 0 ) );
+	}
+} // namespace nfx::string::benchmark
+
+//=====================================================================
+// Benchmarks registration
+//=====================================================================
+
+//----------------------------------------------
+// Sorting
+//----------------------------------------------
+
+BENCHMARK( nfx::string::benchmark::BM_STD_sort_lexicographic )
+	->RangeMultiplier( 8 )
+	->Range( 1 << 10, 1 << 19 )
+	->Unit( benchmark::kMicrosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_sort_naturalLess )
+	->RangeMultiplier( 8 )
+	->Range( 1 << 10, 1 << 19 )
+	->Unit( benchmark::kMicrosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_naturalSort )
+	->RangeMultiplier( 8 )
+	->Range( 1 << 10, 1 << 19 )
+	->Unit( benchmark::kMicrosecond );
+
+BENCHMARK_MAIN();
@@ -0,0 +1,330 @@
+/**
+ * @file BM_Network.cpp
+ * @brief Benchmark network validators and endpoint parsing vs inet_pton and hand-written checks
+ * @details Every benchmark walks a seeded list of addresses, hostnames or endpoints in which one
+ *          entry in ten, at random positions, is malformed (see Corpus.h), so neither the accepting
+ *          nor the rejecting path is memorized
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if defined( _WIN32 )
+#	include <winsock2.h>
+#	include <ws2tcpip.h>
+#else
+#	include <arpa/inet.h>
+#endif
+
+#include <nfx/string/Utils.h>
+
+#include "Corpus.h"
+
+namespace nfx::string::benchmark
+{
+	//=====================================================================
+	// Network benchmark suite
+	//=====================================================================
+
+	//----------------------------------------------
+	// Test data
+	//----------------------------------------------
+
+	/** @brief Entries per list */
+	static constexpr std::size_t kEntryCount{ 1024 };
+
+	/** @brief Fraction of malformed entries, at seeded positions */
+	static constexpr double kInvalidRatio{ 0.1 };
+
+	/** @brief Seeded dotted-quad addresses */
+	static std::vector<std::string> makeIPv4Addresses()
+	{
+		return corpus::addresses( kEntryCount, { .ipv4 = 1.0, .invalid = kInvalidRatio } );
+	}
+
+	/** @brief Seeded IPv6 addresses in full, compressed, link-local and IPv4-mapped forms */
+	static std::vector<std::string> makeIPv6Addresses()
+	{
+		return corpus::addresses( kEntryCount, { .ipv4 = 0.0, .ipv6 = 1.0, .invalid = kInvalidRatio } );
+	}
+
+	/** @brief Seeded service and site hostnames */
+	static std::vector<std::string> makeHostnames()
+	{
+		return corpus::addresses( kEntryCount, { .ipv4 = 0.0, .hostname = 1.0, .invalid = kInvalidRatio } );
+	}
+
+	/** @brief Seeded host:port, ipv4:port and [ipv6]:port endpoints */
+	static std::vector<std::string> makeEndpoints()
+	{
+		return corpus::endpoints( kEntryCount, { .ipv4 = 1.0, .ipv6 = 1.0, .hostname = 1.0, .invalid = kInvalidRatio } );
+	}
+
+	//----------------------------------------------
+	// Baselines
+	//----------------------------------------------
+
+	/** @brief inet_pton() acceptance of a NUL-terminated address */
+	static bool inetPton( int family, const char* address ) noexcept
+	{
+		unsigned char buffer[16];
+		return inet_pton( family, address, buffer ) == 1;
+	}
+
+	/** @brief RFC 1123 hostname check written as a plain loop */
+	static bool manualIsHostname( std::string_view str ) noexcept
+	{
+		if ( str.empty() || str.size() > 253 )
+		{
+			return false;
+		}
+		std::size_t labelSize = 0;
+		char previous = '.';
+		for ( char c : str )
+		{
+			if ( c == '.' )
+			{
+				if ( labelSize == 0 || previous == '-' )
+				{
+					return false;
+				}
+				labelSize = 0;
+			}
+			else
+			{
+				const bool alnum = ( c >= 'a' && c <= 'z' ) || ( c >= 'A' && c <= 'Z' ) || ( c >= '0' && c <= '9' );
+				if ( ( !alnum && c != '-' ) || ( c == '-' && labelSize == 0 ) || ++labelSize > 63 )
+				{
+					return false;
+				}
+			}
+			previous = c;
+		}
+		return labelSize > 0 && previous != '-';
+	}
+
+	/** @brief Endpoint split with rfind/strtol, host validated with inet_pton or the hostname loop */
+	static bool manualParseEndpoint( const std::string& endpoint, std::string& host, std::uint16_t& port )
+	{
+		const bool bracketed = !endpoint.empty() && endpoint.front() == '[';
+		const std::size_t colon = endpoint.rfind( ':' );
+		if ( colon == std::string::npos || colon + 1 == endpoint.size() )
+		{
+			return false;
+		}
+		if ( bracketed && endpoint[colon - 1] != ']' )
+		{
+			return false;
+		}
+
+		char* end = nullptr;
+		const long value = std::strtol( endpoint.c_str() + colon + 1, &end, 10 );
+		if ( *end != '\0' || value < 0 || value > 65535 )
+		{
+			return false;
+		}
+		port = static_cast<std::uint16_t>( value );
+
+		if ( bracketed )
+		{
+			host.assign( endpoint, 1, colon - 2 );
+			return inetPton( AF_INET6, host.c_str() );
+		}
+		host.assign( endpoint, 0, colon );
+		return inetPton( AF_INET, host.c_str() ) || manualIsHostname( host );
+	}
+
+	//----------------------------------------------
+	// IPv4
+	//----------------------------------------------
+
+	static void BM_POSIX_inet_pton_ipv4( ::benchmark::State& state )
+	{
+		const auto addresses = makeIPv4Addresses();
+		for ( auto _ : state )
+		{
+			std::size_t valid = 0;
+			for ( const auto& address : addresses )
+			{
+				valid += inetPton( AF_INET, address.c_str() );
+			}
+			::benchmark::DoNotOptimize( valid );
+		}
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * addresses.size() ) );
+	}
+
+	static void BM_NFX_isIPv4Address( ::benchmark::State& state )
+	{
+		const auto addresses = makeIPv4Addresses();
+		for ( auto _ : state )
+		{
+			std::size_t valid = 0;
+			for ( const auto& address : addresses )
+			{
+				valid += nfx::string::isIPv4Address( address );
+			}
+			::benchmark::DoNotOptimize( valid );
+		}
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * addresses.size() ) );
+	}
+
+	//----------------------------------------------
+	// IPv6
+	//----------------------------------------------
+
+	static void BM_POSIX_inet_pton_ipv6( ::benchmark::State& state )
+	{
+		const auto addresses = makeIPv6Addresses();
+		for ( auto _ : state )
+		{
+			std::size_t valid = 0;
+			for ( const auto& address : addresses )
+			{
+				valid += inetPton( AF_INET6, address.c_str() );
+			}
+			::benchmark::DoNotOptimize( valid );
+		}
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * addresses.size() ) );
+	}
+
+	static void BM_NFX_isIPv6Address( ::benchmark::State& state )
+	{
+		const auto addresses = makeIPv6Addresses();
+		for ( auto _ : state )
+		{
+			std::size_t valid = 0;
+			for ( const auto& address : addresses )
+			{
+				valid += nfx::string::isIPv6Address( address );
+			}
+			::benchmark::DoNotOptimize( valid );
+		}
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * addresses.size() ) );
+	}
+
+	//----------------------------------------------
+	// Hostname
+	//----------------------------------------------
+
+	static void BM_Manual_isHostname( ::benchmark::State& state )
+	{
+		const auto hostnames = makeHostnames();
+		for ( auto _ : state )
+		{
+			std::size_t valid = 0;
+			for ( const auto& hostname : hostnames )
+			{
+				valid += manualIsHostname( hostname );
+			}
+			::benchmark::DoNotOptimize( valid );
+		}
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * hostnames.size() ) );
+	}
+
+	static void BM_NFX_isValidHostname( ::benchmark::State& state )
+	{
+		const auto hostnames = makeHostnames();
+		for ( auto _ : state )
+		{
+			std::size_t valid = 0;
+			for ( const auto& hostname : hostnames )
+			{
+				valid += nfx::string::isValidHostname( hostname );
+			}
+			::benchmark::DoNotOptimize( valid );
+		}
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * hostnames.size() ) );
+	}
+
+	//----------------------------------------------
+	// Endpoint
+	//----------------------------------------------
+
+	static void BM_Manual_parseEndpoint( ::benchmark::State& state )
+	{
+		const auto endpoints = makeEndpoints();
+		std::string host;
+		for ( auto _ : state )
+		{
+			std::size_t valid = 0;
+			for ( const auto& endpoint : endpoints )
+			{
+				std::uint16_t port = 0;
+				valid += manualParseEndpoint( endpoint, host, port );
+				::benchmark::DoNotOptimize( port );
+			}
+			::benchmark::DoNotOptimize( valid );
+		}
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * endpoints.size() ) );
+	}
+
+	static void BM_NFX_tryParseEndpoint( ::benchmark::State& state )
+	{
+		const auto endpoints = makeEndpoints();
+		for ( auto _ : state )
+		{
+			std::size_t valid = 0;
+			for ( const auto& endpoint : endpoints )
+			{
+				std::string_view host;
+				std::uint16_t port = 0;
+				valid += nfx::string::tryParseEndpoint( endpoint, host, port );
+				::benchmark::DoNotOptimize( host );
+				::benchmark::DoNotOptimize( port );
+			}
+			::benchmark::DoNotOptimize( valid );
+		}
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * endpoints.size() ) );
+	}
+} // namespace nfx::string::benchmark
+
+//=====================================================================
+// Benchmarks registration
+//=====================================================================
+
+//----------------------------------------------
+// IPv4
+//----------------------------------------------
+
+BENCHMARK( nfx::string::benchmark::BM_POSIX_inet_pton_ipv4 )
+	->Unit( benchmark::kMicrosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_isIPv4Address )
+	->Unit( benchmark::kMicrosecond );
+
+//----------------------------------------------
+// IPv6
+//----------------------------------------------
+
+BENCHMARK( nfx::string::benchmark::BM_POSIX_inet_pton_ipv6 )
+	->Unit( benchmark::kMicrosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_isIPv6Address )
+	->Unit( benchmark::kMicrosecond );
+
+//----------------------------------------------
+// Hostname
+//----------------------------------------------
+
+BENCHMARK( nfx::string::benchmark::BM_Manual_isHostname )
+	->Unit( benchmark::kMicrosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_isValidHostname )
+	->Unit( benchmark::kMicrosecond );
+
+//----------------------------------------------
+// Endpoint
+//----------------------------------------------
+
+BENCHMARK( nfx::string::benchmark::BM_Manual_parseEndpoint )
+	->Unit( benchmark::kMicrosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_tryParseEndpoint )
+	->Unit( benchmark::kMicrosecond );
+
+BENCHMARK_MAIN();
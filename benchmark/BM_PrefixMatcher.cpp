@@ -0,0 +1,166 @@
+/**
+ * @file BM_PrefixMatcher.cpp
+ * @brief Benchmark multi-prefix routing: PrefixMatcher vs a startsWith loop over every route prefix
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nfx/string/PrefixMatcher.h>
+#include <nfx/string/Utils.h>
+
+namespace nfx::string::benchmark
+{
+	//=====================================================================
+	// Prefix matcher benchmark suite
+	//=====================================================================
+
+	//----------------------------------------------
+	// Test data
+	//----------------------------------------------
+
+	/** @brief Seeded REST-style route prefixes */
+	static std::vector<std::string> makeRoutes( std::size_t count )
+	{
+		static const std::vector<std::string> services{ "users", "orders", "billing", "search", "auth", "catalog", "reports", "admin" };
+		std::mt19937 rng{ 42 };
+		std::vector<std::string> routes;
+		routes.reserve( count );
+		for ( std::size_t i = 0; i < count; ++i )
+		{
+			std::string route{ "/api/v" };
+			route.append( std::to_string( 1 + rng() % 3 ) ).append( "/" ).append( services[rng() % services.size()] );
+			route.append( "/r" ).append( std::to_string( i ) ).append( "/" );
+			routes.push_back( std::move( route ) );
+		}
+		return routes;
+	}
+
+	/** @brief Request paths below the routes, plus one path in eight that matches no route */
+	static std::vector<std::string> makePaths( const std::vector<std::string>& routes )
+	{
+		std::mt19937 rng{ 7 };
+		std::vector<std::string> paths;
+		paths.reserve( 1024 );
+		for ( std::size_t i = 0; i < 1024; ++i )
+		{
+			std::string path = i % 8 == 0 ? std::string{ "/static/img/" } : routes[rng() % routes.size()];
+			path.append( std::to_string( rng() ) ).append( "/details" );
+			paths.push_back( std::move( path ) );
+		}
+		return paths;
+	}
+
+	//----------------------------------------------
+	// Longest matching route
+	//----------------------------------------------
+
+	static void BM_Manual_startsWith_longest( ::benchmark::State& state )
+	{
+		const auto routes = makeRoutes( static_cast<std::size_t>( state.range( 0 ) ) );
+		const auto paths = makePaths( routes );
+		for ( auto _ : state )
+		{
+			for ( const auto& path : paths )
+			{
+				std::size_t best = routes.size();
+				for ( std::size_t i = 0; i < routes.size(); ++i )
+				{
+					if ( nfx::string::startsWith( path, routes[i] ) && ( best == routes.size() || routes[i].size() > routes[best].size() ) )
+					{
+						best = i;
+					}
+				}
+				::benchmark::DoNotOptimize( best );
+			}
+		}
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * paths.size() ) );
+	}
+
+	static void BM_NFX_PrefixMatcher_longestMatch( ::benchmark::State& state )
+	{
+		const auto routes = makeRoutes( static_cast<std::size_t>( state.range( 0 ) ) );
+		const auto paths = makePaths( routes );
+		const nfx::string::PrefixMatcher matcher{ routes };
+		for ( auto _ : state )
+		{
+			for ( const auto& path : paths )
+			{
+				nfx::string::PrefixMatch match{ 0, 0 };
+				::benchmark::DoNotOptimize( matcher.longestMatch( path, match ) );
+				::benchmark::DoNotOptimize( match );
+			}
+		}
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * paths.size() ) );
+	}
+
+	static void BM_NFX_PrefixMatcher_allMatches( ::benchmark::State& state )
+	{
+		const auto routes = makeRoutes( static_cast<std::size_t>( state.range( 0 ) ) );
+		const auto paths = makePaths( routes );
+		const nfx::string::PrefixMatcher matcher{ routes };
+		for ( auto _ : state )
+		{
+			for ( const auto& path : paths )
+			{
+				auto matches = matcher.allMatches( path );
+				::benchmark::DoNotOptimize( matches.data() );
+			}
+		}
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * paths.size() ) );
+	}
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	static void BM_NFX_PrefixMatcher_build( ::benchmark::State& state )
+	{
+		const auto routes = makeRoutes( static_cast<std::size_t>( state.range( 0 ) ) );
+		for ( auto _ : state )
+		{
+			const nfx::string::PrefixMatcher matcher{ routes };
+			::benchmark::DoNotOptimize( matcher.size() );
+		}
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * state.range( 0 ) );
+	}
+} // namespace nfx::string::benchmark
+
+//=====================================================================
+// Benchmarks registration
+//=====================================================================
+
+//----------------------------------------------
+// Longest matching route
+//----------------------------------------------
+
+BENCHMARK( nfx::string::benchmark::BM_Manual_startsWith_longest )
+	->RangeMultiplier( 4 )
+	->Range( 16, 1024 )
+	->Unit( benchmark::kMicrosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_PrefixMatcher_longestMatch )
+	->RangeMultiplier( 4 )
+	->Range( 16, 1024 )
+	->Unit( benchmark::kMicrosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_PrefixMatcher_allMatches )
+	->RangeMultiplier( 4 )
+	->Range( 16, 1024 )
+	->Unit( benchmark::kMicrosecond );
+
+//----------------------------------------------
+// Construction
+//----------------------------------------------
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_PrefixMatcher_build )
+	->RangeMultiplier( 4 )
+	->Range( 16, 1024 )
+	->Unit( benchmark::kMicrosecond );
+
+BENCHMARK_MAIN();
@@ -0,0 +1,155 @@
+/**
+ * @file BM_RadixSort.cpp
+ * @brief Benchmark radixSort and radixSortIgnoreCase vs std::sort on std::string_view
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nfx/string/RadixSort.h>
+#include <nfx/string/Utils.h>
+
+namespace nfx::string::benchmark
+{
+	//=====================================================================
+	// Radix sort benchmark suite
+	//=====================================================================
+
+	//----------------------------------------------
+	// Test data
+	//----------------------------------------------
+
+	/** @brief Seeded split fields: user names, status words and host names with shared prefixes */
+	static std::vector<std::string> makeFields( std::size_t count )
+	{
+		static const std::vector<std::string> words{ "GET", "POST", "ok", "error", "Timeout", "retry", "warning", "Info" };
+		std::mt19937 rng{ 42 };
+		std::vector<std::string> fields;
+		fields.reserve( count );
+		for ( std::size_t i = 0; i < count; ++i )
+		{
+			switch ( rng() % 3 )
+			{
+				case 0:
+					fields.push_back( words[rng() % words.size()] );
+					break;
+				case 1:
+					fields.push_back( "user_" + std::to_string( rng() % ( count / 4 + 1 ) ) );
+					break;
+				default:
+					fields.push_back( "node-" + std::to_string( rng() % 10000 ) + ".eu-west.cluster.example.com" );
+					break;
+			}
+		}
+		return fields;
+	}
+
+	//----------------------------------------------
+	// Case-sensitive sorting
+	//----------------------------------------------
+
+	static void BM_STD_sort( ::benchmark::State& state )
+	{
+		const auto fields = makeFields( static_cast<std::size_t>( state.range( 0 ) ) );
+		for ( auto _ : state )
+		{
+			std::vector<std::string_view> views( fields.begin(), fields.end() );
+			std::sort( views.begin(), views.end() );
+			::benchmark::DoNotOptimize( views.data() );
+		}
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * state.range( 0 ) );
+	}
+
+	static void BM_NFX_radixSort( ::benchmark::State& state )
+	{
+		const auto fields = makeFields( static_cast<std::size_t>( state.range( 0 ) ) );
+		for ( auto _ : state )
+		{
+			std::vector<std::string_view> views( fields.begin(), fields.end() );
+			nfx::string::radixSort( views );
+			::benchmark::DoNotOptimize( views.data() );
+		}
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * state.range( 0 ) );
+	}
+
+	//----------------------------------------------
+	// Case-insensitive sorting
+	//----------------------------------------------
+
+	static void BM_STD_sort_ignoreCase( ::benchmark::State& state )
+	{
+		const auto fields = makeFields( static_cast<std::size_t>( state.range( 0 ) ) );
+		const auto less = []( std::string_view lhs, std::string_view rhs ) {
+			const std::size_t common = std::min( lhs.size(), rhs.size() );
+			for ( std::size_t i = 0; i < common; ++i )
+			{
+				const char l = nfx::string::toLower( lhs[i] );
+				const char r = nfx::string::toLower( rhs[i] );
+				if ( l != r )
+				{
+					return static_cast<unsigned char>( l ) < static_cast<unsigned char>( r );
+				}
+			}
+			return lhs.size() != rhs.size() ? lhs.size() < rhs.size() : lhs < rhs;
+		};
+		for ( auto _ : state )
+		{
+			std::vector<std::string_view> views( fields.begin(), fields.end() );
+			std::sort( views.begin(), views.end(), less );
+			::benchmark::DoNotOptimize( views.data() );
+		}
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * state.range( 0 ) );
+	}
+
+	static void BM_NFX_radixSortIgnoreCase( ::benchmark::State& state )
+	{
+		const auto fields = makeFields( static_cast<std::size_t>( state.range( 0 ) ) );
+		for ( auto _ : state )
+		{
+			std::vector<std::string_view> views( fields.begin(), fields.end() );
+			nfx::string::radixSortIgnoreCase( views );
+			::benchmark::DoNotOptimize( views.data() );
+		}
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * state.range( 0 ) );
+	}
+} // namespace nfx::string::benchmark
+
+//=====================================================================
+// Benchmarks registration
+//=====================================================================
+
+//----------------------------------------------
+// Case-sensitive sorting
+//----------------------------------------------
+
+BENCHMARK( nfx::string::benchmark::BM_STD_sort )
+	->RangeMultiplier( 8 )
+	->Range( 1 << 10, 1 << 22 )
+	->Unit( benchmark::kMicrosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_radixSort )
+	->RangeMultiplier( 8 )
+	->Range( 1 << 10, 1 << 22 )
+	->Unit( benchmark::kMicrosecond );
+
+//----------------------------------------------
+// Case-insensitive sorting
+//----------------------------------------------
+
+BENCHMARK( nfx::string::benchmark::BM_STD_sort_ignoreCase )
+	->RangeMultiplier( 8 )
+	->Range( 1 << 10, 1 << 22 )
+	->Unit( benchmark::kMicrosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_radixSortIgnoreCase )
+	->RangeMultiplier( 8 )
+	->Range( 1 << 10, 1 << 22 )
+	->Unit( benchmark::kMicrosecond );
+
+BENCHMARK_MAIN();
@@ -0,0 +1,254 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file BM_Regex.cpp
+ * @brief Benchmark the lazy-DFA Regex vs std::regex on log classification, replacement and
+ *        splitting
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <regex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nfx/string/Regex.h>
+
+namespace nfx::string::benchmark
+{
+	//=====================================================================
+	// Regex benchmark suite
+	//=====================================================================
+
+	//----------------------------------------------
+	// Test data
+	//----------------------------------------------
+
+	/** @brief Seeded syslog-style lines, a few percent of them connection timeouts */
+	static std::vector<std::string> makeLogLines( std::size_t count )
+	{
+		static const std::vector<std::string> levels{ "INFO", "INFO", "INFO", "DEBUG", "WARN", "ERROR" };
+		static const std::vector<std::string> messages{ "request served in 12ms", "cache miss for key user:4411",
+			"connection to 10.0.3.17:5432 timed out after 3000ms", "retrying upstream call", "session closed by peer" };
+		std::mt19937 rng{ 42 };
+		std::vector<std::string> lines;
+		lines.reserve( count );
+		for ( std::size_t i = 0; i < count; ++i )
+		{
+			std::string line = "2025-03-" + std::to_string( 10 + rng() % 20 ) + "T12:" + std::to_string( 10 + rng() % 50 ) + ":07Z ";
+			line.append( levels[rng() % levels.size()] ).append( " [worker-" ).append( std::to_string( rng() % 64 ) ).append( "] " );
+			line.append( messages[rng() % messages.size()] );
+			lines.push_back( std::move( line ) );
+		}
+		return lines;
+	}
+
+	static constexpr std::size_t lineCount = 4096;
+
+	static constexpr const char* timeoutRule = "(WARN|ERROR) \\[worker-\\d+\\] connection to [\\d.]+:\\d+ timed out";
+
+	//----------------------------------------------
+	// Classification
+	//----------------------------------------------
+
+	static void BM_STD_regex_search( ::benchmark::State& state )
+	{
+		const auto lines = makeLogLines( lineCount );
+		const std::regex rule{ timeoutRule };
+		for ( auto _ : state )
+		{
+			std::size_t matches = 0;
+			for ( const std::string& line : lines )
+			{
+				matches += std::regex_search( line, rule );
+			}
+			::benchmark::DoNotOptimize( matches );
+		}
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( lineCount ) );
+	}
+
+	static void BM_NFX_Regex_search( ::benchmark::State& state )
+	{
+		const auto lines = makeLogLines( lineCount );
+		const nfx::string::Regex rule{ timeoutRule };
+		for ( auto _ : state )
+		{
+			std::size_t matches = 0;
+			for ( const std::string& line : lines )
+			{
+				matches += rule.search( line );
+			}
+			::benchmark::DoNotOptimize( matches );
+		}
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( lineCount ) );
+	}
+
+	static void BM_STD_regex_match( ::benchmark::State& state )
+	{
+		const auto lines = makeLogLines( lineCount );
+		const std::regex rule{ "\\d{4}-\\d{2}-\\d{2}T[\\d:]+Z (INFO|DEBUG) .*" };
+		for ( auto _ : state )
+		{
+			std::size_t matches = 0;
+			for ( const std::string& line : lines )
+			{
+				matches += std::regex_match( line, rule );
+			}
+			::benchmark::DoNotOptimize( matches );
+		}
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( lineCount ) );
+	}
+
+	static void BM_NFX_Regex_matches( ::benchmark::State& state )
+	{
+		const auto lines = makeLogLines( lineCount );
+		const nfx::string::Regex rule{ "\\d{4}-\\d{2}-\\d{2}T[\\d:]+Z (INFO|DEBUG) .*" };
+		for ( auto _ : state )
+		{
+			std::size_t matches = 0;
+			for ( const std::string& line : lines )
+			{
+				matches += rule.matches( line );
+			}
+			::benchmark::DoNotOptimize( matches );
+		}
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( lineCount ) );
+	}
+
+	//----------------------------------------------
+	// Replacement and splitting
+	//----------------------------------------------
+
+	static void BM_STD_regex_replace( ::benchmark::State& state )
+	{
+		const auto lines = makeLogLines( lineCount );
+		const std::regex numbers{ "\\d+" };
+		for ( auto _ : state )
+		{
+			std::size_t size = 0;
+			for ( const std::string& line : lines )
+			{
+				size += std::regex_replace( line, numbers, "N" ).size();
+			}
+			::benchmark::DoNotOptimize( size );
+		}
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( lineCount ) );
+	}
+
+	static void BM_NFX_regexReplace( ::benchmark::State& state )
+	{
+		const auto lines = makeLogLines( lineCount );
+		const nfx::string::Regex numbers{ "\\d+" };
+		for ( auto _ : state )
+		{
+			std::size_t size = 0;
+			for ( const std::string& line : lines )
+			{
+				size += nfx::string::regexReplace( line, numbers, "N" ).size();
+			}
+			::benchmark::DoNotOptimize( size );
+		}
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( lineCount ) );
+	}
+
+	static void BM_STD_sregex_token_iterator( ::benchmark::State& state )
+	{
+		const auto lines = makeLogLines( lineCount );
+		const std::regex separator{ "[ :\\[\\]]+" };
+		for ( auto _ : state )
+		{
+			std::size_t pieces = 0;
+			for ( const std::string& line : lines )
+			{
+				for ( std::sregex_token_iterator it{ line.begin(), line.end(), separator, -1 }, end; it != end; ++it )
+				{
+					pieces += it->length() > 0;
+				}
+			}
+			::benchmark::DoNotOptimize( pieces );
+		}
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( lineCount ) );
+	}
+
+	static void BM_NFX_regexSplit( ::benchmark::State& state )
+	{
+		const auto lines = makeLogLines( lineCount );
+		const nfx::string::Regex separator{ "[ :\\[\\]]+" };
+		for ( auto _ : state )
+		{
+			std::size_t pieces = 0;
+			for ( const std::string& line : lines )
+			{
+				for ( std::string_view piece : nfx::string::regexSplit( line, separator ) )
+				{
+					pieces += !piece.empty();
+				}
+			}
+			::benchmark::DoNotOptimize( pieces );
+		}
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( lineCount ) );
+	}
+} // namespace nfx::string::benchmark
+
+//=====================================================================
+// Benchmarks registration
+//=====================================================================
+
+//----------------------------------------------
+// Classification
+//----------------------------------------------
+
+BENCHMARK( nfx::string::benchmark::BM_STD_regex_search )
+	->Unit( benchmark::kMicrosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_Regex_search )
+	->Unit( benchmark::kMicrosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_STD_regex_match )
+	->Unit( benchmark::kMicrosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_Regex_matches )
+	->Unit( benchmark::kMicrosecond );
+
+//----------------------------------------------
+// Replacement and splitting
+//----------------------------------------------
+
+BENCHMARK( nfx::string::benchmark::BM_STD_regex_replace )
+	->Unit( benchmark::kMicrosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_regexReplace )
+	->Unit( benchmark::kMicrosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_STD_sregex_token_iterator )
+	->Unit( benchmark::kMicrosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_regexSplit )
+	->Unit( benchmark::kMicrosecond );
+
+BENCHMARK_MAIN();
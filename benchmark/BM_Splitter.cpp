@@ -1,15 +1,24 @@
 /**
  * @file BM_Splitter.cpp
  * @brief Benchmark Splitter string splitting performance vs manual approaches
+ * @details CSV benchmarks split the literal row of the published tables ("/corpus:0") or 256
+ *          seeded rows ("/corpus:1", see Corpus.h) per iteration and report rows per second; path
+ *          and configuration benchmarks split one fixed string.
  */
 
 #include <benchmark/benchmark.h>
 
+#include <cstdint>
+#include <string>
 #include <string_view>
 #include <vector>
 
 #include <nfx/string/Splitter.h>
 
+#include "Allocations.h"
+#include "Corpus.h"
+#include "PerfCounters.h"
+
 namespace nfx::string::benchmark
 {
 	//=====================================================================
@@ -20,7 +29,11 @@ namespace nfx::string::benchmark
 	// Test data
 	//----------------------------------------------
 
-	static const std::string csvData = "John,Doe,30,Engineer,NewYork,75000,Active,2023-01-15";
+	/** @brief The CSV row the published result tables were measured on */
+	static const std::vector<std::string> csvLiteralRows{ "John,Doe,30,Engineer,NewYork,75000,Active,2023-01-15" };
+
+	/** @brief Seeded CSV rows of mixed column types, some fields quoted (see Corpus.h) */
+	static const std::vector<std::string> csvCorpusRows = corpus::csvRows( 256 );
 	static const std::string pathData = "VE/400a/400/C101.31/S206/H346.11112/meta";
 	static const std::string configData = "server=localhost;port=8080;database=mydb;timeout=30;ssl=true;debug=false";
 
@@ -28,6 +41,16 @@ namespace nfx::string::benchmark
 	// Manual vs Splitter with CSV data
 	//----------------------------------------------
 
+	/**
+	 * @brief CSV rows of a benchmark run
+	 * @param state Benchmark state whose "corpus" argument is 0 for the literal row and 1 for the corpus
+	 * @return The selected rows
+	 */
+	static const std::vector<std::string>& csvRows( const ::benchmark::State& state )
+	{
+		return state.range( 0 ) == 0 ? csvLiteralRows : csvCorpusRows;
+	}
+
 	class ManualSplitter
 	{
 	public:
@@ -57,13 +80,22 @@ namespace nfx::string::benchmark
 
 	static void BM_Manual_CSV( ::benchmark::State& state )
 	{
+		const std::vector<std::string>& rows = csvRows( state );
 		std::vector<std::string_view> segments;
 
+		const test::AllocationCounter allocations;
+		PerfCounters perfCounters;
 		for ( auto _ : state )
 		{
-			ManualSplitter::split( csvData, ',', segments );
-			::benchmark::DoNotOptimize( segments );
+			for ( const auto& row : rows )
+			{
+				ManualSplitter::split( row, ',', segments );
+				::benchmark::DoNotOptimize( segments );
+			}
 		}
+		reportAllocations( state, allocations );
+		perfCounters.report( state );
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * rows.size() ) );
 	}
 
 	//----------------------------
@@ -72,17 +104,26 @@ namespace nfx::string::benchmark
 
 	static void BM_Splitter_CSV( ::benchmark::State& state )
 	{
+		const std::vector<std::string>& rows = csvRows( state );
 		std::vector<std::string_view> segments;
 
+		const test::AllocationCounter allocations;
+		PerfCounters perfCounters;
 		for ( auto _ : state )
 		{
-			segments.clear();
-			for ( const auto segment : nfx::string::Splitter{ csvData, ',' } )
+			for ( const auto& row : rows )
 			{
-				segments.emplace_back( segment );
+				segments.clear();
+				for ( const auto segment : nfx::string::Splitter{ row, ',' } )
+				{
+					segments.emplace_back( segment );
+				}
+				::benchmark::DoNotOptimize( segments );
 			}
-			::benchmark::DoNotOptimize( segments );
 		}
+		reportAllocations( state, allocations );
+		perfCounters.report( state );
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * rows.size() ) );
 	}
 
 	//----------------------------
@@ -91,17 +132,26 @@ namespace nfx::string::benchmark
 
 	static void BM_SplitView_CSV( ::benchmark::State& state )
 	{
+		const std::vector<std::string>& rows = csvRows( state );
 		std::vector<std::string_view> segments;
 
+		const test::AllocationCounter allocations;
+		PerfCounters perfCounters;
 		for ( auto _ : state )
 		{
-			segments.clear();
-			for ( const auto segment : nfx::string::splitView( csvData, ',' ) )
+			for ( const auto& row : rows )
 			{
-				segments.emplace_back( segment );
+				segments.clear();
+				for ( const auto segment : nfx::string::splitView( row, ',' ) )
+				{
+					segments.emplace_back( segment );
+				}
+				::benchmark::DoNotOptimize( segments );
 			}
-			::benchmark::DoNotOptimize( segments );
 		}
+		reportAllocations( state, allocations );
+		perfCounters.report( state );
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * rows.size() ) );
 	}
 
 	//----------------------------------------------
@@ -116,11 +166,15 @@ namespace nfx::string::benchmark
 	{
 		std::vector<std::string_view> segments;
 
+		const test::AllocationCounter allocations;
+		PerfCounters perfCounters;
 		for ( auto _ : state )
 		{
 			ManualSplitter::split( pathData, '/', segments );
 			::benchmark::DoNotOptimize( segments );
 		}
+		reportAllocations( state, allocations );
+		perfCounters.report( state );
 	}
 
 	//----------------------------
@@ -131,6 +185,8 @@ namespace nfx::string::benchmark
 	{
 		std::vector<std::string_view> segments;
 
+		const test::AllocationCounter allocations;
+		PerfCounters perfCounters;
 		for ( auto _ : state )
 		{
 			segments.clear();
@@ -140,6 +196,8 @@ namespace nfx::string::benchmark
 			}
 			::benchmark::DoNotOptimize( segments );
 		}
+		reportAllocations( state, allocations );
+		perfCounters.report( state );
 	}
 
 	//----------------------------
@@ -150,6 +208,8 @@ namespace nfx::string::benchmark
 	{
 		std::vector<std::string_view> segments;
 
+		const test::AllocationCounter allocations;
+		PerfCounters perfCounters;
 		for ( auto _ : state )
 		{
 			segments.clear();
@@ -159,6 +219,8 @@ namespace nfx::string::benchmark
 			}
 			::benchmark::DoNotOptimize( segments );
 		}
+		reportAllocations( state, allocations );
+		perfCounters.report( state );
 	}
 
 	//----------------------------------------------
@@ -173,11 +235,15 @@ namespace nfx::string::benchmark
 	{
 		std::vector<std::string_view> segments;
 
+		const test::AllocationCounter allocations;
+		PerfCounters perfCounters;
 		for ( auto _ : state )
 		{
 			ManualSplitter::split( configData, ';', segments );
 			::benchmark::DoNotOptimize( segments );
 		}
+		reportAllocations( state, allocations );
+		perfCounters.report( state );
 	}
 
 	//----------------------------
@@ -188,6 +254,8 @@ namespace nfx::string::benchmark
 	{
 		std::vector<std::string_view> segments;
 
+		const test::AllocationCounter allocations;
+		PerfCounters perfCounters;
 		for ( auto _ : state )
 		{
 			segments.clear();
@@ -197,6 +265,8 @@ namespace nfx::string::benchmark
 			}
 			::benchmark::DoNotOptimize( segments );
 		}
+		reportAllocations( state, allocations );
+		perfCounters.report( state );
 	}
 
 	//----------------------------
@@ -207,6 +277,8 @@ namespace nfx::string::benchmark
 	{
 		std::vector<std::string_view> segments;
 
+		const test::AllocationCounter allocations;
+		PerfCounters perfCounters;
 		for ( auto _ : state )
 		{
 			segments.clear();
@@ -216,6 +288,8 @@ namespace nfx::string::benchmark
 			}
 			::benchmark::DoNotOptimize( segments );
 		}
+		reportAllocations( state, allocations );
+		perfCounters.report( state );
 	}
 
 	//----------------------------------------------
@@ -224,15 +298,24 @@ namespace nfx::string::benchmark
 
 	static void BM_Splitter_ZeroAlloc( ::benchmark::State& state )
 	{
+		const std::vector<std::string>& rows = csvRows( state );
+		const test::AllocationCounter allocations;
+		PerfCounters perfCounters;
 		for ( auto _ : state )
 		{
 			size_t count = 0;
-			for ( const auto segment : nfx::string::Splitter{ csvData, ',' } )
+			for ( const auto& row : rows )
 			{
-				count += segment.length();
+				for ( const auto segment : nfx::string::Splitter{ row, ',' } )
+				{
+					count += segment.length();
+				}
 			}
 			::benchmark::DoNotOptimize( count );
 		}
+		reportAllocations( state, allocations );
+		perfCounters.report( state );
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * rows.size() ) );
 	}
 } // namespace nfx::string::benchmark
 
@@ -249,6 +332,9 @@ namespace nfx::string::benchmark
 //----------------------------
 
 BENCHMARK( nfx::string::benchmark::BM_Manual_CSV )
+	->ArgName( "corpus" )
+	->Arg( 0 )
+	->Arg( 1 )
 	->MinTime( 1.0 )
 	->Unit( benchmark::kNanosecond );
 
@@ -257,6 +343,9 @@ BENCHMARK( nfx::string::benchmark::BM_Manual_CSV )
 //----------------------------
 
 BENCHMARK( nfx::string::benchmark::BM_Splitter_CSV )
+	->ArgName( "corpus" )
+	->Arg( 0 )
+	->Arg( 1 )
 	->MinTime( 1.0 )
 	->Unit( benchmark::kNanosecond );
 
@@ -265,6 +354,9 @@ BENCHMARK( nfx::string::benchmark::BM_Splitter_CSV )
 //----------------------------
 
 BENCHMARK( nfx::string::benchmark::BM_SplitView_CSV )
+	->ArgName( "corpus" )
+	->Arg( 0 )
+	->Arg( 1 )
 	->MinTime( 1.0 )
 	->Unit( benchmark::kNanosecond );
 
@@ -321,6 +413,9 @@ BENCHMARK( nfx::string::benchmark::BM_SplitView_Config )
 //----------------------------------------------
 
 BENCHMARK( nfx::string::benchmark::BM_Splitter_ZeroAlloc )
+	->ArgName( "corpus" )
+	->Arg( 0 )
+	->Arg( 1 )
 	->MinTime( 1.0 )
 	->Unit( benchmark::kNanosecond );
 
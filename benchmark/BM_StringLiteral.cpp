@@ -0,0 +1,161 @@
+/**
+ * @file BM_StringLiteral.cpp
+ * @brief Benchmark literal-pattern searches vs the runtime-pattern functions on log lines
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <string_view>
+
+#include <nfx/string/StringLiteral.h>
+#include <nfx/string/Utils.h>
+
+namespace nfx::string::benchmark
+{
+	//=====================================================================
+	// StringLiteral benchmark suite
+	//=====================================================================
+
+	//----------------------------------------------
+	// Test data
+	//----------------------------------------------
+
+	/** @brief Seeded log lines of which roughly one in sixteen is an error */
+	static std::string makeLog( std::size_t size )
+	{
+		static constexpr std::array<std::string_view, 4> lines{
+			"2025-11-08T10:15:32Z INFO  request served path=/api/v1/users status=200 latency=12ms\r\n",
+			"2025-11-08T10:15:32Z DEBUG cache lookup key=session:8f1e hit=true\r\n",
+			"2025-11-08T10:15:33Z WARN  slow query table=orders duration=830ms\r\n",
+			"2025-11-08T10:15:34Z ERROR upstream timeout host=billing.internal retries=3\r\n" };
+
+		std::mt19937 rng{ 42 };
+		std::string text;
+		while ( text.size() < size )
+		{
+			const std::uint32_t pick = rng() % 16;
+			text.append( pick == 0 ? lines[3] : lines[pick % 3] );
+		}
+		return text;
+	}
+
+	//----------------------------------------------
+	// Searching
+	//----------------------------------------------
+
+	static void BM_NFX_count_Runtime( ::benchmark::State& state )
+	{
+		const std::string text = makeLog( static_cast<std::size_t>( state.range( 0 ) ) );
+		const std::string_view needle = "ERROR";
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( needle );
+			std::size_t errors = nfx::string::count( text, needle );
+			::benchmark::DoNotOptimize( errors );
+		}
+		state.SetBytesProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( text.size() ) );
+	}
+
+	static void BM_NFX_countLit( ::benchmark::State& state )
+	{
+		const std::string text = makeLog( static_cast<std::size_t>( state.range( 0 ) ) );
+		for ( auto _ : state )
+		{
+			std::size_t errors = nfx::string::countLit<"ERROR">( text );
+			::benchmark::DoNotOptimize( errors );
+		}
+		state.SetBytesProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( text.size() ) );
+	}
+
+	static void BM_NFX_contains_RuntimeMiss( ::benchmark::State& state )
+	{
+		const std::string text = makeLog( static_cast<std::size_t>( state.range( 0 ) ) );
+		const std::string_view needle = "FATAL";
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( needle );
+			bool found = nfx::string::contains( text, needle );
+			::benchmark::DoNotOptimize( found );
+		}
+		state.SetBytesProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( text.size() ) );
+	}
+
+	static void BM_NFX_containsLit_Miss( ::benchmark::State& state )
+	{
+		const std::string text = makeLog( static_cast<std::size_t>( state.range( 0 ) ) );
+		for ( auto _ : state )
+		{
+			bool found = nfx::string::containsLit<"FATAL">( text );
+			::benchmark::DoNotOptimize( found );
+		}
+		state.SetBytesProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( text.size() ) );
+	}
+
+	//----------------------------------------------
+	// Replacing
+	//----------------------------------------------
+
+	static void BM_NFX_replaceAll_Runtime( ::benchmark::State& state )
+	{
+		const std::string text = makeLog( static_cast<std::size_t>( state.range( 0 ) ) );
+		for ( auto _ : state )
+		{
+			std::string normalized = nfx::string::replaceAll( text, "\r\n", "\n" );
+			::benchmark::DoNotOptimize( normalized );
+		}
+		state.SetBytesProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( text.size() ) );
+	}
+
+	static void BM_NFX_replaceAllLit( ::benchmark::State& state )
+	{
+		const std::string text = makeLog( static_cast<std::size_t>( state.range( 0 ) ) );
+		for ( auto _ : state )
+		{
+			std::string normalized = nfx::string::replaceAllLit<"\r\n", "\n">( text );
+			::benchmark::DoNotOptimize( normalized );
+		}
+		state.SetBytesProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( text.size() ) );
+	}
+} // namespace nfx::string::benchmark
+
+//=====================================================================
+// Benchmarks registration
+//=====================================================================
+
+//----------------------------------------------
+// Searching
+//----------------------------------------------
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_count_Runtime )
+	->Range( 64, 1 << 16 )
+	->Unit( benchmark::kNanosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_countLit )
+	->Range( 64, 1 << 16 )
+	->Unit( benchmark::kNanosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_contains_RuntimeMiss )
+	->Range( 64, 1 << 16 )
+	->Unit( benchmark::kNanosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_containsLit_Miss )
+	->Range( 64, 1 << 16 )
+	->Unit( benchmark::kNanosecond );
+
+//----------------------------------------------
+// Replacing
+//----------------------------------------------
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_replaceAll_Runtime )
+	->Range( 64, 1 << 16 )
+	->Unit( benchmark::kNanosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_replaceAllLit )
+	->Range( 64, 1 << 16 )
+	->Unit( benchmark::kNanosecond );
+
+BENCHMARK_MAIN();
@@ -0,0 +1,209 @@
+/**
+ * @file BM_StringPool.cpp
+ * @brief Benchmark StringPool interning and handle comparison vs std::string copies and
+ *        std::unordered_set<std::string> lookups
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+#include <nfx/string/StringPool.h>
+
+namespace nfx::string::benchmark
+{
+	//=====================================================================
+	// StringPool benchmark suite
+	//=====================================================================
+
+	//----------------------------------------------
+	// Test data
+	//----------------------------------------------
+
+	/** @brief Number of tokens interned per benchmark iteration */
+	static constexpr std::size_t tokenCount = 4096;
+
+	/** @brief Host-name-like vocabulary of the given size */
+	static std::vector<std::string> makeVocabulary( std::size_t size )
+	{
+		std::vector<std::string> vocabulary;
+		vocabulary.reserve( size );
+		for ( std::size_t i = 0; i < size; ++i )
+		{
+			vocabulary.push_back( "node-" + std::to_string( i ) + ".eu-west.cluster.example.com" );
+		}
+		return vocabulary;
+	}
+
+	/** @brief Seeded random token stream drawn from the vocabulary, as a parser would produce it */
+	static std::vector<std::string_view> makeTokens( const std::vector<std::string>& vocabulary )
+	{
+		std::mt19937 rng{ 42 };
+		std::vector<std::string_view> tokens;
+		tokens.reserve( tokenCount );
+		for ( std::size_t i = 0; i < tokenCount; ++i )
+		{
+			tokens.push_back( vocabulary[rng() % vocabulary.size()] );
+		}
+		return tokens;
+	}
+
+	//----------------------------------------------
+	// Storing tokens
+	//----------------------------------------------
+
+	static void BM_STD_string_copy( ::benchmark::State& state )
+	{
+		const auto vocabulary = makeVocabulary( static_cast<std::size_t>( state.range( 0 ) ) );
+		const auto tokens = makeTokens( vocabulary );
+		std::vector<std::string> stored( tokenCount );
+		for ( auto _ : state )
+		{
+			for ( std::size_t i = 0; i < tokenCount; ++i )
+			{
+				stored[i] = std::string{ tokens[i] };
+			}
+			::benchmark::DoNotOptimize( stored.data() );
+		}
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( tokenCount ) );
+	}
+
+	static void BM_STD_unorderedSet_find( ::benchmark::State& state )
+	{
+		const auto vocabulary = makeVocabulary( static_cast<std::size_t>( state.range( 0 ) ) );
+		const auto tokens = makeTokens( vocabulary );
+		const std::unordered_set<std::string> set( vocabulary.begin(), vocabulary.end() );
+		std::vector<const std::string*> stored( tokenCount );
+		for ( auto _ : state )
+		{
+			for ( std::size_t i = 0; i < tokenCount; ++i )
+			{
+				stored[i] = &*set.find( std::string{ tokens[i] } );
+			}
+			::benchmark::DoNotOptimize( stored.data() );
+		}
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( tokenCount ) );
+	}
+
+	static void BM_NFX_StringPool_intern( ::benchmark::State& state )
+	{
+		const auto vocabulary = makeVocabulary( static_cast<std::size_t>( state.range( 0 ) ) );
+		const auto tokens = makeTokens( vocabulary );
+		nfx::string::StringPool pool;
+		std::vector<nfx::string::InternedString> stored( tokenCount );
+		for ( auto _ : state )
+		{
+			for ( std::size_t i = 0; i < tokenCount; ++i )
+			{
+				stored[i] = pool.intern( tokens[i] );
+			}
+			::benchmark::DoNotOptimize( stored.data() );
+		}
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( tokenCount ) );
+	}
+
+	static void BM_NFX_StringPool_intern_Threads( ::benchmark::State& state )
+	{
+		static nfx::string::StringPool pool;
+		const auto vocabulary = makeVocabulary( 1024 );
+		const auto tokens = makeTokens( vocabulary );
+		std::vector<nfx::string::InternedString> stored( tokenCount );
+		for ( auto _ : state )
+		{
+			for ( std::size_t i = 0; i < tokenCount; ++i )
+			{
+				stored[i] = pool.intern( tokens[i] );
+			}
+			::benchmark::DoNotOptimize( stored.data() );
+		}
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( tokenCount ) );
+	}
+
+	//----------------------------------------------
+	// Comparing stored tokens
+	//----------------------------------------------
+
+	static void BM_STD_string_equals( ::benchmark::State& state )
+	{
+		const auto vocabulary = makeVocabulary( static_cast<std::size_t>( state.range( 0 ) ) );
+		const auto tokens = makeTokens( vocabulary );
+		const std::vector<std::string> stored( tokens.begin(), tokens.end() );
+		for ( auto _ : state )
+		{
+			std::size_t matches = 0;
+			for ( std::size_t i = 1; i < tokenCount; ++i )
+			{
+				matches += stored[i] == stored[i - 1];
+			}
+			::benchmark::DoNotOptimize( matches );
+		}
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( tokenCount - 1 ) );
+	}
+
+	static void BM_NFX_InternedString_equals( ::benchmark::State& state )
+	{
+		const auto vocabulary = makeVocabulary( static_cast<std::size_t>( state.range( 0 ) ) );
+		const auto tokens = makeTokens( vocabulary );
+		nfx::string::StringPool pool;
+		std::vector<nfx::string::InternedString> stored;
+		stored.reserve( tokenCount );
+		for ( std::string_view token : tokens )
+		{
+			stored.push_back( pool.intern( token ) );
+		}
+		for ( auto _ : state )
+		{
+			std::size_t matches = 0;
+			for ( std::size_t i = 1; i < tokenCount; ++i )
+			{
+				matches += stored[i] == stored[i - 1];
+			}
+			::benchmark::DoNotOptimize( matches );
+		}
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( tokenCount - 1 ) );
+	}
+} // namespace nfx::string::benchmark
+
+//=====================================================================
+// Benchmarks registration
+//=====================================================================
+
+//----------------------------------------------
+// Storing tokens
+//----------------------------------------------
+
+BENCHMARK( nfx::string::benchmark::BM_STD_string_copy )
+	->Range( 8, 1 << 14 )
+	->Unit( benchmark::kNanosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_STD_unorderedSet_find )
+	->Range( 8, 1 << 14 )
+	->Unit( benchmark::kNanosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_StringPool_intern )
+	->Range( 8, 1 << 14 )
+	->Unit( benchmark::kNanosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_StringPool_intern_Threads )
+	->ThreadRange( 1, 8 )
+	->UseRealTime()
+	->Unit( benchmark::kNanosecond );
+
+//----------------------------------------------
+// Comparing stored tokens
+//----------------------------------------------
+
+BENCHMARK( nfx::string::benchmark::BM_STD_string_equals )
+	->Range( 8, 1 << 14 )
+	->Unit( benchmark::kNanosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_InternedString_equals )
+	->Range( 8, 1 << 14 )
+	->Unit( benchmark::kNanosecond );
+
+BENCHMARK_MAIN();
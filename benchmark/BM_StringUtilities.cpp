@@ -1,6 +1,10 @@
 /**
  * @file BM_StringUtilities.cpp
  * @brief Benchmark nfx::string::Utils performance vs standard library implementations
+ * @details Per-call latency on short literals (".../corpus:0", the published tables) and on
+ *          seeded short fields (".../corpus:1", see Corpus.h), followed by the throughput of the
+ *          whole-string functions over buffers of 8 B to 64 MiB, hot and cold in cache
+ *          (see Throughput.h)
  */
 
 #include <benchmark/benchmark.h>
@@ -15,6 +19,10 @@
 
 #include <nfx/string/Utils.h>
 
+#include "Corpus.h"
+#include "PerfCounters.h"
+#include "Throughput.h"
+
 namespace nfx::string::benchmark
 {
 	//=====================================================================
@@ -25,25 +33,66 @@ namespace nfx::string::benchmark
 	// Test data
 	//----------------------------------------------
 
-	static const std::vector<std::string_view> test_strings = {
-		"",
-		"a",
+	/** @brief Strings and patterns of the per-call benchmarks, each registered once per input set */
+	struct Inputs
+	{
+		std::vector<std::string_view> strings;
+		std::string_view prefix;
+		std::string_view suffix;
+		std::string_view substr;
+		std::vector<std::string_view> ints;
+		std::vector<std::string_view> doubles;
+	};
+
+	/** @brief The short literals the published result tables were measured on */
+	static const Inputs literalInputs{
+		{ "",
+			"a",
+			"Hello",
+			"Hello World",
+			"The quick brown fox jumps over the lazy dog",
+			"   whitespace test   ",
+			"12345",
+			"abc123def",
+			"UPPERCASE",
+			"lowercase",
+			"MixedCase",
+			"https://example.com/path?query=value",
+			"true",
+			"false",
+			"123456789",
+			"-987654321",
+			"3.14159",
+			"not_a_number" },
 		"Hello",
-		"Hello World",
-		"The quick brown fox jumps over the lazy dog",
-		"   whitespace test   ",
-		"12345",
-		"abc123def",
-		"UPPERCASE",
-		"lowercase",
-		"MixedCase",
-		"https://example.com/path?query=value",
-		"true",
-		"false",
-		"123456789",
-		"-987654321",
-		"3.14159",
-		"not_a_number" };
+		"dog",
+		"fox",
+		{ "123", "-456", "0", "999999", "not_a_number" },
+		{ "3.14", "-2.718", "0.0", "1e6", "not_a_number" } };
+
+	/** @brief Seeded short strings: log fields, CSV values, header names, addresses, numbers, padded and empty values */
+	static const std::vector<std::string> corpusFields = corpus::fields( 256 );
+	static const std::vector<std::string> corpusInts = corpus::numbers( 256, 0.0, 0.1 );
+	static const std::vector<std::string> corpusDoubles = corpus::numbers( 256, 0.7, 0.1 );
+
+	/** @brief Corpus fields with patterns that occur in part of them (see Corpus.h) */
+	static const Inputs corpusInputs{
+		std::vector<std::string_view>( corpusFields.begin(), corpusFields.end() ),
+		"/api/",
+		".com",
+		"api",
+		std::vector<std::string_view>( corpusInts.begin(), corpusInts.end() ),
+		std::vector<std::string_view>( corpusDoubles.begin(), corpusDoubles.end() ) };
+
+	/**
+	 * @brief Input set of a per-call benchmark run
+	 * @param state Benchmark state whose "corpus" argument is 0 for the literals and 1 for the corpus
+	 * @return The selected input set
+	 */
+	static const Inputs& inputSet( const ::benchmark::State& state )
+	{
+		return state.range( 0 ) == 0 ? literalInputs : corpusInputs;
+	}
 
 	static const std::vector<char> test_chars = {
 		'a', 'Z', '5', ' ', '\t', '\n', '!', '@', '#', '_', '-', '.', '~' };
@@ -58,6 +107,7 @@ namespace nfx::string::benchmark
 
 	static void BM_Std_isspace( ::benchmark::State& state )
 	{
+		PerfCounters perfCounters;
 		for ( auto _ : state )
 		{
 			for ( char c : test_chars )
@@ -66,10 +116,12 @@ namespace nfx::string::benchmark
 				::benchmark::DoNotOptimize( result );
 			}
 		}
+		perfCounters.report( state );
 	}
 
 	static void BM_NFX_isWhitespace( ::benchmark::State& state )
 	{
+		PerfCounters perfCounters;
 		for ( auto _ : state )
 		{
 			for ( char c : test_chars )
@@ -78,6 +130,7 @@ namespace nfx::string::benchmark
 				::benchmark::DoNotOptimize( result );
 			}
 		}
+		perfCounters.report( state );
 	}
 
 	//----------------------------
@@ -86,6 +139,7 @@ namespace nfx::string::benchmark
 
 	static void BM_Std_isdigit( ::benchmark::State& state )
 	{
+		PerfCounters perfCounters;
 		for ( auto _ : state )
 		{
 			for ( char c : test_chars )
@@ -94,10 +148,12 @@ namespace nfx::string::benchmark
 				::benchmark::DoNotOptimize( result );
 			}
 		}
+		perfCounters.report( state );
 	}
 
 	static void BM_NFX_isDigit( ::benchmark::State& state )
 	{
+		PerfCounters perfCounters;
 		for ( auto _ : state )
 		{
 			for ( char c : test_chars )
@@ -106,6 +162,7 @@ namespace nfx::string::benchmark
 				::benchmark::DoNotOptimize( result );
 			}
 		}
+		perfCounters.report( state );
 	}
 
 	//----------------------------
@@ -114,6 +171,7 @@ namespace nfx::string::benchmark
 
 	static void BM_Std_isalpha( ::benchmark::State& state )
 	{
+		PerfCounters perfCounters;
 		for ( auto _ : state )
 		{
 			for ( char c : test_chars )
@@ -122,10 +180,12 @@ namespace nfx::string::benchmark
 				::benchmark::DoNotOptimize( result );
 			}
 		}
+		perfCounters.report( state );
 	}
 
 	static void BM_NFX_isAlpha( ::benchmark::State& state )
 	{
+		PerfCounters perfCounters;
 		for ( auto _ : state )
 		{
 			for ( char c : test_chars )
@@ -134,6 +194,7 @@ namespace nfx::string::benchmark
 				::benchmark::DoNotOptimize( result );
 			}
 		}
+		perfCounters.report( state );
 	}
 
 	//----------------------------------------------
@@ -146,26 +207,32 @@ namespace nfx::string::benchmark
 
 	static void BM_Std_empty( ::benchmark::State& state )
 	{
+		const Inputs& inputs = inputSet( state );
+		PerfCounters perfCounters;
 		for ( auto _ : state )
 		{
-			for ( const auto& str : test_strings )
+			for ( const auto& str : inputs.strings )
 			{
 				bool result = str.empty();
 				::benchmark::DoNotOptimize( result );
 			}
 		}
+		perfCounters.report( state );
 	}
 
 	static void BM_NFX_isEmpty( ::benchmark::State& state )
 	{
+		const Inputs& inputs = inputSet( state );
+		PerfCounters perfCounters;
 		for ( auto _ : state )
 		{
-			for ( const auto& str : test_strings )
+			for ( const auto& str : inputs.strings )
 			{
 				bool result = nfx::string::isEmpty( str );
 				::benchmark::DoNotOptimize( result );
 			}
 		}
+		perfCounters.report( state );
 	}
 
 	//----------------------------
@@ -174,27 +241,33 @@ namespace nfx::string::benchmark
 
 	static void BM_Manual_isNullOrWhiteSpace( ::benchmark::State& state )
 	{
+		const Inputs& inputs = inputSet( state );
+		PerfCounters perfCounters;
 		for ( auto _ : state )
 		{
-			for ( const auto& str : test_strings )
+			for ( const auto& str : inputs.strings )
 			{
 				bool result = str.empty() || std::all_of( str.begin(), str.end(),
 												 []( char c ) { return std::isspace( static_cast<unsigned char>( c ) ); } );
 				::benchmark::DoNotOptimize( result );
 			}
 		}
+		perfCounters.report( state );
 	}
 
 	static void BM_NFX_isNullOrWhiteSpace( ::benchmark::State& state )
 	{
+		const Inputs& inputs = inputSet( state );
+		PerfCounters perfCounters;
 		for ( auto _ : state )
 		{
-			for ( const auto& str : test_strings )
+			for ( const auto& str : inputs.strings )
 			{
 				bool result = nfx::string::isNullOrWhiteSpace( str );
 				::benchmark::DoNotOptimize( result );
 			}
 		}
+		perfCounters.report( state );
 	}
 
 	//----------------------------
@@ -203,27 +276,33 @@ namespace nfx::string::benchmark
 
 	static void BM_Manual_isAllDigits( ::benchmark::State& state )
 	{
+		const Inputs& inputs = inputSet( state );
+		PerfCounters perfCounters;
 		for ( auto _ : state )
 		{
-			for ( const auto& str : test_strings )
+			for ( const auto& str : inputs.strings )
 			{
 				bool result = !str.empty() && std::all_of( str.begin(), str.end(),
 												  []( char c ) { return std::isdigit( static_cast<unsigned char>( c ) ); } );
 				::benchmark::DoNotOptimize( result );
 			}
 		}
+		perfCounters.report( state );
 	}
 
 	static void BM_NFX_isAllDigits( ::benchmark::State& state )
 	{
+		const Inputs& inputs = inputSet( state );
+		PerfCounters perfCounters;
 		for ( auto _ : state )
 		{
-			for ( const auto& str : test_strings )
+			for ( const auto& str : inputs.strings )
 			{
 				bool result = nfx::string::isAllDigits( str );
 				::benchmark::DoNotOptimize( result );
 			}
 		}
+		perfCounters.report( state );
 	}
 
 	//----------------------------------------------
@@ -236,28 +315,32 @@ namespace nfx::string::benchmark
 
 	static void BM_Std_starts_with( ::benchmark::State& state )
 	{
-		const std::string_view prefix = "Hello";
+		const Inputs& inputs = inputSet( state );
+		PerfCounters perfCounters;
 		for ( auto _ : state )
 		{
-			for ( const auto& str : test_strings )
+			for ( const auto& str : inputs.strings )
 			{
-				bool result = str.starts_with( prefix );
+				bool result = str.starts_with( inputs.prefix );
 				::benchmark::DoNotOptimize( result );
 			}
 		}
+		perfCounters.report( state );
 	}
 
 	static void BM_NFX_startsWith( ::benchmark::State& state )
 	{
-		const std::string_view prefix = "Hello";
+		const Inputs& inputs = inputSet( state );
+		PerfCounters perfCounters;
 		for ( auto _ : state )
 		{
-			for ( const auto& str : test_strings )
+			for ( const auto& str : inputs.strings )
 			{
-				bool result = nfx::string::startsWith( str, prefix );
+				bool result = nfx::string::startsWith( str, inputs.prefix );
 				::benchmark::DoNotOptimize( result );
 			}
 		}
+		perfCounters.report( state );
 	}
 
 	//----------------------------
@@ -266,28 +349,32 @@ namespace nfx::string::benchmark
 
 	static void BM_Std_ends_with( ::benchmark::State& state )
 	{
-		const std::string_view suffix = "dog";
+		const Inputs& inputs = inputSet( state );
+		PerfCounters perfCounters;
 		for ( auto _ : state )
 		{
-			for ( const auto& str : test_strings )
+			for ( const auto& str : inputs.strings )
 			{
-				bool result = str.ends_with( suffix );
+				bool result = str.ends_with( inputs.suffix );
 				::benchmark::DoNotOptimize( result );
 			}
 		}
+		perfCounters.report( state );
 	}
 
 	static void BM_NFX_endsWith( ::benchmark::State& state )
 	{
-		const std::string_view suffix = "dog";
+		const Inputs& inputs = inputSet( state );
+		PerfCounters perfCounters;
 		for ( auto _ : state )
 		{
-			for ( const auto& str : test_strings )
+			for ( const auto& str : inputs.strings )
 			{
-				bool result = nfx::string::endsWith( str, suffix );
+				bool result = nfx::string::endsWith( str, inputs.suffix );
 				::benchmark::DoNotOptimize( result );
 			}
 		}
+		perfCounters.report( state );
 	}
 
 	//----------------------------
@@ -296,28 +383,95 @@ namespace nfx::string::benchmark
 
 	static void BM_Std_contains( ::benchmark::State& state )
 	{
-		const std::string_view substr = "fox";
+		const Inputs& inputs = inputSet( state );
+		PerfCounters perfCounters;
 		for ( auto _ : state )
 		{
-			for ( const auto& str : test_strings )
+			for ( const auto& str : inputs.strings )
 			{
-				bool result = str.find( substr ) != std::string_view::npos;
+				bool result = str.find( inputs.substr ) != std::string_view::npos;
 				::benchmark::DoNotOptimize( result );
 			}
 		}
+		perfCounters.report( state );
 	}
 
 	static void BM_NFX_contains( ::benchmark::State& state )
 	{
-		const std::string_view substr = "fox";
+		const Inputs& inputs = inputSet( state );
+		PerfCounters perfCounters;
 		for ( auto _ : state )
 		{
-			for ( const auto& str : test_strings )
+			for ( const auto& str : inputs.strings )
 			{
-				bool result = nfx::string::contains( str, substr );
+				bool result = nfx::string::contains( str, inputs.substr );
 				::benchmark::DoNotOptimize( result );
 			}
 		}
+		perfCounters.report( state );
+	}
+
+	//----------------------------
+	// Common prefix
+	//----------------------------
+
+	/** @brief Route keys sharing a long prefix and differing near their ends */
+	static std::vector<std::string> makeRouteKeys( std::size_t count )
+	{
+		std::vector<std::string> keys;
+		keys.reserve( count );
+		for ( std::size_t i = 0; i < count; ++i )
+		{
+			keys.push_back( "/api/v2/tenants/eu-west-1/services/inventory/items/" + std::to_string( 100000 + i ) );
+		}
+		return keys;
+	}
+
+	static void BM_Std_mismatch( ::benchmark::State& state )
+	{
+		const auto keys = makeRouteKeys( 1024 );
+		PerfCounters perfCounters;
+		for ( auto _ : state )
+		{
+			std::size_t total = 0;
+			for ( std::size_t i = 1; i < keys.size(); ++i )
+			{
+				const std::size_t size = std::min( keys[i - 1].size(), keys[i].size() );
+				total += static_cast<std::size_t>(
+					std::mismatch( keys[i - 1].begin(), keys[i - 1].begin() + static_cast<std::ptrdiff_t>( size ), keys[i].begin() ).first -
+					keys[i - 1].begin() );
+			}
+			::benchmark::DoNotOptimize( total );
+		}
+		perfCounters.report( state );
+	}
+
+	static void BM_NFX_commonPrefix( ::benchmark::State& state )
+	{
+		const auto keys = makeRouteKeys( 1024 );
+		PerfCounters perfCounters;
+		for ( auto _ : state )
+		{
+			std::size_t total = 0;
+			for ( std::size_t i = 1; i < keys.size(); ++i )
+			{
+				total += nfx::string::commonPrefix( keys[i - 1], keys[i] ).size();
+			}
+			::benchmark::DoNotOptimize( total );
+		}
+		perfCounters.report( state );
+	}
+
+	static void BM_NFX_commonPrefix_set( ::benchmark::State& state )
+	{
+		const auto keys = makeRouteKeys( 1024 );
+		const std::vector<std::string_view> views( keys.begin(), keys.end() );
+		PerfCounters perfCounters;
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( nfx::string::commonPrefix( views ) );
+		}
+		perfCounters.report( state );
 	}
 
 	//----------------------------------------------
@@ -326,9 +480,11 @@ namespace nfx::string::benchmark
 
 	static void BM_Manual_trim( ::benchmark::State& state )
 	{
+		const Inputs& inputs = inputSet( state );
+		PerfCounters perfCounters;
 		for ( auto _ : state )
 		{
-			for ( const auto& str : test_strings )
+			for ( const auto& str : inputs.strings )
 			{
 				auto start = str.find_first_not_of( " \t\n\r\f\v" );
 				if ( start == std::string_view::npos )
@@ -342,18 +498,22 @@ namespace nfx::string::benchmark
 				::benchmark::DoNotOptimize( result );
 			}
 		}
+		perfCounters.report( state );
 	}
 
 	static void BM_NFX_trim( ::benchmark::State& state )
 	{
+		const Inputs& inputs = inputSet( state );
+		PerfCounters perfCounters;
 		for ( auto _ : state )
 		{
-			for ( const auto& str : test_strings )
+			for ( const auto& str : inputs.strings )
 			{
 				auto result = nfx::string::trim( str );
 				::benchmark::DoNotOptimize( result );
 			}
 		}
+		perfCounters.report( state );
 	}
 
 	//----------------------------------------------
@@ -366,6 +526,7 @@ namespace nfx::string::benchmark
 
 	static void BM_Std_tolower( ::benchmark::State& state )
 	{
+		PerfCounters perfCounters;
 		for ( auto _ : state )
 		{
 			for ( char c : test_chars )
@@ -374,13 +535,16 @@ namespace nfx::string::benchmark
 				::benchmark::DoNotOptimize( result );
 			}
 		}
+		perfCounters.report( state );
 	}
 
 	static void BM_Std_transform_tolower( ::benchmark::State& state )
 	{
+		const Inputs& inputs = inputSet( state );
+		PerfCounters perfCounters;
 		for ( auto _ : state )
 		{
-			for ( const auto& str : test_strings )
+			for ( const auto& str : inputs.strings )
 			{
 				std::string result{ str };
 				std::transform( result.begin(), result.end(), result.begin(),
@@ -388,10 +552,12 @@ namespace nfx::string::benchmark
 				::benchmark::DoNotOptimize( result );
 			}
 		}
+		perfCounters.report( state );
 	}
 
 	static void BM_NFX_toLower_char( ::benchmark::State& state )
 	{
+		PerfCounters perfCounters;
 		for ( auto _ : state )
 		{
 			for ( char c : test_chars )
@@ -400,18 +566,22 @@ namespace nfx::string::benchmark
 				::benchmark::DoNotOptimize( result );
 			}
 		}
+		perfCounters.report( state );
 	}
 
 	static void BM_NFX_toLower_string( ::benchmark::State& state )
 	{
+		const Inputs& inputs = inputSet( state );
+		PerfCounters perfCounters;
 		for ( auto _ : state )
 		{
-			for ( const auto& str : test_strings )
+			for ( const auto& str : inputs.strings )
 			{
 				auto result = nfx::string::toLower( str );
 				::benchmark::DoNotOptimize( result );
 			}
 		}
+		perfCounters.report( state );
 	}
 
 	//----------------------------
@@ -420,6 +590,7 @@ namespace nfx::string::benchmark
 
 	static void BM_Std_toupper( ::benchmark::State& state )
 	{
+		PerfCounters perfCounters;
 		for ( auto _ : state )
 		{
 			for ( char c : test_chars )
@@ -428,13 +599,16 @@ namespace nfx::string::benchmark
 				::benchmark::DoNotOptimize( result );
 			}
 		}
+		perfCounters.report( state );
 	}
 
 	static void BM_Std_transform_toupper( ::benchmark::State& state )
 	{
+		const Inputs& inputs = inputSet( state );
+		PerfCounters perfCounters;
 		for ( auto _ : state )
 		{
-			for ( const auto& str : test_strings )
+			for ( const auto& str : inputs.strings )
 			{
 				std::string result{ str };
 				std::transform( result.begin(), result.end(), result.begin(),
@@ -442,10 +616,12 @@ namespace nfx::string::benchmark
 				::benchmark::DoNotOptimize( result );
 			}
 		}
+		perfCounters.report( state );
 	}
 
 	static void BM_NFX_toUpper_char( ::benchmark::State& state )
 	{
+		PerfCounters perfCounters;
 		for ( auto _ : state )
 		{
 			for ( char c : test_chars )
@@ -454,18 +630,22 @@ namespace nfx::string::benchmark
 				::benchmark::DoNotOptimize( result );
 			}
 		}
+		perfCounters.report( state );
 	}
 
 	static void BM_NFX_toUpper_string( ::benchmark::State& state )
 	{
+		const Inputs& inputs = inputSet( state );
+		PerfCounters perfCounters;
 		for ( auto _ : state )
 		{
-			for ( const auto& str : test_strings )
+			for ( const auto& str : inputs.strings )
 			{
 				auto result = nfx::string::toUpper( str );
 				::benchmark::DoNotOptimize( result );
 			}
 		}
+		perfCounters.report( state );
 	}
 
 	//----------------------------------------------
@@ -478,10 +658,11 @@ namespace nfx::string::benchmark
 
 	static void BM_Std_from_chars_int( ::benchmark::State& state )
 	{
-		const std::vector<std::string_view> int_strings = { "123", "-456", "0", "999999", "not_a_number" };
+		const Inputs& inputs = inputSet( state );
+		PerfCounters perfCounters;
 		for ( auto _ : state )
 		{
-			for ( const auto& str : int_strings )
+			for ( const auto& str : inputs.ints )
 			{
 				int result;
 				auto [ptr, ec] = std::from_chars( str.data(), str.data() + str.size(), result );
@@ -490,14 +671,16 @@ namespace nfx::string::benchmark
 				::benchmark::DoNotOptimize( result );
 			}
 		}
+		perfCounters.report( state );
 	}
 
 	static void BM_NFX_tryParseInt( ::benchmark::State& state )
 	{
-		const std::vector<std::string_view> int_strings = { "123", "-456", "0", "999999", "not_a_number" };
+		const Inputs& inputs = inputSet( state );
+		PerfCounters perfCounters;
 		for ( auto _ : state )
 		{
-			for ( const auto& str : int_strings )
+			for ( const auto& str : inputs.ints )
 			{
 				int result;
 				bool success = nfx::string::tryParseInt( str, result );
@@ -505,6 +688,7 @@ namespace nfx::string::benchmark
 				::benchmark::DoNotOptimize( result );
 			}
 		}
+		perfCounters.report( state );
 	}
 
 	//----------------------------
@@ -513,10 +697,11 @@ namespace nfx::string::benchmark
 
 	static void BM_Std_from_chars_double( ::benchmark::State& state )
 	{
-		const std::vector<std::string_view> double_strings = { "3.14", "-2.718", "0.0", "1e6", "not_a_number" };
+		const Inputs& inputs = inputSet( state );
+		PerfCounters perfCounters;
 		for ( auto _ : state )
 		{
-			for ( const auto& str : double_strings )
+			for ( const auto& str : inputs.doubles )
 			{
 				double result;
 				auto [ptr, ec] = std::from_chars( str.data(), str.data() + str.size(), result );
@@ -525,14 +710,16 @@ namespace nfx::string::benchmark
 				::benchmark::DoNotOptimize( result );
 			}
 		}
+		perfCounters.report( state );
 	}
 
 	static void BM_NFX_tryParseDouble( ::benchmark::State& state )
 	{
-		const std::vector<std::string_view> double_strings = { "3.14", "-2.718", "0.0", "1e6", "not_a_number" };
+		const Inputs& inputs = inputSet( state );
+		PerfCounters perfCounters;
 		for ( auto _ : state )
 		{
-			for ( const auto& str : double_strings )
+			for ( const auto& str : inputs.doubles )
 			{
 				double result;
 				bool success = nfx::string::tryParseDouble( str, result );
@@ -540,6 +727,7 @@ namespace nfx::string::benchmark
 				::benchmark::DoNotOptimize( result );
 			}
 		}
+		perfCounters.report( state );
 	}
 
 	//----------------------------------------------
@@ -552,6 +740,7 @@ namespace nfx::string::benchmark
 
 	static void BM_Manual_isURIReserved( ::benchmark::State& state )
 	{
+		PerfCounters perfCounters;
 		for ( auto _ : state )
 		{
 			for ( char c : test_chars )
@@ -563,10 +752,12 @@ namespace nfx::string::benchmark
 				::benchmark::DoNotOptimize( result );
 			}
 		}
+		perfCounters.report( state );
 	}
 
 	static void BM_NFX_isURIReserved( ::benchmark::State& state )
 	{
+		PerfCounters perfCounters;
 		for ( auto _ : state )
 		{
 			for ( char c : test_chars )
@@ -575,6 +766,7 @@ namespace nfx::string::benchmark
 				::benchmark::DoNotOptimize( result );
 			}
 		}
+		perfCounters.report( state );
 	}
 
 	//----------------------------
@@ -583,6 +775,7 @@ namespace nfx::string::benchmark
 
 	static void BM_Manual_isURIUnreserved( ::benchmark::State& state )
 	{
+		PerfCounters perfCounters;
 		for ( auto _ : state )
 		{
 			for ( char c : test_chars )
@@ -593,10 +786,12 @@ namespace nfx::string::benchmark
 				::benchmark::DoNotOptimize( result );
 			}
 		}
+		perfCounters.report( state );
 	}
 
 	static void BM_NFX_isURIUnreserved( ::benchmark::State& state )
 	{
+		PerfCounters perfCounters;
 		for ( auto _ : state )
 		{
 			for ( char c : test_chars )
@@ -605,6 +800,157 @@ namespace nfx::string::benchmark
 				::benchmark::DoNotOptimize( result );
 			}
 		}
+		perfCounters.report( state );
+	}
+
+	//----------------------------------------------
+	// Throughput
+	//----------------------------------------------
+
+	//----------------------------
+	// Null or whitespace
+	//----------------------------
+
+	static void BM_Manual_isNullOrWhiteSpace_throughput( ::benchmark::State& state )
+	{
+		runThroughput( state, Fill::Spaces, []( std::string_view str ) {
+			return str.empty() || std::all_of( str.begin(), str.end(), []( char c ) { return std::isspace( static_cast<unsigned char>( c ) ); } );
+		} );
+	}
+
+	static void BM_NFX_isNullOrWhiteSpace_throughput( ::benchmark::State& state )
+	{
+		runThroughput( state, Fill::Spaces, []( std::string_view str ) { return nfx::string::isNullOrWhiteSpace( str ); } );
+	}
+
+	//----------------------------
+	// All digits
+	//----------------------------
+
+	static void BM_Manual_isAllDigits_throughput( ::benchmark::State& state )
+	{
+		runThroughput( state, Fill::Digits, []( std::string_view str ) {
+			return !str.empty() && std::all_of( str.begin(), str.end(), []( char c ) { return std::isdigit( static_cast<unsigned char>( c ) ); } );
+		} );
+	}
+
+	static void BM_NFX_isAllDigits_throughput( ::benchmark::State& state )
+	{
+		runThroughput( state, Fill::Digits, []( std::string_view str ) { return nfx::string::isAllDigits( str ); } );
+	}
+
+	//----------------------------
+	// Contains
+	//----------------------------
+
+	/** @brief Needle absent from Fill::Text buffers, which hold no line breaks, so the whole buffer is searched */
+	static constexpr std::string_view kAbsentNeedle{ "needle\n" };
+
+	static void BM_Std_contains_throughput( ::benchmark::State& state )
+	{
+		runThroughput( state, Fill::Text, []( std::string_view str ) { return str.find( kAbsentNeedle ) != std::string_view::npos; } );
+	}
+
+	static void BM_NFX_contains_throughput( ::benchmark::State& state )
+	{
+		runThroughput( state, Fill::Text, []( std::string_view str ) { return nfx::string::contains( str, kAbsentNeedle ); } );
+	}
+
+	//----------------------------
+	// Count
+	//----------------------------
+
+	static void BM_Std_count_throughput( ::benchmark::State& state )
+	{
+		runThroughput( state, Fill::Text, []( std::string_view str ) { return std::count( str.begin(), str.end(), ' ' ); } );
+	}
+
+	static void BM_NFX_count_throughput( ::benchmark::State& state )
+	{
+		runThroughput( state, Fill::Text, []( std::string_view str ) { return nfx::string::count( str, ' ' ); } );
+	}
+
+	//----------------------------
+	// Count any
+	//----------------------------
+
+	/** @brief Field and token separators, about one Fill::Text byte in twenty */
+	static constexpr CharClass kSeparators{ ",;: " };
+
+	static void BM_Manual_countAny_throughput( ::benchmark::State& state )
+	{
+		runThroughput( state, Fill::Text, []( std::string_view str ) {
+			std::size_t separators = 0;
+			for ( char c : str )
+			{
+				separators += c == ',' || c == ';' || c == ':' || c == ' ';
+			}
+			return separators;
+		} );
+	}
+
+	static void BM_NFX_countAny_throughput( ::benchmark::State& state )
+	{
+		runThroughput( state, Fill::Text, []( std::string_view str ) { return nfx::string::countAny( str, kSeparators ); } );
+	}
+
+	//----------------------------
+	// Trim
+	//----------------------------
+
+	static void BM_Manual_trim_throughput( ::benchmark::State& state )
+	{
+		runThroughput( state, Fill::Spaces, []( std::string_view str ) {
+			const auto start = str.find_first_not_of( " \t\n\r\f\v" );
+			if ( start == std::string_view::npos )
+			{
+				return std::string_view{};
+			}
+			return str.substr( start, str.find_last_not_of( " \t\n\r\f\v" ) - start + 1 );
+		} );
+	}
+
+	static void BM_NFX_trim_throughput( ::benchmark::State& state )
+	{
+		runThroughput( state, Fill::Spaces, []( std::string_view str ) { return nfx::string::trim( str ); } );
+	}
+
+	//----------------------------
+	// To lower
+	//----------------------------
+
+	static void BM_Std_transform_tolower_throughput( ::benchmark::State& state )
+	{
+		runThroughput( state, Fill::Text, []( std::string_view str ) {
+			std::string result{ str };
+			std::transform( result.begin(), result.end(), result.begin(),
+				[]( unsigned char c ) { return static_cast<char>( std::tolower( c ) ); } );
+			return result;
+		} );
+	}
+
+	static void BM_NFX_toLower_throughput( ::benchmark::State& state )
+	{
+		runThroughput( state, Fill::Text, []( std::string_view str ) { return nfx::string::toLower( str ); } );
+	}
+
+	//----------------------------
+	// To upper
+	//----------------------------
+
+	static void BM_Std_transform_toupper_throughput( ::benchmark::State& state )
+	{
+		runThroughput( state, Fill::Text, []( std::string_view str ) {
+			std::string result{ str };
+			std::transform( result.begin(), result.end(), result.begin(),
+				[]( unsigned char c ) { return static_cast<char>( std::toupper( c ) ); } );
+			return result;
+		} );
+	}
+
+	static void BM_NFX_toUpper_throughput( ::benchmark::State& state )
+	{
+		runThroughput( state, Fill::Text, []( std::string_view str ) { return nfx::string::toUpper( str ); } );
 	}
 } // namespace nfx::string::benchmark
 
@@ -661,10 +1007,16 @@ BENCHMARK( nfx::string::benchmark::BM_NFX_isAlpha )
 //----------------------------
 
 BENCHMARK( nfx::string::benchmark::BM_Std_empty )
+	->ArgName( "corpus" )
+	->Arg( 0 )
+	->Arg( 1 )
 	->MinTime( 1.0 )
 	->Unit( benchmark::kNanosecond );
 
 BENCHMARK( nfx::string::benchmark::BM_NFX_isEmpty )
+	->ArgName( "corpus" )
+	->Arg( 0 )
+	->Arg( 1 )
 	->MinTime( 1.0 )
 	->Unit( benchmark::kNanosecond );
 
@@ -673,10 +1025,16 @@ BENCHMARK( nfx::string::benchmark::BM_NFX_isEmpty )
 //----------------------------
 
 BENCHMARK( nfx::string::benchmark::BM_Manual_isNullOrWhiteSpace )
+	->ArgName( "corpus" )
+	->Arg( 0 )
+	->Arg( 1 )
 	->MinTime( 1.0 )
 	->Unit( benchmark::kNanosecond );
 
 BENCHMARK( nfx::string::benchmark::BM_NFX_isNullOrWhiteSpace )
+	->ArgName( "corpus" )
+	->Arg( 0 )
+	->Arg( 1 )
 	->MinTime( 1.0 )
 	->Unit( benchmark::kNanosecond );
 
@@ -685,10 +1043,16 @@ BENCHMARK( nfx::string::benchmark::BM_NFX_isNullOrWhiteSpace )
 //----------------------------
 
 BENCHMARK( nfx::string::benchmark::BM_Manual_isAllDigits )
+	->ArgName( "corpus" )
+	->Arg( 0 )
+	->Arg( 1 )
 	->MinTime( 1.0 )
 	->Unit( benchmark::kNanosecond );
 
 BENCHMARK( nfx::string::benchmark::BM_NFX_isAllDigits )
+	->ArgName( "corpus" )
+	->Arg( 0 )
+	->Arg( 1 )
 	->MinTime( 1.0 )
 	->Unit( benchmark::kNanosecond );
 
@@ -701,10 +1065,16 @@ BENCHMARK( nfx::string::benchmark::BM_NFX_isAllDigits )
 //----------------------------
 
 BENCHMARK( nfx::string::benchmark::BM_Std_starts_with )
+	->ArgName( "corpus" )
+	->Arg( 0 )
+	->Arg( 1 )
 	->MinTime( 1.0 )
 	->Unit( benchmark::kNanosecond );
 
 BENCHMARK( nfx::string::benchmark::BM_NFX_startsWith )
+	->ArgName( "corpus" )
+	->Arg( 0 )
+	->Arg( 1 )
 	->MinTime( 1.0 )
 	->Unit( benchmark::kNanosecond );
 
@@ -713,10 +1083,16 @@ BENCHMARK( nfx::string::benchmark::BM_NFX_startsWith )
 //----------------------------
 
 BENCHMARK( nfx::string::benchmark::BM_Std_ends_with )
+	->ArgName( "corpus" )
+	->Arg( 0 )
+	->Arg( 1 )
 	->MinTime( 1.0 )
 	->Unit( benchmark::kNanosecond );
 
 BENCHMARK( nfx::string::benchmark::BM_NFX_endsWith )
+	->ArgName( "corpus" )
+	->Arg( 0 )
+	->Arg( 1 )
 	->MinTime( 1.0 )
 	->Unit( benchmark::kNanosecond );
 
@@ -725,22 +1101,47 @@ BENCHMARK( nfx::string::benchmark::BM_NFX_endsWith )
 //----------------------------
 
 BENCHMARK( nfx::string::benchmark::BM_Std_contains )
+	->ArgName( "corpus" )
+	->Arg( 0 )
+	->Arg( 1 )
 	->MinTime( 1.0 )
 	->Unit( benchmark::kNanosecond );
 
 BENCHMARK( nfx::string::benchmark::BM_NFX_contains )
+	->ArgName( "corpus" )
+	->Arg( 0 )
+	->Arg( 1 )
 	->MinTime( 1.0 )
 	->Unit( benchmark::kNanosecond );
 
+//----------------------------
+// Common prefix
+//----------------------------
+
+BENCHMARK( nfx::string::benchmark::BM_Std_mismatch )
+	->Unit( benchmark::kMicrosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_commonPrefix )
+	->Unit( benchmark::kMicrosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_commonPrefix_set )
+	->Unit( benchmark::kMicrosecond );
+
 //----------------------------------------------
 // String Trimming
 //----------------------------------------------
 
 BENCHMARK( nfx::string::benchmark::BM_Manual_trim )
+	->ArgName( "corpus" )
+	->Arg( 0 )
+	->Arg( 1 )
 	->MinTime( 1.0 )
 	->Unit( benchmark::kNanosecond );
 
 BENCHMARK( nfx::string::benchmark::BM_NFX_trim )
+	->ArgName( "corpus" )
+	->Arg( 0 )
+	->Arg( 1 )
 	->MinTime( 1.0 )
 	->Unit( benchmark::kNanosecond );
 
@@ -757,6 +1158,9 @@ BENCHMARK( nfx::string::benchmark::BM_Std_tolower )
 	->Unit( benchmark::kNanosecond );
 
 BENCHMARK( nfx::string::benchmark::BM_Std_transform_tolower )
+	->ArgName( "corpus" )
+	->Arg( 0 )
+	->Arg( 1 )
 	->MinTime( 1.0 )
 	->Unit( benchmark::kNanosecond );
 
@@ -765,6 +1169,9 @@ BENCHMARK( nfx::string::benchmark::BM_NFX_toLower_char )
 	->Unit( benchmark::kNanosecond );
 
 BENCHMARK( nfx::string::benchmark::BM_NFX_toLower_string )
+	->ArgName( "corpus" )
+	->Arg( 0 )
+	->Arg( 1 )
 	->MinTime( 1.0 )
 	->Unit( benchmark::kNanosecond );
 
@@ -777,6 +1184,9 @@ BENCHMARK( nfx::string::benchmark::BM_Std_toupper )
 	->Unit( benchmark::kNanosecond );
 
 BENCHMARK( nfx::string::benchmark::BM_Std_transform_toupper )
+	->ArgName( "corpus" )
+	->Arg( 0 )
+	->Arg( 1 )
 	->MinTime( 1.0 )
 	->Unit( benchmark::kNanosecond );
 
@@ -785,6 +1195,9 @@ BENCHMARK( nfx::string::benchmark::BM_NFX_toUpper_char )
 	->Unit( benchmark::kNanosecond );
 
 BENCHMARK( nfx::string::benchmark::BM_NFX_toUpper_string )
+	->ArgName( "corpus" )
+	->Arg( 0 )
+	->Arg( 1 )
 	->MinTime( 1.0 )
 	->Unit( benchmark::kNanosecond );
 
@@ -797,10 +1210,16 @@ BENCHMARK( nfx::string::benchmark::BM_NFX_toUpper_string )
 //----------------------------
 
 BENCHMARK( nfx::string::benchmark::BM_Std_from_chars_int )
+	->ArgName( "corpus" )
+	->Arg( 0 )
+	->Arg( 1 )
 	->MinTime( 1.0 )
 	->Unit( benchmark::kNanosecond );
 
 BENCHMARK( nfx::string::benchmark::BM_NFX_tryParseInt )
+	->ArgName( "corpus" )
+	->Arg( 0 )
+	->Arg( 1 )
 	->MinTime( 1.0 )
 	->Unit( benchmark::kNanosecond );
 
@@ -809,10 +1228,16 @@ BENCHMARK( nfx::string::benchmark::BM_NFX_tryParseInt )
 //----------------------------
 
 BENCHMARK( nfx::string::benchmark::BM_Std_from_chars_double )
+	->ArgName( "corpus" )
+	->Arg( 0 )
+	->Arg( 1 )
 	->MinTime( 1.0 )
 	->Unit( benchmark::kNanosecond );
 
 BENCHMARK( nfx::string::benchmark::BM_NFX_tryParseDouble )
+	->ArgName( "corpus" )
+	->Arg( 0 )
+	->Arg( 1 )
 	->MinTime( 1.0 )
 	->Unit( benchmark::kNanosecond );
 
@@ -844,4 +1269,104 @@ BENCHMARK( nfx::string::benchmark::BM_NFX_isURIUnreserved )
 	->MinTime( 1.0 )
 	->Unit( benchmark::kNanosecond );
 
+//----------------------------------------------
+// Throughput
+//----------------------------------------------
+
+//----------------------------
+// Null or whitespace
+//----------------------------
+
+BENCHMARK( nfx::string::benchmark::BM_Manual_isNullOrWhiteSpace_throughput )
+	->Apply( nfx::string::benchmark::throughputArguments )
+	->Unit( benchmark::kNanosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_isNullOrWhiteSpace_throughput )
+	->Apply( nfx::string::benchmark::throughputArguments )
+	->Unit( benchmark::kNanosecond );
+
+//----------------------------
+// All digits
+//----------------------------
+
+BENCHMARK( nfx::string::benchmark::BM_Manual_isAllDigits_throughput )
+	->Apply( nfx::string::benchmark::throughputArguments )
+	->Unit( benchmark::kNanosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_isAllDigits_throughput )
+	->Apply( nfx::string::benchmark::throughputArguments )
+	->Unit( benchmark::kNanosecond );
+
+//----------------------------
+// Contains
+//----------------------------
+
+BENCHMARK( nfx::string::benchmark::BM_Std_contains_throughput )
+	->Apply( nfx::string::benchmark::throughputArguments )
+	->Unit( benchmark::kNanosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_contains_throughput )
+	->Apply( nfx::string::benchmark::throughputArguments )
+	->Unit( benchmark::kNanosecond );
+
+//----------------------------
+// Count
+//----------------------------
+
+BENCHMARK( nfx::string::benchmark::BM_Std_count_throughput )
+	->Apply( nfx::string::benchmark::throughputArguments )
+	->Unit( benchmark::kNanosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_count_throughput )
+	->Apply( nfx::string::benchmark::throughputArguments )
+	->Unit( benchmark::kNanosecond );
+
+//----------------------------
+// Count any
+//----------------------------
+
+BENCHMARK( nfx::string::benchmark::BM_Manual_countAny_throughput )
+	->Apply( nfx::string::benchmark::throughputArguments )
+	->Unit( benchmark::kNanosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_countAny_throughput )
+	->Apply( nfx::string::benchmark::throughputArguments )
+	->Unit( benchmark::kNanosecond );
+
+//----------------------------
+// Trim
+//----------------------------
+
+BENCHMARK( nfx::string::benchmark::BM_Manual_trim_throughput )
+	->Apply( nfx::string::benchmark::throughputArguments )
+	->Unit( benchmark::kNanosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_trim_throughput )
+	->Apply( nfx::string::benchmark::throughputArguments )
+	->Unit( benchmark::kNanosecond );
+
+//----------------------------
+// To lower
+//----------------------------
+
+BENCHMARK( nfx::string::benchmark::BM_Std_transform_tolower_throughput )
+	->Apply( nfx::string::benchmark::throughputArguments )
+	->Unit( benchmark::kNanosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_toLower_throughput )
+	->Apply( nfx::string::benchmark::throughputArguments )
+	->Unit( benchmark::kNanosecond );
+
+//----------------------------
+// To upper
+//----------------------------
+
+BENCHMARK( nfx::string::benchmark::BM_Std_transform_toupper_throughput )
+	->Apply( nfx::string::benchmark::throughputArguments )
+	->Unit( benchmark::kNanosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_toUpper_throughput )
+	->Apply( nfx::string::benchmark::throughputArguments )
+	->Unit( benchmark::kNanosecond );
+
 BENCHMARK_MAIN();
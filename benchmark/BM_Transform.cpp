@@ -0,0 +1,768 @@
+/**
+ * @file BM_Transform.cpp
+ * @brief Benchmark counting, replacement, joining, padding, comparison and field parsing vs
+ *        standard library calls and hand-written loops
+ * @details Inputs are a seeded combined-format access log and the fields extracted from it, and a
+ *          seeded DNA sequence for motif counting (see Corpus.h)
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nfx/string/Utils.h>
+
+#include "Allocations.h"
+#include "Corpus.h"
+
+namespace nfx::string::benchmark
+{
+	//=====================================================================
+	// Transform benchmark suite
+	//=====================================================================
+
+	//----------------------------------------------
+	// Test data
+	//----------------------------------------------
+
+	/** @brief Lines in the access log */
+	static constexpr std::size_t kLineCount{ 1024 };
+
+	/** @brief Seeded access log lines in combined format, followed by the request time in seconds */
+	static std::vector<std::string> makeAccessLog()
+	{
+		return corpus::accessLogLines( kLineCount );
+	}
+
+	/** @brief The access log as one newline-terminated buffer */
+	static std::string makeLogBuffer()
+	{
+		std::string buffer;
+		for ( const auto& line : makeAccessLog() )
+		{
+			buffer.append( line ).push_back( '\n' );
+		}
+		return buffer;
+	}
+
+	/** @brief Size of the DNA sequence */
+	static constexpr std::size_t kSequenceSize{ 1 << 20 };
+
+	/** @brief Pattern that almost matches at every base of a poly-A run, the worst case of a search restarted after each hit */
+	static constexpr std::string_view kPeriodicPattern{ "AAAAAAAAAAAAAAAAAAAAAAAAAAAAAATA" };
+
+	/** @brief Counts with a find() loop, resuming one byte or one pattern past each hit */
+	static std::size_t findLoopCount( std::string_view buffer, std::string_view substr, bool overlapping ) noexcept
+	{
+		std::size_t count = 0;
+		for ( std::size_t pos = buffer.find( substr ); pos != std::string_view::npos;
+			  pos = buffer.find( substr, pos + ( overlapping ? 1 : substr.size() ) ) )
+		{
+			++count;
+		}
+		return count;
+	}
+
+	/** @brief Space-separated field of every log line; fields inside quotes count as one per word */
+	static std::vector<std::string> logField( std::size_t field )
+	{
+		std::vector<std::string> values;
+		for ( const auto& line : makeAccessLog() )
+		{
+			std::size_t begin = 0;
+			for ( std::size_t i = 0; i < field; ++i )
+			{
+				begin = line.find( ' ', begin ) + 1;
+			}
+			values.push_back( line.substr( begin, line.find( ' ', begin ) - begin ) );
+		}
+		return values;
+	}
+
+	/** @brief Field indices of the status code, response size and request time */
+	static constexpr std::size_t kStatusField{ 8 };
+	static constexpr std::size_t kSizeField{ 9 };
+
+	/** @brief Request times, the last field of each line */
+	static std::vector<std::string> requestTimes()
+	{
+		std::vector<std::string> values;
+		for ( const auto& line : makeAccessLog() )
+		{
+			values.push_back( line.substr( line.rfind( ' ' ) + 1 ) );
+		}
+		return values;
+	}
+
+	/** @brief Seeded header names in the spellings clients send, with the canonical name each is compared with */
+	static std::vector<std::pair<std::string, std::string>> makeHeaderNames()
+	{
+		return corpus::headerNames( kLineCount, 0.25, corpus::kSeed + 1 );
+	}
+
+	/** @brief Seeded boolean flags in the spellings accepted by configuration files */
+	static std::vector<std::string> makeFlags()
+	{
+		static const std::vector<std::string> flags{ "true", "False", "1", "0", "yes", "NO", "on", "off", "TRUE", "maybe" };
+		std::mt19937 rng{ 44 };
+		std::vector<std::string> values;
+		for ( std::size_t i = 0; i < kLineCount; ++i )
+		{
+			values.push_back( flags[rng() % flags.size()] );
+		}
+		return values;
+	}
+
+	//----------------------------------------------
+	// Counting
+	//----------------------------------------------
+
+	static void BM_Std_count_char( ::benchmark::State& state )
+	{
+		const auto buffer = makeLogBuffer();
+		const test::AllocationCounter allocations;
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( std::count( buffer.begin(), buffer.end(), '\n' ) );
+		}
+		reportAllocations( state, allocations );
+		state.SetBytesProcessed( static_cast<std::int64_t>( state.iterations() * buffer.size() ) );
+	}
+
+	static void BM_NFX_count_char( ::benchmark::State& state )
+	{
+		const auto buffer = makeLogBuffer();
+		const test::AllocationCounter allocations;
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( nfx::string::count( buffer, '\n' ) );
+		}
+		reportAllocations( state, allocations );
+		state.SetBytesProcessed( static_cast<std::int64_t>( state.iterations() * buffer.size() ) );
+	}
+
+	static void BM_Manual_count( ::benchmark::State& state )
+	{
+		const auto buffer = makeLogBuffer();
+		const std::string_view substr{ "HTTP/1.1" };
+		const test::AllocationCounter allocations;
+		for ( auto _ : state )
+		{
+			std::size_t count = 0;
+			for ( std::size_t pos = buffer.find( substr ); pos != std::string::npos; pos = buffer.find( substr, pos + substr.size() ) )
+			{
+				++count;
+			}
+			::benchmark::DoNotOptimize( count );
+		}
+		reportAllocations( state, allocations );
+		state.SetBytesProcessed( static_cast<std::int64_t>( state.iterations() * buffer.size() ) );
+	}
+
+	static void BM_NFX_count( ::benchmark::State& state )
+	{
+		const auto buffer = makeLogBuffer();
+		const test::AllocationCounter allocations;
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( nfx::string::count( buffer, "HTTP/1.1" ) );
+		}
+		reportAllocations( state, allocations );
+		state.SetBytesProcessed( static_cast<std::int64_t>( state.iterations() * buffer.size() ) );
+	}
+
+	static void BM_Manual_countOverlapping( ::benchmark::State& state )
+	{
+		const auto buffer = makeLogBuffer();
+		const std::string_view substr{ "00" };
+		const test::AllocationCounter allocations;
+		for ( auto _ : state )
+		{
+			std::size_t count = 0;
+			for ( std::size_t pos = buffer.find( substr ); pos != std::string::npos; pos = buffer.find( substr, pos + 1 ) )
+			{
+				++count;
+			}
+			::benchmark::DoNotOptimize( count );
+		}
+		reportAllocations( state, allocations );
+		state.SetBytesProcessed( static_cast<std::int64_t>( state.iterations() * buffer.size() ) );
+	}
+
+	static void BM_NFX_countOverlapping( ::benchmark::State& state )
+	{
+		const auto buffer = makeLogBuffer();
+		const test::AllocationCounter allocations;
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( nfx::string::countOverlapping( buffer, "00" ) );
+		}
+		reportAllocations( state, allocations );
+		state.SetBytesProcessed( static_cast<std::int64_t>( state.iterations() * buffer.size() ) );
+	}
+
+	static void BM_Manual_countOverlapping_motif( ::benchmark::State& state )
+	{
+		const auto sequence = corpus::sequence( kSequenceSize );
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( findLoopCount( sequence, "TATA", true ) );
+		}
+		state.SetBytesProcessed( static_cast<std::int64_t>( state.iterations() * sequence.size() ) );
+	}
+
+	static void BM_NFX_countOverlapping_motif( ::benchmark::State& state )
+	{
+		const auto sequence = corpus::sequence( kSequenceSize );
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( nfx::string::countOverlapping( sequence, "TATA" ) );
+		}
+		state.SetBytesProcessed( static_cast<std::int64_t>( state.iterations() * sequence.size() ) );
+	}
+
+	static void BM_Manual_countOverlapping_periodic( ::benchmark::State& state )
+	{
+		const std::string sequence( kSequenceSize, 'A' );
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( findLoopCount( sequence, kPeriodicPattern, true ) );
+		}
+		state.SetBytesProcessed( static_cast<std::int64_t>( state.iterations() * sequence.size() ) );
+	}
+
+	static void BM_NFX_countOverlapping_periodic( ::benchmark::State& state )
+	{
+		const std::string sequence( kSequenceSize, 'A' );
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( nfx::string::countOverlapping( sequence, kPeriodicPattern ) );
+		}
+		state.SetBytesProcessed( static_cast<std::int64_t>( state.iterations() * sequence.size() ) );
+	}
+
+	//----------------------------------------------
+	// Replacement
+	//----------------------------------------------
+
+	static void BM_Std_string_replace( ::benchmark::State& state )
+	{
+		const auto lines = makeAccessLog();
+		const test::AllocationCounter allocations;
+		for ( auto _ : state )
+		{
+			for ( const auto& line : lines )
+			{
+				std::string result{ line };
+				const std::size_t pos = result.find( "HTTP/1.1" );
+				if ( pos != std::string::npos )
+				{
+					result.replace( pos, 8, "HTTP/2" );
+				}
+				::benchmark::DoNotOptimize( result.data() );
+			}
+		}
+		reportAllocations( state, allocations );
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * lines.size() ) );
+	}
+
+	static void BM_NFX_replace( ::benchmark::State& state )
+	{
+		const auto lines = makeAccessLog();
+		const test::AllocationCounter allocations;
+		for ( auto _ : state )
+		{
+			for ( const auto& line : lines )
+			{
+				auto result = nfx::string::replace( line, "HTTP/1.1", "HTTP/2" );
+				::benchmark::DoNotOptimize( result.data() );
+			}
+		}
+		reportAllocations( state, allocations );
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * lines.size() ) );
+	}
+
+	static void BM_Manual_replaceAll( ::benchmark::State& state )
+	{
+		const auto buffer = makeLogBuffer();
+		const std::string_view oldStr{ "HTTP/1.1" };
+		const std::string_view newStr{ "HTTP/2" };
+		const test::AllocationCounter allocations;
+		for ( auto _ : state )
+		{
+			std::string result;
+			std::size_t begin = 0;
+			for ( std::size_t pos = buffer.find( oldStr ); pos != std::string::npos; pos = buffer.find( oldStr, begin ) )
+			{
+				result.append( buffer, begin, pos - begin ).append( newStr );
+				begin = pos + oldStr.size();
+			}
+			result.append( buffer, begin );
+			::benchmark::DoNotOptimize( result.data() );
+		}
+		reportAllocations( state, allocations );
+		state.SetBytesProcessed( static_cast<std::int64_t>( state.iterations() * buffer.size() ) );
+	}
+
+	static void BM_NFX_replaceAll( ::benchmark::State& state )
+	{
+		const auto buffer = makeLogBuffer();
+		const test::AllocationCounter allocations;
+		for ( auto _ : state )
+		{
+			auto result = nfx::string::replaceAll( buffer, "HTTP/1.1", "HTTP/2" );
+			::benchmark::DoNotOptimize( result.data() );
+		}
+		reportAllocations( state, allocations );
+		state.SetBytesProcessed( static_cast<std::int64_t>( state.iterations() * buffer.size() ) );
+	}
+
+	//----------------------------------------------
+	// Joining and reversal
+	//----------------------------------------------
+
+	static void BM_Manual_join( ::benchmark::State& state )
+	{
+		const auto lines = makeAccessLog();
+		const test::AllocationCounter allocations;
+		for ( auto _ : state )
+		{
+			std::string result;
+			for ( std::size_t i = 0; i < lines.size(); ++i )
+			{
+				if ( i > 0 )
+				{
+					result += '\n';
+				}
+				result += lines[i];
+			}
+			::benchmark::DoNotOptimize( result.data() );
+		}
+		reportAllocations( state, allocations );
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * lines.size() ) );
+	}
+
+	static void BM_NFX_join( ::benchmark::State& state )
+	{
+		const auto lines = makeAccessLog();
+		const test::AllocationCounter allocations;
+		for ( auto _ : state )
+		{
+			auto result = nfx::string::join( lines, "\n" );
+			::benchmark::DoNotOptimize( result.data() );
+		}
+		reportAllocations( state, allocations );
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * lines.size() ) );
+	}
+
+	static void BM_Std_reverse_copy( ::benchmark::State& state )
+	{
+		const auto lines = makeAccessLog();
+		const test::AllocationCounter allocations;
+		for ( auto _ : state )
+		{
+			for ( const auto& line : lines )
+			{
+				std::string result{ line.rbegin(), line.rend() };
+				::benchmark::DoNotOptimize( result.data() );
+			}
+		}
+		reportAllocations( state, allocations );
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * lines.size() ) );
+	}
+
+	static void BM_NFX_reverse( ::benchmark::State& state )
+	{
+		const auto lines = makeAccessLog();
+		const test::AllocationCounter allocations;
+		for ( auto _ : state )
+		{
+			for ( const auto& line : lines )
+			{
+				auto result = nfx::string::reverse( line );
+				::benchmark::DoNotOptimize( result.data() );
+			}
+		}
+		reportAllocations( state, allocations );
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * lines.size() ) );
+	}
+
+	//----------------------------------------------
+	// Padding and repetition
+	//----------------------------------------------
+
+	/** @brief Hand-written padding: fill on the left, the right, or split around the value */
+	static std::string manualPad( std::string_view str, std::size_t width, std::size_t leftShare, std::size_t shares )
+	{
+		if ( str.size() >= width )
+		{
+			return std::string{ str };
+		}
+		const std::size_t padding = width - str.size();
+		const std::size_t left = padding * leftShare / shares;
+		std::string result( left, ' ' );
+		result.append( str ).append( padding - left, ' ' );
+		return result;
+	}
+
+	static void BM_Manual_pad( ::benchmark::State& state )
+	{
+		const auto sizes = logField( kSizeField );
+		const auto statuses = logField( kStatusField );
+		const test::AllocationCounter allocations;
+		for ( auto _ : state )
+		{
+			for ( std::size_t i = 0; i < sizes.size(); ++i )
+			{
+				auto right = manualPad( sizes[i], 10, 1, 1 );
+				auto left = manualPad( statuses[i], 6, 0, 1 );
+				auto centered = manualPad( statuses[i], 9, 1, 2 );
+				::benchmark::DoNotOptimize( right.data() );
+				::benchmark::DoNotOptimize( left.data() );
+				::benchmark::DoNotOptimize( centered.data() );
+			}
+		}
+		reportAllocations( state, allocations );
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * sizes.size() ) );
+	}
+
+	static void BM_NFX_pad( ::benchmark::State& state )
+	{
+		const auto sizes = logField( kSizeField );
+		const auto statuses = logField( kStatusField );
+		const test::AllocationCounter allocations;
+		for ( auto _ : state )
+		{
+			for ( std::size_t i = 0; i < sizes.size(); ++i )
+			{
+				auto right = nfx::string::padLeft( sizes[i], 10 );
+				auto left = nfx::string::padRight( statuses[i], 6 );
+				auto centered = nfx::string::center( statuses[i], 9 );
+				::benchmark::DoNotOptimize( right.data() );
+				::benchmark::DoNotOptimize( left.data() );
+				::benchmark::DoNotOptimize( centered.data() );
+			}
+		}
+		reportAllocations( state, allocations );
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * sizes.size() ) );
+	}
+
+	static void BM_Manual_repeat( ::benchmark::State& state )
+	{
+		const auto count = static_cast<std::size_t>( state.range( 0 ) );
+		const test::AllocationCounter allocations;
+		for ( auto _ : state )
+		{
+			std::string result;
+			for ( std::size_t i = 0; i < count; ++i )
+			{
+				result += "=-";
+			}
+			::benchmark::DoNotOptimize( result.data() );
+		}
+		reportAllocations( state, allocations );
+		state.SetBytesProcessed( static_cast<std::int64_t>( state.iterations() ) * 2 * state.range( 0 ) );
+	}
+
+	static void BM_NFX_repeat( ::benchmark::State& state )
+	{
+		const auto count = static_cast<std::size_t>( state.range( 0 ) );
+		const test::AllocationCounter allocations;
+		for ( auto _ : state )
+		{
+			auto result = nfx::string::repeat( "=-", count );
+			::benchmark::DoNotOptimize( result.data() );
+		}
+		reportAllocations( state, allocations );
+		state.SetBytesProcessed( static_cast<std::int64_t>( state.iterations() ) * 2 * state.range( 0 ) );
+	}
+
+	//----------------------------------------------
+	// Case-insensitive comparison
+	//----------------------------------------------
+
+	static void BM_Manual_iequals( ::benchmark::State& state )
+	{
+		const auto pairs = makeHeaderNames();
+		const test::AllocationCounter allocations;
+		for ( auto _ : state )
+		{
+			std::size_t equal = 0;
+			for ( const auto& [header, canonical] : pairs )
+			{
+				equal += header.size() == canonical.size() &&
+						 std::equal( header.begin(), header.end(), canonical.begin(), []( char a, char b ) {
+							 return std::tolower( static_cast<unsigned char>( a ) ) == std::tolower( static_cast<unsigned char>( b ) );
+						 } );
+			}
+			::benchmark::DoNotOptimize( equal );
+		}
+		reportAllocations( state, allocations );
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * pairs.size() ) );
+	}
+
+	static void BM_NFX_iequals( ::benchmark::State& state )
+	{
+		const auto pairs = makeHeaderNames();
+		const test::AllocationCounter allocations;
+		for ( auto _ : state )
+		{
+			std::size_t equal = 0;
+			for ( const auto& [header, canonical] : pairs )
+			{
+				equal += nfx::string::iequals( header, canonical );
+			}
+			::benchmark::DoNotOptimize( equal );
+		}
+		reportAllocations( state, allocations );
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * pairs.size() ) );
+	}
+
+	//----------------------------------------------
+	// Field parsing
+	//----------------------------------------------
+
+	static void BM_Std_strtoll( ::benchmark::State& state )
+	{
+		const auto sizes = logField( kSizeField );
+		const test::AllocationCounter allocations;
+		for ( auto _ : state )
+		{
+			std::int64_t total = 0;
+			for ( const auto& size : sizes )
+			{
+				char* end = nullptr;
+				const long long value = std::strtoll( size.c_str(), &end, 10 );
+				total += *end == '\0' ? value : 0;
+			}
+			::benchmark::DoNotOptimize( total );
+		}
+		reportAllocations( state, allocations );
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * sizes.size() ) );
+	}
+
+	static void BM_NFX_tryParseLong( ::benchmark::State& state )
+	{
+		const auto sizes = logField( kSizeField );
+		const test::AllocationCounter allocations;
+		for ( auto _ : state )
+		{
+			std::int64_t total = 0;
+			for ( const auto& size : sizes )
+			{
+				std::int64_t value = 0;
+				total += nfx::string::tryParseLong( size, value ) ? value : 0;
+			}
+			::benchmark::DoNotOptimize( total );
+		}
+		reportAllocations( state, allocations );
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * sizes.size() ) );
+	}
+
+	static void BM_Std_strtof( ::benchmark::State& state )
+	{
+		const auto times = requestTimes();
+		const test::AllocationCounter allocations;
+		for ( auto _ : state )
+		{
+			float total = 0.0f;
+			for ( const auto& time : times )
+			{
+				char* end = nullptr;
+				const float value = std::strtof( time.c_str(), &end );
+				total += *end == '\0' ? value : 0.0f;
+			}
+			::benchmark::DoNotOptimize( total );
+		}
+		reportAllocations( state, allocations );
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * times.size() ) );
+	}
+
+	static void BM_NFX_tryParseFloat( ::benchmark::State& state )
+	{
+		const auto times = requestTimes();
+		const test::AllocationCounter allocations;
+		for ( auto _ : state )
+		{
+			float total = 0.0f;
+			for ( const auto& time : times )
+			{
+				float value = 0.0f;
+				total += nfx::string::tryParseFloat( time, value ) ? value : 0.0f;
+			}
+			::benchmark::DoNotOptimize( total );
+		}
+		reportAllocations( state, allocations );
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * times.size() ) );
+	}
+
+	static void BM_Manual_parseBool( ::benchmark::State& state )
+	{
+		const auto flags = makeFlags();
+		const test::AllocationCounter allocations;
+		for ( auto _ : state )
+		{
+			std::size_t parsed = 0;
+			for ( const auto& flag : flags )
+			{
+				std::string lower{ flag };
+				std::transform( lower.begin(), lower.end(), lower.begin(), []( unsigned char c ) { return static_cast<char>( std::tolower( c ) ); } );
+				parsed += lower == "true" || lower == "1" || lower == "yes" || lower == "on" || lower == "t" || lower == "y" ||
+						  lower == "false" || lower == "0" || lower == "no" || lower == "off" || lower == "f" || lower == "n";
+			}
+			::benchmark::DoNotOptimize( parsed );
+		}
+		reportAllocations( state, allocations );
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * flags.size() ) );
+	}
+
+	static void BM_NFX_tryParseBool( ::benchmark::State& state )
+	{
+		const auto flags = makeFlags();
+		const test::AllocationCounter allocations;
+		for ( auto _ : state )
+		{
+			std::size_t parsed = 0;
+			for ( const auto& flag : flags )
+			{
+				bool value = false;
+				parsed += nfx::string::tryParseBool( flag, value );
+				::benchmark::DoNotOptimize( value );
+			}
+			::benchmark::DoNotOptimize( parsed );
+		}
+		reportAllocations( state, allocations );
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() * flags.size() ) );
+	}
+} // namespace nfx::string::benchmark
+
+//=====================================================================
+// Benchmarks registration
+//=====================================================================
+
+//----------------------------------------------
+// Counting
+//----------------------------------------------
+
+BENCHMARK( nfx::string::benchmark::BM_Std_count_char )
+	->Unit( benchmark::kMicrosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_count_char )
+	->Unit( benchmark::kMicrosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_Manual_count )
+	->Unit( benchmark::kMicrosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_count )
+	->Unit( benchmark::kMicrosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_Manual_countOverlapping )
+	->Unit( benchmark::kMicrosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_countOverlapping )
+	->Unit( benchmark::kMicrosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_Manual_countOverlapping_motif )
+	->Unit( benchmark::kMicrosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_countOverlapping_motif )
+	->Unit( benchmark::kMicrosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_Manual_countOverlapping_periodic )
+	->Unit( benchmark::kMicrosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_countOverlapping_periodic )
+	->Unit( benchmark::kMicrosecond );
+
+//----------------------------------------------
+// Replacement
+//----------------------------------------------
+
+BENCHMARK( nfx::string::benchmark::BM_Std_string_replace )
+	->Unit( benchmark::kMicrosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_replace )
+	->Unit( benchmark::kMicrosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_Manual_replaceAll )
+	->Unit( benchmark::kMicrosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_replaceAll )
+	->Unit( benchmark::kMicrosecond );
+
+//----------------------------------------------
+// Joining and reversal
+//----------------------------------------------
+
+BENCHMARK( nfx::string::benchmark::BM_Manual_join )
+	->Unit( benchmark::kMicrosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_join )
+	->Unit( benchmark::kMicrosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_Std_reverse_copy )
+	->Unit( benchmark::kMicrosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_reverse )
+	->Unit( benchmark::kMicrosecond );
+
+//----------------------------------------------
+// Padding and repetition
+//----------------------------------------------
+
+BENCHMARK( nfx::string::benchmark::BM_Manual_pad )
+	->Unit( benchmark::kMicrosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_pad )
+	->Unit( benchmark::kMicrosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_Manual_repeat )
+	->RangeMultiplier( 8 )
+	->Range( 8, 1 << 15 )
+	->Unit( benchmark::kNanosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_repeat )
+	->RangeMultiplier( 8 )
+	->Range( 8, 1 << 15 )
+	->Unit( benchmark::kNanosecond );
+
+//----------------------------------------------
+// Case-insensitive comparison
+//----------------------------------------------
+
+BENCHMARK( nfx::string::benchmark::BM_Manual_iequals )
+	->Unit( benchmark::kMicrosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_iequals )
+	->Unit( benchmark::kMicrosecond );
+
+//----------------------------------------------
+// Field parsing
+//----------------------------------------------
+
+BENCHMARK( nfx::string::benchmark::BM_Std_strtoll )
+	->Unit( benchmark::kMicrosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_tryParseLong )
+	->Unit( benchmark::kMicrosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_Std_strtof )
+	->Unit( benchmark::kMicrosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_tryParseFloat )
+	->Unit( benchmark::kMicrosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_Manual_parseBool )
+	->Unit( benchmark::kMicrosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_tryParseBool )
+	->Unit( benchmark::kMicrosecond );
+
+BENCHMARK_MAIN();
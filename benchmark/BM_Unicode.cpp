@@ -0,0 +1,352 @@
+/**
+ * @file BM_Unicode.cpp
+ * @brief Benchmark nfx::string Unicode case mapping and comparison vs the ASCII-only functions,
+ *        normalization of already-normalized and decomposed text, and display width of table cells
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nfx/string/Unicode.h>
+#include <nfx/string/Utils.h>
+
+namespace nfx::string::benchmark
+{
+	//=====================================================================
+	// Unicode benchmark suite
+	//=====================================================================
+
+	//----------------------------------------------
+	// Test data
+	//----------------------------------------------
+
+	/** @brief Mixed-case words in a seeded random order, optionally with non-ASCII names */
+	static std::string makeNames( std::size_t size, bool asciiOnly )
+	{
+		static constexpr std::array<std::string_view, 8> ascii{
+			"Smith ", "JOHNSON ", "williams ", "Brown ", "jones ", "GARCIA ", "Miller ", "davis " };
+		static constexpr std::array<std::string_view, 8> mixed{
+			"M\xC3\xBCller ", "\xC3\x89MILE ", "Dvo\xC5\x99\xC3\xA1k ", "\xD0\x98\xD0\xB2\xD0\xB0\xD0\xBD\xD0\xBE\xD0\xB2 ",
+			"Smith ", "\xCE\xA0\xCE\xB1\xCF\x80\xCE\xB1\xCE\xB4\xCF\x8C\xCF\x80\xCE\xBF\xCF\x85\xCE\xBB\xCE\xBF\xCF\x82 ", "garcia ", "\xC3\x85" "berg " };
+
+		const auto& words = asciiOnly ? ascii : mixed;
+		std::mt19937 rng{ 42 };
+		std::string text;
+		while ( text.size() < size )
+		{
+			text.append( words[rng() % words.size()] );
+		}
+		return text;
+	}
+
+	//----------------------------------------------
+	// Case mapping
+	//----------------------------------------------
+
+	static void BM_NFX_toLower_Ascii( ::benchmark::State& state )
+	{
+		const std::string text = makeNames( static_cast<std::size_t>( state.range( 0 ) ), true );
+		for ( auto _ : state )
+		{
+			std::string result = nfx::string::toLower( text );
+			::benchmark::DoNotOptimize( result );
+		}
+		state.SetBytesProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( text.size() ) );
+	}
+
+	static void BM_NFX_utf8ToLower_Ascii( ::benchmark::State& state )
+	{
+		const std::string text = makeNames( static_cast<std::size_t>( state.range( 0 ) ), true );
+		for ( auto _ : state )
+		{
+			std::string result = nfx::string::utf8ToLower( text );
+			::benchmark::DoNotOptimize( result );
+		}
+		state.SetBytesProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( text.size() ) );
+	}
+
+	static void BM_NFX_utf8CaseFold_Mixed( ::benchmark::State& state )
+	{
+		const std::string text = makeNames( static_cast<std::size_t>( state.range( 0 ) ), false );
+		for ( auto _ : state )
+		{
+			std::string result = nfx::string::utf8CaseFold( text );
+			::benchmark::DoNotOptimize( result );
+		}
+		state.SetBytesProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( text.size() ) );
+	}
+
+	//----------------------------------------------
+	// Case-insensitive comparison
+	//----------------------------------------------
+
+	static void BM_NFX_iequals_Ascii( ::benchmark::State& state )
+	{
+		const std::string lhs = makeNames( static_cast<std::size_t>( state.range( 0 ) ), true );
+		const std::string rhs = nfx::string::toUpper( lhs );
+		for ( auto _ : state )
+		{
+			bool result = nfx::string::iequals( lhs, rhs );
+			::benchmark::DoNotOptimize( result );
+		}
+		state.SetBytesProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( lhs.size() ) );
+	}
+
+	static void BM_NFX_iequalsUtf8_Ascii( ::benchmark::State& state )
+	{
+		const std::string lhs = makeNames( static_cast<std::size_t>( state.range( 0 ) ), true );
+		const std::string rhs = nfx::string::toUpper( lhs );
+		for ( auto _ : state )
+		{
+			bool result = nfx::string::iequalsUtf8( lhs, rhs );
+			::benchmark::DoNotOptimize( result );
+		}
+		state.SetBytesProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( lhs.size() ) );
+	}
+
+	static void BM_NFX_iequalsUtf8_Mixed( ::benchmark::State& state )
+	{
+		const std::string lhs = makeNames( static_cast<std::size_t>( state.range( 0 ) ), false );
+		const std::string rhs = nfx::string::utf8ToUpper( lhs );
+		for ( auto _ : state )
+		{
+			bool result = nfx::string::iequalsUtf8( lhs, rhs );
+			::benchmark::DoNotOptimize( result );
+		}
+		state.SetBytesProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( lhs.size() ) );
+	}
+
+	//----------------------------------------------
+	// Normalization
+	//----------------------------------------------
+
+	static void BM_NFX_utf8QuickCheck_Nfc( ::benchmark::State& state )
+	{
+		const std::string text = makeNames( static_cast<std::size_t>( state.range( 0 ) ), false );
+		for ( auto _ : state )
+		{
+			auto result = nfx::string::utf8QuickCheck( text );
+			::benchmark::DoNotOptimize( result );
+		}
+		state.SetBytesProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( text.size() ) );
+	}
+
+	static void BM_NFX_utf8NormalizeInPlace_Nfc( ::benchmark::State& state )
+	{
+		std::string text = makeNames( static_cast<std::size_t>( state.range( 0 ) ), false );
+		for ( auto _ : state )
+		{
+			bool changed = nfx::string::utf8NormalizeInPlace( text );
+			::benchmark::DoNotOptimize( changed );
+		}
+		state.SetBytesProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( text.size() ) );
+	}
+
+	static void BM_NFX_utf8Normalize_Nfd( ::benchmark::State& state )
+	{
+		const std::string text = nfx::string::utf8Normalize(
+			makeNames( static_cast<std::size_t>( state.range( 0 ) ), false ), nfx::string::NormalizationForm::NFD );
+		for ( auto _ : state )
+		{
+			std::string result = nfx::string::utf8Normalize( text );
+			::benchmark::DoNotOptimize( result );
+		}
+		state.SetBytesProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( text.size() ) );
+	}
+
+	static void BM_NFX_Utf8Normalizer_Nfd( ::benchmark::State& state )
+	{
+		const std::string text = nfx::string::utf8Normalize(
+			makeNames( static_cast<std::size_t>( state.range( 0 ) ), false ), nfx::string::NormalizationForm::NFD );
+		std::string result;
+		for ( auto _ : state )
+		{
+			result.clear();
+			nfx::string::Utf8Normalizer normalizer;
+			for ( std::size_t pos = 0; pos < text.size(); pos += 4096 )
+			{
+				normalizer.append( std::string_view{ text }.substr( pos, 4096 ), result );
+			}
+			normalizer.finish( result );
+			::benchmark::DoNotOptimize( result );
+		}
+		state.SetBytesProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( text.size() ) );
+	}
+
+	//----------------------------------------------
+	// Display width
+	//----------------------------------------------
+
+	/** @brief Table cells of 4 to 40 bytes cut from makeNames() text at codepoint boundaries */
+	static std::vector<std::string> makeCells( std::size_t count, bool asciiOnly )
+	{
+		const std::string text = makeNames( count * 40, asciiOnly );
+		std::mt19937 rng{ 7 };
+		std::vector<std::string> cells;
+		std::size_t pos = 0;
+		while ( cells.size() < count )
+		{
+			std::size_t end = std::min( pos + 4 + rng() % 37, text.size() );
+			while ( end < text.size() && ( static_cast<unsigned char>( text[end] ) & 0xC0u ) == 0x80u )
+			{
+				++end;
+			}
+			cells.emplace_back( text.substr( pos, end - pos ) );
+			pos = end < text.size() ? end : 0;
+		}
+		return cells;
+	}
+
+	static void BM_NFX_displayWidth_Ascii( ::benchmark::State& state )
+	{
+		const std::string text = makeNames( static_cast<std::size_t>( state.range( 0 ) ), true );
+		for ( auto _ : state )
+		{
+			std::size_t width = nfx::string::displayWidth( text );
+			::benchmark::DoNotOptimize( width );
+		}
+		state.SetBytesProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( text.size() ) );
+	}
+
+	static void BM_NFX_displayWidth_Mixed( ::benchmark::State& state )
+	{
+		const std::string text = makeNames( static_cast<std::size_t>( state.range( 0 ) ), false );
+		for ( auto _ : state )
+		{
+			std::size_t width = nfx::string::displayWidth( text );
+			::benchmark::DoNotOptimize( width );
+		}
+		state.SetBytesProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( text.size() ) );
+	}
+
+	static void BM_NFX_padRight_Cells( ::benchmark::State& state )
+	{
+		const std::vector<std::string> cells = makeCells( static_cast<std::size_t>( state.range( 0 ) ), true );
+		for ( auto _ : state )
+		{
+			for ( const std::string& cell : cells )
+			{
+				std::string padded = nfx::string::padRight( cell, 48 );
+				::benchmark::DoNotOptimize( padded );
+			}
+		}
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( cells.size() ) );
+	}
+
+	static void BM_NFX_padDisplay_Cells( ::benchmark::State& state )
+	{
+		const std::vector<std::string> cells = makeCells( static_cast<std::size_t>( state.range( 0 ) ), true );
+		for ( auto _ : state )
+		{
+			for ( const std::string& cell : cells )
+			{
+				std::string padded = nfx::string::padDisplay( cell, 48 );
+				::benchmark::DoNotOptimize( padded );
+			}
+		}
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( cells.size() ) );
+	}
+
+	static void BM_NFX_truncateDisplay_MixedCells( ::benchmark::State& state )
+	{
+		const std::vector<std::string> cells = makeCells( static_cast<std::size_t>( state.range( 0 ) ), false );
+		for ( auto _ : state )
+		{
+			for ( const std::string& cell : cells )
+			{
+				std::string truncated = nfx::string::truncateDisplay( cell, 20 );
+				::benchmark::DoNotOptimize( truncated );
+			}
+		}
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( cells.size() ) );
+	}
+} // namespace nfx::string::benchmark
+
+//=====================================================================
+// Benchmarks registration
+//=====================================================================
+
+//----------------------------------------------
+// Case mapping
+//----------------------------------------------
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_toLower_Ascii )
+	->Range( 64, 1 << 16 )
+	->Unit( benchmark::kNanosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_utf8ToLower_Ascii )
+	->Range( 64, 1 << 16 )
+	->Unit( benchmark::kNanosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_utf8CaseFold_Mixed )
+	->Range( 64, 1 << 16 )
+	->Unit( benchmark::kNanosecond );
+
+//----------------------------------------------
+// Case-insensitive comparison
+//----------------------------------------------
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_iequals_Ascii )
+	->Range( 64, 1 << 16 )
+	->Unit( benchmark::kNanosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_iequalsUtf8_Ascii )
+	->Range( 64, 1 << 16 )
+	->Unit( benchmark::kNanosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_iequalsUtf8_Mixed )
+	->Range( 64, 1 << 16 )
+	->Unit( benchmark::kNanosecond );
+
+//----------------------------------------------
+// Normalization
+//----------------------------------------------
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_utf8QuickCheck_Nfc )
+	->Range( 64, 1 << 16 )
+	->Unit( benchmark::kNanosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_utf8NormalizeInPlace_Nfc )
+	->Range( 64, 1 << 16 )
+	->Unit( benchmark::kNanosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_utf8Normalize_Nfd )
+	->Range( 64, 1 << 16 )
+	->Unit( benchmark::kNanosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_Utf8Normalizer_Nfd )
+	->Range( 64, 1 << 16 )
+	->Unit( benchmark::kNanosecond );
+
+//----------------------------------------------
+// Display width
+//----------------------------------------------
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_displayWidth_Ascii )
+	->Range( 64, 1 << 16 )
+	->Unit( benchmark::kNanosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_displayWidth_Mixed )
+	->Range( 64, 1 << 16 )
+	->Unit( benchmark::kNanosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_padRight_Cells )
+	->Range( 64, 1 << 12 )
+	->Unit( benchmark::kNanosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_padDisplay_Cells )
+	->Range( 64, 1 << 12 )
+	->Unit( benchmark::kNanosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_truncateDisplay_MixedCells )
+	->Range( 64, 1 << 12 )
+	->Unit( benchmark::kNanosecond );
+
+BENCHMARK_MAIN();
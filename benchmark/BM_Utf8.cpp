@@ -0,0 +1,332 @@
+/**
+ * @file BM_Utf8.cpp
+ * @brief Benchmark nfx::string UTF-8 validation, counting and transcoding vs byte-at-a-time loops
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <string_view>
+
+#include <nfx/string/Utf8.h>
+
+namespace nfx::string::benchmark
+{
+	//=====================================================================
+	// UTF-8 benchmark suite
+	//=====================================================================
+
+	//----------------------------------------------
+	// Test data
+	//----------------------------------------------
+
+	static std::string makeText( std::size_t size, bool asciiOnly )
+	{
+		static constexpr std::string_view ascii{ "The quick brown fox jumps over the lazy dog. " };
+		static constexpr std::string_view mixed{ "Caf\xC3\xA9 \xE2\x82\xAC 42 \xE4\xB8\xAD\xE6\x96\x87 na\xC3\xAFve \xF0\x9F\x98\x80 " };
+
+		const std::string_view piece = asciiOnly ? ascii : mixed;
+		std::string text;
+		text.reserve( size + piece.size() );
+		while ( text.size() < size )
+		{
+			text.append( piece );
+		}
+		// Cut on a sequence boundary so the text stays valid
+		while ( text.size() > size )
+		{
+			text.pop_back();
+		}
+		while ( !text.empty() && ( static_cast<unsigned char>( text.back() ) & 0xC0 ) == 0x80 )
+		{
+			text.pop_back();
+		}
+		if ( !text.empty() && static_cast<unsigned char>( text.back() ) >= 0xC0 )
+		{
+			text.pop_back();
+		}
+		return text;
+	}
+
+	/**
+	 * @brief Mixed-script words in a seeded random order
+	 * @details Repeating a short sample lets the branch predictor learn the byte-at-a-time loops;
+	 *          shuffled words keep the sequence lengths unpredictable as in real text.
+	 */
+	static std::string makeShuffledText( std::size_t size )
+	{
+		static constexpr std::array<std::string_view, 8> words{
+			"the ", "data ", "caf\xC3\xA9 ", "na\xC3\xAFve ", "\xE2\x82\xAC" "42 ",
+			"\xE4\xB8\xAD\xE6\x96\x87 ", "\xD0\xBC\xD0\xB8\xD1\x80 ", "\xF0\x9F\x98\x80 " };
+
+		std::mt19937 rng{ 42 };
+		std::uniform_int_distribution<std::size_t> pick{ 0, words.size() - 1 };
+		std::string text;
+		text.reserve( size + 16 );
+		while ( text.size() < size )
+		{
+			const std::string_view word = words[pick( rng )];
+			if ( text.size() + word.size() > size )
+			{
+				break;
+			}
+			text.append( word );
+		}
+		return text;
+	}
+
+	static bool naiveUtf8Valid( std::string_view str )
+	{
+		std::size_t i = 0;
+		while ( i < str.size() )
+		{
+			const auto c = static_cast<unsigned char>( str[i] );
+			std::size_t n = c < 0x80 ? 1 : ( c & 0xE0 ) == 0xC0 ? 2
+									   : ( c & 0xF0 ) == 0xE0	? 3
+									   : ( c & 0xF8 ) == 0xF0	? 4
+																: 0;
+			if ( n == 0 || i + n > str.size() )
+			{
+				return false;
+			}
+			std::uint32_t cp = n == 1 ? c : c & ( 0x7F >> n );
+			for ( std::size_t k = 1; k < n; ++k )
+			{
+				const auto b = static_cast<unsigned char>( str[i + k] );
+				if ( ( b & 0xC0 ) != 0x80 )
+				{
+					return false;
+				}
+				cp = ( cp << 6 ) | ( b & 0x3F );
+			}
+			if ( ( n == 2 && cp < 0x80 ) || ( n == 3 && cp < 0x800 ) || ( n == 4 && cp < 0x10000 ) ||
+				 cp > 0x10FFFF || ( cp >= 0xD800 && cp <= 0xDFFF ) )
+			{
+				return false;
+			}
+			i += n;
+		}
+		return true;
+	}
+
+	//----------------------------------------------
+	// Validation
+	//----------------------------------------------
+
+	static void BM_Naive_utf8Valid_Mixed( ::benchmark::State& state )
+	{
+		const std::string text = makeText( static_cast<std::size_t>( state.range( 0 ) ), false );
+		for ( auto _ : state )
+		{
+			bool result = naiveUtf8Valid( text );
+			::benchmark::DoNotOptimize( result );
+		}
+		state.SetBytesProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( text.size() ) );
+	}
+
+	static void BM_NFX_utf8Valid_Mixed( ::benchmark::State& state )
+	{
+		const std::string text = makeText( static_cast<std::size_t>( state.range( 0 ) ), false );
+		for ( auto _ : state )
+		{
+			bool result = nfx::string::utf8Valid( text );
+			::benchmark::DoNotOptimize( result );
+		}
+		state.SetBytesProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( text.size() ) );
+	}
+
+	static void BM_NFX_utf8Valid_Ascii( ::benchmark::State& state )
+	{
+		const std::string text = makeText( static_cast<std::size_t>( state.range( 0 ) ), true );
+		for ( auto _ : state )
+		{
+			bool result = nfx::string::utf8Valid( text );
+			::benchmark::DoNotOptimize( result );
+		}
+		state.SetBytesProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( text.size() ) );
+	}
+
+	//----------------------------------------------
+	// Codepoint counting
+	//----------------------------------------------
+
+	static void BM_Manual_utf8Length( ::benchmark::State& state )
+	{
+		const std::string text = makeText( static_cast<std::size_t>( state.range( 0 ) ), false );
+		for ( auto _ : state )
+		{
+			std::size_t result = 0;
+			for ( char c : text )
+			{
+				result += ( static_cast<unsigned char>( c ) & 0xC0 ) != 0x80 ? 1 : 0;
+			}
+			::benchmark::DoNotOptimize( result );
+		}
+		state.SetBytesProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( text.size() ) );
+	}
+
+	static void BM_NFX_utf8Length( ::benchmark::State& state )
+	{
+		const std::string text = makeText( static_cast<std::size_t>( state.range( 0 ) ), false );
+		for ( auto _ : state )
+		{
+			std::size_t result = nfx::string::utf8Length( text );
+			::benchmark::DoNotOptimize( result );
+		}
+		state.SetBytesProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( text.size() ) );
+	}
+
+	//----------------------------------------------
+	// Transcoding
+	//----------------------------------------------
+
+	static void BM_Naive_utf8ToUtf16( ::benchmark::State& state )
+	{
+		const std::string text = makeShuffledText( static_cast<std::size_t>( state.range( 0 ) ) );
+		std::u16string output( text.size(), u'\0' );
+		for ( auto _ : state )
+		{
+			std::size_t count = 0;
+			for ( std::size_t i = 0; i < text.size(); )
+			{
+				const auto c = static_cast<unsigned char>( text[i] );
+				std::uint32_t cp;
+				if ( c < 0x80 )
+				{
+					cp = c;
+					i += 1;
+				}
+				else if ( c < 0xE0 )
+				{
+					cp = ( ( c & 0x1Fu ) << 6 ) | ( text[i + 1] & 0x3Fu );
+					i += 2;
+				}
+				else if ( c < 0xF0 )
+				{
+					cp = ( ( c & 0x0Fu ) << 12 ) | ( ( text[i + 1] & 0x3Fu ) << 6 ) | ( text[i + 2] & 0x3Fu );
+					i += 3;
+				}
+				else
+				{
+					cp = ( ( c & 0x07u ) << 18 ) | ( ( text[i + 1] & 0x3Fu ) << 12 ) | ( ( text[i + 2] & 0x3Fu ) << 6 ) | ( text[i + 3] & 0x3Fu );
+					i += 4;
+				}
+				if ( cp < 0x10000 )
+				{
+					output[count++] = static_cast<char16_t>( cp );
+				}
+				else
+				{
+					output[count++] = static_cast<char16_t>( 0xD800 + ( ( cp - 0x10000 ) >> 10 ) );
+					output[count++] = static_cast<char16_t>( 0xDC00 + ( ( cp - 0x10000 ) & 0x3FF ) );
+				}
+			}
+			::benchmark::DoNotOptimize( count );
+			::benchmark::ClobberMemory();
+		}
+		state.SetBytesProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( text.size() ) );
+	}
+
+	static void BM_NFX_utf8ToUtf16( ::benchmark::State& state )
+	{
+		const std::string text = makeShuffledText( static_cast<std::size_t>( state.range( 0 ) ) );
+		std::u16string output( nfx::string::utf16LengthFromUtf8( text ), u'\0' );
+		for ( auto _ : state )
+		{
+			std::size_t written = 0;
+			bool result = nfx::string::tryUtf8ToUtf16( text, output, written );
+			::benchmark::DoNotOptimize( result );
+			::benchmark::ClobberMemory();
+		}
+		state.SetBytesProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( text.size() ) );
+	}
+
+	static void BM_NFX_utf16ToUtf8( ::benchmark::State& state )
+	{
+		std::u16string input;
+		static_cast<void>( nfx::string::tryUtf8ToUtf16( makeShuffledText( static_cast<std::size_t>( state.range( 0 ) ) ), input ) );
+		std::string output( nfx::string::utf8LengthFromUtf16( input ), '\0' );
+		for ( auto _ : state )
+		{
+			std::size_t written = 0;
+			bool result = nfx::string::tryUtf16ToUtf8( input, output, written );
+			::benchmark::DoNotOptimize( result );
+			::benchmark::ClobberMemory();
+		}
+		state.SetBytesProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( output.size() ) );
+	}
+
+	static void BM_NFX_latin1ToUtf8( ::benchmark::State& state )
+	{
+		std::string input( static_cast<std::size_t>( state.range( 0 ) ), 'a' );
+		for ( std::size_t i = 0; i < input.size(); i += 7 )
+		{
+			input[i] = static_cast<char>( 0xE9 );
+		}
+		std::string output( nfx::string::utf8LengthFromLatin1( input ), '\0' );
+		for ( auto _ : state )
+		{
+			std::size_t written = nfx::string::latin1ToUtf8( input, output );
+			::benchmark::DoNotOptimize( written );
+			::benchmark::ClobberMemory();
+		}
+		state.SetBytesProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( input.size() ) );
+	}
+} // namespace nfx::string::benchmark
+
+//=====================================================================
+// Benchmarks registration
+//=====================================================================
+
+//----------------------------------------------
+// Validation
+//----------------------------------------------
+
+BENCHMARK( nfx::string::benchmark::BM_Naive_utf8Valid_Mixed )
+	->Range( 64, 1 << 20 )
+	->Unit( benchmark::kNanosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_utf8Valid_Mixed )
+	->Range( 64, 1 << 20 )
+	->Unit( benchmark::kNanosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_utf8Valid_Ascii )
+	->Range( 64, 1 << 20 )
+	->Unit( benchmark::kNanosecond );
+
+//----------------------------------------------
+// Codepoint counting
+//----------------------------------------------
+
+BENCHMARK( nfx::string::benchmark::BM_Manual_utf8Length )
+	->Range( 64, 1 << 20 )
+	->Unit( benchmark::kNanosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_utf8Length )
+	->Range( 64, 1 << 20 )
+	->Unit( benchmark::kNanosecond );
+
+//----------------------------------------------
+// Transcoding
+//----------------------------------------------
+
+BENCHMARK( nfx::string::benchmark::BM_Naive_utf8ToUtf16 )
+	->Range( 64, 1 << 20 )
+	->Unit( benchmark::kNanosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_utf8ToUtf16 )
+	->Range( 64, 1 << 20 )
+	->Unit( benchmark::kNanosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_utf16ToUtf8 )
+	->Range( 64, 1 << 20 )
+	->Unit( benchmark::kNanosecond );
+
+BENCHMARK( nfx::string::benchmark::BM_NFX_latin1ToUtf8 )
+	->Range( 64, 1 << 20 )
+	->Unit( benchmark::kNanosecond );
+
+BENCHMARK_MAIN();
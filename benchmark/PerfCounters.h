@@ -0,0 +1,166 @@
+/**
+ * @file PerfCounters.h
+ * @brief Hardware performance counters per benchmark iteration, through Linux perf_event_open
+ * @details Built with NFX_STRINGUTILS_PERF_COUNTERS (CMake option of the same name) on Linux,
+ *          PerfCounters measures cycles, instructions, branch misses, L1 data cache read misses
+ *          and last-level cache misses of the calling thread, in user space only, and reports
+ *          them per iteration together with the IPC. Events the kernel refuses (containers,
+ *          kernel.perf_event_paranoid, virtual machines without a PMU) are silently left out.
+ *          In every other build PerfCounters compiles to nothing.
+ */
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstdint>
+
+#if defined( NFX_STRINGUTILS_PERF_COUNTERS ) && defined( __linux__ )
+#	include <linux/perf_event.h>
+#	include <sys/ioctl.h>
+#	include <sys/syscall.h>
+#	include <unistd.h>
+#endif
+
+namespace nfx::string::benchmark
+{
+	//=====================================================================
+	// Hardware performance counters
+	//=====================================================================
+
+#if defined( NFX_STRINGUTILS_PERF_COUNTERS ) && defined( __linux__ )
+
+	/**
+	 * @brief Counts hardware events of the calling thread from construction until report()
+	 * @details Each event is opened on its own, not as a group, so that the kernel can multiplex
+	 *          them when the PMU has fewer counters; counts are scaled by the time each event ran.
+	 */
+	class PerfCounters
+	{
+	public:
+		/**
+		 * @brief Opens and starts every available event
+		 */
+		PerfCounters() noexcept
+		{
+			for ( std::size_t i = 0; i < kEvents.size(); ++i )
+			{
+				perf_event_attr attributes{};
+				attributes.size = sizeof( attributes );
+				attributes.type = kEvents[i].type;
+				attributes.config = kEvents[i].config;
+				attributes.disabled = 1;
+				attributes.exclude_kernel = 1;
+				attributes.exclude_hv = 1;
+				attributes.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+				m_fds[i] = static_cast<int>( syscall( SYS_perf_event_open, &attributes, 0, -1, -1, 0 ) );
+			}
+			for ( int fd : m_fds )
+			{
+				if ( fd >= 0 )
+				{
+					ioctl( fd, PERF_EVENT_IOC_RESET, 0 );
+					ioctl( fd, PERF_EVENT_IOC_ENABLE, 0 );
+				}
+			}
+		}
+
+		PerfCounters( const PerfCounters& ) = delete;
+		PerfCounters& operator=( const PerfCounters& ) = delete;
+
+		~PerfCounters()
+		{
+			for ( int fd : m_fds )
+			{
+				if ( fd >= 0 )
+				{
+					close( fd );
+				}
+			}
+		}
+
+		/**
+		 * @brief Stops counting and adds the per-iteration counts to the benchmark counters
+		 * @param state Benchmark state, after its measurement loop
+		 */
+		void report( ::benchmark::State& state ) noexcept
+		{
+			std::array<double, kEventCount> values{};
+			std::array<bool, kEventCount> valid{};
+			for ( std::size_t i = 0; i < kEventCount; ++i )
+			{
+				if ( m_fds[i] < 0 )
+				{
+					continue;
+				}
+				ioctl( m_fds[i], PERF_EVENT_IOC_DISABLE, 0 );
+
+				// value, time enabled, time running
+				std::uint64_t counts[3]{};
+				if ( read( m_fds[i], counts, sizeof( counts ) ) != static_cast<ssize_t>( sizeof( counts ) ) || counts[2] == 0 )
+				{
+					continue;
+				}
+				values[i] = static_cast<double>( counts[0] ) * static_cast<double>( counts[1] ) / static_cast<double>( counts[2] );
+				valid[i] = true;
+			}
+
+			for ( std::size_t i = 0; i < kEventCount; ++i )
+			{
+				if ( valid[i] )
+				{
+					state.counters[kEvents[i].name] = ::benchmark::Counter( values[i], ::benchmark::Counter::kAvgIterations );
+				}
+			}
+			if ( valid[kCycles] && valid[kInstructions] && values[kCycles] > 0.0 )
+			{
+				state.counters["IPC"] = values[kInstructions] / values[kCycles];
+			}
+		}
+
+	private:
+		struct Event
+		{
+			std::uint32_t type;
+			std::uint64_t config;
+			const char* name;
+		};
+
+		static constexpr std::size_t kEventCount{ 5 };
+		static constexpr std::size_t kCycles{ 0 };
+		static constexpr std::size_t kInstructions{ 1 };
+
+		static constexpr std::array<Event, kEventCount> kEvents{ {
+			{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, "cycles/op" },
+			{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, "instructions/op" },
+			{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES, "branch-misses/op" },
+			{ PERF_TYPE_HW_CACHE,
+				PERF_COUNT_HW_CACHE_L1D | ( PERF_COUNT_HW_CACHE_OP_READ << 8 ) | ( PERF_COUNT_HW_CACHE_RESULT_MISS << 16 ),
+				"L1d-misses/op" },
+			{ PERF_TYPE_HW_CACHE,
+				PERF_COUNT_HW_CACHE_LL | ( PERF_COUNT_HW_CACHE_OP_READ << 8 ) | ( PERF_COUNT_HW_CACHE_RESULT_MISS << 16 ),
+				"LLC-misses/op" },
+		} };
+
+		std::array<int, kEventCount> m_fds{};
+	};
+
+#else
+
+	/**
+	 * @brief No-op stand-in used when hardware counters are not enabled or not supported
+	 */
+	class PerfCounters
+	{
+	public:
+		/**
+		 * @brief Does nothing
+		 */
+		void report( ::benchmark::State& ) noexcept
+		{
+		}
+	};
+
+#endif
+} // namespace nfx::string::benchmark
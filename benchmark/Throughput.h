@@ -0,0 +1,172 @@
+/**
+ * @file Throughput.h
+ * @brief Size-parameterized input buffers for throughput benchmarks, read hot or cold
+ * @details A throughput benchmark is registered with throughputArguments() and runs its operation
+ *          through runThroughput(). Every run reports bytes per second for buffer sizes from
+ *          8 bytes to 64 MiB, once on a buffer that stays cached between iterations (cold:0)
+ *          and once on a different slice of an arena four times larger than the largest cache
+ *          per iteration (cold:1), so large-input results show memory-bound behaviour.
+ *          Heap allocations per call are reported alongside (see Allocations.h), and hardware
+ *          counters when enabled (see PerfCounters.h).
+ */
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <string>
+#include <string_view>
+
+#include "Allocations.h"
+#include "PerfCounters.h"
+
+namespace nfx::string::benchmark
+{
+	//=====================================================================
+	// Throughput benchmark support
+	//=====================================================================
+
+	/**
+	 * @brief Contents of a throughput buffer
+	 */
+	enum class Fill : std::uint8_t
+	{
+		/** @brief Printable ASCII, without line breaks */
+		Text,
+
+		/** @brief Decimal digits */
+		Digits,
+
+		/** @brief ASCII whitespace */
+		Spaces
+	};
+
+	/** @brief Size of the random block tiled over a buffer */
+	inline constexpr std::size_t kThroughputBlockSize{ 64 * 1024 };
+
+	/** @brief Odd slice step of cold runs; with a power-of-two slice count it visits every slice once per cycle */
+	inline constexpr std::size_t kColdSliceStep{ 40503 };
+
+	/**
+	 * @brief Registers buffer sizes 8 B .. 64 MiB (multiplier 8), each hot and cold
+	 * @param benchmark Benchmark to configure, passed by Apply()
+	 */
+	inline void throughputArguments( ::benchmark::internal::Benchmark* benchmark )
+	{
+		benchmark->ArgNames( { "bytes", "cold" } )->ArgsProduct( { ::benchmark::CreateRange( 8, 1 << 26, 8 ), { 0, 1 } } );
+	}
+
+	/**
+	 * @brief Bytes a cold run cycles through
+	 * @return Four times the largest cache reported by the benchmark library, at least 128 MiB
+	 */
+	inline std::size_t coldFootprint()
+	{
+		std::size_t largest = std::size_t{ 32 } << 20;
+		for ( const auto& cache : ::benchmark::CPUInfo::Get().caches )
+		{
+			largest = std::max( largest, static_cast<std::size_t>( cache.size ) );
+		}
+		return 4 * largest;
+	}
+
+	/**
+	 * @brief Seeded buffer of the requested contents
+	 * @param fill Buffer contents
+	 * @param size Buffer size in bytes
+	 * @return View of a buffer shared by all benchmarks; valid until the next call with another fill or a larger size
+	 */
+	inline std::string_view fillBuffer( Fill fill, std::size_t size )
+	{
+		static std::string buffer;
+		static Fill current{ Fill::Text };
+		if ( current != fill || buffer.size() < size )
+		{
+			std::mt19937 rng{ 42 };
+			std::string block( kThroughputBlockSize, ' ' );
+			for ( char& c : block )
+			{
+				switch ( fill )
+				{
+					case Fill::Text:
+					{
+						c = static_cast<char>( ' ' + rng() % 95 );
+						break;
+					}
+					case Fill::Digits:
+					{
+						c = static_cast<char>( '0' + rng() % 10 );
+						break;
+					}
+					case Fill::Spaces:
+					{
+						c = " \t\n\r"[rng() % 4];
+						break;
+					}
+				}
+			}
+
+			// Release the previous buffer first; cold arenas are several hundred MiB
+			std::string{}.swap( buffer );
+			buffer.resize( size );
+			for ( std::size_t offset = 0; offset < size; offset += block.size() )
+			{
+				std::memcpy( buffer.data() + offset, block.data(), std::min( block.size(), size - offset ) );
+			}
+			current = fill;
+		}
+		return std::string_view{ buffer.data(), size };
+	}
+
+	/**
+	 * @brief Runs a throughput benchmark over state.range(0) bytes, hot or cold by state.range(1)
+	 * @tparam Operation Callable taking a std::string_view
+	 * @param state Benchmark state configured by throughputArguments()
+	 * @param fill Buffer contents
+	 * @param operation Operation under test; its result is kept alive with DoNotOptimize
+	 */
+	template <typename Operation>
+	inline void runThroughput( ::benchmark::State& state, Fill fill, Operation&& operation )
+	{
+		const std::size_t size = static_cast<std::size_t>( state.range( 0 ) );
+		if ( state.range( 1 ) == 0 )
+		{
+			const std::string_view buffer = fillBuffer( fill, size );
+			const test::AllocationCounter allocations;
+			PerfCounters perfCounters;
+			for ( auto _ : state )
+			{
+				auto result = operation( buffer );
+				::benchmark::DoNotOptimize( result );
+			}
+			reportAllocations( state, allocations );
+			perfCounters.report( state );
+		}
+		else
+		{
+			// Slices start on cache-line boundaries and are visited in an order the prefetcher cannot follow
+			const std::size_t stride = std::bit_ceil( std::max( size, std::size_t{ 64 } ) );
+			const std::size_t arenaSize = std::bit_ceil( std::max( coldFootprint(), 2 * stride ) );
+			const std::string_view arena = fillBuffer( fill, arenaSize );
+			const std::size_t mask = arenaSize / stride - 1;
+			std::size_t slice = 0;
+			const test::AllocationCounter allocations;
+			PerfCounters perfCounters;
+			for ( auto _ : state )
+			{
+				auto result = operation( arena.substr( slice * stride, size ) );
+				::benchmark::DoNotOptimize( result );
+				slice = ( slice + kColdSliceStep ) & mask;
+			}
+			reportAllocations( state, allocations );
+			perfCounters.report( state );
+		}
+		state.SetBytesProcessed( static_cast<std::int64_t>( state.iterations() ) * state.range( 0 ) );
+	}
+} // namespace nfx::string::benchmark
@@ -9,11 +9,41 @@
 set(PUBLIC_HEADERS)
 
 list(APPEND PUBLIC_HEADERS
+	${NFX_STRINGUTILS_INCLUDE_DIR}/nfx/string/FixedString.h
+	${NFX_STRINGUTILS_INCLUDE_DIR}/nfx/string/FuzzyIndex.h
+	${NFX_STRINGUTILS_INCLUDE_DIR}/nfx/string/Glob.h
+	${NFX_STRINGUTILS_INCLUDE_DIR}/nfx/string/Instrumentation.h
+	${NFX_STRINGUTILS_INCLUDE_DIR}/nfx/string/Levenshtein.h
+	${NFX_STRINGUTILS_INCLUDE_DIR}/nfx/string/NaturalOrder.h
+	${NFX_STRINGUTILS_INCLUDE_DIR}/nfx/string/PrefixMatcher.h
+	${NFX_STRINGUTILS_INCLUDE_DIR}/nfx/string/RadixSort.h
+	${NFX_STRINGUTILS_INCLUDE_DIR}/nfx/string/Regex.h
 	${NFX_STRINGUTILS_INCLUDE_DIR}/nfx/string/Splitter.h
+	${NFX_STRINGUTILS_INCLUDE_DIR}/nfx/string/StringLiteral.h
+	${NFX_STRINGUTILS_INCLUDE_DIR}/nfx/string/StringPool.h
+	${NFX_STRINGUTILS_INCLUDE_DIR}/nfx/string/Unicode.h
+	${NFX_STRINGUTILS_INCLUDE_DIR}/nfx/string/Utf8.h
 	${NFX_STRINGUTILS_INCLUDE_DIR}/nfx/string/Utils.h
 
+	${NFX_STRINGUTILS_INCLUDE_DIR}/nfx/detail/string/CaseTables.h
+	${NFX_STRINGUTILS_INCLUDE_DIR}/nfx/detail/string/FixedString.inl
+	${NFX_STRINGUTILS_INCLUDE_DIR}/nfx/detail/string/FuzzyIndex.inl
+	${NFX_STRINGUTILS_INCLUDE_DIR}/nfx/detail/string/Glob.inl
+	${NFX_STRINGUTILS_INCLUDE_DIR}/nfx/detail/string/Instrumentation.inl
+	${NFX_STRINGUTILS_INCLUDE_DIR}/nfx/detail/string/Levenshtein.inl
+	${NFX_STRINGUTILS_INCLUDE_DIR}/nfx/detail/string/NaturalOrder.inl
+	${NFX_STRINGUTILS_INCLUDE_DIR}/nfx/detail/string/NormalizationTables.h
+	${NFX_STRINGUTILS_INCLUDE_DIR}/nfx/detail/string/PrefixMatcher.inl
+	${NFX_STRINGUTILS_INCLUDE_DIR}/nfx/detail/string/RadixSort.inl
+	${NFX_STRINGUTILS_INCLUDE_DIR}/nfx/detail/string/Regex.inl
+	${NFX_STRINGUTILS_INCLUDE_DIR}/nfx/detail/string/Simd.h
 	${NFX_STRINGUTILS_INCLUDE_DIR}/nfx/detail/string/Splitter.inl
+	${NFX_STRINGUTILS_INCLUDE_DIR}/nfx/detail/string/StringLiteral.inl
+	${NFX_STRINGUTILS_INCLUDE_DIR}/nfx/detail/string/StringPool.inl
+	${NFX_STRINGUTILS_INCLUDE_DIR}/nfx/detail/string/Unicode.inl
+	${NFX_STRINGUTILS_INCLUDE_DIR}/nfx/detail/string/Utf8.inl
 	${NFX_STRINGUTILS_INCLUDE_DIR}/nfx/detail/string/Utils.inl
+	${NFX_STRINGUTILS_INCLUDE_DIR}/nfx/detail/string/WidthTables.h
 )
 
 #----------------------------------------------
@@ -41,3 +71,11 @@ target_compile_features(${PROJECT_NAME}
 	INTERFACE
 		cxx_std_20
 )
+
+# Opt-in hot-path counters, defined for every consumer so all translation units agree
+if(NFX_STRINGUTILS_INSTRUMENT)
+	target_compile_definitions(${PROJECT_NAME}
+		INTERFACE
+			NFX_STRINGUTILS_INSTRUMENT
+	)
+endif()
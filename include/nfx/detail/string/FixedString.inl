@@ -0,0 +1,363 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file FixedString.inl
+ * @brief Implementation of the fixed-capacity inline string
+ * @details The free function overloads build their output in a local FixedString and assign
+ *          it at the end, so the result may alias an input and is left untouched on failure.
+ */
+
+#include <algorithm>
+#include <string>
+
+namespace nfx::string
+{
+	//=====================================================================
+	// FixedString class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	template <std::size_t N>
+	template <std::size_t M>
+	inline constexpr FixedString<N>::FixedString( const char ( &str )[M] ) noexcept
+		: m_size{ static_cast<SizeType>( M - 1 ) }
+	{
+		static_assert( M >= 1 && M - 1 <= N, "String literal exceeds FixedString capacity" );
+		std::copy_n( str, M - 1, m_data );
+	}
+
+	template <std::size_t N>
+	inline constexpr FixedString<N>::FixedString( std::string_view str ) noexcept
+		: m_size{ static_cast<SizeType>( std::min( str.size(), N ) ) }
+	{
+		std::copy_n( str.data(), m_size, m_data );
+	}
+
+	//----------------------------------------------
+	// Modification
+	//----------------------------------------------
+
+	template <std::size_t N>
+	inline constexpr bool FixedString<N>::tryAssign( std::string_view str ) noexcept
+	{
+		if ( str.size() > N )
+		{
+			return false;
+		}
+
+		// str may overlap this string, e.g. when assigning a trimmed view of itself
+		std::char_traits<char>::move( m_data, str.data(), str.size() );
+		m_data[str.size()] = '\0';
+		m_size = static_cast<SizeType>( str.size() );
+		return true;
+	}
+
+	template <std::size_t N>
+	inline constexpr bool FixedString<N>::tryAppend( std::string_view str ) noexcept
+	{
+		if ( str.size() > N - m_size )
+		{
+			return false;
+		}
+
+		std::copy_n( str.data(), str.size(), m_data + m_size );
+		m_size = static_cast<SizeType>( m_size + str.size() );
+		m_data[m_size] = '\0';
+		return true;
+	}
+
+	template <std::size_t N>
+	inline constexpr bool FixedString<N>::tryAppend( std::size_t count, char ch ) noexcept
+	{
+		if ( count > N - m_size )
+		{
+			return false;
+		}
+
+		std::fill_n( m_data + m_size, count, ch );
+		m_size = static_cast<SizeType>( m_size + count );
+		m_data[m_size] = '\0';
+		return true;
+	}
+
+	template <std::size_t N>
+	inline constexpr bool FixedString<N>::tryPushBack( char ch ) noexcept
+	{
+		if ( m_size == N )
+		{
+			return false;
+		}
+
+		m_data[m_size] = ch;
+		++m_size;
+		m_data[m_size] = '\0';
+		return true;
+	}
+
+	template <std::size_t N>
+	inline constexpr void FixedString<N>::clear() noexcept
+	{
+		m_size = 0;
+		m_data[0] = '\0';
+	}
+
+	//----------------------------------------------
+	// Access
+	//----------------------------------------------
+
+	template <std::size_t N>
+	inline constexpr std::string_view FixedString<N>::view() const noexcept
+	{
+		return std::string_view{ m_data, m_size };
+	}
+
+	template <std::size_t N>
+	inline constexpr FixedString<N>::operator std::string_view() const noexcept
+	{
+		return view();
+	}
+
+	template <std::size_t N>
+	inline constexpr const char* FixedString<N>::c_str() const noexcept
+	{
+		return m_data;
+	}
+
+	template <std::size_t N>
+	inline constexpr const char* FixedString<N>::data() const noexcept
+	{
+		return m_data;
+	}
+
+	template <std::size_t N>
+	inline constexpr char* FixedString<N>::data() noexcept
+	{
+		return m_data;
+	}
+
+	template <std::size_t N>
+	inline constexpr const char& FixedString<N>::operator[]( std::size_t index ) const noexcept
+	{
+		return m_data[index];
+	}
+
+	template <std::size_t N>
+	inline constexpr char& FixedString<N>::operator[]( std::size_t index ) noexcept
+	{
+		return m_data[index];
+	}
+
+	template <std::size_t N>
+	inline constexpr const char* FixedString<N>::begin() const noexcept
+	{
+		return m_data;
+	}
+
+	template <std::size_t N>
+	inline constexpr const char* FixedString<N>::end() const noexcept
+	{
+		return m_data + m_size;
+	}
+
+	//----------------------------------------------
+	// Capacity
+	//----------------------------------------------
+
+	template <std::size_t N>
+	inline constexpr std::size_t FixedString<N>::size() const noexcept
+	{
+		return m_size;
+	}
+
+	template <std::size_t N>
+	inline constexpr bool FixedString<N>::empty() const noexcept
+	{
+		return m_size == 0;
+	}
+
+	template <std::size_t N>
+	inline constexpr std::size_t FixedString<N>::capacity() noexcept
+	{
+		return N;
+	}
+
+	//----------------------------------------------
+	// Comparison
+	//----------------------------------------------
+
+	template <std::size_t N>
+	template <std::size_t M>
+	inline constexpr bool FixedString<N>::operator==( const FixedString<M>& other ) const noexcept
+	{
+		return view() == other.view();
+	}
+
+	template <std::size_t N>
+	inline constexpr bool FixedString<N>::operator==( std::string_view other ) const noexcept
+	{
+		return view() == other;
+	}
+
+	template <std::size_t N>
+	template <std::size_t M>
+	inline constexpr std::strong_ordering FixedString<N>::operator<=>( const FixedString<M>& other ) const noexcept
+	{
+		return view() <=> other.view();
+	}
+
+	template <std::size_t N>
+	inline constexpr std::strong_ordering FixedString<N>::operator<=>( std::string_view other ) const noexcept
+	{
+		return view() <=> other;
+	}
+
+	//=====================================================================
+	// Non-allocating string operations
+	//=====================================================================
+
+	template <std::size_t N>
+	inline constexpr bool trim( std::string_view str, FixedString<N>& result ) noexcept
+	{
+		return result.tryAssign( trim( str ) );
+	}
+
+	template <std::size_t N>
+	inline constexpr bool toLower( std::string_view str, FixedString<N>& result ) noexcept
+	{
+		if ( !result.tryAssign( str ) )
+		{
+			return false;
+		}
+
+		char* data = result.data();
+		for ( std::size_t i = 0; i < result.size(); ++i )
+		{
+			data[i] = toLower( data[i] );
+		}
+		return true;
+	}
+
+	template <std::size_t N>
+	inline constexpr bool toUpper( std::string_view str, FixedString<N>& result ) noexcept
+	{
+		if ( !result.tryAssign( str ) )
+		{
+			return false;
+		}
+
+		char* data = result.data();
+		for ( std::size_t i = 0; i < result.size(); ++i )
+		{
+			data[i] = toUpper( data[i] );
+		}
+		return true;
+	}
+
+	template <std::size_t N>
+	inline constexpr bool padLeft( std::string_view str, std::size_t width, FixedString<N>& result, char fillChar ) noexcept
+	{
+		FixedString<N> padded;
+		if ( str.size() < width && !padded.tryAppend( width - str.size(), fillChar ) )
+		{
+			return false;
+		}
+		if ( !padded.tryAppend( str ) )
+		{
+			return false;
+		}
+
+		result = padded;
+		return true;
+	}
+
+	template <std::size_t N>
+	inline constexpr bool padRight( std::string_view str, std::size_t width, FixedString<N>& result, char fillChar ) noexcept
+	{
+		FixedString<N> padded;
+		if ( !padded.tryAppend( str ) )
+		{
+			return false;
+		}
+		if ( str.size() < width && !padded.tryAppend( width - str.size(), fillChar ) )
+		{
+			return false;
+		}
+
+		result = padded;
+		return true;
+	}
+
+	template <std::size_t N>
+	inline constexpr bool replace( std::string_view str, std::string_view oldStr, std::string_view newStr, FixedString<N>& result ) noexcept
+	{
+		const std::size_t pos = oldStr.empty() ? std::string_view::npos : str.find( oldStr );
+		if ( pos == std::string_view::npos )
+		{
+			return result.tryAssign( str );
+		}
+
+		FixedString<N> replaced;
+		if ( !replaced.tryAppend( str.substr( 0, pos ) ) ||
+			 !replaced.tryAppend( newStr ) ||
+			 !replaced.tryAppend( str.substr( pos + oldStr.size() ) ) )
+		{
+			return false;
+		}
+
+		result = replaced;
+		return true;
+	}
+
+	template <std::size_t N>
+	inline constexpr bool replaceAll( std::string_view str, std::string_view oldStr, std::string_view newStr, FixedString<N>& result ) noexcept
+	{
+		if ( oldStr.empty() )
+		{
+			return result.tryAssign( str );
+		}
+
+		FixedString<N> replaced;
+		std::size_t lastPos = 0;
+		std::size_t pos = 0;
+		while ( ( pos = str.find( oldStr, lastPos ) ) != std::string_view::npos )
+		{
+			if ( !replaced.tryAppend( str.substr( lastPos, pos - lastPos ) ) || !replaced.tryAppend( newStr ) )
+			{
+				return false;
+			}
+			lastPos = pos + oldStr.size();
+		}
+		if ( !replaced.tryAppend( str.substr( lastPos ) ) )
+		{
+			return false;
+		}
+
+		result = replaced;
+		return true;
+	}
+} // namespace nfx::string
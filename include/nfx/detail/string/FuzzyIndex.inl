@@ -0,0 +1,321 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file FuzzyIndex.inl
+ * @brief Implementation of the trigram-filtered approximate lookup index
+ * @details Posting lists are stored in CSR form: one sorted array of trigram keys, the start of
+ *          each key's list, and a single array of entry ids. A lookup scans only the shortest
+ *          posting lists of the query (prefix filter), counts how often each entry occurs in
+ *          them, then verifies the entries that reach the count threshold.
+ */
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <numeric>
+
+namespace nfx::string
+{
+	namespace detail
+	{
+		//=====================================================================
+		// Fuzzy index internals
+		//=====================================================================
+
+		/** @brief Boundary symbol of padded trigrams; distinct from every byte value */
+		inline constexpr std::uint32_t kFuzzyPadSymbol{ 256 };
+
+		/** @brief Edits can destroy at most this many trigrams each */
+		inline constexpr std::size_t kFuzzyGramSize{ 3 };
+
+		/**
+		 * @brief Distinct padded trigrams of a string, as sorted 27-bit keys
+		 * @param str String to decompose
+		 * @param grams Receives the keys; str.size() + 2 trigrams before removing duplicates
+		 */
+		inline void fuzzyGrams( std::string_view str, std::vector<std::uint32_t>& grams )
+		{
+			const auto symbol = [str]( std::size_t i ) noexcept -> std::uint32_t {
+				return i < 2 || i >= str.size() + 2 ? kFuzzyPadSymbol : static_cast<unsigned char>( str[i - 2] );
+			};
+
+			grams.clear();
+			for ( std::size_t i = 0; i < str.size() + 2; ++i )
+			{
+				grams.push_back( ( symbol( i ) << 18 ) | ( symbol( i + 1 ) << 9 ) | symbol( i + 2 ) );
+			}
+
+			std::sort( grams.begin(), grams.end() );
+			grams.erase( std::unique( grams.begin(), grams.end() ), grams.end() );
+		}
+
+		/** @brief a + b, saturating at the maximum of std::size_t */
+		inline std::size_t saturatingAdd( std::size_t a, std::size_t b ) noexcept
+		{
+			return b > std::numeric_limits<std::size_t>::max() - a ? std::numeric_limits<std::size_t>::max() : a + b;
+		}
+	} // namespace detail
+
+	//=====================================================================
+	// FuzzyIndex class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	template <typename Container>
+	inline FuzzyIndex::FuzzyIndex( const Container& entries )
+	{
+		std::vector<std::string_view> views;
+		views.reserve( static_cast<std::size_t>( std::distance( std::begin( entries ), std::end( entries ) ) ) );
+		for ( const auto& entry : entries )
+		{
+			views.emplace_back( entry );
+		}
+		build( views );
+	}
+
+	inline void FuzzyIndex::build( const std::vector<std::string_view>& entries )
+	{
+		const std::size_t count = entries.size();
+
+		// Renumber entries by length so that a length range is an id range
+		m_indices.resize( count );
+		std::iota( m_indices.begin(), m_indices.end(), std::uint32_t{ 0 } );
+		std::stable_sort( m_indices.begin(), m_indices.end(), [&entries]( std::uint32_t a, std::uint32_t b ) noexcept {
+			return entries[a].size() < entries[b].size();
+		} );
+
+		std::size_t totalSize = 0;
+		for ( std::string_view entry : entries )
+		{
+			totalSize += entry.size();
+		}
+		m_text.reserve( totalSize );
+		m_offsets.reserve( count + 1 );
+		for ( std::uint32_t index : m_indices )
+		{
+			m_offsets.push_back( m_text.size() );
+			m_text.append( entries[index] );
+		}
+		m_offsets.push_back( m_text.size() );
+
+		// (trigram, id) pairs sorted by trigram, then id, become the posting lists
+		std::vector<std::uint64_t> pairs;
+		pairs.reserve( totalSize + 2 * count );
+		m_gramCounts.resize( count );
+		std::vector<std::uint32_t> grams;
+		for ( std::uint32_t id = 0; id < count; ++id )
+		{
+			detail::fuzzyGrams( entry( id ), grams );
+			m_gramCounts[id] = static_cast<std::uint32_t>( grams.size() );
+			for ( std::uint32_t gram : grams )
+			{
+				pairs.push_back( ( static_cast<std::uint64_t>( gram ) << 32 ) | id );
+			}
+		}
+		std::sort( pairs.begin(), pairs.end() );
+
+		m_postings.reserve( pairs.size() );
+		for ( std::uint64_t pair : pairs )
+		{
+			const std::uint32_t gram = static_cast<std::uint32_t>( pair >> 32 );
+			if ( m_gramKeys.empty() || m_gramKeys.back() != gram )
+			{
+				m_gramKeys.push_back( gram );
+				m_gramStarts.push_back( m_postings.size() );
+			}
+			m_postings.push_back( static_cast<std::uint32_t>( pair ) );
+		}
+		m_gramStarts.push_back( m_postings.size() );
+	}
+
+	//----------------------------------------------
+	// Lookup
+	//----------------------------------------------
+
+	inline std::vector<FuzzyMatch> FuzzyIndex::find( std::string_view query, std::size_t maxDistance ) const
+	{
+		std::vector<FuzzyMatch> results;
+
+		// Only entries whose length differs by at most maxDistance can match
+		const std::size_t minLength = query.size() > maxDistance ? query.size() - maxDistance : 0;
+		const std::size_t maxLength = detail::saturatingAdd( query.size(), maxDistance );
+		const auto firstWithLength = [this]( std::size_t length ) noexcept {
+			std::uint32_t low = 0;
+			std::uint32_t high = static_cast<std::uint32_t>( size() );
+			while ( low < high )
+			{
+				const std::uint32_t middle = low + ( high - low ) / 2;
+				if ( entry( middle ).size() < length )
+				{
+					low = middle + 1;
+				}
+				else
+				{
+					high = middle;
+				}
+			}
+			return low;
+		};
+		const std::uint32_t first = firstWithLength( minLength );
+		const std::uint32_t last = maxLength == std::numeric_limits<std::size_t>::max()
+									   ? static_cast<std::uint32_t>( size() )
+									   : firstWithLength( maxLength + 1 );
+		if ( first >= last )
+		{
+			return results;
+		}
+
+		const LevenshteinMatcher matcher{ query };
+		const auto verify = [&]( std::uint32_t id ) {
+			const std::string_view value = entry( id );
+			const std::size_t distance = matcher.distance( value, maxDistance );
+			if ( distance <= maxDistance )
+			{
+				results.push_back( FuzzyMatch{ m_indices[id], distance, value } );
+			}
+		};
+
+		std::vector<std::uint32_t> grams;
+		detail::fuzzyGrams( query, grams );
+		const std::size_t slack = maxDistance > std::numeric_limits<std::size_t>::max() / detail::kFuzzyGramSize
+									  ? std::numeric_limits<std::size_t>::max()
+									  : maxDistance * detail::kFuzzyGramSize;
+
+		if ( slack >= grams.size() )
+		{
+			// The count filter cannot exclude anything
+			for ( std::uint32_t id = first; id < last; ++id )
+			{
+				verify( id );
+			}
+		}
+		else
+		{
+			// Posting list of every query trigram, narrowed to the length range
+			struct Span
+			{
+				std::vector<std::uint32_t>::const_iterator begin;
+				std::vector<std::uint32_t>::const_iterator end;
+			};
+			std::vector<Span> spans;
+			spans.reserve( grams.size() );
+			for ( std::uint32_t gram : grams )
+			{
+				const auto key = std::lower_bound( m_gramKeys.begin(), m_gramKeys.end(), gram );
+				if ( key == m_gramKeys.end() || *key != gram )
+				{
+					spans.push_back( Span{ m_postings.end(), m_postings.end() } );
+					continue;
+				}
+
+				const std::size_t list = static_cast<std::size_t>( key - m_gramKeys.begin() );
+				const auto listBegin = m_postings.begin() + static_cast<std::ptrdiff_t>( m_gramStarts[list] );
+				const auto listEnd = m_postings.begin() + static_cast<std::ptrdiff_t>( m_gramStarts[list + 1] );
+				const auto begin = std::lower_bound( listBegin, listEnd, first );
+				spans.push_back( Span{ begin, std::lower_bound( begin, listEnd, last ) } );
+			}
+			std::sort( spans.begin(), spans.end(), []( const Span& a, const Span& b ) noexcept {
+				return a.end - a.begin < b.end - b.begin;
+			} );
+
+			// A match misses at most slack query trigrams, so it appears in at least one of the
+			// slack + 1 shortest lists (prefix filter). Further short lists are scanned as long
+			// as they at most double the work, each raising the count a candidate must reach.
+			std::size_t scanned = slack + 1;
+			std::size_t required = 0;
+			for ( std::size_t i = 0; i < scanned; ++i )
+			{
+				required += static_cast<std::size_t>( spans[i].end - spans[i].begin );
+			}
+			const std::size_t budget = 2 * required;
+			for ( ; scanned < spans.size() && scanned < std::numeric_limits<std::uint8_t>::max(); ++scanned )
+			{
+				const std::size_t length = static_cast<std::size_t>( spans[scanned].end - spans[scanned].begin );
+				if ( length > budget - required )
+				{
+					break;
+				}
+				required += length;
+			}
+			const std::size_t needed = scanned - slack;
+			const std::size_t unscanned = grams.size() - scanned;
+
+			// Byte counters keep the table cache-friendly; they saturate harmlessly past 255 lists
+			std::vector<std::uint8_t> counts( last - first, 0 );
+			std::vector<std::uint32_t> candidates;
+			for ( std::size_t i = 0; i < scanned; ++i )
+			{
+				for ( auto posting = spans[i].begin; posting != spans[i].end; ++posting )
+				{
+					std::uint8_t& count = counts[*posting - first];
+					if ( count == 0 )
+					{
+						candidates.push_back( *posting );
+					}
+					if ( count < std::numeric_limits<std::uint8_t>::max() )
+					{
+						++count;
+					}
+				}
+			}
+
+			for ( std::uint32_t id : candidates )
+			{
+				const std::size_t shared = counts[id - first];
+				if ( shared >= needed && shared + unscanned + slack >= m_gramCounts[id] )
+				{
+					verify( id );
+				}
+			}
+		}
+
+		std::sort( results.begin(), results.end(), []( const FuzzyMatch& a, const FuzzyMatch& b ) noexcept {
+			return a.distance != b.distance ? a.distance < b.distance : a.index < b.index;
+		} );
+		return results;
+	}
+
+	//----------------------------------------------
+	// Access
+	//----------------------------------------------
+
+	inline std::size_t FuzzyIndex::size() const noexcept
+	{
+		return m_indices.size();
+	}
+
+	inline bool FuzzyIndex::empty() const noexcept
+	{
+		return m_indices.empty();
+	}
+
+	inline std::string_view FuzzyIndex::entry( std::uint32_t id ) const noexcept
+	{
+		return std::string_view{ m_text.data() + m_offsets[id], m_offsets[id + 1] - m_offsets[id] };
+	}
+} // namespace nfx::string
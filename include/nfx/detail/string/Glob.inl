@@ -0,0 +1,572 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Glob.inl
+ * @brief Implementation of compiled glob patterns and pattern sets
+ * @details A pattern compiles to 16-bit tokens: values below 256 are literal bytes (lowercase
+ *          for case-insensitive patterns), 256 is '?', and 257 + i refers to the i-th bracket
+ *          class, a 256-bit membership table. Stars only delimit segments.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+
+#include "nfx/detail/string/Simd.h"
+#include "nfx/string/Utils.h"
+
+namespace nfx::string
+{
+	namespace detail
+	{
+		//=====================================================================
+		// Glob internals
+		//=====================================================================
+
+		/** @brief Token matching any single byte */
+		inline constexpr std::uint16_t kGlobAnyToken{ 256 };
+
+		/** @brief Token of the first bracket class */
+		inline constexpr std::uint16_t kGlobClassToken{ 257 };
+
+		/** @brief Add a byte, and its other case when folding, to a class table */
+		inline void globClassAdd( std::array<std::uint64_t, 4>& table, unsigned char c, bool foldCase ) noexcept
+		{
+			table[c >> 6] |= std::uint64_t{ 1 } << ( c & 63 );
+			if ( foldCase && isAlpha( static_cast<char>( c ) ) )
+			{
+				const unsigned char other = static_cast<unsigned char>( c ^ 0x20 );
+				table[other >> 6] |= std::uint64_t{ 1 } << ( other & 63 );
+			}
+		}
+
+		/**
+		 * @brief Equality of two byte ranges
+		 * @details Ranges up to 16 bytes are compared with two overlapping word loads instead of a
+		 *          memcmp call, which dominates when matching short host names and paths.
+		 */
+		inline bool globBytesEqual( const char* lhs, const char* rhs, std::size_t size ) noexcept
+		{
+			if ( size >= 8 && size <= 16 )
+			{
+				return ( simd::loadU64( lhs ) == simd::loadU64( rhs ) ) &
+					   ( simd::loadU64( lhs + size - 8 ) == simd::loadU64( rhs + size - 8 ) );
+			}
+			if ( size >= 4 && size < 8 )
+			{
+				std::uint32_t a[2];
+				std::uint32_t b[2];
+				std::memcpy( &a[0], lhs, 4 );
+				std::memcpy( &a[1], lhs + size - 4, 4 );
+				std::memcpy( &b[0], rhs, 4 );
+				std::memcpy( &b[1], rhs + size - 4, 4 );
+				return ( a[0] == b[0] ) & ( a[1] == b[1] );
+			}
+			if ( size < 4 )
+			{
+				for ( std::size_t i = 0; i < size; ++i )
+				{
+					if ( lhs[i] != rhs[i] )
+					{
+						return false;
+					}
+				}
+				return true;
+			}
+			return std::memcmp( lhs, rhs, size ) == 0;
+		}
+
+		/** @brief Case-insensitive comparison of str against an already lowercase literal */
+		inline bool globEqualsFolded( const char* str, std::string_view lowerLiteral ) noexcept
+		{
+			const std::size_t size = lowerLiteral.size();
+			if ( size >= 8 )
+			{
+				// Folds 8 bytes per step; the last word overlaps the previous one
+				for ( std::size_t i = 0; i + 8 < size; i += 8 )
+				{
+					if ( simd::toLowerAsciiU64( simd::loadU64( str + i ) ) != simd::loadU64( lowerLiteral.data() + i ) )
+					{
+						return false;
+					}
+				}
+				return simd::toLowerAsciiU64( simd::loadU64( str + size - 8 ) ) == simd::loadU64( lowerLiteral.data() + size - 8 );
+			}
+
+			for ( std::size_t i = 0; i < size; ++i )
+			{
+				if ( toLower( str[i] ) != lowerLiteral[i] )
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		template <bool FoldCase>
+		inline std::size_t GlobLiteralHash<FoldCase>::operator()( std::string_view str ) const noexcept
+		{
+			if constexpr ( FoldCase )
+			{
+				// FNV-1a over the folded bytes
+				std::uint64_t hash = 14695981039346656037ull;
+				for ( char c : str )
+				{
+					hash = ( hash ^ static_cast<unsigned char>( toLower( c ) ) ) * 1099511628211ull;
+				}
+				return static_cast<std::size_t>( hash );
+			}
+			else
+			{
+				return std::hash<std::string_view>{}( str );
+			}
+		}
+
+		template <bool FoldCase>
+		inline bool GlobLiteralEqual<FoldCase>::operator()( std::string_view lhs, std::string_view rhs ) const noexcept
+		{
+			if constexpr ( FoldCase )
+			{
+				return iequals( lhs, rhs );
+			}
+			else
+			{
+				return lhs == rhs;
+			}
+		}
+	} // namespace detail
+
+	//=====================================================================
+	// GlobPattern class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	inline GlobPattern::GlobPattern( std::string_view pattern, GlobCase caseMode )
+		: m_pattern{ pattern },
+		  m_segments{},
+		  m_case{ caseMode }
+	{
+		const bool foldCase = caseMode == GlobCase::Insensitive;
+		std::size_t segmentBegin = 0;
+		bool segmentLiteral = true;
+		const auto closeSegment = [&]() {
+			const std::size_t size = m_tokens.size() - segmentBegin;
+			m_segments.push_back( Segment{ segmentBegin, size, segmentLiteral } );
+			m_minSize += size;
+			segmentBegin = m_tokens.size();
+			segmentLiteral = true;
+		};
+		const auto addLiteral = [&]( char c ) {
+			const char folded = foldCase ? toLower( c ) : c;
+			m_tokens.push_back( static_cast<unsigned char>( folded ) );
+			m_literals.push_back( folded );
+		};
+		const auto addWildcard = [&]( std::uint16_t token ) {
+			m_tokens.push_back( token );
+			m_literals.push_back( '\0' );
+			segmentLiteral = false;
+		};
+
+		bool previousStar = false;
+		for ( std::size_t i = 0; i < pattern.size(); ++i )
+		{
+			const char c = pattern[i];
+			if ( c == '*' )
+			{
+				// Consecutive stars are one star
+				if ( !previousStar )
+				{
+					closeSegment();
+				}
+				m_hasStar = true;
+				previousStar = true;
+				continue;
+			}
+
+			previousStar = false;
+			if ( c == '?' )
+			{
+				addWildcard( detail::kGlobAnyToken );
+			}
+			else if ( c == '\\' && i + 1 < pattern.size() )
+			{
+				addLiteral( pattern[++i] );
+			}
+			else if ( c == '[' )
+			{
+				std::size_t j = i + 1;
+				const bool negate = j < pattern.size() && ( pattern[j] == '!' || pattern[j] == '^' );
+				if ( negate )
+				{
+					++j;
+				}
+
+				std::array<std::uint64_t, 4> table{};
+				bool closed = false;
+				for ( bool first = true; j < pattern.size(); first = false )
+				{
+					if ( pattern[j] == ']' && !first )
+					{
+						closed = true;
+						break;
+					}
+
+					unsigned char low = static_cast<unsigned char>( pattern[j] );
+					if ( low == '\\' && j + 1 < pattern.size() )
+					{
+						low = static_cast<unsigned char>( pattern[++j] );
+					}
+					++j;
+
+					unsigned char high = low;
+					if ( j + 1 < pattern.size() && pattern[j] == '-' && pattern[j + 1] != ']' )
+					{
+						j += 1;
+						high = static_cast<unsigned char>( pattern[j] );
+						if ( high == '\\' && j + 1 < pattern.size() )
+						{
+							high = static_cast<unsigned char>( pattern[++j] );
+						}
+						++j;
+					}
+					for ( unsigned int b = low; b <= high; ++b )
+					{
+						detail::globClassAdd( table, static_cast<unsigned char>( b ), foldCase );
+					}
+				}
+
+				if ( !closed )
+				{
+					addLiteral( c );
+					continue;
+				}
+				if ( negate )
+				{
+					for ( std::uint64_t& word : table )
+					{
+						word = ~word;
+					}
+				}
+				m_classes.push_back( table );
+				addWildcard( static_cast<std::uint16_t>( detail::kGlobClassToken + m_classes.size() - 1 ) );
+				i = j;
+			}
+			else
+			{
+				addLiteral( c );
+			}
+		}
+		closeSegment();
+	}
+
+	//----------------------------------------------
+	// Matching
+	//----------------------------------------------
+
+	inline bool GlobPattern::matches( std::string_view str ) const noexcept
+	{
+		if ( !m_hasStar )
+		{
+			return str.size() == m_minSize && matchesAt( m_segments.front(), str, 0 );
+		}
+		if ( str.size() < m_minSize )
+		{
+			return false;
+		}
+
+		const Segment& head = m_segments.front();
+		const Segment& tail = m_segments.back();
+		if ( !matchesAt( tail, str, str.size() - tail.size ) || !matchesAt( head, str, 0 ) )
+		{
+			return false;
+		}
+
+		// Leftmost placement of each middle segment leaves the most room for the next one
+		const std::string_view middle = str.substr( 0, str.size() - tail.size );
+		std::size_t pos = head.size;
+		for ( std::size_t s = 1; s + 1 < m_segments.size(); ++s )
+		{
+			const std::size_t found = findSegment( m_segments[s], middle, pos );
+			if ( found == std::string_view::npos )
+			{
+				return false;
+			}
+			pos = found + m_segments[s].size;
+		}
+		return true;
+	}
+
+	inline bool GlobPattern::tokenMatches( std::uint16_t token, char c ) const noexcept
+	{
+		if ( token < detail::kGlobAnyToken )
+		{
+			return ( m_case == GlobCase::Insensitive ? toLower( c ) : c ) == static_cast<char>( token );
+		}
+		if ( token == detail::kGlobAnyToken )
+		{
+			return true;
+		}
+
+		const unsigned char byte = static_cast<unsigned char>( c );
+		return ( m_classes[token - detail::kGlobClassToken][byte >> 6] >> ( byte & 63 ) ) & 1;
+	}
+
+	inline bool GlobPattern::matchesAt( const Segment& segment, std::string_view str, std::size_t pos ) const noexcept
+	{
+		if ( segment.literal )
+		{
+			const std::string_view literal{ m_literals.data() + segment.begin, segment.size };
+			return m_case == GlobCase::Insensitive ? detail::globEqualsFolded( str.data() + pos, literal )
+												   : detail::globBytesEqual( str.data() + pos, literal.data(), literal.size() );
+		}
+
+		for ( std::size_t i = 0; i < segment.size; ++i )
+		{
+			if ( !tokenMatches( m_tokens[segment.begin + i], str[pos + i] ) )
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	inline std::size_t GlobPattern::findSegment( const Segment& segment, std::string_view str, std::size_t pos ) const noexcept
+	{
+		if ( segment.literal && m_case == GlobCase::Sensitive )
+		{
+			return str.find( std::string_view{ m_literals.data() + segment.begin, segment.size }, pos );
+		}
+
+		if ( str.size() < segment.size )
+		{
+			return std::string_view::npos;
+		}
+		for ( std::size_t last = str.size() - segment.size; pos <= last; ++pos )
+		{
+			if ( tokenMatches( m_tokens[segment.begin], str[pos] ) && matchesAt( segment, str, pos ) )
+			{
+				return pos;
+			}
+		}
+		return std::string_view::npos;
+	}
+
+	//----------------------------------------------
+	// Access
+	//----------------------------------------------
+
+	inline std::string_view GlobPattern::pattern() const noexcept
+	{
+		return m_pattern;
+	}
+
+	inline GlobCase GlobPattern::caseMode() const noexcept
+	{
+		return m_case;
+	}
+
+	//=====================================================================
+	// GlobSet class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Modifiers
+	//----------------------------------------------
+
+	inline std::size_t GlobSet::add( std::string_view pattern, GlobCase caseMode )
+	{
+		const std::size_t id = m_patterns.size();
+		const GlobPattern& glob = m_patterns.emplace_back( pattern, caseMode );
+		const bool foldCase = caseMode == GlobCase::Insensitive;
+
+		if ( !glob.m_hasStar && glob.m_segments.front().literal )
+		{
+			if ( foldCase )
+			{
+				m_exactIgnoreCase[glob.m_literals].push_back( id );
+			}
+			else
+			{
+				m_exact[glob.m_literals].push_back( id );
+			}
+			return id;
+		}
+
+		// Key by the longer of the literal runs anchored at the start and at the end
+		const auto& head = glob.m_segments.front();
+		const auto& tail = glob.m_segments.back();
+		std::size_t prefixLength = 0;
+		while ( prefixLength < head.size && glob.m_tokens[head.begin + prefixLength] < detail::kGlobAnyToken )
+		{
+			++prefixLength;
+		}
+		std::size_t suffixLength = 0;
+		while ( suffixLength < tail.size && glob.m_tokens[tail.begin + tail.size - 1 - suffixLength] < detail::kGlobAnyToken )
+		{
+			++suffixLength;
+		}
+
+		if ( prefixLength == 0 && suffixLength == 0 )
+		{
+			m_unkeyed.push_back( id );
+		}
+		else if ( prefixLength >= suffixLength )
+		{
+			const std::string_view prefix{ glob.m_literals.data() + head.begin, prefixLength };
+			if ( foldCase )
+			{
+				addKeyed( m_prefixesIgnoreCase, prefix, id );
+			}
+			else
+			{
+				addKeyed( m_prefixes, prefix, id );
+			}
+		}
+		else
+		{
+			const std::string_view suffix{ glob.m_literals.data() + tail.begin + tail.size - suffixLength, suffixLength };
+			if ( foldCase )
+			{
+				addKeyed( m_suffixesIgnoreCase, suffix, id );
+			}
+			else
+			{
+				addKeyed( m_suffixes, suffix, id );
+			}
+		}
+		return id;
+	}
+
+	template <bool FoldCase>
+	inline void GlobSet::addKeyed( std::vector<detail::GlobAffixTable<FoldCase>>& tables, std::string_view literal, std::size_t id )
+	{
+		auto table = std::find_if( tables.begin(), tables.end(), [&literal]( const auto& candidate ) noexcept {
+			return candidate.length == literal.size();
+		} );
+		if ( table == tables.end() )
+		{
+			table = tables.insert( tables.end(), detail::GlobAffixTable<FoldCase>{ literal.size(), {} } );
+		}
+		table->ids[std::string{ literal }].push_back( id );
+	}
+
+	//----------------------------------------------
+	// Matching
+	//----------------------------------------------
+
+	inline bool GlobSet::matchesAny( std::string_view str ) const
+	{
+		return !forEachMatch( str, []( std::size_t ) noexcept { return false; } );
+	}
+
+	inline std::vector<std::size_t> GlobSet::matches( std::string_view str ) const
+	{
+		std::vector<std::size_t> ids;
+		forEachMatch( str, [&ids]( std::size_t id ) {
+			ids.push_back( id );
+			return true;
+		} );
+		std::sort( ids.begin(), ids.end() );
+		return ids;
+	}
+
+	template <typename Visitor>
+	inline bool GlobSet::forEachMatch( std::string_view str, const Visitor& visitor ) const
+	{
+		const auto visitAll = [&]( const std::vector<std::size_t>& ids ) {
+			for ( std::size_t id : ids )
+			{
+				if ( m_patterns[id].matches( str ) && !visitor( id ) )
+				{
+					return false;
+				}
+			}
+			return true;
+		};
+		const auto visitExact = [&]( const auto& table ) {
+			const auto found = table.find( str );
+			if ( found != table.end() )
+			{
+				for ( std::size_t id : found->second )
+				{
+					if ( !visitor( id ) )
+					{
+						return false;
+					}
+				}
+			}
+			return true;
+		};
+
+		if ( ( !m_exact.empty() && !visitExact( m_exact ) ) || ( !m_exactIgnoreCase.empty() && !visitExact( m_exactIgnoreCase ) ) )
+		{
+			return false;
+		}
+		const auto visitAffixes = [&]( const auto& tables, bool suffix ) {
+			for ( const auto& table : tables )
+			{
+				if ( table.length > str.size() )
+				{
+					continue;
+				}
+				const auto found = table.ids.find( suffix ? str.substr( str.size() - table.length ) : str.substr( 0, table.length ) );
+				if ( found != table.ids.end() && !visitAll( found->second ) )
+				{
+					return false;
+				}
+			}
+			return true;
+		};
+
+		if ( !visitAffixes( m_prefixes, false ) || !visitAffixes( m_suffixes, true ) ||
+			 !visitAffixes( m_prefixesIgnoreCase, false ) || !visitAffixes( m_suffixesIgnoreCase, true ) )
+		{
+			return false;
+		}
+		return visitAll( m_unkeyed );
+	}
+
+	//----------------------------------------------
+	// Access
+	//----------------------------------------------
+
+	inline std::size_t GlobSet::size() const noexcept
+	{
+		return m_patterns.size();
+	}
+
+	inline bool GlobSet::empty() const noexcept
+	{
+		return m_patterns.empty();
+	}
+
+	inline const GlobPattern& GlobSet::operator[]( std::size_t id ) const noexcept
+	{
+		return m_patterns[id];
+	}
+} // namespace nfx::string
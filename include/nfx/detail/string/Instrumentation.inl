@@ -0,0 +1,309 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Instrumentation.inl
+ * @brief Implementation of the opt-in hot-path counters
+ * @details Each thread owns a block of counters that only it writes, with relaxed atomic stores,
+ *          so counting never locks and a concurrent snapshot reads whole values. Blocks are
+ *          linked into a registry when a thread first counts and folded into the retired totals
+ *          when it exits. Thread exit is observed through a pthread key rather than a thread_local
+ *          destructor, whose registration allocates on some C++ runtimes, so counting never
+ *          allocates on POSIX either.
+ */
+
+#if defined( NFX_STRINGUTILS_INSTRUMENT )
+#	include <atomic>
+#	include <chrono>
+#	include <mutex>
+#	include <new>
+#	include <type_traits>
+#	if !defined( _WIN32 )
+#		include <pthread.h>
+#	endif
+#endif
+
+namespace nfx::string
+{
+#if defined( NFX_STRINGUTILS_INSTRUMENT )
+	namespace detail
+	{
+		//=====================================================================
+		// Instrumentation internals
+		//=====================================================================
+
+		//----------------------------------------------
+		// Per-thread counters
+		//----------------------------------------------
+
+		/** @brief Counters of one function, written by the owning thread only */
+		struct InstrumentationSlot
+		{
+			std::atomic<std::uint64_t> calls{ 0 };
+			std::atomic<std::uint64_t> bytes{ 0 };
+			std::atomic<std::uint64_t> nanoseconds{ 0 };
+		};
+
+		/** @brief Adds to a single-writer counter without a read-modify-write instruction */
+		inline void addRelaxed( std::atomic<std::uint64_t>& counter, std::uint64_t value ) noexcept
+		{
+			counter.store( counter.load( std::memory_order_relaxed ) + value, std::memory_order_relaxed );
+		}
+
+		/** @brief Accumulates a slot into plain totals */
+		inline void accumulate( InstrumentationCounters& totals, const InstrumentationSlot& slot ) noexcept
+		{
+			totals.calls += slot.calls.load( std::memory_order_relaxed );
+			totals.bytes += slot.bytes.load( std::memory_order_relaxed );
+			totals.nanoseconds += slot.nanoseconds.load( std::memory_order_relaxed );
+		}
+
+		/** @brief Counter block of one thread, linked into the registry until the thread exits */
+		class ThreadInstrumentation
+		{
+		public:
+			inline ThreadInstrumentation() noexcept;
+
+			/** @brief Folds the counters into the retired totals and unlinks the block */
+			inline void retire() noexcept;
+
+			ThreadInstrumentation( const ThreadInstrumentation& ) = delete;
+			ThreadInstrumentation& operator=( const ThreadInstrumentation& ) = delete;
+
+			std::array<InstrumentationSlot, kInstrumentedFunctionCount> m_slots;
+			ThreadInstrumentation* m_previous{ nullptr };
+			ThreadInstrumentation* m_next{ nullptr };
+		};
+
+		//----------------------------------------------
+		// Registry
+		//----------------------------------------------
+
+		/** @brief Live thread blocks and the totals of exited threads */
+		struct InstrumentationRegistry
+		{
+#if !defined( _WIN32 )
+			InstrumentationRegistry() noexcept
+			{
+				pthread_key_create( &exitKey, []( void* block ) { static_cast<ThreadInstrumentation*>( block )->retire(); } );
+			}
+
+			/** @brief Key whose destructor retires the block of an exiting thread */
+			pthread_key_t exitKey;
+#endif
+			std::mutex mutex;
+			ThreadInstrumentation* threads{ nullptr };
+			InstrumentationSnapshot retired;
+		};
+
+		/**
+		 * @brief Process-wide registry
+		 * @details Built in static storage without allocating and never destroyed, so threads
+		 *          exiting during or after static destruction can still retire their counters.
+		 */
+		inline InstrumentationRegistry& instrumentationRegistry() noexcept
+		{
+			alignas( InstrumentationRegistry ) static unsigned char storage[sizeof( InstrumentationRegistry )];
+			static InstrumentationRegistry* const registry{ ::new ( static_cast<void*>( storage ) ) InstrumentationRegistry{} };
+			return *registry;
+		}
+
+		inline ThreadInstrumentation::ThreadInstrumentation() noexcept
+		{
+			InstrumentationRegistry& registry{ instrumentationRegistry() };
+			const std::lock_guard lock{ registry.mutex };
+			m_next = registry.threads;
+			if ( m_next )
+			{
+				m_next->m_previous = this;
+			}
+			registry.threads = this;
+#if !defined( _WIN32 )
+			pthread_setspecific( registry.exitKey, this );
+#endif
+		}
+
+		inline void ThreadInstrumentation::retire() noexcept
+		{
+			InstrumentationRegistry& registry{ instrumentationRegistry() };
+			const std::lock_guard lock{ registry.mutex };
+			for ( std::size_t i = 0; i < kInstrumentedFunctionCount; ++i )
+			{
+				accumulate( registry.retired.counters[i], m_slots[i] );
+			}
+			( m_previous ? m_previous->m_next : registry.threads ) = m_next;
+			if ( m_next )
+			{
+				m_next->m_previous = m_previous;
+			}
+		}
+
+		/** @brief Counter block of the calling thread, registered on first use */
+		inline ThreadInstrumentation& threadInstrumentation() noexcept
+		{
+#if defined( _WIN32 )
+			struct Owner
+			{
+				ThreadInstrumentation block;
+
+				~Owner()
+				{
+					block.retire();
+				}
+			};
+			thread_local Owner owner;
+			return owner.block;
+#else
+			// Trivially destructible, so the runtime records no destructor; the exit key retires it
+			thread_local ThreadInstrumentation instrumentation;
+			return instrumentation;
+#endif
+		}
+
+		//----------------------------------------------
+		// InstrumentationProbe class
+		//----------------------------------------------
+
+		/**
+		 * @brief Scope guard recording calls, bytes and elapsed time of the enclosing function
+		 * @details A literal type that does nothing during constant evaluation, so the constexpr
+		 *          validators keep working in constant expressions.
+		 */
+		class InstrumentationProbe
+		{
+		public:
+			constexpr InstrumentationProbe( InstrumentedFunction function, std::size_t bytes, std::uint64_t calls = 1 ) noexcept
+				: m_function{ function },
+				  m_bytes{ bytes },
+				  m_calls{ calls }
+			{
+				if ( !std::is_constant_evaluated() )
+				{
+					m_start = std::chrono::steady_clock::now();
+				}
+			}
+
+			constexpr ~InstrumentationProbe()
+			{
+				if ( !std::is_constant_evaluated() )
+				{
+					const auto elapsed{ std::chrono::steady_clock::now() - m_start };
+					InstrumentationSlot& slot{ threadInstrumentation().m_slots[static_cast<std::size_t>( m_function )] };
+					addRelaxed( slot.calls, m_calls );
+					addRelaxed( slot.bytes, m_bytes );
+					addRelaxed( slot.nanoseconds, static_cast<std::uint64_t>( std::chrono::duration_cast<std::chrono::nanoseconds>( elapsed ).count() ) );
+				}
+			}
+
+			InstrumentationProbe( const InstrumentationProbe& ) = delete;
+			InstrumentationProbe& operator=( const InstrumentationProbe& ) = delete;
+
+		private:
+			InstrumentedFunction m_function;
+			std::size_t m_bytes;
+			std::uint64_t m_calls;
+			std::chrono::steady_clock::time_point m_start{};
+		};
+	} // namespace detail
+#endif
+
+	//=====================================================================
+	// InstrumentationSnapshot
+	//=====================================================================
+
+	inline constexpr const InstrumentationCounters& InstrumentationSnapshot::operator[]( InstrumentedFunction function ) const noexcept
+	{
+		return counters[static_cast<std::size_t>( function )];
+	}
+
+	inline constexpr InstrumentationSnapshot InstrumentationSnapshot::operator-( const InstrumentationSnapshot& earlier ) const noexcept
+	{
+		InstrumentationSnapshot difference;
+		for ( std::size_t i = 0; i < kInstrumentedFunctionCount; ++i )
+		{
+			difference.counters[i].calls = counters[i].calls - earlier.counters[i].calls;
+			difference.counters[i].bytes = counters[i].bytes - earlier.counters[i].bytes;
+			difference.counters[i].nanoseconds = counters[i].nanoseconds - earlier.counters[i].nanoseconds;
+		}
+		return difference;
+	}
+
+	//=====================================================================
+	// Export
+	//=====================================================================
+
+	inline constexpr std::string_view instrumentedFunctionName( InstrumentedFunction function ) noexcept
+	{
+		switch ( function )
+		{
+			case InstrumentedFunction::ReplaceAll:
+				return "replaceAll";
+			case InstrumentedFunction::Splitter:
+				return "Splitter";
+			case InstrumentedFunction::TryParseBool:
+				return "tryParseBool";
+			case InstrumentedFunction::TryParseInt:
+				return "tryParseInt";
+			case InstrumentedFunction::TryParseUInt:
+				return "tryParseUInt";
+			case InstrumentedFunction::TryParseLong:
+				return "tryParseLong";
+			case InstrumentedFunction::TryParseFloat:
+				return "tryParseFloat";
+			case InstrumentedFunction::TryParseDouble:
+				return "tryParseDouble";
+			case InstrumentedFunction::IsIPv4Address:
+				return "isIPv4Address";
+			case InstrumentedFunction::IsIPv6Address:
+				return "isIPv6Address";
+			case InstrumentedFunction::IsValidHostname:
+				return "isValidHostname";
+			case InstrumentedFunction::IsDomainName:
+				return "isDomainName";
+			case InstrumentedFunction::IsValidPort:
+				return "isValidPort";
+			case InstrumentedFunction::TryParseEndpoint:
+				return "tryParseEndpoint";
+		}
+		return {};
+	}
+
+	inline InstrumentationSnapshot instrumentationSnapshot()
+	{
+		InstrumentationSnapshot snapshot;
+#if defined( NFX_STRINGUTILS_INSTRUMENT )
+		detail::InstrumentationRegistry& registry{ detail::instrumentationRegistry() };
+		const std::lock_guard lock{ registry.mutex };
+		snapshot = registry.retired;
+		for ( const detail::ThreadInstrumentation* thread = registry.threads; thread; thread = thread->m_next )
+		{
+			for ( std::size_t i = 0; i < kInstrumentedFunctionCount; ++i )
+			{
+				detail::accumulate( snapshot.counters[i], thread->m_slots[i] );
+			}
+		}
+#endif
+		return snapshot;
+	}
+} // namespace nfx::string
@@ -0,0 +1,291 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Levenshtein.inl
+ * @brief Implementation of the bit-parallel Levenshtein distance
+ * @details Bit i of the vertical delta vectors VP/VN records whether D[i + 1][j] - D[i][j] is
+ *          +1 or -1 for the current text column j; the distance is tracked at the last pattern
+ *          row. Multi-word patterns pass the horizontal delta at the bottom of each 64-row
+ *          block into the block below, as in Myers (1999), section 4.
+ */
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <utility>
+
+namespace nfx::string
+{
+	namespace detail
+	{
+		//=====================================================================
+		// Edit distance internals
+		//=====================================================================
+
+		/** @brief Pattern rows held by one block */
+		inline constexpr std::size_t kLevenshteinBlockBits{ 64 };
+
+		/**
+		 * @brief Check whether the distance can no longer come back within the bound
+		 * @param score Distance at the last pattern row for the current column
+		 * @param remaining Text bytes still to process; each can lower the score by at most one
+		 */
+		inline bool levenshteinExceeds( std::size_t score, std::size_t remaining, std::size_t maxDistance ) noexcept
+		{
+			return score > remaining && score - remaining > maxDistance;
+		}
+
+		/** @brief Distance for a pattern of 1 to 64 bytes, using one word per vector */
+		inline std::size_t levenshteinWord(
+			const std::uint64_t* masks, std::size_t patternSize, std::string_view text, std::size_t maxDistance ) noexcept
+		{
+			const std::uint64_t lastRow = std::uint64_t{ 1 } << ( patternSize - 1 );
+			std::uint64_t vp = ~std::uint64_t{ 0 };
+			std::uint64_t vn = 0;
+			std::size_t score = patternSize;
+
+			for ( std::size_t j = 0; j < text.size(); ++j )
+			{
+				const std::uint64_t eq = masks[static_cast<unsigned char>( text[j] )];
+				const std::uint64_t d0 = ( ( ( eq & vp ) + vp ) ^ vp ) | eq | vn;
+				std::uint64_t hp = vn | ~( d0 | vp );
+				std::uint64_t hn = vp & d0;
+
+				score += ( hp & lastRow ) != 0;
+				score -= ( hn & lastRow ) != 0;
+				if ( levenshteinExceeds( score, text.size() - j - 1, maxDistance ) )
+				{
+					return maxDistance + 1;
+				}
+
+				hp = ( hp << 1 ) | 1;
+				hn <<= 1;
+				vp = hn | ~( d0 | hp );
+				vn = hp & d0;
+			}
+
+			return score;
+		}
+
+		/**
+		 * @brief Advance one 64-row block by one text column
+		 * @param vp Positive vertical deltas of the block
+		 * @param vn Negative vertical deltas of the block
+		 * @param eq Match mask of the text byte for this block
+		 * @param carry Horizontal delta entering at the top of the block (-1, 0 or +1)
+		 * @param lastRow Bit of the block's bottom row
+		 * @return Horizontal delta leaving at the bottom row
+		 */
+		inline int levenshteinAdvanceBlock( std::uint64_t& vp, std::uint64_t& vn, std::uint64_t eq, int carry, std::uint64_t lastRow ) noexcept
+		{
+			const std::uint64_t xv = eq | vn;
+			if ( carry < 0 )
+			{
+				eq |= 1;
+			}
+			const std::uint64_t xh = ( ( ( eq & vp ) + vp ) ^ vp ) | eq;
+			std::uint64_t hp = vn | ~( xh | vp );
+			std::uint64_t hn = vp & xh;
+
+			const int carryOut = ( hp & lastRow ) != 0 ? 1 : ( ( hn & lastRow ) != 0 ? -1 : 0 );
+
+			hp <<= 1;
+			hn <<= 1;
+			if ( carry < 0 )
+			{
+				hn |= 1;
+			}
+			else if ( carry > 0 )
+			{
+				hp |= 1;
+			}
+
+			vp = hn | ~( xv | hp );
+			vn = hp & xv;
+			return carryOut;
+		}
+
+		/** @brief Distance for a pattern longer than 64 bytes; masks hold blocks words per byte value */
+		inline std::size_t levenshteinBlocks( const std::uint64_t* masks, std::size_t patternSize, std::size_t blocks,
+			std::string_view text, std::size_t maxDistance )
+		{
+			std::vector<std::uint64_t> vp( blocks, ~std::uint64_t{ 0 } );
+			std::vector<std::uint64_t> vn( blocks, 0 );
+			const std::uint64_t lastRow = std::uint64_t{ 1 } << ( ( patternSize - 1 ) % kLevenshteinBlockBits );
+			constexpr std::uint64_t topBit = std::uint64_t{ 1 } << ( kLevenshteinBlockBits - 1 );
+			std::size_t score = patternSize;
+
+			for ( std::size_t j = 0; j < text.size(); ++j )
+			{
+				const std::uint64_t* eq = masks + static_cast<unsigned char>( text[j] ) * blocks;
+
+				// Row 0 of the DP table is D[0][j] = j, so +1 enters the first block
+				int carry = 1;
+				for ( std::size_t b = 0; b + 1 < blocks; ++b )
+				{
+					carry = levenshteinAdvanceBlock( vp[b], vn[b], eq[b], carry, topBit );
+				}
+				carry = levenshteinAdvanceBlock( vp[blocks - 1], vn[blocks - 1], eq[blocks - 1], carry, lastRow );
+
+				score = static_cast<std::size_t>( static_cast<std::ptrdiff_t>( score ) + carry );
+				if ( levenshteinExceeds( score, text.size() - j - 1, maxDistance ) )
+				{
+					return maxDistance + 1;
+				}
+			}
+
+			return score;
+		}
+
+		/** @brief Set bit i of the masks of pattern[i]; masks hold blocks words per byte value */
+		inline void levenshteinBuildMasks( std::string_view pattern, std::size_t blocks, std::uint64_t* masks ) noexcept
+		{
+			for ( std::size_t i = 0; i < pattern.size(); ++i )
+			{
+				masks[static_cast<unsigned char>( pattern[i] ) * blocks + i / kLevenshteinBlockBits] |=
+					std::uint64_t{ 1 } << ( i % kLevenshteinBlockBits );
+			}
+		}
+
+		/** @brief Handles the cases decided by the lengths alone; returns false if a scan is needed */
+		inline bool levenshteinTrivial( std::size_t patternSize, std::size_t textSize, std::size_t maxDistance, std::size_t& result ) noexcept
+		{
+			const std::size_t lengthDifference = patternSize > textSize ? patternSize - textSize : textSize - patternSize;
+			if ( lengthDifference > maxDistance )
+			{
+				result = maxDistance + 1;
+				return true;
+			}
+			if ( patternSize == 0 || textSize == 0 )
+			{
+				result = lengthDifference;
+				return true;
+			}
+			return false;
+		}
+	} // namespace detail
+
+	//=====================================================================
+	// Edit distance
+	//=====================================================================
+
+	inline std::size_t levenshteinDistance( std::string_view lhs, std::string_view rhs )
+	{
+		return levenshteinDistance( lhs, rhs, std::numeric_limits<std::size_t>::max() );
+	}
+
+	inline std::size_t levenshteinDistance( std::string_view lhs, std::string_view rhs, std::size_t maxDistance )
+	{
+		// Shared prefixes and suffixes never change the distance
+		const std::size_t prefix = static_cast<std::size_t>(
+			std::mismatch( lhs.begin(), lhs.end(), rhs.begin(), rhs.end() ).first - lhs.begin() );
+		lhs.remove_prefix( prefix );
+		rhs.remove_prefix( prefix );
+		const std::size_t suffix = static_cast<std::size_t>(
+			std::mismatch( lhs.rbegin(), lhs.rend(), rhs.rbegin(), rhs.rend() ).first - lhs.rbegin() );
+		lhs.remove_suffix( suffix );
+		rhs.remove_suffix( suffix );
+
+		// The shorter string becomes the bit-parallel pattern
+		if ( lhs.size() > rhs.size() )
+		{
+			std::swap( lhs, rhs );
+		}
+
+		std::size_t result;
+		if ( detail::levenshteinTrivial( lhs.size(), rhs.size(), maxDistance, result ) )
+		{
+			return result;
+		}
+
+		if ( lhs.size() <= detail::kLevenshteinBlockBits )
+		{
+			std::array<std::uint64_t, 256> masks{};
+			detail::levenshteinBuildMasks( lhs, 1, masks.data() );
+			return detail::levenshteinWord( masks.data(), lhs.size(), rhs, maxDistance );
+		}
+
+		const std::size_t blocks = ( lhs.size() + detail::kLevenshteinBlockBits - 1 ) / detail::kLevenshteinBlockBits;
+		std::vector<std::uint64_t> masks( 256 * blocks, 0 );
+		detail::levenshteinBuildMasks( lhs, blocks, masks.data() );
+		return detail::levenshteinBlocks( masks.data(), lhs.size(), blocks, rhs, maxDistance );
+	}
+
+	//=====================================================================
+	// LevenshteinMatcher class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	inline LevenshteinMatcher::LevenshteinMatcher( std::string_view query )
+		: m_size{ query.size() },
+		  m_blocks{ std::max<std::size_t>( 1, ( query.size() + detail::kLevenshteinBlockBits - 1 ) / detail::kLevenshteinBlockBits ) },
+		  m_masks( 256 * m_blocks, 0 )
+	{
+		detail::levenshteinBuildMasks( query, m_blocks, m_masks.data() );
+	}
+
+	//----------------------------------------------
+	// Distance
+	//----------------------------------------------
+
+	inline std::size_t LevenshteinMatcher::distance( std::string_view candidate, std::size_t maxDistance ) const
+	{
+		std::size_t result;
+		if ( detail::levenshteinTrivial( m_size, candidate.size(), maxDistance, result ) )
+		{
+			return result;
+		}
+
+		if ( m_blocks == 1 )
+		{
+			return detail::levenshteinWord( m_masks.data(), m_size, candidate, maxDistance );
+		}
+		return detail::levenshteinBlocks( m_masks.data(), m_size, m_blocks, candidate, maxDistance );
+	}
+
+	template <typename Container>
+	inline std::vector<std::size_t> LevenshteinMatcher::distances( const Container& candidates, std::size_t maxDistance ) const
+	{
+		std::vector<std::size_t> results;
+		results.reserve( static_cast<std::size_t>( std::distance( std::begin( candidates ), std::end( candidates ) ) ) );
+		for ( const auto& candidate : candidates )
+		{
+			results.push_back( distance( std::string_view{ candidate }, maxDistance ) );
+		}
+		return results;
+	}
+
+	//----------------------------------------------
+	// Access
+	//----------------------------------------------
+
+	inline std::size_t LevenshteinMatcher::size() const noexcept
+	{
+		return m_size;
+	}
+} // namespace nfx::string
@@ -0,0 +1,257 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file NaturalOrder.inl
+ * @brief Implementation of natural-order comparison and sorting
+ * @details The sort key of a string is its bytes with each digit run replaced by the marker '0',
+ *          the length of the run without leading zeros, and its significant digits. The marker
+ *          compares against any other byte exactly like a digit would, and the length settles
+ *          runs of different magnitude before their digits are reached. Leading-zero counts go
+ *          into a separate tie-break key compared only when the main keys are equal. The main
+ *          keys are sorted with the cached-key multikey quicksort of RadixSort.h.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "nfx/string/RadixSort.h"
+
+namespace nfx::string
+{
+	namespace detail
+	{
+		//=====================================================================
+		// Natural order internals
+		//=====================================================================
+
+		/**
+		 * @brief Append an order-preserving encoding of a count
+		 * @details One byte below 255, otherwise 0xFF followed by 8 big-endian bytes.
+		 */
+		inline void appendNaturalCount( std::string& key, std::size_t count )
+		{
+			if ( count < 0xFF )
+			{
+				key.push_back( static_cast<char>( count ) );
+				return;
+			}
+
+			key.push_back( static_cast<char>( 0xFF ) );
+			for ( int shift = 56; shift >= 0; shift -= 8 )
+			{
+				key.push_back( static_cast<char>( static_cast<std::uint64_t>( count ) >> shift ) );
+			}
+		}
+
+		/** @brief Location of the sort key of one string in the shared key buffer */
+		struct NaturalKey
+		{
+			/** @brief Offset of the main key in the buffer; the tie-break key follows it */
+			std::size_t offset;
+
+			/** @brief Main key length */
+			std::size_t mainSize;
+
+			/** @brief Tie-break key length */
+			std::size_t tieSize;
+
+			/** @brief The string being sorted */
+			std::string_view value;
+		};
+
+		/** @brief Byte-wise three-way comparison of two key segments */
+		inline int compareNaturalBytes( const char* lhs, std::size_t lhsSize, const char* rhs, std::size_t rhsSize ) noexcept
+		{
+			const std::size_t common = std::min( lhsSize, rhsSize );
+			const int result = common == 0 ? 0 : std::memcmp( lhs, rhs, common );
+			if ( result != 0 )
+			{
+				return result;
+			}
+			return lhsSize < rhsSize ? -1 : ( lhsSize > rhsSize ? 1 : 0 );
+		}
+	} // namespace detail
+
+	//=====================================================================
+	// Natural order
+	//=====================================================================
+
+	inline constexpr int naturalCompare( std::string_view lhs, std::string_view rhs ) noexcept
+	{
+		int tieBreak = 0;
+		std::size_t i = 0;
+		std::size_t j = 0;
+		while ( i < lhs.size() && j < rhs.size() )
+		{
+			if ( isDigit( lhs[i] ) && isDigit( rhs[j] ) )
+			{
+				std::size_t lhsStart = i;
+				std::size_t rhsStart = j;
+				while ( lhsStart < lhs.size() && lhs[lhsStart] == '0' )
+				{
+					++lhsStart;
+				}
+				while ( rhsStart < rhs.size() && rhs[rhsStart] == '0' )
+				{
+					++rhsStart;
+				}
+
+				std::size_t lhsEnd = lhsStart;
+				std::size_t rhsEnd = rhsStart;
+				while ( lhsEnd < lhs.size() && isDigit( lhs[lhsEnd] ) )
+				{
+					++lhsEnd;
+				}
+				while ( rhsEnd < rhs.size() && isDigit( rhs[rhsEnd] ) )
+				{
+					++rhsEnd;
+				}
+
+				// More significant digits means a larger number
+				if ( lhsEnd - lhsStart != rhsEnd - rhsStart )
+				{
+					return lhsEnd - lhsStart < rhsEnd - rhsStart ? -1 : 1;
+				}
+				for ( std::size_t k = 0; k < lhsEnd - lhsStart; ++k )
+				{
+					if ( lhs[lhsStart + k] != rhs[rhsStart + k] )
+					{
+						return lhs[lhsStart + k] < rhs[rhsStart + k] ? -1 : 1;
+					}
+				}
+
+				const std::size_t lhsZeros = lhsStart - i;
+				const std::size_t rhsZeros = rhsStart - j;
+				if ( tieBreak == 0 && lhsZeros != rhsZeros )
+				{
+					tieBreak = lhsZeros < rhsZeros ? -1 : 1;
+				}
+
+				i = lhsEnd;
+				j = rhsEnd;
+				continue;
+			}
+
+			if ( lhs[i] != rhs[j] )
+			{
+				return static_cast<unsigned char>( lhs[i] ) < static_cast<unsigned char>( rhs[j] ) ? -1 : 1;
+			}
+			++i;
+			++j;
+		}
+
+		if ( i < lhs.size() )
+		{
+			return 1;
+		}
+		if ( j < rhs.size() )
+		{
+			return -1;
+		}
+		return tieBreak;
+	}
+
+	inline constexpr bool naturalLess( std::string_view lhs, std::string_view rhs ) noexcept
+	{
+		return naturalCompare( lhs, rhs ) < 0;
+	}
+
+	inline void naturalSort( std::span<std::string_view> strings )
+	{
+		std::size_t totalSize = 0;
+		for ( std::string_view str : strings )
+		{
+			totalSize += str.size();
+		}
+
+		std::string buffer;
+		buffer.reserve( totalSize + totalSize / 2 + strings.size() );
+		std::vector<detail::NaturalKey> keys;
+		keys.reserve( strings.size() );
+
+		std::string tieKey;
+		for ( std::string_view str : strings )
+		{
+			const std::size_t offset = buffer.size();
+			tieKey.clear();
+			for ( std::size_t i = 0; i < str.size(); )
+			{
+				if ( !isDigit( str[i] ) )
+				{
+					const std::size_t textStart = i;
+					while ( i < str.size() && !isDigit( str[i] ) )
+					{
+						++i;
+					}
+					buffer.append( str.data() + textStart, i - textStart );
+					continue;
+				}
+
+				const std::size_t runStart = i;
+				while ( i < str.size() && str[i] == '0' )
+				{
+					++i;
+				}
+				const std::size_t digitsStart = i;
+				while ( i < str.size() && isDigit( str[i] ) )
+				{
+					++i;
+				}
+
+				buffer.push_back( '0' );
+				detail::appendNaturalCount( buffer, i - digitsStart );
+				buffer.append( str.substr( digitsStart, i - digitsStart ) );
+				detail::appendNaturalCount( tieKey, digitsStart - runStart );
+			}
+			const std::size_t mainSize = buffer.size() - offset;
+			buffer.append( tieKey );
+			keys.push_back( detail::NaturalKey{ offset, mainSize, tieKey.size(), str } );
+		}
+
+		// The main keys are ordered by the radix sort, the tie-break keys only among equal ones
+		std::vector<detail::RadixRecord> records;
+		records.reserve( keys.size() );
+		for ( std::size_t i = 0; i < keys.size(); ++i )
+		{
+			records.push_back( detail::RadixRecord{ 0, std::string_view{ buffer.data() + keys[i].offset, keys[i].mainSize }, i } );
+		}
+
+		const char* base = buffer.data();
+		detail::radixSortRecords<false>( records, [base, &keys]( const detail::RadixRecord& lhs, const detail::RadixRecord& rhs ) noexcept {
+			const detail::NaturalKey& left = keys[lhs.item];
+			const detail::NaturalKey& right = keys[rhs.item];
+			return detail::compareNaturalBytes( base + left.offset + left.mainSize, left.tieSize,
+												base + right.offset + right.mainSize, right.tieSize ) < 0;
+		} );
+
+		for ( std::size_t i = 0; i < records.size(); ++i )
+		{
+			strings[i] = keys[records[i].item].value;
+		}
+	}
+} // namespace nfx::string
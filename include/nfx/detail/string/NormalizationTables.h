@@ -0,0 +1,3301 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file NormalizationTables.h
+ * @brief Unicode normalization tables
+ * @details Generated by scripts/generate_unicode_tables.pl from Unicode 14.0.0 - do not edit.
+ *          Canonical combining classes, NFC/NFD/NFKC/NFKD quick-check values, fully expanded
+ *          canonical and compatibility decompositions, and primary composites (canonical pairs
+ *          minus Full_Composition_Exclusion). Hangul syllables are handled algorithmically.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace nfx::string::detail
+{
+	/** @brief Codepoints at or above this limit are starters that never change under normalization */
+	inline constexpr char32_t kNormalizationLimit{ 0x2FB00 };
+
+	/** @brief Quick-check flags of NormalizationRecord::quickCheck */
+	inline constexpr std::uint8_t kNfdNo{ 1 };
+	inline constexpr std::uint8_t kNfkdNo{ 2 };
+	inline constexpr std::uint8_t kNfcNo{ 4 };
+	inline constexpr std::uint8_t kNfcMaybe{ 8 };
+	inline constexpr std::uint8_t kNfkcNo{ 16 };
+	inline constexpr std::uint8_t kNfkcMaybe{ 32 };
+
+	/** @brief Canonical combining class and quick-check answers of a codepoint */
+	struct NormalizationRecord
+	{
+		std::uint8_t ccc;
+		std::uint8_t quickCheck;
+	};
+
+	/** @brief Distinct property records; record 0 is a starter that is always normalized */
+	inline constexpr NormalizationRecord kNormalizationRecords[]{
+		{ 0, 0 }, { 0, 18 }, { 0, 3 }, { 230, 40 }, { 230, 0 }, { 232, 0 }, { 220, 0 }, { 216, 40 },
+		{ 202, 0 }, { 220, 40 }, { 202, 40 }, { 1, 0 }, { 1, 40 }, { 230, 23 }, { 240, 40 }, { 233, 0 },
+		{ 234, 0 }, { 0, 23 }, { 0, 19 }, { 222, 0 }, { 228, 0 }, { 10, 0 }, { 11, 0 }, { 12, 0 },
+		{ 13, 0 }, { 14, 0 }, { 15, 0 }, { 16, 0 }, { 17, 0 }, { 18, 0 }, { 19, 0 }, { 20, 0 },
+		{ 21, 0 }, { 22, 0 }, { 23, 0 }, { 24, 0 }, { 25, 0 }, { 30, 0 }, { 31, 0 }, { 32, 0 },
+		{ 27, 0 }, { 28, 0 }, { 29, 0 }, { 33, 0 }, { 34, 0 }, { 35, 0 }, { 36, 0 }, { 7, 40 },
+		{ 9, 0 }, { 7, 0 }, { 0, 40 }, { 84, 0 }, { 91, 40 }, { 9, 40 }, { 103, 0 }, { 107, 0 },
+		{ 118, 0 }, { 122, 0 }, { 216, 0 }, { 129, 0 }, { 130, 0 }, { 132, 0 }, { 214, 0 }, { 218, 0 },
+		{ 224, 0 }, { 8, 40 }, { 26, 0 }, { 6, 0 }, { 226, 0 },
+	};
+
+	/** @brief log2 of the number of codepoints per property block */
+	inline constexpr unsigned kNormalizationShift{ 6 };
+
+	/** @brief Block number for each run of 2^kNormalizationShift codepoints */
+	inline constexpr std::uint8_t kNormalizationIndex[]{
+		0, 0, 1, 2, 3, 4, 5, 6, 7, 0, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 0, 0, 18, 19,
+		20, 21, 0, 22, 23, 24, 0, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 32, 38, 39, 40,
+		36, 41, 36, 42, 43, 40, 0, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 0, 54, 55, 0, 56, 57, 58,
+		0, 0, 0, 0, 0, 59, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 60, 0, 0, 61,
+		0, 0, 62, 0, 63, 0, 0, 0, 64, 65, 66, 67, 68, 69, 70, 71, 72, 0, 0, 73, 74, 75, 76, 77,
+		78, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 0, 0, 0,
+		0, 98, 99, 100, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		101, 102, 0, 103, 0, 0, 0, 0, 0, 104, 0, 105, 0, 106, 0, 107, 0, 0, 108, 109, 99, 99, 99, 110,
+		111, 112, 113, 114, 115, 99, 116, 0, 117, 118, 99, 99, 99, 99, 99, 99, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 119, 120, 121, 0, 122, 0, 123,
+		124, 0, 0, 125, 126, 127, 128, 129, 0, 0, 130, 131, 0, 132, 0, 133, 78, 78, 78, 78, 78, 78, 78, 78,
+		78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+		78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+		78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+		78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+		78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+		78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+		78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 134, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 135, 135, 135, 135, 136, 137, 135, 138, 139, 140, 141, 142,
+		99, 99, 99, 99, 143, 144, 145, 146, 147, 148, 99, 149, 150, 99, 151, 152, 0, 0, 0, 0, 0, 0, 0, 153,
+		0, 0, 0, 154, 0, 155, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 156, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 157, 0, 0, 158, 0, 0, 0, 0, 0, 0, 0, 0, 159, 0, 0, 0,
+		0, 0, 160, 0, 0, 161, 162, 0, 0, 163, 164, 0, 165, 128, 0, 166, 167, 0, 0, 168, 169, 170, 0, 0,
+		0, 171, 172, 173, 0, 0, 174, 175, 176, 0, 177, 0, 178, 0, 0, 0, 179, 0, 0, 0, 180, 181, 0, 182,
+		183, 184, 185, 0, 0, 0, 0, 0, 176, 0, 0, 0, 0, 186, 187, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 188, 189, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 190, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 191, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 192, 193, 194, 0, 195, 0, 0, 0, 0, 0, 0,
+		99, 196, 197, 198, 199, 200, 99, 99, 99, 99, 201, 99, 99, 99, 99, 202, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		203, 0, 0, 0, 189, 0, 0, 0, 0, 0, 204, 205, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 206, 0, 207, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 208, 209, 210, 0, 0, 0, 0, 0, 0, 0, 0, 0, 211, 212, 213, 0,
+		214, 215, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 216, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 135, 135, 135, 135, 135, 135, 135, 135,
+		217, 0, 0, 0,
+	};
+
+	/** @brief Record number for each codepoint of every distinct block */
+	inline constexpr std::uint8_t kNormalizationBlocks[]{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 1, 0, 0, 1, 1, 1, 1, 0, 0,
+		1, 1, 1, 0, 1, 1, 1, 0, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		0, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 0, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 0, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 0, 1, 1, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 1, 1, 0, 0, 2, 2, 2, 2, 2,
+		2, 1, 0, 0, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 1, 1, 1, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2,
+		0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 4, 3, 3,
+		3, 3, 3, 3, 3, 4, 4, 3, 4, 3, 4, 3, 3, 5, 6, 6, 6, 6, 5, 7, 6, 6, 6, 6,
+		6, 8, 8, 9, 9, 9, 9, 10, 10, 6, 6, 6, 6, 9, 9, 6, 9, 9, 6, 6, 11, 11, 11, 11,
+		12, 6, 6, 6, 6, 4, 4, 4, 13, 13, 3, 13, 13, 14, 4, 6, 6, 6, 4, 4, 4, 6, 6, 0,
+		4, 4, 4, 6, 6, 6, 6, 4, 5, 6, 6, 4, 15, 16, 16, 15, 16, 16, 15, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 17, 0, 0, 0, 0, 0, 1, 0, 0, 0, 17, 0,
+		0, 0, 0, 0, 1, 18, 2, 17, 2, 2, 2, 0, 2, 0, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2,
+		2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 2, 2, 2, 2, 2, 0, 1, 1, 1, 18, 18, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 1, 1, 0, 0,
+		0, 1, 0, 0, 0, 0, 0, 0, 2, 2, 0, 2, 0, 0, 0, 2, 0, 0, 0, 0, 2, 2, 2, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 2, 0, 0, 0, 2,
+		0, 0, 0, 0, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		2, 2, 2, 2, 0, 0, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2,
+		0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 4, 4, 4, 4, 6, 4,
+		4, 4, 19, 6, 4, 4, 4, 4, 4, 4, 6, 6, 6, 6, 6, 6, 4, 4, 6, 4, 4, 19, 20, 4,
+		21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 30, 31, 32, 33, 0, 34, 0, 35, 36, 0, 4, 6, 0, 29,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 4, 4, 4, 4, 4, 4, 4, 37, 38, 39, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 41, 42, 37, 38, 39, 43, 44, 3, 3, 9, 6, 4,
+		4, 4, 4, 4, 6, 4, 4, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		45, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 4, 4, 4, 4, 4, 4, 4, 0, 0, 4,
+		4, 4, 4, 6, 4, 0, 0, 4, 4, 0, 6, 4, 4, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 4, 6, 4, 4, 6, 4, 4, 6, 6, 6, 4, 6, 6, 4, 6, 4,
+		4, 4, 6, 4, 6, 4, 6, 4, 6, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 6, 4, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 4, 4, 4,
+		0, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 6, 6, 6, 4, 4, 4, 4,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 6,
+		6, 6, 6, 6, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 6, 4, 4, 6, 4,
+		4, 6, 4, 4, 4, 6, 6, 6, 40, 41, 42, 4, 4, 4, 6, 4, 4, 6, 6, 4, 4, 4, 4, 4,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0,
+		0, 2, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 48, 0, 0, 0, 4, 6, 4, 4, 0, 0, 0, 17, 17, 17, 17, 17, 17, 17, 17,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 50, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50,
+		0, 0, 0, 0, 17, 17, 0, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 17, 0,
+		0, 0, 0, 0, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 17, 17, 0, 0, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 2, 2, 48, 0, 0,
+		0, 0, 0, 0, 0, 0, 50, 50, 0, 0, 0, 0, 17, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 2, 2, 2, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 48, 0, 0,
+		0, 0, 0, 0, 0, 51, 52, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		2, 0, 50, 0, 0, 0, 0, 2, 2, 0, 2, 2, 0, 48, 0, 0, 0, 0, 0, 0, 0, 50, 50, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 48, 48, 0, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0, 0, 0, 0, 50,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 2, 2, 50, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 1, 0, 0, 0, 0, 54, 54, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		55, 55, 55, 55, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 56, 56, 48, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 57, 57, 57, 57, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 6,
+		0, 58, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0,
+		0, 0, 17, 0, 0, 0, 0, 17, 0, 0, 0, 0, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 17, 0, 0, 0, 0, 0, 0, 0, 59, 60, 17, 61, 17, 17, 1, 17, 1, 60, 60, 60, 60, 0, 0,
+		60, 17, 4, 4, 48, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 17, 0, 0, 0, 0, 17, 0, 0, 0, 0, 17, 0, 0, 0, 0, 17, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0,
+		0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 48, 48, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50,
+		50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50,
+		50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 48, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 4, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 6,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 4, 4, 4, 4, 6, 6, 6, 6, 6, 6, 4, 4, 6, 0, 6, 6, 4, 4, 6, 6, 4, 4, 4,
+		4, 4, 6, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0,
+		0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 50, 0, 0, 0, 0, 0, 2, 0, 2, 0, 0,
+		2, 2, 0, 2, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 6, 4, 4, 4,
+		4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 0, 11, 6, 6, 6, 6, 6, 4, 4, 6, 6, 6, 6,
+		4, 0, 11, 11, 11, 11, 11, 11, 11, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0,
+		4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 4, 4, 6, 4, 4, 4, 4, 4, 4, 4, 6, 4, 4, 16, 62, 6,
+		8, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 20, 20, 6, 63, 4, 15, 6, 4, 6,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 18, 0, 0, 0, 0,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0,
+		2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0,
+		2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 0, 2, 0, 2, 0, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 17, 2, 17, 2, 17, 2, 17,
+		2, 17, 2, 17, 2, 17, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 17, 2, 1, 17, 1,
+		1, 18, 2, 2, 2, 0, 2, 2, 2, 17, 2, 17, 2, 18, 18, 18, 2, 2, 2, 17, 0, 0, 2, 2,
+		2, 2, 2, 17, 0, 18, 18, 18, 2, 2, 2, 17, 2, 2, 2, 2, 2, 2, 2, 17, 2, 18, 17, 17,
+		0, 0, 2, 2, 2, 0, 2, 2, 2, 17, 2, 17, 2, 17, 1, 0, 17, 17, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 1,
+		0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 11, 11, 4, 4, 4, 4, 11, 11, 11, 4, 4, 0, 0, 0,
+		0, 4, 0, 0, 0, 11, 11, 4, 6, 4, 11, 11, 6, 6, 6, 6, 4, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 0, 1, 1, 0, 0, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 0, 1, 0, 17, 0,
+		1, 0, 17, 17, 1, 1, 0, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1,
+		1, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 0, 0, 0, 0, 0, 1, 1, 0, 1,
+		1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 2, 0, 0, 2,
+		0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		2, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 0, 0, 2, 2, 0, 0,
+		2, 2, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 2, 2, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+		4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 63, 20, 5, 19, 64, 64,
+		0, 0, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0,
+		2, 0, 2, 0, 0, 2, 0, 2, 0, 2, 0, 0, 0, 0, 0, 0, 2, 2, 0, 2, 2, 0, 2, 2,
+		0, 2, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 2, 0, 0, 0, 0, 65, 65, 1, 1, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0,
+		2, 0, 2, 0, 0, 2, 0, 2, 0, 2, 0, 0, 0, 0, 0, 0, 2, 2, 0, 2, 2, 0, 2, 2,
+		0, 2, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 2, 0, 0, 2, 2, 2, 2, 0, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+		0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 1, 1, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 4, 4, 6, 0, 0, 4,
+		4, 0, 0, 0, 0, 0, 4, 4, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+		17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+		17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+		17, 17, 17, 17, 17, 17, 0, 0, 17, 0, 17, 0, 0, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 0,
+		17, 0, 17, 0, 0, 17, 17, 0, 0, 0, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+		17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+		17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+		17, 17, 17, 17, 17, 17, 0, 0, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+		17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+		17, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 17, 66, 17,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 0,
+		17, 17, 17, 17, 17, 0, 17, 0, 17, 17, 0, 17, 17, 0, 17, 17, 17, 17, 17, 17, 17, 17, 17, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 6, 6, 6, 6, 6, 6, 6, 4, 4,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 0, 1, 0, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+		0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1,
+		0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0,
+		1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0,
+		0, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 6, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 11, 6, 0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 6, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 4, 4, 4, 6, 4, 6, 6, 6,
+		6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 4, 6, 4, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 47, 0, 0, 0, 0, 0,
+		4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 0, 0, 0, 2, 2,
+		0, 0, 0, 48, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 48, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 49, 49, 0, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 48, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4,
+		4, 4, 4, 4, 4, 0, 0, 0, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 48, 0, 0, 0, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 50, 2, 2, 50, 2, 0, 0, 0, 48, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 48, 49, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 48, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 49, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		50, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 48, 48, 0, 0, 0, 0, 49, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 49, 0, 48, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 11, 11, 11, 11, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 67, 67, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 17, 17, 17, 17, 17, 17, 17, 58, 58, 11, 11, 11, 0, 0, 0, 68, 58, 58,
+		58, 58, 58, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 4, 4, 4,
+		4, 4, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 17, 17, 17, 17, 17, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 0, 0, 1, 0, 0, 1, 1, 0,
+		0, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 0, 1, 1, 1,
+		1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1,
+		1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 0, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 0, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+		1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 4, 4, 4, 4, 4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 4, 4, 4, 4, 4, 4, 4, 0, 4, 4, 0, 4, 4,
+		4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		0, 1, 1, 0, 1, 0, 0, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1,
+		0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 1, 1, 1,
+		0, 1, 1, 0, 1, 0, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 1, 0, 1, 0, 0, 1,
+		1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0, 1, 0,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 0, 0, 0, 0, 0, 1, 1, 1, 0, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+		1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 17, 17, 17, 17, 17, 17, 17, 17,
+		17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+	};
+
+	/** @brief log2 of the number of codepoints per decomposition block */
+	inline constexpr unsigned kDecompositionShift{ 6 };
+
+	/** @brief Block number for each run of 2^kDecompositionShift codepoints */
+	inline constexpr std::uint8_t kDecompositionIndex[]{
+		0, 0, 1, 2, 3, 4, 5, 6, 7, 0, 8, 9, 0, 10, 11, 12, 13, 14, 0, 15, 0, 0, 16, 0,
+		17, 18, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 20, 21, 0, 22, 23, 24, 0, 0, 0, 25, 26, 27,
+		0, 28, 0, 29, 0, 30, 0, 31, 32, 0, 33, 34, 35, 36, 37, 0, 38, 0, 0, 39, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 41, 0, 0, 0, 0, 0, 0, 42, 43, 44, 0,
+		45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 0, 56, 57, 58, 59, 60, 61, 62, 63, 64, 0, 0, 0,
+		0, 65, 66, 67, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		68, 69, 0, 70, 0, 0, 0, 0, 0, 71, 0, 0, 0, 72, 0, 0, 0, 0, 73, 74, 75, 76, 77, 78,
+		79, 80, 81, 82, 83, 84, 85, 0, 86, 87, 88, 89, 90, 91, 92, 93, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 94, 0, 0, 95, 0, 96,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 97, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109,
+		110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 126, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 127, 0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0,
+		0, 0, 130, 0, 0, 0, 131, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 132, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 133, 134, 135, 0, 0, 0, 0, 0, 0, 0, 0,
+		136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 152, 153, 154, 0, 0, 0, 0, 0, 0, 0, 0, 0, 155, 156, 157, 0,
+		158, 159, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 160, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 161, 162, 163, 164, 165, 166, 167, 168,
+		169, 0, 0, 0,
+	};
+
+	/** @brief Offset into kDecompositionData for each codepoint, 0 if it does not decompose */
+	inline constexpr std::uint16_t kDecompositionBlocks[]{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 0, 0, 0, 0, 0, 0, 0, 3, 0, 6, 0, 0, 0, 0, 8,
+		0, 0, 11, 13, 15, 18, 0, 0, 20, 23, 25, 0, 27, 31, 35, 0,
+		39, 42, 45, 48, 51, 54, 0, 57, 60, 63, 66, 69, 72, 75, 78, 81,
+		0, 84, 87, 90, 93, 96, 99, 0, 0, 102, 105, 108, 111, 114, 0, 0,
+		117, 120, 123, 126, 129, 132, 0, 135, 138, 141, 144, 147, 150, 153, 156, 159,
+		0, 162, 165, 168, 171, 174, 177, 0, 0, 180, 183, 186, 189, 192, 0, 195,
+		198, 201, 204, 207, 210, 213, 216, 219, 222, 225, 228, 231, 234, 237, 240, 243,
+		0, 0, 246, 249, 252, 255, 258, 261, 264, 267, 270, 273, 276, 279, 282, 285,
+		288, 291, 294, 297, 300, 303, 0, 0, 306, 309, 312, 315, 318, 321, 324, 327,
+		330, 0, 333, 336, 339, 342, 345, 348, 0, 351, 354, 357, 360, 363, 366, 369,
+		372, 0, 0, 375, 378, 381, 384, 387, 390, 393, 0, 0, 396, 399, 402, 405,
+		408, 411, 0, 0, 414, 417, 420, 423, 426, 429, 432, 435, 438, 441, 444, 447,
+		450, 453, 456, 459, 462, 465, 0, 0, 468, 471, 474, 477, 480, 483, 486, 489,
+		492, 495, 498, 501, 504, 507, 510, 513, 516, 519, 522, 525, 528, 531, 534, 537,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		539, 542, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 545,
+		548, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 551, 555, 559, 563, 566, 569, 572, 575, 578, 581, 584, 587,
+		590, 593, 596, 599, 602, 605, 609, 613, 617, 621, 625, 629, 633, 0, 637, 641,
+		645, 649, 653, 656, 0, 0, 659, 662, 665, 668, 671, 674, 677, 681, 685, 688,
+		691, 694, 697, 700, 703, 706, 0, 0, 709, 712, 715, 719, 723, 726, 729, 732,
+		735, 738, 741, 744, 747, 750, 753, 756, 759, 762, 765, 768, 771, 774, 777, 780,
+		783, 786, 789, 792, 795, 798, 801, 804, 807, 810, 813, 816, 0, 0, 819, 822,
+		0, 0, 0, 0, 0, 0, 825, 828, 831, 834, 837, 841, 845, 849, 853, 856,
+		859, 863, 867, 870, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		873, 875, 877, 879, 881, 883, 885, 887, 889, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 891, 894, 897, 900, 903, 906, 0, 0,
+		909, 911, 913, 915, 917, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		919, 921, 0, 923, 925, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 928, 0, 0, 0, 0, 0, 930, 0, 0, 0, 933, 0,
+		0, 0, 0, 0, 935, 938, 944, 947, 949, 952, 955, 0, 958, 0, 961, 964,
+		967, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 971, 974, 977, 980, 983, 986,
+		989, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 993, 996, 999, 1002, 1005, 0,
+		1008, 1010, 1012, 1014, 1019, 1024, 1026, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1028, 1030, 1032, 0, 1034, 1036, 0, 0, 0, 1038, 0, 0, 0, 0, 0, 0,
+		1040, 1043, 0, 1046, 0, 0, 0, 1049, 0, 0, 0, 0, 1052, 1055, 1058, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 1061, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 1064, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1067, 1070, 0, 1073, 0, 0, 0, 1076, 0, 0, 0, 0, 1079, 1082, 1085, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 1088, 1091, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 1094, 1097, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1100, 1103, 1106, 1109, 0, 0, 1112, 1115, 0, 0, 1118, 1121, 1124, 1127, 1130, 1133,
+		0, 0, 1136, 1139, 1142, 1145, 1148, 1151, 0, 0, 1154, 1157, 1160, 1163, 1166, 1169,
+		1172, 1175, 1178, 1181, 1184, 1187, 0, 0, 1190, 1193, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 1196, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 1199, 1202, 1205, 1208, 1211, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 1214, 1217, 1220, 1223, 0, 0, 0, 0, 0, 0, 0,
+		1226, 0, 1229, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 1232, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 1235, 0, 0, 0, 0, 0, 0,
+		0, 1238, 0, 0, 1241, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 1244, 1247, 1250, 1253, 1256, 1259, 1262, 1265,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1268, 1271, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1274, 1277, 0, 1280,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 1283, 0, 0, 1286, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 1289, 1292, 1295, 0, 0, 1298, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 1301, 0, 0, 1304, 1307, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1310, 1313, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 1316, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1319, 1322, 1325, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 1328, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1331, 0, 0, 0, 0, 0, 0, 1334, 1337, 0, 1340, 1343, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1347, 1350, 1353, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1356, 0, 1359, 1362, 1366, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 1369, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 1372, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1375, 1378, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1381, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 1383, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1386, 0, 0,
+		0, 0, 1389, 0, 0, 0, 0, 1392, 0, 0, 0, 0, 1395, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 1398, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 1401, 0, 1404, 1407, 1410, 1414, 1417, 0, 0, 0, 0, 0, 0,
+		0, 1421, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 1424, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1427, 0, 0,
+		0, 0, 1430, 0, 0, 0, 0, 1433, 0, 0, 0, 0, 1436, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 1439, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 1442, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1445, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 1447, 0, 1450, 0, 1453, 0, 1456, 0, 1459, 0,
+		0, 0, 1462, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1465, 0, 1468, 0, 0,
+		1471, 1474, 0, 1477, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1480, 1482, 1484, 0,
+		1486, 1488, 1490, 1492, 1494, 1496, 1498, 1500, 1502, 1504, 1506, 0, 1508, 1510, 1512, 1514,
+		1516, 1518, 1520, 1522, 1524, 1526, 1528, 1530, 1532, 1534, 1536, 1538, 1540, 1542, 0, 1544,
+		1546, 1548, 1550, 1552, 1554, 1556, 1558, 1560, 1562, 1564, 1566, 1568, 1570, 1572, 1574, 1576,
+		1578, 1580, 1582, 1584, 1586, 1588, 1590, 1592, 1594, 1596, 1598, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 1600, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1602, 1604, 1606, 1608, 1610,
+		1612, 1614, 1616, 1618, 1620, 1622, 1624, 1626, 1628, 1630, 1632, 1634, 1636, 1638, 1640, 1642,
+		1644, 1646, 1648, 1650, 1652, 1654, 1656, 1658, 1660, 1662, 1664, 1666, 1668, 1670, 1672, 1674,
+		1676, 1679, 1682, 1685, 1688, 1691, 1694, 1697, 1700, 1704, 1708, 1711, 1714, 1717, 1720, 1723,
+		1726, 1729, 1732, 1735, 1738, 1742, 1746, 1750, 1754, 1757, 1760, 1763, 1766, 1770, 1774, 1777,
+		1780, 1783, 1786, 1789, 1792, 1795, 1798, 1801, 1804, 1807, 1810, 1813, 1816, 1819, 1822, 1826,
+		1830, 1833, 1836, 1839, 1842, 1845, 1848, 1851, 1854, 1858, 1862, 1865, 1868, 1871, 1874, 1877,
+		1880, 1883, 1886, 1889, 1892, 1895, 1898, 1901, 1904, 1907, 1910, 1913, 1916, 1920, 1924, 1928,
+		1932, 1936, 1940, 1944, 1948, 1951, 1954, 1957, 1960, 1963, 1966, 1969, 1972, 1976, 1980, 1983,
+		1986, 1989, 1992, 1995, 1998, 2002, 2006, 2010, 2014, 2018, 2022, 2025, 2028, 2031, 2034, 2037,
+		2040, 2043, 2046, 2049, 2052, 2055, 2058, 2061, 2064, 2068, 2072, 2076, 2080, 2083, 2086, 2089,
+		2092, 2095, 2098, 2101, 2104, 2107, 2110, 2113, 2116, 2119, 2122, 2125, 2128, 2131, 2134, 2137,
+		2140, 2143, 2146, 2149, 2152, 2155, 2158, 2161, 2164, 2167, 2170, 2173, 0, 0, 0, 0,
+		2178, 2181, 2184, 2187, 2190, 2194, 2198, 2202, 2206, 2210, 2214, 2218, 2222, 2226, 2230, 2234,
+		2238, 2242, 2246, 2250, 2254, 2258, 2262, 2266, 2270, 2273, 2276, 2279, 2282, 2285, 2288, 2292,
+		2296, 2300, 2304, 2308, 2312, 2316, 2320, 2324, 2328, 2331, 2334, 2337, 2340, 2343, 2346, 2349,
+		2352, 2356, 2360, 2364, 2368, 2372, 2376, 2380, 2384, 2388, 2392, 2396, 2400, 2404, 2408, 2412,
+		2416, 2420, 2424, 2428, 2432, 2435, 2438, 2441, 2444, 2448, 2452, 2456, 2460, 2464, 2468, 2472,
+		2476, 2480, 2484, 2487, 2490, 2493, 2496, 2499, 2502, 2505, 0, 0, 0, 0, 0, 0,
+		2508, 2511, 2514, 2518, 2522, 2526, 2530, 2534, 2538, 2541, 2544, 2548, 2552, 2556, 2560, 2564,
+		2568, 2571, 2574, 2578, 2582, 2586, 0, 0, 2590, 2593, 2596, 2600, 2604, 2608, 0, 0,
+		2612, 2615, 2618, 2622, 2626, 2630, 2634, 2638, 2642, 2645, 2648, 2652, 2656, 2660, 2664, 2668,
+		2672, 2675, 2678, 2682, 2686, 2690, 2694, 2698, 2702, 2705, 2708, 2712, 2716, 2720, 2724, 2728,
+		2732, 2735, 2738, 2742, 2746, 2750, 0, 0, 2754, 2757, 2760, 2764, 2768, 2772, 0, 0,
+		2776, 2779, 2782, 2786, 2790, 2794, 2798, 2802, 0, 2806, 0, 2809, 0, 2813, 0, 2817,
+		2821, 2824, 2827, 2831, 2835, 2839, 2843, 2847, 2851, 2854, 2857, 2861, 2865, 2869, 2873, 2877,
+		2881, 2884, 2887, 2890, 2893, 2896, 2899, 2902, 2905, 2908, 2911, 2914, 2917, 2920, 0, 0,
+		2923, 2927, 2931, 2936, 2941, 2946, 2951, 2956, 2961, 2965, 2969, 2974, 2979, 2984, 2989, 2994,
+		2999, 3003, 3007, 3012, 3017, 3022, 3027, 3032, 3037, 3041, 3045, 3050, 3055, 3060, 3065, 3070,
+		3075, 3079, 3083, 3088, 3093, 3098, 3103, 3108, 3113, 3117, 3121, 3126, 3131, 3136, 3141, 3146,
+		3151, 3154, 3157, 3161, 3164, 0, 3168, 3171, 3175, 3178, 3181, 3184, 3187, 3190, 3193, 3195,
+		3198, 3201, 3207, 3211, 3214, 0, 3218, 3221, 3225, 3228, 3231, 3234, 3237, 3240, 3246, 3252,
+		3258, 3261, 3264, 3268, 0, 0, 3272, 3275, 3279, 3282, 3285, 3288, 0, 3291, 3297, 3303,
+		3309, 3312, 3315, 3319, 3323, 3326, 3329, 3332, 3336, 3339, 3342, 3345, 3348, 3351, 3357, 3363,
+		0, 0, 3365, 3369, 3372, 0, 3376, 3379, 3383, 3386, 3389, 3392, 3395, 3398, 3402, 0,
+		3405, 3408, 3411, 3413, 3415, 3417, 3419, 3421, 3423, 3425, 3427, 0, 0, 0, 0, 0,
+		0, 3429, 0, 0, 0, 0, 0, 3431, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 3434, 3436, 3439, 0, 0, 0, 0, 0, 0, 0, 0, 3443,
+		0, 0, 0, 3445, 3448, 0, 3452, 3455, 0, 0, 0, 0, 3459, 0, 3462, 0,
+		0, 0, 0, 0, 0, 0, 0, 3465, 3468, 3471, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 3474, 0, 0, 0, 0, 0, 0, 0, 3479,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		3481, 3483, 0, 0, 3485, 3487, 3489, 3491, 3493, 3495, 3497, 3499, 3501, 3503, 3505, 3507,
+		3509, 3511, 3513, 3515, 3517, 3519, 3521, 3523, 3525, 3527, 3529, 3531, 3533, 3535, 3537, 0,
+		3539, 3541, 3543, 3545, 3547, 3549, 3551, 3553, 3555, 3557, 3559, 3561, 3563, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 3565, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		3568, 3572, 3576, 3578, 0, 3581, 3585, 3589, 0, 3591, 3594, 3596, 3598, 3600, 3602, 3604,
+		3606, 3608, 3610, 3612, 0, 3614, 3616, 0, 0, 3619, 3621, 3623, 3625, 3627, 0, 0,
+		3629, 3632, 3636, 0, 3639, 0, 3641, 0, 3643, 0, 3645, 3647, 3650, 3652, 0, 3654,
+		3656, 3658, 0, 3660, 3662, 3664, 3666, 3668, 3670, 3672, 0, 3674, 3678, 3680, 3682, 3684,
+		3686, 0, 0, 0, 0, 3688, 3690, 3692, 3694, 3696, 0, 0, 0, 0, 0, 0,
+		3698, 3702, 3706, 3711, 3715, 3719, 3723, 3727, 3731, 3735, 3739, 3743, 3747, 3751, 3755, 3759,
+		3762, 3764, 3767, 3771, 3774, 3776, 3779, 3783, 3788, 3791, 3793, 3796, 3800, 3802, 3804, 3806,
+		3808, 3810, 3813, 3817, 3820, 3822, 3825, 3829, 3834, 3837, 3839, 3842, 3846, 3848, 3850, 3852,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 3854, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3858, 3861, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3864, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3867, 3870, 3873,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 3876, 0, 0, 0, 0, 3879, 0, 0, 3882, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 3885, 0, 3888, 0, 0, 0, 0, 0, 3891, 3894, 0, 3898,
+		3901, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 3905, 0, 0, 3908, 0, 0, 3911, 0, 3914, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		3917, 0, 3920, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3923, 3926, 3929,
+		3932, 3935, 0, 0, 3938, 3941, 0, 0, 3944, 3947, 0, 0, 0, 0, 0, 0,
+		3950, 3953, 0, 0, 3956, 3959, 0, 0, 3962, 3965, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3968, 3971, 3974, 3977,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		3980, 3983, 3986, 3989, 0, 0, 0, 0, 0, 0, 3992, 3995, 3998, 4001, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 4004, 4006, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4008, 4010, 4012, 4014, 4016, 4018, 4020, 4022, 4024, 4026, 4029, 4032, 4035, 4038, 4041, 4044,
+		4047, 4050, 4053, 4056, 4059, 4063, 4067, 4071, 4075, 4079, 4083, 4087, 4091, 4095, 4100, 4105,
+		4110, 4115, 4120, 4125, 4130, 4135, 4140, 4145, 4150, 4153, 4156, 4159, 4162, 4165, 4168, 4171,
+		4174, 4177, 4181, 4185, 4189, 4193, 4197, 4201, 4205, 4209, 4213, 4217, 4221, 4225, 4229, 4233,
+		4237, 4241, 4245, 4249, 4253, 4257, 4261, 4265, 4269, 4273, 4277, 4281, 4285, 4289, 4293, 4297,
+		4301, 4305, 4309, 4313, 4317, 4321, 4325, 4327, 4329, 4331, 4333, 4335, 4337, 4339, 4341, 4343,
+		4345, 4347, 4349, 4351, 4353, 4355, 4357, 4359, 4361, 4363, 4365, 4367, 4369, 4371, 4373, 4375,
+		4377, 4379, 4381, 4383, 4385, 4387, 4389, 4391, 4393, 4395, 4397, 4399, 4401, 4403, 4405, 4407,
+		4409, 4411, 4413, 4415, 4417, 4419, 4421, 4423, 4425, 4427, 4429, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4431, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 4436, 4440, 4443, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4447, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4450, 4452, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4454,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4456,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 4458, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4460, 4462, 4464, 4466, 4468, 4470, 4472, 4474, 4476, 4478, 4480, 4482, 4484, 4486, 4488, 4490,
+		4492, 4494, 4496, 4498, 4500, 4502, 4504, 4506, 4508, 4510, 4512, 4514, 4516, 4518, 4520, 4522,
+		4524, 4526, 4528, 4530, 4532, 4534, 4536, 4538, 4540, 4542, 4544, 4546, 4548, 4550, 4552, 4554,
+		4556, 4558, 4560, 4562, 4564, 4566, 4568, 4570, 4572, 4574, 4576, 4578, 4580, 4582, 4584, 4586,
+		4588, 4590, 4592, 4594, 4596, 4598, 4600, 4602, 4604, 4606, 4608, 4610, 4612, 4614, 4616, 4618,
+		4620, 4622, 4624, 4626, 4628, 4630, 4632, 4634, 4636, 4638, 4640, 4642, 4644, 4646, 4648, 4650,
+		4652, 4654, 4656, 4658, 4660, 4662, 4664, 4666, 4668, 4670, 4672, 4674, 4676, 4678, 4680, 4682,
+		4684, 4686, 4688, 4690, 4692, 4694, 4696, 4698, 4700, 4702, 4704, 4706, 4708, 4710, 4712, 4714,
+		4716, 4718, 4720, 4722, 4724, 4726, 4728, 4730, 4732, 4734, 4736, 4738, 4740, 4742, 4744, 4746,
+		4748, 4750, 4752, 4754, 4756, 4758, 4760, 4762, 4764, 4766, 4768, 4770, 4772, 4774, 4776, 4778,
+		4780, 4782, 4784, 4786, 4788, 4790, 4792, 4794, 4796, 4798, 4800, 4802, 4804, 4806, 4808, 4810,
+		4812, 4814, 4816, 4818, 4820, 4822, 4824, 4826, 4828, 4830, 4832, 4834, 4836, 4838, 4840, 4842,
+		4844, 4846, 4848, 4850, 4852, 4854, 4856, 4858, 4860, 4862, 4864, 4866, 4868, 4870, 4872, 4874,
+		4876, 4878, 4880, 4882, 4884, 4886, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4888, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 4890, 0, 4892, 4894, 4896, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4898, 0, 4901, 0,
+		4904, 0, 4907, 0, 4910, 0, 4913, 0, 4916, 0, 4919, 0, 4922, 0, 4925, 0,
+		4928, 0, 4931, 0, 0, 4934, 0, 4937, 0, 4940, 0, 0, 0, 0, 0, 0,
+		4943, 4946, 0, 4949, 4952, 0, 4955, 4958, 0, 4961, 4964, 0, 4967, 4970, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 4973, 0, 0, 0, 0, 0, 0, 4976, 4979, 0, 4982, 4985,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4988, 0, 4991, 0,
+		4994, 0, 4997, 0, 5000, 0, 5003, 0, 5006, 0, 5009, 0, 5012, 0, 5015, 0,
+		5018, 0, 5021, 0, 0, 5024, 0, 5027, 0, 5030, 0, 0, 0, 0, 0, 0,
+		5033, 5036, 0, 5039, 5042, 0, 5045, 5048, 0, 5051, 5054, 0, 5057, 5060, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 5063, 0, 0, 5066, 5069, 5072, 5075, 0, 0, 0, 5078, 5081,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 5084, 5086, 5088, 5090, 5092, 5094, 5096, 5098, 5100, 5102, 5104, 5106, 5108, 5110, 5112,
+		5114, 5116, 5118, 5120, 5122, 5124, 5126, 5128, 5130, 5132, 5134, 5136, 5138, 5140, 5142, 5144,
+		5146, 5148, 5150, 5152, 5154, 5156, 5158, 5160, 5162, 5164, 5166, 5168, 5170, 5172, 5174, 5176,
+		5178, 5180, 5182, 5184, 5186, 5188, 5190, 5192, 5194, 5196, 5198, 5200, 5202, 5204, 5206, 5208,
+		5210, 5212, 5214, 5216, 5218, 5220, 5222, 5224, 5226, 5228, 5230, 5232, 5234, 5236, 5238, 5240,
+		5242, 5244, 5246, 5248, 5250, 5252, 5254, 5256, 5258, 5260, 5262, 5264, 5266, 5268, 5270, 0,
+		0, 0, 5272, 5274, 5276, 5278, 5280, 5282, 5284, 5286, 5288, 5290, 5292, 5294, 5296, 5298,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		5300, 5304, 5308, 5312, 5316, 5320, 5324, 5328, 5332, 5336, 5340, 5344, 5348, 5352, 5356, 5361,
+		5366, 5371, 5376, 5381, 5386, 5391, 5396, 5401, 5406, 5411, 5416, 5421, 5426, 5431, 5439, 0,
+		5446, 5450, 5454, 5458, 5462, 5466, 5470, 5474, 5478, 5482, 5486, 5490, 5494, 5498, 5502, 5506,
+		5510, 5514, 5518, 5522, 5526, 5530, 5534, 5538, 5542, 5546, 5550, 5554, 5558, 5562, 5566, 5570,
+		5574, 5578, 5582, 5586, 5590, 5592, 5594, 5596, 0, 0, 0, 0, 0, 0, 0, 0,
+		5598, 5602, 5605, 5608, 5611, 5614, 5617, 5620, 5623, 5626, 5629, 5632, 5635, 5638, 5641, 5644,
+		5647, 5649, 5651, 5653, 5655, 5657, 5659, 5661, 5663, 5665, 5667, 5669, 5671, 5673, 5675, 5678,
+		5681, 5684, 5687, 5690, 5693, 5696, 5699, 5702, 5705, 5708, 5711, 5714, 5717, 5723, 5728, 0,
+		5731, 5733, 5735, 5737, 5739, 5741, 5743, 5745, 5747, 5749, 5751, 5753, 5755, 5757, 5759, 5761,
+		5763, 5765, 5767, 5769, 5771, 5773, 5775, 5777, 5779, 5781, 5783, 5785, 5787, 5789, 5791, 5793,
+		5795, 5797, 5799, 5801, 5803, 5805, 5807, 5809, 5811, 5813, 5815, 5817, 5819, 5821, 5823, 5825,
+		5827, 5829, 5832, 5835, 5838, 5841, 5844, 5847, 5850, 5853, 5856, 5859, 5862, 5865, 5868, 5871,
+		5874, 5877, 5880, 5883, 5886, 5889, 5892, 5895, 5898, 5901, 5905, 5909, 5913, 5916, 5920, 5923,
+		5927, 5929, 5931, 5933, 5935, 5937, 5939, 5941, 5943, 5945, 5947, 5949, 5951, 5953, 5955, 5957,
+		5959, 5961, 5963, 5965, 5967, 5969, 5971, 5973, 5975, 5977, 5979, 5981, 5983, 5985, 5987, 5989,
+		5991, 5993, 5995, 5997, 5999, 6001, 6003, 6005, 6007, 6009, 6011, 6013, 6015, 6017, 6019, 6021,
+		6024, 6030, 6035, 6041, 6045, 6051, 6055, 6059, 6066, 6071, 6075, 6079, 6083, 6088, 6093, 6098,
+		6103, 6108, 6113, 6118, 6125, 6128, 6135, 6142, 6148, 6153, 6160, 6167, 6172, 6176, 6180, 6185,
+		6190, 6196, 6202, 6206, 6210, 6215, 6219, 6223, 6226, 6229, 6233, 6237, 6244, 6249, 6255, 6262,
+		6267, 6271, 6275, 6282, 6287, 6294, 6298, 6304, 6308, 6313, 6317, 6322, 6328, 6333, 6339, 6344,
+		6347, 6353, 6357, 6361, 6366, 6370, 6374, 6378, 6384, 6389, 6392, 6399, 6403, 6409, 6414, 6419,
+		6423, 6427, 6432, 6435, 6440, 6446, 6449, 6456, 6460, 6463, 6466, 6469, 6472, 6475, 6478, 6481,
+		6484, 6487, 6490, 6494, 6498, 6502, 6506, 6510, 6514, 6518, 6522, 6526, 6530, 6534, 6538, 6542,
+		6546, 6550, 6554, 6557, 6560, 6564, 6567, 6570, 6573, 6577, 6581, 6584, 6587, 6590, 6593, 6596,
+		6601, 6604, 6607, 6610, 6613, 6616, 6619, 6622, 6625, 6629, 6634, 6637, 6640, 6643, 6646, 6649,
+		6652, 6655, 6659, 6663, 6667, 6671, 6674, 6677, 6680, 6683, 6686, 6689, 6692, 6695, 6698, 6701,
+		6705, 6709, 6712, 6716, 6720, 6724, 6727, 6731, 6735, 6740, 6743, 6747, 6751, 6755, 6759, 6765,
+		6772, 6775, 6778, 6781, 6784, 6787, 6790, 6793, 6796, 6799, 6802, 6805, 6808, 6811, 6814, 6817,
+		6820, 6823, 6826, 6831, 6834, 6837, 6840, 6845, 6849, 6852, 6855, 6858, 6861, 6864, 6867, 6870,
+		6873, 6876, 6879, 6883, 6886, 6889, 6893, 6897, 6900, 6905, 6909, 6912, 6915, 6918, 6921, 6925,
+		6929, 6932, 6935, 6938, 6941, 6944, 6947, 6950, 6953, 6956, 6960, 6964, 6968, 6972, 6976, 6980,
+		6984, 6988, 6992, 6996, 7000, 7004, 7008, 7012, 7016, 7020, 7024, 7028, 7032, 7036, 7040, 7044,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7048, 7050, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		7052, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 7054, 7056, 7058, 0, 0, 0, 7060, 7062, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7064, 7066, 7068, 7070,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 7072, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		7074, 7076, 7078, 7080, 7082, 7084, 7086, 7088, 7090, 7092, 7094, 7096, 7098, 7100, 7102, 7104,
+		7106, 7108, 7110, 7112, 7114, 7116, 7118, 7120, 7122, 7124, 7126, 7128, 7130, 7132, 7134, 7136,
+		7138, 7140, 7142, 7144, 7146, 7148, 7150, 7152, 7154, 7156, 7158, 7160, 7162, 7164, 7166, 7168,
+		7170, 7172, 7174, 7176, 7178, 7180, 7182, 7184, 7186, 7188, 7190, 7192, 7194, 7196, 7198, 7200,
+		7202, 7204, 7206, 7208, 7210, 7212, 7214, 7216, 7218, 7220, 7222, 7224, 7226, 7228, 7230, 7232,
+		7234, 7236, 7238, 7240, 7242, 7244, 7246, 7248, 7250, 7252, 7254, 7256, 7258, 7260, 7262, 7264,
+		7266, 7268, 7270, 7272, 7274, 7276, 7278, 7280, 7282, 7284, 7286, 7288, 7290, 7292, 7294, 7296,
+		7298, 7300, 7302, 7304, 7306, 7308, 7310, 7312, 7314, 7316, 7318, 7320, 7322, 7324, 7326, 7328,
+		7330, 7332, 7334, 7336, 7338, 7340, 7342, 7344, 7346, 7348, 7350, 7352, 7354, 7356, 7358, 7360,
+		7362, 7364, 7366, 7368, 7370, 7372, 7374, 7376, 7378, 7380, 7382, 7384, 7386, 7388, 7390, 7392,
+		7394, 7396, 7398, 7400, 7402, 7404, 7406, 7408, 7410, 7412, 7414, 7416, 7418, 7420, 7422, 7424,
+		7426, 7428, 7430, 7432, 7434, 7436, 7438, 7440, 7442, 7444, 7446, 7448, 7450, 7452, 7454, 7456,
+		7458, 7460, 7462, 7464, 7466, 7468, 7470, 7472, 7474, 7476, 7478, 7480, 7482, 7484, 7486, 7488,
+		7490, 7492, 7494, 7496, 7498, 7500, 7502, 7504, 7506, 7508, 7510, 7512, 7514, 7516, 7518, 7520,
+		7522, 7524, 7526, 7528, 7530, 7532, 7534, 7536, 7538, 7540, 7542, 7544, 7546, 7548, 7550, 7552,
+		7554, 7556, 7558, 7560, 7562, 7564, 7566, 7568, 7570, 7572, 7574, 7576, 7578, 7580, 7582, 7584,
+		7586, 7588, 7590, 7592, 7594, 7596, 7598, 7600, 7602, 7604, 7606, 7608, 7610, 7612, 0, 0,
+		7614, 0, 7616, 0, 0, 7618, 7620, 7622, 7624, 7626, 7628, 7630, 7632, 7634, 7636, 0,
+		7638, 0, 7640, 0, 0, 7642, 7644, 0, 0, 0, 7646, 7648, 7650, 7652, 7654, 7656,
+		7658, 7660, 7662, 7664, 7666, 7668, 7670, 7672, 7674, 7676, 7678, 7680, 7682, 7684, 7686, 7688,
+		7690, 7692, 7694, 7696, 7698, 7700, 7702, 7704, 7706, 7708, 7710, 7712, 7714, 7716, 7718, 7720,
+		7722, 7724, 7726, 7728, 7730, 7732, 7734, 7736, 7738, 7740, 7742, 7744, 7746, 7748, 7750, 7752,
+		7754, 7756, 7758, 7760, 7762, 7764, 7766, 7768, 7770, 7772, 7774, 7776, 7778, 7780, 0, 0,
+		7782, 7784, 7786, 7788, 7790, 7792, 7794, 7796, 7798, 7800, 7802, 7804, 7806, 7808, 7810, 7812,
+		7814, 7816, 7818, 7820, 7822, 7824, 7826, 7828, 7830, 7832, 7834, 7836, 7838, 7840, 7842, 7844,
+		7846, 7848, 7850, 7852, 7854, 7856, 7858, 7860, 7862, 7864, 7866, 7868, 7870, 7872, 7874, 7876,
+		7878, 7880, 7882, 7884, 7886, 7888, 7890, 7892, 7894, 7896, 7898, 7900, 7902, 7904, 7906, 7908,
+		7910, 7912, 7914, 7916, 7918, 7920, 7922, 7924, 7926, 7928, 7930, 7932, 7934, 7936, 7938, 7940,
+		7942, 7944, 7946, 7948, 7950, 7952, 7954, 7956, 7958, 7960, 7962, 7964, 7966, 7968, 7970, 7972,
+		7974, 7976, 7978, 7980, 7982, 7984, 7986, 7988, 7990, 7992, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		7994, 7997, 8000, 8003, 8007, 8011, 8014, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 8017, 8020, 8023, 8026, 8029, 0, 0, 0, 0, 0, 8032, 0, 8035,
+		8038, 8040, 8042, 8044, 8046, 8048, 8050, 8052, 8054, 8056, 8058, 8061, 8064, 8068, 8072, 8075,
+		8078, 8081, 8084, 8087, 8090, 8093, 8096, 0, 8099, 8102, 8105, 8108, 8111, 0, 8114, 0,
+		8117, 8120, 0, 8123, 8126, 0, 8129, 8132, 8135, 8138, 8141, 8144, 8147, 8150, 8153, 8156,
+		8159, 8161, 8163, 8165, 8167, 8169, 8171, 8173, 8175, 8177, 8179, 8181, 8183, 8185, 8187, 8189,
+		8191, 8193, 8195, 8197, 8199, 8201, 8203, 8205, 8207, 8209, 8211, 8213, 8215, 8217, 8219, 8221,
+		8223, 8225, 8227, 8229, 8231, 8233, 8235, 8237, 8239, 8241, 8243, 8245, 8247, 8249, 8251, 8253,
+		8255, 8257, 8259, 8261, 8263, 8265, 8267, 8269, 8271, 8273, 8275, 8277, 8279, 8281, 8283, 8285,
+		8287, 8289, 8291, 8293, 8295, 8297, 8299, 8301, 8303, 8305, 8307, 8309, 8311, 8313, 8315, 8317,
+		8319, 8321, 8323, 8325, 8327, 8330, 8333, 8335, 8337, 8339, 8341, 8343, 8345, 8347, 8349, 8351,
+		8353, 8356, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 8359, 8361, 8363, 8365, 8367, 8369, 8371, 8373, 8375, 8377, 8379, 8382, 8384,
+		8386, 8388, 8390, 8392, 8394, 8396, 8398, 8400, 8402, 8404, 8406, 8410, 8414, 8418, 8422, 8426,
+		8430, 8434, 8438, 8442, 8446, 8450, 8454, 8458, 8462, 8466, 8470, 8474, 8478, 8480, 8482, 8484,
+		8486, 8490, 8494, 8498, 8502, 8506, 8509, 8512, 8515, 8518, 8521, 8524, 8527, 8530, 8533, 8536,
+		8539, 8542, 8545, 8548, 8551, 8554, 8557, 8560, 8563, 8566, 8569, 8572, 8575, 8578, 8581, 8584,
+		8587, 8590, 8593, 8596, 8599, 8602, 8605, 8608, 8611, 8614, 8617, 8620, 8623, 8626, 8629, 8632,
+		8635, 8638, 8641, 8644, 8647, 8650, 8653, 8656, 8659, 8662, 8665, 8668, 8671, 8674, 8677, 8680,
+		8683, 8686, 8689, 8692, 8695, 8698, 8701, 8704, 8707, 8710, 8713, 8716, 8719, 8722, 8725, 8728,
+		8731, 8734, 8737, 8740, 8743, 8746, 8749, 8752, 8755, 8758, 8761, 8764, 8767, 8770, 8773, 8777,
+		8781, 8785, 8789, 8793, 8797, 8801, 8805, 8809, 8813, 8817, 8821, 8824, 8827, 8830, 8833, 8836,
+		8839, 8842, 8845, 8848, 8851, 8854, 8857, 8860, 8863, 8866, 8869, 8872, 8875, 8878, 8881, 8884,
+		8887, 8890, 8893, 8896, 8899, 8902, 8905, 8908, 8911, 8914, 8917, 8920, 8923, 8926, 8929, 8932,
+		8935, 8938, 8941, 8944, 8947, 8950, 8953, 8956, 8960, 8964, 8968, 8972, 8976, 8979, 8982, 8985,
+		8988, 8991, 8994, 8997, 9000, 9003, 9006, 9009, 9012, 9015, 9018, 9021, 9024, 9027, 9030, 9033,
+		9036, 9039, 9042, 9045, 9048, 9051, 9054, 9057, 9060, 9063, 9066, 9069, 9072, 9075, 9078, 9081,
+		9084, 9087, 9090, 9093, 9096, 9099, 9102, 9105, 9108, 9111, 9114, 9117, 9120, 9123, 9126, 9129,
+		9132, 9135, 9138, 9141, 9144, 9147, 9150, 9153, 9156, 9159, 9162, 9165, 9168, 9171, 9174, 9177,
+		9181, 9185, 9188, 9191, 9194, 9197, 9200, 9203, 9206, 9209, 9212, 9215, 9218, 9221, 9224, 9227,
+		9230, 9233, 9236, 9240, 9244, 9248, 9251, 9254, 9257, 9260, 9263, 9266, 9269, 9272, 9275, 9278,
+		9281, 9284, 9287, 9290, 9293, 9296, 9299, 9302, 9305, 9308, 9311, 9314, 9317, 9320, 9323, 9326,
+		9329, 9332, 9335, 9338, 9341, 9344, 9347, 9350, 9353, 9356, 9359, 9362, 9365, 9368, 9371, 9374,
+		9377, 9380, 9383, 9386, 9389, 9392, 9395, 9398, 9401, 9404, 9407, 9410, 9413, 9416, 9419, 9422,
+		9425, 9428, 9431, 9434, 9437, 9440, 9443, 9446, 9449, 9452, 9455, 9458, 9461, 9464, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		9467, 9471, 9475, 9479, 9483, 9487, 9491, 9495, 9499, 9503, 9507, 9511, 9515, 9519, 9523, 9527,
+		9531, 9535, 9539, 9543, 9547, 9551, 9555, 9559, 9563, 9567, 9571, 9575, 9579, 9583, 9587, 9591,
+		9595, 9599, 9603, 9607, 9611, 9615, 9619, 9623, 9627, 9631, 9635, 9639, 9643, 9647, 9651, 9655,
+		9659, 9663, 9667, 9671, 9675, 9679, 9683, 9687, 9691, 9695, 9699, 9703, 9707, 9711, 9715, 9719,
+		0, 0, 9723, 9727, 9731, 9735, 9739, 9743, 9747, 9751, 9755, 9759, 9763, 9767, 9771, 9775,
+		9779, 9783, 9787, 9791, 9795, 9799, 9803, 9807, 9811, 9815, 9819, 9823, 9827, 9831, 9835, 9839,
+		9843, 9847, 9851, 9855, 9859, 9863, 9867, 9871, 9875, 9879, 9883, 9887, 9891, 9895, 9899, 9903,
+		9907, 9911, 9915, 9919, 9923, 9927, 9931, 9935, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		9939, 9943, 9947, 9952, 9957, 9962, 9967, 9972, 9977, 9982, 9986, 10005, 10014, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		10019, 10021, 10023, 10025, 10027, 10029, 10031, 10033, 10035, 10037, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		10041, 10044, 10046, 10048, 10050, 10052, 10054, 10056, 10058, 10060, 10062, 10064, 10066, 10068, 10070, 10072,
+		10074, 10076, 10078, 10080, 10082, 0, 0, 10084, 10086, 10088, 10091, 10094, 10097, 10100, 10102, 10104,
+		10106, 10108, 10110, 0, 10112, 10114, 10116, 10118, 10120, 10122, 10124, 10126, 10128, 10130, 10132, 10134,
+		10136, 10138, 10140, 10142, 10144, 10146, 10148, 0, 10150, 10152, 10154, 10156, 0, 0, 0, 0,
+		10158, 10161, 10164, 0, 10167, 0, 10170, 10173, 10176, 10179, 10182, 10185, 10188, 10191, 10194, 10197,
+		10200, 10202, 10205, 10208, 10211, 10214, 10217, 10220, 10223, 10226, 10229, 10232, 10235, 10238, 10240, 10242,
+		10244, 10246, 10248, 10250, 10252, 10254, 10256, 10258, 10260, 10262, 10264, 10266, 10268, 10270, 10272, 10274,
+		10276, 10278, 10280, 10282, 10284, 10286, 10288, 10290, 10292, 10294, 10296, 10298, 10300, 10302, 10304, 10306,
+		10308, 10310, 10312, 10314, 10316, 10318, 10320, 10322, 10324, 10326, 10328, 10330, 10332, 10334, 10336, 10338,
+		10340, 10342, 10344, 10346, 10348, 10350, 10352, 10354, 10356, 10358, 10360, 10362, 10364, 10366, 10368, 10370,
+		10372, 10374, 10376, 10378, 10380, 10382, 10384, 10386, 10388, 10390, 10392, 10394, 10396, 10398, 10400, 10402,
+		10404, 10406, 10408, 10410, 10412, 10414, 10416, 10418, 10420, 10422, 10424, 10426, 10428, 10430, 10432, 10434,
+		10436, 10438, 10440, 10442, 10444, 10446, 10450, 10454, 10458, 10462, 10466, 10470, 10473, 0, 0, 0,
+		0, 10476, 10478, 10480, 10482, 10484, 10486, 10488, 10490, 10492, 10494, 10496, 10498, 10500, 10502, 10504,
+		10506, 10508, 10510, 10512, 10514, 10516, 10518, 10520, 10522, 10524, 10526, 10528, 10530, 10532, 10534, 10536,
+		10538, 10540, 10542, 10544, 10546, 10548, 10550, 10552, 10554, 10556, 10558, 10560, 10562, 10564, 10566, 10568,
+		10570, 10572, 10574, 10576, 10578, 10580, 10582, 10584, 10586, 10588, 10590, 10592, 10594, 10596, 10598, 10600,
+		10602, 10604, 10606, 10608, 10610, 10612, 10614, 10616, 10618, 10620, 10622, 10624, 10626, 10628, 10630, 10632,
+		10634, 10636, 10638, 10640, 10642, 10644, 10646, 10648, 10650, 10652, 10654, 10656, 10658, 10660, 10662, 10664,
+		10666, 10668, 10670, 10672, 10674, 10676, 10678, 10680, 10682, 10684, 10686, 10688, 10690, 10692, 10694, 10696,
+		10698, 10700, 10702, 10704, 10706, 10708, 10710, 10712, 10714, 10716, 10718, 10720, 10722, 10724, 10726, 10728,
+		10730, 10732, 10734, 10736, 10738, 10740, 10742, 10744, 10746, 10748, 10750, 10752, 10754, 10756, 10758, 10760,
+		10762, 10764, 10766, 10768, 10770, 10772, 10774, 10776, 10778, 10780, 10782, 10784, 10786, 10788, 10790, 10792,
+		10794, 10796, 10798, 10800, 10802, 10804, 10806, 10808, 10810, 10812, 10814, 10816, 10818, 10820, 10822, 10824,
+		10826, 10828, 10830, 10832, 10834, 10836, 10838, 10840, 10842, 10844, 10846, 10848, 10850, 10852, 10854, 0,
+		0, 0, 10856, 10858, 10860, 10862, 10864, 10866, 0, 0, 10868, 10870, 10872, 10874, 10876, 10878,
+		0, 0, 10880, 10882, 10884, 10886, 10888, 10890, 0, 0, 10892, 10894, 10896, 0, 0, 0,
+		10898, 10900, 10902, 10904, 10907, 10909, 10911, 0, 10913, 10915, 10917, 10919, 10921, 10923, 10925, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 10927, 10929, 10931, 10933, 10935, 0, 10937, 10939, 10941, 10943, 10945, 10947, 10949, 10951, 10953,
+		10955, 10957, 10959, 10961, 10963, 10965, 10967, 10969, 10971, 10973, 10975, 10977, 10979, 10981, 10983, 10985,
+		10987, 10989, 10991, 10993, 10995, 10997, 10999, 11001, 11003, 11005, 11007, 11009, 11011, 11013, 11015, 11017,
+		11019, 0, 11021, 11023, 11025, 11027, 11029, 11031, 11033, 11035, 11037, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11039, 0, 11042, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11045, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11048, 11051,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11054, 11057, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11060, 11063, 0, 11066, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11069, 11072, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 11075, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11078, 11081,
+		11084, 11088, 11092, 11096, 11100, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11104, 11107, 11110, 11114, 11118,
+		11122, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		11126, 11128, 11130, 11132, 11134, 11136, 11138, 11140, 11142, 11144, 11146, 11148, 11150, 11152, 11154, 11156,
+		11158, 11160, 11162, 11164, 11166, 11168, 11170, 11172, 11174, 11176, 11178, 11180, 11182, 11184, 11186, 11188,
+		11190, 11192, 11194, 11196, 11198, 11200, 11202, 11204, 11206, 11208, 11210, 11212, 11214, 11216, 11218, 11220,
+		11222, 11224, 11226, 11228, 11230, 11232, 11234, 11236, 11238, 11240, 11242, 11244, 11246, 11248, 11250, 11252,
+		11254, 11256, 11258, 11260, 11262, 11264, 11266, 11268, 11270, 11272, 11274, 11276, 11278, 11280, 11282, 11284,
+		11286, 11288, 11290, 11292, 11294, 0, 11296, 11298, 11300, 11302, 11304, 11306, 11308, 11310, 11312, 11314,
+		11316, 11318, 11320, 11322, 11324, 11326, 11328, 11330, 11332, 11334, 11336, 11338, 11340, 11342, 11344, 11346,
+		11348, 11350, 11352, 11354, 11356, 11358, 11360, 11362, 11364, 11366, 11368, 11370, 11372, 11374, 11376, 11378,
+		11380, 11382, 11384, 11386, 11388, 11390, 11392, 11394, 11396, 11398, 11400, 11402, 11404, 11406, 11408, 11410,
+		11412, 11414, 11416, 11418, 11420, 11422, 11424, 11426, 11428, 11430, 11432, 11434, 11436, 0, 11438, 11440,
+		0, 0, 11442, 0, 0, 11444, 11446, 0, 0, 11448, 11450, 11452, 11454, 0, 11456, 11458,
+		11460, 11462, 11464, 11466, 11468, 11470, 11472, 11474, 11476, 11478, 0, 11480, 0, 11482, 11484, 11486,
+		11488, 11490, 11492, 11494, 0, 11496, 11498, 11500, 11502, 11504, 11506, 11508, 11510, 11512, 11514, 11516,
+		11518, 11520, 11522, 11524, 11526, 11528, 11530, 11532, 11534, 11536, 11538, 11540, 11542, 11544, 11546, 11548,
+		11550, 11552, 11554, 11556, 11558, 11560, 11562, 11564, 11566, 11568, 11570, 11572, 11574, 11576, 11578, 11580,
+		11582, 11584, 11586, 11588, 11590, 11592, 11594, 11596, 11598, 11600, 11602, 11604, 11606, 11608, 11610, 11612,
+		11614, 11616, 11618, 11620, 11622, 11624, 0, 11626, 11628, 11630, 11632, 0, 0, 11634, 11636, 11638,
+		11640, 11642, 11644, 11646, 11648, 0, 11650, 11652, 11654, 11656, 11658, 11660, 11662, 0, 11664, 11666,
+		11668, 11670, 11672, 11674, 11676, 11678, 11680, 11682, 11684, 11686, 11688, 11690, 11692, 11694, 11696, 11698,
+		11700, 11702, 11704, 11706, 11708, 11710, 11712, 11714, 11716, 11718, 0, 11720, 11722, 11724, 11726, 0,
+		11728, 11730, 11732, 11734, 11736, 0, 11738, 0, 0, 0, 11740, 11742, 11744, 11746, 11748, 11750,
+		11752, 0, 11754, 11756, 11758, 11760, 11762, 11764, 11766, 11768, 11770, 11772, 11774, 11776, 11778, 11780,
+		11782, 11784, 11786, 11788, 11790, 11792, 11794, 11796, 11798, 11800, 11802, 11804, 11806, 11808, 11810, 11812,
+		11814, 11816, 11818, 11820, 11822, 11824, 11826, 11828, 11830, 11832, 11834, 11836, 11838, 11840, 11842, 11844,
+		11846, 11848, 11850, 11852, 11854, 11856, 11858, 11860, 11862, 11864, 11866, 11868, 11870, 11872, 11874, 11876,
+		11878, 11880, 11882, 11884, 11886, 11888, 11890, 11892, 11894, 11896, 11898, 11900, 11902, 11904, 11906, 11908,
+		11910, 11912, 11914, 11916, 11918, 11920, 11922, 11924, 11926, 11928, 11930, 11932, 11934, 11936, 11938, 11940,
+		11942, 11944, 11946, 11948, 11950, 11952, 11954, 11956, 11958, 11960, 11962, 11964, 11966, 11968, 11970, 11972,
+		11974, 11976, 11978, 11980, 11982, 11984, 11986, 11988, 11990, 11992, 11994, 11996, 11998, 12000, 12002, 12004,
+		12006, 12008, 12010, 12012, 12014, 12016, 12018, 12020, 12022, 12024, 12026, 12028, 12030, 12032, 12034, 12036,
+		12038, 12040, 12042, 12044, 12046, 12048, 12050, 12052, 12054, 12056, 12058, 12060, 12062, 12064, 12066, 12068,
+		12070, 12072, 12074, 12076, 12078, 12080, 12082, 12084, 12086, 12088, 12090, 12092, 12094, 12096, 12098, 12100,
+		12102, 12104, 12106, 12108, 12110, 12112, 12114, 12116, 12118, 12120, 12122, 12124, 12126, 12128, 12130, 12132,
+		12134, 12136, 12138, 12140, 12142, 12144, 12146, 12148, 12150, 12152, 12154, 12156, 12158, 12160, 12162, 12164,
+		12166, 12168, 12170, 12172, 12174, 12176, 12178, 12180, 12182, 12184, 12186, 12188, 12190, 12192, 12194, 12196,
+		12198, 12200, 12202, 12204, 12206, 12208, 12210, 12212, 12214, 12216, 12218, 12220, 12222, 12224, 12226, 12228,
+		12230, 12232, 12234, 12236, 12238, 12240, 12242, 12244, 12246, 12248, 12250, 12252, 12254, 12256, 12258, 12260,
+		12262, 12264, 12266, 12268, 12270, 12272, 12274, 12276, 12278, 12280, 12282, 12284, 12286, 12288, 12290, 12292,
+		12294, 12296, 12298, 12300, 12302, 12304, 12306, 12308, 12310, 12312, 12314, 12316, 12318, 12320, 12322, 12324,
+		12326, 12328, 12330, 12332, 12334, 12336, 12338, 12340, 12342, 12344, 12346, 12348, 12350, 12352, 12354, 12356,
+		12358, 12360, 12362, 12364, 12366, 12368, 12370, 12372, 12374, 12376, 12378, 12380, 12382, 12384, 12386, 12388,
+		12390, 12392, 12394, 12396, 12398, 12400, 12402, 12404, 12406, 12408, 12410, 12412, 12414, 12416, 12418, 12420,
+		12422, 12424, 12426, 12428, 12430, 12432, 0, 0, 12434, 12436, 12438, 12440, 12442, 12444, 12446, 12448,
+		12450, 12452, 12454, 12456, 12458, 12460, 12462, 12464, 12466, 12468, 12470, 12472, 12474, 12476, 12478, 12480,
+		12482, 12484, 12486, 12488, 12490, 12492, 12494, 12496, 12498, 12500, 12502, 12504, 12506, 12508, 12510, 12512,
+		12514, 12516, 12518, 12520, 12522, 12524, 12526, 12528, 12530, 12532, 12534, 12536, 12538, 12540, 12542, 12544,
+		12546, 12548, 12550, 12552, 12554, 12556, 12558, 12560, 12562, 12564, 12566, 12568, 12570, 12572, 12574, 12576,
+		12578, 12580, 12582, 12584, 12586, 12588, 12590, 12592, 12594, 12596, 12598, 12600, 12602, 12604, 12606, 12608,
+		12610, 12612, 12614, 12616, 12618, 12620, 12622, 12624, 12626, 12628, 12630, 12632, 12634, 12636, 12638, 12640,
+		12642, 12644, 12646, 12648, 12650, 12652, 12654, 12656, 12658, 12660, 12662, 12664, 12666, 12668, 12670, 12672,
+		12674, 12676, 12678, 12680, 12682, 12684, 12686, 12688, 12690, 12692, 12694, 12696, 12698, 12700, 12702, 12704,
+		12706, 12708, 12710, 12712, 12714, 12716, 12718, 12720, 12722, 12724, 12726, 12728, 12730, 12732, 12734, 12736,
+		12738, 12740, 12742, 12744, 12746, 12748, 12750, 12752, 12754, 12756, 12758, 12760, 12762, 12764, 12766, 12768,
+		12770, 12772, 12774, 12776, 12778, 12780, 12782, 12784, 12786, 12788, 12790, 12792, 12794, 12796, 12798, 12800,
+		12802, 12804, 12806, 12808, 12810, 12812, 12814, 12816, 12818, 12820, 12822, 12824, 12826, 12828, 12830, 12832,
+		12834, 12836, 12838, 12840, 12842, 12844, 12846, 12848, 12850, 12852, 12854, 12856, 12858, 12860, 12862, 12864,
+		12866, 12868, 12870, 12872, 12874, 12876, 12878, 12880, 12882, 12884, 12886, 12888, 12890, 12892, 12894, 12896,
+		12898, 12900, 12902, 12904, 12906, 12908, 12910, 12912, 12914, 12916, 12918, 12920, 12922, 12924, 12926, 12928,
+		12930, 12932, 12934, 12936, 12938, 12940, 12942, 12944, 12946, 12948, 12950, 12952, 12954, 12956, 12958, 12960,
+		12962, 12964, 12966, 12968, 12970, 12972, 12974, 12976, 12978, 12980, 12982, 12984, 12986, 12988, 12990, 12992,
+		12994, 12996, 12998, 13000, 13002, 13004, 13006, 13008, 13010, 13012, 13014, 13016, 0, 0, 13018, 13020,
+		13022, 13024, 13026, 13028, 13030, 13032, 13034, 13036, 13038, 13040, 13042, 13044, 13046, 13048, 13050, 13052,
+		13054, 13056, 13058, 13060, 13062, 13064, 13066, 13068, 13070, 13072, 13074, 13076, 13078, 13080, 13082, 13084,
+		13086, 13088, 13090, 13092, 13094, 13096, 13098, 13100, 13102, 13104, 13106, 13108, 13110, 13112, 13114, 13116,
+		13118, 13120, 13122, 13124, 0, 13126, 13128, 13130, 13132, 13134, 13136, 13138, 13140, 13142, 13144, 13146,
+		13148, 13150, 13152, 13154, 13156, 13158, 13160, 13162, 13164, 13166, 13168, 13170, 13172, 13174, 13176, 13178,
+		0, 13180, 13182, 0, 13184, 0, 0, 13186, 0, 13188, 13190, 13192, 13194, 13196, 13198, 13200,
+		13202, 13204, 13206, 0, 13208, 13210, 13212, 13214, 0, 13216, 0, 13218, 0, 0, 0, 0,
+		0, 0, 13220, 0, 0, 0, 0, 13222, 0, 13224, 0, 13226, 0, 13228, 13230, 13232,
+		0, 13234, 13236, 0, 13238, 0, 0, 13240, 0, 13242, 0, 13244, 0, 13246, 0, 13248,
+		0, 13250, 13252, 0, 13254, 0, 0, 13256, 13258, 13260, 13262, 0, 13264, 13266, 13268, 13270,
+		13272, 13274, 13276, 0, 13278, 13280, 13282, 13284, 0, 13286, 13288, 13290, 13292, 0, 13294, 0,
+		13296, 13298, 13300, 13302, 13304, 13306, 13308, 13310, 13312, 13314, 0, 13316, 13318, 13320, 13322, 13324,
+		13326, 13328, 13330, 13332, 13334, 13336, 13338, 13340, 13342, 13344, 13346, 13348, 0, 0, 0, 0,
+		0, 13350, 13352, 13354, 0, 13356, 13358, 13360, 13362, 13364, 0, 13366, 13368, 13370, 13372, 13374,
+		13376, 13378, 13380, 13382, 13384, 13386, 13388, 13390, 13392, 13394, 13396, 13398, 0, 0, 0, 0,
+		13400, 13403, 13406, 13409, 13412, 13415, 13418, 13421, 13424, 13427, 13430, 0, 0, 0, 0, 0,
+		13433, 13437, 13441, 13445, 13449, 13453, 13457, 13461, 13465, 13469, 13473, 13477, 13481, 13485, 13489, 13493,
+		13497, 13501, 13505, 13509, 13513, 13517, 13521, 13525, 13529, 13533, 13537, 13541, 13543, 13545, 13548, 0,
+		13551, 13553, 13555, 13557, 13559, 13561, 13563, 13565, 13567, 13569, 13571, 13573, 13575, 13577, 13579, 13581,
+		13583, 13585, 13587, 13589, 13591, 13593, 13595, 13597, 13599, 13601, 13603, 13606, 13609, 13612, 13615, 13619,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13622, 13625, 13628, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		13631, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		13634, 13637, 13640, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		13642, 13644, 13646, 13648, 13651, 13653, 13655, 13657, 13659, 13661, 13663, 13665, 13667, 13669, 13671, 13673,
+		13675, 13677, 13679, 13681, 13683, 13685, 13687, 13689, 13691, 13693, 13695, 13697, 13699, 13701, 13703, 13705,
+		13707, 13709, 13711, 13713, 13715, 13717, 13719, 13721, 13723, 13725, 13727, 13729, 0, 0, 0, 0,
+		13731, 13735, 13739, 13743, 13747, 13751, 13755, 13759, 13763, 0, 0, 0, 0, 0, 0, 0,
+		13767, 13769, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		13771, 13773, 13775, 13777, 13779, 13781, 13783, 13785, 13787, 13789, 0, 0, 0, 0, 0, 0,
+		13791, 13793, 13795, 13797, 13799, 13801, 13803, 13805, 13807, 13809, 13811, 13813, 13815, 13817, 13819, 13821,
+		13823, 13825, 13827, 13829, 13831, 13833, 13835, 13837, 13839, 13841, 13843, 13845, 13847, 13849, 13851, 13853,
+		13855, 13857, 13859, 13861, 13863, 13865, 13867, 13869, 13871, 13873, 13875, 13877, 13879, 13881, 13883, 13885,
+		13887, 13889, 13891, 13893, 13895, 13897, 13899, 13901, 13903, 13905, 13907, 13909, 13911, 13913, 13915, 13917,
+		13919, 13921, 13923, 13925, 13927, 13929, 13931, 13933, 13935, 13937, 13939, 13941, 13943, 13945, 13947, 13949,
+		13951, 13953, 13955, 13957, 13959, 13961, 13963, 13965, 13967, 13969, 13971, 13973, 13975, 13977, 13979, 13981,
+		13983, 13985, 13987, 13989, 13991, 13993, 13995, 13997, 13999, 14001, 14003, 14005, 14007, 14009, 14011, 14013,
+		14015, 14017, 14019, 14021, 14023, 14025, 14027, 14029, 14031, 14033, 14035, 14037, 14039, 14041, 14043, 14045,
+		14047, 14049, 14051, 14053, 14055, 14057, 14059, 14061, 14063, 14065, 14067, 14069, 14071, 14073, 14075, 14077,
+		14079, 14081, 14083, 14085, 14087, 14089, 14091, 14093, 14095, 14097, 14099, 14101, 14103, 14105, 14107, 14109,
+		14111, 14113, 14115, 14117, 14119, 14121, 14123, 14125, 14127, 14129, 14131, 14133, 14135, 14137, 14139, 14141,
+		14143, 14145, 14147, 14149, 14151, 14153, 14155, 14157, 14159, 14161, 14163, 14165, 14167, 14169, 14171, 14173,
+		14175, 14177, 14179, 14181, 14183, 14185, 14187, 14189, 14191, 14193, 14195, 14197, 14199, 14201, 14203, 14205,
+		14207, 14209, 14211, 14213, 14215, 14217, 14219, 14221, 14223, 14225, 14227, 14229, 14231, 14233, 14235, 14237,
+		14239, 14241, 14243, 14245, 14247, 14249, 14251, 14253, 14255, 14257, 14259, 14261, 14263, 14265, 14267, 14269,
+		14271, 14273, 14275, 14277, 14279, 14281, 14283, 14285, 14287, 14289, 14291, 14293, 14295, 14297, 14299, 14301,
+		14303, 14305, 14307, 14309, 14311, 14313, 14315, 14317, 14319, 14321, 14323, 14325, 14327, 14329, 14331, 14333,
+		14335, 14337, 14339, 14341, 14343, 14345, 14347, 14349, 14351, 14353, 14355, 14357, 14359, 14361, 14363, 14365,
+		14367, 14369, 14371, 14373, 14375, 14377, 14379, 14381, 14383, 14385, 14387, 14389, 14391, 14393, 14395, 14397,
+		14399, 14401, 14403, 14405, 14407, 14409, 14411, 14413, 14415, 14417, 14419, 14421, 14423, 14425, 14427, 14429,
+		14431, 14433, 14435, 14437, 14439, 14441, 14443, 14445, 14447, 14449, 14451, 14453, 14455, 14457, 14459, 14461,
+		14463, 14465, 14467, 14469, 14471, 14473, 14475, 14477, 14479, 14481, 14483, 14485, 14487, 14489, 14491, 14493,
+		14495, 14497, 14499, 14501, 14503, 14505, 14507, 14509, 14511, 14513, 14515, 14517, 14519, 14521, 14523, 14525,
+		14527, 14529, 14531, 14533, 14535, 14537, 14539, 14541, 14543, 14545, 14547, 14549, 14551, 14553, 14555, 14557,
+		14559, 14561, 14563, 14565, 14567, 14569, 14571, 14573, 14575, 14577, 14579, 14581, 14583, 14585, 14587, 14589,
+		14591, 14593, 14595, 14597, 14599, 14601, 14603, 14605, 14607, 14609, 14611, 14613, 14615, 14617, 14619, 14621,
+		14623, 14625, 14627, 14629, 14631, 14633, 14635, 14637, 14639, 14641, 14643, 14645, 14647, 14649, 14651, 14653,
+		14655, 14657, 14659, 14661, 14663, 14665, 14667, 14669, 14671, 14673, 14675, 14677, 14679, 14681, 14683, 14685,
+		14687, 14689, 14691, 14693, 14695, 14697, 14699, 14701, 14703, 14705, 14707, 14709, 14711, 14713, 14715, 14717,
+		14719, 14721, 14723, 14725, 14727, 14729, 14731, 14733, 14735, 14737, 14739, 14741, 14743, 14745, 14747, 14749,
+		14751, 14753, 14755, 14757, 14759, 14761, 14763, 14765, 14767, 14769, 14771, 14773, 14775, 14777, 14779, 14781,
+		14783, 14785, 14787, 14789, 14791, 14793, 14795, 14797, 14799, 14801, 14803, 14805, 14807, 14809, 14811, 14813,
+		14815, 14817, 14819, 14821, 14823, 14825, 14827, 14829, 14831, 14833, 14835, 14837, 14839, 14841, 14843, 14845,
+		14847, 14849, 14851, 14853, 14855, 14857, 14859, 14861, 14863, 14865, 14867, 14869, 14871, 14873, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	};
+
+	/** @brief Full decompositions as [canonical length | compatibility length << 8, codepoints...] */
+	inline constexpr char32_t kDecompositionData[]{
+		0x0, 0x100, 0x20, 0x200, 0x20, 0x308, 0x100, 0x61, 0x200, 0x20, 0x304, 0x100,
+		0x32, 0x100, 0x33, 0x200, 0x20, 0x301, 0x100, 0x3BC, 0x200, 0x20, 0x327, 0x100,
+		0x31, 0x100, 0x6F, 0x300, 0x31, 0x2044, 0x34, 0x300, 0x31, 0x2044, 0x32, 0x300,
+		0x33, 0x2044, 0x34, 0x2, 0x41, 0x300, 0x2, 0x41, 0x301, 0x2, 0x41, 0x302,
+		0x2, 0x41, 0x303, 0x2, 0x41, 0x308, 0x2, 0x41, 0x30A, 0x2, 0x43, 0x327,
+		0x2, 0x45, 0x300, 0x2, 0x45, 0x301, 0x2, 0x45, 0x302, 0x2, 0x45, 0x308,
+		0x2, 0x49, 0x300, 0x2, 0x49, 0x301, 0x2, 0x49, 0x302, 0x2, 0x49, 0x308,
+		0x2, 0x4E, 0x303, 0x2, 0x4F, 0x300, 0x2, 0x4F, 0x301, 0x2, 0x4F, 0x302,
+		0x2, 0x4F, 0x303, 0x2, 0x4F, 0x308, 0x2, 0x55, 0x300, 0x2, 0x55, 0x301,
+		0x2, 0x55, 0x302, 0x2, 0x55, 0x308, 0x2, 0x59, 0x301, 0x2, 0x61, 0x300,
+		0x2, 0x61, 0x301, 0x2, 0x61, 0x302, 0x2, 0x61, 0x303, 0x2, 0x61, 0x308,
+		0x2, 0x61, 0x30A, 0x2, 0x63, 0x327, 0x2, 0x65, 0x300, 0x2, 0x65, 0x301,
+		0x2, 0x65, 0x302, 0x2, 0x65, 0x308, 0x2, 0x69, 0x300, 0x2, 0x69, 0x301,
+		0x2, 0x69, 0x302, 0x2, 0x69, 0x308, 0x2, 0x6E, 0x303, 0x2, 0x6F, 0x300,
+		0x2, 0x6F, 0x301, 0x2, 0x6F, 0x302, 0x2, 0x6F, 0x303, 0x2, 0x6F, 0x308,
+		0x2, 0x75, 0x300, 0x2, 0x75, 0x301, 0x2, 0x75, 0x302, 0x2, 0x75, 0x308,
+		0x2, 0x79, 0x301, 0x2, 0x79, 0x308, 0x2, 0x41, 0x304, 0x2, 0x61, 0x304,
+		0x2, 0x41, 0x306, 0x2, 0x61, 0x306, 0x2, 0x41, 0x328, 0x2, 0x61, 0x328,
+		0x2, 0x43, 0x301, 0x2, 0x63, 0x301, 0x2, 0x43, 0x302, 0x2, 0x63, 0x302,
+		0x2, 0x43, 0x307, 0x2, 0x63, 0x307, 0x2, 0x43, 0x30C, 0x2, 0x63, 0x30C,
+		0x2, 0x44, 0x30C, 0x2, 0x64, 0x30C, 0x2, 0x45, 0x304, 0x2, 0x65, 0x304,
+		0x2, 0x45, 0x306, 0x2, 0x65, 0x306, 0x2, 0x45, 0x307, 0x2, 0x65, 0x307,
+		0x2, 0x45, 0x328, 0x2, 0x65, 0x328, 0x2, 0x45, 0x30C, 0x2, 0x65, 0x30C,
+		0x2, 0x47, 0x302, 0x2, 0x67, 0x302, 0x2, 0x47, 0x306, 0x2, 0x67, 0x306,
+		0x2, 0x47, 0x307, 0x2, 0x67, 0x307, 0x2, 0x47, 0x327, 0x2, 0x67, 0x327,
+		0x2, 0x48, 0x302, 0x2, 0x68, 0x302, 0x2, 0x49, 0x303, 0x2, 0x69, 0x303,
+		0x2, 0x49, 0x304, 0x2, 0x69, 0x304, 0x2, 0x49, 0x306, 0x2, 0x69, 0x306,
+		0x2, 0x49, 0x328, 0x2, 0x69, 0x328, 0x2, 0x49, 0x307, 0x200, 0x49, 0x4A,
+		0x200, 0x69, 0x6A, 0x2, 0x4A, 0x302, 0x2, 0x6A, 0x302, 0x2, 0x4B, 0x327,
+		0x2, 0x6B, 0x327, 0x2, 0x4C, 0x301, 0x2, 0x6C, 0x301, 0x2, 0x4C, 0x327,
+		0x2, 0x6C, 0x327, 0x2, 0x4C, 0x30C, 0x2, 0x6C, 0x30C, 0x200, 0x4C, 0xB7,
+		0x200, 0x6C, 0xB7, 0x2, 0x4E, 0x301, 0x2, 0x6E, 0x301, 0x2, 0x4E, 0x327,
+		0x2, 0x6E, 0x327, 0x2, 0x4E, 0x30C, 0x2, 0x6E, 0x30C, 0x200, 0x2BC, 0x6E,
+		0x2, 0x4F, 0x304, 0x2, 0x6F, 0x304, 0x2, 0x4F, 0x306, 0x2, 0x6F, 0x306,
+		0x2, 0x4F, 0x30B, 0x2, 0x6F, 0x30B, 0x2, 0x52, 0x301, 0x2, 0x72, 0x301,
+		0x2, 0x52, 0x327, 0x2, 0x72, 0x327, 0x2, 0x52, 0x30C, 0x2, 0x72, 0x30C,
+		0x2, 0x53, 0x301, 0x2, 0x73, 0x301, 0x2, 0x53, 0x302, 0x2, 0x73, 0x302,
+		0x2, 0x53, 0x327, 0x2, 0x73, 0x327, 0x2, 0x53, 0x30C, 0x2, 0x73, 0x30C,
+		0x2, 0x54, 0x327, 0x2, 0x74, 0x327, 0x2, 0x54, 0x30C, 0x2, 0x74, 0x30C,
+		0x2, 0x55, 0x303, 0x2, 0x75, 0x303, 0x2, 0x55, 0x304, 0x2, 0x75, 0x304,
+		0x2, 0x55, 0x306, 0x2, 0x75, 0x306, 0x2, 0x55, 0x30A, 0x2, 0x75, 0x30A,
+		0x2, 0x55, 0x30B, 0x2, 0x75, 0x30B, 0x2, 0x55, 0x328, 0x2, 0x75, 0x328,
+		0x2, 0x57, 0x302, 0x2, 0x77, 0x302, 0x2, 0x59, 0x302, 0x2, 0x79, 0x302,
+		0x2, 0x59, 0x308, 0x2, 0x5A, 0x301, 0x2, 0x7A, 0x301, 0x2, 0x5A, 0x307,
+		0x2, 0x7A, 0x307, 0x2, 0x5A, 0x30C, 0x2, 0x7A, 0x30C, 0x100, 0x73, 0x2,
+		0x4F, 0x31B, 0x2, 0x6F, 0x31B, 0x2, 0x55, 0x31B, 0x2, 0x75, 0x31B, 0x300,
+		0x44, 0x5A, 0x30C, 0x300, 0x44, 0x7A, 0x30C, 0x300, 0x64, 0x7A, 0x30C, 0x200,
+		0x4C, 0x4A, 0x200, 0x4C, 0x6A, 0x200, 0x6C, 0x6A, 0x200, 0x4E, 0x4A, 0x200,
+		0x4E, 0x6A, 0x200, 0x6E, 0x6A, 0x2, 0x41, 0x30C, 0x2, 0x61, 0x30C, 0x2,
+		0x49, 0x30C, 0x2, 0x69, 0x30C, 0x2, 0x4F, 0x30C, 0x2, 0x6F, 0x30C, 0x2,
+		0x55, 0x30C, 0x2, 0x75, 0x30C, 0x3, 0x55, 0x308, 0x304, 0x3, 0x75, 0x308,
+		0x304, 0x3, 0x55, 0x308, 0x301, 0x3, 0x75, 0x308, 0x301, 0x3, 0x55, 0x308,
+		0x30C, 0x3, 0x75, 0x308, 0x30C, 0x3, 0x55, 0x308, 0x300, 0x3, 0x75, 0x308,
+		0x300, 0x3, 0x41, 0x308, 0x304, 0x3, 0x61, 0x308, 0x304, 0x3, 0x41, 0x307,
+		0x304, 0x3, 0x61, 0x307, 0x304, 0x2, 0xC6, 0x304, 0x2, 0xE6, 0x304, 0x2,
+		0x47, 0x30C, 0x2, 0x67, 0x30C, 0x2, 0x4B, 0x30C, 0x2, 0x6B, 0x30C, 0x2,
+		0x4F, 0x328, 0x2, 0x6F, 0x328, 0x3, 0x4F, 0x328, 0x304, 0x3, 0x6F, 0x328,
+		0x304, 0x2, 0x1B7, 0x30C, 0x2, 0x292, 0x30C, 0x2, 0x6A, 0x30C, 0x200, 0x44,
+		0x5A, 0x200, 0x44, 0x7A, 0x200, 0x64, 0x7A, 0x2, 0x47, 0x301, 0x2, 0x67,
+		0x301, 0x2, 0x4E, 0x300, 0x2, 0x6E, 0x300, 0x3, 0x41, 0x30A, 0x301, 0x3,
+		0x61, 0x30A, 0x301, 0x2, 0xC6, 0x301, 0x2, 0xE6, 0x301, 0x2, 0xD8, 0x301,
+		0x2, 0xF8, 0x301, 0x2, 0x41, 0x30F, 0x2, 0x61, 0x30F, 0x2, 0x41, 0x311,
+		0x2, 0x61, 0x311, 0x2, 0x45, 0x30F, 0x2, 0x65, 0x30F, 0x2, 0x45, 0x311,
+		0x2, 0x65, 0x311, 0x2, 0x49, 0x30F, 0x2, 0x69, 0x30F, 0x2, 0x49, 0x311,
+		0x2, 0x69, 0x311, 0x2, 0x4F, 0x30F, 0x2, 0x6F, 0x30F, 0x2, 0x4F, 0x311,
+		0x2, 0x6F, 0x311, 0x2, 0x52, 0x30F, 0x2, 0x72, 0x30F, 0x2, 0x52, 0x311,
+		0x2, 0x72, 0x311, 0x2, 0x55, 0x30F, 0x2, 0x75, 0x30F, 0x2, 0x55, 0x311,
+		0x2, 0x75, 0x311, 0x2, 0x53, 0x326, 0x2, 0x73, 0x326, 0x2, 0x54, 0x326,
+		0x2, 0x74, 0x326, 0x2, 0x48, 0x30C, 0x2, 0x68, 0x30C, 0x2, 0x41, 0x307,
+		0x2, 0x61, 0x307, 0x2, 0x45, 0x327, 0x2, 0x65, 0x327, 0x3, 0x4F, 0x308,
+		0x304, 0x3, 0x6F, 0x308, 0x304, 0x3, 0x4F, 0x303, 0x304, 0x3, 0x6F, 0x303,
+		0x304, 0x2, 0x4F, 0x307, 0x2, 0x6F, 0x307, 0x3, 0x4F, 0x307, 0x304, 0x3,
+		0x6F, 0x307, 0x304, 0x2, 0x59, 0x304, 0x2, 0x79, 0x304, 0x100, 0x68, 0x100,
+		0x266, 0x100, 0x6A, 0x100, 0x72, 0x100, 0x279, 0x100, 0x27B, 0x100, 0x281, 0x100,
+		0x77, 0x100, 0x79, 0x200, 0x20, 0x306, 0x200, 0x20, 0x307, 0x200, 0x20, 0x30A,
+		0x200, 0x20, 0x328, 0x200, 0x20, 0x303, 0x200, 0x20, 0x30B, 0x100, 0x263, 0x100,
+		0x6C, 0x100, 0x73, 0x100, 0x78, 0x100, 0x295, 0x1, 0x300, 0x1, 0x301, 0x1,
+		0x313, 0x2, 0x308, 0x301, 0x1, 0x2B9, 0x200, 0x20, 0x345, 0x1, 0x3B, 0x200,
+		0x20, 0x301, 0x302, 0xA8, 0x301, 0x20, 0x308, 0x301, 0x2, 0x391, 0x301, 0x1,
+		0xB7, 0x2, 0x395, 0x301, 0x2, 0x397, 0x301, 0x2, 0x399, 0x301, 0x2, 0x39F,
+		0x301, 0x2, 0x3A5, 0x301, 0x2, 0x3A9, 0x301, 0x3, 0x3B9, 0x308, 0x301, 0x2,
+		0x399, 0x308, 0x2, 0x3A5, 0x308, 0x2, 0x3B1, 0x301, 0x2, 0x3B5, 0x301, 0x2,
+		0x3B7, 0x301, 0x2, 0x3B9, 0x301, 0x3, 0x3C5, 0x308, 0x301, 0x2, 0x3B9, 0x308,
+		0x2, 0x3C5, 0x308, 0x2, 0x3BF, 0x301, 0x2, 0x3C5, 0x301, 0x2, 0x3C9, 0x301,
+		0x100, 0x3B2, 0x100, 0x3B8, 0x100, 0x3A5, 0x202, 0x3D2, 0x301, 0x3A5, 0x301, 0x202,
+		0x3D2, 0x308, 0x3A5, 0x308, 0x100, 0x3C6, 0x100, 0x3C0, 0x100, 0x3BA, 0x100, 0x3C1,
+		0x100, 0x3C2, 0x100, 0x398, 0x100, 0x3B5, 0x100, 0x3A3, 0x2, 0x415, 0x300, 0x2,
+		0x415, 0x308, 0x2, 0x413, 0x301, 0x2, 0x406, 0x308, 0x2, 0x41A, 0x301, 0x2,
+		0x418, 0x300, 0x2, 0x423, 0x306, 0x2, 0x418, 0x306, 0x2, 0x438, 0x306, 0x2,
+		0x435, 0x300, 0x2, 0x435, 0x308, 0x2, 0x433, 0x301, 0x2, 0x456, 0x308, 0x2,
+		0x43A, 0x301, 0x2, 0x438, 0x300, 0x2, 0x443, 0x306, 0x2, 0x474, 0x30F, 0x2,
+		0x475, 0x30F, 0x2, 0x416, 0x306, 0x2, 0x436, 0x306, 0x2, 0x410, 0x306, 0x2,
+		0x430, 0x306, 0x2, 0x410, 0x308, 0x2, 0x430, 0x308, 0x2, 0x415, 0x306, 0x2,
+		0x435, 0x306, 0x2, 0x4D8, 0x308, 0x2, 0x4D9, 0x308, 0x2, 0x416, 0x308, 0x2,
+		0x436, 0x308, 0x2, 0x417, 0x308, 0x2, 0x437, 0x308, 0x2, 0x418, 0x304, 0x2,
+		0x438, 0x304, 0x2, 0x418, 0x308, 0x2, 0x438, 0x308, 0x2, 0x41E, 0x308, 0x2,
+		0x43E, 0x308, 0x2, 0x4E8, 0x308, 0x2, 0x4E9, 0x308, 0x2, 0x42D, 0x308, 0x2,
+		0x44D, 0x308, 0x2, 0x423, 0x304, 0x2, 0x443, 0x304, 0x2, 0x423, 0x308, 0x2,
+		0x443, 0x308, 0x2, 0x423, 0x30B, 0x2, 0x443, 0x30B, 0x2, 0x427, 0x308, 0x2,
+		0x447, 0x308, 0x2, 0x42B, 0x308, 0x2, 0x44B, 0x308, 0x200, 0x565, 0x582, 0x2,
+		0x627, 0x653, 0x2, 0x627, 0x654, 0x2, 0x648, 0x654, 0x2, 0x627, 0x655, 0x2,
+		0x64A, 0x654, 0x200, 0x627, 0x674, 0x200, 0x648, 0x674, 0x200, 0x6C7, 0x674, 0x200,
+		0x64A, 0x674, 0x2, 0x6D5, 0x654, 0x2, 0x6C1, 0x654, 0x2, 0x6D2, 0x654, 0x2,
+		0x928, 0x93C, 0x2, 0x930, 0x93C, 0x2, 0x933, 0x93C, 0x2, 0x915, 0x93C, 0x2,
+		0x916, 0x93C, 0x2, 0x917, 0x93C, 0x2, 0x91C, 0x93C, 0x2, 0x921, 0x93C, 0x2,
+		0x922, 0x93C, 0x2, 0x92B, 0x93C, 0x2, 0x92F, 0x93C, 0x2, 0x9C7, 0x9BE, 0x2,
+		0x9C7, 0x9D7, 0x2, 0x9A1, 0x9BC, 0x2, 0x9A2, 0x9BC, 0x2, 0x9AF, 0x9BC, 0x2,
+		0xA32, 0xA3C, 0x2, 0xA38, 0xA3C, 0x2, 0xA16, 0xA3C, 0x2, 0xA17, 0xA3C, 0x2,
+		0xA1C, 0xA3C, 0x2, 0xA2B, 0xA3C, 0x2, 0xB47, 0xB56, 0x2, 0xB47, 0xB3E, 0x2,
+		0xB47, 0xB57, 0x2, 0xB21, 0xB3C, 0x2, 0xB22, 0xB3C, 0x2, 0xB92, 0xBD7, 0x2,
+		0xBC6, 0xBBE, 0x2, 0xBC7, 0xBBE, 0x2, 0xBC6, 0xBD7, 0x2, 0xC46, 0xC56, 0x2,
+		0xCBF, 0xCD5, 0x2, 0xCC6, 0xCD5, 0x2, 0xCC6, 0xCD6, 0x2, 0xCC6, 0xCC2, 0x3,
+		0xCC6, 0xCC2, 0xCD5, 0x2, 0xD46, 0xD3E, 0x2, 0xD47, 0xD3E, 0x2, 0xD46, 0xD57,
+		0x2, 0xDD9, 0xDCA, 0x2, 0xDD9, 0xDCF, 0x3, 0xDD9, 0xDCF, 0xDCA, 0x2, 0xDD9,
+		0xDDF, 0x200, 0xE4D, 0xE32, 0x200, 0xECD, 0xEB2, 0x200, 0xEAB, 0xE99, 0x200, 0xEAB,
+		0xEA1, 0x100, 0xF0B, 0x2, 0xF42, 0xFB7, 0x2, 0xF4C, 0xFB7, 0x2, 0xF51, 0xFB7,
+		0x2, 0xF56, 0xFB7, 0x2, 0xF5B, 0xFB7, 0x2, 0xF40, 0xFB5, 0x2, 0xF71, 0xF72,
+		0x2, 0xF71, 0xF74, 0x2, 0xFB2, 0xF80, 0x300, 0xFB2, 0xF71, 0xF80, 0x2, 0xFB3,
+		0xF80, 0x300, 0xFB3, 0xF71, 0xF80, 0x2, 0xF71, 0xF80, 0x2, 0xF92, 0xFB7, 0x2,
+		0xF9C, 0xFB7, 0x2, 0xFA1, 0xFB7, 0x2, 0xFA6, 0xFB7, 0x2, 0xFAB, 0xFB7, 0x2,
+		0xF90, 0xFB5, 0x2, 0x1025, 0x102E, 0x100, 0x10DC, 0x2, 0x1B05, 0x1B35, 0x2, 0x1B07,
+		0x1B35, 0x2, 0x1B09, 0x1B35, 0x2, 0x1B0B, 0x1B35, 0x2, 0x1B0D, 0x1B35, 0x2, 0x1B11,
+		0x1B35, 0x2, 0x1B3A, 0x1B35, 0x2, 0x1B3C, 0x1B35, 0x2, 0x1B3E, 0x1B35, 0x2, 0x1B3F,
+		0x1B35, 0x2, 0x1B42, 0x1B35, 0x100, 0x41, 0x100, 0xC6, 0x100, 0x42, 0x100, 0x44,
+		0x100, 0x45, 0x100, 0x18E, 0x100, 0x47, 0x100, 0x48, 0x100, 0x49, 0x100, 0x4A,
+		0x100, 0x4B, 0x100, 0x4C, 0x100, 0x4D, 0x100, 0x4E, 0x100, 0x4F, 0x100, 0x222,
+		0x100, 0x50, 0x100, 0x52, 0x100, 0x54, 0x100, 0x55, 0x100, 0x57, 0x100, 0x61,
+		0x100, 0x250, 0x100, 0x251, 0x100, 0x1D02, 0x100, 0x62, 0x100, 0x64, 0x100, 0x65,
+		0x100, 0x259, 0x100, 0x25B, 0x100, 0x25C, 0x100, 0x67, 0x100, 0x6B, 0x100, 0x6D,
+		0x100, 0x14B, 0x100, 0x6F, 0x100, 0x254, 0x100, 0x1D16, 0x100, 0x1D17, 0x100, 0x70,
+		0x100, 0x74, 0x100, 0x75, 0x100, 0x1D1D, 0x100, 0x26F, 0x100, 0x76, 0x100, 0x1D25,
+		0x100, 0x3B2, 0x100, 0x3B3, 0x100, 0x3B4, 0x100, 0x3C6, 0x100, 0x3C7, 0x100, 0x69,
+		0x100, 0x72, 0x100, 0x75, 0x100, 0x76, 0x100, 0x3B2, 0x100, 0x3B3, 0x100, 0x3C1,
+		0x100, 0x3C6, 0x100, 0x3C7, 0x100, 0x43D, 0x100, 0x252, 0x100, 0x63, 0x100, 0x255,
+		0x100, 0xF0, 0x100, 0x25C, 0x100, 0x66, 0x100, 0x25F, 0x100, 0x261, 0x100, 0x265,
+		0x100, 0x268, 0x100, 0x269, 0x100, 0x26A, 0x100, 0x1D7B, 0x100, 0x29D, 0x100, 0x26D,
+		0x100, 0x1D85, 0x100, 0x29F, 0x100, 0x271, 0x100, 0x270, 0x100, 0x272, 0x100, 0x273,
+		0x100, 0x274, 0x100, 0x275, 0x100, 0x278, 0x100, 0x282, 0x100, 0x283, 0x100, 0x1AB,
+		0x100, 0x289, 0x100, 0x28A, 0x100, 0x1D1C, 0x100, 0x28B, 0x100, 0x28C, 0x100, 0x7A,
+		0x100, 0x290, 0x100, 0x291, 0x100, 0x292, 0x100, 0x3B8, 0x2, 0x41, 0x325, 0x2,
+		0x61, 0x325, 0x2, 0x42, 0x307, 0x2, 0x62, 0x307, 0x2, 0x42, 0x323, 0x2,
+		0x62, 0x323, 0x2, 0x42, 0x331, 0x2, 0x62, 0x331, 0x3, 0x43, 0x327, 0x301,
+		0x3, 0x63, 0x327, 0x301, 0x2, 0x44, 0x307, 0x2, 0x64, 0x307, 0x2, 0x44,
+		0x323, 0x2, 0x64, 0x323, 0x2, 0x44, 0x331, 0x2, 0x64, 0x331, 0x2, 0x44,
+		0x327, 0x2, 0x64, 0x327, 0x2, 0x44, 0x32D, 0x2, 0x64, 0x32D, 0x3, 0x45,
+		0x304, 0x300, 0x3, 0x65, 0x304, 0x300, 0x3, 0x45, 0x304, 0x301, 0x3, 0x65,
+		0x304, 0x301, 0x2, 0x45, 0x32D, 0x2, 0x65, 0x32D, 0x2, 0x45, 0x330, 0x2,
+		0x65, 0x330, 0x3, 0x45, 0x327, 0x306, 0x3, 0x65, 0x327, 0x306, 0x2, 0x46,
+		0x307, 0x2, 0x66, 0x307, 0x2, 0x47, 0x304, 0x2, 0x67, 0x304, 0x2, 0x48,
+		0x307, 0x2, 0x68, 0x307, 0x2, 0x48, 0x323, 0x2, 0x68, 0x323, 0x2, 0x48,
+		0x308, 0x2, 0x68, 0x308, 0x2, 0x48, 0x327, 0x2, 0x68, 0x327, 0x2, 0x48,
+		0x32E, 0x2, 0x68, 0x32E, 0x2, 0x49, 0x330, 0x2, 0x69, 0x330, 0x3, 0x49,
+		0x308, 0x301, 0x3, 0x69, 0x308, 0x301, 0x2, 0x4B, 0x301, 0x2, 0x6B, 0x301,
+		0x2, 0x4B, 0x323, 0x2, 0x6B, 0x323, 0x2, 0x4B, 0x331, 0x2, 0x6B, 0x331,
+		0x2, 0x4C, 0x323, 0x2, 0x6C, 0x323, 0x3, 0x4C, 0x323, 0x304, 0x3, 0x6C,
+		0x323, 0x304, 0x2, 0x4C, 0x331, 0x2, 0x6C, 0x331, 0x2, 0x4C, 0x32D, 0x2,
+		0x6C, 0x32D, 0x2, 0x4D, 0x301, 0x2, 0x6D, 0x301, 0x2, 0x4D, 0x307, 0x2,
+		0x6D, 0x307, 0x2, 0x4D, 0x323, 0x2, 0x6D, 0x323, 0x2, 0x4E, 0x307, 0x2,
+		0x6E, 0x307, 0x2, 0x4E, 0x323, 0x2, 0x6E, 0x323, 0x2, 0x4E, 0x331, 0x2,
+		0x6E, 0x331, 0x2, 0x4E, 0x32D, 0x2, 0x6E, 0x32D, 0x3, 0x4F, 0x303, 0x301,
+		0x3, 0x6F, 0x303, 0x301, 0x3, 0x4F, 0x303, 0x308, 0x3, 0x6F, 0x303, 0x308,
+		0x3, 0x4F, 0x304, 0x300, 0x3, 0x6F, 0x304, 0x300, 0x3, 0x4F, 0x304, 0x301,
+		0x3, 0x6F, 0x304, 0x301, 0x2, 0x50, 0x301, 0x2, 0x70, 0x301, 0x2, 0x50,
+		0x307, 0x2, 0x70, 0x307, 0x2, 0x52, 0x307, 0x2, 0x72, 0x307, 0x2, 0x52,
+		0x323, 0x2, 0x72, 0x323, 0x3, 0x52, 0x323, 0x304, 0x3, 0x72, 0x323, 0x304,
+		0x2, 0x52, 0x331, 0x2, 0x72, 0x331, 0x2, 0x53, 0x307, 0x2, 0x73, 0x307,
+		0x2, 0x53, 0x323, 0x2, 0x73, 0x323, 0x3, 0x53, 0x301, 0x307, 0x3, 0x73,
+		0x301, 0x307, 0x3, 0x53, 0x30C, 0x307, 0x3, 0x73, 0x30C, 0x307, 0x3, 0x53,
+		0x323, 0x307, 0x3, 0x73, 0x323, 0x307, 0x2, 0x54, 0x307, 0x2, 0x74, 0x307,
+		0x2, 0x54, 0x323, 0x2, 0x74, 0x323, 0x2, 0x54, 0x331, 0x2, 0x74, 0x331,
+		0x2, 0x54, 0x32D, 0x2, 0x74, 0x32D, 0x2, 0x55, 0x324, 0x2, 0x75, 0x324,
+		0x2, 0x55, 0x330, 0x2, 0x75, 0x330, 0x2, 0x55, 0x32D, 0x2, 0x75, 0x32D,
+		0x3, 0x55, 0x303, 0x301, 0x3, 0x75, 0x303, 0x301, 0x3, 0x55, 0x304, 0x308,
+		0x3, 0x75, 0x304, 0x308, 0x2, 0x56, 0x303, 0x2, 0x76, 0x303, 0x2, 0x56,
+		0x323, 0x2, 0x76, 0x323, 0x2, 0x57, 0x300, 0x2, 0x77, 0x300, 0x2, 0x57,
+		0x301, 0x2, 0x77, 0x301, 0x2, 0x57, 0x308, 0x2, 0x77, 0x308, 0x2, 0x57,
+		0x307, 0x2, 0x77, 0x307, 0x2, 0x57, 0x323, 0x2, 0x77, 0x323, 0x2, 0x58,
+		0x307, 0x2, 0x78, 0x307, 0x2, 0x58, 0x308, 0x2, 0x78, 0x308, 0x2, 0x59,
+		0x307, 0x2, 0x79, 0x307, 0x2, 0x5A, 0x302, 0x2, 0x7A, 0x302, 0x2, 0x5A,
+		0x323, 0x2, 0x7A, 0x323, 0x2, 0x5A, 0x331, 0x2, 0x7A, 0x331, 0x2, 0x68,
+		0x331, 0x2, 0x74, 0x308, 0x2, 0x77, 0x30A, 0x2, 0x79, 0x30A, 0x200, 0x61,
+		0x2BE, 0x202, 0x17F, 0x307, 0x73, 0x307, 0x2, 0x41, 0x323, 0x2, 0x61, 0x323,
+		0x2, 0x41, 0x309, 0x2, 0x61, 0x309, 0x3, 0x41, 0x302, 0x301, 0x3, 0x61,
+		0x302, 0x301, 0x3, 0x41, 0x302, 0x300, 0x3, 0x61, 0x302, 0x300, 0x3, 0x41,
+		0x302, 0x309, 0x3, 0x61, 0x302, 0x309, 0x3, 0x41, 0x302, 0x303, 0x3, 0x61,
+		0x302, 0x303, 0x3, 0x41, 0x323, 0x302, 0x3, 0x61, 0x323, 0x302, 0x3, 0x41,
+		0x306, 0x301, 0x3, 0x61, 0x306, 0x301, 0x3, 0x41, 0x306, 0x300, 0x3, 0x61,
+		0x306, 0x300, 0x3, 0x41, 0x306, 0x309, 0x3, 0x61, 0x306, 0x309, 0x3, 0x41,
+		0x306, 0x303, 0x3, 0x61, 0x306, 0x303, 0x3, 0x41, 0x323, 0x306, 0x3, 0x61,
+		0x323, 0x306, 0x2, 0x45, 0x323, 0x2, 0x65, 0x323, 0x2, 0x45, 0x309, 0x2,
+		0x65, 0x309, 0x2, 0x45, 0x303, 0x2, 0x65, 0x303, 0x3, 0x45, 0x302, 0x301,
+		0x3, 0x65, 0x302, 0x301, 0x3, 0x45, 0x302, 0x300, 0x3, 0x65, 0x302, 0x300,
+		0x3, 0x45, 0x302, 0x309, 0x3, 0x65, 0x302, 0x309, 0x3, 0x45, 0x302, 0x303,
+		0x3, 0x65, 0x302, 0x303, 0x3, 0x45, 0x323, 0x302, 0x3, 0x65, 0x323, 0x302,
+		0x2, 0x49, 0x309, 0x2, 0x69, 0x309, 0x2, 0x49, 0x323, 0x2, 0x69, 0x323,
+		0x2, 0x4F, 0x323, 0x2, 0x6F, 0x323, 0x2, 0x4F, 0x309, 0x2, 0x6F, 0x309,
+		0x3, 0x4F, 0x302, 0x301, 0x3, 0x6F, 0x302, 0x301, 0x3, 0x4F, 0x302, 0x300,
+		0x3, 0x6F, 0x302, 0x300, 0x3, 0x4F, 0x302, 0x309, 0x3, 0x6F, 0x302, 0x309,
+		0x3, 0x4F, 0x302, 0x303, 0x3, 0x6F, 0x302, 0x303, 0x3, 0x4F, 0x323, 0x302,
+		0x3, 0x6F, 0x323, 0x302, 0x3, 0x4F, 0x31B, 0x301, 0x3, 0x6F, 0x31B, 0x301,
+		0x3, 0x4F, 0x31B, 0x300, 0x3, 0x6F, 0x31B, 0x300, 0x3, 0x4F, 0x31B, 0x309,
+		0x3, 0x6F, 0x31B, 0x309, 0x3, 0x4F, 0x31B, 0x303, 0x3, 0x6F, 0x31B, 0x303,
+		0x3, 0x4F, 0x31B, 0x323, 0x3, 0x6F, 0x31B, 0x323, 0x2, 0x55, 0x323, 0x2,
+		0x75, 0x323, 0x2, 0x55, 0x309, 0x2, 0x75, 0x309, 0x3, 0x55, 0x31B, 0x301,
+		0x3, 0x75, 0x31B, 0x301, 0x3, 0x55, 0x31B, 0x300, 0x3, 0x75, 0x31B, 0x300,
+		0x3, 0x55, 0x31B, 0x309, 0x3, 0x75, 0x31B, 0x309, 0x3, 0x55, 0x31B, 0x303,
+		0x3, 0x75, 0x31B, 0x303, 0x3, 0x55, 0x31B, 0x323, 0x3, 0x75, 0x31B, 0x323,
+		0x2, 0x59, 0x300, 0x2, 0x79, 0x300, 0x2, 0x59, 0x323, 0x2, 0x79, 0x323,
+		0x2, 0x59, 0x309, 0x2, 0x79, 0x309, 0x2, 0x59, 0x303, 0x2, 0x79, 0x303,
+		0x2, 0x3B1, 0x313, 0x2, 0x3B1, 0x314, 0x3, 0x3B1, 0x313, 0x300, 0x3, 0x3B1,
+		0x314, 0x300, 0x3, 0x3B1, 0x313, 0x301, 0x3, 0x3B1, 0x314, 0x301, 0x3, 0x3B1,
+		0x313, 0x342, 0x3, 0x3B1, 0x314, 0x342, 0x2, 0x391, 0x313, 0x2, 0x391, 0x314,
+		0x3, 0x391, 0x313, 0x300, 0x3, 0x391, 0x314, 0x300, 0x3, 0x391, 0x313, 0x301,
+		0x3, 0x391, 0x314, 0x301, 0x3, 0x391, 0x313, 0x342, 0x3, 0x391, 0x314, 0x342,
+		0x2, 0x3B5, 0x313, 0x2, 0x3B5, 0x314, 0x3, 0x3B5, 0x313, 0x300, 0x3, 0x3B5,
+		0x314, 0x300, 0x3, 0x3B5, 0x313, 0x301, 0x3, 0x3B5, 0x314, 0x301, 0x2, 0x395,
+		0x313, 0x2, 0x395, 0x314, 0x3, 0x395, 0x313, 0x300, 0x3, 0x395, 0x314, 0x300,
+		0x3, 0x395, 0x313, 0x301, 0x3, 0x395, 0x314, 0x301, 0x2, 0x3B7, 0x313, 0x2,
+		0x3B7, 0x314, 0x3, 0x3B7, 0x313, 0x300, 0x3, 0x3B7, 0x314, 0x300, 0x3, 0x3B7,
+		0x313, 0x301, 0x3, 0x3B7, 0x314, 0x301, 0x3, 0x3B7, 0x313, 0x342, 0x3, 0x3B7,
+		0x314, 0x342, 0x2, 0x397, 0x313, 0x2, 0x397, 0x314, 0x3, 0x397, 0x313, 0x300,
+		0x3, 0x397, 0x314, 0x300, 0x3, 0x397, 0x313, 0x301, 0x3, 0x397, 0x314, 0x301,
+		0x3, 0x397, 0x313, 0x342, 0x3, 0x397, 0x314, 0x342, 0x2, 0x3B9, 0x313, 0x2,
+		0x3B9, 0x314, 0x3, 0x3B9, 0x313, 0x300, 0x3, 0x3B9, 0x314, 0x300, 0x3, 0x3B9,
+		0x313, 0x301, 0x3, 0x3B9, 0x314, 0x301, 0x3, 0x3B9, 0x313, 0x342, 0x3, 0x3B9,
+		0x314, 0x342, 0x2, 0x399, 0x313, 0x2, 0x399, 0x314, 0x3, 0x399, 0x313, 0x300,
+		0x3, 0x399, 0x314, 0x300, 0x3, 0x399, 0x313, 0x301, 0x3, 0x399, 0x314, 0x301,
+		0x3, 0x399, 0x313, 0x342, 0x3, 0x399, 0x314, 0x342, 0x2, 0x3BF, 0x313, 0x2,
+		0x3BF, 0x314, 0x3, 0x3BF, 0x313, 0x300, 0x3, 0x3BF, 0x314, 0x300, 0x3, 0x3BF,
+		0x313, 0x301, 0x3, 0x3BF, 0x314, 0x301, 0x2, 0x39F, 0x313, 0x2, 0x39F, 0x314,
+		0x3, 0x39F, 0x313, 0x300, 0x3, 0x39F, 0x314, 0x300, 0x3, 0x39F, 0x313, 0x301,
+		0x3, 0x39F, 0x314, 0x301, 0x2, 0x3C5, 0x313, 0x2, 0x3C5, 0x314, 0x3, 0x3C5,
+		0x313, 0x300, 0x3, 0x3C5, 0x314, 0x300, 0x3, 0x3C5, 0x313, 0x301, 0x3, 0x3C5,
+		0x314, 0x301, 0x3, 0x3C5, 0x313, 0x342, 0x3, 0x3C5, 0x314, 0x342, 0x2, 0x3A5,
+		0x314, 0x3, 0x3A5, 0x314, 0x300, 0x3, 0x3A5, 0x314, 0x301, 0x3, 0x3A5, 0x314,
+		0x342, 0x2, 0x3C9, 0x313, 0x2, 0x3C9, 0x314, 0x3, 0x3C9, 0x313, 0x300, 0x3,
+		0x3C9, 0x314, 0x300, 0x3, 0x3C9, 0x313, 0x301, 0x3, 0x3C9, 0x314, 0x301, 0x3,
+		0x3C9, 0x313, 0x342, 0x3, 0x3C9, 0x314, 0x342, 0x2, 0x3A9, 0x313, 0x2, 0x3A9,
+		0x314, 0x3, 0x3A9, 0x313, 0x300, 0x3, 0x3A9, 0x314, 0x300, 0x3, 0x3A9, 0x313,
+		0x301, 0x3, 0x3A9, 0x314, 0x301, 0x3, 0x3A9, 0x313, 0x342, 0x3, 0x3A9, 0x314,
+		0x342, 0x2, 0x3B1, 0x300, 0x2, 0x3B1, 0x301, 0x2, 0x3B5, 0x300, 0x2, 0x3B5,
+		0x301, 0x2, 0x3B7, 0x300, 0x2, 0x3B7, 0x301, 0x2, 0x3B9, 0x300, 0x2, 0x3B9,
+		0x301, 0x2, 0x3BF, 0x300, 0x2, 0x3BF, 0x301, 0x2, 0x3C5, 0x300, 0x2, 0x3C5,
+		0x301, 0x2, 0x3C9, 0x300, 0x2, 0x3C9, 0x301, 0x3, 0x3B1, 0x313, 0x345, 0x3,
+		0x3B1, 0x314, 0x345, 0x4, 0x3B1, 0x313, 0x300, 0x345, 0x4, 0x3B1, 0x314, 0x300,
+		0x345, 0x4, 0x3B1, 0x313, 0x301, 0x345, 0x4, 0x3B1, 0x314, 0x301, 0x345, 0x4,
+		0x3B1, 0x313, 0x342, 0x345, 0x4, 0x3B1, 0x314, 0x342, 0x345, 0x3, 0x391, 0x313,
+		0x345, 0x3, 0x391, 0x314, 0x345, 0x4, 0x391, 0x313, 0x300, 0x345, 0x4, 0x391,
+		0x314, 0x300, 0x345, 0x4, 0x391, 0x313, 0x301, 0x345, 0x4, 0x391, 0x314, 0x301,
+		0x345, 0x4, 0x391, 0x313, 0x342, 0x345, 0x4, 0x391, 0x314, 0x342, 0x345, 0x3,
+		0x3B7, 0x313, 0x345, 0x3, 0x3B7, 0x314, 0x345, 0x4, 0x3B7, 0x313, 0x300, 0x345,
+		0x4, 0x3B7, 0x314, 0x300, 0x345, 0x4, 0x3B7, 0x313, 0x301, 0x345, 0x4, 0x3B7,
+		0x314, 0x301, 0x345, 0x4, 0x3B7, 0x313, 0x342, 0x345, 0x4, 0x3B7, 0x314, 0x342,
+		0x345, 0x3, 0x397, 0x313, 0x345, 0x3, 0x397, 0x314, 0x345, 0x4, 0x397, 0x313,
+		0x300, 0x345, 0x4, 0x397, 0x314, 0x300, 0x345, 0x4, 0x397, 0x313, 0x301, 0x345,
+		0x4, 0x397, 0x314, 0x301, 0x345, 0x4, 0x397, 0x313, 0x342, 0x345, 0x4, 0x397,
+		0x314, 0x342, 0x345, 0x3, 0x3C9, 0x313, 0x345, 0x3, 0x3C9, 0x314, 0x345, 0x4,
+		0x3C9, 0x313, 0x300, 0x345, 0x4, 0x3C9, 0x314, 0x300, 0x345, 0x4, 0x3C9, 0x313,
+		0x301, 0x345, 0x4, 0x3C9, 0x314, 0x301, 0x345, 0x4, 0x3C9, 0x313, 0x342, 0x345,
+		0x4, 0x3C9, 0x314, 0x342, 0x345, 0x3, 0x3A9, 0x313, 0x345, 0x3, 0x3A9, 0x314,
+		0x345, 0x4, 0x3A9, 0x313, 0x300, 0x345, 0x4, 0x3A9, 0x314, 0x300, 0x345, 0x4,
+		0x3A9, 0x313, 0x301, 0x345, 0x4, 0x3A9, 0x314, 0x301, 0x345, 0x4, 0x3A9, 0x313,
+		0x342, 0x345, 0x4, 0x3A9, 0x314, 0x342, 0x345, 0x2, 0x3B1, 0x306, 0x2, 0x3B1,
+		0x304, 0x3, 0x3B1, 0x300, 0x345, 0x2, 0x3B1, 0x345, 0x3, 0x3B1, 0x301, 0x345,
+		0x2, 0x3B1, 0x342, 0x3, 0x3B1, 0x342, 0x345, 0x2, 0x391, 0x306, 0x2, 0x391,
+		0x304, 0x2, 0x391, 0x300, 0x2, 0x391, 0x301, 0x2, 0x391, 0x345, 0x200, 0x20,
+		0x313, 0x1, 0x3B9, 0x200, 0x20, 0x313, 0x200, 0x20, 0x342, 0x302, 0xA8, 0x342,
+		0x20, 0x308, 0x342, 0x3, 0x3B7, 0x300, 0x345, 0x2, 0x3B7, 0x345, 0x3, 0x3B7,
+		0x301, 0x345, 0x2, 0x3B7, 0x342, 0x3, 0x3B7, 0x342, 0x345, 0x2, 0x395, 0x300,
+		0x2, 0x395, 0x301, 0x2, 0x397, 0x300, 0x2, 0x397, 0x301, 0x2, 0x397, 0x345,
+		0x302, 0x1FBF, 0x300, 0x20, 0x313, 0x300, 0x302, 0x1FBF, 0x301, 0x20, 0x313, 0x301,
+		0x302, 0x1FBF, 0x342, 0x20, 0x313, 0x342, 0x2, 0x3B9, 0x306, 0x2, 0x3B9, 0x304,
+		0x3, 0x3B9, 0x308, 0x300, 0x3, 0x3B9, 0x308, 0x301, 0x2, 0x3B9, 0x342, 0x3,
+		0x3B9, 0x308, 0x342, 0x2, 0x399, 0x306, 0x2, 0x399, 0x304, 0x2, 0x399, 0x300,
+		0x2, 0x399, 0x301, 0x302, 0x1FFE, 0x300, 0x20, 0x314, 0x300, 0x302, 0x1FFE, 0x301,
+		0x20, 0x314, 0x301, 0x302, 0x1FFE, 0x342, 0x20, 0x314, 0x342, 0x2, 0x3C5, 0x306,
+		0x2, 0x3C5, 0x304, 0x3, 0x3C5, 0x308, 0x300, 0x3, 0x3C5, 0x308, 0x301, 0x2,
+		0x3C1, 0x313, 0x2, 0x3C1, 0x314, 0x2, 0x3C5, 0x342, 0x3, 0x3C5, 0x308, 0x342,
+		0x2, 0x3A5, 0x306, 0x2, 0x3A5, 0x304, 0x2, 0x3A5, 0x300, 0x2, 0x3A5, 0x301,
+		0x2, 0x3A1, 0x314, 0x302, 0xA8, 0x300, 0x20, 0x308, 0x300, 0x302, 0xA8, 0x301,
+		0x20, 0x308, 0x301, 0x1, 0x60, 0x3, 0x3C9, 0x300, 0x345, 0x2, 0x3C9, 0x345,
+		0x3, 0x3C9, 0x301, 0x345, 0x2, 0x3C9, 0x342, 0x3, 0x3C9, 0x342, 0x345, 0x2,
+		0x39F, 0x300, 0x2, 0x39F, 0x301, 0x2, 0x3A9, 0x300, 0x2, 0x3A9, 0x301, 0x2,
+		0x3A9, 0x345, 0x201, 0xB4, 0x20, 0x301, 0x200, 0x20, 0x314, 0x101, 0x2002, 0x20,
+		0x101, 0x2003, 0x20, 0x100, 0x20, 0x100, 0x20, 0x100, 0x20, 0x100, 0x20, 0x100,
+		0x20, 0x100, 0x20, 0x100, 0x20, 0x100, 0x20, 0x100, 0x20, 0x100, 0x2010, 0x200,
+		0x20, 0x333, 0x100, 0x2E, 0x200, 0x2E, 0x2E, 0x300, 0x2E, 0x2E, 0x2E, 0x100,
+		0x20, 0x200, 0x2032, 0x2032, 0x300, 0x2032, 0x2032, 0x2032, 0x200, 0x2035, 0x2035, 0x300,
+		0x2035, 0x2035, 0x2035, 0x200, 0x21, 0x21, 0x200, 0x20, 0x305, 0x200, 0x3F, 0x3F,
+		0x200, 0x3F, 0x21, 0x200, 0x21, 0x3F, 0x400, 0x2032, 0x2032, 0x2032, 0x2032, 0x100,
+		0x20, 0x100, 0x30, 0x100, 0x69, 0x100, 0x34, 0x100, 0x35, 0x100, 0x36, 0x100,
+		0x37, 0x100, 0x38, 0x100, 0x39, 0x100, 0x2B, 0x100, 0x2212, 0x100, 0x3D, 0x100,
+		0x28, 0x100, 0x29, 0x100, 0x6E, 0x100, 0x30, 0x100, 0x31, 0x100, 0x32, 0x100,
+		0x33, 0x100, 0x34, 0x100, 0x35, 0x100, 0x36, 0x100, 0x37, 0x100, 0x38, 0x100,
+		0x39, 0x100, 0x2B, 0x100, 0x2212, 0x100, 0x3D, 0x100, 0x28, 0x100, 0x29, 0x100,
+		0x61, 0x100, 0x65, 0x100, 0x6F, 0x100, 0x78, 0x100, 0x259, 0x100, 0x68, 0x100,
+		0x6B, 0x100, 0x6C, 0x100, 0x6D, 0x100, 0x6E, 0x100, 0x70, 0x100, 0x73, 0x100,
+		0x74, 0x200, 0x52, 0x73, 0x300, 0x61, 0x2F, 0x63, 0x300, 0x61, 0x2F, 0x73,
+		0x100, 0x43, 0x200, 0xB0, 0x43, 0x300, 0x63, 0x2F, 0x6F, 0x300, 0x63, 0x2F,
+		0x75, 0x100, 0x190, 0x200, 0xB0, 0x46, 0x100, 0x67, 0x100, 0x48, 0x100, 0x48,
+		0x100, 0x48, 0x100, 0x68, 0x100, 0x127, 0x100, 0x49, 0x100, 0x49, 0x100, 0x4C,
+		0x100, 0x6C, 0x100, 0x4E, 0x200, 0x4E, 0x6F, 0x100, 0x50, 0x100, 0x51, 0x100,
+		0x52, 0x100, 0x52, 0x100, 0x52, 0x200, 0x53, 0x4D, 0x300, 0x54, 0x45, 0x4C,
+		0x200, 0x54, 0x4D, 0x100, 0x5A, 0x1, 0x3A9, 0x100, 0x5A, 0x1, 0x4B, 0x2,
+		0x41, 0x30A, 0x100, 0x42, 0x100, 0x43, 0x100, 0x65, 0x100, 0x45, 0x100, 0x46,
+		0x100, 0x4D, 0x100, 0x6F, 0x100, 0x5D0, 0x100, 0x5D1, 0x100, 0x5D2, 0x100, 0x5D3,
+		0x100, 0x69, 0x300, 0x46, 0x41, 0x58, 0x100, 0x3C0, 0x100, 0x3B3, 0x100, 0x393,
+		0x100, 0x3A0, 0x100, 0x2211, 0x100, 0x44, 0x100, 0x64, 0x100, 0x65, 0x100, 0x69,
+		0x100, 0x6A, 0x300, 0x31, 0x2044, 0x37, 0x300, 0x31, 0x2044, 0x39, 0x400, 0x31,
+		0x2044, 0x31, 0x30, 0x300, 0x31, 0x2044, 0x33, 0x300, 0x32, 0x2044, 0x33, 0x300,
+		0x31, 0x2044, 0x35, 0x300, 0x32, 0x2044, 0x35, 0x300, 0x33, 0x2044, 0x35, 0x300,
+		0x34, 0x2044, 0x35, 0x300, 0x31, 0x2044, 0x36, 0x300, 0x35, 0x2044, 0x36, 0x300,
+		0x31, 0x2044, 0x38, 0x300, 0x33, 0x2044, 0x38, 0x300, 0x35, 0x2044, 0x38, 0x300,
+		0x37, 0x2044, 0x38, 0x200, 0x31, 0x2044, 0x100, 0x49, 0x200, 0x49, 0x49, 0x300,
+		0x49, 0x49, 0x49, 0x200, 0x49, 0x56, 0x100, 0x56, 0x200, 0x56, 0x49, 0x300,
+		0x56, 0x49, 0x49, 0x400, 0x56, 0x49, 0x49, 0x49, 0x200, 0x49, 0x58, 0x100,
+		0x58, 0x200, 0x58, 0x49, 0x300, 0x58, 0x49, 0x49, 0x100, 0x4C, 0x100, 0x43,
+		0x100, 0x44, 0x100, 0x4D, 0x100, 0x69, 0x200, 0x69, 0x69, 0x300, 0x69, 0x69,
+		0x69, 0x200, 0x69, 0x76, 0x100, 0x76, 0x200, 0x76, 0x69, 0x300, 0x76, 0x69,
+		0x69, 0x400, 0x76, 0x69, 0x69, 0x69, 0x200, 0x69, 0x78, 0x100, 0x78, 0x200,
+		0x78, 0x69, 0x300, 0x78, 0x69, 0x69, 0x100, 0x6C, 0x100, 0x63, 0x100, 0x64,
+		0x100, 0x6D, 0x300, 0x30, 0x2044, 0x33, 0x2, 0x2190, 0x338, 0x2, 0x2192, 0x338,
+		0x2, 0x2194, 0x338, 0x2, 0x21D0, 0x338, 0x2, 0x21D4, 0x338, 0x2, 0x21D2, 0x338,
+		0x2, 0x2203, 0x338, 0x2, 0x2208, 0x338, 0x2, 0x220B, 0x338, 0x2, 0x2223, 0x338,
+		0x2, 0x2225, 0x338, 0x200, 0x222B, 0x222B, 0x300, 0x222B, 0x222B, 0x222B, 0x200, 0x222E,
+		0x222E, 0x300, 0x222E, 0x222E, 0x222E, 0x2, 0x223C, 0x338, 0x2, 0x2243, 0x338, 0x2,
+		0x2245, 0x338, 0x2, 0x2248, 0x338, 0x2, 0x3D, 0x338, 0x2, 0x2261, 0x338, 0x2,
+		0x224D, 0x338, 0x2, 0x3C, 0x338, 0x2, 0x3E, 0x338, 0x2, 0x2264, 0x338, 0x2,
+		0x2265, 0x338, 0x2, 0x2272, 0x338, 0x2, 0x2273, 0x338, 0x2, 0x2276, 0x338, 0x2,
+		0x2277, 0x338, 0x2, 0x227A, 0x338, 0x2, 0x227B, 0x338, 0x2, 0x2282, 0x338, 0x2,
+		0x2283, 0x338, 0x2, 0x2286, 0x338, 0x2, 0x2287, 0x338, 0x2, 0x22A2, 0x338, 0x2,
+		0x22A8, 0x338, 0x2, 0x22A9, 0x338, 0x2, 0x22AB, 0x338, 0x2, 0x227C, 0x338, 0x2,
+		0x227D, 0x338, 0x2, 0x2291, 0x338, 0x2, 0x2292, 0x338, 0x2, 0x22B2, 0x338, 0x2,
+		0x22B3, 0x338, 0x2, 0x22B4, 0x338, 0x2, 0x22B5, 0x338, 0x1, 0x3008, 0x1, 0x3009,
+		0x100, 0x31, 0x100, 0x32, 0x100, 0x33, 0x100, 0x34, 0x100, 0x35, 0x100, 0x36,
+		0x100, 0x37, 0x100, 0x38, 0x100, 0x39, 0x200, 0x31, 0x30, 0x200, 0x31, 0x31,
+		0x200, 0x31, 0x32, 0x200, 0x31, 0x33, 0x200, 0x31, 0x34, 0x200, 0x31, 0x35,
+		0x200, 0x31, 0x36, 0x200, 0x31, 0x37, 0x200, 0x31, 0x38, 0x200, 0x31, 0x39,
+		0x200, 0x32, 0x30, 0x300, 0x28, 0x31, 0x29, 0x300, 0x28, 0x32, 0x29, 0x300,
+		0x28, 0x33, 0x29, 0x300, 0x28, 0x34, 0x29, 0x300, 0x28, 0x35, 0x29, 0x300,
+		0x28, 0x36, 0x29, 0x300, 0x28, 0x37, 0x29, 0x300, 0x28, 0x38, 0x29, 0x300,
+		0x28, 0x39, 0x29, 0x400, 0x28, 0x31, 0x30, 0x29, 0x400, 0x28, 0x31, 0x31,
+		0x29, 0x400, 0x28, 0x31, 0x32, 0x29, 0x400, 0x28, 0x31, 0x33, 0x29, 0x400,
+		0x28, 0x31, 0x34, 0x29, 0x400, 0x28, 0x31, 0x35, 0x29, 0x400, 0x28, 0x31,
+		0x36, 0x29, 0x400, 0x28, 0x31, 0x37, 0x29, 0x400, 0x28, 0x31, 0x38, 0x29,
+		0x400, 0x28, 0x31, 0x39, 0x29, 0x400, 0x28, 0x32, 0x30, 0x29, 0x200, 0x31,
+		0x2E, 0x200, 0x32, 0x2E, 0x200, 0x33, 0x2E, 0x200, 0x34, 0x2E, 0x200, 0x35,
+		0x2E, 0x200, 0x36, 0x2E, 0x200, 0x37, 0x2E, 0x200, 0x38, 0x2E, 0x200, 0x39,
+		0x2E, 0x300, 0x31, 0x30, 0x2E, 0x300, 0x31, 0x31, 0x2E, 0x300, 0x31, 0x32,
+		0x2E, 0x300, 0x31, 0x33, 0x2E, 0x300, 0x31, 0x34, 0x2E, 0x300, 0x31, 0x35,
+		0x2E, 0x300, 0x31, 0x36, 0x2E, 0x300, 0x31, 0x37, 0x2E, 0x300, 0x31, 0x38,
+		0x2E, 0x300, 0x31, 0x39, 0x2E, 0x300, 0x32, 0x30, 0x2E, 0x300, 0x28, 0x61,
+		0x29, 0x300, 0x28, 0x62, 0x29, 0x300, 0x28, 0x63, 0x29, 0x300, 0x28, 0x64,
+		0x29, 0x300, 0x28, 0x65, 0x29, 0x300, 0x28, 0x66, 0x29, 0x300, 0x28, 0x67,
+		0x29, 0x300, 0x28, 0x68, 0x29, 0x300, 0x28, 0x69, 0x29, 0x300, 0x28, 0x6A,
+		0x29, 0x300, 0x28, 0x6B, 0x29, 0x300, 0x28, 0x6C, 0x29, 0x300, 0x28, 0x6D,
+		0x29, 0x300, 0x28, 0x6E, 0x29, 0x300, 0x28, 0x6F, 0x29, 0x300, 0x28, 0x70,
+		0x29, 0x300, 0x28, 0x71, 0x29, 0x300, 0x28, 0x72, 0x29, 0x300, 0x28, 0x73,
+		0x29, 0x300, 0x28, 0x74, 0x29, 0x300, 0x28, 0x75, 0x29, 0x300, 0x28, 0x76,
+		0x29, 0x300, 0x28, 0x77, 0x29, 0x300, 0x28, 0x78, 0x29, 0x300, 0x28, 0x79,
+		0x29, 0x300, 0x28, 0x7A, 0x29, 0x100, 0x41, 0x100, 0x42, 0x100, 0x43, 0x100,
+		0x44, 0x100, 0x45, 0x100, 0x46, 0x100, 0x47, 0x100, 0x48, 0x100, 0x49, 0x100,
+		0x4A, 0x100, 0x4B, 0x100, 0x4C, 0x100, 0x4D, 0x100, 0x4E, 0x100, 0x4F, 0x100,
+		0x50, 0x100, 0x51, 0x100, 0x52, 0x100, 0x53, 0x100, 0x54, 0x100, 0x55, 0x100,
+		0x56, 0x100, 0x57, 0x100, 0x58, 0x100, 0x59, 0x100, 0x5A, 0x100, 0x61, 0x100,
+		0x62, 0x100, 0x63, 0x100, 0x64, 0x100, 0x65, 0x100, 0x66, 0x100, 0x67, 0x100,
+		0x68, 0x100, 0x69, 0x100, 0x6A, 0x100, 0x6B, 0x100, 0x6C, 0x100, 0x6D, 0x100,
+		0x6E, 0x100, 0x6F, 0x100, 0x70, 0x100, 0x71, 0x100, 0x72, 0x100, 0x73, 0x100,
+		0x74, 0x100, 0x75, 0x100, 0x76, 0x100, 0x77, 0x100, 0x78, 0x100, 0x79, 0x100,
+		0x7A, 0x100, 0x30, 0x400, 0x222B, 0x222B, 0x222B, 0x222B, 0x300, 0x3A, 0x3A, 0x3D,
+		0x200, 0x3D, 0x3D, 0x300, 0x3D, 0x3D, 0x3D, 0x2, 0x2ADD, 0x338, 0x100, 0x6A,
+		0x100, 0x56, 0x100, 0x2D61, 0x100, 0x6BCD, 0x100, 0x9F9F, 0x100, 0x4E00, 0x100, 0x4E28,
+		0x100, 0x4E36, 0x100, 0x4E3F, 0x100, 0x4E59, 0x100, 0x4E85, 0x100, 0x4E8C, 0x100, 0x4EA0,
+		0x100, 0x4EBA, 0x100, 0x513F, 0x100, 0x5165, 0x100, 0x516B, 0x100, 0x5182, 0x100, 0x5196,
+		0x100, 0x51AB, 0x100, 0x51E0, 0x100, 0x51F5, 0x100, 0x5200, 0x100, 0x529B, 0x100, 0x52F9,
+		0x100, 0x5315, 0x100, 0x531A, 0x100, 0x5338, 0x100, 0x5341, 0x100, 0x535C, 0x100, 0x5369,
+		0x100, 0x5382, 0x100, 0x53B6, 0x100, 0x53C8, 0x100, 0x53E3, 0x100, 0x56D7, 0x100, 0x571F,
+		0x100, 0x58EB, 0x100, 0x5902, 0x100, 0x590A, 0x100, 0x5915, 0x100, 0x5927, 0x100, 0x5973,
+		0x100, 0x5B50, 0x100, 0x5B80, 0x100, 0x5BF8, 0x100, 0x5C0F, 0x100, 0x5C22, 0x100, 0x5C38,
+		0x100, 0x5C6E, 0x100, 0x5C71, 0x100, 0x5DDB, 0x100, 0x5DE5, 0x100, 0x5DF1, 0x100, 0x5DFE,
+		0x100, 0x5E72, 0x100, 0x5E7A, 0x100, 0x5E7F, 0x100, 0x5EF4, 0x100, 0x5EFE, 0x100, 0x5F0B,
+		0x100, 0x5F13, 0x100, 0x5F50, 0x100, 0x5F61, 0x100, 0x5F73, 0x100, 0x5FC3, 0x100, 0x6208,
+		0x100, 0x6236, 0x100, 0x624B, 0x100, 0x652F, 0x100, 0x6534, 0x100, 0x6587, 0x100, 0x6597,
+		0x100, 0x65A4, 0x100, 0x65B9, 0x100, 0x65E0, 0x100, 0x65E5, 0x100, 0x66F0, 0x100, 0x6708,
+		0x100, 0x6728, 0x100, 0x6B20, 0x100, 0x6B62, 0x100, 0x6B79, 0x100, 0x6BB3, 0x100, 0x6BCB,
+		0x100, 0x6BD4, 0x100, 0x6BDB, 0x100, 0x6C0F, 0x100, 0x6C14, 0x100, 0x6C34, 0x100, 0x706B,
+		0x100, 0x722A, 0x100, 0x7236, 0x100, 0x723B, 0x100, 0x723F, 0x100, 0x7247, 0x100, 0x7259,
+		0x100, 0x725B, 0x100, 0x72AC, 0x100, 0x7384, 0x100, 0x7389, 0x100, 0x74DC, 0x100, 0x74E6,
+		0x100, 0x7518, 0x100, 0x751F, 0x100, 0x7528, 0x100, 0x7530, 0x100, 0x758B, 0x100, 0x7592,
+		0x100, 0x7676, 0x100, 0x767D, 0x100, 0x76AE, 0x100, 0x76BF, 0x100, 0x76EE, 0x100, 0x77DB,
+		0x100, 0x77E2, 0x100, 0x77F3, 0x100, 0x793A, 0x100, 0x79B8, 0x100, 0x79BE, 0x100, 0x7A74,
+		0x100, 0x7ACB, 0x100, 0x7AF9, 0x100, 0x7C73, 0x100, 0x7CF8, 0x100, 0x7F36, 0x100, 0x7F51,
+		0x100, 0x7F8A, 0x100, 0x7FBD, 0x100, 0x8001, 0x100, 0x800C, 0x100, 0x8012, 0x100, 0x8033,
+		0x100, 0x807F, 0x100, 0x8089, 0x100, 0x81E3, 0x100, 0x81EA, 0x100, 0x81F3, 0x100, 0x81FC,
+		0x100, 0x820C, 0x100, 0x821B, 0x100, 0x821F, 0x100, 0x826E, 0x100, 0x8272, 0x100, 0x8278,
+		0x100, 0x864D, 0x100, 0x866B, 0x100, 0x8840, 0x100, 0x884C, 0x100, 0x8863, 0x100, 0x897E,
+		0x100, 0x898B, 0x100, 0x89D2, 0x100, 0x8A00, 0x100, 0x8C37, 0x100, 0x8C46, 0x100, 0x8C55,
+		0x100, 0x8C78, 0x100, 0x8C9D, 0x100, 0x8D64, 0x100, 0x8D70, 0x100, 0x8DB3, 0x100, 0x8EAB,
+		0x100, 0x8ECA, 0x100, 0x8F9B, 0x100, 0x8FB0, 0x100, 0x8FB5, 0x100, 0x9091, 0x100, 0x9149,
+		0x100, 0x91C6, 0x100, 0x91CC, 0x100, 0x91D1, 0x100, 0x9577, 0x100, 0x9580, 0x100, 0x961C,
+		0x100, 0x96B6, 0x100, 0x96B9, 0x100, 0x96E8, 0x100, 0x9751, 0x100, 0x975E, 0x100, 0x9762,
+		0x100, 0x9769, 0x100, 0x97CB, 0x100, 0x97ED, 0x100, 0x97F3, 0x100, 0x9801, 0x100, 0x98A8,
+		0x100, 0x98DB, 0x100, 0x98DF, 0x100, 0x9996, 0x100, 0x9999, 0x100, 0x99AC, 0x100, 0x9AA8,
+		0x100, 0x9AD8, 0x100, 0x9ADF, 0x100, 0x9B25, 0x100, 0x9B2F, 0x100, 0x9B32, 0x100, 0x9B3C,
+		0x100, 0x9B5A, 0x100, 0x9CE5, 0x100, 0x9E75, 0x100, 0x9E7F, 0x100, 0x9EA5, 0x100, 0x9EBB,
+		0x100, 0x9EC3, 0x100, 0x9ECD, 0x100, 0x9ED1, 0x100, 0x9EF9, 0x100, 0x9EFD, 0x100, 0x9F0E,
+		0x100, 0x9F13, 0x100, 0x9F20, 0x100, 0x9F3B, 0x100, 0x9F4A, 0x100, 0x9F52, 0x100, 0x9F8D,
+		0x100, 0x9F9C, 0x100, 0x9FA0, 0x100, 0x20, 0x100, 0x3012, 0x100, 0x5341, 0x100, 0x5344,
+		0x100, 0x5345, 0x2, 0x304B, 0x3099, 0x2, 0x304D, 0x3099, 0x2, 0x304F, 0x3099, 0x2,
+		0x3051, 0x3099, 0x2, 0x3053, 0x3099, 0x2, 0x3055, 0x3099, 0x2, 0x3057, 0x3099, 0x2,
+		0x3059, 0x3099, 0x2, 0x305B, 0x3099, 0x2, 0x305D, 0x3099, 0x2, 0x305F, 0x3099, 0x2,
+		0x3061, 0x3099, 0x2, 0x3064, 0x3099, 0x2, 0x3066, 0x3099, 0x2, 0x3068, 0x3099, 0x2,
+		0x306F, 0x3099, 0x2, 0x306F, 0x309A, 0x2, 0x3072, 0x3099, 0x2, 0x3072, 0x309A, 0x2,
+		0x3075, 0x3099, 0x2, 0x3075, 0x309A, 0x2, 0x3078, 0x3099, 0x2, 0x3078, 0x309A, 0x2,
+		0x307B, 0x3099, 0x2, 0x307B, 0x309A, 0x2, 0x3046, 0x3099, 0x200, 0x20, 0x3099, 0x200,
+		0x20, 0x309A, 0x2, 0x309D, 0x3099, 0x200, 0x3088, 0x308A, 0x2, 0x30AB, 0x3099, 0x2,
+		0x30AD, 0x3099, 0x2, 0x30AF, 0x3099, 0x2, 0x30B1, 0x3099, 0x2, 0x30B3, 0x3099, 0x2,
+		0x30B5, 0x3099, 0x2, 0x30B7, 0x3099, 0x2, 0x30B9, 0x3099, 0x2, 0x30BB, 0x3099, 0x2,
+		0x30BD, 0x3099, 0x2, 0x30BF, 0x3099, 0x2, 0x30C1, 0x3099, 0x2, 0x30C4, 0x3099, 0x2,
+		0x30C6, 0x3099, 0x2, 0x30C8, 0x3099, 0x2, 0x30CF, 0x3099, 0x2, 0x30CF, 0x309A, 0x2,
+		0x30D2, 0x3099, 0x2, 0x30D2, 0x309A, 0x2, 0x30D5, 0x3099, 0x2, 0x30D5, 0x309A, 0x2,
+		0x30D8, 0x3099, 0x2, 0x30D8, 0x309A, 0x2, 0x30DB, 0x3099, 0x2, 0x30DB, 0x309A, 0x2,
+		0x30A6, 0x3099, 0x2, 0x30EF, 0x3099, 0x2, 0x30F0, 0x3099, 0x2, 0x30F1, 0x3099, 0x2,
+		0x30F2, 0x3099, 0x2, 0x30FD, 0x3099, 0x200, 0x30B3, 0x30C8, 0x100, 0x1100, 0x100, 0x1101,
+		0x100, 0x11AA, 0x100, 0x1102, 0x100, 0x11AC, 0x100, 0x11AD, 0x100, 0x1103, 0x100, 0x1104,
+		0x100, 0x1105, 0x100, 0x11B0, 0x100, 0x11B1, 0x100, 0x11B2, 0x100, 0x11B3, 0x100, 0x11B4,
+		0x100, 0x11B5, 0x100, 0x111A, 0x100, 0x1106, 0x100, 0x1107, 0x100, 0x1108, 0x100, 0x1121,
+		0x100, 0x1109, 0x100, 0x110A, 0x100, 0x110B, 0x100, 0x110C, 0x100, 0x110D, 0x100, 0x110E,
+		0x100, 0x110F, 0x100, 0x1110, 0x100, 0x1111, 0x100, 0x1112, 0x100, 0x1161, 0x100, 0x1162,
+		0x100, 0x1163, 0x100, 0x1164, 0x100, 0x1165, 0x100, 0x1166, 0x100, 0x1167, 0x100, 0x1168,
+		0x100, 0x1169, 0x100, 0x116A, 0x100, 0x116B, 0x100, 0x116C, 0x100, 0x116D, 0x100, 0x116E,
+		0x100, 0x116F, 0x100, 0x1170, 0x100, 0x1171, 0x100, 0x1172, 0x100, 0x1173, 0x100, 0x1174,
+		0x100, 0x1175, 0x100, 0x1160, 0x100, 0x1114, 0x100, 0x1115, 0x100, 0x11C7, 0x100, 0x11C8,
+		0x100, 0x11CC, 0x100, 0x11CE, 0x100, 0x11D3, 0x100, 0x11D7, 0x100, 0x11D9, 0x100, 0x111C,
+		0x100, 0x11DD, 0x100, 0x11DF, 0x100, 0x111D, 0x100, 0x111E, 0x100, 0x1120, 0x100, 0x1122,
+		0x100, 0x1123, 0x100, 0x1127, 0x100, 0x1129, 0x100, 0x112B, 0x100, 0x112C, 0x100, 0x112D,
+		0x100, 0x112E, 0x100, 0x112F, 0x100, 0x1132, 0x100, 0x1136, 0x100, 0x1140, 0x100, 0x1147,
+		0x100, 0x114C, 0x100, 0x11F1, 0x100, 0x11F2, 0x100, 0x1157, 0x100, 0x1158, 0x100, 0x1159,
+		0x100, 0x1184, 0x100, 0x1185, 0x100, 0x1188, 0x100, 0x1191, 0x100, 0x1192, 0x100, 0x1194,
+		0x100, 0x119E, 0x100, 0x11A1, 0x100, 0x4E00, 0x100, 0x4E8C, 0x100, 0x4E09, 0x100, 0x56DB,
+		0x100, 0x4E0A, 0x100, 0x4E2D, 0x100, 0x4E0B, 0x100, 0x7532, 0x100, 0x4E59, 0x100, 0x4E19,
+		0x100, 0x4E01, 0x100, 0x5929, 0x100, 0x5730, 0x100, 0x4EBA, 0x300, 0x28, 0x1100, 0x29,
+		0x300, 0x28, 0x1102, 0x29, 0x300, 0x28, 0x1103, 0x29, 0x300, 0x28, 0x1105, 0x29,
+		0x300, 0x28, 0x1106, 0x29, 0x300, 0x28, 0x1107, 0x29, 0x300, 0x28, 0x1109, 0x29,
+		0x300, 0x28, 0x110B, 0x29, 0x300, 0x28, 0x110C, 0x29, 0x300, 0x28, 0x110E, 0x29,
+		0x300, 0x28, 0x110F, 0x29, 0x300, 0x28, 0x1110, 0x29, 0x300, 0x28, 0x1111, 0x29,
+		0x300, 0x28, 0x1112, 0x29, 0x400, 0x28, 0x1100, 0x1161, 0x29, 0x400, 0x28, 0x1102,
+		0x1161, 0x29, 0x400, 0x28, 0x1103, 0x1161, 0x29, 0x400, 0x28, 0x1105, 0x1161, 0x29,
+		0x400, 0x28, 0x1106, 0x1161, 0x29, 0x400, 0x28, 0x1107, 0x1161, 0x29, 0x400, 0x28,
+		0x1109, 0x1161, 0x29, 0x400, 0x28, 0x110B, 0x1161, 0x29, 0x400, 0x28, 0x110C, 0x1161,
+		0x29, 0x400, 0x28, 0x110E, 0x1161, 0x29, 0x400, 0x28, 0x110F, 0x1161, 0x29, 0x400,
+		0x28, 0x1110, 0x1161, 0x29, 0x400, 0x28, 0x1111, 0x1161, 0x29, 0x400, 0x28, 0x1112,
+		0x1161, 0x29, 0x400, 0x28, 0x110C, 0x116E, 0x29, 0x700, 0x28, 0x110B, 0x1169, 0x110C,
+		0x1165, 0x11AB, 0x29, 0x600, 0x28, 0x110B, 0x1169, 0x1112, 0x116E, 0x29, 0x300, 0x28,
+		0x4E00, 0x29, 0x300, 0x28, 0x4E8C, 0x29, 0x300, 0x28, 0x4E09, 0x29, 0x300, 0x28,
+		0x56DB, 0x29, 0x300, 0x28, 0x4E94, 0x29, 0x300, 0x28, 0x516D, 0x29, 0x300, 0x28,
+		0x4E03, 0x29, 0x300, 0x28, 0x516B, 0x29, 0x300, 0x28, 0x4E5D, 0x29, 0x300, 0x28,
+		0x5341, 0x29, 0x300, 0x28, 0x6708, 0x29, 0x300, 0x28, 0x706B, 0x29, 0x300, 0x28,
+		0x6C34, 0x29, 0x300, 0x28, 0x6728, 0x29, 0x300, 0x28, 0x91D1, 0x29, 0x300, 0x28,
+		0x571F, 0x29, 0x300, 0x28, 0x65E5, 0x29, 0x300, 0x28, 0x682A, 0x29, 0x300, 0x28,
+		0x6709, 0x29, 0x300, 0x28, 0x793E, 0x29, 0x300, 0x28, 0x540D, 0x29, 0x300, 0x28,
+		0x7279, 0x29, 0x300, 0x28, 0x8CA1, 0x29, 0x300, 0x28, 0x795D, 0x29, 0x300, 0x28,
+		0x52B4, 0x29, 0x300, 0x28, 0x4EE3, 0x29, 0x300, 0x28, 0x547C, 0x29, 0x300, 0x28,
+		0x5B66, 0x29, 0x300, 0x28, 0x76E3, 0x29, 0x300, 0x28, 0x4F01, 0x29, 0x300, 0x28,
+		0x8CC7, 0x29, 0x300, 0x28, 0x5354, 0x29, 0x300, 0x28, 0x796D, 0x29, 0x300, 0x28,
+		0x4F11, 0x29, 0x300, 0x28, 0x81EA, 0x29, 0x300, 0x28, 0x81F3, 0x29, 0x100, 0x554F,
+		0x100, 0x5E7C, 0x100, 0x6587, 0x100, 0x7B8F, 0x300, 0x50, 0x54, 0x45, 0x200, 0x32,
+		0x31, 0x200, 0x32, 0x32, 0x200, 0x32, 0x33, 0x200, 0x32, 0x34, 0x200, 0x32,
+		0x35, 0x200, 0x32, 0x36, 0x200, 0x32, 0x37, 0x200, 0x32, 0x38, 0x200, 0x32,
+		0x39, 0x200, 0x33, 0x30, 0x200, 0x33, 0x31, 0x200, 0x33, 0x32, 0x200, 0x33,
+		0x33, 0x200, 0x33, 0x34, 0x200, 0x33, 0x35, 0x100, 0x1100, 0x100, 0x1102, 0x100,
+		0x1103, 0x100, 0x1105, 0x100, 0x1106, 0x100, 0x1107, 0x100, 0x1109, 0x100, 0x110B, 0x100,
+		0x110C, 0x100, 0x110E, 0x100, 0x110F, 0x100, 0x1110, 0x100, 0x1111, 0x100, 0x1112, 0x200,
+		0x1100, 0x1161, 0x200, 0x1102, 0x1161, 0x200, 0x1103, 0x1161, 0x200, 0x1105, 0x1161, 0x200,
+		0x1106, 0x1161, 0x200, 0x1107, 0x1161, 0x200, 0x1109, 0x1161, 0x200, 0x110B, 0x1161, 0x200,
+		0x110C, 0x1161, 0x200, 0x110E, 0x1161, 0x200, 0x110F, 0x1161, 0x200, 0x1110, 0x1161, 0x200,
+		0x1111, 0x1161, 0x200, 0x1112, 0x1161, 0x500, 0x110E, 0x1161, 0x11B7, 0x1100, 0x1169, 0x400,
+		0x110C, 0x116E, 0x110B, 0x1174, 0x200, 0x110B, 0x116E, 0x100, 0x4E00, 0x100, 0x4E8C, 0x100,
+		0x4E09, 0x100, 0x56DB, 0x100, 0x4E94, 0x100, 0x516D, 0x100, 0x4E03, 0x100, 0x516B, 0x100,
+		0x4E5D, 0x100, 0x5341, 0x100, 0x6708, 0x100, 0x706B, 0x100, 0x6C34, 0x100, 0x6728, 0x100,
+		0x91D1, 0x100, 0x571F, 0x100, 0x65E5, 0x100, 0x682A, 0x100, 0x6709, 0x100, 0x793E, 0x100,
+		0x540D, 0x100, 0x7279, 0x100, 0x8CA1, 0x100, 0x795D, 0x100, 0x52B4, 0x100, 0x79D8, 0x100,
+		0x7537, 0x100, 0x5973, 0x100, 0x9069, 0x100, 0x512A, 0x100, 0x5370, 0x100, 0x6CE8, 0x100,
+		0x9805, 0x100, 0x4F11, 0x100, 0x5199, 0x100, 0x6B63, 0x100, 0x4E0A, 0x100, 0x4E2D, 0x100,
+		0x4E0B, 0x100, 0x5DE6, 0x100, 0x53F3, 0x100, 0x533B, 0x100, 0x5B97, 0x100, 0x5B66, 0x100,
+		0x76E3, 0x100, 0x4F01, 0x100, 0x8CC7, 0x100, 0x5354, 0x100, 0x591C, 0x200, 0x33, 0x36,
+		0x200, 0x33, 0x37, 0x200, 0x33, 0x38, 0x200, 0x33, 0x39, 0x200, 0x34, 0x30,
+		0x200, 0x34, 0x31, 0x200, 0x34, 0x32, 0x200, 0x34, 0x33, 0x200, 0x34, 0x34,
+		0x200, 0x34, 0x35, 0x200, 0x34, 0x36, 0x200, 0x34, 0x37, 0x200, 0x34, 0x38,
+		0x200, 0x34, 0x39, 0x200, 0x35, 0x30, 0x200, 0x31, 0x6708, 0x200, 0x32, 0x6708,
+		0x200, 0x33, 0x6708, 0x200, 0x34, 0x6708, 0x200, 0x35, 0x6708, 0x200, 0x36, 0x6708,
+		0x200, 0x37, 0x6708, 0x200, 0x38, 0x6708, 0x200, 0x39, 0x6708, 0x300, 0x31, 0x30,
+		0x6708, 0x300, 0x31, 0x31, 0x6708, 0x300, 0x31, 0x32, 0x6708, 0x200, 0x48, 0x67,
+		0x300, 0x65, 0x72, 0x67, 0x200, 0x65, 0x56, 0x300, 0x4C, 0x54, 0x44, 0x100,
+		0x30A2, 0x100, 0x30A4, 0x100, 0x30A6, 0x100, 0x30A8, 0x100, 0x30AA, 0x100, 0x30AB, 0x100,
+		0x30AD, 0x100, 0x30AF, 0x100, 0x30B1, 0x100, 0x30B3, 0x100, 0x30B5, 0x100, 0x30B7, 0x100,
+		0x30B9, 0x100, 0x30BB, 0x100, 0x30BD, 0x100, 0x30BF, 0x100, 0x30C1, 0x100, 0x30C4, 0x100,
+		0x30C6, 0x100, 0x30C8, 0x100, 0x30CA, 0x100, 0x30CB, 0x100, 0x30CC, 0x100, 0x30CD, 0x100,
+		0x30CE, 0x100, 0x30CF, 0x100, 0x30D2, 0x100, 0x30D5, 0x100, 0x30D8, 0x100, 0x30DB, 0x100,
+		0x30DE, 0x100, 0x30DF, 0x100, 0x30E0, 0x100, 0x30E1, 0x100, 0x30E2, 0x100, 0x30E4, 0x100,
+		0x30E6, 0x100, 0x30E8, 0x100, 0x30E9, 0x100, 0x30EA, 0x100, 0x30EB, 0x100, 0x30EC, 0x100,
+		0x30ED, 0x100, 0x30EF, 0x100, 0x30F0, 0x100, 0x30F1, 0x100, 0x30F2, 0x200, 0x4EE4, 0x548C,
+		0x500, 0x30A2, 0x30CF, 0x309A, 0x30FC, 0x30C8, 0x400, 0x30A2, 0x30EB, 0x30D5, 0x30A1, 0x500,
+		0x30A2, 0x30F3, 0x30D8, 0x309A, 0x30A2, 0x300, 0x30A2, 0x30FC, 0x30EB, 0x500, 0x30A4, 0x30CB,
+		0x30F3, 0x30AF, 0x3099, 0x300, 0x30A4, 0x30F3, 0x30C1, 0x300, 0x30A6, 0x30A9, 0x30F3, 0x600,
+		0x30A8, 0x30B9, 0x30AF, 0x30FC, 0x30C8, 0x3099, 0x400, 0x30A8, 0x30FC, 0x30AB, 0x30FC, 0x300,
+		0x30AA, 0x30F3, 0x30B9, 0x300, 0x30AA, 0x30FC, 0x30E0, 0x300, 0x30AB, 0x30A4, 0x30EA, 0x400,
+		0x30AB, 0x30E9, 0x30C3, 0x30C8, 0x400, 0x30AB, 0x30ED, 0x30EA, 0x30FC, 0x400, 0x30AB, 0x3099,
+		0x30ED, 0x30F3, 0x400, 0x30AB, 0x3099, 0x30F3, 0x30DE, 0x400, 0x30AD, 0x3099, 0x30AB, 0x3099,
+		0x400, 0x30AD, 0x3099, 0x30CB, 0x30FC, 0x400, 0x30AD, 0x30E5, 0x30EA, 0x30FC, 0x600, 0x30AD,
+		0x3099, 0x30EB, 0x30BF, 0x3099, 0x30FC, 0x200, 0x30AD, 0x30ED, 0x600, 0x30AD, 0x30ED, 0x30AF,
+		0x3099, 0x30E9, 0x30E0, 0x600, 0x30AD, 0x30ED, 0x30E1, 0x30FC, 0x30C8, 0x30EB, 0x500, 0x30AD,
+		0x30ED, 0x30EF, 0x30C3, 0x30C8, 0x400, 0x30AF, 0x3099, 0x30E9, 0x30E0, 0x600, 0x30AF, 0x3099,
+		0x30E9, 0x30E0, 0x30C8, 0x30F3, 0x600, 0x30AF, 0x30EB, 0x30BB, 0x3099, 0x30A4, 0x30ED, 0x400,
+		0x30AF, 0x30ED, 0x30FC, 0x30CD, 0x300, 0x30B1, 0x30FC, 0x30B9, 0x300, 0x30B3, 0x30EB, 0x30CA,
+		0x400, 0x30B3, 0x30FC, 0x30DB, 0x309A, 0x400, 0x30B5, 0x30A4, 0x30AF, 0x30EB, 0x500, 0x30B5,
+		0x30F3, 0x30C1, 0x30FC, 0x30E0, 0x500, 0x30B7, 0x30EA, 0x30F3, 0x30AF, 0x3099, 0x300, 0x30BB,
+		0x30F3, 0x30C1, 0x300, 0x30BB, 0x30F3, 0x30C8, 0x400, 0x30BF, 0x3099, 0x30FC, 0x30B9, 0x300,
+		0x30C6, 0x3099, 0x30B7, 0x300, 0x30C8, 0x3099, 0x30EB, 0x200, 0x30C8, 0x30F3, 0x200, 0x30CA,
+		0x30CE, 0x300, 0x30CE, 0x30C3, 0x30C8, 0x300, 0x30CF, 0x30A4, 0x30C4, 0x600, 0x30CF, 0x309A,
+		0x30FC, 0x30BB, 0x30F3, 0x30C8, 0x400, 0x30CF, 0x309A, 0x30FC, 0x30C4, 0x500, 0x30CF, 0x3099,
+		0x30FC, 0x30EC, 0x30EB, 0x600, 0x30D2, 0x309A, 0x30A2, 0x30B9, 0x30C8, 0x30EB, 0x400, 0x30D2,
+		0x309A, 0x30AF, 0x30EB, 0x300, 0x30D2, 0x309A, 0x30B3, 0x300, 0x30D2, 0x3099, 0x30EB, 0x600,
+		0x30D5, 0x30A1, 0x30E9, 0x30C3, 0x30C8, 0x3099, 0x400, 0x30D5, 0x30A3, 0x30FC, 0x30C8, 0x600,
+		0x30D5, 0x3099, 0x30C3, 0x30B7, 0x30A7, 0x30EB, 0x300, 0x30D5, 0x30E9, 0x30F3, 0x500, 0x30D8,
+		0x30AF, 0x30BF, 0x30FC, 0x30EB, 0x300, 0x30D8, 0x309A, 0x30BD, 0x400, 0x30D8, 0x309A, 0x30CB,
+		0x30D2, 0x300, 0x30D8, 0x30EB, 0x30C4, 0x400, 0x30D8, 0x309A, 0x30F3, 0x30B9, 0x500, 0x30D8,
+		0x309A, 0x30FC, 0x30B7, 0x3099, 0x400, 0x30D8, 0x3099, 0x30FC, 0x30BF, 0x500, 0x30DB, 0x309A,
+		0x30A4, 0x30F3, 0x30C8, 0x400, 0x30DB, 0x3099, 0x30EB, 0x30C8, 0x200, 0x30DB, 0x30F3, 0x500,
+		0x30DB, 0x309A, 0x30F3, 0x30C8, 0x3099, 0x300, 0x30DB, 0x30FC, 0x30EB, 0x300, 0x30DB, 0x30FC,
+		0x30F3, 0x400, 0x30DE, 0x30A4, 0x30AF, 0x30ED, 0x300, 0x30DE, 0x30A4, 0x30EB, 0x300, 0x30DE,
+		0x30C3, 0x30CF, 0x300, 0x30DE, 0x30EB, 0x30AF, 0x500, 0x30DE, 0x30F3, 0x30B7, 0x30E7, 0x30F3,
+		0x400, 0x30DF, 0x30AF, 0x30ED, 0x30F3, 0x200, 0x30DF, 0x30EA, 0x600, 0x30DF, 0x30EA, 0x30CF,
+		0x3099, 0x30FC, 0x30EB, 0x300, 0x30E1, 0x30AB, 0x3099, 0x500, 0x30E1, 0x30AB, 0x3099, 0x30C8,
+		0x30F3, 0x400, 0x30E1, 0x30FC, 0x30C8, 0x30EB, 0x400, 0x30E4, 0x30FC, 0x30C8, 0x3099, 0x300,
+		0x30E4, 0x30FC, 0x30EB, 0x300, 0x30E6, 0x30A2, 0x30F3, 0x400, 0x30EA, 0x30C3, 0x30C8, 0x30EB,
+		0x200, 0x30EA, 0x30E9, 0x400, 0x30EB, 0x30D2, 0x309A, 0x30FC, 0x500, 0x30EB, 0x30FC, 0x30D5,
+		0x3099, 0x30EB, 0x200, 0x30EC, 0x30E0, 0x600, 0x30EC, 0x30F3, 0x30C8, 0x30B1, 0x3099, 0x30F3,
+		0x300, 0x30EF, 0x30C3, 0x30C8, 0x200, 0x30, 0x70B9, 0x200, 0x31, 0x70B9, 0x200, 0x32,
+		0x70B9, 0x200, 0x33, 0x70B9, 0x200, 0x34, 0x70B9, 0x200, 0x35, 0x70B9, 0x200, 0x36,
+		0x70B9, 0x200, 0x37, 0x70B9, 0x200, 0x38, 0x70B9, 0x200, 0x39, 0x70B9, 0x300, 0x31,
+		0x30, 0x70B9, 0x300, 0x31, 0x31, 0x70B9, 0x300, 0x31, 0x32, 0x70B9, 0x300, 0x31,
+		0x33, 0x70B9, 0x300, 0x31, 0x34, 0x70B9, 0x300, 0x31, 0x35, 0x70B9, 0x300, 0x31,
+		0x36, 0x70B9, 0x300, 0x31, 0x37, 0x70B9, 0x300, 0x31, 0x38, 0x70B9, 0x300, 0x31,
+		0x39, 0x70B9, 0x300, 0x32, 0x30, 0x70B9, 0x300, 0x32, 0x31, 0x70B9, 0x300, 0x32,
+		0x32, 0x70B9, 0x300, 0x32, 0x33, 0x70B9, 0x300, 0x32, 0x34, 0x70B9, 0x300, 0x68,
+		0x50, 0x61, 0x200, 0x64, 0x61, 0x200, 0x41, 0x55, 0x300, 0x62, 0x61, 0x72,
+		0x200, 0x6F, 0x56, 0x200, 0x70, 0x63, 0x200, 0x64, 0x6D, 0x300, 0x64, 0x6D,
+		0x32, 0x300, 0x64, 0x6D, 0x33, 0x200, 0x49, 0x55, 0x200, 0x5E73, 0x6210, 0x200,
+		0x662D, 0x548C, 0x200, 0x5927, 0x6B63, 0x200, 0x660E, 0x6CBB, 0x400, 0x682A, 0x5F0F, 0x4F1A,
+		0x793E, 0x200, 0x70, 0x41, 0x200, 0x6E, 0x41, 0x200, 0x3BC, 0x41, 0x200, 0x6D,
+		0x41, 0x200, 0x6B, 0x41, 0x200, 0x4B, 0x42, 0x200, 0x4D, 0x42, 0x200, 0x47,
+		0x42, 0x300, 0x63, 0x61, 0x6C, 0x400, 0x6B, 0x63, 0x61, 0x6C, 0x200, 0x70,
+		0x46, 0x200, 0x6E, 0x46, 0x200, 0x3BC, 0x46, 0x200, 0x3BC, 0x67, 0x200, 0x6D,
+		0x67, 0x200, 0x6B, 0x67, 0x200, 0x48, 0x7A, 0x300, 0x6B, 0x48, 0x7A, 0x300,
+		0x4D, 0x48, 0x7A, 0x300, 0x47, 0x48, 0x7A, 0x300, 0x54, 0x48, 0x7A, 0x200,
+		0x3BC, 0x6C, 0x200, 0x6D, 0x6C, 0x200, 0x64, 0x6C, 0x200, 0x6B, 0x6C, 0x200,
+		0x66, 0x6D, 0x200, 0x6E, 0x6D, 0x200, 0x3BC, 0x6D, 0x200, 0x6D, 0x6D, 0x200,
+		0x63, 0x6D, 0x200, 0x6B, 0x6D, 0x300, 0x6D, 0x6D, 0x32, 0x300, 0x63, 0x6D,
+		0x32, 0x200, 0x6D, 0x32, 0x300, 0x6B, 0x6D, 0x32, 0x300, 0x6D, 0x6D, 0x33,
+		0x300, 0x63, 0x6D, 0x33, 0x200, 0x6D, 0x33, 0x300, 0x6B, 0x6D, 0x33, 0x300,
+		0x6D, 0x2215, 0x73, 0x400, 0x6D, 0x2215, 0x73, 0x32, 0x200, 0x50, 0x61, 0x300,
+		0x6B, 0x50, 0x61, 0x300, 0x4D, 0x50, 0x61, 0x300, 0x47, 0x50, 0x61, 0x300,
+		0x72, 0x61, 0x64, 0x500, 0x72, 0x61, 0x64, 0x2215, 0x73, 0x600, 0x72, 0x61,
+		0x64, 0x2215, 0x73, 0x32, 0x200, 0x70, 0x73, 0x200, 0x6E, 0x73, 0x200, 0x3BC,
+		0x73, 0x200, 0x6D, 0x73, 0x200, 0x70, 0x56, 0x200, 0x6E, 0x56, 0x200, 0x3BC,
+		0x56, 0x200, 0x6D, 0x56, 0x200, 0x6B, 0x56, 0x200, 0x4D, 0x56, 0x200, 0x70,
+		0x57, 0x200, 0x6E, 0x57, 0x200, 0x3BC, 0x57, 0x200, 0x6D, 0x57, 0x200, 0x6B,
+		0x57, 0x200, 0x4D, 0x57, 0x200, 0x6B, 0x3A9, 0x200, 0x4D, 0x3A9, 0x400, 0x61,
+		0x2E, 0x6D, 0x2E, 0x200, 0x42, 0x71, 0x200, 0x63, 0x63, 0x200, 0x63, 0x64,
+		0x400, 0x43, 0x2215, 0x6B, 0x67, 0x300, 0x43, 0x6F, 0x2E, 0x200, 0x64, 0x42,
+		0x200, 0x47, 0x79, 0x200, 0x68, 0x61, 0x200, 0x48, 0x50, 0x200, 0x69, 0x6E,
+		0x200, 0x4B, 0x4B, 0x200, 0x4B, 0x4D, 0x200, 0x6B, 0x74, 0x200, 0x6C, 0x6D,
+		0x200, 0x6C, 0x6E, 0x300, 0x6C, 0x6F, 0x67, 0x200, 0x6C, 0x78, 0x200, 0x6D,
+		0x62, 0x300, 0x6D, 0x69, 0x6C, 0x300, 0x6D, 0x6F, 0x6C, 0x200, 0x50, 0x48,
+		0x400, 0x70, 0x2E, 0x6D, 0x2E, 0x300, 0x50, 0x50, 0x4D, 0x200, 0x50, 0x52,
+		0x200, 0x73, 0x72, 0x200, 0x53, 0x76, 0x200, 0x57, 0x62, 0x300, 0x56, 0x2215,
+		0x6D, 0x300, 0x41, 0x2215, 0x6D, 0x200, 0x31, 0x65E5, 0x200, 0x32, 0x65E5, 0x200,
+		0x33, 0x65E5, 0x200, 0x34, 0x65E5, 0x200, 0x35, 0x65E5, 0x200, 0x36, 0x65E5, 0x200,
+		0x37, 0x65E5, 0x200, 0x38, 0x65E5, 0x200, 0x39, 0x65E5, 0x300, 0x31, 0x30, 0x65E5,
+		0x300, 0x31, 0x31, 0x65E5, 0x300, 0x31, 0x32, 0x65E5, 0x300, 0x31, 0x33, 0x65E5,
+		0x300, 0x31, 0x34, 0x65E5, 0x300, 0x31, 0x35, 0x65E5, 0x300, 0x31, 0x36, 0x65E5,
+		0x300, 0x31, 0x37, 0x65E5, 0x300, 0x31, 0x38, 0x65E5, 0x300, 0x31, 0x39, 0x65E5,
+		0x300, 0x32, 0x30, 0x65E5, 0x300, 0x32, 0x31, 0x65E5, 0x300, 0x32, 0x32, 0x65E5,
+		0x300, 0x32, 0x33, 0x65E5, 0x300, 0x32, 0x34, 0x65E5, 0x300, 0x32, 0x35, 0x65E5,
+		0x300, 0x32, 0x36, 0x65E5, 0x300, 0x32, 0x37, 0x65E5, 0x300, 0x32, 0x38, 0x65E5,
+		0x300, 0x32, 0x39, 0x65E5, 0x300, 0x33, 0x30, 0x65E5, 0x300, 0x33, 0x31, 0x65E5,
+		0x300, 0x67, 0x61, 0x6C, 0x100, 0x44A, 0x100, 0x44C, 0x100, 0xA76F, 0x100, 0x43,
+		0x100, 0x46, 0x100, 0x51, 0x100, 0x126, 0x100, 0x153, 0x100, 0xA727, 0x100, 0xAB37,
+		0x100, 0x26B, 0x100, 0xAB52, 0x100, 0x28D, 0x1, 0x8C48, 0x1, 0x66F4, 0x1, 0x8ECA,
+		0x1, 0x8CC8, 0x1, 0x6ED1, 0x1, 0x4E32, 0x1, 0x53E5, 0x1, 0x9F9C, 0x1, 0x9F9C,
+		0x1, 0x5951, 0x1, 0x91D1, 0x1, 0x5587, 0x1, 0x5948, 0x1, 0x61F6, 0x1, 0x7669,
+		0x1, 0x7F85, 0x1, 0x863F, 0x1, 0x87BA, 0x1, 0x88F8, 0x1, 0x908F, 0x1, 0x6A02,
+		0x1, 0x6D1B, 0x1, 0x70D9, 0x1, 0x73DE, 0x1, 0x843D, 0x1, 0x916A, 0x1, 0x99F1,
+		0x1, 0x4E82, 0x1, 0x5375, 0x1, 0x6B04, 0x1, 0x721B, 0x1, 0x862D, 0x1, 0x9E1E,
+		0x1, 0x5D50, 0x1, 0x6FEB, 0x1, 0x85CD, 0x1, 0x8964, 0x1, 0x62C9, 0x1, 0x81D8,
+		0x1, 0x881F, 0x1, 0x5ECA, 0x1, 0x6717, 0x1, 0x6D6A, 0x1, 0x72FC, 0x1, 0x90CE,
+		0x1, 0x4F86, 0x1, 0x51B7, 0x1, 0x52DE, 0x1, 0x64C4, 0x1, 0x6AD3, 0x1, 0x7210,
+		0x1, 0x76E7, 0x1, 0x8001, 0x1, 0x8606, 0x1, 0x865C, 0x1, 0x8DEF, 0x1, 0x9732,
+		0x1, 0x9B6F, 0x1, 0x9DFA, 0x1, 0x788C, 0x1, 0x797F, 0x1, 0x7DA0, 0x1, 0x83C9,
+		0x1, 0x9304, 0x1, 0x9E7F, 0x1, 0x8AD6, 0x1, 0x58DF, 0x1, 0x5F04, 0x1, 0x7C60,
+		0x1, 0x807E, 0x1, 0x7262, 0x1, 0x78CA, 0x1, 0x8CC2, 0x1, 0x96F7, 0x1, 0x58D8,
+		0x1, 0x5C62, 0x1, 0x6A13, 0x1, 0x6DDA, 0x1, 0x6F0F, 0x1, 0x7D2F, 0x1, 0x7E37,
+		0x1, 0x964B, 0x1, 0x52D2, 0x1, 0x808B, 0x1, 0x51DC, 0x1, 0x51CC, 0x1, 0x7A1C,
+		0x1, 0x7DBE, 0x1, 0x83F1, 0x1, 0x9675, 0x1, 0x8B80, 0x1, 0x62CF, 0x1, 0x6A02,
+		0x1, 0x8AFE, 0x1, 0x4E39, 0x1, 0x5BE7, 0x1, 0x6012, 0x1, 0x7387, 0x1, 0x7570,
+		0x1, 0x5317, 0x1, 0x78FB, 0x1, 0x4FBF, 0x1, 0x5FA9, 0x1, 0x4E0D, 0x1, 0x6CCC,
+		0x1, 0x6578, 0x1, 0x7D22, 0x1, 0x53C3, 0x1, 0x585E, 0x1, 0x7701, 0x1, 0x8449,
+		0x1, 0x8AAA, 0x1, 0x6BBA, 0x1, 0x8FB0, 0x1, 0x6C88, 0x1, 0x62FE, 0x1, 0x82E5,
+		0x1, 0x63A0, 0x1, 0x7565, 0x1, 0x4EAE, 0x1, 0x5169, 0x1, 0x51C9, 0x1, 0x6881,
+		0x1, 0x7CE7, 0x1, 0x826F, 0x1, 0x8AD2, 0x1, 0x91CF, 0x1, 0x52F5, 0x1, 0x5442,
+		0x1, 0x5973, 0x1, 0x5EEC, 0x1, 0x65C5, 0x1, 0x6FFE, 0x1, 0x792A, 0x1, 0x95AD,
+		0x1, 0x9A6A, 0x1, 0x9E97, 0x1, 0x9ECE, 0x1, 0x529B, 0x1, 0x66C6, 0x1, 0x6B77,
+		0x1, 0x8F62, 0x1, 0x5E74, 0x1, 0x6190, 0x1, 0x6200, 0x1, 0x649A, 0x1, 0x6F23,
+		0x1, 0x7149, 0x1, 0x7489, 0x1, 0x79CA, 0x1, 0x7DF4, 0x1, 0x806F, 0x1, 0x8F26,
+		0x1, 0x84EE, 0x1, 0x9023, 0x1, 0x934A, 0x1, 0x5217, 0x1, 0x52A3, 0x1, 0x54BD,
+		0x1, 0x70C8, 0x1, 0x88C2, 0x1, 0x8AAA, 0x1, 0x5EC9, 0x1, 0x5FF5, 0x1, 0x637B,
+		0x1, 0x6BAE, 0x1, 0x7C3E, 0x1, 0x7375, 0x1, 0x4EE4, 0x1, 0x56F9, 0x1, 0x5BE7,
+		0x1, 0x5DBA, 0x1, 0x601C, 0x1, 0x73B2, 0x1, 0x7469, 0x1, 0x7F9A, 0x1, 0x8046,
+		0x1, 0x9234, 0x1, 0x96F6, 0x1, 0x9748, 0x1, 0x9818, 0x1, 0x4F8B, 0x1, 0x79AE,
+		0x1, 0x91B4, 0x1, 0x96B8, 0x1, 0x60E1, 0x1, 0x4E86, 0x1, 0x50DA, 0x1, 0x5BEE,
+		0x1, 0x5C3F, 0x1, 0x6599, 0x1, 0x6A02, 0x1, 0x71CE, 0x1, 0x7642, 0x1, 0x84FC,
+		0x1, 0x907C, 0x1, 0x9F8D, 0x1, 0x6688, 0x1, 0x962E, 0x1, 0x5289, 0x1, 0x677B,
+		0x1, 0x67F3, 0x1, 0x6D41, 0x1, 0x6E9C, 0x1, 0x7409, 0x1, 0x7559, 0x1, 0x786B,
+		0x1, 0x7D10, 0x1, 0x985E, 0x1, 0x516D, 0x1, 0x622E, 0x1, 0x9678, 0x1, 0x502B,
+		0x1, 0x5D19, 0x1, 0x6DEA, 0x1, 0x8F2A, 0x1, 0x5F8B, 0x1, 0x6144, 0x1, 0x6817,
+		0x1, 0x7387, 0x1, 0x9686, 0x1, 0x5229, 0x1, 0x540F, 0x1, 0x5C65, 0x1, 0x6613,
+		0x1, 0x674E, 0x1, 0x68A8, 0x1, 0x6CE5, 0x1, 0x7406, 0x1, 0x75E2, 0x1, 0x7F79,
+		0x1, 0x88CF, 0x1, 0x88E1, 0x1, 0x91CC, 0x1, 0x96E2, 0x1, 0x533F, 0x1, 0x6EBA,
+		0x1, 0x541D, 0x1, 0x71D0, 0x1, 0x7498, 0x1, 0x85FA, 0x1, 0x96A3, 0x1, 0x9C57,
+		0x1, 0x9E9F, 0x1, 0x6797, 0x1, 0x6DCB, 0x1, 0x81E8, 0x1, 0x7ACB, 0x1, 0x7B20,
+		0x1, 0x7C92, 0x1, 0x72C0, 0x1, 0x7099, 0x1, 0x8B58, 0x1, 0x4EC0, 0x1, 0x8336,
+		0x1, 0x523A, 0x1, 0x5207, 0x1, 0x5EA6, 0x1, 0x62D3, 0x1, 0x7CD6, 0x1, 0x5B85,
+		0x1, 0x6D1E, 0x1, 0x66B4, 0x1, 0x8F3B, 0x1, 0x884C, 0x1, 0x964D, 0x1, 0x898B,
+		0x1, 0x5ED3, 0x1, 0x5140, 0x1, 0x55C0, 0x1, 0x585A, 0x1, 0x6674, 0x1, 0x51DE,
+		0x1, 0x732A, 0x1, 0x76CA, 0x1, 0x793C, 0x1, 0x795E, 0x1, 0x7965, 0x1, 0x798F,
+		0x1, 0x9756, 0x1, 0x7CBE, 0x1, 0x7FBD, 0x1, 0x8612, 0x1, 0x8AF8, 0x1, 0x9038,
+		0x1, 0x90FD, 0x1, 0x98EF, 0x1, 0x98FC, 0x1, 0x9928, 0x1, 0x9DB4, 0x1, 0x90DE,
+		0x1, 0x96B7, 0x1, 0x4FAE, 0x1, 0x50E7, 0x1, 0x514D, 0x1, 0x52C9, 0x1, 0x52E4,
+		0x1, 0x5351, 0x1, 0x559D, 0x1, 0x5606, 0x1, 0x5668, 0x1, 0x5840, 0x1, 0x58A8,
+		0x1, 0x5C64, 0x1, 0x5C6E, 0x1, 0x6094, 0x1, 0x6168, 0x1, 0x618E, 0x1, 0x61F2,
+		0x1, 0x654F, 0x1, 0x65E2, 0x1, 0x6691, 0x1, 0x6885, 0x1, 0x6D77, 0x1, 0x6E1A,
+		0x1, 0x6F22, 0x1, 0x716E, 0x1, 0x722B, 0x1, 0x7422, 0x1, 0x7891, 0x1, 0x793E,
+		0x1, 0x7949, 0x1, 0x7948, 0x1, 0x7950, 0x1, 0x7956, 0x1, 0x795D, 0x1, 0x798D,
+		0x1, 0x798E, 0x1, 0x7A40, 0x1, 0x7A81, 0x1, 0x7BC0, 0x1, 0x7DF4, 0x1, 0x7E09,
+		0x1, 0x7E41, 0x1, 0x7F72, 0x1, 0x8005, 0x1, 0x81ED, 0x1, 0x8279, 0x1, 0x8279,
+		0x1, 0x8457, 0x1, 0x8910, 0x1, 0x8996, 0x1, 0x8B01, 0x1, 0x8B39, 0x1, 0x8CD3,
+		0x1, 0x8D08, 0x1, 0x8FB6, 0x1, 0x9038, 0x1, 0x96E3, 0x1, 0x97FF, 0x1, 0x983B,
+		0x1, 0x6075, 0x1, 0x242EE, 0x1, 0x8218, 0x1, 0x4E26, 0x1, 0x51B5, 0x1, 0x5168,
+		0x1, 0x4F80, 0x1, 0x5145, 0x1, 0x5180, 0x1, 0x52C7, 0x1, 0x52FA, 0x1, 0x559D,
+		0x1, 0x5555, 0x1, 0x5599, 0x1, 0x55E2, 0x1, 0x585A, 0x1, 0x58B3, 0x1, 0x5944,
+		0x1, 0x5954, 0x1, 0x5A62, 0x1, 0x5B28, 0x1, 0x5ED2, 0x1, 0x5ED9, 0x1, 0x5F69,
+		0x1, 0x5FAD, 0x1, 0x60D8, 0x1, 0x614E, 0x1, 0x6108, 0x1, 0x618E, 0x1, 0x6160,
+		0x1, 0x61F2, 0x1, 0x6234, 0x1, 0x63C4, 0x1, 0x641C, 0x1, 0x6452, 0x1, 0x6556,
+		0x1, 0x6674, 0x1, 0x6717, 0x1, 0x671B, 0x1, 0x6756, 0x1, 0x6B79, 0x1, 0x6BBA,
+		0x1, 0x6D41, 0x1, 0x6EDB, 0x1, 0x6ECB, 0x1, 0x6F22, 0x1, 0x701E, 0x1, 0x716E,
+		0x1, 0x77A7, 0x1, 0x7235, 0x1, 0x72AF, 0x1, 0x732A, 0x1, 0x7471, 0x1, 0x7506,
+		0x1, 0x753B, 0x1, 0x761D, 0x1, 0x761F, 0x1, 0x76CA, 0x1, 0x76DB, 0x1, 0x76F4,
+		0x1, 0x774A, 0x1, 0x7740, 0x1, 0x78CC, 0x1, 0x7AB1, 0x1, 0x7BC0, 0x1, 0x7C7B,
+		0x1, 0x7D5B, 0x1, 0x7DF4, 0x1, 0x7F3E, 0x1, 0x8005, 0x1, 0x8352, 0x1, 0x83EF,
+		0x1, 0x8779, 0x1, 0x8941, 0x1, 0x8986, 0x1, 0x8996, 0x1, 0x8ABF, 0x1, 0x8AF8,
+		0x1, 0x8ACB, 0x1, 0x8B01, 0x1, 0x8AFE, 0x1, 0x8AED, 0x1, 0x8B39, 0x1, 0x8B8A,
+		0x1, 0x8D08, 0x1, 0x8F38, 0x1, 0x9072, 0x1, 0x9199, 0x1, 0x9276, 0x1, 0x967C,
+		0x1, 0x96E3, 0x1, 0x9756, 0x1, 0x97DB, 0x1, 0x97FF, 0x1, 0x980B, 0x1, 0x983B,
+		0x1, 0x9B12, 0x1, 0x9F9C, 0x1, 0x2284A, 0x1, 0x22844, 0x1, 0x233D5, 0x1, 0x3B9D,
+		0x1, 0x4018, 0x1, 0x4039, 0x1, 0x25249, 0x1, 0x25CD0, 0x1, 0x27ED3, 0x1, 0x9F43,
+		0x1, 0x9F8E, 0x200, 0x66, 0x66, 0x200, 0x66, 0x69, 0x200, 0x66, 0x6C, 0x300,
+		0x66, 0x66, 0x69, 0x300, 0x66, 0x66, 0x6C, 0x200, 0x73, 0x74, 0x200, 0x73,
+		0x74, 0x200, 0x574, 0x576, 0x200, 0x574, 0x565, 0x200, 0x574, 0x56B, 0x200, 0x57E,
+		0x576, 0x200, 0x574, 0x56D, 0x2, 0x5D9, 0x5B4, 0x2, 0x5F2, 0x5B7, 0x100, 0x5E2,
+		0x100, 0x5D0, 0x100, 0x5D3, 0x100, 0x5D4, 0x100, 0x5DB, 0x100, 0x5DC, 0x100, 0x5DD,
+		0x100, 0x5E8, 0x100, 0x5EA, 0x100, 0x2B, 0x2, 0x5E9, 0x5C1, 0x2, 0x5E9, 0x5C2,
+		0x3, 0x5E9, 0x5BC, 0x5C1, 0x3, 0x5E9, 0x5BC, 0x5C2, 0x2, 0x5D0, 0x5B7, 0x2,
+		0x5D0, 0x5B8, 0x2, 0x5D0, 0x5BC, 0x2, 0x5D1, 0x5BC, 0x2, 0x5D2, 0x5BC, 0x2,
+		0x5D3, 0x5BC, 0x2, 0x5D4, 0x5BC, 0x2, 0x5D5, 0x5BC, 0x2, 0x5D6, 0x5BC, 0x2,
+		0x5D8, 0x5BC, 0x2, 0x5D9, 0x5BC, 0x2, 0x5DA, 0x5BC, 0x2, 0x5DB, 0x5BC, 0x2,
+		0x5DC, 0x5BC, 0x2, 0x5DE, 0x5BC, 0x2, 0x5E0, 0x5BC, 0x2, 0x5E1, 0x5BC, 0x2,
+		0x5E3, 0x5BC, 0x2, 0x5E4, 0x5BC, 0x2, 0x5E6, 0x5BC, 0x2, 0x5E7, 0x5BC, 0x2,
+		0x5E8, 0x5BC, 0x2, 0x5E9, 0x5BC, 0x2, 0x5EA, 0x5BC, 0x2, 0x5D5, 0x5B9, 0x2,
+		0x5D1, 0x5BF, 0x2, 0x5DB, 0x5BF, 0x2, 0x5E4, 0x5BF, 0x200, 0x5D0, 0x5DC, 0x100,
+		0x671, 0x100, 0x671, 0x100, 0x67B, 0x100, 0x67B, 0x100, 0x67B, 0x100, 0x67B, 0x100,
+		0x67E, 0x100, 0x67E, 0x100, 0x67E, 0x100, 0x67E, 0x100, 0x680, 0x100, 0x680, 0x100,
+		0x680, 0x100, 0x680, 0x100, 0x67A, 0x100, 0x67A, 0x100, 0x67A, 0x100, 0x67A, 0x100,
+		0x67F, 0x100, 0x67F, 0x100, 0x67F, 0x100, 0x67F, 0x100, 0x679, 0x100, 0x679, 0x100,
+		0x679, 0x100, 0x679, 0x100, 0x6A4, 0x100, 0x6A4, 0x100, 0x6A4, 0x100, 0x6A4, 0x100,
+		0x6A6, 0x100, 0x6A6, 0x100, 0x6A6, 0x100, 0x6A6, 0x100, 0x684, 0x100, 0x684, 0x100,
+		0x684, 0x100, 0x684, 0x100, 0x683, 0x100, 0x683, 0x100, 0x683, 0x100, 0x683, 0x100,
+		0x686, 0x100, 0x686, 0x100, 0x686, 0x100, 0x686, 0x100, 0x687, 0x100, 0x687, 0x100,
+		0x687, 0x100, 0x687, 0x100, 0x68D, 0x100, 0x68D, 0x100, 0x68C, 0x100, 0x68C, 0x100,
+		0x68E, 0x100, 0x68E, 0x100, 0x688, 0x100, 0x688, 0x100, 0x698, 0x100, 0x698, 0x100,
+		0x691, 0x100, 0x691, 0x100, 0x6A9, 0x100, 0x6A9, 0x100, 0x6A9, 0x100, 0x6A9, 0x100,
+		0x6AF, 0x100, 0x6AF, 0x100, 0x6AF, 0x100, 0x6AF, 0x100, 0x6B3, 0x100, 0x6B3, 0x100,
+		0x6B3, 0x100, 0x6B3, 0x100, 0x6B1, 0x100, 0x6B1, 0x100, 0x6B1, 0x100, 0x6B1, 0x100,
+		0x6BA, 0x100, 0x6BA, 0x100, 0x6BB, 0x100, 0x6BB, 0x100, 0x6BB, 0x100, 0x6BB, 0x200,
+		0x6D5, 0x654, 0x200, 0x6D5, 0x654, 0x100, 0x6C1, 0x100, 0x6C1, 0x100, 0x6C1, 0x100,
+		0x6C1, 0x100, 0x6BE, 0x100, 0x6BE, 0x100, 0x6BE, 0x100, 0x6BE, 0x100, 0x6D2, 0x100,
+		0x6D2, 0x200, 0x6D2, 0x654, 0x200, 0x6D2, 0x654, 0x100, 0x6AD, 0x100, 0x6AD, 0x100,
+		0x6AD, 0x100, 0x6AD, 0x100, 0x6C7, 0x100, 0x6C7, 0x100, 0x6C6, 0x100, 0x6C6, 0x100,
+		0x6C8, 0x100, 0x6C8, 0x200, 0x6C7, 0x674, 0x100, 0x6CB, 0x100, 0x6CB, 0x100, 0x6C5,
+		0x100, 0x6C5, 0x100, 0x6C9, 0x100, 0x6C9, 0x100, 0x6D0, 0x100, 0x6D0, 0x100, 0x6D0,
+		0x100, 0x6D0, 0x100, 0x649, 0x100, 0x649, 0x300, 0x64A, 0x654, 0x627, 0x300, 0x64A,
+		0x654, 0x627, 0x300, 0x64A, 0x654, 0x6D5, 0x300, 0x64A, 0x654, 0x6D5, 0x300, 0x64A,
+		0x654, 0x648, 0x300, 0x64A, 0x654, 0x648, 0x300, 0x64A, 0x654, 0x6C7, 0x300, 0x64A,
+		0x654, 0x6C7, 0x300, 0x64A, 0x654, 0x6C6, 0x300, 0x64A, 0x654, 0x6C6, 0x300, 0x64A,
+		0x654, 0x6C8, 0x300, 0x64A, 0x654, 0x6C8, 0x300, 0x64A, 0x654, 0x6D0, 0x300, 0x64A,
+		0x654, 0x6D0, 0x300, 0x64A, 0x654, 0x6D0, 0x300, 0x64A, 0x654, 0x649, 0x300, 0x64A,
+		0x654, 0x649, 0x300, 0x64A, 0x654, 0x649, 0x100, 0x6CC, 0x100, 0x6CC, 0x100, 0x6CC,
+		0x100, 0x6CC, 0x300, 0x64A, 0x654, 0x62C, 0x300, 0x64A, 0x654, 0x62D, 0x300, 0x64A,
+		0x654, 0x645, 0x300, 0x64A, 0x654, 0x649, 0x300, 0x64A, 0x654, 0x64A, 0x200, 0x628,
+		0x62C, 0x200, 0x628, 0x62D, 0x200, 0x628, 0x62E, 0x200, 0x628, 0x645, 0x200, 0x628,
+		0x649, 0x200, 0x628, 0x64A, 0x200, 0x62A, 0x62C, 0x200, 0x62A, 0x62D, 0x200, 0x62A,
+		0x62E, 0x200, 0x62A, 0x645, 0x200, 0x62A, 0x649, 0x200, 0x62A, 0x64A, 0x200, 0x62B,
+		0x62C, 0x200, 0x62B, 0x645, 0x200, 0x62B, 0x649, 0x200, 0x62B, 0x64A, 0x200, 0x62C,
+		0x62D, 0x200, 0x62C, 0x645, 0x200, 0x62D, 0x62C, 0x200, 0x62D, 0x645, 0x200, 0x62E,
+		0x62C, 0x200, 0x62E, 0x62D, 0x200, 0x62E, 0x645, 0x200, 0x633, 0x62C, 0x200, 0x633,
+		0x62D, 0x200, 0x633, 0x62E, 0x200, 0x633, 0x645, 0x200, 0x635, 0x62D, 0x200, 0x635,
+		0x645, 0x200, 0x636, 0x62C, 0x200, 0x636, 0x62D, 0x200, 0x636, 0x62E, 0x200, 0x636,
+		0x645, 0x200, 0x637, 0x62D, 0x200, 0x637, 0x645, 0x200, 0x638, 0x645, 0x200, 0x639,
+		0x62C, 0x200, 0x639, 0x645, 0x200, 0x63A, 0x62C, 0x200, 0x63A, 0x645, 0x200, 0x641,
+		0x62C, 0x200, 0x641, 0x62D, 0x200, 0x641, 0x62E, 0x200, 0x641, 0x645, 0x200, 0x641,
+		0x649, 0x200, 0x641, 0x64A, 0x200, 0x642, 0x62D, 0x200, 0x642, 0x645, 0x200, 0x642,
+		0x649, 0x200, 0x642, 0x64A, 0x200, 0x643, 0x627, 0x200, 0x643, 0x62C, 0x200, 0x643,
+		0x62D, 0x200, 0x643, 0x62E, 0x200, 0x643, 0x644, 0x200, 0x643, 0x645, 0x200, 0x643,
+		0x649, 0x200, 0x643, 0x64A, 0x200, 0x644, 0x62C, 0x200, 0x644, 0x62D, 0x200, 0x644,
+		0x62E, 0x200, 0x644, 0x645, 0x200, 0x644, 0x649, 0x200, 0x644, 0x64A, 0x200, 0x645,
+		0x62C, 0x200, 0x645, 0x62D, 0x200, 0x645, 0x62E, 0x200, 0x645, 0x645, 0x200, 0x645,
+		0x649, 0x200, 0x645, 0x64A, 0x200, 0x646, 0x62C, 0x200, 0x646, 0x62D, 0x200, 0x646,
+		0x62E, 0x200, 0x646, 0x645, 0x200, 0x646, 0x649, 0x200, 0x646, 0x64A, 0x200, 0x647,
+		0x62C, 0x200, 0x647, 0x645, 0x200, 0x647, 0x649, 0x200, 0x647, 0x64A, 0x200, 0x64A,
+		0x62C, 0x200, 0x64A, 0x62D, 0x200, 0x64A, 0x62E, 0x200, 0x64A, 0x645, 0x200, 0x64A,
+		0x649, 0x200, 0x64A, 0x64A, 0x200, 0x630, 0x670, 0x200, 0x631, 0x670, 0x200, 0x649,
+		0x670, 0x300, 0x20, 0x64C, 0x651, 0x300, 0x20, 0x64D, 0x651, 0x300, 0x20, 0x64E,
+		0x651, 0x300, 0x20, 0x64F, 0x651, 0x300, 0x20, 0x650, 0x651, 0x300, 0x20, 0x651,
+		0x670, 0x300, 0x64A, 0x654, 0x631, 0x300, 0x64A, 0x654, 0x632, 0x300, 0x64A, 0x654,
+		0x645, 0x300, 0x64A, 0x654, 0x646, 0x300, 0x64A, 0x654, 0x649, 0x300, 0x64A, 0x654,
+		0x64A, 0x200, 0x628, 0x631, 0x200, 0x628, 0x632, 0x200, 0x628, 0x645, 0x200, 0x628,
+		0x646, 0x200, 0x628, 0x649, 0x200, 0x628, 0x64A, 0x200, 0x62A, 0x631, 0x200, 0x62A,
+		0x632, 0x200, 0x62A, 0x645, 0x200, 0x62A, 0x646, 0x200, 0x62A, 0x649, 0x200, 0x62A,
+		0x64A, 0x200, 0x62B, 0x631, 0x200, 0x62B, 0x632, 0x200, 0x62B, 0x645, 0x200, 0x62B,
+		0x646, 0x200, 0x62B, 0x649, 0x200, 0x62B, 0x64A, 0x200, 0x641, 0x649, 0x200, 0x641,
+		0x64A, 0x200, 0x642, 0x649, 0x200, 0x642, 0x64A, 0x200, 0x643, 0x627, 0x200, 0x643,
+		0x644, 0x200, 0x643, 0x645, 0x200, 0x643, 0x649, 0x200, 0x643, 0x64A, 0x200, 0x644,
+		0x645, 0x200, 0x644, 0x649, 0x200, 0x644, 0x64A, 0x200, 0x645, 0x627, 0x200, 0x645,
+		0x645, 0x200, 0x646, 0x631, 0x200, 0x646, 0x632, 0x200, 0x646, 0x645, 0x200, 0x646,
+		0x646, 0x200, 0x646, 0x649, 0x200, 0x646, 0x64A, 0x200, 0x649, 0x670, 0x200, 0x64A,
+		0x631, 0x200, 0x64A, 0x632, 0x200, 0x64A, 0x645, 0x200, 0x64A, 0x646, 0x200, 0x64A,
+		0x649, 0x200, 0x64A, 0x64A, 0x300, 0x64A, 0x654, 0x62C, 0x300, 0x64A, 0x654, 0x62D,
+		0x300, 0x64A, 0x654, 0x62E, 0x300, 0x64A, 0x654, 0x645, 0x300, 0x64A, 0x654, 0x647,
+		0x200, 0x628, 0x62C, 0x200, 0x628, 0x62D, 0x200, 0x628, 0x62E, 0x200, 0x628, 0x645,
+		0x200, 0x628, 0x647, 0x200, 0x62A, 0x62C, 0x200, 0x62A, 0x62D, 0x200, 0x62A, 0x62E,
+		0x200, 0x62A, 0x645, 0x200, 0x62A, 0x647, 0x200, 0x62B, 0x645, 0x200, 0x62C, 0x62D,
+		0x200, 0x62C, 0x645, 0x200, 0x62D, 0x62C, 0x200, 0x62D, 0x645, 0x200, 0x62E, 0x62C,
+		0x200, 0x62E, 0x645, 0x200, 0x633, 0x62C, 0x200, 0x633, 0x62D, 0x200, 0x633, 0x62E,
+		0x200, 0x633, 0x645, 0x200, 0x635, 0x62D, 0x200, 0x635, 0x62E, 0x200, 0x635, 0x645,
+		0x200, 0x636, 0x62C, 0x200, 0x636, 0x62D, 0x200, 0x636, 0x62E, 0x200, 0x636, 0x645,
+		0x200, 0x637, 0x62D, 0x200, 0x638, 0x645, 0x200, 0x639, 0x62C, 0x200, 0x639, 0x645,
+		0x200, 0x63A, 0x62C, 0x200, 0x63A, 0x645, 0x200, 0x641, 0x62C, 0x200, 0x641, 0x62D,
+		0x200, 0x641, 0x62E, 0x200, 0x641, 0x645, 0x200, 0x642, 0x62D, 0x200, 0x642, 0x645,
+		0x200, 0x643, 0x62C, 0x200, 0x643, 0x62D, 0x200, 0x643, 0x62E, 0x200, 0x643, 0x644,
+		0x200, 0x643, 0x645, 0x200, 0x644, 0x62C, 0x200, 0x644, 0x62D, 0x200, 0x644, 0x62E,
+		0x200, 0x644, 0x645, 0x200, 0x644, 0x647, 0x200, 0x645, 0x62C, 0x200, 0x645, 0x62D,
+		0x200, 0x645, 0x62E, 0x200, 0x645, 0x645, 0x200, 0x646, 0x62C, 0x200, 0x646, 0x62D,
+		0x200, 0x646, 0x62E, 0x200, 0x646, 0x645, 0x200, 0x646, 0x647, 0x200, 0x647, 0x62C,
+		0x200, 0x647, 0x645, 0x200, 0x647, 0x670, 0x200, 0x64A, 0x62C, 0x200, 0x64A, 0x62D,
+		0x200, 0x64A, 0x62E, 0x200, 0x64A, 0x645, 0x200, 0x64A, 0x647, 0x300, 0x64A, 0x654,
+		0x645, 0x300, 0x64A, 0x654, 0x647, 0x200, 0x628, 0x645, 0x200, 0x628, 0x647, 0x200,
+		0x62A, 0x645, 0x200, 0x62A, 0x647, 0x200, 0x62B, 0x645, 0x200, 0x62B, 0x647, 0x200,
+		0x633, 0x645, 0x200, 0x633, 0x647, 0x200, 0x634, 0x645, 0x200, 0x634, 0x647, 0x200,
+		0x643, 0x644, 0x200, 0x643, 0x645, 0x200, 0x644, 0x645, 0x200, 0x646, 0x645, 0x200,
+		0x646, 0x647, 0x200, 0x64A, 0x645, 0x200, 0x64A, 0x647, 0x300, 0x640, 0x64E, 0x651,
+		0x300, 0x640, 0x64F, 0x651, 0x300, 0x640, 0x650, 0x651, 0x200, 0x637, 0x649, 0x200,
+		0x637, 0x64A, 0x200, 0x639, 0x649, 0x200, 0x639, 0x64A, 0x200, 0x63A, 0x649, 0x200,
+		0x63A, 0x64A, 0x200, 0x633, 0x649, 0x200, 0x633, 0x64A, 0x200, 0x634, 0x649, 0x200,
+		0x634, 0x64A, 0x200, 0x62D, 0x649, 0x200, 0x62D, 0x64A, 0x200, 0x62C, 0x649, 0x200,
+		0x62C, 0x64A, 0x200, 0x62E, 0x649, 0x200, 0x62E, 0x64A, 0x200, 0x635, 0x649, 0x200,
+		0x635, 0x64A, 0x200, 0x636, 0x649, 0x200, 0x636, 0x64A, 0x200, 0x634, 0x62C, 0x200,
+		0x634, 0x62D, 0x200, 0x634, 0x62E, 0x200, 0x634, 0x645, 0x200, 0x634, 0x631, 0x200,
+		0x633, 0x631, 0x200, 0x635, 0x631, 0x200, 0x636, 0x631, 0x200, 0x637, 0x649, 0x200,
+		0x637, 0x64A, 0x200, 0x639, 0x649, 0x200, 0x639, 0x64A, 0x200, 0x63A, 0x649, 0x200,
+		0x63A, 0x64A, 0x200, 0x633, 0x649, 0x200, 0x633, 0x64A, 0x200, 0x634, 0x649, 0x200,
+		0x634, 0x64A, 0x200, 0x62D, 0x649, 0x200, 0x62D, 0x64A, 0x200, 0x62C, 0x649, 0x200,
+		0x62C, 0x64A, 0x200, 0x62E, 0x649, 0x200, 0x62E, 0x64A, 0x200, 0x635, 0x649, 0x200,
+		0x635, 0x64A, 0x200, 0x636, 0x649, 0x200, 0x636, 0x64A, 0x200, 0x634, 0x62C, 0x200,
+		0x634, 0x62D, 0x200, 0x634, 0x62E, 0x200, 0x634, 0x645, 0x200, 0x634, 0x631, 0x200,
+		0x633, 0x631, 0x200, 0x635, 0x631, 0x200, 0x636, 0x631, 0x200, 0x634, 0x62C, 0x200,
+		0x634, 0x62D, 0x200, 0x634, 0x62E, 0x200, 0x634, 0x645, 0x200, 0x633, 0x647, 0x200,
+		0x634, 0x647, 0x200, 0x637, 0x645, 0x200, 0x633, 0x62C, 0x200, 0x633, 0x62D, 0x200,
+		0x633, 0x62E, 0x200, 0x634, 0x62C, 0x200, 0x634, 0x62D, 0x200, 0x634, 0x62E, 0x200,
+		0x637, 0x645, 0x200, 0x638, 0x645, 0x200, 0x627, 0x64B, 0x200, 0x627, 0x64B, 0x300,
+		0x62A, 0x62C, 0x645, 0x300, 0x62A, 0x62D, 0x62C, 0x300, 0x62A, 0x62D, 0x62C, 0x300,
+		0x62A, 0x62D, 0x645, 0x300, 0x62A, 0x62E, 0x645, 0x300, 0x62A, 0x645, 0x62C, 0x300,
+		0x62A, 0x645, 0x62D, 0x300, 0x62A, 0x645, 0x62E, 0x300, 0x62C, 0x645, 0x62D, 0x300,
+		0x62C, 0x645, 0x62D, 0x300, 0x62D, 0x645, 0x64A, 0x300, 0x62D, 0x645, 0x649, 0x300,
+		0x633, 0x62D, 0x62C, 0x300, 0x633, 0x62C, 0x62D, 0x300, 0x633, 0x62C, 0x649, 0x300,
+		0x633, 0x645, 0x62D, 0x300, 0x633, 0x645, 0x62D, 0x300, 0x633, 0x645, 0x62C, 0x300,
+		0x633, 0x645, 0x645, 0x300, 0x633, 0x645, 0x645, 0x300, 0x635, 0x62D, 0x62D, 0x300,
+		0x635, 0x62D, 0x62D, 0x300, 0x635, 0x645, 0x645, 0x300, 0x634, 0x62D, 0x645, 0x300,
+		0x634, 0x62D, 0x645, 0x300, 0x634, 0x62C, 0x64A, 0x300, 0x634, 0x645, 0x62E, 0x300,
+		0x634, 0x645, 0x62E, 0x300, 0x634, 0x645, 0x645, 0x300, 0x634, 0x645, 0x645, 0x300,
+		0x636, 0x62D, 0x649, 0x300, 0x636, 0x62E, 0x645, 0x300, 0x636, 0x62E, 0x645, 0x300,
+		0x637, 0x645, 0x62D, 0x300, 0x637, 0x645, 0x62D, 0x300, 0x637, 0x645, 0x645, 0x300,
+		0x637, 0x645, 0x64A, 0x300, 0x639, 0x62C, 0x645, 0x300, 0x639, 0x645, 0x645, 0x300,
+		0x639, 0x645, 0x645, 0x300, 0x639, 0x645, 0x649, 0x300, 0x63A, 0x645, 0x645, 0x300,
+		0x63A, 0x645, 0x64A, 0x300, 0x63A, 0x645, 0x649, 0x300, 0x641, 0x62E, 0x645, 0x300,
+		0x641, 0x62E, 0x645, 0x300, 0x642, 0x645, 0x62D, 0x300, 0x642, 0x645, 0x645, 0x300,
+		0x644, 0x62D, 0x645, 0x300, 0x644, 0x62D, 0x64A, 0x300, 0x644, 0x62D, 0x649, 0x300,
+		0x644, 0x62C, 0x62C, 0x300, 0x644, 0x62C, 0x62C, 0x300, 0x644, 0x62E, 0x645, 0x300,
+		0x644, 0x62E, 0x645, 0x300, 0x644, 0x645, 0x62D, 0x300, 0x644, 0x645, 0x62D, 0x300,
+		0x645, 0x62D, 0x62C, 0x300, 0x645, 0x62D, 0x645, 0x300, 0x645, 0x62D, 0x64A, 0x300,
+		0x645, 0x62C, 0x62D, 0x300, 0x645, 0x62C, 0x645, 0x300, 0x645, 0x62E, 0x62C, 0x300,
+		0x645, 0x62E, 0x645, 0x300, 0x645, 0x62C, 0x62E, 0x300, 0x647, 0x645, 0x62C, 0x300,
+		0x647, 0x645, 0x645, 0x300, 0x646, 0x62D, 0x645, 0x300, 0x646, 0x62D, 0x649, 0x300,
+		0x646, 0x62C, 0x645, 0x300, 0x646, 0x62C, 0x645, 0x300, 0x646, 0x62C, 0x649, 0x300,
+		0x646, 0x645, 0x64A, 0x300, 0x646, 0x645, 0x649, 0x300, 0x64A, 0x645, 0x645, 0x300,
+		0x64A, 0x645, 0x645, 0x300, 0x628, 0x62E, 0x64A, 0x300, 0x62A, 0x62C, 0x64A, 0x300,
+		0x62A, 0x62C, 0x649, 0x300, 0x62A, 0x62E, 0x64A, 0x300, 0x62A, 0x62E, 0x649, 0x300,
+		0x62A, 0x645, 0x64A, 0x300, 0x62A, 0x645, 0x649, 0x300, 0x62C, 0x645, 0x64A, 0x300,
+		0x62C, 0x62D, 0x649, 0x300, 0x62C, 0x645, 0x649, 0x300, 0x633, 0x62E, 0x649, 0x300,
+		0x635, 0x62D, 0x64A, 0x300, 0x634, 0x62D, 0x64A, 0x300, 0x636, 0x62D, 0x64A, 0x300,
+		0x644, 0x62C, 0x64A, 0x300, 0x644, 0x645, 0x64A, 0x300, 0x64A, 0x62D, 0x64A, 0x300,
+		0x64A, 0x62C, 0x64A, 0x300, 0x64A, 0x645, 0x64A, 0x300, 0x645, 0x645, 0x64A, 0x300,
+		0x642, 0x645, 0x64A, 0x300, 0x646, 0x62D, 0x64A, 0x300, 0x642, 0x645, 0x62D, 0x300,
+		0x644, 0x62D, 0x645, 0x300, 0x639, 0x645, 0x64A, 0x300, 0x643, 0x645, 0x64A, 0x300,
+		0x646, 0x62C, 0x62D, 0x300, 0x645, 0x62E, 0x64A, 0x300, 0x644, 0x62C, 0x645, 0x300,
+		0x643, 0x645, 0x645, 0x300, 0x644, 0x62C, 0x645, 0x300, 0x646, 0x62C, 0x62D, 0x300,
+		0x62C, 0x62D, 0x64A, 0x300, 0x62D, 0x62C, 0x64A, 0x300, 0x645, 0x62C, 0x64A, 0x300,
+		0x641, 0x645, 0x64A, 0x300, 0x628, 0x62D, 0x64A, 0x300, 0x643, 0x645, 0x645, 0x300,
+		0x639, 0x62C, 0x645, 0x300, 0x635, 0x645, 0x645, 0x300, 0x633, 0x62E, 0x64A, 0x300,
+		0x646, 0x62C, 0x64A, 0x300, 0x635, 0x644, 0x6D2, 0x300, 0x642, 0x644, 0x6D2, 0x400,
+		0x627, 0x644, 0x644, 0x647, 0x400, 0x627, 0x643, 0x628, 0x631, 0x400, 0x645, 0x62D,
+		0x645, 0x62F, 0x400, 0x635, 0x644, 0x639, 0x645, 0x400, 0x631, 0x633, 0x648, 0x644,
+		0x400, 0x639, 0x644, 0x64A, 0x647, 0x400, 0x648, 0x633, 0x644, 0x645, 0x300, 0x635,
+		0x644, 0x649, 0x1200, 0x635, 0x644, 0x649, 0x20, 0x627, 0x644, 0x644, 0x647, 0x20,
+		0x639, 0x644, 0x64A, 0x647, 0x20, 0x648, 0x633, 0x644, 0x645, 0x800, 0x62C, 0x644,
+		0x20, 0x62C, 0x644, 0x627, 0x644, 0x647, 0x400, 0x631, 0x6CC, 0x627, 0x644, 0x100,
+		0x2C, 0x100, 0x3001, 0x100, 0x3002, 0x100, 0x3A, 0x100, 0x3B, 0x100, 0x21, 0x100,
+		0x3F, 0x100, 0x3016, 0x100, 0x3017, 0x300, 0x2E, 0x2E, 0x2E, 0x200, 0x2E, 0x2E,
+		0x100, 0x2014, 0x100, 0x2013, 0x100, 0x5F, 0x100, 0x5F, 0x100, 0x28, 0x100, 0x29,
+		0x100, 0x7B, 0x100, 0x7D, 0x100, 0x3014, 0x100, 0x3015, 0x100, 0x3010, 0x100, 0x3011,
+		0x100, 0x300A, 0x100, 0x300B, 0x100, 0x3008, 0x100, 0x3009, 0x100, 0x300C, 0x100, 0x300D,
+		0x100, 0x300E, 0x100, 0x300F, 0x100, 0x5B, 0x100, 0x5D, 0x200, 0x20, 0x305, 0x200,
+		0x20, 0x305, 0x200, 0x20, 0x305, 0x200, 0x20, 0x305, 0x100, 0x5F, 0x100, 0x5F,
+		0x100, 0x5F, 0x100, 0x2C, 0x100, 0x3001, 0x100, 0x2E, 0x100, 0x3B, 0x100, 0x3A,
+		0x100, 0x3F, 0x100, 0x21, 0x100, 0x2014, 0x100, 0x28, 0x100, 0x29, 0x100, 0x7B,
+		0x100, 0x7D, 0x100, 0x3014, 0x100, 0x3015, 0x100, 0x23, 0x100, 0x26, 0x100, 0x2A,
+		0x100, 0x2B, 0x100, 0x2D, 0x100, 0x3C, 0x100, 0x3E, 0x100, 0x3D, 0x100, 0x5C,
+		0x100, 0x24, 0x100, 0x25, 0x100, 0x40, 0x200, 0x20, 0x64B, 0x200, 0x640, 0x64B,
+		0x200, 0x20, 0x64C, 0x200, 0x20, 0x64D, 0x200, 0x20, 0x64E, 0x200, 0x640, 0x64E,
+		0x200, 0x20, 0x64F, 0x200, 0x640, 0x64F, 0x200, 0x20, 0x650, 0x200, 0x640, 0x650,
+		0x200, 0x20, 0x651, 0x200, 0x640, 0x651, 0x200, 0x20, 0x652, 0x200, 0x640, 0x652,
+		0x100, 0x621, 0x200, 0x627, 0x653, 0x200, 0x627, 0x653, 0x200, 0x627, 0x654, 0x200,
+		0x627, 0x654, 0x200, 0x648, 0x654, 0x200, 0x648, 0x654, 0x200, 0x627, 0x655, 0x200,
+		0x627, 0x655, 0x200, 0x64A, 0x654, 0x200, 0x64A, 0x654, 0x200, 0x64A, 0x654, 0x200,
+		0x64A, 0x654, 0x100, 0x627, 0x100, 0x627, 0x100, 0x628, 0x100, 0x628, 0x100, 0x628,
+		0x100, 0x628, 0x100, 0x629, 0x100, 0x629, 0x100, 0x62A, 0x100, 0x62A, 0x100, 0x62A,
+		0x100, 0x62A, 0x100, 0x62B, 0x100, 0x62B, 0x100, 0x62B, 0x100, 0x62B, 0x100, 0x62C,
+		0x100, 0x62C, 0x100, 0x62C, 0x100, 0x62C, 0x100, 0x62D, 0x100, 0x62D, 0x100, 0x62D,
+		0x100, 0x62D, 0x100, 0x62E, 0x100, 0x62E, 0x100, 0x62E, 0x100, 0x62E, 0x100, 0x62F,
+		0x100, 0x62F, 0x100, 0x630, 0x100, 0x630, 0x100, 0x631, 0x100, 0x631, 0x100, 0x632,
+		0x100, 0x632, 0x100, 0x633, 0x100, 0x633, 0x100, 0x633, 0x100, 0x633, 0x100, 0x634,
+		0x100, 0x634, 0x100, 0x634, 0x100, 0x634, 0x100, 0x635, 0x100, 0x635, 0x100, 0x635,
+		0x100, 0x635, 0x100, 0x636, 0x100, 0x636, 0x100, 0x636, 0x100, 0x636, 0x100, 0x637,
+		0x100, 0x637, 0x100, 0x637, 0x100, 0x637, 0x100, 0x638, 0x100, 0x638, 0x100, 0x638,
+		0x100, 0x638, 0x100, 0x639, 0x100, 0x639, 0x100, 0x639, 0x100, 0x639, 0x100, 0x63A,
+		0x100, 0x63A, 0x100, 0x63A, 0x100, 0x63A, 0x100, 0x641, 0x100, 0x641, 0x100, 0x641,
+		0x100, 0x641, 0x100, 0x642, 0x100, 0x642, 0x100, 0x642, 0x100, 0x642, 0x100, 0x643,
+		0x100, 0x643, 0x100, 0x643, 0x100, 0x643, 0x100, 0x644, 0x100, 0x644, 0x100, 0x644,
+		0x100, 0x644, 0x100, 0x645, 0x100, 0x645, 0x100, 0x645, 0x100, 0x645, 0x100, 0x646,
+		0x100, 0x646, 0x100, 0x646, 0x100, 0x646, 0x100, 0x647, 0x100, 0x647, 0x100, 0x647,
+		0x100, 0x647, 0x100, 0x648, 0x100, 0x648, 0x100, 0x649, 0x100, 0x649, 0x100, 0x64A,
+		0x100, 0x64A, 0x100, 0x64A, 0x100, 0x64A, 0x300, 0x644, 0x627, 0x653, 0x300, 0x644,
+		0x627, 0x653, 0x300, 0x644, 0x627, 0x654, 0x300, 0x644, 0x627, 0x654, 0x300, 0x644,
+		0x627, 0x655, 0x300, 0x644, 0x627, 0x655, 0x200, 0x644, 0x627, 0x200, 0x644, 0x627,
+		0x100, 0x21, 0x100, 0x22, 0x100, 0x23, 0x100, 0x24, 0x100, 0x25, 0x100, 0x26,
+		0x100, 0x27, 0x100, 0x28, 0x100, 0x29, 0x100, 0x2A, 0x100, 0x2B, 0x100, 0x2C,
+		0x100, 0x2D, 0x100, 0x2E, 0x100, 0x2F, 0x100, 0x30, 0x100, 0x31, 0x100, 0x32,
+		0x100, 0x33, 0x100, 0x34, 0x100, 0x35, 0x100, 0x36, 0x100, 0x37, 0x100, 0x38,
+		0x100, 0x39, 0x100, 0x3A, 0x100, 0x3B, 0x100, 0x3C, 0x100, 0x3D, 0x100, 0x3E,
+		0x100, 0x3F, 0x100, 0x40, 0x100, 0x41, 0x100, 0x42, 0x100, 0x43, 0x100, 0x44,
+		0x100, 0x45, 0x100, 0x46, 0x100, 0x47, 0x100, 0x48, 0x100, 0x49, 0x100, 0x4A,
+		0x100, 0x4B, 0x100, 0x4C, 0x100, 0x4D, 0x100, 0x4E, 0x100, 0x4F, 0x100, 0x50,
+		0x100, 0x51, 0x100, 0x52, 0x100, 0x53, 0x100, 0x54, 0x100, 0x55, 0x100, 0x56,
+		0x100, 0x57, 0x100, 0x58, 0x100, 0x59, 0x100, 0x5A, 0x100, 0x5B, 0x100, 0x5C,
+		0x100, 0x5D, 0x100, 0x5E, 0x100, 0x5F, 0x100, 0x60, 0x100, 0x61, 0x100, 0x62,
+		0x100, 0x63, 0x100, 0x64, 0x100, 0x65, 0x100, 0x66, 0x100, 0x67, 0x100, 0x68,
+		0x100, 0x69, 0x100, 0x6A, 0x100, 0x6B, 0x100, 0x6C, 0x100, 0x6D, 0x100, 0x6E,
+		0x100, 0x6F, 0x100, 0x70, 0x100, 0x71, 0x100, 0x72, 0x100, 0x73, 0x100, 0x74,
+		0x100, 0x75, 0x100, 0x76, 0x100, 0x77, 0x100, 0x78, 0x100, 0x79, 0x100, 0x7A,
+		0x100, 0x7B, 0x100, 0x7C, 0x100, 0x7D, 0x100, 0x7E, 0x100, 0x2985, 0x100, 0x2986,
+		0x100, 0x3002, 0x100, 0x300C, 0x100, 0x300D, 0x100, 0x3001, 0x100, 0x30FB, 0x100, 0x30F2,
+		0x100, 0x30A1, 0x100, 0x30A3, 0x100, 0x30A5, 0x100, 0x30A7, 0x100, 0x30A9, 0x100, 0x30E3,
+		0x100, 0x30E5, 0x100, 0x30E7, 0x100, 0x30C3, 0x100, 0x30FC, 0x100, 0x30A2, 0x100, 0x30A4,
+		0x100, 0x30A6, 0x100, 0x30A8, 0x100, 0x30AA, 0x100, 0x30AB, 0x100, 0x30AD, 0x100, 0x30AF,
+		0x100, 0x30B1, 0x100, 0x30B3, 0x100, 0x30B5, 0x100, 0x30B7, 0x100, 0x30B9, 0x100, 0x30BB,
+		0x100, 0x30BD, 0x100, 0x30BF, 0x100, 0x30C1, 0x100, 0x30C4, 0x100, 0x30C6, 0x100, 0x30C8,
+		0x100, 0x30CA, 0x100, 0x30CB, 0x100, 0x30CC, 0x100, 0x30CD, 0x100, 0x30CE, 0x100, 0x30CF,
+		0x100, 0x30D2, 0x100, 0x30D5, 0x100, 0x30D8, 0x100, 0x30DB, 0x100, 0x30DE, 0x100, 0x30DF,
+		0x100, 0x30E0, 0x100, 0x30E1, 0x100, 0x30E2, 0x100, 0x30E4, 0x100, 0x30E6, 0x100, 0x30E8,
+		0x100, 0x30E9, 0x100, 0x30EA, 0x100, 0x30EB, 0x100, 0x30EC, 0x100, 0x30ED, 0x100, 0x30EF,
+		0x100, 0x30F3, 0x100, 0x3099, 0x100, 0x309A, 0x100, 0x1160, 0x100, 0x1100, 0x100, 0x1101,
+		0x100, 0x11AA, 0x100, 0x1102, 0x100, 0x11AC, 0x100, 0x11AD, 0x100, 0x1103, 0x100, 0x1104,
+		0x100, 0x1105, 0x100, 0x11B0, 0x100, 0x11B1, 0x100, 0x11B2, 0x100, 0x11B3, 0x100, 0x11B4,
+		0x100, 0x11B5, 0x100, 0x111A, 0x100, 0x1106, 0x100, 0x1107, 0x100, 0x1108, 0x100, 0x1121,
+		0x100, 0x1109, 0x100, 0x110A, 0x100, 0x110B, 0x100, 0x110C, 0x100, 0x110D, 0x100, 0x110E,
+		0x100, 0x110F, 0x100, 0x1110, 0x100, 0x1111, 0x100, 0x1112, 0x100, 0x1161, 0x100, 0x1162,
+		0x100, 0x1163, 0x100, 0x1164, 0x100, 0x1165, 0x100, 0x1166, 0x100, 0x1167, 0x100, 0x1168,
+		0x100, 0x1169, 0x100, 0x116A, 0x100, 0x116B, 0x100, 0x116C, 0x100, 0x116D, 0x100, 0x116E,
+		0x100, 0x116F, 0x100, 0x1170, 0x100, 0x1171, 0x100, 0x1172, 0x100, 0x1173, 0x100, 0x1174,
+		0x100, 0x1175, 0x100, 0xA2, 0x100, 0xA3, 0x100, 0xAC, 0x200, 0x20, 0x304, 0x100,
+		0xA6, 0x100, 0xA5, 0x100, 0x20A9, 0x100, 0x2502, 0x100, 0x2190, 0x100, 0x2191, 0x100,
+		0x2192, 0x100, 0x2193, 0x100, 0x25A0, 0x100, 0x25CB, 0x100, 0x2D0, 0x100, 0x2D1, 0x100,
+		0xE6, 0x100, 0x299, 0x100, 0x253, 0x100, 0x2A3, 0x100, 0xAB66, 0x100, 0x2A5, 0x100,
+		0x2A4, 0x100, 0x256, 0x100, 0x257, 0x100, 0x1D91, 0x100, 0x258, 0x100, 0x25E, 0x100,
+		0x2A9, 0x100, 0x264, 0x100, 0x262, 0x100, 0x260, 0x100, 0x29B, 0x100, 0x127, 0x100,
+		0x29C, 0x100, 0x267, 0x100, 0x284, 0x100, 0x2AA, 0x100, 0x2AB, 0x100, 0x26C, 0x100,
+		0x1DF04, 0x100, 0xA78E, 0x100, 0x26E, 0x100, 0x1DF05, 0x100, 0x28E, 0x100, 0x1DF06, 0x100,
+		0xF8, 0x100, 0x276, 0x100, 0x277, 0x100, 0x71, 0x100, 0x27A, 0x100, 0x1DF08, 0x100,
+		0x27D, 0x100, 0x27E, 0x100, 0x280, 0x100, 0x2A8, 0x100, 0x2A6, 0x100, 0xAB67, 0x100,
+		0x2A7, 0x100, 0x288, 0x100, 0x2C71, 0x100, 0x28F, 0x100, 0x2A1, 0x100, 0x2A2, 0x100,
+		0x298, 0x100, 0x1C0, 0x100, 0x1C1, 0x100, 0x1C2, 0x100, 0x1DF0A, 0x100, 0x1DF1E, 0x2,
+		0x11099, 0x110BA, 0x2, 0x1109B, 0x110BA, 0x2, 0x110A5, 0x110BA, 0x2, 0x11131, 0x11127, 0x2,
+		0x11132, 0x11127, 0x2, 0x11347, 0x1133E, 0x2, 0x11347, 0x11357, 0x2, 0x114B9, 0x114BA, 0x2,
+		0x114B9, 0x114B0, 0x2, 0x114B9, 0x114BD, 0x2, 0x115B8, 0x115AF, 0x2, 0x115B9, 0x115AF, 0x2,
+		0x11935, 0x11930, 0x2, 0x1D157, 0x1D165, 0x2, 0x1D158, 0x1D165, 0x3, 0x1D158, 0x1D165, 0x1D16E,
+		0x3, 0x1D158, 0x1D165, 0x1D16F, 0x3, 0x1D158, 0x1D165, 0x1D170, 0x3, 0x1D158, 0x1D165, 0x1D171,
+		0x3, 0x1D158, 0x1D165, 0x1D172, 0x2, 0x1D1B9, 0x1D165, 0x2, 0x1D1BA, 0x1D165, 0x3, 0x1D1B9,
+		0x1D165, 0x1D16E, 0x3, 0x1D1BA, 0x1D165, 0x1D16E, 0x3, 0x1D1B9, 0x1D165, 0x1D16F, 0x3, 0x1D1BA,
+		0x1D165, 0x1D16F, 0x100, 0x41, 0x100, 0x42, 0x100, 0x43, 0x100, 0x44, 0x100, 0x45,
+		0x100, 0x46, 0x100, 0x47, 0x100, 0x48, 0x100, 0x49, 0x100, 0x4A, 0x100, 0x4B,
+		0x100, 0x4C, 0x100, 0x4D, 0x100, 0x4E, 0x100, 0x4F, 0x100, 0x50, 0x100, 0x51,
+		0x100, 0x52, 0x100, 0x53, 0x100, 0x54, 0x100, 0x55, 0x100, 0x56, 0x100, 0x57,
+		0x100, 0x58, 0x100, 0x59, 0x100, 0x5A, 0x100, 0x61, 0x100, 0x62, 0x100, 0x63,
+		0x100, 0x64, 0x100, 0x65, 0x100, 0x66, 0x100, 0x67, 0x100, 0x68, 0x100, 0x69,
+		0x100, 0x6A, 0x100, 0x6B, 0x100, 0x6C, 0x100, 0x6D, 0x100, 0x6E, 0x100, 0x6F,
+		0x100, 0x70, 0x100, 0x71, 0x100, 0x72, 0x100, 0x73, 0x100, 0x74, 0x100, 0x75,
+		0x100, 0x76, 0x100, 0x77, 0x100, 0x78, 0x100, 0x79, 0x100, 0x7A, 0x100, 0x41,
+		0x100, 0x42, 0x100, 0x43, 0x100, 0x44, 0x100, 0x45, 0x100, 0x46, 0x100, 0x47,
+		0x100, 0x48, 0x100, 0x49, 0x100, 0x4A, 0x100, 0x4B, 0x100, 0x4C, 0x100, 0x4D,
+		0x100, 0x4E, 0x100, 0x4F, 0x100, 0x50, 0x100, 0x51, 0x100, 0x52, 0x100, 0x53,
+		0x100, 0x54, 0x100, 0x55, 0x100, 0x56, 0x100, 0x57, 0x100, 0x58, 0x100, 0x59,
+		0x100, 0x5A, 0x100, 0x61, 0x100, 0x62, 0x100, 0x63, 0x100, 0x64, 0x100, 0x65,
+		0x100, 0x66, 0x100, 0x67, 0x100, 0x69, 0x100, 0x6A, 0x100, 0x6B, 0x100, 0x6C,
+		0x100, 0x6D, 0x100, 0x6E, 0x100, 0x6F, 0x100, 0x70, 0x100, 0x71, 0x100, 0x72,
+		0x100, 0x73, 0x100, 0x74, 0x100, 0x75, 0x100, 0x76, 0x100, 0x77, 0x100, 0x78,
+		0x100, 0x79, 0x100, 0x7A, 0x100, 0x41, 0x100, 0x42, 0x100, 0x43, 0x100, 0x44,
+		0x100, 0x45, 0x100, 0x46, 0x100, 0x47, 0x100, 0x48, 0x100, 0x49, 0x100, 0x4A,
+		0x100, 0x4B, 0x100, 0x4C, 0x100, 0x4D, 0x100, 0x4E, 0x100, 0x4F, 0x100, 0x50,
+		0x100, 0x51, 0x100, 0x52, 0x100, 0x53, 0x100, 0x54, 0x100, 0x55, 0x100, 0x56,
+		0x100, 0x57, 0x100, 0x58, 0x100, 0x59, 0x100, 0x5A, 0x100, 0x61, 0x100, 0x62,
+		0x100, 0x63, 0x100, 0x64, 0x100, 0x65, 0x100, 0x66, 0x100, 0x67, 0x100, 0x68,
+		0x100, 0x69, 0x100, 0x6A, 0x100, 0x6B, 0x100, 0x6C, 0x100, 0x6D, 0x100, 0x6E,
+		0x100, 0x6F, 0x100, 0x70, 0x100, 0x71, 0x100, 0x72, 0x100, 0x73, 0x100, 0x74,
+		0x100, 0x75, 0x100, 0x76, 0x100, 0x77, 0x100, 0x78, 0x100, 0x79, 0x100, 0x7A,
+		0x100, 0x41, 0x100, 0x43, 0x100, 0x44, 0x100, 0x47, 0x100, 0x4A, 0x100, 0x4B,
+		0x100, 0x4E, 0x100, 0x4F, 0x100, 0x50, 0x100, 0x51, 0x100, 0x53, 0x100, 0x54,
+		0x100, 0x55, 0x100, 0x56, 0x100, 0x57, 0x100, 0x58, 0x100, 0x59, 0x100, 0x5A,
+		0x100, 0x61, 0x100, 0x62, 0x100, 0x63, 0x100, 0x64, 0x100, 0x66, 0x100, 0x68,
+		0x100, 0x69, 0x100, 0x6A, 0x100, 0x6B, 0x100, 0x6C, 0x100, 0x6D, 0x100, 0x6E,
+		0x100, 0x70, 0x100, 0x71, 0x100, 0x72, 0x100, 0x73, 0x100, 0x74, 0x100, 0x75,
+		0x100, 0x76, 0x100, 0x77, 0x100, 0x78, 0x100, 0x79, 0x100, 0x7A, 0x100, 0x41,
+		0x100, 0x42, 0x100, 0x43, 0x100, 0x44, 0x100, 0x45, 0x100, 0x46, 0x100, 0x47,
+		0x100, 0x48, 0x100, 0x49, 0x100, 0x4A, 0x100, 0x4B, 0x100, 0x4C, 0x100, 0x4D,
+		0x100, 0x4E, 0x100, 0x4F, 0x100, 0x50, 0x100, 0x51, 0x100, 0x52, 0x100, 0x53,
+		0x100, 0x54, 0x100, 0x55, 0x100, 0x56, 0x100, 0x57, 0x100, 0x58, 0x100, 0x59,
+		0x100, 0x5A, 0x100, 0x61, 0x100, 0x62, 0x100, 0x63, 0x100, 0x64, 0x100, 0x65,
+		0x100, 0x66, 0x100, 0x67, 0x100, 0x68, 0x100, 0x69, 0x100, 0x6A, 0x100, 0x6B,
+		0x100, 0x6C, 0x100, 0x6D, 0x100, 0x6E, 0x100, 0x6F, 0x100, 0x70, 0x100, 0x71,
+		0x100, 0x72, 0x100, 0x73, 0x100, 0x74, 0x100, 0x75, 0x100, 0x76, 0x100, 0x77,
+		0x100, 0x78, 0x100, 0x79, 0x100, 0x7A, 0x100, 0x41, 0x100, 0x42, 0x100, 0x44,
+		0x100, 0x45, 0x100, 0x46, 0x100, 0x47, 0x100, 0x4A, 0x100, 0x4B, 0x100, 0x4C,
+		0x100, 0x4D, 0x100, 0x4E, 0x100, 0x4F, 0x100, 0x50, 0x100, 0x51, 0x100, 0x53,
+		0x100, 0x54, 0x100, 0x55, 0x100, 0x56, 0x100, 0x57, 0x100, 0x58, 0x100, 0x59,
+		0x100, 0x61, 0x100, 0x62, 0x100, 0x63, 0x100, 0x64, 0x100, 0x65, 0x100, 0x66,
+		0x100, 0x67, 0x100, 0x68, 0x100, 0x69, 0x100, 0x6A, 0x100, 0x6B, 0x100, 0x6C,
+		0x100, 0x6D, 0x100, 0x6E, 0x100, 0x6F, 0x100, 0x70, 0x100, 0x71, 0x100, 0x72,
+		0x100, 0x73, 0x100, 0x74, 0x100, 0x75, 0x100, 0x76, 0x100, 0x77, 0x100, 0x78,
+		0x100, 0x79, 0x100, 0x7A, 0x100, 0x41, 0x100, 0x42, 0x100, 0x44, 0x100, 0x45,
+		0x100, 0x46, 0x100, 0x47, 0x100, 0x49, 0x100, 0x4A, 0x100, 0x4B, 0x100, 0x4C,
+		0x100, 0x4D, 0x100, 0x4F, 0x100, 0x53, 0x100, 0x54, 0x100, 0x55, 0x100, 0x56,
+		0x100, 0x57, 0x100, 0x58, 0x100, 0x59, 0x100, 0x61, 0x100, 0x62, 0x100, 0x63,
+		0x100, 0x64, 0x100, 0x65, 0x100, 0x66, 0x100, 0x67, 0x100, 0x68, 0x100, 0x69,
+		0x100, 0x6A, 0x100, 0x6B, 0x100, 0x6C, 0x100, 0x6D, 0x100, 0x6E, 0x100, 0x6F,
+		0x100, 0x70, 0x100, 0x71, 0x100, 0x72, 0x100, 0x73, 0x100, 0x74, 0x100, 0x75,
+		0x100, 0x76, 0x100, 0x77, 0x100, 0x78, 0x100, 0x79, 0x100, 0x7A, 0x100, 0x41,
+		0x100, 0x42, 0x100, 0x43, 0x100, 0x44, 0x100, 0x45, 0x100, 0x46, 0x100, 0x47,
+		0x100, 0x48, 0x100, 0x49, 0x100, 0x4A, 0x100, 0x4B, 0x100, 0x4C, 0x100, 0x4D,
+		0x100, 0x4E, 0x100, 0x4F, 0x100, 0x50, 0x100, 0x51, 0x100, 0x52, 0x100, 0x53,
+		0x100, 0x54, 0x100, 0x55, 0x100, 0x56, 0x100, 0x57, 0x100, 0x58, 0x100, 0x59,
+		0x100, 0x5A, 0x100, 0x61, 0x100, 0x62, 0x100, 0x63, 0x100, 0x64, 0x100, 0x65,
+		0x100, 0x66, 0x100, 0x67, 0x100, 0x68, 0x100, 0x69, 0x100, 0x6A, 0x100, 0x6B,
+		0x100, 0x6C, 0x100, 0x6D, 0x100, 0x6E, 0x100, 0x6F, 0x100, 0x70, 0x100, 0x71,
+		0x100, 0x72, 0x100, 0x73, 0x100, 0x74, 0x100, 0x75, 0x100, 0x76, 0x100, 0x77,
+		0x100, 0x78, 0x100, 0x79, 0x100, 0x7A, 0x100, 0x41, 0x100, 0x42, 0x100, 0x43,
+		0x100, 0x44, 0x100, 0x45, 0x100, 0x46, 0x100, 0x47, 0x100, 0x48, 0x100, 0x49,
+		0x100, 0x4A, 0x100, 0x4B, 0x100, 0x4C, 0x100, 0x4D, 0x100, 0x4E, 0x100, 0x4F,
+		0x100, 0x50, 0x100, 0x51, 0x100, 0x52, 0x100, 0x53, 0x100, 0x54, 0x100, 0x55,
+		0x100, 0x56, 0x100, 0x57, 0x100, 0x58, 0x100, 0x59, 0x100, 0x5A, 0x100, 0x61,
+		0x100, 0x62, 0x100, 0x63, 0x100, 0x64, 0x100, 0x65, 0x100, 0x66, 0x100, 0x67,
+		0x100, 0x68, 0x100, 0x69, 0x100, 0x6A, 0x100, 0x6B, 0x100, 0x6C, 0x100, 0x6D,
+		0x100, 0x6E, 0x100, 0x6F, 0x100, 0x70, 0x100, 0x71, 0x100, 0x72, 0x100, 0x73,
+		0x100, 0x74, 0x100, 0x75, 0x100, 0x76, 0x100, 0x77, 0x100, 0x78, 0x100, 0x79,
+		0x100, 0x7A, 0x100, 0x41, 0x100, 0x42, 0x100, 0x43, 0x100, 0x44, 0x100, 0x45,
+		0x100, 0x46, 0x100, 0x47, 0x100, 0x48, 0x100, 0x49, 0x100, 0x4A, 0x100, 0x4B,
+		0x100, 0x4C, 0x100, 0x4D, 0x100, 0x4E, 0x100, 0x4F, 0x100, 0x50, 0x100, 0x51,
+		0x100, 0x52, 0x100, 0x53, 0x100, 0x54, 0x100, 0x55, 0x100, 0x56, 0x100, 0x57,
+		0x100, 0x58, 0x100, 0x59, 0x100, 0x5A, 0x100, 0x61, 0x100, 0x62, 0x100, 0x63,
+		0x100, 0x64, 0x100, 0x65, 0x100, 0x66, 0x100, 0x67, 0x100, 0x68, 0x100, 0x69,
+		0x100, 0x6A, 0x100, 0x6B, 0x100, 0x6C, 0x100, 0x6D, 0x100, 0x6E, 0x100, 0x6F,
+		0x100, 0x70, 0x100, 0x71, 0x100, 0x72, 0x100, 0x73, 0x100, 0x74, 0x100, 0x75,
+		0x100, 0x76, 0x100, 0x77, 0x100, 0x78, 0x100, 0x79, 0x100, 0x7A, 0x100, 0x41,
+		0x100, 0x42, 0x100, 0x43, 0x100, 0x44, 0x100, 0x45, 0x100, 0x46, 0x100, 0x47,
+		0x100, 0x48, 0x100, 0x49, 0x100, 0x4A, 0x100, 0x4B, 0x100, 0x4C, 0x100, 0x4D,
+		0x100, 0x4E, 0x100, 0x4F, 0x100, 0x50, 0x100, 0x51, 0x100, 0x52, 0x100, 0x53,
+		0x100, 0x54, 0x100, 0x55, 0x100, 0x56, 0x100, 0x57, 0x100, 0x58, 0x100, 0x59,
+		0x100, 0x5A, 0x100, 0x61, 0x100, 0x62, 0x100, 0x63, 0x100, 0x64, 0x100, 0x65,
+		0x100, 0x66, 0x100, 0x67, 0x100, 0x68, 0x100, 0x69, 0x100, 0x6A, 0x100, 0x6B,
+		0x100, 0x6C, 0x100, 0x6D, 0x100, 0x6E, 0x100, 0x6F, 0x100, 0x70, 0x100, 0x71,
+		0x100, 0x72, 0x100, 0x73, 0x100, 0x74, 0x100, 0x75, 0x100, 0x76, 0x100, 0x77,
+		0x100, 0x78, 0x100, 0x79, 0x100, 0x7A, 0x100, 0x41, 0x100, 0x42, 0x100, 0x43,
+		0x100, 0x44, 0x100, 0x45, 0x100, 0x46, 0x100, 0x47, 0x100, 0x48, 0x100, 0x49,
+		0x100, 0x4A, 0x100, 0x4B, 0x100, 0x4C, 0x100, 0x4D, 0x100, 0x4E, 0x100, 0x4F,
+		0x100, 0x50, 0x100, 0x51, 0x100, 0x52, 0x100, 0x53, 0x100, 0x54, 0x100, 0x55,
+		0x100, 0x56, 0x100, 0x57, 0x100, 0x58, 0x100, 0x59, 0x100, 0x5A, 0x100, 0x61,
+		0x100, 0x62, 0x100, 0x63, 0x100, 0x64, 0x100, 0x65, 0x100, 0x66, 0x100, 0x67,
+		0x100, 0x68, 0x100, 0x69, 0x100, 0x6A, 0x100, 0x6B, 0x100, 0x6C, 0x100, 0x6D,
+		0x100, 0x6E, 0x100, 0x6F, 0x100, 0x70, 0x100, 0x71, 0x100, 0x72, 0x100, 0x73,
+		0x100, 0x74, 0x100, 0x75, 0x100, 0x76, 0x100, 0x77, 0x100, 0x78, 0x100, 0x79,
+		0x100, 0x7A, 0x100, 0x41, 0x100, 0x42, 0x100, 0x43, 0x100, 0x44, 0x100, 0x45,
+		0x100, 0x46, 0x100, 0x47, 0x100, 0x48, 0x100, 0x49, 0x100, 0x4A, 0x100, 0x4B,
+		0x100, 0x4C, 0x100, 0x4D, 0x100, 0x4E, 0x100, 0x4F, 0x100, 0x50, 0x100, 0x51,
+		0x100, 0x52, 0x100, 0x53, 0x100, 0x54, 0x100, 0x55, 0x100, 0x56, 0x100, 0x57,
+		0x100, 0x58, 0x100, 0x59, 0x100, 0x5A, 0x100, 0x61, 0x100, 0x62, 0x100, 0x63,
+		0x100, 0x64, 0x100, 0x65, 0x100, 0x66, 0x100, 0x67, 0x100, 0x68, 0x100, 0x69,
+		0x100, 0x6A, 0x100, 0x6B, 0x100, 0x6C, 0x100, 0x6D, 0x100, 0x6E, 0x100, 0x6F,
+		0x100, 0x70, 0x100, 0x71, 0x100, 0x72, 0x100, 0x73, 0x100, 0x74, 0x100, 0x75,
+		0x100, 0x76, 0x100, 0x77, 0x100, 0x78, 0x100, 0x79, 0x100, 0x7A, 0x100, 0x131,
+		0x100, 0x237, 0x100, 0x391, 0x100, 0x392, 0x100, 0x393, 0x100, 0x394, 0x100, 0x395,
+		0x100, 0x396, 0x100, 0x397, 0x100, 0x398, 0x100, 0x399, 0x100, 0x39A, 0x100, 0x39B,
+		0x100, 0x39C, 0x100, 0x39D, 0x100, 0x39E, 0x100, 0x39F, 0x100, 0x3A0, 0x100, 0x3A1,
+		0x100, 0x398, 0x100, 0x3A3, 0x100, 0x3A4, 0x100, 0x3A5, 0x100, 0x3A6, 0x100, 0x3A7,
+		0x100, 0x3A8, 0x100, 0x3A9, 0x100, 0x2207, 0x100, 0x3B1, 0x100, 0x3B2, 0x100, 0x3B3,
+		0x100, 0x3B4, 0x100, 0x3B5, 0x100, 0x3B6, 0x100, 0x3B7, 0x100, 0x3B8, 0x100, 0x3B9,
+		0x100, 0x3BA, 0x100, 0x3BB, 0x100, 0x3BC, 0x100, 0x3BD, 0x100, 0x3BE, 0x100, 0x3BF,
+		0x100, 0x3C0, 0x100, 0x3C1, 0x100, 0x3C2, 0x100, 0x3C3, 0x100, 0x3C4, 0x100, 0x3C5,
+		0x100, 0x3C6, 0x100, 0x3C7, 0x100, 0x3C8, 0x100, 0x3C9, 0x100, 0x2202, 0x100, 0x3B5,
+		0x100, 0x3B8, 0x100, 0x3BA, 0x100, 0x3C6, 0x100, 0x3C1, 0x100, 0x3C0, 0x100, 0x391,
+		0x100, 0x392, 0x100, 0x393, 0x100, 0x394, 0x100, 0x395, 0x100, 0x396, 0x100, 0x397,
+		0x100, 0x398, 0x100, 0x399, 0x100, 0x39A, 0x100, 0x39B, 0x100, 0x39C, 0x100, 0x39D,
+		0x100, 0x39E, 0x100, 0x39F, 0x100, 0x3A0, 0x100, 0x3A1, 0x100, 0x398, 0x100, 0x3A3,
+		0x100, 0x3A4, 0x100, 0x3A5, 0x100, 0x3A6, 0x100, 0x3A7, 0x100, 0x3A8, 0x100, 0x3A9,
+		0x100, 0x2207, 0x100, 0x3B1, 0x100, 0x3B2, 0x100, 0x3B3, 0x100, 0x3B4, 0x100, 0x3B5,
+		0x100, 0x3B6, 0x100, 0x3B7, 0x100, 0x3B8, 0x100, 0x3B9, 0x100, 0x3BA, 0x100, 0x3BB,
+		0x100, 0x3BC, 0x100, 0x3BD, 0x100, 0x3BE, 0x100, 0x3BF, 0x100, 0x3C0, 0x100, 0x3C1,
+		0x100, 0x3C2, 0x100, 0x3C3, 0x100, 0x3C4, 0x100, 0x3C5, 0x100, 0x3C6, 0x100, 0x3C7,
+		0x100, 0x3C8, 0x100, 0x3C9, 0x100, 0x2202, 0x100, 0x3B5, 0x100, 0x3B8, 0x100, 0x3BA,
+		0x100, 0x3C6, 0x100, 0x3C1, 0x100, 0x3C0, 0x100, 0x391, 0x100, 0x392, 0x100, 0x393,
+		0x100, 0x394, 0x100, 0x395, 0x100, 0x396, 0x100, 0x397, 0x100, 0x398, 0x100, 0x399,
+		0x100, 0x39A, 0x100, 0x39B, 0x100, 0x39C, 0x100, 0x39D, 0x100, 0x39E, 0x100, 0x39F,
+		0x100, 0x3A0, 0x100, 0x3A1, 0x100, 0x398, 0x100, 0x3A3, 0x100, 0x3A4, 0x100, 0x3A5,
+		0x100, 0x3A6, 0x100, 0x3A7, 0x100, 0x3A8, 0x100, 0x3A9, 0x100, 0x2207, 0x100, 0x3B1,
+		0x100, 0x3B2, 0x100, 0x3B3, 0x100, 0x3B4, 0x100, 0x3B5, 0x100, 0x3B6, 0x100, 0x3B7,
+		0x100, 0x3B8, 0x100, 0x3B9, 0x100, 0x3BA, 0x100, 0x3BB, 0x100, 0x3BC, 0x100, 0x3BD,
+		0x100, 0x3BE, 0x100, 0x3BF, 0x100, 0x3C0, 0x100, 0x3C1, 0x100, 0x3C2, 0x100, 0x3C3,
+		0x100, 0x3C4, 0x100, 0x3C5, 0x100, 0x3C6, 0x100, 0x3C7, 0x100, 0x3C8, 0x100, 0x3C9,
+		0x100, 0x2202, 0x100, 0x3B5, 0x100, 0x3B8, 0x100, 0x3BA, 0x100, 0x3C6, 0x100, 0x3C1,
+		0x100, 0x3C0, 0x100, 0x391, 0x100, 0x392, 0x100, 0x393, 0x100, 0x394, 0x100, 0x395,
+		0x100, 0x396, 0x100, 0x397, 0x100, 0x398, 0x100, 0x399, 0x100, 0x39A, 0x100, 0x39B,
+		0x100, 0x39C, 0x100, 0x39D, 0x100, 0x39E, 0x100, 0x39F, 0x100, 0x3A0, 0x100, 0x3A1,
+		0x100, 0x398, 0x100, 0x3A3, 0x100, 0x3A4, 0x100, 0x3A5, 0x100, 0x3A6, 0x100, 0x3A7,
+		0x100, 0x3A8, 0x100, 0x3A9, 0x100, 0x2207, 0x100, 0x3B1, 0x100, 0x3B2, 0x100, 0x3B3,
+		0x100, 0x3B4, 0x100, 0x3B5, 0x100, 0x3B6, 0x100, 0x3B7, 0x100, 0x3B8, 0x100, 0x3B9,
+		0x100, 0x3BA, 0x100, 0x3BB, 0x100, 0x3BC, 0x100, 0x3BD, 0x100, 0x3BE, 0x100, 0x3BF,
+		0x100, 0x3C0, 0x100, 0x3C1, 0x100, 0x3C2, 0x100, 0x3C3, 0x100, 0x3C4, 0x100, 0x3C5,
+		0x100, 0x3C6, 0x100, 0x3C7, 0x100, 0x3C8, 0x100, 0x3C9, 0x100, 0x2202, 0x100, 0x3B5,
+		0x100, 0x3B8, 0x100, 0x3BA, 0x100, 0x3C6, 0x100, 0x3C1, 0x100, 0x3C0, 0x100, 0x391,
+		0x100, 0x392, 0x100, 0x393, 0x100, 0x394, 0x100, 0x395, 0x100, 0x396, 0x100, 0x397,
+		0x100, 0x398, 0x100, 0x399, 0x100, 0x39A, 0x100, 0x39B, 0x100, 0x39C, 0x100, 0x39D,
+		0x100, 0x39E, 0x100, 0x39F, 0x100, 0x3A0, 0x100, 0x3A1, 0x100, 0x398, 0x100, 0x3A3,
+		0x100, 0x3A4, 0x100, 0x3A5, 0x100, 0x3A6, 0x100, 0x3A7, 0x100, 0x3A8, 0x100, 0x3A9,
+		0x100, 0x2207, 0x100, 0x3B1, 0x100, 0x3B2, 0x100, 0x3B3, 0x100, 0x3B4, 0x100, 0x3B5,
+		0x100, 0x3B6, 0x100, 0x3B7, 0x100, 0x3B8, 0x100, 0x3B9, 0x100, 0x3BA, 0x100, 0x3BB,
+		0x100, 0x3BC, 0x100, 0x3BD, 0x100, 0x3BE, 0x100, 0x3BF, 0x100, 0x3C0, 0x100, 0x3C1,
+		0x100, 0x3C2, 0x100, 0x3C3, 0x100, 0x3C4, 0x100, 0x3C5, 0x100, 0x3C6, 0x100, 0x3C7,
+		0x100, 0x3C8, 0x100, 0x3C9, 0x100, 0x2202, 0x100, 0x3B5, 0x100, 0x3B8, 0x100, 0x3BA,
+		0x100, 0x3C6, 0x100, 0x3C1, 0x100, 0x3C0, 0x100, 0x3DC, 0x100, 0x3DD, 0x100, 0x30,
+		0x100, 0x31, 0x100, 0x32, 0x100, 0x33, 0x100, 0x34, 0x100, 0x35, 0x100, 0x36,
+		0x100, 0x37, 0x100, 0x38, 0x100, 0x39, 0x100, 0x30, 0x100, 0x31, 0x100, 0x32,
+		0x100, 0x33, 0x100, 0x34, 0x100, 0x35, 0x100, 0x36, 0x100, 0x37, 0x100, 0x38,
+		0x100, 0x39, 0x100, 0x30, 0x100, 0x31, 0x100, 0x32, 0x100, 0x33, 0x100, 0x34,
+		0x100, 0x35, 0x100, 0x36, 0x100, 0x37, 0x100, 0x38, 0x100, 0x39, 0x100, 0x30,
+		0x100, 0x31, 0x100, 0x32, 0x100, 0x33, 0x100, 0x34, 0x100, 0x35, 0x100, 0x36,
+		0x100, 0x37, 0x100, 0x38, 0x100, 0x39, 0x100, 0x30, 0x100, 0x31, 0x100, 0x32,
+		0x100, 0x33, 0x100, 0x34, 0x100, 0x35, 0x100, 0x36, 0x100, 0x37, 0x100, 0x38,
+		0x100, 0x39, 0x100, 0x627, 0x100, 0x628, 0x100, 0x62C, 0x100, 0x62F, 0x100, 0x648,
+		0x100, 0x632, 0x100, 0x62D, 0x100, 0x637, 0x100, 0x64A, 0x100, 0x643, 0x100, 0x644,
+		0x100, 0x645, 0x100, 0x646, 0x100, 0x633, 0x100, 0x639, 0x100, 0x641, 0x100, 0x635,
+		0x100, 0x642, 0x100, 0x631, 0x100, 0x634, 0x100, 0x62A, 0x100, 0x62B, 0x100, 0x62E,
+		0x100, 0x630, 0x100, 0x636, 0x100, 0x638, 0x100, 0x63A, 0x100, 0x66E, 0x100, 0x6BA,
+		0x100, 0x6A1, 0x100, 0x66F, 0x100, 0x628, 0x100, 0x62C, 0x100, 0x647, 0x100, 0x62D,
+		0x100, 0x64A, 0x100, 0x643, 0x100, 0x644, 0x100, 0x645, 0x100, 0x646, 0x100, 0x633,
+		0x100, 0x639, 0x100, 0x641, 0x100, 0x635, 0x100, 0x642, 0x100, 0x634, 0x100, 0x62A,
+		0x100, 0x62B, 0x100, 0x62E, 0x100, 0x636, 0x100, 0x63A, 0x100, 0x62C, 0x100, 0x62D,
+		0x100, 0x64A, 0x100, 0x644, 0x100, 0x646, 0x100, 0x633, 0x100, 0x639, 0x100, 0x635,
+		0x100, 0x642, 0x100, 0x634, 0x100, 0x62E, 0x100, 0x636, 0x100, 0x63A, 0x100, 0x6BA,
+		0x100, 0x66F, 0x100, 0x628, 0x100, 0x62C, 0x100, 0x647, 0x100, 0x62D, 0x100, 0x637,
+		0x100, 0x64A, 0x100, 0x643, 0x100, 0x645, 0x100, 0x646, 0x100, 0x633, 0x100, 0x639,
+		0x100, 0x641, 0x100, 0x635, 0x100, 0x642, 0x100, 0x634, 0x100, 0x62A, 0x100, 0x62B,
+		0x100, 0x62E, 0x100, 0x636, 0x100, 0x638, 0x100, 0x63A, 0x100, 0x66E, 0x100, 0x6A1,
+		0x100, 0x627, 0x100, 0x628, 0x100, 0x62C, 0x100, 0x62F, 0x100, 0x647, 0x100, 0x648,
+		0x100, 0x632, 0x100, 0x62D, 0x100, 0x637, 0x100, 0x64A, 0x100, 0x644, 0x100, 0x645,
+		0x100, 0x646, 0x100, 0x633, 0x100, 0x639, 0x100, 0x641, 0x100, 0x635, 0x100, 0x642,
+		0x100, 0x631, 0x100, 0x634, 0x100, 0x62A, 0x100, 0x62B, 0x100, 0x62E, 0x100, 0x630,
+		0x100, 0x636, 0x100, 0x638, 0x100, 0x63A, 0x100, 0x628, 0x100, 0x62C, 0x100, 0x62F,
+		0x100, 0x648, 0x100, 0x632, 0x100, 0x62D, 0x100, 0x637, 0x100, 0x64A, 0x100, 0x644,
+		0x100, 0x645, 0x100, 0x646, 0x100, 0x633, 0x100, 0x639, 0x100, 0x641, 0x100, 0x635,
+		0x100, 0x642, 0x100, 0x631, 0x100, 0x634, 0x100, 0x62A, 0x100, 0x62B, 0x100, 0x62E,
+		0x100, 0x630, 0x100, 0x636, 0x100, 0x638, 0x100, 0x63A, 0x200, 0x30, 0x2E, 0x200,
+		0x30, 0x2C, 0x200, 0x31, 0x2C, 0x200, 0x32, 0x2C, 0x200, 0x33, 0x2C, 0x200,
+		0x34, 0x2C, 0x200, 0x35, 0x2C, 0x200, 0x36, 0x2C, 0x200, 0x37, 0x2C, 0x200,
+		0x38, 0x2C, 0x200, 0x39, 0x2C, 0x300, 0x28, 0x41, 0x29, 0x300, 0x28, 0x42,
+		0x29, 0x300, 0x28, 0x43, 0x29, 0x300, 0x28, 0x44, 0x29, 0x300, 0x28, 0x45,
+		0x29, 0x300, 0x28, 0x46, 0x29, 0x300, 0x28, 0x47, 0x29, 0x300, 0x28, 0x48,
+		0x29, 0x300, 0x28, 0x49, 0x29, 0x300, 0x28, 0x4A, 0x29, 0x300, 0x28, 0x4B,
+		0x29, 0x300, 0x28, 0x4C, 0x29, 0x300, 0x28, 0x4D, 0x29, 0x300, 0x28, 0x4E,
+		0x29, 0x300, 0x28, 0x4F, 0x29, 0x300, 0x28, 0x50, 0x29, 0x300, 0x28, 0x51,
+		0x29, 0x300, 0x28, 0x52, 0x29, 0x300, 0x28, 0x53, 0x29, 0x300, 0x28, 0x54,
+		0x29, 0x300, 0x28, 0x55, 0x29, 0x300, 0x28, 0x56, 0x29, 0x300, 0x28, 0x57,
+		0x29, 0x300, 0x28, 0x58, 0x29, 0x300, 0x28, 0x59, 0x29, 0x300, 0x28, 0x5A,
+		0x29, 0x300, 0x3014, 0x53, 0x3015, 0x100, 0x43, 0x100, 0x52, 0x200, 0x43, 0x44,
+		0x200, 0x57, 0x5A, 0x100, 0x41, 0x100, 0x42, 0x100, 0x43, 0x100, 0x44, 0x100,
+		0x45, 0x100, 0x46, 0x100, 0x47, 0x100, 0x48, 0x100, 0x49, 0x100, 0x4A, 0x100,
+		0x4B, 0x100, 0x4C, 0x100, 0x4D, 0x100, 0x4E, 0x100, 0x4F, 0x100, 0x50, 0x100,
+		0x51, 0x100, 0x52, 0x100, 0x53, 0x100, 0x54, 0x100, 0x55, 0x100, 0x56, 0x100,
+		0x57, 0x100, 0x58, 0x100, 0x59, 0x100, 0x5A, 0x200, 0x48, 0x56, 0x200, 0x4D,
+		0x56, 0x200, 0x53, 0x44, 0x200, 0x53, 0x53, 0x300, 0x50, 0x50, 0x56, 0x200,
+		0x57, 0x43, 0x200, 0x4D, 0x43, 0x200, 0x4D, 0x44, 0x200, 0x4D, 0x52, 0x200,
+		0x44, 0x4A, 0x200, 0x307B, 0x304B, 0x200, 0x30B3, 0x30B3, 0x100, 0x30B5, 0x100, 0x624B,
+		0x100, 0x5B57, 0x100, 0x53CC, 0x200, 0x30C6, 0x3099, 0x100, 0x4E8C, 0x100, 0x591A, 0x100,
+		0x89E3, 0x100, 0x5929, 0x100, 0x4EA4, 0x100, 0x6620, 0x100, 0x7121, 0x100, 0x6599, 0x100,
+		0x524D, 0x100, 0x5F8C, 0x100, 0x518D, 0x100, 0x65B0, 0x100, 0x521D, 0x100, 0x7D42, 0x100,
+		0x751F, 0x100, 0x8CA9, 0x100, 0x58F0, 0x100, 0x5439, 0x100, 0x6F14, 0x100, 0x6295, 0x100,
+		0x6355, 0x100, 0x4E00, 0x100, 0x4E09, 0x100, 0x904A, 0x100, 0x5DE6, 0x100, 0x4E2D, 0x100,
+		0x53F3, 0x100, 0x6307, 0x100, 0x8D70, 0x100, 0x6253, 0x100, 0x7981, 0x100, 0x7A7A, 0x100,
+		0x5408, 0x100, 0x6E80, 0x100, 0x6709, 0x100, 0x6708, 0x100, 0x7533, 0x100, 0x5272, 0x100,
+		0x55B6, 0x100, 0x914D, 0x300, 0x3014, 0x672C, 0x3015, 0x300, 0x3014, 0x4E09, 0x3015, 0x300,
+		0x3014, 0x4E8C, 0x3015, 0x300, 0x3014, 0x5B89, 0x3015, 0x300, 0x3014, 0x70B9, 0x3015, 0x300,
+		0x3014, 0x6253, 0x3015, 0x300, 0x3014, 0x76D7, 0x3015, 0x300, 0x3014, 0x52DD, 0x3015, 0x300,
+		0x3014, 0x6557, 0x3015, 0x100, 0x5F97, 0x100, 0x53EF, 0x100, 0x30, 0x100, 0x31, 0x100,
+		0x32, 0x100, 0x33, 0x100, 0x34, 0x100, 0x35, 0x100, 0x36, 0x100, 0x37, 0x100,
+		0x38, 0x100, 0x39, 0x1, 0x4E3D, 0x1, 0x4E38, 0x1, 0x4E41, 0x1, 0x20122, 0x1,
+		0x4F60, 0x1, 0x4FAE, 0x1, 0x4FBB, 0x1, 0x5002, 0x1, 0x507A, 0x1, 0x5099, 0x1,
+		0x50E7, 0x1, 0x50CF, 0x1, 0x349E, 0x1, 0x2063A, 0x1, 0x514D, 0x1, 0x5154, 0x1,
+		0x5164, 0x1, 0x5177, 0x1, 0x2051C, 0x1, 0x34B9, 0x1, 0x5167, 0x1, 0x518D, 0x1,
+		0x2054B, 0x1, 0x5197, 0x1, 0x51A4, 0x1, 0x4ECC, 0x1, 0x51AC, 0x1, 0x51B5, 0x1,
+		0x291DF, 0x1, 0x51F5, 0x1, 0x5203, 0x1, 0x34DF, 0x1, 0x523B, 0x1, 0x5246, 0x1,
+		0x5272, 0x1, 0x5277, 0x1, 0x3515, 0x1, 0x52C7, 0x1, 0x52C9, 0x1, 0x52E4, 0x1,
+		0x52FA, 0x1, 0x5305, 0x1, 0x5306, 0x1, 0x5317, 0x1, 0x5349, 0x1, 0x5351, 0x1,
+		0x535A, 0x1, 0x5373, 0x1, 0x537D, 0x1, 0x537F, 0x1, 0x537F, 0x1, 0x537F, 0x1,
+		0x20A2C, 0x1, 0x7070, 0x1, 0x53CA, 0x1, 0x53DF, 0x1, 0x20B63, 0x1, 0x53EB, 0x1,
+		0x53F1, 0x1, 0x5406, 0x1, 0x549E, 0x1, 0x5438, 0x1, 0x5448, 0x1, 0x5468, 0x1,
+		0x54A2, 0x1, 0x54F6, 0x1, 0x5510, 0x1, 0x5553, 0x1, 0x5563, 0x1, 0x5584, 0x1,
+		0x5584, 0x1, 0x5599, 0x1, 0x55AB, 0x1, 0x55B3, 0x1, 0x55C2, 0x1, 0x5716, 0x1,
+		0x5606, 0x1, 0x5717, 0x1, 0x5651, 0x1, 0x5674, 0x1, 0x5207, 0x1, 0x58EE, 0x1,
+		0x57CE, 0x1, 0x57F4, 0x1, 0x580D, 0x1, 0x578B, 0x1, 0x5832, 0x1, 0x5831, 0x1,
+		0x58AC, 0x1, 0x214E4, 0x1, 0x58F2, 0x1, 0x58F7, 0x1, 0x5906, 0x1, 0x591A, 0x1,
+		0x5922, 0x1, 0x5962, 0x1, 0x216A8, 0x1, 0x216EA, 0x1, 0x59EC, 0x1, 0x5A1B, 0x1,
+		0x5A27, 0x1, 0x59D8, 0x1, 0x5A66, 0x1, 0x36EE, 0x1, 0x36FC, 0x1, 0x5B08, 0x1,
+		0x5B3E, 0x1, 0x5B3E, 0x1, 0x219C8, 0x1, 0x5BC3, 0x1, 0x5BD8, 0x1, 0x5BE7, 0x1,
+		0x5BF3, 0x1, 0x21B18, 0x1, 0x5BFF, 0x1, 0x5C06, 0x1, 0x5F53, 0x1, 0x5C22, 0x1,
+		0x3781, 0x1, 0x5C60, 0x1, 0x5C6E, 0x1, 0x5CC0, 0x1, 0x5C8D, 0x1, 0x21DE4, 0x1,
+		0x5D43, 0x1, 0x21DE6, 0x1, 0x5D6E, 0x1, 0x5D6B, 0x1, 0x5D7C, 0x1, 0x5DE1, 0x1,
+		0x5DE2, 0x1, 0x382F, 0x1, 0x5DFD, 0x1, 0x5E28, 0x1, 0x5E3D, 0x1, 0x5E69, 0x1,
+		0x3862, 0x1, 0x22183, 0x1, 0x387C, 0x1, 0x5EB0, 0x1, 0x5EB3, 0x1, 0x5EB6, 0x1,
+		0x5ECA, 0x1, 0x2A392, 0x1, 0x5EFE, 0x1, 0x22331, 0x1, 0x22331, 0x1, 0x8201, 0x1,
+		0x5F22, 0x1, 0x5F22, 0x1, 0x38C7, 0x1, 0x232B8, 0x1, 0x261DA, 0x1, 0x5F62, 0x1,
+		0x5F6B, 0x1, 0x38E3, 0x1, 0x5F9A, 0x1, 0x5FCD, 0x1, 0x5FD7, 0x1, 0x5FF9, 0x1,
+		0x6081, 0x1, 0x393A, 0x1, 0x391C, 0x1, 0x6094, 0x1, 0x226D4, 0x1, 0x60C7, 0x1,
+		0x6148, 0x1, 0x614C, 0x1, 0x614E, 0x1, 0x614C, 0x1, 0x617A, 0x1, 0x618E, 0x1,
+		0x61B2, 0x1, 0x61A4, 0x1, 0x61AF, 0x1, 0x61DE, 0x1, 0x61F2, 0x1, 0x61F6, 0x1,
+		0x6210, 0x1, 0x621B, 0x1, 0x625D, 0x1, 0x62B1, 0x1, 0x62D4, 0x1, 0x6350, 0x1,
+		0x22B0C, 0x1, 0x633D, 0x1, 0x62FC, 0x1, 0x6368, 0x1, 0x6383, 0x1, 0x63E4, 0x1,
+		0x22BF1, 0x1, 0x6422, 0x1, 0x63C5, 0x1, 0x63A9, 0x1, 0x3A2E, 0x1, 0x6469, 0x1,
+		0x647E, 0x1, 0x649D, 0x1, 0x6477, 0x1, 0x3A6C, 0x1, 0x654F, 0x1, 0x656C, 0x1,
+		0x2300A, 0x1, 0x65E3, 0x1, 0x66F8, 0x1, 0x6649, 0x1, 0x3B19, 0x1, 0x6691, 0x1,
+		0x3B08, 0x1, 0x3AE4, 0x1, 0x5192, 0x1, 0x5195, 0x1, 0x6700, 0x1, 0x669C, 0x1,
+		0x80AD, 0x1, 0x43D9, 0x1, 0x6717, 0x1, 0x671B, 0x1, 0x6721, 0x1, 0x675E, 0x1,
+		0x6753, 0x1, 0x233C3, 0x1, 0x3B49, 0x1, 0x67FA, 0x1, 0x6785, 0x1, 0x6852, 0x1,
+		0x6885, 0x1, 0x2346D, 0x1, 0x688E, 0x1, 0x681F, 0x1, 0x6914, 0x1, 0x3B9D, 0x1,
+		0x6942, 0x1, 0x69A3, 0x1, 0x69EA, 0x1, 0x6AA8, 0x1, 0x236A3, 0x1, 0x6ADB, 0x1,
+		0x3C18, 0x1, 0x6B21, 0x1, 0x238A7, 0x1, 0x6B54, 0x1, 0x3C4E, 0x1, 0x6B72, 0x1,
+		0x6B9F, 0x1, 0x6BBA, 0x1, 0x6BBB, 0x1, 0x23A8D, 0x1, 0x21D0B, 0x1, 0x23AFA, 0x1,
+		0x6C4E, 0x1, 0x23CBC, 0x1, 0x6CBF, 0x1, 0x6CCD, 0x1, 0x6C67, 0x1, 0x6D16, 0x1,
+		0x6D3E, 0x1, 0x6D77, 0x1, 0x6D41, 0x1, 0x6D69, 0x1, 0x6D78, 0x1, 0x6D85, 0x1,
+		0x23D1E, 0x1, 0x6D34, 0x1, 0x6E2F, 0x1, 0x6E6E, 0x1, 0x3D33, 0x1, 0x6ECB, 0x1,
+		0x6EC7, 0x1, 0x23ED1, 0x1, 0x6DF9, 0x1, 0x6F6E, 0x1, 0x23F5E, 0x1, 0x23F8E, 0x1,
+		0x6FC6, 0x1, 0x7039, 0x1, 0x701E, 0x1, 0x701B, 0x1, 0x3D96, 0x1, 0x704A, 0x1,
+		0x707D, 0x1, 0x7077, 0x1, 0x70AD, 0x1, 0x20525, 0x1, 0x7145, 0x1, 0x24263, 0x1,
+		0x719C, 0x1, 0x243AB, 0x1, 0x7228, 0x1, 0x7235, 0x1, 0x7250, 0x1, 0x24608, 0x1,
+		0x7280, 0x1, 0x7295, 0x1, 0x24735, 0x1, 0x24814, 0x1, 0x737A, 0x1, 0x738B, 0x1,
+		0x3EAC, 0x1, 0x73A5, 0x1, 0x3EB8, 0x1, 0x3EB8, 0x1, 0x7447, 0x1, 0x745C, 0x1,
+		0x7471, 0x1, 0x7485, 0x1, 0x74CA, 0x1, 0x3F1B, 0x1, 0x7524, 0x1, 0x24C36, 0x1,
+		0x753E, 0x1, 0x24C92, 0x1, 0x7570, 0x1, 0x2219F, 0x1, 0x7610, 0x1, 0x24FA1, 0x1,
+		0x24FB8, 0x1, 0x25044, 0x1, 0x3FFC, 0x1, 0x4008, 0x1, 0x76F4, 0x1, 0x250F3, 0x1,
+		0x250F2, 0x1, 0x25119, 0x1, 0x25133, 0x1, 0x771E, 0x1, 0x771F, 0x1, 0x771F, 0x1,
+		0x774A, 0x1, 0x4039, 0x1, 0x778B, 0x1, 0x4046, 0x1, 0x4096, 0x1, 0x2541D, 0x1,
+		0x784E, 0x1, 0x788C, 0x1, 0x78CC, 0x1, 0x40E3, 0x1, 0x25626, 0x1, 0x7956, 0x1,
+		0x2569A, 0x1, 0x256C5, 0x1, 0x798F, 0x1, 0x79EB, 0x1, 0x412F, 0x1, 0x7A40, 0x1,
+		0x7A4A, 0x1, 0x7A4F, 0x1, 0x2597C, 0x1, 0x25AA7, 0x1, 0x25AA7, 0x1, 0x7AEE, 0x1,
+		0x4202, 0x1, 0x25BAB, 0x1, 0x7BC6, 0x1, 0x7BC9, 0x1, 0x4227, 0x1, 0x25C80, 0x1,
+		0x7CD2, 0x1, 0x42A0, 0x1, 0x7CE8, 0x1, 0x7CE3, 0x1, 0x7D00, 0x1, 0x25F86, 0x1,
+		0x7D63, 0x1, 0x4301, 0x1, 0x7DC7, 0x1, 0x7E02, 0x1, 0x7E45, 0x1, 0x4334, 0x1,
+		0x26228, 0x1, 0x26247, 0x1, 0x4359, 0x1, 0x262D9, 0x1, 0x7F7A, 0x1, 0x2633E, 0x1,
+		0x7F95, 0x1, 0x7FFA, 0x1, 0x8005, 0x1, 0x264DA, 0x1, 0x26523, 0x1, 0x8060, 0x1,
+		0x265A8, 0x1, 0x8070, 0x1, 0x2335F, 0x1, 0x43D5, 0x1, 0x80B2, 0x1, 0x8103, 0x1,
+		0x440B, 0x1, 0x813E, 0x1, 0x5AB5, 0x1, 0x267A7, 0x1, 0x267B5, 0x1, 0x23393, 0x1,
+		0x2339C, 0x1, 0x8201, 0x1, 0x8204, 0x1, 0x8F9E, 0x1, 0x446B, 0x1, 0x8291, 0x1,
+		0x828B, 0x1, 0x829D, 0x1, 0x52B3, 0x1, 0x82B1, 0x1, 0x82B3, 0x1, 0x82BD, 0x1,
+		0x82E6, 0x1, 0x26B3C, 0x1, 0x82E5, 0x1, 0x831D, 0x1, 0x8363, 0x1, 0x83AD, 0x1,
+		0x8323, 0x1, 0x83BD, 0x1, 0x83E7, 0x1, 0x8457, 0x1, 0x8353, 0x1, 0x83CA, 0x1,
+		0x83CC, 0x1, 0x83DC, 0x1, 0x26C36, 0x1, 0x26D6B, 0x1, 0x26CD5, 0x1, 0x452B, 0x1,
+		0x84F1, 0x1, 0x84F3, 0x1, 0x8516, 0x1, 0x273CA, 0x1, 0x8564, 0x1, 0x26F2C, 0x1,
+		0x455D, 0x1, 0x4561, 0x1, 0x26FB1, 0x1, 0x270D2, 0x1, 0x456B, 0x1, 0x8650, 0x1,
+		0x865C, 0x1, 0x8667, 0x1, 0x8669, 0x1, 0x86A9, 0x1, 0x8688, 0x1, 0x870E, 0x1,
+		0x86E2, 0x1, 0x8779, 0x1, 0x8728, 0x1, 0x876B, 0x1, 0x8786, 0x1, 0x45D7, 0x1,
+		0x87E1, 0x1, 0x8801, 0x1, 0x45F9, 0x1, 0x8860, 0x1, 0x8863, 0x1, 0x27667, 0x1,
+		0x88D7, 0x1, 0x88DE, 0x1, 0x4635, 0x1, 0x88FA, 0x1, 0x34BB, 0x1, 0x278AE, 0x1,
+		0x27966, 0x1, 0x46BE, 0x1, 0x46C7, 0x1, 0x8AA0, 0x1, 0x8AED, 0x1, 0x8B8A, 0x1,
+		0x8C55, 0x1, 0x27CA8, 0x1, 0x8CAB, 0x1, 0x8CC1, 0x1, 0x8D1B, 0x1, 0x8D77, 0x1,
+		0x27F2F, 0x1, 0x20804, 0x1, 0x8DCB, 0x1, 0x8DBC, 0x1, 0x8DF0, 0x1, 0x208DE, 0x1,
+		0x8ED4, 0x1, 0x8F38, 0x1, 0x285D2, 0x1, 0x285ED, 0x1, 0x9094, 0x1, 0x90F1, 0x1,
+		0x9111, 0x1, 0x2872E, 0x1, 0x911B, 0x1, 0x9238, 0x1, 0x92D7, 0x1, 0x92D8, 0x1,
+		0x927C, 0x1, 0x93F9, 0x1, 0x9415, 0x1, 0x28BFA, 0x1, 0x958B, 0x1, 0x4995, 0x1,
+		0x95B7, 0x1, 0x28D77, 0x1, 0x49E6, 0x1, 0x96C3, 0x1, 0x5DB2, 0x1, 0x9723, 0x1,
+		0x29145, 0x1, 0x2921A, 0x1, 0x4A6E, 0x1, 0x4A76, 0x1, 0x97E0, 0x1, 0x2940A, 0x1,
+		0x4AB2, 0x1, 0x29496, 0x1, 0x980B, 0x1, 0x980B, 0x1, 0x9829, 0x1, 0x295B6, 0x1,
+		0x98E2, 0x1, 0x4B33, 0x1, 0x9929, 0x1, 0x99A7, 0x1, 0x99C2, 0x1, 0x99FE, 0x1,
+		0x4BCE, 0x1, 0x29B30, 0x1, 0x9B12, 0x1, 0x9C40, 0x1, 0x9CFD, 0x1, 0x4CCE, 0x1,
+		0x4CED, 0x1, 0x9D67, 0x1, 0x2A0CE, 0x1, 0x4CF8, 0x1, 0x2A105, 0x1, 0x2A20E, 0x1,
+		0x2A291, 0x1, 0x9EBB, 0x1, 0x4D56, 0x1, 0x9EF9, 0x1, 0x9EFE, 0x1, 0x9F05, 0x1,
+		0x9F0F, 0x1, 0x9F16, 0x1, 0x9F3B, 0x1, 0x2A600,
+	};
+
+	/** @brief Codepoints at or above this limit never start a primary composite */
+	inline constexpr char32_t kCompositionLimit{ 0x11A00 };
+
+	/** @brief log2 of the number of codepoints per composition block */
+	inline constexpr unsigned kCompositionShift{ 5 };
+
+	/** @brief Block number for each run of 2^kCompositionShift codepoints */
+	inline constexpr std::uint8_t kCompositionIndex[]{
+		0, 1, 2, 3, 0, 4, 5, 6, 7, 0, 8, 9, 0, 10, 0, 11, 0, 12, 0, 0, 13, 0, 0, 0,
+		0, 0, 0, 0, 14, 15, 16, 0, 17, 18, 19, 20, 0, 0, 21, 22, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 23, 24, 0, 0, 0, 25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 26, 0, 0, 0, 0, 27, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 0, 29, 0, 30, 0,
+		0, 0, 31, 0, 0, 32, 33, 0, 0, 0, 34, 0, 0, 0, 35, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		37, 38, 39, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 40, 41, 42, 0, 43, 44, 0, 45, 46, 47, 48, 0, 49, 50, 51, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 52, 0, 53, 0, 54, 55, 56, 57, 58, 59, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 60, 61, 62, 63, 64, 65, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 66, 67, 0, 0,
+		0, 68, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 69, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 70, 0, 0, 0, 0, 0, 0, 0, 71, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 72, 0, 0, 0, 0, 0, 0,
+	};
+
+	/** @brief Offset into kCompositionData for each first codepoint, 0 if it starts no composite */
+	inline constexpr std::uint16_t kCompositionBlocks[]{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 4, 7, 0,
+		0, 10, 43, 50, 61, 74, 109, 112, 127, 142, 173, 176, 187, 200, 207, 226,
+		259, 0, 264, 281, 296, 311, 350, 355, 368, 373, 392, 0, 0, 0, 0, 0,
+		0, 405, 438, 445, 456, 469, 504, 507, 522, 539, 568, 573, 584, 597, 604, 623,
+		656, 0, 661, 678, 693, 710, 749, 754, 769, 774, 795, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 808, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 815, 0, 824, 827, 830, 835, 0, 0, 838, 0, 0, 0, 0, 847,
+		0, 0, 0, 0, 850, 859, 866, 0, 869, 0, 0, 0, 872, 0, 0, 0,
+		0, 0, 881, 0, 890, 893, 896, 901, 0, 0, 904, 0, 0, 0, 0, 913,
+		0, 0, 0, 0, 916, 925, 932, 0, 935, 0, 0, 0, 938, 0, 0, 0,
+		0, 0, 947, 956, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 965, 970, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 975, 980, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 985, 988, 0, 0, 0, 0,
+		991, 994, 0, 0, 0, 0, 0, 0, 997, 1000, 1003, 1006, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1009,
+		1012, 1023, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1034,
+		1045, 0, 0, 0, 0, 0, 0, 1056, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1059, 1062, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 1065, 1068, 1071, 1074, 0, 0, 0, 0, 1077, 1080,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 1083, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 1086, 0, 0, 0, 1101, 0, 1110, 0, 1121, 0, 0, 0, 0, 0, 1136,
+		0, 1145, 0, 0, 0, 1148, 0, 0, 0, 1161, 0, 0, 1172, 0, 1175, 0,
+		0, 1178, 0, 0, 0, 1195, 0, 1204, 0, 1217, 0, 0, 0, 0, 0, 1234,
+		0, 1243, 0, 0, 0, 1248, 0, 0, 0, 1265, 1278, 1285, 0, 0, 1292, 0,
+		0, 0, 1295, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 1300, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1303, 0, 0, 1308, 0, 1311, 1318, 1323, 1326, 0, 1335, 0, 0, 0, 1338, 0,
+		0, 0, 0, 1341, 0, 0, 0, 1350, 0, 0, 0, 1353, 0, 1356, 0, 0,
+		1359, 0, 0, 1364, 0, 1367, 1374, 1379, 1382, 0, 1391, 0, 0, 0, 1394, 0,
+		0, 0, 0, 1397, 0, 0, 0, 1406, 0, 0, 0, 1409, 0, 1412, 0, 0,
+		0, 0, 0, 0, 0, 0, 1415, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 1418, 1421, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 1424, 1427, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 1430, 1433, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 1436, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 1443, 0, 1446, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 1449, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 1452, 0, 0, 1455, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 1458, 0, 0, 0, 0, 0, 0, 0,
+		1461, 0, 0, 1464, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 1467, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 1472, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 1479, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 1482, 1487, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 1490, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1493,
+		0, 0, 0, 0, 0, 0, 1496, 0, 0, 0, 1503, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 1506, 1511, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 1514, 0, 0, 1521, 0, 0, 0,
+		0, 0, 0, 0, 0, 1524, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 1527, 0, 1530, 0, 1533, 0, 1536, 0, 1539, 0, 0,
+		0, 1542, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1545, 0, 1548, 0, 1551, 1554,
+		0, 0, 1557, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 1560, 1563, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1566, 1569, 0, 0, 0, 0,
+		0, 0, 1572, 1575, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1578, 1583, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 1588, 1591, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1594, 1597, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1600, 1609, 1618, 1621, 1624, 1627, 1630, 1633, 1636, 1645, 1654, 1657, 1660, 1663, 1666, 1669,
+		1672, 1677, 0, 0, 0, 0, 0, 0, 1682, 1687, 0, 0, 0, 0, 0, 0,
+		1692, 1701, 1710, 1713, 1716, 1719, 1722, 1725, 1728, 1737, 1746, 1749, 1752, 1755, 1758, 1761,
+		1764, 1771, 0, 0, 0, 0, 0, 0, 1778, 1785, 0, 0, 0, 0, 0, 0,
+		1792, 1797, 0, 0, 0, 0, 0, 0, 1802, 1807, 0, 0, 0, 0, 0, 0,
+		1812, 1819, 0, 0, 0, 0, 0, 0, 0, 1826, 0, 0, 0, 0, 0, 0,
+		1833, 1842, 1851, 1854, 1857, 1860, 1863, 1866, 1869, 1878, 1887, 1890, 1893, 1896, 1899, 1902,
+		1905, 0, 0, 0, 1908, 0, 0, 0, 0, 0, 0, 0, 1911, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 1914, 0, 0, 0, 0, 0, 0, 0, 0, 1917,
+		0, 0, 0, 0, 0, 0, 1924, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 1927, 0, 0, 0, 0, 0, 0, 0, 1930, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1937, 0, 1940, 0, 1943, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1946, 0, 1949, 0, 1952, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 1955, 0, 0, 0, 0, 1958, 0, 0, 1961, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 1964, 0, 1967, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1970, 0, 0, 0,
+		0, 0, 0, 1973, 0, 1976, 0, 0, 1979, 0, 0, 0, 0, 1982, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 1985, 0, 0, 1988, 1991, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 1994, 1997, 0, 0, 2000, 2003, 0, 0, 2006, 2009, 2012, 2015, 0, 0,
+		0, 0, 2018, 2021, 0, 0, 2024, 2027, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 2030, 2033, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 2036, 0, 0, 0, 0, 0, 2039, 2042, 0, 2045, 0, 0, 0, 0,
+		0, 0, 2048, 2051, 2054, 2057, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 2060, 0, 0, 0, 0, 2063, 0, 2066, 0, 2069,
+		0, 2072, 0, 2075, 0, 2078, 0, 2081, 0, 2084, 0, 2087, 0, 2090, 0, 2093,
+		0, 2096, 0, 0, 2099, 0, 2102, 0, 2105, 0, 0, 0, 0, 0, 0, 2108,
+		0, 0, 2113, 0, 0, 2118, 0, 0, 2123, 0, 0, 2128, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2133, 0, 0,
+		0, 0, 0, 0, 0, 0, 2136, 0, 0, 0, 0, 2139, 0, 2142, 0, 2145,
+		0, 2148, 0, 2151, 0, 2154, 0, 2157, 0, 2160, 0, 2163, 0, 2166, 0, 2169,
+		0, 2172, 0, 0, 2175, 0, 2178, 0, 2181, 0, 0, 0, 0, 0, 0, 2184,
+		0, 0, 2189, 0, 0, 2194, 0, 0, 2199, 0, 0, 2204, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2209,
+		2212, 2215, 2218, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2221, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 2224, 0, 2227, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 2230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 2233, 2236, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 2239, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 2244, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 2251, 2254, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 2257, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	};
+
+	/** @brief Composites as [count, second, composite, second, composite...] per first codepoint */
+	inline constexpr char32_t kCompositionData[]{
+		0x0, 0x1, 0x338, 0x226E, 0x1, 0x338, 0x2260, 0x1, 0x338, 0x226F, 0x10, 0x300,
+		0xC0, 0x301, 0xC1, 0x302, 0xC2, 0x303, 0xC3, 0x308, 0xC4, 0x30A, 0xC5, 0x304,
+		0x100, 0x306, 0x102, 0x328, 0x104, 0x30C, 0x1CD, 0x30F, 0x200, 0x311, 0x202, 0x307,
+		0x226, 0x325, 0x1E00, 0x323, 0x1EA0, 0x309, 0x1EA2, 0x3, 0x307, 0x1E02, 0x323, 0x1E04,
+		0x331, 0x1E06, 0x5, 0x327, 0xC7, 0x301, 0x106, 0x302, 0x108, 0x307, 0x10A, 0x30C,
+		0x10C, 0x6, 0x30C, 0x10E, 0x307, 0x1E0A, 0x323, 0x1E0C, 0x331, 0x1E0E, 0x327, 0x1E10,
+		0x32D, 0x1E12, 0x11, 0x300, 0xC8, 0x301, 0xC9, 0x302, 0xCA, 0x308, 0xCB, 0x304,
+		0x112, 0x306, 0x114, 0x307, 0x116, 0x328, 0x118, 0x30C, 0x11A, 0x30F, 0x204, 0x311,
+		0x206, 0x327, 0x228, 0x32D, 0x1E18, 0x330, 0x1E1A, 0x323, 0x1EB8, 0x309, 0x1EBA, 0x303,
+		0x1EBC, 0x1, 0x307, 0x1E1E, 0x7, 0x302, 0x11C, 0x306, 0x11E, 0x307, 0x120, 0x327,
+		0x122, 0x30C, 0x1E6, 0x301, 0x1F4, 0x304, 0x1E20, 0x7, 0x302, 0x124, 0x30C, 0x21E,
+		0x307, 0x1E22, 0x323, 0x1E24, 0x308, 0x1E26, 0x327, 0x1E28, 0x32E, 0x1E2A, 0xF, 0x300,
+		0xCC, 0x301, 0xCD, 0x302, 0xCE, 0x308, 0xCF, 0x303, 0x128, 0x304, 0x12A, 0x306,
+		0x12C, 0x328, 0x12E, 0x307, 0x130, 0x30C, 0x1CF, 0x30F, 0x208, 0x311, 0x20A, 0x330,
+		0x1E2C, 0x309, 0x1EC8, 0x323, 0x1ECA, 0x1, 0x302, 0x134, 0x5, 0x327, 0x136, 0x30C,
+		0x1E8, 0x301, 0x1E30, 0x323, 0x1E32, 0x331, 0x1E34, 0x6, 0x301, 0x139, 0x327, 0x13B,
+		0x30C, 0x13D, 0x323, 0x1E36, 0x331, 0x1E3A, 0x32D, 0x1E3C, 0x3, 0x301, 0x1E3E, 0x307,
+		0x1E40, 0x323, 0x1E42, 0x9, 0x303, 0xD1, 0x301, 0x143, 0x327, 0x145, 0x30C, 0x147,
+		0x300, 0x1F8, 0x307, 0x1E44, 0x323, 0x1E46, 0x331, 0x1E48, 0x32D, 0x1E4A, 0x10, 0x300,
+		0xD2, 0x301, 0xD3, 0x302, 0xD4, 0x303, 0xD5, 0x308, 0xD6, 0x304, 0x14C, 0x306,
+		0x14E, 0x30B, 0x150, 0x31B, 0x1A0, 0x30C, 0x1D1, 0x328, 0x1EA, 0x30F, 0x20C, 0x311,
+		0x20E, 0x307, 0x22E, 0x323, 0x1ECC, 0x309, 0x1ECE, 0x2, 0x301, 0x1E54, 0x307, 0x1E56,
+		0x8, 0x301, 0x154, 0x327, 0x156, 0x30C, 0x158, 0x30F, 0x210, 0x311, 0x212, 0x307,
+		0x1E58, 0x323, 0x1E5A, 0x331, 0x1E5E, 0x7, 0x301, 0x15A, 0x302, 0x15C, 0x327, 0x15E,
+		0x30C, 0x160, 0x326, 0x218, 0x307, 0x1E60, 0x323, 0x1E62, 0x7, 0x327, 0x162, 0x30C,
+		0x164, 0x326, 0x21A, 0x307, 0x1E6A, 0x323, 0x1E6C, 0x331, 0x1E6E, 0x32D, 0x1E70, 0x13,
+		0x300, 0xD9, 0x301, 0xDA, 0x302, 0xDB, 0x308, 0xDC, 0x303, 0x168, 0x304, 0x16A,
+		0x306, 0x16C, 0x30A, 0x16E, 0x30B, 0x170, 0x328, 0x172, 0x31B, 0x1AF, 0x30C, 0x1D3,
+		0x30F, 0x214, 0x311, 0x216, 0x324, 0x1E72, 0x330, 0x1E74, 0x32D, 0x1E76, 0x323, 0x1EE4,
+		0x309, 0x1EE6, 0x2, 0x303, 0x1E7C, 0x323, 0x1E7E, 0x6, 0x302, 0x174, 0x300, 0x1E80,
+		0x301, 0x1E82, 0x308, 0x1E84, 0x307, 0x1E86, 0x323, 0x1E88, 0x2, 0x307, 0x1E8A, 0x308,
+		0x1E8C, 0x9, 0x301, 0xDD, 0x302, 0x176, 0x308, 0x178, 0x304, 0x232, 0x307, 0x1E8E,
+		0x300, 0x1EF2, 0x323, 0x1EF4, 0x309, 0x1EF6, 0x303, 0x1EF8, 0x6, 0x301, 0x179, 0x307,
+		0x17B, 0x30C, 0x17D, 0x302, 0x1E90, 0x323, 0x1E92, 0x331, 0x1E94, 0x10, 0x300, 0xE0,
+		0x301, 0xE1, 0x302, 0xE2, 0x303, 0xE3, 0x308, 0xE4, 0x30A, 0xE5, 0x304, 0x101,
+		0x306, 0x103, 0x328, 0x105, 0x30C, 0x1CE, 0x30F, 0x201, 0x311, 0x203, 0x307, 0x227,
+		0x325, 0x1E01, 0x323, 0x1EA1, 0x309, 0x1EA3, 0x3, 0x307, 0x1E03, 0x323, 0x1E05, 0x331,
+		0x1E07, 0x5, 0x327, 0xE7, 0x301, 0x107, 0x302, 0x109, 0x307, 0x10B, 0x30C, 0x10D,
+		0x6, 0x30C, 0x10F, 0x307, 0x1E0B, 0x323, 0x1E0D, 0x331, 0x1E0F, 0x327, 0x1E11, 0x32D,
+		0x1E13, 0x11, 0x300, 0xE8, 0x301, 0xE9, 0x302, 0xEA, 0x308, 0xEB, 0x304, 0x113,
+		0x306, 0x115, 0x307, 0x117, 0x328, 0x119, 0x30C, 0x11B, 0x30F, 0x205, 0x311, 0x207,
+		0x327, 0x229, 0x32D, 0x1E19, 0x330, 0x1E1B, 0x323, 0x1EB9, 0x309, 0x1EBB, 0x303, 0x1EBD,
+		0x1, 0x307, 0x1E1F, 0x7, 0x302, 0x11D, 0x306, 0x11F, 0x307, 0x121, 0x327, 0x123,
+		0x30C, 0x1E7, 0x301, 0x1F5, 0x304, 0x1E21, 0x8, 0x302, 0x125, 0x30C, 0x21F, 0x307,
+		0x1E23, 0x323, 0x1E25, 0x308, 0x1E27, 0x327, 0x1E29, 0x32E, 0x1E2B, 0x331, 0x1E96, 0xE,
+		0x300, 0xEC, 0x301, 0xED, 0x302, 0xEE, 0x308, 0xEF, 0x303, 0x129, 0x304, 0x12B,
+		0x306, 0x12D, 0x328, 0x12F, 0x30C, 0x1D0, 0x30F, 0x209, 0x311, 0x20B, 0x330, 0x1E2D,
+		0x309, 0x1EC9, 0x323, 0x1ECB, 0x2, 0x302, 0x135, 0x30C, 0x1F0, 0x5, 0x327, 0x137,
+		0x30C, 0x1E9, 0x301, 0x1E31, 0x323, 0x1E33, 0x331, 0x1E35, 0x6, 0x301, 0x13A, 0x327,
+		0x13C, 0x30C, 0x13E, 0x323, 0x1E37, 0x331, 0x1E3B, 0x32D, 0x1E3D, 0x3, 0x301, 0x1E3F,
+		0x307, 0x1E41, 0x323, 0x1E43, 0x9, 0x303, 0xF1, 0x301, 0x144, 0x327, 0x146, 0x30C,
+		0x148, 0x300, 0x1F9, 0x307, 0x1E45, 0x323, 0x1E47, 0x331, 0x1E49, 0x32D, 0x1E4B, 0x10,
+		0x300, 0xF2, 0x301, 0xF3, 0x302, 0xF4, 0x303, 0xF5, 0x308, 0xF6, 0x304, 0x14D,
+		0x306, 0x14F, 0x30B, 0x151, 0x31B, 0x1A1, 0x30C, 0x1D2, 0x328, 0x1EB, 0x30F, 0x20D,
+		0x311, 0x20F, 0x307, 0x22F, 0x323, 0x1ECD, 0x309, 0x1ECF, 0x2, 0x301, 0x1E55, 0x307,
+		0x1E57, 0x8, 0x301, 0x155, 0x327, 0x157, 0x30C, 0x159, 0x30F, 0x211, 0x311, 0x213,
+		0x307, 0x1E59, 0x323, 0x1E5B, 0x331, 0x1E5F, 0x7, 0x301, 0x15B, 0x302, 0x15D, 0x327,
+		0x15F, 0x30C, 0x161, 0x326, 0x219, 0x307, 0x1E61, 0x323, 0x1E63, 0x8, 0x327, 0x163,
+		0x30C, 0x165, 0x326, 0x21B, 0x307, 0x1E6B, 0x323, 0x1E6D, 0x331, 0x1E6F, 0x32D, 0x1E71,
+		0x308, 0x1E97, 0x13, 0x300, 0xF9, 0x301, 0xFA, 0x302, 0xFB, 0x308, 0xFC, 0x303,
+		0x169, 0x304, 0x16B, 0x306, 0x16D, 0x30A, 0x16F, 0x30B, 0x171, 0x328, 0x173, 0x31B,
+		0x1B0, 0x30C, 0x1D4, 0x30F, 0x215, 0x311, 0x217, 0x324, 0x1E73, 0x330, 0x1E75, 0x32D,
+		0x1E77, 0x323, 0x1EE5, 0x309, 0x1EE7, 0x2, 0x303, 0x1E7D, 0x323, 0x1E7F, 0x7, 0x302,
+		0x175, 0x300, 0x1E81, 0x301, 0x1E83, 0x308, 0x1E85, 0x307, 0x1E87, 0x323, 0x1E89, 0x30A,
+		0x1E98, 0x2, 0x307, 0x1E8B, 0x308, 0x1E8D, 0xA, 0x301, 0xFD, 0x308, 0xFF, 0x302,
+		0x177, 0x304, 0x233, 0x307, 0x1E8F, 0x30A, 0x1E99, 0x300, 0x1EF3, 0x323, 0x1EF5, 0x309,
+		0x1EF7, 0x303, 0x1EF9, 0x6, 0x301, 0x17A, 0x307, 0x17C, 0x30C, 0x17E, 0x302, 0x1E91,
+		0x323, 0x1E93, 0x331, 0x1E95, 0x3, 0x301, 0x385, 0x342, 0x1FC1, 0x300, 0x1FED, 0x4,
+		0x301, 0x1EA4, 0x300, 0x1EA6, 0x309, 0x1EA8, 0x303, 0x1EAA, 0x1, 0x304, 0x1DE, 0x1,
+		0x301, 0x1FA, 0x2, 0x304, 0x1E2, 0x301, 0x1FC, 0x1, 0x301, 0x1E08, 0x4, 0x301,
+		0x1EBE, 0x300, 0x1EC0, 0x309, 0x1EC2, 0x303, 0x1EC4, 0x1, 0x301, 0x1E2E, 0x4, 0x301,
+		0x1ED0, 0x300, 0x1ED2, 0x309, 0x1ED4, 0x303, 0x1ED6, 0x3, 0x304, 0x22C, 0x301, 0x1E4C,
+		0x308, 0x1E4E, 0x1, 0x304, 0x22A, 0x1, 0x301, 0x1FE, 0x4, 0x304, 0x1D5, 0x301,
+		0x1D7, 0x30C, 0x1D9, 0x300, 0x1DB, 0x4, 0x301, 0x1EA5, 0x300, 0x1EA7, 0x309, 0x1EA9,
+		0x303, 0x1EAB, 0x1, 0x304, 0x1DF, 0x1, 0x301, 0x1FB, 0x2, 0x304, 0x1E3, 0x301,
+		0x1FD, 0x1, 0x301, 0x1E09, 0x4, 0x301, 0x1EBF, 0x300, 0x1EC1, 0x309, 0x1EC3, 0x303,
+		0x1EC5, 0x1, 0x301, 0x1E2F, 0x4, 0x301, 0x1ED1, 0x300, 0x1ED3, 0x309, 0x1ED5, 0x303,
+		0x1ED7, 0x3, 0x304, 0x22D, 0x301, 0x1E4D, 0x308, 0x1E4F, 0x1, 0x304, 0x22B, 0x1,
+		0x301, 0x1FF, 0x4, 0x304, 0x1D6, 0x301, 0x1D8, 0x30C, 0x1DA, 0x300, 0x1DC, 0x4,
+		0x301, 0x1EAE, 0x300, 0x1EB0, 0x309, 0x1EB2, 0x303, 0x1EB4, 0x4, 0x301, 0x1EAF, 0x300,
+		0x1EB1, 0x309, 0x1EB3, 0x303, 0x1EB5, 0x2, 0x300, 0x1E14, 0x301, 0x1E16, 0x2, 0x300,
+		0x1E15, 0x301, 0x1E17, 0x2, 0x300, 0x1E50, 0x301, 0x1E52, 0x2, 0x300, 0x1E51, 0x301,
+		0x1E53, 0x1, 0x307, 0x1E64, 0x1, 0x307, 0x1E65, 0x1, 0x307, 0x1E66, 0x1, 0x307,
+		0x1E67, 0x1, 0x301, 0x1E78, 0x1, 0x301, 0x1E79, 0x1, 0x308, 0x1E7A, 0x1, 0x308,
+		0x1E7B, 0x1, 0x307, 0x1E9B, 0x5, 0x301, 0x1EDA, 0x300, 0x1EDC, 0x309, 0x1EDE, 0x303,
+		0x1EE0, 0x323, 0x1EE2, 0x5, 0x301, 0x1EDB, 0x300, 0x1EDD, 0x309, 0x1EDF, 0x303, 0x1EE1,
+		0x323, 0x1EE3, 0x5, 0x301, 0x1EE8, 0x300, 0x1EEA, 0x309, 0x1EEC, 0x303, 0x1EEE, 0x323,
+		0x1EF0, 0x5, 0x301, 0x1EE9, 0x300, 0x1EEB, 0x309, 0x1EED, 0x303, 0x1EEF, 0x323, 0x1EF1,
+		0x1, 0x30C, 0x1EE, 0x1, 0x304, 0x1EC, 0x1, 0x304, 0x1ED, 0x1, 0x304, 0x1E0,
+		0x1, 0x304, 0x1E1, 0x1, 0x306, 0x1E1C, 0x1, 0x306, 0x1E1D, 0x1, 0x304, 0x230,
+		0x1, 0x304, 0x231, 0x1, 0x30C, 0x1EF, 0x7, 0x301, 0x386, 0x313, 0x1F08, 0x314,
+		0x1F09, 0x306, 0x1FB8, 0x304, 0x1FB9, 0x300, 0x1FBA, 0x345, 0x1FBC, 0x4, 0x301, 0x388,
+		0x313, 0x1F18, 0x314, 0x1F19, 0x300, 0x1FC8, 0x5, 0x301, 0x389, 0x313, 0x1F28, 0x314,
+		0x1F29, 0x300, 0x1FCA, 0x345, 0x1FCC, 0x7, 0x301, 0x38A, 0x308, 0x3AA, 0x313, 0x1F38,
+		0x314, 0x1F39, 0x306, 0x1FD8, 0x304, 0x1FD9, 0x300, 0x1FDA, 0x4, 0x301, 0x38C, 0x313,
+		0x1F48, 0x314, 0x1F49, 0x300, 0x1FF8, 0x1, 0x314, 0x1FEC, 0x6, 0x301, 0x38E, 0x308,
+		0x3AB, 0x314, 0x1F59, 0x306, 0x1FE8, 0x304, 0x1FE9, 0x300, 0x1FEA, 0x5, 0x301, 0x38F,
+		0x313, 0x1F68, 0x314, 0x1F69, 0x300, 0x1FFA, 0x345, 0x1FFC, 0x1, 0x345, 0x1FB4, 0x1,
+		0x345, 0x1FC4, 0x8, 0x301, 0x3AC, 0x313, 0x1F00, 0x314, 0x1F01, 0x300, 0x1F70, 0x306,
+		0x1FB0, 0x304, 0x1FB1, 0x345, 0x1FB3, 0x342, 0x1FB6, 0x4, 0x301, 0x3AD, 0x313, 0x1F10,
+		0x314, 0x1F11, 0x300, 0x1F72, 0x6, 0x301, 0x3AE, 0x313, 0x1F20, 0x314, 0x1F21, 0x300,
+		0x1F74, 0x345, 0x1FC3, 0x342, 0x1FC6, 0x8, 0x301, 0x3AF, 0x308, 0x3CA, 0x313, 0x1F30,
+		0x314, 0x1F31, 0x300, 0x1F76, 0x306, 0x1FD0, 0x304, 0x1FD1, 0x342, 0x1FD6, 0x4, 0x301,
+		0x3CC, 0x313, 0x1F40, 0x314, 0x1F41, 0x300, 0x1F78, 0x2, 0x313, 0x1FE4, 0x314, 0x1FE5,
+		0x8, 0x308, 0x3CB, 0x301, 0x3CD, 0x313, 0x1F50, 0x314, 0x1F51, 0x300, 0x1F7A, 0x306,
+		0x1FE0, 0x304, 0x1FE1, 0x342, 0x1FE6, 0x6, 0x301, 0x3CE, 0x313, 0x1F60, 0x314, 0x1F61,
+		0x300, 0x1F7C, 0x345, 0x1FF3, 0x342, 0x1FF6, 0x3, 0x301, 0x390, 0x300, 0x1FD2, 0x342,
+		0x1FD7, 0x3, 0x301, 0x3B0, 0x300, 0x1FE2, 0x342, 0x1FE7, 0x1, 0x345, 0x1FF4, 0x2,
+		0x301, 0x3D3, 0x308, 0x3D4, 0x1, 0x308, 0x407, 0x2, 0x306, 0x4D0, 0x308, 0x4D2,
+		0x1, 0x301, 0x403, 0x3, 0x300, 0x400, 0x308, 0x401, 0x306, 0x4D6, 0x2, 0x306,
+		0x4C1, 0x308, 0x4DC, 0x1, 0x308, 0x4DE, 0x4, 0x300, 0x40D, 0x306, 0x419, 0x304,
+		0x4E2, 0x308, 0x4E4, 0x1, 0x301, 0x40C, 0x1, 0x308, 0x4E6, 0x4, 0x306, 0x40E,
+		0x304, 0x4EE, 0x308, 0x4F0, 0x30B, 0x4F2, 0x1, 0x308, 0x4F4, 0x1, 0x308, 0x4F8,
+		0x1, 0x308, 0x4EC, 0x2, 0x306, 0x4D1, 0x308, 0x4D3, 0x1, 0x301, 0x453, 0x3,
+		0x300, 0x450, 0x308, 0x451, 0x306, 0x4D7, 0x2, 0x306, 0x4C2, 0x308, 0x4DD, 0x1,
+		0x308, 0x4DF, 0x4, 0x306, 0x439, 0x300, 0x45D, 0x304, 0x4E3, 0x308, 0x4E5, 0x1,
+		0x301, 0x45C, 0x1, 0x308, 0x4E7, 0x4, 0x306, 0x45E, 0x304, 0x4EF, 0x308, 0x4F1,
+		0x30B, 0x4F3, 0x1, 0x308, 0x4F5, 0x1, 0x308, 0x4F9, 0x1, 0x308, 0x4ED, 0x1,
+		0x308, 0x457, 0x1, 0x30F, 0x476, 0x1, 0x30F, 0x477, 0x1, 0x308, 0x4DA, 0x1,
+		0x308, 0x4DB, 0x1, 0x308, 0x4EA, 0x1, 0x308, 0x4EB, 0x3, 0x653, 0x622, 0x654,
+		0x623, 0x655, 0x625, 0x1, 0x654, 0x624, 0x1, 0x654, 0x626, 0x1, 0x654, 0x6C2,
+		0x1, 0x654, 0x6D3, 0x1, 0x654, 0x6C0, 0x1, 0x93C, 0x929, 0x1, 0x93C, 0x931,
+		0x1, 0x93C, 0x934, 0x2, 0x9BE, 0x9CB, 0x9D7, 0x9CC, 0x3, 0xB56, 0xB48, 0xB3E,
+		0xB4B, 0xB57, 0xB4C, 0x1, 0xBD7, 0xB94, 0x2, 0xBBE, 0xBCA, 0xBD7, 0xBCC, 0x1,
+		0xBBE, 0xBCB, 0x1, 0xC56, 0xC48, 0x1, 0xCD5, 0xCC0, 0x3, 0xCD5, 0xCC7, 0xCD6,
+		0xCC8, 0xCC2, 0xCCA, 0x1, 0xCD5, 0xCCB, 0x2, 0xD3E, 0xD4A, 0xD57, 0xD4C, 0x1,
+		0xD3E, 0xD4B, 0x3, 0xDCA, 0xDDA, 0xDCF, 0xDDC, 0xDDF, 0xDDE, 0x1, 0xDCA, 0xDDD,
+		0x1, 0x102E, 0x1026, 0x1, 0x1B35, 0x1B06, 0x1, 0x1B35, 0x1B08, 0x1, 0x1B35, 0x1B0A,
+		0x1, 0x1B35, 0x1B0C, 0x1, 0x1B35, 0x1B0E, 0x1, 0x1B35, 0x1B12, 0x1, 0x1B35, 0x1B3B,
+		0x1, 0x1B35, 0x1B3D, 0x1, 0x1B35, 0x1B40, 0x1, 0x1B35, 0x1B41, 0x1, 0x1B35, 0x1B43,
+		0x1, 0x304, 0x1E38, 0x1, 0x304, 0x1E39, 0x1, 0x304, 0x1E5C, 0x1, 0x304, 0x1E5D,
+		0x1, 0x307, 0x1E68, 0x1, 0x307, 0x1E69, 0x2, 0x302, 0x1EAC, 0x306, 0x1EB6, 0x2,
+		0x302, 0x1EAD, 0x306, 0x1EB7, 0x1, 0x302, 0x1EC6, 0x1, 0x302, 0x1EC7, 0x1, 0x302,
+		0x1ED8, 0x1, 0x302, 0x1ED9, 0x4, 0x300, 0x1F02, 0x301, 0x1F04, 0x342, 0x1F06, 0x345,
+		0x1F80, 0x4, 0x300, 0x1F03, 0x301, 0x1F05, 0x342, 0x1F07, 0x345, 0x1F81, 0x1, 0x345,
+		0x1F82, 0x1, 0x345, 0x1F83, 0x1, 0x345, 0x1F84, 0x1, 0x345, 0x1F85, 0x1, 0x345,
+		0x1F86, 0x1, 0x345, 0x1F87, 0x4, 0x300, 0x1F0A, 0x301, 0x1F0C, 0x342, 0x1F0E, 0x345,
+		0x1F88, 0x4, 0x300, 0x1F0B, 0x301, 0x1F0D, 0x342, 0x1F0F, 0x345, 0x1F89, 0x1, 0x345,
+		0x1F8A, 0x1, 0x345, 0x1F8B, 0x1, 0x345, 0x1F8C, 0x1, 0x345, 0x1F8D, 0x1, 0x345,
+		0x1F8E, 0x1, 0x345, 0x1F8F, 0x2, 0x300, 0x1F12, 0x301, 0x1F14, 0x2, 0x300, 0x1F13,
+		0x301, 0x1F15, 0x2, 0x300, 0x1F1A, 0x301, 0x1F1C, 0x2, 0x300, 0x1F1B, 0x301, 0x1F1D,
+		0x4, 0x300, 0x1F22, 0x301, 0x1F24, 0x342, 0x1F26, 0x345, 0x1F90, 0x4, 0x300, 0x1F23,
+		0x301, 0x1F25, 0x342, 0x1F27, 0x345, 0x1F91, 0x1, 0x345, 0x1F92, 0x1, 0x345, 0x1F93,
+		0x1, 0x345, 0x1F94, 0x1, 0x345, 0x1F95, 0x1, 0x345, 0x1F96, 0x1, 0x345, 0x1F97,
+		0x4, 0x300, 0x1F2A, 0x301, 0x1F2C, 0x342, 0x1F2E, 0x345, 0x1F98, 0x4, 0x300, 0x1F2B,
+		0x301, 0x1F2D, 0x342, 0x1F2F, 0x345, 0x1F99, 0x1, 0x345, 0x1F9A, 0x1, 0x345, 0x1F9B,
+		0x1, 0x345, 0x1F9C, 0x1, 0x345, 0x1F9D, 0x1, 0x345, 0x1F9E, 0x1, 0x345, 0x1F9F,
+		0x3, 0x300, 0x1F32, 0x301, 0x1F34, 0x342, 0x1F36, 0x3, 0x300, 0x1F33, 0x301, 0x1F35,
+		0x342, 0x1F37, 0x3, 0x300, 0x1F3A, 0x301, 0x1F3C, 0x342, 0x1F3E, 0x3, 0x300, 0x1F3B,
+		0x301, 0x1F3D, 0x342, 0x1F3F, 0x2, 0x300, 0x1F42, 0x301, 0x1F44, 0x2, 0x300, 0x1F43,
+		0x301, 0x1F45, 0x2, 0x300, 0x1F4A, 0x301, 0x1F4C, 0x2, 0x300, 0x1F4B, 0x301, 0x1F4D,
+		0x3, 0x300, 0x1F52, 0x301, 0x1F54, 0x342, 0x1F56, 0x3, 0x300, 0x1F53, 0x301, 0x1F55,
+		0x342, 0x1F57, 0x3, 0x300, 0x1F5B, 0x301, 0x1F5D, 0x342, 0x1F5F, 0x4, 0x300, 0x1F62,
+		0x301, 0x1F64, 0x342, 0x1F66, 0x345, 0x1FA0, 0x4, 0x300, 0x1F63, 0x301, 0x1F65, 0x342,
+		0x1F67, 0x345, 0x1FA1, 0x1, 0x345, 0x1FA2, 0x1, 0x345, 0x1FA3, 0x1, 0x345, 0x1FA4,
+		0x1, 0x345, 0x1FA5, 0x1, 0x345, 0x1FA6, 0x1, 0x345, 0x1FA7, 0x4, 0x300, 0x1F6A,
+		0x301, 0x1F6C, 0x342, 0x1F6E, 0x345, 0x1FA8, 0x4, 0x300, 0x1F6B, 0x301, 0x1F6D, 0x342,
+		0x1F6F, 0x345, 0x1FA9, 0x1, 0x345, 0x1FAA, 0x1, 0x345, 0x1FAB, 0x1, 0x345, 0x1FAC,
+		0x1, 0x345, 0x1FAD, 0x1, 0x345, 0x1FAE, 0x1, 0x345, 0x1FAF, 0x1, 0x345, 0x1FB2,
+		0x1, 0x345, 0x1FC2, 0x1, 0x345, 0x1FF2, 0x1, 0x345, 0x1FB7, 0x3, 0x300, 0x1FCD,
+		0x301, 0x1FCE, 0x342, 0x1FCF, 0x1, 0x345, 0x1FC7, 0x1, 0x345, 0x1FF7, 0x3, 0x300,
+		0x1FDD, 0x301, 0x1FDE, 0x342, 0x1FDF, 0x1, 0x338, 0x219A, 0x1, 0x338, 0x219B, 0x1,
+		0x338, 0x21AE, 0x1, 0x338, 0x21CD, 0x1, 0x338, 0x21CF, 0x1, 0x338, 0x21CE, 0x1,
+		0x338, 0x2204, 0x1, 0x338, 0x2209, 0x1, 0x338, 0x220C, 0x1, 0x338, 0x2224, 0x1,
+		0x338, 0x2226, 0x1, 0x338, 0x2241, 0x1, 0x338, 0x2244, 0x1, 0x338, 0x2247, 0x1,
+		0x338, 0x2249, 0x1, 0x338, 0x226D, 0x1, 0x338, 0x2262, 0x1, 0x338, 0x2270, 0x1,
+		0x338, 0x2271, 0x1, 0x338, 0x2274, 0x1, 0x338, 0x2275, 0x1, 0x338, 0x2278, 0x1,
+		0x338, 0x2279, 0x1, 0x338, 0x2280, 0x1, 0x338, 0x2281, 0x1, 0x338, 0x22E0, 0x1,
+		0x338, 0x22E1, 0x1, 0x338, 0x2284, 0x1, 0x338, 0x2285, 0x1, 0x338, 0x2288, 0x1,
+		0x338, 0x2289, 0x1, 0x338, 0x22E2, 0x1, 0x338, 0x22E3, 0x1, 0x338, 0x22AC, 0x1,
+		0x338, 0x22AD, 0x1, 0x338, 0x22AE, 0x1, 0x338, 0x22AF, 0x1, 0x338, 0x22EA, 0x1,
+		0x338, 0x22EB, 0x1, 0x338, 0x22EC, 0x1, 0x338, 0x22ED, 0x1, 0x3099, 0x3094, 0x1,
+		0x3099, 0x304C, 0x1, 0x3099, 0x304E, 0x1, 0x3099, 0x3050, 0x1, 0x3099, 0x3052, 0x1,
+		0x3099, 0x3054, 0x1, 0x3099, 0x3056, 0x1, 0x3099, 0x3058, 0x1, 0x3099, 0x305A, 0x1,
+		0x3099, 0x305C, 0x1, 0x3099, 0x305E, 0x1, 0x3099, 0x3060, 0x1, 0x3099, 0x3062, 0x1,
+		0x3099, 0x3065, 0x1, 0x3099, 0x3067, 0x1, 0x3099, 0x3069, 0x2, 0x3099, 0x3070, 0x309A,
+		0x3071, 0x2, 0x3099, 0x3073, 0x309A, 0x3074, 0x2, 0x3099, 0x3076, 0x309A, 0x3077, 0x2,
+		0x3099, 0x3079, 0x309A, 0x307A, 0x2, 0x3099, 0x307C, 0x309A, 0x307D, 0x1, 0x3099, 0x309E,
+		0x1, 0x3099, 0x30F4, 0x1, 0x3099, 0x30AC, 0x1, 0x3099, 0x30AE, 0x1, 0x3099, 0x30B0,
+		0x1, 0x3099, 0x30B2, 0x1, 0x3099, 0x30B4, 0x1, 0x3099, 0x30B6, 0x1, 0x3099, 0x30B8,
+		0x1, 0x3099, 0x30BA, 0x1, 0x3099, 0x30BC, 0x1, 0x3099, 0x30BE, 0x1, 0x3099, 0x30C0,
+		0x1, 0x3099, 0x30C2, 0x1, 0x3099, 0x30C5, 0x1, 0x3099, 0x30C7, 0x1, 0x3099, 0x30C9,
+		0x2, 0x3099, 0x30D0, 0x309A, 0x30D1, 0x2, 0x3099, 0x30D3, 0x309A, 0x30D4, 0x2, 0x3099,
+		0x30D6, 0x309A, 0x30D7, 0x2, 0x3099, 0x30D9, 0x309A, 0x30DA, 0x2, 0x3099, 0x30DC, 0x309A,
+		0x30DD, 0x1, 0x3099, 0x30F7, 0x1, 0x3099, 0x30F8, 0x1, 0x3099, 0x30F9, 0x1, 0x3099,
+		0x30FA, 0x1, 0x3099, 0x30FE, 0x1, 0x110BA, 0x1109A, 0x1, 0x110BA, 0x1109C, 0x1, 0x110BA,
+		0x110AB, 0x1, 0x11127, 0x1112E, 0x1, 0x11127, 0x1112F, 0x2, 0x1133E, 0x1134B, 0x11357, 0x1134C,
+		0x3, 0x114BA, 0x114BB, 0x114B0, 0x114BC, 0x114BD, 0x114BE, 0x1, 0x115AF, 0x115BA, 0x1, 0x115AF,
+		0x115BB, 0x1, 0x11930, 0x11938,
+	};
+} // namespace nfx::string::detail
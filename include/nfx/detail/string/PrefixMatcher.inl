@@ -0,0 +1,233 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file PrefixMatcher.inl
+ * @brief Implementation of the compacted radix tree prefix matcher
+ * @details The tree is built breadth-first from the sorted, deduplicated prefixes: the prefixes
+ *          below a node form a contiguous sorted range, which splits into one child per
+ *          distinct next byte. The edge label of a child is the common prefix of its range,
+ *          the common prefix of its first and last strings.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <numeric>
+
+#include "nfx/string/Utils.h"
+
+namespace nfx::string
+{
+	//=====================================================================
+	// PrefixMatcher class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	template <typename Container>
+	inline PrefixMatcher::PrefixMatcher( const Container& prefixes )
+	{
+		std::vector<std::string_view> views;
+		views.reserve( static_cast<std::size_t>( std::distance( std::begin( prefixes ), std::end( prefixes ) ) ) );
+		for ( const auto& prefix : prefixes )
+		{
+			views.emplace_back( prefix );
+		}
+		build( views );
+	}
+
+	inline void PrefixMatcher::build( const std::vector<std::string_view>& prefixes )
+	{
+		std::size_t totalSize = 0;
+		for ( std::string_view prefix : prefixes )
+		{
+			totalSize += prefix.size();
+		}
+		m_text.reserve( totalSize );
+		m_offsets.reserve( prefixes.size() + 1 );
+		for ( std::string_view prefix : prefixes )
+		{
+			m_offsets.push_back( m_text.size() );
+			m_text.append( prefix );
+		}
+		m_offsets.push_back( m_text.size() );
+
+		// Sorted distinct prefixes; a stable sort keeps the first occurrence of duplicates
+		std::vector<std::uint32_t> order( prefixes.size() );
+		std::iota( order.begin(), order.end(), std::uint32_t{ 0 } );
+		std::stable_sort( order.begin(), order.end(), [&prefixes]( std::uint32_t a, std::uint32_t b ) noexcept {
+			return prefixes[a] < prefixes[b];
+		} );
+		order.erase( std::unique( order.begin(), order.end(), [&prefixes]( std::uint32_t a, std::uint32_t b ) noexcept {
+			return prefixes[a] == prefixes[b];
+		} ),
+			order.end() );
+
+		// Each pending node owns the sorted range of prefixes below it, all sharing depth bytes
+		struct Pending
+		{
+			std::uint32_t node;
+			std::size_t begin;
+			std::size_t end;
+			std::size_t depth;
+		};
+
+		m_nodes.push_back( Node{ 0, 0, 0, 0, kNoValue } );
+		m_firstBytes.push_back( '\0' );
+		std::vector<Pending> pending{ Pending{ 0, 0, order.size(), 0 } };
+		for ( std::size_t next = 0; next < pending.size(); ++next )
+		{
+			const Pending current = pending[next];
+			std::size_t begin = current.begin;
+
+			// The shortest prefix of the range sorts first; it ends here if it has no more bytes
+			if ( begin < current.end && prefixes[order[begin]].size() == current.depth )
+			{
+				m_nodes[current.node].value = order[begin];
+				++begin;
+			}
+
+			m_nodes[current.node].firstChild = static_cast<std::uint32_t>( m_nodes.size() );
+			while ( begin < current.end )
+			{
+				const char byte = prefixes[order[begin]][current.depth];
+				std::size_t end = begin + 1;
+				while ( end < current.end && prefixes[order[end]][current.depth] == byte )
+				{
+					++end;
+				}
+
+				const std::string_view first = prefixes[order[begin]];
+				const std::size_t depth = commonPrefix( first, prefixes[order[end - 1]] ).size();
+				m_nodes.push_back( Node{ static_cast<std::uint32_t>( m_offsets[order[begin]] + current.depth ),
+					static_cast<std::uint32_t>( depth - current.depth ),
+					0,
+					0,
+					kNoValue } );
+				m_firstBytes.push_back( byte );
+				pending.push_back( Pending{ static_cast<std::uint32_t>( m_nodes.size() - 1 ), begin, end, depth } );
+				++m_nodes[current.node].childCount;
+				begin = end;
+			}
+		}
+	}
+
+	//----------------------------------------------
+	// Matching
+	//----------------------------------------------
+
+	template <typename Visitor>
+	inline void PrefixMatcher::walk( std::string_view str, Visitor&& visit ) const
+	{
+		if ( m_nodes.empty() )
+		{
+			return;
+		}
+
+		std::uint32_t node = 0;
+		std::size_t position = 0;
+		while ( true )
+		{
+			const Node& current = m_nodes[node];
+			if ( current.value != kNoValue && !visit( current.value, position ) )
+			{
+				return;
+			}
+			if ( position == str.size() || current.childCount == 0 )
+			{
+				return;
+			}
+
+			// Children are adjacent, so their first bytes form one short array
+			const char* firstBytes = m_firstBytes.data() + current.firstChild;
+			const void* hit = std::memchr( firstBytes, str[position], current.childCount );
+			if ( hit == nullptr )
+			{
+				return;
+			}
+			node = current.firstChild + static_cast<std::uint32_t>( static_cast<const char*>( hit ) - firstBytes );
+
+			const Node& child = m_nodes[node];
+			if ( child.labelSize > str.size() - position ||
+				 std::memcmp( m_text.data() + child.labelOffset + 1, str.data() + position + 1, child.labelSize - 1 ) != 0 )
+			{
+				return;
+			}
+			position += child.labelSize;
+		}
+	}
+
+	inline bool PrefixMatcher::longestMatch( std::string_view str, PrefixMatch& match ) const noexcept
+	{
+		bool found = false;
+		walk( str, [&]( std::uint32_t value, std::size_t length ) noexcept {
+			match = PrefixMatch{ value, length };
+			found = true;
+			return true;
+		} );
+		return found;
+	}
+
+	inline std::vector<PrefixMatch> PrefixMatcher::allMatches( std::string_view str ) const
+	{
+		std::vector<PrefixMatch> matches;
+		walk( str, [&matches]( std::uint32_t value, std::size_t length ) {
+			matches.push_back( PrefixMatch{ value, length } );
+			return true;
+		} );
+		return matches;
+	}
+
+	inline bool PrefixMatcher::matchesAny( std::string_view str ) const noexcept
+	{
+		bool found = false;
+		walk( str, [&found]( std::uint32_t, std::size_t ) noexcept {
+			found = true;
+			return false;
+		} );
+		return found;
+	}
+
+	//----------------------------------------------
+	// Access
+	//----------------------------------------------
+
+	inline std::size_t PrefixMatcher::size() const noexcept
+	{
+		return m_offsets.empty() ? 0 : m_offsets.size() - 1;
+	}
+
+	inline bool PrefixMatcher::empty() const noexcept
+	{
+		return size() == 0;
+	}
+
+	inline std::string_view PrefixMatcher::prefix( std::size_t index ) const noexcept
+	{
+		return std::string_view{ m_text.data() + m_offsets[index], m_offsets[index + 1] - m_offsets[index] };
+	}
+} // namespace nfx::string
@@ -0,0 +1,266 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file RadixSort.inl
+ * @brief Implementation of the cached-key multikey quicksort
+ * @details Each record caches 8 key bytes at the current depth. A range is split three ways
+ *          around a median-of-three pivot; the "less" and "greater" parts recurse at the same
+ *          depth, and the "equal" part first moves strings that end within the cached bytes to
+ *          its front (ordered by length, shorter strings being prefixes of longer ones) and then
+ *          continues 8 bytes deeper. Small ranges use insertion sort, and ranges that exceed the
+ *          recursion budget fall back to std::sort with the full comparison.
+ */
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include "nfx/detail/string/Simd.h"
+
+namespace nfx::string
+{
+	namespace detail
+	{
+		//=====================================================================
+		// Radix sort internals
+		//=====================================================================
+
+		/** @brief Ranges up to this size are insertion-sorted */
+		inline constexpr std::size_t kRadixInsertionThreshold{ 16 };
+
+		/** @brief One string to sort with its cached key bytes */
+		struct RadixRecord
+		{
+			/** @brief Key bytes [depth, depth + 8), big-endian and zero-padded */
+			std::uint64_t cache;
+
+			/** @brief Bytes defining the order */
+			std::string_view key;
+
+			/** @brief Caller-defined payload, e.g. the index of the original element */
+			std::size_t item;
+		};
+
+		/**
+		 * @brief Key bytes [depth, depth + 8) packed so that integer order is byte order
+		 * @tparam FoldCase Fold ASCII uppercase letters to lowercase
+		 */
+		template <bool FoldCase>
+		inline std::uint64_t radixLoad( std::string_view key, std::size_t depth ) noexcept
+		{
+			std::uint64_t word = 0;
+			if ( key.size() >= depth + 8 )
+			{
+				word = simd::loadBigEndianU64( key.data() + depth );
+			}
+			else if ( key.size() > depth )
+			{
+				char buffer[8]{};
+				std::memcpy( buffer, key.data() + depth, key.size() - depth );
+				word = simd::loadBigEndianU64( buffer );
+			}
+
+			if constexpr ( FoldCase )
+			{
+				word = simd::toLowerAsciiU64( word );
+			}
+			return word;
+		}
+
+		/** @brief Three-way comparison of two keys from a depth whose preceding bytes are equal */
+		template <bool FoldCase>
+		inline int radixCompare( std::string_view lhs, std::string_view rhs, std::size_t depth ) noexcept
+		{
+			for ( ;; depth += 8 )
+			{
+				const std::uint64_t lhsWord = radixLoad<FoldCase>( lhs, depth );
+				const std::uint64_t rhsWord = radixLoad<FoldCase>( rhs, depth );
+				if ( lhsWord != rhsWord )
+				{
+					return lhsWord < rhsWord ? -1 : 1;
+				}
+				if ( lhs.size() <= depth + 8 || rhs.size() <= depth + 8 )
+				{
+					return lhs.size() < rhs.size() ? -1 : ( lhs.size() > rhs.size() ? 1 : 0 );
+				}
+			}
+		}
+
+		/**
+		 * @brief Sort records by key from the given depth
+		 * @tparam FoldCase Fold ASCII uppercase letters to lowercase
+		 * @param first First record; every cache must hold the bytes at depth
+		 * @param last One past the last record
+		 * @param depth Number of leading key bytes shared by all records
+		 * @param budget Remaining partitioning levels before falling back to std::sort
+		 * @param tieLess Orders records whose keys are equal
+		 */
+		template <bool FoldCase, typename TieLess>
+		inline void radixSortRecords( RadixRecord* first, RadixRecord* last, std::size_t depth, std::size_t budget, const TieLess& tieLess )
+		{
+			while ( last - first > 1 )
+			{
+				const auto less = [depth, &tieLess]( const RadixRecord& lhs, const RadixRecord& rhs ) noexcept {
+					if ( lhs.cache != rhs.cache )
+					{
+						return lhs.cache < rhs.cache;
+					}
+					const int result = radixCompare<FoldCase>( lhs.key, rhs.key, depth );
+					return result != 0 ? result < 0 : tieLess( lhs, rhs );
+				};
+
+				const std::size_t count = static_cast<std::size_t>( last - first );
+				if ( count <= kRadixInsertionThreshold )
+				{
+					for ( RadixRecord* current = first + 1; current != last; ++current )
+					{
+						RadixRecord record = *current;
+						RadixRecord* hole = current;
+						for ( ; hole != first && less( record, *( hole - 1 ) ); --hole )
+						{
+							*hole = *( hole - 1 );
+						}
+						*hole = record;
+					}
+					return;
+				}
+				if ( budget == 0 )
+				{
+					std::sort( first, last, less );
+					return;
+				}
+				--budget;
+
+				// Median-of-three pivot on the cached words
+				std::uint64_t a = first->cache;
+				std::uint64_t b = first[count / 2].cache;
+				std::uint64_t c = last[-1].cache;
+				if ( a > b )
+				{
+					std::swap( a, b );
+				}
+				const std::uint64_t pivot = c <= a ? a : ( c >= b ? b : c );
+
+				// Dutch national flag partition: [first, lower) < pivot == [lower, upper) < [upper, last)
+				RadixRecord* lower = first;
+				RadixRecord* upper = last;
+				for ( RadixRecord* current = first; current < upper; )
+				{
+					if ( current->cache < pivot )
+					{
+						std::swap( *current++, *lower++ );
+					}
+					else if ( current->cache > pivot )
+					{
+						std::swap( *current, *--upper );
+					}
+					else
+					{
+						++current;
+					}
+				}
+
+				radixSortRecords<FoldCase>( first, lower, depth, budget, tieLess );
+				radixSortRecords<FoldCase>( upper, last, depth, budget, tieLess );
+
+				// Keys ending within the cached bytes precede the longer ones, shorter first
+				RadixRecord* ended = std::partition( lower, upper, [depth]( const RadixRecord& record ) noexcept {
+					return record.key.size() <= depth + 8;
+				} );
+				std::sort( lower, ended, [&tieLess]( const RadixRecord& lhs, const RadixRecord& rhs ) noexcept {
+					return lhs.key.size() != rhs.key.size() ? lhs.key.size() < rhs.key.size() : tieLess( lhs, rhs );
+				} );
+
+				depth += 8;
+				for ( RadixRecord* record = ended; record != upper; ++record )
+				{
+					record->cache = radixLoad<FoldCase>( record->key, depth );
+				}
+				first = ended;
+				last = upper;
+			}
+		}
+
+		/**
+		 * @brief Sort records whose caches are not loaded yet
+		 * @tparam FoldCase Fold ASCII uppercase letters to lowercase
+		 * @param records Records to sort
+		 * @param tieLess Orders records whose keys are equal
+		 */
+		template <bool FoldCase, typename TieLess>
+		inline void radixSortRecords( std::vector<RadixRecord>& records, const TieLess& tieLess )
+		{
+			for ( RadixRecord& record : records )
+			{
+				record.cache = radixLoad<FoldCase>( record.key, 0 );
+			}
+			const std::size_t budget = 2 * static_cast<std::size_t>( std::bit_width( records.size() ) );
+			radixSortRecords<FoldCase>( records.data(), records.data() + records.size(), 0, budget, tieLess );
+		}
+
+		/** @brief Records viewing the strings themselves, in input order */
+		inline std::vector<RadixRecord> radixRecords( std::span<const std::string_view> strings )
+		{
+			std::vector<RadixRecord> records;
+			records.reserve( strings.size() );
+			for ( std::size_t i = 0; i < strings.size(); ++i )
+			{
+				records.push_back( RadixRecord{ 0, strings[i], i } );
+			}
+			return records;
+		}
+	} // namespace detail
+
+	//=====================================================================
+	// String sorting
+	//=====================================================================
+
+	inline void radixSort( std::span<std::string_view> strings )
+	{
+		auto records = detail::radixRecords( strings );
+		detail::radixSortRecords<false>( records, []( const detail::RadixRecord&, const detail::RadixRecord& ) noexcept {
+			return false;
+		} );
+		for ( std::size_t i = 0; i < records.size(); ++i )
+		{
+			strings[i] = records[i].key;
+		}
+	}
+
+	inline void radixSortIgnoreCase( std::span<std::string_view> strings )
+	{
+		auto records = detail::radixRecords( strings );
+		detail::radixSortRecords<true>( records, []( const detail::RadixRecord& lhs, const detail::RadixRecord& rhs ) noexcept {
+			return lhs.key < rhs.key;
+		} );
+		for ( std::size_t i = 0; i < records.size(); ++i )
+		{
+			strings[i] = records[i].key;
+		}
+	}
+} // namespace nfx::string
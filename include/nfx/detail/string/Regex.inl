@@ -0,0 +1,1538 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Regex.inl
+ * @brief Implementation of the lazy-DFA regular expression engine
+ * @details A recursive-descent parser builds a small syntax tree, which is compiled twice into
+ *          Thompson NFAs: once forward and once with every concatenation reversed. Bytes are
+ *          grouped into classes that no pattern set distinguishes, so DFA transition rows stay
+ *          short. Whole-string and existence checks run one forward DFA. Finding match positions
+ *          runs the reverse DFA backward over the input to mark every byte where a match starts,
+ *          then the anchored forward DFA from a marked start yields the longest match there.
+ */
+
+#include <algorithm>
+#include <bit>
+#include <limits>
+
+namespace nfx::string
+{
+	namespace detail
+	{
+		//=====================================================================
+		// Regex internals
+		//=====================================================================
+
+		/** @brief Upper bound of a "{m,n}" repetition count */
+		inline constexpr std::uint32_t kRegexMaxRepeat{ 1000 };
+
+		/** @brief Marks an unbounded repetition */
+		inline constexpr std::uint32_t kRegexUnbounded{ std::numeric_limits<std::uint32_t>::max() };
+
+		/** @brief Upper bound of NFA states per compiled direction */
+		inline constexpr std::size_t kRegexMaxStates{ 10000 };
+
+		/** @brief Upper bound of nested groups */
+		inline constexpr std::size_t kRegexMaxDepth{ 256 };
+
+		/** @brief DFA states kept before the cache is flushed */
+		inline constexpr std::size_t kRegexCacheStates{ 2048 };
+
+		/** @brief Set of byte values as a 256-bit mask */
+		using RegexByteSet = std::array<std::uint64_t, 4>;
+
+		inline bool regexSetHas( const RegexByteSet& set, unsigned char byte ) noexcept
+		{
+			return ( set[byte >> 6] >> ( byte & 63 ) ) & 1;
+		}
+
+		inline void regexSetAdd( RegexByteSet& set, unsigned char byte ) noexcept
+		{
+			set[byte >> 6] |= std::uint64_t{ 1 } << ( byte & 63 );
+		}
+
+		inline void regexSetAddRange( RegexByteSet& set, unsigned char first, unsigned char last ) noexcept
+		{
+			for ( unsigned int byte = first; byte <= last; ++byte )
+			{
+				regexSetAdd( set, static_cast<unsigned char>( byte ) );
+			}
+		}
+
+		inline void regexSetAddComplement( RegexByteSet& set, const RegexByteSet& other ) noexcept
+		{
+			for ( std::size_t i = 0; i < set.size(); ++i )
+			{
+				set[i] |= ~other[i];
+			}
+		}
+
+		/** @brief Adds the other ASCII case of every letter in the set */
+		inline void regexSetFoldCase( RegexByteSet& set ) noexcept
+		{
+			for ( unsigned char lower = 'a'; lower <= 'z'; ++lower )
+			{
+				const unsigned char upper = static_cast<unsigned char>( lower - 'a' + 'A' );
+				if ( regexSetHas( set, lower ) || regexSetHas( set, upper ) )
+				{
+					regexSetAdd( set, lower );
+					regexSetAdd( set, upper );
+				}
+			}
+		}
+
+		/** @brief Node of the parsed pattern */
+		struct RegexNode
+		{
+			enum class Kind : std::uint8_t
+			{
+				Empty,
+				Set,
+				Concat,
+				Alternate,
+				Repeat
+			};
+
+			Kind kind = Kind::Empty;
+			std::uint32_t set = 0;
+			std::uint32_t min = 0;
+			std::uint32_t max = 0;
+			std::vector<std::uint32_t> children;
+		};
+
+		//----------------------------------------------
+		// Parser
+		//----------------------------------------------
+
+		/**
+		 * @brief Recursive-descent parser producing RegexNode trees
+		 * @details Grammar: alternation = concat ('|' concat)*, concat = repeat*,
+		 *          repeat = atom quantifier*. Any error stops the parse.
+		 */
+		class RegexParser
+		{
+		public:
+			RegexParser( std::string_view pattern, bool foldCase, std::vector<RegexByteSet>& sets ) noexcept
+				: m_pattern{ pattern },
+				  m_sets{ sets },
+				  m_foldCase{ foldCase }
+			{
+			}
+
+			inline bool parse( std::uint32_t& root, bool& anchoredStart, bool& anchoredEnd )
+			{
+				if ( !m_pattern.empty() && m_pattern.front() == '^' )
+				{
+					anchoredStart = true;
+					m_pos = 1;
+				}
+				std::size_t end = m_pattern.size();
+				if ( end > m_pos && m_pattern.back() == '$' && !escapedAt( end - 1 ) )
+				{
+					anchoredEnd = true;
+					--end;
+				}
+				m_pattern = m_pattern.substr( 0, end );
+
+				root = parseAlternation();
+				if ( m_failed || m_pos != m_pattern.size() )
+				{
+					return false;
+				}
+
+				// "^a|b" would read as "(^a)|b" elsewhere; require the explicit grouping
+				return !( ( anchoredStart || anchoredEnd ) && m_topLevelAlternation );
+			}
+
+			std::vector<RegexNode> nodes;
+
+		private:
+			/** @brief True if the byte at pos is preceded by an odd number of backslashes */
+			inline bool escapedAt( std::size_t pos ) const noexcept
+			{
+				std::size_t count = 0;
+				while ( pos > count && m_pattern[pos - count - 1] == '\\' )
+				{
+					++count;
+				}
+				return ( count & 1 ) != 0;
+			}
+
+			inline std::uint32_t addNode( RegexNode node )
+			{
+				nodes.push_back( std::move( node ) );
+				return static_cast<std::uint32_t>( nodes.size() - 1 );
+			}
+
+			inline std::uint32_t addSet( RegexByteSet set )
+			{
+				if ( m_foldCase )
+				{
+					regexSetFoldCase( set );
+				}
+				m_sets.push_back( set );
+
+				RegexNode node;
+				node.kind = RegexNode::Kind::Set;
+				node.set = static_cast<std::uint32_t>( m_sets.size() - 1 );
+				return addNode( std::move( node ) );
+			}
+
+			inline std::uint32_t fail() noexcept
+			{
+				m_failed = true;
+				m_pos = m_pattern.size();
+				return 0;
+			}
+
+			inline std::uint32_t parseAlternation()
+			{
+				std::vector<std::uint32_t> branches{ parseConcat() };
+				while ( !m_failed && m_pos < m_pattern.size() && m_pattern[m_pos] == '|' )
+				{
+					m_topLevelAlternation |= m_depth == 0;
+					++m_pos;
+					branches.push_back( parseConcat() );
+				}
+				if ( branches.size() == 1 )
+				{
+					return branches.front();
+				}
+
+				RegexNode node;
+				node.kind = RegexNode::Kind::Alternate;
+				node.children = std::move( branches );
+				return addNode( std::move( node ) );
+			}
+
+			inline std::uint32_t parseConcat()
+			{
+				std::vector<std::uint32_t> children;
+				while ( !m_failed && m_pos < m_pattern.size() && m_pattern[m_pos] != '|' && m_pattern[m_pos] != ')' )
+				{
+					const std::uint32_t child = parseRepeat();
+					if ( m_failed )
+					{
+						break;
+					}
+					if ( nodes[child].kind == RegexNode::Kind::Concat )
+					{
+						// Groups carry no meaning of their own; flattening exposes literal affixes
+						const std::vector<std::uint32_t> inner = nodes[child].children;
+						children.insert( children.end(), inner.begin(), inner.end() );
+					}
+					else if ( nodes[child].kind != RegexNode::Kind::Empty )
+					{
+						children.push_back( child );
+					}
+				}
+				if ( children.size() == 1 )
+				{
+					return children.front();
+				}
+
+				RegexNode node;
+				node.kind = children.empty() ? RegexNode::Kind::Empty : RegexNode::Kind::Concat;
+				node.children = std::move( children );
+				return addNode( std::move( node ) );
+			}
+
+			inline bool parseNumber( std::uint32_t& value ) noexcept
+			{
+				const std::size_t begin = m_pos;
+				value = 0;
+				while ( m_pos < m_pattern.size() && m_pattern[m_pos] >= '0' && m_pattern[m_pos] <= '9' )
+				{
+					value = value * 10 + static_cast<std::uint32_t>( m_pattern[m_pos] - '0' );
+					if ( value > kRegexMaxRepeat )
+					{
+						return false;
+					}
+					++m_pos;
+				}
+				return m_pos != begin;
+			}
+
+			inline std::uint32_t parseRepeat()
+			{
+				std::uint32_t atom = parseAtom();
+				while ( !m_failed && m_pos < m_pattern.size() )
+				{
+					std::uint32_t min = 0;
+					std::uint32_t max = kRegexUnbounded;
+					const char c = m_pattern[m_pos];
+					if ( c == '*' )
+					{
+						++m_pos;
+					}
+					else if ( c == '+' )
+					{
+						min = 1;
+						++m_pos;
+					}
+					else if ( c == '?' )
+					{
+						max = 1;
+						++m_pos;
+					}
+					else if ( c == '{' )
+					{
+						++m_pos;
+						if ( !parseNumber( min ) )
+						{
+							return fail();
+						}
+						max = min;
+						if ( m_pos < m_pattern.size() && m_pattern[m_pos] == ',' )
+						{
+							++m_pos;
+							max = kRegexUnbounded;
+							if ( m_pos < m_pattern.size() && m_pattern[m_pos] != '}' && ( !parseNumber( max ) || max < min ) )
+							{
+								return fail();
+							}
+						}
+						if ( m_pos >= m_pattern.size() || m_pattern[m_pos] != '}' )
+						{
+							return fail();
+						}
+						++m_pos;
+					}
+					else
+					{
+						break;
+					}
+
+					// A lazy suffix cannot change a leftmost-longest match
+					if ( m_pos < m_pattern.size() && m_pattern[m_pos] == '?' )
+					{
+						++m_pos;
+					}
+
+					RegexNode node;
+					node.kind = RegexNode::Kind::Repeat;
+					node.min = min;
+					node.max = max;
+					node.children.push_back( atom );
+					atom = addNode( std::move( node ) );
+				}
+				return atom;
+			}
+
+			inline std::uint32_t parseAtom()
+			{
+				const char c = m_pattern[m_pos++];
+				RegexByteSet set{};
+				switch ( c )
+				{
+					case '(':
+					{
+						if ( ++m_depth > kRegexMaxDepth )
+						{
+							return fail();
+						}
+						if ( m_pattern.substr( m_pos, 2 ) == "?:" )
+						{
+							m_pos += 2;
+						}
+						const std::uint32_t inner = parseAlternation();
+						if ( m_failed || m_pos >= m_pattern.size() || m_pattern[m_pos] != ')' )
+						{
+							return fail();
+						}
+						++m_pos;
+						--m_depth;
+						return inner;
+					}
+					case '[':
+					{
+						if ( !parseClass( set ) )
+						{
+							return fail();
+						}
+						return addSet( set );
+					}
+					case '.':
+					{
+						regexSetAddRange( set, 0, 255 );
+						set['\n' >> 6] &= ~( std::uint64_t{ 1 } << ( '\n' & 63 ) );
+						return addSet( set );
+					}
+					case '\\':
+					{
+						if ( !parseEscape( set ) )
+						{
+							return fail();
+						}
+						return addSet( set );
+					}
+					case '*':
+					case '+':
+					case '?':
+					case '{':
+					case '^':
+					case '$':
+					{
+						return fail();
+					}
+					default:
+					{
+						regexSetAdd( set, static_cast<unsigned char>( c ) );
+						return addSet( set );
+					}
+				}
+			}
+
+			/** @brief Parses the escape after a backslash into set; returns false if unknown */
+			inline bool parseEscape( RegexByteSet& set )
+			{
+				if ( m_pos >= m_pattern.size() )
+				{
+					return false;
+				}
+
+				RegexByteSet named{};
+				const char c = m_pattern[m_pos++];
+				switch ( c )
+				{
+					case 'd':
+					case 'D':
+					{
+						regexSetAddRange( named, '0', '9' );
+						break;
+					}
+					case 'w':
+					case 'W':
+					{
+						regexSetAddRange( named, 'a', 'z' );
+						regexSetAddRange( named, 'A', 'Z' );
+						regexSetAddRange( named, '0', '9' );
+						regexSetAdd( named, '_' );
+						break;
+					}
+					case 's':
+					case 'S':
+					{
+						regexSetAddRange( named, '\t', '\r' );
+						regexSetAdd( named, ' ' );
+						break;
+					}
+					case 't':
+					{
+						regexSetAdd( set, '\t' );
+						return true;
+					}
+					case 'n':
+					{
+						regexSetAdd( set, '\n' );
+						return true;
+					}
+					case 'r':
+					{
+						regexSetAdd( set, '\r' );
+						return true;
+					}
+					case 'f':
+					{
+						regexSetAdd( set, '\f' );
+						return true;
+					}
+					case 'v':
+					{
+						regexSetAdd( set, '\v' );
+						return true;
+					}
+					case 'x':
+					{
+						const auto hex = []( char digit ) noexcept -> int {
+							if ( digit >= '0' && digit <= '9' )
+							{
+								return digit - '0';
+							}
+							if ( digit >= 'a' && digit <= 'f' )
+							{
+								return digit - 'a' + 10;
+							}
+							if ( digit >= 'A' && digit <= 'F' )
+							{
+								return digit - 'A' + 10;
+							}
+							return -1;
+						};
+						if ( m_pos + 2 > m_pattern.size() || hex( m_pattern[m_pos] ) < 0 || hex( m_pattern[m_pos + 1] ) < 0 )
+						{
+							return false;
+						}
+						regexSetAdd( set, static_cast<unsigned char>( hex( m_pattern[m_pos] ) * 16 + hex( m_pattern[m_pos + 1] ) ) );
+						m_pos += 2;
+						return true;
+					}
+					default:
+					{
+						const unsigned char byte = static_cast<unsigned char>( c );
+						if ( ( byte >= '0' && byte <= '9' ) || ( byte >= 'a' && byte <= 'z' ) || ( byte >= 'A' && byte <= 'Z' ) )
+						{
+							return false;
+						}
+						regexSetAdd( set, byte );
+						return true;
+					}
+				}
+
+				if ( c >= 'A' && c <= 'Z' )
+				{
+					regexSetAddComplement( set, named );
+				}
+				else
+				{
+					for ( std::size_t i = 0; i < set.size(); ++i )
+					{
+						set[i] |= named[i];
+					}
+				}
+				return true;
+			}
+
+			/** @brief Parses one class member; single receives its byte, or -1 for a named set */
+			inline bool parseClassAtom( RegexByteSet& set, int& single )
+			{
+				const char c = m_pattern[m_pos++];
+				if ( c != '\\' )
+				{
+					single = static_cast<unsigned char>( c );
+					return true;
+				}
+
+				RegexByteSet escaped{};
+				if ( !parseEscape( escaped ) )
+				{
+					return false;
+				}
+				single = -1;
+				int count = 0;
+				for ( unsigned int byte = 0; byte < 256; ++byte )
+				{
+					if ( regexSetHas( escaped, static_cast<unsigned char>( byte ) ) )
+					{
+						single = static_cast<int>( byte );
+						++count;
+					}
+				}
+				if ( count != 1 )
+				{
+					single = -1;
+					for ( std::size_t i = 0; i < set.size(); ++i )
+					{
+						set[i] |= escaped[i];
+					}
+				}
+				return true;
+			}
+
+			/** @brief Parses a bracket class after '['; ']' first in the class is a literal */
+			inline bool parseClass( RegexByteSet& set )
+			{
+				const bool negate = m_pos < m_pattern.size() && m_pattern[m_pos] == '^';
+				if ( negate )
+				{
+					++m_pos;
+				}
+
+				RegexByteSet members{};
+				bool first = true;
+				while ( m_pos < m_pattern.size() && ( first || m_pattern[m_pos] != ']' ) )
+				{
+					first = false;
+					int low = 0;
+					if ( !parseClassAtom( members, low ) )
+					{
+						return false;
+					}
+					if ( low < 0 )
+					{
+						continue;
+					}
+
+					if ( m_pos + 1 < m_pattern.size() && m_pattern[m_pos] == '-' && m_pattern[m_pos + 1] != ']' )
+					{
+						++m_pos;
+						int high = 0;
+						RegexByteSet unused{};
+						if ( !parseClassAtom( unused, high ) || high < low )
+						{
+							return false;
+						}
+						regexSetAddRange( members, static_cast<unsigned char>( low ), static_cast<unsigned char>( high ) );
+					}
+					else
+					{
+						regexSetAdd( members, static_cast<unsigned char>( low ) );
+					}
+				}
+				if ( m_pos >= m_pattern.size() )
+				{
+					return false;
+				}
+				++m_pos;
+
+				if ( m_foldCase )
+				{
+					regexSetFoldCase( members );
+				}
+				if ( negate )
+				{
+					regexSetAddComplement( set, members );
+				}
+				else
+				{
+					set = members;
+				}
+				return true;
+			}
+
+			std::string_view m_pattern;
+			std::vector<RegexByteSet>& m_sets;
+			std::size_t m_pos = 0;
+			std::size_t m_depth = 0;
+			bool m_foldCase;
+			bool m_failed = false;
+			bool m_topLevelAlternation = false;
+		};
+
+		//----------------------------------------------
+		// NFA construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Thompson construction from the back: each node is compiled knowing its continuation
+		 * @details Reversed compilation walks concatenations from the front, producing an NFA for
+		 *          the reversed language.
+		 */
+		class RegexCompiler
+		{
+		public:
+			RegexCompiler( const std::vector<RegexNode>& nodes, RegexNfa& nfa, bool reverse ) noexcept
+				: m_nodes{ nodes },
+				  m_nfa{ nfa },
+				  m_reverse{ reverse }
+			{
+			}
+
+			inline bool compile( std::uint32_t root )
+			{
+				m_nfa.states.clear();
+				const std::uint32_t match = add( RegexNfa::Kind::Match, 0, 0, 0 );
+				m_nfa.start = compile( root, match );
+				return !m_failed;
+			}
+
+		private:
+			inline std::uint32_t add( RegexNfa::Kind kind, std::uint32_t set, std::uint32_t out, std::uint32_t out1 )
+			{
+				if ( m_nfa.states.size() >= kRegexMaxStates )
+				{
+					m_failed = true;
+					return 0;
+				}
+				m_nfa.states.push_back( RegexNfa::State{ kind, set, out, out1 } );
+				return static_cast<std::uint32_t>( m_nfa.states.size() - 1 );
+			}
+
+			inline std::uint32_t compile( std::uint32_t index, std::uint32_t next )
+			{
+				if ( m_failed )
+				{
+					return 0;
+				}
+
+				const RegexNode& node = m_nodes[index];
+				switch ( node.kind )
+				{
+					case RegexNode::Kind::Empty:
+					{
+						return next;
+					}
+					case RegexNode::Kind::Set:
+					{
+						return add( RegexNfa::Kind::Byte, node.set, next, 0 );
+					}
+					case RegexNode::Kind::Concat:
+					{
+						if ( m_reverse )
+						{
+							for ( std::uint32_t child : node.children )
+							{
+								next = compile( child, next );
+							}
+						}
+						else
+						{
+							for ( auto child = node.children.rbegin(); child != node.children.rend(); ++child )
+							{
+								next = compile( *child, next );
+							}
+						}
+						return next;
+					}
+					case RegexNode::Kind::Alternate:
+					{
+						std::uint32_t entry = compile( node.children.back(), next );
+						for ( std::size_t i = node.children.size() - 1; i-- > 0; )
+						{
+							const std::uint32_t branch = compile( node.children[i], next );
+							entry = add( RegexNfa::Kind::Split, 0, branch, entry );
+						}
+						return entry;
+					}
+					case RegexNode::Kind::Repeat:
+					{
+						const std::uint32_t child = node.children.front();
+						std::uint32_t entry = next;
+						if ( node.max == kRegexUnbounded )
+						{
+							const std::uint32_t loop = add( RegexNfa::Kind::Split, 0, 0, next );
+							const std::uint32_t body = compile( child, loop );
+							if ( m_failed )
+							{
+								return 0;
+							}
+							m_nfa.states[loop].out = body;
+							entry = loop;
+						}
+						else
+						{
+							for ( std::uint32_t i = node.min; i < node.max; ++i )
+							{
+								const std::uint32_t body = compile( child, entry );
+								entry = add( RegexNfa::Kind::Split, 0, body, next );
+							}
+						}
+						for ( std::uint32_t i = 0; i < node.min; ++i )
+						{
+							entry = compile( child, entry );
+						}
+						return entry;
+					}
+				}
+				return next;
+			}
+
+			const std::vector<RegexNode>& m_nodes;
+			RegexNfa& m_nfa;
+			bool m_reverse;
+			bool m_failed = false;
+		};
+
+		//=====================================================================
+		// RegexDfa class
+		//=====================================================================
+
+		inline void RegexDfa::reset( const RegexNfa& nfa, std::size_t classCount, bool unanchored )
+		{
+			m_classCount = classCount;
+			m_unanchored = unanchored;
+			m_marks.assign( nfa.states.size(), 0 );
+			m_generation = 0;
+
+			m_startMembers.clear();
+			nextGeneration();
+			addClosure( nfa, nfa.start, m_startMembers );
+			std::sort( m_startMembers.begin(), m_startMembers.end() );
+
+			clear( nfa );
+		}
+
+		inline void RegexDfa::clear( const RegexNfa& nfa )
+		{
+			m_transitions.clear();
+			m_members.clear();
+			m_accepting.clear();
+			m_ids.clear();
+
+			std::vector<std::uint32_t> members;
+			intern( nfa, members );
+			std::fill( m_transitions.begin(), m_transitions.end(), dead );
+			members = m_startMembers;
+			intern( nfa, members );
+		}
+
+		inline std::int32_t RegexDfa::step( const RegexNfa& nfa, const std::vector<std::array<std::uint64_t, 4>>& sets,
+			const std::array<std::uint8_t, 256>& classes, std::int32_t state, unsigned char byte )
+		{
+			const std::int32_t next = m_transitions[static_cast<std::size_t>( state ) + classes[byte]];
+			return next >= 0 ? next : computeStep( nfa, sets, state, byte, classes[byte] );
+		}
+
+		inline std::int32_t RegexDfa::start() const noexcept
+		{
+			return static_cast<std::int32_t>( m_classCount );
+		}
+
+		inline bool RegexDfa::isAccepting( std::int32_t state ) const noexcept
+		{
+			return m_accepting[static_cast<std::size_t>( state )] != 0;
+		}
+
+		inline std::int32_t RegexDfa::adopt( const RegexNfa& nfa, const RegexDfa& other, std::int32_t state )
+		{
+			// Both DFAs are built from the same NFA, so a state carries over as its set of NFA states
+			std::vector<std::uint32_t> members = other.m_members[static_cast<std::size_t>( state ) / other.m_classCount];
+			return intern( nfa, members );
+		}
+
+		inline std::int32_t RegexDfa::computeStep( const RegexNfa& nfa, const std::vector<std::array<std::uint64_t, 4>>& sets,
+			std::int32_t state, unsigned char byte, std::size_t byteClass )
+		{
+			if ( m_members.size() >= kRegexCacheStates )
+			{
+				std::vector<std::uint32_t> current = m_members[static_cast<std::size_t>( state ) / m_classCount];
+				clear( nfa );
+				state = intern( nfa, current );
+			}
+
+			std::vector<std::uint32_t> next;
+			nextGeneration();
+			for ( std::uint32_t member : m_members[static_cast<std::size_t>( state ) / m_classCount] )
+			{
+				const RegexNfa::State& nfaState = nfa.states[member];
+				if ( nfaState.kind == RegexNfa::Kind::Byte && regexSetHas( sets[nfaState.set], byte ) )
+				{
+					addClosure( nfa, nfaState.out, next );
+				}
+			}
+			if ( m_unanchored )
+			{
+				addClosure( nfa, nfa.start, next );
+			}
+			std::sort( next.begin(), next.end() );
+
+			const std::int32_t target = intern( nfa, next );
+			m_transitions[static_cast<std::size_t>( state ) + byteClass] = target;
+			return target;
+		}
+
+		inline void RegexDfa::nextGeneration() noexcept
+		{
+			if ( ++m_generation == 0 )
+			{
+				std::fill( m_marks.begin(), m_marks.end(), 0 );
+				m_generation = 1;
+			}
+		}
+
+		inline void RegexDfa::addClosure( const RegexNfa& nfa, std::uint32_t state, std::vector<std::uint32_t>& members )
+		{
+			m_stack.push_back( state );
+			while ( !m_stack.empty() )
+			{
+				const std::uint32_t current = m_stack.back();
+				m_stack.pop_back();
+				if ( m_marks[current] == m_generation )
+				{
+					continue;
+				}
+				m_marks[current] = m_generation;
+
+				const RegexNfa::State& nfaState = nfa.states[current];
+				if ( nfaState.kind == RegexNfa::Kind::Split )
+				{
+					m_stack.push_back( nfaState.out1 );
+					m_stack.push_back( nfaState.out );
+				}
+				else
+				{
+					members.push_back( current );
+				}
+			}
+		}
+
+		inline std::int32_t RegexDfa::intern( const RegexNfa& nfa, std::vector<std::uint32_t>& members )
+		{
+			std::string key{ reinterpret_cast<const char*>( members.data() ), members.size() * sizeof( std::uint32_t ) };
+			const auto found = m_ids.find( key );
+			if ( found != m_ids.end() )
+			{
+				return found->second;
+			}
+
+			const std::int32_t id = static_cast<std::int32_t>( m_transitions.size() );
+			const bool accepting = std::any_of( members.begin(), members.end(), [&nfa]( std::uint32_t member ) noexcept {
+				return nfa.states[member].kind == RegexNfa::Kind::Match;
+			} );
+			m_ids.emplace( std::move( key ), id );
+			m_members.push_back( std::move( members ) );
+			m_accepting.resize( m_transitions.size() + m_classCount, accepting ? 1 : 0 );
+			m_transitions.resize( m_transitions.size() + m_classCount, -1 );
+			return id;
+		}
+		//=====================================================================
+		// RegexCachePool class
+		//=====================================================================
+
+		inline RegexCachePool::Lease::Lease( const RegexCachePool& pool, std::unique_ptr<Caches> caches ) noexcept
+			: m_pool{ pool },
+			  m_caches{ std::move( caches ) }
+		{
+		}
+
+		inline RegexCachePool::Lease::~Lease()
+		{
+			const std::lock_guard<std::mutex> lock{ m_pool.m_mutex };
+			m_caches->next = std::move( m_pool.m_free );
+			m_pool.m_free = std::move( m_caches );
+		}
+
+		inline RegexCachePool::Caches& RegexCachePool::Lease::operator*() const noexcept
+		{
+			return *m_caches;
+		}
+
+		inline RegexCachePool::Caches* RegexCachePool::Lease::operator->() const noexcept
+		{
+			return m_caches.get();
+		}
+
+		inline RegexCachePool::RegexCachePool( const RegexCachePool& other )
+			: m_prototype{ other.m_prototype.anchored, other.m_prototype.search, other.m_prototype.reverse, nullptr }
+		{
+		}
+
+		inline RegexCachePool& RegexCachePool::operator=( const RegexCachePool& other )
+		{
+			if ( this != &other )
+			{
+				m_prototype.anchored = other.m_prototype.anchored;
+				m_prototype.search = other.m_prototype.search;
+				m_prototype.reverse = other.m_prototype.reverse;
+
+				const std::lock_guard<std::mutex> lock{ m_mutex };
+				m_free.reset();
+			}
+			return *this;
+		}
+
+		inline RegexCachePool::Caches& RegexCachePool::prototype() noexcept
+		{
+			return m_prototype;
+		}
+
+		inline RegexCachePool::Lease RegexCachePool::acquire() const
+		{
+			{
+				const std::lock_guard<std::mutex> lock{ m_mutex };
+				if ( m_free )
+				{
+					std::unique_ptr<Caches> caches = std::move( m_free );
+					m_free = std::move( caches->next );
+					return Lease{ *this, std::move( caches ) };
+				}
+			}
+
+			// The prototype is only written at construction, so it is copied without the lock
+			return Lease{ *this, std::unique_ptr<Caches>{ new Caches{ m_prototype.anchored, m_prototype.search, m_prototype.reverse, nullptr } } };
+		}
+	} // namespace detail
+
+	//=====================================================================
+	// Regex class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	inline Regex::Regex( std::string_view pattern, RegexCase caseMode )
+		: m_pattern{ pattern },
+		  m_case{ caseMode }
+	{
+		detail::RegexParser parser{ pattern, caseMode == RegexCase::Insensitive, m_sets };
+		std::uint32_t root = 0;
+		if ( !parser.parse( root, m_anchoredStart, m_anchoredEnd ) ||
+			 !detail::RegexCompiler{ parser.nodes, m_forward, false }.compile( root ) ||
+			 !detail::RegexCompiler{ parser.nodes, m_reverse, true }.compile( root ) )
+		{
+			return;
+		}
+
+		// Bytes that every set treats alike share a class and a DFA transition column
+		std::size_t classCount = 1;
+		for ( const detail::RegexByteSet& set : m_sets )
+		{
+			std::array<std::int16_t, 512> renumber;
+			renumber.fill( -1 );
+			std::int16_t count = 0;
+			for ( unsigned int byte = 0; byte < 256; ++byte )
+			{
+				const std::size_t key = m_classes[byte] * 2u + ( detail::regexSetHas( set, static_cast<unsigned char>( byte ) ) ? 1u : 0u );
+				if ( renumber[key] < 0 )
+				{
+					renumber[key] = count++;
+				}
+				m_classes[byte] = static_cast<std::uint8_t>( renumber[key] );
+			}
+			classCount = static_cast<std::size_t>( count );
+		}
+
+		// Literal bytes that open or close every match drive the prefilters
+		const auto literal = [&]( std::uint32_t index, char& byte ) {
+			const detail::RegexNode& node = parser.nodes[index];
+			if ( node.kind != detail::RegexNode::Kind::Set )
+			{
+				return false;
+			}
+			const detail::RegexByteSet& set = m_sets[node.set];
+			if ( std::popcount( set[0] ) + std::popcount( set[1] ) + std::popcount( set[2] ) + std::popcount( set[3] ) != 1 )
+			{
+				return false;
+			}
+			for ( unsigned int value = 0; value < 256; ++value )
+			{
+				if ( detail::regexSetHas( set, static_cast<unsigned char>( value ) ) )
+				{
+					byte = static_cast<char>( value );
+				}
+			}
+			return true;
+		};
+		const detail::RegexNode& top = parser.nodes[root];
+		const std::vector<std::uint32_t> single{ root };
+		const std::vector<std::uint32_t>& sequence = top.kind == detail::RegexNode::Kind::Concat ? top.children : single;
+		char byte = 0;
+		for ( auto it = sequence.begin(); it != sequence.end() && literal( *it, byte ); ++it )
+		{
+			m_prefix.push_back( byte );
+		}
+		for ( auto it = sequence.rbegin(); it != sequence.rend() && literal( *it, byte ); ++it )
+		{
+			m_suffix.push_back( byte );
+		}
+		std::reverse( m_suffix.begin(), m_suffix.end() );
+
+		m_caches.prototype().anchored.reset( m_forward, classCount, false );
+		m_caches.prototype().search.reset( m_forward, classCount, true );
+		m_caches.prototype().reverse.reset( m_reverse, classCount, !m_anchoredEnd );
+		m_valid = true;
+	}
+
+	//----------------------------------------------
+	// Matching
+	//----------------------------------------------
+
+	inline bool Regex::matches( std::string_view str ) const
+	{
+		if ( !m_valid )
+		{
+			return false;
+		}
+
+		const detail::RegexCachePool::Lease caches = m_caches.acquire();
+		return matches( *caches, str );
+	}
+
+	inline bool Regex::search( std::string_view str ) const
+	{
+		if ( !m_valid )
+		{
+			return false;
+		}
+		const detail::RegexCachePool::Lease caches = m_caches.acquire();
+		if ( m_anchoredStart && m_anchoredEnd )
+		{
+			return matches( *caches, str );
+		}
+
+		if ( m_anchoredStart )
+		{
+			detail::RegexDfa& dfa = caches->anchored;
+			std::int32_t state = dfa.start();
+			for ( std::size_t i = 0; !dfa.isAccepting( state ); ++i )
+			{
+				if ( i == str.size() )
+				{
+					return false;
+				}
+				state = step( dfa, m_forward, state, str[i] );
+				if ( state == detail::RegexDfa::dead )
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		return earliestEnd( *caches, str, 0 ) != std::string_view::npos;
+	}
+
+	inline bool Regex::find( std::string_view str, std::size_t pos, std::string_view& match ) const
+	{
+		if ( !m_valid || pos > str.size() )
+		{
+			return false;
+		}
+
+		const detail::RegexCachePool::Lease caches = m_caches.acquire();
+		std::size_t begin = std::string_view::npos;
+		if ( m_anchoredStart || m_anchoredEnd )
+		{
+			// A match starts at 0 or ends at str.size(), so the scan covers no more than it must read
+			scanStarts( *caches, str, pos, str.size(), nullptr, begin );
+		}
+		else
+		{
+			begin = leftmostStart( *caches, str, pos );
+		}
+		if ( begin == std::string_view::npos )
+		{
+			return false;
+		}
+		match = str.substr( begin, longestEnd( *caches, str, begin ) - begin );
+		return true;
+	}
+
+	//----------------------------------------------
+	// Access
+	//----------------------------------------------
+
+	inline bool Regex::isValid() const noexcept
+	{
+		return m_valid;
+	}
+
+	inline std::string_view Regex::pattern() const noexcept
+	{
+		return m_pattern;
+	}
+
+	inline RegexCase Regex::caseMode() const noexcept
+	{
+		return m_case;
+	}
+
+	//----------------------------------------------
+	// Private methods
+	//----------------------------------------------
+
+	inline std::int32_t Regex::step( detail::RegexDfa& dfa, const detail::RegexNfa& nfa, std::int32_t state, char c ) const
+	{
+		return dfa.step( nfa, m_sets, m_classes, state, static_cast<unsigned char>( c ) );
+	}
+
+	inline bool Regex::matches( Caches& caches, std::string_view str ) const
+	{
+		detail::RegexDfa& dfa = caches.anchored;
+		std::int32_t state = dfa.start();
+		for ( char c : str )
+		{
+			state = step( dfa, m_forward, state, c );
+			if ( state == detail::RegexDfa::dead )
+			{
+				return false;
+			}
+		}
+		return dfa.isAccepting( state );
+	}
+
+	inline std::size_t Regex::earliestEnd( Caches& caches, std::string_view str, std::size_t pos ) const
+	{
+		detail::RegexDfa& dfa = caches.search;
+		const std::int32_t start = dfa.start();
+		std::int32_t state = start;
+		if ( !m_anchoredEnd && dfa.isAccepting( state ) )
+		{
+			return pos;
+		}
+		for ( std::size_t i = pos; i < str.size(); )
+		{
+			// With no match in progress, skip ahead to where the next one could start
+			if ( state == start && !m_prefix.empty() )
+			{
+				i = str.find( m_prefix, i );
+				if ( i == std::string_view::npos )
+				{
+					return std::string_view::npos;
+				}
+			}
+			state = step( dfa, m_forward, state, str[i++] );
+			if ( !m_anchoredEnd && dfa.isAccepting( state ) )
+			{
+				return i;
+			}
+		}
+		return dfa.isAccepting( state ) ? str.size() : std::string_view::npos;
+	}
+
+	inline std::size_t Regex::leftmostStart( Caches& caches, std::string_view str, std::size_t pos ) const
+	{
+		// The leftmost start among the matches ending by the earliest match end, found backwards from there
+		std::size_t end = earliestEnd( caches, str, pos );
+		if ( end == std::string_view::npos )
+		{
+			return std::string_view::npos;
+		}
+		std::size_t begin = std::string_view::npos;
+		scanStarts( caches, str, pos, end, nullptr, begin );
+
+		// A start further left may still have matches, all ending later: follow its threads until they die
+		while ( begin > pos )
+		{
+			end = endBefore( caches, str, pos, begin );
+			if ( end == std::string_view::npos )
+			{
+				break;
+			}
+			scanStarts( caches, str, pos, end, nullptr, begin );
+		}
+		return begin;
+	}
+
+	inline std::size_t Regex::endBefore( Caches& caches, std::string_view str, std::size_t pos, std::size_t limit ) const
+	{
+		// Threads started at every position before limit, the last one not yet advanced
+		std::int32_t state = caches.search.start();
+		for ( std::size_t i = pos; i + 1 < limit; ++i )
+		{
+			state = step( caches.search, m_forward, state, str[i] );
+		}
+
+		// Advanced without starting new threads, until the first of them matches or all die
+		detail::RegexDfa& dfa = caches.anchored;
+		state = dfa.adopt( m_forward, caches.search, state );
+		for ( std::size_t i = limit - 1; state != detail::RegexDfa::dead; )
+		{
+			if ( dfa.isAccepting( state ) )
+			{
+				return i;
+			}
+			if ( i == str.size() )
+			{
+				break;
+			}
+			state = step( dfa, m_forward, state, str[i++] );
+		}
+		return std::string_view::npos;
+	}
+
+	inline void Regex::scanStarts( Caches& caches, std::string_view str, std::size_t pos, std::size_t end,
+		std::vector<std::uint64_t>* starts, std::size_t& first ) const
+	{
+		const auto mark = [&]( std::size_t i ) {
+			first = i;
+			if ( starts != nullptr )
+			{
+				( *starts )[i / 64] |= std::uint64_t{ 1 } << ( i % 64 );
+			}
+		};
+
+		first = std::string_view::npos;
+		if ( m_anchoredStart )
+		{
+			if ( pos == 0 && longestEnd( caches, str, 0 ) != std::string_view::npos )
+			{
+				mark( 0 );
+			}
+			return;
+		}
+
+		// The reverse DFA accepts at every position where a match starts
+		detail::RegexDfa& dfa = caches.reverse;
+		const std::int32_t start = dfa.start();
+		std::int32_t state = start;
+		std::size_t i = end;
+		if ( dfa.isAccepting( state ) )
+		{
+			mark( i );
+		}
+		while ( i > pos )
+		{
+			// With no match in progress, skip back to where the previous one could end
+			if ( state == start && !m_anchoredEnd && !m_suffix.empty() )
+			{
+				if ( i - pos < m_suffix.size() )
+				{
+					return;
+				}
+				const std::size_t occurrence = str.rfind( m_suffix, i - m_suffix.size() );
+				if ( occurrence == std::string_view::npos || occurrence < pos )
+				{
+					return;
+				}
+				i = occurrence + m_suffix.size();
+			}
+			state = step( dfa, m_reverse, state, str[--i] );
+			if ( state == detail::RegexDfa::dead )
+			{
+				return;
+			}
+			if ( dfa.isAccepting( state ) )
+			{
+				mark( i );
+			}
+		}
+	}
+
+	inline std::size_t Regex::longestEnd( Caches& caches, std::string_view str, std::size_t pos ) const
+	{
+		detail::RegexDfa& dfa = caches.anchored;
+		std::size_t end = std::string_view::npos;
+		std::int32_t state = dfa.start();
+		if ( dfa.isAccepting( state ) && ( !m_anchoredEnd || pos == str.size() ) )
+		{
+			end = pos;
+		}
+		for ( std::size_t i = pos; i < str.size(); )
+		{
+			state = step( dfa, m_forward, state, str[i++] );
+			if ( state == detail::RegexDfa::dead )
+			{
+				break;
+			}
+			if ( dfa.isAccepting( state ) && ( !m_anchoredEnd || i == str.size() ) )
+			{
+				end = i;
+			}
+		}
+		return end;
+	}
+
+	inline bool Regex::nextMatch( std::string_view str, const std::vector<std::uint64_t>& starts, std::size_t pos,
+		std::size_t& begin, std::size_t& end ) const
+	{
+		const detail::RegexCachePool::Lease caches = m_caches.acquire();
+		for ( std::size_t word = pos / 64; word < starts.size(); ++word )
+		{
+			std::uint64_t bits = starts[word];
+			if ( word == pos / 64 )
+			{
+				bits &= ~std::uint64_t{ 0 } << ( pos % 64 );
+			}
+			while ( bits != 0 )
+			{
+				const std::size_t start = word * 64 + static_cast<std::size_t>( std::countr_zero( bits ) );
+				bits &= bits - 1;
+
+				const std::size_t stop = longestEnd( *caches, str, start );
+				if ( stop != std::string_view::npos && stop > start )
+				{
+					begin = start;
+					end = stop;
+					return true;
+				}
+			}
+		}
+		return false;
+	}
+
+	//=====================================================================
+	// RegexSplitter class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	inline RegexSplitter::RegexSplitter( std::string_view str, const Regex& regex )
+		: m_str{ str },
+		  m_regex{ &regex }
+	{
+		locateStarts();
+	}
+
+	inline RegexSplitter::RegexSplitter( std::string_view str, Regex&& regex )
+		: m_str{ str },
+		  m_owned{ std::make_shared<const Regex>( std::move( regex ) ) },
+		  m_regex{ m_owned.get() }
+	{
+		locateStarts();
+	}
+
+	//----------------------------------------------
+	// Iteration
+	//----------------------------------------------
+
+	inline RegexSplitter::Iterator RegexSplitter::begin() const
+	{
+		return Iterator{ *this };
+	}
+
+	inline RegexSplitter::Iterator RegexSplitter::end() const
+	{
+		return Iterator{ *this, true };
+	}
+
+	//----------------------------------------------
+	// Private methods
+	//----------------------------------------------
+
+	inline void RegexSplitter::locateStarts()
+	{
+		if ( !m_str.empty() && m_regex->isValid() )
+		{
+			m_starts.assign( m_str.size() / 64 + 1, 0 );
+			const detail::RegexCachePool::Lease caches = m_regex->m_caches.acquire();
+			std::size_t first = 0;
+			m_regex->scanStarts( *caches, m_str, 0, m_str.size(), &m_starts, first );
+		}
+	}
+
+	//----------------------------------------------
+	// RegexSplitter::Iterator class
+	//----------------------------------------------
+
+	//-----------------------------
+	// Construction
+	//-----------------------------
+
+	inline RegexSplitter::Iterator::Iterator( const RegexSplitter& splitter, bool atEnd )
+		: m_splitter{ &splitter },
+		  m_start{ 0 },
+		  m_end{ 0 },
+		  m_next{ 0 },
+		  m_isLast{ false },
+		  m_isAtEnd{ atEnd || splitter.m_str.empty() }
+	{
+		if ( !m_isAtEnd )
+		{
+			findSeparator( 0 );
+		}
+	}
+
+	//-----------------------------
+	// Iterator operators
+	//-----------------------------
+
+	inline std::string_view RegexSplitter::Iterator::operator*() const noexcept
+	{
+		return m_splitter->m_str.substr( m_start, m_end - m_start );
+	}
+
+	inline RegexSplitter::Iterator& RegexSplitter::Iterator::operator++()
+	{
+		if ( m_isLast )
+		{
+			m_isAtEnd = true;
+			return *this;
+		}
+		m_start = m_next;
+		findSeparator( m_next );
+		return *this;
+	}
+
+	inline RegexSplitter::Iterator RegexSplitter::Iterator::operator++( int )
+	{
+		Iterator temp = *this;
+		++( *this );
+		return temp;
+	}
+
+	//-----------------------------
+	// Comparison operators
+	//-----------------------------
+
+	inline bool RegexSplitter::Iterator::operator==( const Iterator& other ) const noexcept
+	{
+		return m_isAtEnd == other.m_isAtEnd;
+	}
+
+	inline bool RegexSplitter::Iterator::operator!=( const Iterator& other ) const noexcept
+	{
+		return !( *this == other );
+	}
+
+	//-----------------------------
+	// Private methods
+	//-----------------------------
+
+	inline void RegexSplitter::Iterator::findSeparator( std::size_t pos )
+	{
+		std::size_t begin = 0;
+		std::size_t end = 0;
+		if ( m_splitter->m_regex->nextMatch( m_splitter->m_str, m_splitter->m_starts, pos, begin, end ) )
+		{
+			m_end = begin;
+			m_next = end;
+		}
+		else
+		{
+			m_end = m_splitter->m_str.size();
+			m_isLast = true;
+		}
+	}
+
+	//=====================================================================
+	// Regular expression functions
+	//=====================================================================
+
+	inline bool regexMatch( std::string_view str, const Regex& regex )
+	{
+		return regex.matches( str );
+	}
+
+	inline bool regexMatch( std::string_view str, std::string_view pattern )
+	{
+		return Regex{ pattern }.matches( str );
+	}
+
+	inline bool regexSearch( std::string_view str, const Regex& regex )
+	{
+		return regex.search( str );
+	}
+
+	inline bool regexSearch( std::string_view str, std::string_view pattern )
+	{
+		return Regex{ pattern }.search( str );
+	}
+
+	inline std::string regexReplace( std::string_view str, const Regex& regex, std::string_view replacement )
+	{
+		std::string result;
+		result.reserve( str.size() );
+		bool first = true;
+		for ( std::string_view piece : RegexSplitter{ str, regex } )
+		{
+			if ( !first )
+			{
+				result.append( replacement );
+			}
+			result.append( piece );
+			first = false;
+		}
+		return result;
+	}
+
+	inline std::string regexReplace( std::string_view str, std::string_view pattern, std::string_view replacement )
+	{
+		return regexReplace( str, Regex{ pattern }, replacement );
+	}
+
+	inline RegexSplitter regexSplit( std::string_view str, const Regex& regex )
+	{
+		return RegexSplitter{ str, regex };
+	}
+
+	inline RegexSplitter regexSplit( std::string_view str, std::string_view pattern )
+	{
+		return RegexSplitter{ str, Regex{ pattern } };
+	}
+} // namespace nfx::string
@@ -0,0 +1,818 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Simd.h
+ * @brief Internal SIMD helpers shared by the string utilities
+ * @details Compile-time selection of the widest available x86 instruction set (AVX2, SSSE3, SSE2)
+ *          with a portable SWAR fallback. Define NFX_STRINGUTILS_NO_SIMD to force the portable path.
+ *          Nothing in this header is part of the public API.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+//=====================================================================
+// Instruction set detection
+//=====================================================================
+
+#if !defined( NFX_STRINGUTILS_NO_SIMD )
+#	if defined( __AVX2__ )
+#		define NFX_STRINGUTILS_HAS_AVX2 1
+#	endif
+#	if defined( __SSSE3__ ) || defined( NFX_STRINGUTILS_HAS_AVX2 )
+#		define NFX_STRINGUTILS_HAS_SSSE3 1
+#	endif
+#	if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+#		define NFX_STRINGUTILS_HAS_SSE2 1
+#	endif
+#endif
+
+#if defined( NFX_STRINGUTILS_HAS_SSSE3 )
+#	include <immintrin.h>
+#elif defined( NFX_STRINGUTILS_HAS_SSE2 )
+#	include <emmintrin.h>
+#endif
+
+namespace nfx::string::detail::simd
+{
+	//=====================================================================
+	// Scalar helpers
+	//=====================================================================
+
+	/** @brief Every byte set to 0x80 */
+	inline constexpr std::uint64_t kHighBits{ 0x8080808080808080ull };
+
+	/** @brief Every byte set to 0x01 */
+	inline constexpr std::uint64_t kLowBits{ 0x0101010101010101ull };
+
+	/**
+	 * @brief Unaligned little-endian load of 8 bytes
+	 * @param data Pointer to at least 8 readable bytes
+	 * @return The 8 bytes packed into a 64-bit word
+	 */
+	inline std::uint64_t loadU64( const char* data ) noexcept
+	{
+		std::uint64_t word;
+		std::memcpy( &word, data, sizeof( word ) );
+		return word;
+	}
+
+	/**
+	 * @brief Unaligned big-endian load of 8 bytes
+	 * @param data Pointer to at least 8 readable bytes
+	 * @return The 8 bytes packed so that integer order equals byte-wise (memcmp) order
+	 */
+	inline std::uint64_t loadBigEndianU64( const char* data ) noexcept
+	{
+		std::uint64_t word = loadU64( data );
+		if constexpr ( std::endian::native == std::endian::little )
+		{
+			word = ( ( word & 0x00FF00FF00FF00FFull ) << 8 ) | ( ( word >> 8 ) & 0x00FF00FF00FF00FFull );
+			word = ( ( word & 0x0000FFFF0000FFFFull ) << 16 ) | ( ( word >> 16 ) & 0x0000FFFF0000FFFFull );
+			word = ( word << 32 ) | ( word >> 32 );
+		}
+		return word;
+	}
+
+	/**
+	 * @brief ASCII lowercase of 8 packed bytes
+	 * @param word Bytes to fold, in any byte order
+	 * @return The word with every byte in 'A'-'Z' replaced by its lowercase letter
+	 */
+	inline constexpr std::uint64_t toLowerAsciiU64( std::uint64_t word ) noexcept
+	{
+		const std::uint64_t heptets = word & ~kHighBits;
+		const std::uint64_t atLeastA = heptets + ( 0x80 - 'A' ) * kLowBits;
+		const std::uint64_t aboveZ = heptets + ( 0x80 - 'Z' - 1 ) * kLowBits;
+		const std::uint64_t upper = atLeastA & ~aboveZ & ~word & kHighBits;
+		return word | ( upper >> 2 );
+	}
+
+	/**
+	 * @brief Index of the first byte flagged in a SWAR mask
+	 * @param marks Word whose flagged bytes have their high bit set (all other bits clear)
+	 * @return Byte index in memory order of the first flagged byte
+	 */
+	inline std::size_t firstMarkedByte( std::uint64_t marks ) noexcept
+	{
+		if constexpr ( std::endian::native == std::endian::little )
+		{
+			return static_cast<std::size_t>( std::countr_zero( marks ) / 8 );
+		}
+		else
+		{
+			return static_cast<std::size_t>( std::countl_zero( marks ) / 8 );
+		}
+	}
+
+	//=====================================================================
+	// Vector wrappers
+	//=====================================================================
+
+#if defined( NFX_STRINGUTILS_HAS_SSSE3 )
+	/**
+	 * @brief 128-bit SSSE3 vector operations
+	 * @details Thin static wrapper so byte-parallel kernels can be written once and instantiated per width
+	 */
+	struct Sse
+	{
+		using Vector = __m128i;
+
+		static constexpr std::size_t width = 16;
+
+		static Vector load( const char* data ) noexcept { return _mm_loadu_si128( reinterpret_cast<const __m128i*>( data ) ); }
+
+		static Vector zero() noexcept { return _mm_setzero_si128(); }
+
+		static Vector splat( std::uint8_t value ) noexcept { return _mm_set1_epi8( static_cast<char>( value ) ); }
+
+		static Vector table( const std::uint8_t ( &values )[16] ) noexcept
+		{
+			return _mm_loadu_si128( reinterpret_cast<const __m128i*>( values ) );
+		}
+
+		static Vector lookup( Vector table, Vector indices ) noexcept { return _mm_shuffle_epi8( table, indices ); }
+
+		static Vector highNibbles( Vector v ) noexcept { return _mm_and_si128( _mm_srli_epi16( v, 4 ), splat( 0x0F ) ); }
+
+		static Vector lowNibbles( Vector v ) noexcept { return _mm_and_si128( v, splat( 0x0F ) ); }
+
+		static Vector and_( Vector a, Vector b ) noexcept { return _mm_and_si128( a, b ); }
+
+		static Vector or_( Vector a, Vector b ) noexcept { return _mm_or_si128( a, b ); }
+
+		static Vector xor_( Vector a, Vector b ) noexcept { return _mm_xor_si128( a, b ); }
+
+		static Vector subSaturate( Vector a, Vector b ) noexcept { return _mm_subs_epu8( a, b ); }
+
+		static Vector equal( Vector a, Vector b ) noexcept { return _mm_cmpeq_epi8( a, b ); }
+
+		template <int N>
+		static Vector prev( Vector current, Vector previous ) noexcept
+		{
+			return _mm_alignr_epi8( current, previous, 16 - N );
+		}
+
+		static std::uint32_t highBitMask( Vector v ) noexcept { return static_cast<std::uint32_t>( _mm_movemask_epi8( v ) ); }
+
+		static bool isAscii( Vector v ) noexcept { return highBitMask( v ) == 0; }
+
+		static bool any( Vector v ) noexcept
+		{
+			return _mm_movemask_epi8( _mm_cmpeq_epi8( v, zero() ) ) != 0xFFFF;
+		}
+	};
+#endif
+
+#if defined( NFX_STRINGUTILS_HAS_AVX2 )
+	/**
+	 * @brief 256-bit AVX2 vector operations
+	 * @details Same interface as Sse; lookup tables are replicated into both 128-bit lanes
+	 */
+	struct Avx2
+	{
+		using Vector = __m256i;
+
+		static constexpr std::size_t width = 32;
+
+		static Vector load( const char* data ) noexcept { return _mm256_loadu_si256( reinterpret_cast<const __m256i*>( data ) ); }
+
+		static Vector zero() noexcept { return _mm256_setzero_si256(); }
+
+		static Vector splat( std::uint8_t value ) noexcept { return _mm256_set1_epi8( static_cast<char>( value ) ); }
+
+		static Vector table( const std::uint8_t ( &values )[16] ) noexcept
+		{
+			return _mm256_broadcastsi128_si256( _mm_loadu_si128( reinterpret_cast<const __m128i*>( values ) ) );
+		}
+
+		static Vector lookup( Vector table, Vector indices ) noexcept { return _mm256_shuffle_epi8( table, indices ); }
+
+		static Vector highNibbles( Vector v ) noexcept { return _mm256_and_si256( _mm256_srli_epi16( v, 4 ), splat( 0x0F ) ); }
+
+		static Vector lowNibbles( Vector v ) noexcept { return _mm256_and_si256( v, splat( 0x0F ) ); }
+
+		static Vector and_( Vector a, Vector b ) noexcept { return _mm256_and_si256( a, b ); }
+
+		static Vector or_( Vector a, Vector b ) noexcept { return _mm256_or_si256( a, b ); }
+
+		static Vector xor_( Vector a, Vector b ) noexcept { return _mm256_xor_si256( a, b ); }
+
+		static Vector subSaturate( Vector a, Vector b ) noexcept { return _mm256_subs_epu8( a, b ); }
+
+		static Vector equal( Vector a, Vector b ) noexcept { return _mm256_cmpeq_epi8( a, b ); }
+
+		template <int N>
+		static Vector prev( Vector current, Vector previous ) noexcept
+		{
+			return _mm256_alignr_epi8( current, _mm256_permute2x128_si256( previous, current, 0x21 ), 16 - N );
+		}
+
+		static std::uint32_t highBitMask( Vector v ) noexcept { return static_cast<std::uint32_t>( _mm256_movemask_epi8( v ) ); }
+
+		static bool isAscii( Vector v ) noexcept { return highBitMask( v ) == 0; }
+
+		static bool any( Vector v ) noexcept { return !_mm256_testz_si256( v, v ); }
+	};
+#endif
+
+	//=====================================================================
+	// Byte scanning
+	//=====================================================================
+
+	/**
+	 * @brief Length of the leading run of ASCII bytes
+	 * @param data Pointer to the bytes to scan
+	 * @param size Number of bytes available
+	 * @return Index of the first byte >= 0x80, or size if every byte is ASCII
+	 * @details Skips 64-byte blocks with a single test when vector instructions are available.
+	 */
+	inline std::size_t asciiPrefixLength( const char* data, std::size_t size ) noexcept
+	{
+		std::size_t pos = 0;
+
+#if defined( NFX_STRINGUTILS_HAS_AVX2 )
+		for ( ; pos + 64 <= size; pos += 64 )
+		{
+			const __m256i a = Avx2::load( data + pos );
+			const __m256i b = Avx2::load( data + pos + 32 );
+			if ( !Avx2::isAscii( Avx2::or_( a, b ) ) )
+			{
+				const std::uint32_t maskA = Avx2::highBitMask( a );
+				return maskA != 0
+						   ? pos + static_cast<std::size_t>( std::countr_zero( maskA ) )
+						   : pos + 32 + static_cast<std::size_t>( std::countr_zero( Avx2::highBitMask( b ) ) );
+			}
+		}
+#endif
+
+#if defined( NFX_STRINGUTILS_HAS_SSE2 )
+		for ( ; pos + 16 <= size; pos += 16 )
+		{
+			const std::uint32_t mask = static_cast<std::uint32_t>(
+				_mm_movemask_epi8( _mm_loadu_si128( reinterpret_cast<const __m128i*>( data + pos ) ) ) );
+			if ( mask != 0 )
+			{
+				return pos + static_cast<std::size_t>( std::countr_zero( mask ) );
+			}
+		}
+#endif
+
+		for ( ; pos + 8 <= size; pos += 8 )
+		{
+			const std::uint64_t high = loadU64( data + pos ) & kHighBits;
+			if ( high != 0 )
+			{
+				return pos + firstMarkedByte( high );
+			}
+		}
+
+		while ( pos < size && static_cast<unsigned char>( data[pos] ) < 0x80 )
+		{
+			++pos;
+		}
+
+		return pos;
+	}
+
+	/**
+	 * @brief Length of the common prefix of two byte ranges
+	 * @param lhs Pointer to the first range
+	 * @param rhs Pointer to the second range
+	 * @param size Number of bytes readable from both
+	 * @return Index of the first differing byte, or size if the ranges are equal
+	 * @details Compares 32 or 16 bytes per step and locates the mismatch with a count of
+	 *          trailing zeros on the inequality mask.
+	 */
+	inline std::size_t commonPrefixLength( const char* lhs, const char* rhs, std::size_t size ) noexcept
+	{
+		std::size_t pos = 0;
+
+#if defined( NFX_STRINGUTILS_HAS_AVX2 )
+		for ( ; pos + 32 <= size; pos += 32 )
+		{
+			const std::uint32_t equal = Avx2::highBitMask( _mm256_cmpeq_epi8( Avx2::load( lhs + pos ), Avx2::load( rhs + pos ) ) );
+			if ( equal != 0xFFFFFFFFu )
+			{
+				return pos + static_cast<std::size_t>( std::countr_one( equal ) );
+			}
+		}
+#endif
+
+#if defined( NFX_STRINGUTILS_HAS_SSE2 )
+		for ( ; pos + 16 <= size; pos += 16 )
+		{
+			const std::uint32_t equal = static_cast<std::uint32_t>( _mm_movemask_epi8( _mm_cmpeq_epi8(
+				_mm_loadu_si128( reinterpret_cast<const __m128i*>( lhs + pos ) ),
+				_mm_loadu_si128( reinterpret_cast<const __m128i*>( rhs + pos ) ) ) ) );
+			if ( equal != 0xFFFFu )
+			{
+				return pos + static_cast<std::size_t>( std::countr_one( equal ) );
+			}
+		}
+#endif
+
+		for ( ; pos + 8 <= size; pos += 8 )
+		{
+			const std::uint64_t difference = loadU64( lhs + pos ) ^ loadU64( rhs + pos );
+			if ( difference != 0 )
+			{
+				if constexpr ( std::endian::native == std::endian::little )
+				{
+					return pos + static_cast<std::size_t>( std::countr_zero( difference ) / 8 );
+				}
+				else
+				{
+					return pos + static_cast<std::size_t>( std::countl_zero( difference ) / 8 );
+				}
+			}
+		}
+
+		while ( pos < size && lhs[pos] == rhs[pos] )
+		{
+			++pos;
+		}
+
+		return pos;
+	}
+
+	/**
+	 * @brief Length of the common suffix of two byte ranges
+	 * @param lhsEnd Pointer one past the end of the first range
+	 * @param rhsEnd Pointer one past the end of the second range
+	 * @param size Number of bytes readable before both ends
+	 * @return Number of equal trailing bytes, at most size
+	 * @details Mirror of commonPrefixLength() that scans backward and counts leading zeros.
+	 */
+	inline std::size_t commonSuffixLength( const char* lhsEnd, const char* rhsEnd, std::size_t size ) noexcept
+	{
+		std::size_t pos = 0;
+
+#if defined( NFX_STRINGUTILS_HAS_AVX2 )
+		for ( ; pos + 32 <= size; pos += 32 )
+		{
+			const std::uint32_t equal = Avx2::highBitMask(
+				_mm256_cmpeq_epi8( Avx2::load( lhsEnd - pos - 32 ), Avx2::load( rhsEnd - pos - 32 ) ) );
+			if ( equal != 0xFFFFFFFFu )
+			{
+				return pos + static_cast<std::size_t>( std::countl_one( equal ) );
+			}
+		}
+#endif
+
+#if defined( NFX_STRINGUTILS_HAS_SSE2 )
+		for ( ; pos + 16 <= size; pos += 16 )
+		{
+			const std::uint32_t equal = static_cast<std::uint32_t>( _mm_movemask_epi8( _mm_cmpeq_epi8(
+				_mm_loadu_si128( reinterpret_cast<const __m128i*>( lhsEnd - pos - 16 ) ),
+				_mm_loadu_si128( reinterpret_cast<const __m128i*>( rhsEnd - pos - 16 ) ) ) ) );
+			if ( equal != 0xFFFFu )
+			{
+				return pos + static_cast<std::size_t>( std::countl_one( static_cast<std::uint16_t>( equal ) ) );
+			}
+		}
+#endif
+
+		for ( ; pos + 8 <= size; pos += 8 )
+		{
+			const std::uint64_t difference = loadU64( lhsEnd - pos - 8 ) ^ loadU64( rhsEnd - pos - 8 );
+			if ( difference != 0 )
+			{
+				if constexpr ( std::endian::native == std::endian::little )
+				{
+					return pos + static_cast<std::size_t>( std::countl_zero( difference ) / 8 );
+				}
+				else
+				{
+					return pos + static_cast<std::size_t>( std::countr_zero( difference ) / 8 );
+				}
+			}
+		}
+
+		while ( pos < size && lhsEnd[-1 - static_cast<std::ptrdiff_t>( pos )] == rhsEnd[-1 - static_cast<std::ptrdiff_t>( pos )] )
+		{
+			++pos;
+		}
+
+		return pos;
+	}
+
+	//=====================================================================
+	// Byte counting
+	//=====================================================================
+
+	/** @brief Vector steps summed in 8-bit lanes before they could overflow; each step adds at most 4 */
+	inline constexpr std::size_t kCountStepsPerSum{ 63 };
+
+	/**
+	 * @brief Number of occurrences of a byte
+	 * @param data Pointer to the bytes to scan
+	 * @param size Number of bytes available
+	 * @param byte Byte to count
+	 * @return Number of bytes equal to byte
+	 * @details Subtracts the compare masks of four vectors per step from 8-bit lane counters,
+	 *          which are summed with a sum of absolute differences every kCountStepsPerSum
+	 *          steps, so the loop does no horizontal work and runs at load bandwidth. The tail
+	 *          is counted 8 bytes at a time with an exact SWAR zero-byte test.
+	 */
+	inline std::size_t countByte( const char* data, std::size_t size, char byte ) noexcept
+	{
+		std::size_t pos = 0;
+		std::size_t total = 0;
+
+#if defined( NFX_STRINGUTILS_HAS_AVX2 )
+		{
+			const __m256i needle = _mm256_set1_epi8( byte );
+			while ( pos + 128 <= size )
+			{
+				const std::size_t steps = std::min( ( size - pos ) / 128, kCountStepsPerSum );
+				__m256i counts = Avx2::zero();
+				for ( std::size_t step = 0; step < steps; ++step, pos += 128 )
+				{
+					const __m256i a = _mm256_cmpeq_epi8( Avx2::load( data + pos ), needle );
+					const __m256i b = _mm256_cmpeq_epi8( Avx2::load( data + pos + 32 ), needle );
+					const __m256i c = _mm256_cmpeq_epi8( Avx2::load( data + pos + 64 ), needle );
+					const __m256i d = _mm256_cmpeq_epi8( Avx2::load( data + pos + 96 ), needle );
+					counts = _mm256_sub_epi8( counts, _mm256_add_epi8( _mm256_add_epi8( a, b ), _mm256_add_epi8( c, d ) ) );
+				}
+				const __m256i sums = _mm256_sad_epu8( counts, Avx2::zero() );
+				const __m128i halves = _mm_add_epi64( _mm256_castsi256_si128( sums ), _mm256_extracti128_si256( sums, 1 ) );
+				total += static_cast<std::uint32_t>( _mm_cvtsi128_si32( _mm_add_epi64( halves, _mm_unpackhi_epi64( halves, halves ) ) ) );
+			}
+		}
+#endif
+
+#if defined( NFX_STRINGUTILS_HAS_SSE2 )
+		{
+			const __m128i needle = _mm_set1_epi8( byte );
+			while ( pos + 64 <= size )
+			{
+				const std::size_t steps = std::min( ( size - pos ) / 64, kCountStepsPerSum );
+				__m128i counts = _mm_setzero_si128();
+				for ( std::size_t step = 0; step < steps; ++step, pos += 64 )
+				{
+					const __m128i a = _mm_cmpeq_epi8( _mm_loadu_si128( reinterpret_cast<const __m128i*>( data + pos ) ), needle );
+					const __m128i b = _mm_cmpeq_epi8( _mm_loadu_si128( reinterpret_cast<const __m128i*>( data + pos + 16 ) ), needle );
+					const __m128i c = _mm_cmpeq_epi8( _mm_loadu_si128( reinterpret_cast<const __m128i*>( data + pos + 32 ) ), needle );
+					const __m128i d = _mm_cmpeq_epi8( _mm_loadu_si128( reinterpret_cast<const __m128i*>( data + pos + 48 ) ), needle );
+					counts = _mm_sub_epi8( counts, _mm_add_epi8( _mm_add_epi8( a, b ), _mm_add_epi8( c, d ) ) );
+				}
+				const __m128i sums = _mm_sad_epu8( counts, _mm_setzero_si128() );
+				total += static_cast<std::uint32_t>( _mm_cvtsi128_si32( _mm_add_epi64( sums, _mm_unpackhi_epi64( sums, sums ) ) ) );
+			}
+		}
+#endif
+
+		const std::uint64_t pattern = static_cast<unsigned char>( byte ) * kLowBits;
+		for ( ; pos + 8 <= size; pos += 8 )
+		{
+			// High bit of every byte that differs from the pattern; no carry crosses bytes
+			const std::uint64_t difference = loadU64( data + pos ) ^ pattern;
+			const std::uint64_t nonZero = ( ( difference & ~kHighBits ) + ~kHighBits ) | difference;
+			total += static_cast<std::size_t>( std::popcount( ~nonZero & kHighBits ) );
+		}
+
+		for ( ; pos < size; ++pos )
+		{
+			total += data[pos] == byte;
+		}
+
+		return total;
+	}
+
+#if defined( NFX_STRINGUTILS_HAS_SSE2 )
+	/**
+	 * @brief Number of bytes equal to any of a few bytes
+	 * @tparam Count Number of member bytes, 1 to 8
+	 * @param data Pointer to the bytes to scan
+	 * @param size Number of bytes available
+	 * @param bytes Pointer to the Count member bytes, distinct
+	 * @return Number of bytes of data that are members
+	 * @details ORs the compares of each 16 byte vector with every member and subtracts the
+	 *          result from 8-bit lane counters, summed like countByte(); needs SSE2 only.
+	 */
+	template <std::size_t Count>
+	inline std::size_t countAnyByte( const char* data, std::size_t size, const char* bytes ) noexcept
+	{
+		__m128i needles[Count];
+		for ( std::size_t k = 0; k < Count; ++k )
+		{
+			needles[k] = _mm_set1_epi8( bytes[k] );
+		}
+		const auto members = [&needles]( const char* at ) noexcept {
+			const __m128i chunk = _mm_loadu_si128( reinterpret_cast<const __m128i*>( at ) );
+			__m128i matches = _mm_cmpeq_epi8( chunk, needles[0] );
+			for ( std::size_t k = 1; k < Count; ++k )
+			{
+				matches = _mm_or_si128( matches, _mm_cmpeq_epi8( chunk, needles[k] ) );
+			}
+			return matches;
+		};
+
+		std::size_t pos = 0;
+		std::size_t total = 0;
+		while ( pos + 64 <= size )
+		{
+			const std::size_t steps = std::min( ( size - pos ) / 64, kCountStepsPerSum );
+			__m128i counts = _mm_setzero_si128();
+			for ( std::size_t step = 0; step < steps; ++step, pos += 64 )
+			{
+				const __m128i a = members( data + pos );
+				const __m128i b = members( data + pos + 16 );
+				const __m128i c = members( data + pos + 32 );
+				const __m128i d = members( data + pos + 48 );
+				counts = _mm_sub_epi8( counts, _mm_add_epi8( _mm_add_epi8( a, b ), _mm_add_epi8( c, d ) ) );
+			}
+			const __m128i sums = _mm_sad_epu8( counts, _mm_setzero_si128() );
+			total += static_cast<std::uint32_t>( _mm_cvtsi128_si32( _mm_add_epi64( sums, _mm_unpackhi_epi64( sums, sums ) ) ) );
+		}
+
+		for ( ; pos + 16 <= size; pos += 16 )
+		{
+			total += static_cast<std::size_t>( std::popcount( static_cast<std::uint32_t>( _mm_movemask_epi8( members( data + pos ) ) ) ) );
+		}
+
+		for ( ; pos < size; ++pos )
+		{
+			for ( std::size_t k = 0; k < Count; ++k )
+			{
+				total += data[pos] == bytes[k];
+			}
+		}
+
+		return total;
+	}
+
+	/**
+	 * @brief Number of occurrences of a 2 to 4 byte pattern
+	 * @tparam Length Pattern length
+	 * @param data Pointer to the bytes to scan
+	 * @param size Number of bytes available, at least Length
+	 * @param pattern Pointer to the Length pattern bytes
+	 * @param overlapping Count every occurrence, or only those a left-to-right scan finds when
+	 *        it resumes after each hit
+	 * @return Number of occurrences
+	 * @details ANDs the compares of the block shifted by each pattern offset with that pattern
+	 *          byte, so one mask marks every occurrence starting in a 32 or 16 byte block. The
+	 *          marks are counted with a popcount unless non-overlapping occurrences of a pattern
+	 *          that can overlap itself ("aa", "aba") are wanted; those are walked in order.
+	 */
+	template <std::size_t Length>
+	inline std::size_t countShortPattern( const char* data, std::size_t size, const char* pattern, bool overlapping ) noexcept
+	{
+		// A pattern overlaps itself when a proper prefix is also a suffix
+		bool selfOverlapping = false;
+		for ( std::size_t border = 1; border < Length; ++border )
+		{
+			selfOverlapping = selfOverlapping || std::memcmp( pattern, pattern + Length - border, border ) == 0;
+		}
+		const bool countAllMarks = overlapping || !selfOverlapping;
+
+		std::size_t total = 0;
+		std::size_t pos = 0;
+		std::size_t nextStart = 0;
+		const auto take = [&]( std::uint32_t marks ) noexcept {
+			if ( countAllMarks )
+			{
+				total += static_cast<std::size_t>( std::popcount( marks ) );
+				return;
+			}
+			for ( ; marks != 0; marks &= marks - 1 )
+			{
+				const std::size_t start = pos + static_cast<std::size_t>( std::countr_zero( marks ) );
+				if ( start >= nextStart )
+				{
+					++total;
+					nextStart = start + Length;
+				}
+			}
+		};
+
+#	if defined( NFX_STRINGUTILS_HAS_AVX2 )
+		{
+			__m256i needles[Length];
+			for ( std::size_t k = 0; k < Length; ++k )
+			{
+				needles[k] = _mm256_set1_epi8( pattern[k] );
+			}
+			for ( ; pos + 32 + Length - 1 <= size; pos += 32 )
+			{
+				__m256i matches = _mm256_cmpeq_epi8( Avx2::load( data + pos ), needles[0] );
+				for ( std::size_t k = 1; k < Length; ++k )
+				{
+					matches = _mm256_and_si256( matches, _mm256_cmpeq_epi8( Avx2::load( data + pos + k ), needles[k] ) );
+				}
+				take( Avx2::highBitMask( matches ) );
+			}
+		}
+#	endif
+
+		{
+			__m128i needles[Length];
+			for ( std::size_t k = 0; k < Length; ++k )
+			{
+				needles[k] = _mm_set1_epi8( pattern[k] );
+			}
+			for ( ; pos + 16 + Length - 1 <= size; pos += 16 )
+			{
+				__m128i matches = _mm_cmpeq_epi8( _mm_loadu_si128( reinterpret_cast<const __m128i*>( data + pos ) ), needles[0] );
+				for ( std::size_t k = 1; k < Length; ++k )
+				{
+					matches = _mm_and_si128( matches,
+						_mm_cmpeq_epi8( _mm_loadu_si128( reinterpret_cast<const __m128i*>( data + pos + k ) ), needles[k] ) );
+				}
+				take( static_cast<std::uint32_t>( _mm_movemask_epi8( matches ) ) );
+			}
+		}
+
+		for ( ; pos + Length <= size; ++pos )
+		{
+			if ( std::memcmp( data + pos, pattern, Length ) == 0 )
+			{
+				take( 1u );
+			}
+		}
+
+		return total;
+	}
+
+	/**
+	 * @brief Counts occurrences of a multi-byte pattern until verifying candidates stops paying off
+	 * @param data Pointer to the bytes to scan
+	 * @param size Number of bytes available
+	 * @param pattern Pointer to the pattern bytes
+	 * @param length Pattern length, at least 2
+	 * @param overlapping Count every occurrence, or resume past each hit
+	 * @param resume [in,out] First start position to scan; on return, the first one not scanned
+	 * @param resumeStart [in,out] First start position a hit may have
+	 * @return Number of occurrences starting before resume
+	 * @details Marks the positions of a 32 or 16 byte block where both the first and the last
+	 *          pattern byte match, and compares the bytes in between only there. Returns early
+	 *          once the comparisons have read twice as many bytes as were scanned, as they do on
+	 *          periodic input such as "AAAA" searched for "AATA"; the caller finishes in linear time.
+	 */
+	inline std::size_t countPatternCandidates( const char* data, std::size_t size, const char* pattern, std::size_t length,
+		bool overlapping, std::size_t& resume, std::size_t& resumeStart ) noexcept
+	{
+		const std::size_t lastOffset = length - 1;
+		std::size_t pos = resume;
+		std::size_t nextStart = resumeStart;
+		std::size_t total = 0;
+		std::size_t verified = 0;
+		const auto stop = [&]() noexcept {
+			resume = pos;
+			resumeStart = nextStart;
+			return total;
+		};
+
+		// Verifies the marked candidates; false once the comparisons read twice the bytes scanned
+		const auto take = [&]( std::uint32_t marks ) noexcept {
+			if ( verified > 2 * pos + 4096 )
+			{
+				return false;
+			}
+			for ( ; marks != 0; marks &= marks - 1 )
+			{
+				const std::size_t start = pos + static_cast<std::size_t>( std::countr_zero( marks ) );
+				if ( start < nextStart )
+				{
+					continue;
+				}
+				verified += length;
+				if ( std::memcmp( data + start + 1, pattern + 1, length - 2 ) == 0 )
+				{
+					++total;
+					nextStart = start + ( overlapping ? 1 : length );
+				}
+			}
+			return true;
+		};
+
+#	if defined( NFX_STRINGUTILS_HAS_AVX2 )
+		{
+			const __m256i first = _mm256_set1_epi8( pattern[0] );
+			const __m256i last = _mm256_set1_epi8( pattern[lastOffset] );
+			for ( ; pos + 32 + lastOffset <= size; pos += 32 )
+			{
+				const __m256i matches = _mm256_and_si256( _mm256_cmpeq_epi8( Avx2::load( data + pos ), first ),
+					_mm256_cmpeq_epi8( Avx2::load( data + pos + lastOffset ), last ) );
+				const std::uint32_t marks = Avx2::highBitMask( matches );
+				if ( marks != 0 && !take( marks ) )
+				{
+					return stop();
+				}
+			}
+		}
+#	endif
+
+		{
+			const __m128i first = _mm_set1_epi8( pattern[0] );
+			const __m128i last = _mm_set1_epi8( pattern[lastOffset] );
+			for ( ; pos + 16 + lastOffset <= size; pos += 16 )
+			{
+				const __m128i matches = _mm_and_si128( _mm_cmpeq_epi8( _mm_loadu_si128( reinterpret_cast<const __m128i*>( data + pos ) ), first ),
+					_mm_cmpeq_epi8( _mm_loadu_si128( reinterpret_cast<const __m128i*>( data + pos + lastOffset ) ), last ) );
+				const auto marks = static_cast<std::uint32_t>( _mm_movemask_epi8( matches ) );
+				if ( marks != 0 && !take( marks ) )
+				{
+					return stop();
+				}
+			}
+		}
+
+		for ( ; pos + length <= size; ++pos )
+		{
+			if ( data[pos] == pattern[0] && data[pos + lastOffset] == pattern[lastOffset] && !take( 1u ) )
+			{
+				return stop();
+			}
+		}
+
+		return stop();
+	}
+#endif
+
+#if defined( NFX_STRINGUTILS_HAS_SSSE3 )
+	/**
+	 * @brief Counts whole vectors of bytes that belong to a nibble-table byte class
+	 * @tparam V Vector wrapper (Sse or Avx2)
+	 * @param data Pointer to the bytes to scan
+	 * @param size Number of bytes available
+	 * @param pos Start offset, advanced past the last whole vector
+	 * @param lowTable Bucket bits of each low nibble
+	 * @param highTable Bucket bits of each high nibble
+	 * @return Number of member bytes in the vectors scanned
+	 */
+	template <typename V>
+	inline std::size_t countClassVectors( const char* data, std::size_t size, std::size_t& pos,
+		const std::uint8_t ( &lowTable )[16], const std::uint8_t ( &highTable )[16] ) noexcept
+	{
+		const auto low = V::table( lowTable );
+		const auto high = V::table( highTable );
+		std::size_t total = 0;
+		for ( ; pos + V::width <= size; pos += V::width )
+		{
+			const auto input = V::load( data + pos );
+			const auto buckets = V::and_( V::lookup( low, V::lowNibbles( input ) ), V::lookup( high, V::highNibbles( input ) ) );
+			total += V::width - static_cast<std::size_t>( std::popcount( V::highBitMask( V::equal( buckets, V::zero() ) ) ) );
+		}
+		return total;
+	}
+
+	/**
+	 * @brief Number of bytes that belong to a nibble-table byte class
+	 * @param data Pointer to the bytes to scan
+	 * @param size Number of bytes available
+	 * @param lowTable Bucket bits of each low nibble
+	 * @param highTable Bucket bits of each high nibble
+	 * @return Number of bytes b with lowTable[b & 15] & highTable[b >> 4] non-zero
+	 * @details Classifies 32 or 16 bytes per step with two byte shuffles, as in Utf8.inl.
+	 */
+	inline std::size_t countClass( const char* data, std::size_t size,
+		const std::uint8_t ( &lowTable )[16], const std::uint8_t ( &highTable )[16] ) noexcept
+	{
+		std::size_t pos = 0;
+		std::size_t total = 0;
+
+#	if defined( NFX_STRINGUTILS_HAS_AVX2 )
+		total += countClassVectors<Avx2>( data, size, pos, lowTable, highTable );
+#	endif
+		total += countClassVectors<Sse>( data, size, pos, lowTable, highTable );
+
+		for ( ; pos < size; ++pos )
+		{
+			const auto value = static_cast<unsigned char>( data[pos] );
+			total += ( lowTable[value & 0x0F] & highTable[value >> 4] ) != 0;
+		}
+
+		return total;
+	}
+#endif
+} // namespace nfx::string::detail::simd
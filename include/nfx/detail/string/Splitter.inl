@@ -28,6 +28,8 @@
  * @details Inline implementations for high-performance string_view-based splitting
  */
 
+#include "nfx/string/Instrumentation.h"
+
 namespace nfx::string
 {
 	//=====================================================================
@@ -51,6 +53,8 @@ namespace nfx::string
 
 	inline Splitter::Iterator Splitter::begin() const noexcept
 	{
+		NFX_STRINGUTILS_PROBE( Splitter, m_str.size() );
+
 		return Iterator{ *this };
 	}
 
@@ -95,6 +99,9 @@ namespace nfx::string
 
 	inline Splitter::Iterator& Splitter::Iterator::operator++() noexcept
 	{
+		// Time only; the call and its bytes were counted by begin()
+		NFX_STRINGUTILS_PROBE( Splitter, 0, 0 );
+
 		m_start = m_end + 1;
 
 		const size_t str_len = m_splitter->m_str.length();
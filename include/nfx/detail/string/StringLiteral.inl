@@ -0,0 +1,400 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file StringLiteral.inl
+ * @brief Implementation of compile-time string literals and literal pattern searches
+ * @details Vector searches compare two pattern bytes, chosen at compile time as the rarest
+ *          pair, at every position of a block and compare the whole pattern only at positions
+ *          where both match; every match in a block is reported before the next block is
+ *          loaded. The scalar path and the tail of the vector search use Horspool's algorithm
+ *          with a skip table built at compile time.
+ */
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#include "nfx/detail/string/Simd.h"
+
+namespace nfx::string
+{
+	namespace detail
+	{
+		//=====================================================================
+		// Literal search internals
+		//=====================================================================
+
+		/**
+		 * @brief Rough rarity of a byte in text and log data, higher is rarer
+		 * @details Used at compile time to choose which two pattern bytes the vector search
+		 *          compares, so that fewer positions need a full comparison.
+		 */
+		inline constexpr int byteRarity( unsigned char c ) noexcept
+		{
+			constexpr std::string_view common = " etaoinsrhldcum";
+			if ( const std::size_t rank = common.find( static_cast<char>( c ) ); rank != std::string_view::npos )
+			{
+				return static_cast<int>( rank / 4 );
+			}
+			if ( ( c >= 'a' && c <= 'z' ) || ( c >= '0' && c <= '9' ) )
+			{
+				return 4;
+			}
+			if ( c == '.' || c == ',' || c == '/' || c == ':' || c == '=' || c == '-' || c == '_' || c == '\n' )
+			{
+				return 5;
+			}
+			if ( c >= 'A' && c <= 'Z' )
+			{
+				return 6;
+			}
+			if ( c >= 0x20 && c < 0x7F )
+			{
+				return 7;
+			}
+			return c >= 0x80 ? 7 : 8;
+		}
+
+		/** @brief Search for one literal, with every pattern-dependent value precomputed */
+		template <StringLiteral Needle>
+		struct LiteralSearcher
+		{
+			static constexpr std::size_t size = Needle.size();
+
+			using Shift = std::conditional_t<( size <= std::numeric_limits<std::uint8_t>::max() ), std::uint8_t, std::size_t>;
+
+			/** @brief Horspool skip distance for each value of the byte aligned with the pattern's end */
+			static constexpr std::array<Shift, 256> shifts = [] {
+				std::array<Shift, 256> table{};
+				table.fill( static_cast<Shift>( size ) );
+				for ( std::size_t i = 0; i + 1 < size; ++i )
+				{
+					table[static_cast<unsigned char>( Needle.value[i] )] = static_cast<Shift>( size - 1 - i );
+				}
+				return table;
+			}();
+
+			/** @brief Positions of the two rarest distinct pattern bytes, compared by the vector search */
+			static constexpr std::array<std::size_t, 2> probes = [] {
+				std::array<std::size_t, 2> best{ 0, size > 1 ? size - 1 : 0 };
+				int bestScore = -1;
+				for ( std::size_t i = 0; i + 1 < size; ++i )
+				{
+					for ( std::size_t j = i + 1; j < size; ++j )
+					{
+						const unsigned char a = static_cast<unsigned char>( Needle.value[i] );
+						const unsigned char b = static_cast<unsigned char>( Needle.value[j] );
+						const int score = byteRarity( a ) + byteRarity( b ) + ( a != b ? 8 : 0 );
+						if ( score > bestScore )
+						{
+							bestScore = score;
+							best = { i, j };
+						}
+					}
+				}
+				return best;
+			}();
+
+			static std::size_t scalarFind( const char* data, std::size_t length, std::size_t pos ) noexcept
+			{
+				constexpr unsigned char lastByte = static_cast<unsigned char>( Needle.value[size - 1] );
+
+				while ( pos + size <= length )
+				{
+					const unsigned char aligned = static_cast<unsigned char>( data[pos + size - 1] );
+					if ( aligned == lastByte && std::memcmp( data + pos, Needle.value, size - 1 ) == 0 )
+					{
+						return pos;
+					}
+					pos += shifts[aligned];
+				}
+				return std::string_view::npos;
+			}
+
+			/**
+			 * @brief Report every non-overlapping occurrence at or after pos, in order
+			 * @param str String to search in
+			 * @param pos Position to start at
+			 * @param onMatch Called with each match offset; returns true to stop the search
+			 * @details noexcept when onMatch is, so that exceptions of a callback that builds a
+			 *          result (std::bad_alloc) reach the caller instead of std::terminate().
+			 */
+			template <typename Callback>
+			static void forEachMatch( std::string_view str, std::size_t pos, Callback&& onMatch ) noexcept(
+				std::is_nothrow_invocable_v<Callback&, std::size_t> )
+			{
+				static_assert( size > 0 );
+
+				if constexpr ( size == 1 )
+				{
+					while ( ( pos = str.find( Needle.value[0], pos ) ) != std::string_view::npos )
+					{
+						if ( onMatch( pos ) )
+						{
+							return;
+						}
+						++pos;
+					}
+				}
+				else
+				{
+					const char* const data = str.data();
+					const std::size_t length = str.size();
+
+					// Earliest start that does not overlap the last reported match
+					std::size_t next = pos;
+
+					constexpr bool nothrowCallback = std::is_nothrow_invocable_v<Callback&, std::size_t>;
+					[[maybe_unused]] const auto report = [&]( std::size_t blockPos, auto candidates ) noexcept( nothrowCallback ) {
+						while ( candidates != 0 )
+						{
+							const std::size_t offset = blockPos + static_cast<std::size_t>( std::countr_zero( candidates ) );
+							if ( offset >= next && ( size == 2 || std::memcmp( data + offset, Needle.value, size ) == 0 ) )
+							{
+								if ( onMatch( offset ) )
+								{
+									return true;
+								}
+								next = offset + size;
+							}
+							candidates &= candidates - 1;
+						}
+						return false;
+					};
+
+#if defined( NFX_STRINGUTILS_HAS_AVX2 )
+					if ( length >= size - 1 + 64 )
+					{
+						constexpr std::size_t i = probes[0];
+						constexpr std::size_t j = probes[1];
+						const __m256i first = _mm256_set1_epi8( Needle.value[i] );
+						const __m256i second = _mm256_set1_epi8( Needle.value[j] );
+						const auto block = [&]( const char* at ) noexcept {
+							const __m256i a = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( at + i ) );
+							const __m256i b = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( at + j ) );
+							return static_cast<std::uint32_t>( _mm256_movemask_epi8(
+								_mm256_and_si256( _mm256_cmpeq_epi8( a, first ), _mm256_cmpeq_epi8( b, second ) ) ) );
+						};
+
+						// Last start position at which every load of a block stays in bounds
+						const std::size_t lastBlock = length - ( size - 1 ) - 64;
+						for ( ; pos <= lastBlock; pos += 64 )
+						{
+							const std::uint64_t candidates = block( data + pos ) | ( static_cast<std::uint64_t>( block( data + pos + 32 ) ) << 32 );
+							if ( candidates != 0 && report( pos, candidates ) )
+							{
+								return;
+							}
+						}
+					}
+#endif
+
+#if defined( NFX_STRINGUTILS_HAS_SSE2 )
+					if ( length >= size - 1 + 16 )
+					{
+						constexpr std::size_t i = probes[0];
+						constexpr std::size_t j = probes[1];
+						const __m128i first = _mm_set1_epi8( Needle.value[i] );
+						const __m128i second = _mm_set1_epi8( Needle.value[j] );
+
+						// Last start position at which both loads of a block stay in bounds
+						const std::size_t lastBlock = length - ( size - 1 ) - 16;
+						for ( ; pos <= lastBlock; pos += 16 )
+						{
+							const __m128i a = _mm_loadu_si128( reinterpret_cast<const __m128i*>( data + pos + i ) );
+							const __m128i b = _mm_loadu_si128( reinterpret_cast<const __m128i*>( data + pos + j ) );
+							const std::uint32_t candidates = static_cast<std::uint32_t>(
+								_mm_movemask_epi8( _mm_and_si128( _mm_cmpeq_epi8( a, first ), _mm_cmpeq_epi8( b, second ) ) ) );
+							if ( candidates != 0 && report( pos, candidates ) )
+							{
+								return;
+							}
+						}
+					}
+#endif
+
+					pos = std::max( pos, next );
+					while ( ( pos = scalarFind( data, length, pos ) ) != std::string_view::npos )
+					{
+						if ( onMatch( pos ) )
+						{
+							return;
+						}
+						pos += size;
+					}
+				}
+			}
+
+			/** @brief First occurrence at or after pos, or npos */
+			static std::size_t find( std::string_view str, std::size_t pos ) noexcept
+			{
+				if constexpr ( size == 0 )
+				{
+					return pos <= str.size() ? pos : std::string_view::npos;
+				}
+				else
+				{
+					std::size_t found = std::string_view::npos;
+					forEachMatch( str, pos, [&found]( std::size_t offset ) noexcept {
+						found = offset;
+						return true;
+					} );
+					return found;
+				}
+			}
+		};
+	} // namespace detail
+
+	//=====================================================================
+	// StringLiteral class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	template <std::size_t N>
+	inline constexpr StringLiteral<N>::StringLiteral( const char ( &str )[N] ) noexcept
+	{
+		for ( std::size_t i = 0; i < N; ++i )
+		{
+			value[i] = str[i];
+		}
+	}
+
+	//----------------------------------------------
+	// Access
+	//----------------------------------------------
+
+	template <std::size_t N>
+	inline constexpr std::size_t StringLiteral<N>::size() noexcept
+	{
+		return N - 1;
+	}
+
+	template <std::size_t N>
+	inline constexpr std::string_view StringLiteral<N>::view() const noexcept
+	{
+		return std::string_view{ value, N - 1 };
+	}
+
+	//=====================================================================
+	// Literal pattern operations
+	//=====================================================================
+
+	template <StringLiteral Needle>
+	inline constexpr bool containsLit( std::string_view str ) noexcept
+	{
+		return indexOfLit<Needle>( str ) != std::string_view::npos;
+	}
+
+	template <StringLiteral Prefix>
+	inline constexpr bool startsWithLit( std::string_view str ) noexcept
+	{
+		if ( std::is_constant_evaluated() )
+		{
+			return str.starts_with( Prefix.view() );
+		}
+		return str.size() >= Prefix.size() && std::memcmp( str.data(), Prefix.value, Prefix.size() ) == 0;
+	}
+
+	template <StringLiteral Suffix>
+	inline constexpr bool endsWithLit( std::string_view str ) noexcept
+	{
+		if ( std::is_constant_evaluated() )
+		{
+			return str.ends_with( Suffix.view() );
+		}
+		return str.size() >= Suffix.size() &&
+			   std::memcmp( str.data() + str.size() - Suffix.size(), Suffix.value, Suffix.size() ) == 0;
+	}
+
+	template <StringLiteral Needle>
+	inline constexpr std::size_t indexOfLit( std::string_view str ) noexcept
+	{
+		if ( std::is_constant_evaluated() )
+		{
+			return str.find( Needle.view() );
+		}
+		return detail::LiteralSearcher<Needle>::find( str, 0 );
+	}
+
+	template <StringLiteral Needle>
+	inline constexpr std::size_t countLit( std::string_view str ) noexcept
+	{
+		if constexpr ( Needle.size() == 0 )
+		{
+			return 0;
+		}
+		else
+		{
+			if ( std::is_constant_evaluated() )
+			{
+				std::size_t occurrences = 0;
+				for ( std::size_t pos = str.find( Needle.view() ); pos != std::string_view::npos;
+					  pos = str.find( Needle.view(), pos + Needle.size() ) )
+				{
+					++occurrences;
+				}
+				return occurrences;
+			}
+
+			std::size_t occurrences = 0;
+			detail::LiteralSearcher<Needle>::forEachMatch( str, 0, [&occurrences]( std::size_t ) noexcept {
+				++occurrences;
+				return false;
+			} );
+			return occurrences;
+		}
+	}
+
+	template <StringLiteral OldStr, StringLiteral NewStr>
+	inline std::string replaceAllLit( std::string_view str )
+	{
+		if constexpr ( OldStr.size() == 0 )
+		{
+			return std::string{ str };
+		}
+		else
+		{
+			std::string result;
+			result.reserve( str.size() );
+
+			std::size_t lastPos = 0;
+			detail::LiteralSearcher<OldStr>::forEachMatch( str, 0, [&]( std::size_t pos ) {
+				result.append( str.data() + lastPos, pos - lastPos );
+				result.append( NewStr.value, NewStr.size() );
+				lastPos = pos + OldStr.size();
+				return false;
+			} );
+			result.append( str.data() + lastPos, str.size() - lastPos );
+
+			return result;
+		}
+	}
+} // namespace nfx::string
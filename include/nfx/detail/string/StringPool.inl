@@ -0,0 +1,379 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file StringPool.inl
+ * @brief Implementation of the thread-safe string interning pool
+ * @details Readers load a shard's table pointer and its slots with acquire ordering, so an
+ *          entry is always fully written before it becomes visible. A reader that misses on a
+ *          table being replaced falls back to the locked path, which searches the current table
+ *          before inserting.
+ */
+
+#include <atomic>
+#include <bit>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <vector>
+
+#include "nfx/detail/string/Simd.h"
+
+namespace nfx::string
+{
+	namespace detail
+	{
+		//=====================================================================
+		// String pool internals
+		//=====================================================================
+
+		/** @brief Number of independently locked shards; the top hash bits select one */
+		inline constexpr std::size_t kStringPoolShardCount{ 16 };
+		inline constexpr unsigned kStringPoolShardShift{ 60 };
+
+		/** @brief Slots of a shard's first table; tables double when half full */
+		inline constexpr std::size_t kStringPoolInitialCapacity{ 64 };
+
+		/** @brief Arena block size; longer strings get a block of their own */
+		inline constexpr std::size_t kStringPoolBlockSize{ 64 * 1024 };
+
+		//----------------------------------------------
+		// Entries
+		//----------------------------------------------
+
+		/** @brief Header of an interned string; the bytes and a null terminator follow it */
+		struct StringPoolEntry
+		{
+			std::uint64_t hash;
+			std::size_t size;
+
+			const char* data() const noexcept
+			{
+				return reinterpret_cast<const char*>( this + 1 );
+			}
+		};
+
+		/** @brief 64-bit hash of a byte string; two independent multiply lanes per 16 bytes */
+		inline std::uint64_t hashBytes( const char* data, std::size_t size ) noexcept
+		{
+			constexpr std::uint64_t k0 = 0x9E3779B97F4A7C15ull;
+			constexpr std::uint64_t k1 = 0xBF58476D1CE4E5B9ull;
+
+			std::uint64_t a = static_cast<std::uint64_t>( size ) * k0;
+			std::uint64_t b = k1;
+			std::size_t pos = 0;
+			for ( ; pos + 16 <= size; pos += 16 )
+			{
+				a = std::rotl( a ^ simd::loadU64( data + pos ), 29 ) * k0;
+				b = std::rotl( b ^ simd::loadU64( data + pos + 8 ), 31 ) * k1;
+			}
+			if ( pos + 8 <= size )
+			{
+				a = std::rotl( a ^ simd::loadU64( data + pos ), 29 ) * k0;
+				pos += 8;
+			}
+			if ( pos < size )
+			{
+				std::uint64_t tail = 0;
+				std::memcpy( &tail, data + pos, size - pos );
+				b = std::rotl( b ^ tail, 31 ) * k1;
+			}
+
+			std::uint64_t hash = a ^ std::rotl( b, 32 );
+			hash ^= hash >> 32;
+			hash *= k1;
+			hash ^= hash >> 29;
+			return hash;
+		}
+
+		//----------------------------------------------
+		// Arena
+		//----------------------------------------------
+
+		/** @brief Append-only storage of entries; not synchronized */
+		class StringPoolArena
+		{
+		public:
+			const StringPoolEntry* store( std::string_view str, std::uint64_t hash )
+			{
+				constexpr std::size_t alignment = alignof( StringPoolEntry );
+				const std::size_t bytes = ( sizeof( StringPoolEntry ) + str.size() + 1 + alignment - 1 ) & ~( alignment - 1 );
+
+				char* memory;
+				if ( bytes > kStringPoolBlockSize / 4 )
+				{
+					m_blocks.emplace_back( new char[bytes] );
+					memory = m_blocks.back().get();
+				}
+				else
+				{
+					if ( static_cast<std::size_t>( m_end - m_next ) < bytes )
+					{
+						m_blocks.emplace_back( new char[kStringPoolBlockSize] );
+						m_next = m_blocks.back().get();
+						m_end = m_next + kStringPoolBlockSize;
+					}
+					memory = m_next;
+					m_next += bytes;
+				}
+
+				const StringPoolEntry* entry = new ( memory ) StringPoolEntry{ hash, str.size() };
+				char* const data = memory + sizeof( StringPoolEntry );
+				std::memcpy( data, str.data(), str.size() );
+				data[str.size()] = '\0';
+				return entry;
+			}
+
+		private:
+			std::vector<std::unique_ptr<char[]>> m_blocks;
+			char* m_next{ nullptr };
+			char* m_end{ nullptr };
+		};
+
+		//----------------------------------------------
+		// Hash table
+		//----------------------------------------------
+
+		/** @brief Open-addressing table of entry pointers with linear probing */
+		struct StringPoolTable
+		{
+			explicit StringPoolTable( std::size_t capacity )
+				: mask{ capacity - 1 },
+				  slots{ new std::atomic<const StringPoolEntry*>[capacity]() }
+			{
+			}
+
+			std::size_t mask;
+			std::unique_ptr<std::atomic<const StringPoolEntry*>[]> slots;
+		};
+
+		inline const StringPoolEntry* findEntry( const StringPoolTable& table, std::string_view str, std::uint64_t hash ) noexcept
+		{
+			for ( std::size_t i = static_cast<std::size_t>( hash ) & table.mask;; i = ( i + 1 ) & table.mask )
+			{
+				const StringPoolEntry* entry = table.slots[i].load( std::memory_order_acquire );
+				if ( entry == nullptr )
+				{
+					return nullptr;
+				}
+				if ( entry->hash == hash && entry->size == str.size() && std::memcmp( entry->data(), str.data(), str.size() ) == 0 )
+				{
+					return entry;
+				}
+			}
+		}
+
+		/** @brief Store an entry in the first free slot of its probe sequence */
+		inline void insertEntry( StringPoolTable& table, const StringPoolEntry* entry, std::memory_order order ) noexcept
+		{
+			std::size_t i = static_cast<std::size_t>( entry->hash ) & table.mask;
+			while ( table.slots[i].load( std::memory_order_relaxed ) != nullptr )
+			{
+				i = ( i + 1 ) & table.mask;
+			}
+			table.slots[i].store( entry, order );
+		}
+	} // namespace detail
+
+	//=====================================================================
+	// InternedString class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	inline InternedString::InternedString( const detail::StringPoolEntry* entry ) noexcept
+		: m_entry{ entry }
+	{
+	}
+
+	//----------------------------------------------
+	// Access
+	//----------------------------------------------
+
+	inline std::string_view InternedString::view() const noexcept
+	{
+		return m_entry != nullptr ? std::string_view{ m_entry->data(), m_entry->size } : std::string_view{};
+	}
+
+	inline const char* InternedString::c_str() const noexcept
+	{
+		return m_entry != nullptr ? m_entry->data() : "";
+	}
+
+	inline std::size_t InternedString::size() const noexcept
+	{
+		return m_entry != nullptr ? m_entry->size : 0;
+	}
+
+	inline bool InternedString::empty() const noexcept
+	{
+		return m_entry == nullptr;
+	}
+
+	inline std::size_t InternedString::hash() const noexcept
+	{
+		return m_entry != nullptr ? static_cast<std::size_t>( m_entry->hash ) : 0;
+	}
+
+	inline InternedString::operator std::string_view() const noexcept
+	{
+		return view();
+	}
+
+	//----------------------------------------------
+	// Comparison
+	//----------------------------------------------
+
+	inline bool InternedString::operator==( const InternedString& other ) const noexcept
+	{
+		return m_entry == other.m_entry;
+	}
+
+	//=====================================================================
+	// StringPool class
+	//=====================================================================
+
+	/** @brief One lock, table chain and arena; aligned so shards do not share cache lines */
+	struct alignas( 64 ) StringPool::Shard
+	{
+		std::atomic<const detail::StringPoolTable*> table{ nullptr };
+		std::atomic<std::size_t> count{ 0 };
+		std::mutex mutex;
+
+		/** @brief Every table this shard has published; replaced tables stay readable */
+		std::vector<std::unique_ptr<detail::StringPoolTable>> tables;
+		detail::StringPoolArena arena;
+	};
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	inline StringPool::StringPool()
+		: m_shards{ std::make_unique<Shard[]>( detail::kStringPoolShardCount ) }
+	{
+	}
+
+	inline StringPool::~StringPool() = default;
+
+	//----------------------------------------------
+	// Interning
+	//----------------------------------------------
+
+	inline InternedString StringPool::intern( std::string_view str )
+	{
+		if ( str.empty() )
+		{
+			return InternedString{};
+		}
+
+		const std::uint64_t hash = detail::hashBytes( str.data(), str.size() );
+		Shard& shard = m_shards[static_cast<std::size_t>( hash >> detail::kStringPoolShardShift )];
+
+		// Fast path: lock-free lookup
+		const detail::StringPoolTable* table = shard.table.load( std::memory_order_acquire );
+		if ( table != nullptr )
+		{
+			if ( const detail::StringPoolEntry* entry = detail::findEntry( *table, str, hash ) )
+			{
+				return InternedString{ entry };
+			}
+		}
+
+		std::lock_guard<std::mutex> lock{ shard.mutex };
+
+		// Another thread may have inserted str or grown the table since the lookup
+		table = shard.table.load( std::memory_order_relaxed );
+		if ( table != nullptr )
+		{
+			if ( const detail::StringPoolEntry* entry = detail::findEntry( *table, str, hash ) )
+			{
+				return InternedString{ entry };
+			}
+		}
+
+		const std::size_t count = shard.count.load( std::memory_order_relaxed );
+		detail::StringPoolTable* writable = shard.tables.empty() ? nullptr : shard.tables.back().get();
+		if ( writable == nullptr || ( count + 1 ) * 2 > writable->mask + 1 )
+		{
+			auto grown = std::make_unique<detail::StringPoolTable>(
+				writable == nullptr ? detail::kStringPoolInitialCapacity : ( writable->mask + 1 ) * 2 );
+			if ( writable != nullptr )
+			{
+				for ( std::size_t i = 0; i <= writable->mask; ++i )
+				{
+					if ( const detail::StringPoolEntry* entry = writable->slots[i].load( std::memory_order_relaxed ) )
+					{
+						detail::insertEntry( *grown, entry, std::memory_order_relaxed );
+					}
+				}
+			}
+			writable = grown.get();
+			shard.tables.push_back( std::move( grown ) );
+			shard.table.store( writable, std::memory_order_release );
+		}
+
+		const detail::StringPoolEntry* entry = shard.arena.store( str, hash );
+		detail::insertEntry( *writable, entry, std::memory_order_release );
+		shard.count.store( count + 1, std::memory_order_relaxed );
+		return InternedString{ entry };
+	}
+
+	inline bool StringPool::tryFind( std::string_view str, InternedString& result ) const noexcept
+	{
+		if ( str.empty() )
+		{
+			result = InternedString{};
+			return true;
+		}
+
+		const std::uint64_t hash = detail::hashBytes( str.data(), str.size() );
+		const Shard& shard = m_shards[static_cast<std::size_t>( hash >> detail::kStringPoolShardShift )];
+		const detail::StringPoolTable* table = shard.table.load( std::memory_order_acquire );
+		const detail::StringPoolEntry* entry = table != nullptr ? detail::findEntry( *table, str, hash ) : nullptr;
+		if ( entry == nullptr )
+		{
+			return false;
+		}
+
+		result = InternedString{ entry };
+		return true;
+	}
+
+	//----------------------------------------------
+	// Statistics
+	//----------------------------------------------
+
+	inline std::size_t StringPool::size() const noexcept
+	{
+		std::size_t total = 0;
+		for ( std::size_t i = 0; i < detail::kStringPoolShardCount; ++i )
+		{
+			total += m_shards[i].count.load( std::memory_order_relaxed );
+		}
+		return total;
+	}
+} // namespace nfx::string
@@ -0,0 +1,1065 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Unicode.inl
+ * @brief Implementation of Unicode case mapping, comparison, normalization and display width
+ * @details Codepoint properties come from the generated two-stage tables in CaseTables.h,
+ *          NormalizationTables.h and WidthTables.h. ASCII letters are mapped with a single signed compare per 16 bytes: adding
+ *          0x80 - 'A' moves 'A'-'Z' to the bottom of the signed byte range, and no other byte
+ *          value lands there, so non-ASCII bytes pass through untouched.
+ *
+ *          Normalization splits the text at stable starters: codepoints with combining class 0
+ *          that pass the quick check, so nothing before them can combine with anything after.
+ *          Runs that pass the quick check are copied verbatim and only the segments around the
+ *          remaining codepoints are decomposed, canonically ordered and recomposed.
+ *
+ *          Display width walks extended grapheme clusters with the UAX #29 pair rules. Inside a
+ *          run of ASCII every byte is its own cluster (CR LF aside, and both are zero width), so
+ *          all but the last byte of a run are counted in bulk.
+ */
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+
+#include "nfx/detail/string/CaseTables.h"
+#include "nfx/detail/string/NormalizationTables.h"
+#include "nfx/detail/string/Simd.h"
+#include "nfx/detail/string/WidthTables.h"
+
+namespace nfx::string
+{
+	namespace detail
+	{
+		//=====================================================================
+		// Unicode internals
+		//=====================================================================
+
+		//----------------------------------------------
+		// Case mapping
+		//----------------------------------------------
+
+		enum class CaseMapping
+		{
+			Fold,
+			Lower,
+			Upper
+		};
+
+		template <CaseMapping Mapping>
+		inline constexpr char32_t mapCase( char32_t codepoint ) noexcept
+		{
+			if ( codepoint >= kCaseLimit )
+			{
+				return codepoint;
+			}
+
+			constexpr char32_t blockMask = ( char32_t{ 1 } << kCaseShift ) - 1;
+			const std::size_t block = static_cast<std::size_t>( kCaseIndex[codepoint >> kCaseShift] ) << kCaseShift;
+			const CaseRecord& record = kCaseRecords[kCaseBlocks[block | ( codepoint & blockMask )]];
+
+			const std::int32_t delta = Mapping == CaseMapping::Fold    ? record.fold
+									   : Mapping == CaseMapping::Lower ? record.lower
+																	   : record.upper;
+			return static_cast<char32_t>( static_cast<std::int32_t>( codepoint ) + delta );
+		}
+
+		template <CaseMapping Mapping>
+		inline constexpr char mapAsciiCase( char c ) noexcept
+		{
+			const char first = Mapping == CaseMapping::Upper ? 'a' : 'A';
+			return ( c >= first && c <= first + 25 ) ? static_cast<char>( c ^ 0x20 ) : c;
+		}
+
+#if defined( NFX_STRINGUTILS_HAS_SSE2 )
+		/** @brief Map the ASCII letters among 16 bytes; every other byte is left unchanged */
+		template <CaseMapping Mapping>
+		inline __m128i mapAsciiCase( __m128i bytes ) noexcept
+		{
+			constexpr char first = Mapping == CaseMapping::Upper ? 'a' : 'A';
+			const __m128i shifted = _mm_add_epi8( bytes, _mm_set1_epi8( static_cast<char>( 0x80 - first ) ) );
+			const __m128i letters = _mm_cmplt_epi8( shifted, _mm_set1_epi8( static_cast<char>( -128 + 26 ) ) );
+			return _mm_xor_si128( bytes, _mm_and_si128( letters, _mm_set1_epi8( 0x20 ) ) );
+		}
+#endif
+
+		template <CaseMapping Mapping>
+		inline std::string utf8MapCase( std::string_view str )
+		{
+			const char* const in = str.data();
+			const std::size_t size = str.size();
+
+			// Invariant: the unwritten part of result is at least as long as the unread input,
+			// so ASCII blocks can be stored in place. Only codepoints whose mapping encodes
+			// longer than the source grow the buffer.
+			std::string result( size, '\0' );
+			std::size_t pos = 0;
+			std::size_t out = 0;
+
+			while ( pos < size )
+			{
+#if defined( NFX_STRINGUTILS_HAS_SSE2 )
+				if ( pos + 16 <= size && static_cast<unsigned char>( in[pos] ) < 0x80u )
+				{
+					const __m128i bytes = _mm_loadu_si128( reinterpret_cast<const __m128i*>( in + pos ) );
+					_mm_storeu_si128( reinterpret_cast<__m128i*>( result.data() + out ), mapAsciiCase<Mapping>( bytes ) );
+					const unsigned high = static_cast<unsigned>( _mm_movemask_epi8( bytes ) );
+					const std::size_t ascii = high == 0 ? 16 : static_cast<std::size_t>( std::countr_zero( high ) );
+					pos += ascii;
+					out += ascii;
+					if ( ascii == 16 )
+					{
+						continue;
+					}
+				}
+#endif
+				if ( static_cast<unsigned char>( in[pos] ) < 0x80u )
+				{
+					result[out++] = mapAsciiCase<Mapping>( in[pos++] );
+					continue;
+				}
+
+				char32_t codepoint = 0;
+				const std::size_t length = utf8DecodeLenient( in + pos, size - pos, codepoint );
+				if ( codepoint >= 0xDC80u && codepoint <= 0xDCFFu )
+				{
+					result[out++] = in[pos++];
+					continue;
+				}
+
+				const char32_t mapped = mapCase<Mapping>( codepoint );
+				const std::size_t encoded = utf8EncodedLength( mapped );
+				if ( encoded > length )
+				{
+					result.resize( result.size() + encoded - length );
+				}
+				utf8EncodeOne( mapped, result.data() + out );
+				out += encoded;
+				pos += length;
+			}
+
+			result.resize( out );
+			return result;
+		}
+
+		//----------------------------------------------
+		// Case-insensitive comparison
+		//----------------------------------------------
+
+		/** @brief Decode and fold the codepoint at data; ill-formed bytes keep their escape value */
+		inline std::size_t foldedCodepointAt( const char* data, std::size_t remaining, char32_t& folded ) noexcept
+		{
+			if ( static_cast<unsigned char>( data[0] ) < 0x80u )
+			{
+				folded = static_cast<unsigned char>( mapAsciiCase<CaseMapping::Fold>( data[0] ) );
+				return 1;
+			}
+			const std::size_t length = utf8DecodeLenient( data, remaining, folded );
+			folded = mapCase<CaseMapping::Fold>( folded );
+			return length;
+		}
+
+		inline int utf8CompareFolded( std::string_view lhs, std::string_view rhs ) noexcept
+		{
+			const char* const a = lhs.data();
+			const char* const b = rhs.data();
+			std::size_t i = 0;
+			std::size_t j = 0;
+
+			while ( i < lhs.size() && j < rhs.size() )
+			{
+#if defined( NFX_STRINGUTILS_HAS_SSE2 )
+				if ( i + 16 <= lhs.size() && j + 16 <= rhs.size() && static_cast<unsigned char>( a[i] | b[j] ) < 0x80u )
+				{
+					const __m128i x = _mm_loadu_si128( reinterpret_cast<const __m128i*>( a + i ) );
+					const __m128i y = _mm_loadu_si128( reinterpret_cast<const __m128i*>( b + j ) );
+					const __m128i same = _mm_cmpeq_epi8( mapAsciiCase<CaseMapping::Fold>( x ), mapAsciiCase<CaseMapping::Fold>( y ) );
+					const unsigned stop = ( ~static_cast<unsigned>( _mm_movemask_epi8( same ) ) | static_cast<unsigned>( _mm_movemask_epi8( _mm_or_si128( x, y ) ) ) ) & 0xFFFFu;
+					if ( stop == 0 )
+					{
+						i += 16;
+						j += 16;
+						continue;
+					}
+					// Both sides hold the same ASCII text up to the first stop, so they stay aligned
+					const std::size_t skip = static_cast<std::size_t>( std::countr_zero( stop ) );
+					i += skip;
+					j += skip;
+				}
+#endif
+				char32_t x = 0;
+				char32_t y = 0;
+				i += foldedCodepointAt( a + i, lhs.size() - i, x );
+				j += foldedCodepointAt( b + j, rhs.size() - j, y );
+				if ( x != y )
+				{
+					return x < y ? -1 : 1;
+				}
+			}
+
+			if ( i < lhs.size() )
+			{
+				return 1;
+			}
+			return j < rhs.size() ? -1 : 0;
+		}
+
+		//----------------------------------------------
+		// Normalization
+		//----------------------------------------------
+
+		/** @brief Hangul syllable constants of the algorithmic (de)composition, Unicode section 3.12 */
+		inline constexpr char32_t kHangulSBase{ 0xAC00 };
+		inline constexpr char32_t kHangulLBase{ 0x1100 };
+		inline constexpr char32_t kHangulVBase{ 0x1161 };
+		inline constexpr char32_t kHangulTBase{ 0x11A7 };
+		inline constexpr char32_t kHangulLCount{ 19 };
+		inline constexpr char32_t kHangulVCount{ 21 };
+		inline constexpr char32_t kHangulTCount{ 28 };
+		inline constexpr char32_t kHangulNCount{ kHangulVCount * kHangulTCount };
+		inline constexpr char32_t kHangulSCount{ kHangulLCount * kHangulNCount };
+
+		/** @brief Quick-check flags answering No and Maybe for one normalization form */
+		struct QuickCheckFlags
+		{
+			std::uint8_t no;
+			std::uint8_t maybe;
+		};
+
+		inline constexpr QuickCheckFlags quickCheckFlags( NormalizationForm form ) noexcept
+		{
+			switch ( form )
+			{
+				case NormalizationForm::NFC:
+					return { kNfcNo, kNfcMaybe };
+				case NormalizationForm::NFD:
+					return { kNfdNo, 0 };
+				case NormalizationForm::NFKC:
+					return { kNfkcNo, kNfkcMaybe };
+				default:
+					return { kNfkdNo, 0 };
+			}
+		}
+
+		/** @brief Quick-check flags that make a codepoint unstable under a form */
+		inline constexpr std::uint8_t unstableFlags( NormalizationForm form ) noexcept
+		{
+			const QuickCheckFlags flags = quickCheckFlags( form );
+			return static_cast<std::uint8_t>( flags.no | flags.maybe );
+		}
+
+		inline const NormalizationRecord& normalizationRecord( char32_t codepoint ) noexcept
+		{
+			if ( codepoint >= kNormalizationLimit )
+			{
+				return kNormalizationRecords[0];
+			}
+
+			constexpr char32_t blockMask = ( char32_t{ 1 } << kNormalizationShift ) - 1;
+			const std::size_t block = static_cast<std::size_t>( kNormalizationIndex[codepoint >> kNormalizationShift] ) << kNormalizationShift;
+			return kNormalizationRecords[kNormalizationBlocks[block | ( codepoint & blockMask )]];
+		}
+
+		inline bool isStableStarter( const NormalizationRecord& record, std::uint8_t unstable ) noexcept
+		{
+			return record.ccc == 0 && ( record.quickCheck & unstable ) == 0;
+		}
+
+		inline NormalizationCheck quickCheck( std::string_view str, QuickCheckFlags flags ) noexcept
+		{
+			const char* const in = str.data();
+			const std::size_t size = str.size();
+			NormalizationCheck result = NormalizationCheck::Yes;
+			std::uint8_t lastCcc = 0;
+			std::size_t pos = 0;
+
+			while ( pos < size )
+			{
+				const std::size_t ascii = simd::asciiPrefixLength( in + pos, size - pos );
+				if ( ascii != 0 )
+				{
+					pos += ascii;
+					lastCcc = 0;
+					continue;
+				}
+
+				char32_t codepoint = 0;
+				const std::size_t length = utf8DecodeLenient( in + pos, size - pos, codepoint );
+				const NormalizationRecord& record = normalizationRecord( codepoint );
+				if ( ( record.quickCheck & flags.no ) != 0 || ( record.ccc != 0 && record.ccc < lastCcc ) )
+				{
+					return NormalizationCheck::No;
+				}
+				if ( ( record.quickCheck & flags.maybe ) != 0 )
+				{
+					result = NormalizationCheck::Maybe;
+				}
+				lastCcc = record.ccc;
+				pos += length;
+			}
+
+			return result;
+		}
+
+		/**
+		 * @brief Start of the first segment that normalization may change
+		 * @return Offset of the stable starter preceding the first codepoint that fails the quick
+		 *         check or is out of canonical order (0 if there is none), or npos if str is stable
+		 */
+		inline std::size_t firstUnstableSegment( std::string_view str, std::uint8_t unstable ) noexcept
+		{
+			const char* const in = str.data();
+			const std::size_t size = str.size();
+			std::size_t segment = 0;
+			std::uint8_t lastCcc = 0;
+			std::size_t pos = 0;
+
+			while ( pos < size )
+			{
+				const std::size_t ascii = simd::asciiPrefixLength( in + pos, size - pos );
+				if ( ascii != 0 )
+				{
+					pos += ascii;
+					segment = pos - 1;
+					lastCcc = 0;
+					continue;
+				}
+
+				char32_t codepoint = 0;
+				const std::size_t length = utf8DecodeLenient( in + pos, size - pos, codepoint );
+				const NormalizationRecord& record = normalizationRecord( codepoint );
+				if ( ( record.quickCheck & unstable ) != 0 || ( record.ccc != 0 && record.ccc < lastCcc ) )
+				{
+					return segment;
+				}
+				if ( record.ccc == 0 )
+				{
+					segment = pos;
+				}
+				lastCcc = record.ccc;
+				pos += length;
+			}
+
+			return std::string_view::npos;
+		}
+
+		/** @brief Offset of the first stable starter after the codepoint at start, or str.size() */
+		inline std::size_t segmentEnd( std::string_view str, std::size_t start, std::uint8_t unstable ) noexcept
+		{
+			const char* const in = str.data();
+			const std::size_t size = str.size();
+			char32_t codepoint = 0;
+			std::size_t pos = start + utf8DecodeLenient( in + start, size - start, codepoint );
+
+			while ( pos < size && static_cast<unsigned char>( in[pos] ) >= 0x80u )
+			{
+				const std::size_t length = utf8DecodeLenient( in + pos, size - pos, codepoint );
+				if ( isStableStarter( normalizationRecord( codepoint ), unstable ) )
+				{
+					break;
+				}
+				pos += length;
+			}
+
+			return pos;
+		}
+
+		/** @brief Offset of the last stable starter in str, or 0 if there is none */
+		inline std::size_t lastStableStarter( std::string_view str, std::uint8_t unstable ) noexcept
+		{
+			const char* const in = str.data();
+			const std::size_t size = str.size();
+			std::size_t last = 0;
+			std::size_t pos = 0;
+
+			while ( pos < size )
+			{
+				const std::size_t ascii = simd::asciiPrefixLength( in + pos, size - pos );
+				if ( ascii != 0 )
+				{
+					pos += ascii;
+					last = pos - 1;
+					continue;
+				}
+
+				char32_t codepoint = 0;
+				const std::size_t length = utf8DecodeLenient( in + pos, size - pos, codepoint );
+				if ( isStableStarter( normalizationRecord( codepoint ), unstable ) )
+				{
+					last = pos;
+				}
+				pos += length;
+			}
+
+			return last;
+		}
+
+		/** @brief Number of trailing bytes that start a sequence the input does not yet complete */
+		inline std::size_t incompleteSuffixLength( std::string_view str ) noexcept
+		{
+			for ( std::size_t back = 1; back <= 3 && back <= str.size(); ++back )
+			{
+				const unsigned char byte = static_cast<unsigned char>( str[str.size() - back] );
+				if ( ( byte & 0xC0u ) != 0x80u )
+				{
+					const std::size_t length = byte >= 0xF0u ? 4 : byte >= 0xE0u ? 3
+																: byte >= 0xC0u	  ? 2
+																				  : 1;
+					return length > back ? back : 0;
+				}
+			}
+
+			return 0;
+		}
+
+		/** @brief Append the full canonical or compatibility decomposition of a codepoint */
+		inline void appendDecomposition( char32_t codepoint, bool compatibility, std::u32string& buffer )
+		{
+			const char32_t syllable = codepoint - kHangulSBase;
+			if ( syllable < kHangulSCount )
+			{
+				buffer.push_back( kHangulLBase + syllable / kHangulNCount );
+				buffer.push_back( kHangulVBase + ( syllable % kHangulNCount ) / kHangulTCount );
+				if ( syllable % kHangulTCount != 0 )
+				{
+					buffer.push_back( kHangulTBase + syllable % kHangulTCount );
+				}
+				return;
+			}
+
+			if ( codepoint < kNormalizationLimit )
+			{
+				constexpr char32_t blockMask = ( char32_t{ 1 } << kDecompositionShift ) - 1;
+				const std::size_t block = static_cast<std::size_t>( kDecompositionIndex[codepoint >> kDecompositionShift] ) << kDecompositionShift;
+				const std::size_t offset = kDecompositionBlocks[block | ( codepoint & blockMask )];
+				if ( offset != 0 )
+				{
+					const char32_t* const entry = kDecompositionData + offset;
+					const std::size_t canonicalLength = entry[0] & 0xFFu;
+					const std::size_t compatibilityLength = entry[0] >> 8;
+					if ( compatibility && compatibilityLength != 0 )
+					{
+						buffer.append( entry + 1 + canonicalLength, compatibilityLength );
+						return;
+					}
+					if ( canonicalLength != 0 )
+					{
+						buffer.append( entry + 1, canonicalLength );
+						return;
+					}
+				}
+			}
+
+			buffer.push_back( codepoint );
+		}
+
+		/** @brief Primary composite of a starter and the codepoint that follows it, or 0 if none */
+		inline char32_t composePair( char32_t first, char32_t second ) noexcept
+		{
+			const char32_t leading = first - kHangulLBase;
+			const char32_t vowel = second - kHangulVBase;
+			if ( leading < kHangulLCount && vowel < kHangulVCount )
+			{
+				return kHangulSBase + ( leading * kHangulVCount + vowel ) * kHangulTCount;
+			}
+
+			const char32_t syllable = first - kHangulSBase;
+			const char32_t trailing = second - kHangulTBase;
+			if ( syllable < kHangulSCount && syllable % kHangulTCount == 0 && trailing - 1 < kHangulTCount - 1 )
+			{
+				return first + trailing;
+			}
+
+			if ( first >= kCompositionLimit )
+			{
+				return 0;
+			}
+
+			constexpr char32_t blockMask = ( char32_t{ 1 } << kCompositionShift ) - 1;
+			const std::size_t block = static_cast<std::size_t>( kCompositionIndex[first >> kCompositionShift] ) << kCompositionShift;
+			const std::size_t offset = kCompositionBlocks[block | ( first & blockMask )];
+			if ( offset == 0 )
+			{
+				return 0;
+			}
+
+			const char32_t* const entry = kCompositionData + offset;
+			for ( std::size_t i = 0; i < entry[0]; ++i )
+			{
+				if ( entry[1 + 2 * i] == second )
+				{
+					return entry[2 + 2 * i];
+				}
+			}
+			return 0;
+		}
+
+		/**
+		 * @brief Normalize one segment and append it to output
+		 * @details The segment starts at a stable starter (or the start of the text) and ends
+		 *          before the next one. buffer is scratch space reused across segments.
+		 */
+		inline void normalizeSegment( std::string_view segment, NormalizationForm form, std::u32string& buffer, std::string& output )
+		{
+			const bool compatibility = form == NormalizationForm::NFKC || form == NormalizationForm::NFKD;
+			const bool compose = form == NormalizationForm::NFC || form == NormalizationForm::NFKC;
+
+			buffer.clear();
+			for ( std::size_t pos = 0; pos < segment.size(); )
+			{
+				char32_t codepoint = 0;
+				pos += utf8DecodeLenient( segment.data() + pos, segment.size() - pos, codepoint );
+				appendDecomposition( codepoint, compatibility, buffer );
+			}
+
+			// Canonical ordering: stable insertion sort of each run of non-starters
+			for ( std::size_t i = 1; i < buffer.size(); ++i )
+			{
+				const char32_t codepoint = buffer[i];
+				const std::uint8_t ccc = normalizationRecord( codepoint ).ccc;
+				std::size_t j = i;
+				for ( ; ccc != 0 && j > 0 && normalizationRecord( buffer[j - 1] ).ccc > ccc; --j )
+				{
+					buffer[j] = buffer[j - 1];
+				}
+				buffer[j] = codepoint;
+			}
+
+			// Canonical composition: a mark combines with the last starter unless a codepoint in
+			// between has class 0 or a class at least as high
+			std::size_t length = buffer.size();
+			if ( compose && length != 0 )
+			{
+				std::size_t starter = 0;
+				unsigned lastCcc = normalizationRecord( buffer[0] ).ccc == 0 ? 0u : 256u;
+				length = 1;
+				for ( std::size_t i = 1; i < buffer.size(); ++i )
+				{
+					const char32_t codepoint = buffer[i];
+					const unsigned ccc = normalizationRecord( codepoint ).ccc;
+					if ( lastCcc == 0 || lastCcc < ccc )
+					{
+						const char32_t composite = composePair( buffer[starter], codepoint );
+						if ( composite != 0 )
+						{
+							buffer[starter] = composite;
+							continue;
+						}
+					}
+					if ( ccc == 0 )
+					{
+						starter = length;
+					}
+					lastCcc = ccc;
+					buffer[length++] = codepoint;
+				}
+			}
+
+			for ( std::size_t i = 0; i < length; ++i )
+			{
+				const char32_t codepoint = buffer[i];
+				if ( codepoint >= 0xDC80u && codepoint <= 0xDCFFu )
+				{
+					output.push_back( static_cast<char>( codepoint & 0xFFu ) );
+					continue;
+				}
+				char encoded[4];
+				output.append( encoded, utf8EncodeOne( codepoint, encoded ) );
+			}
+		}
+
+		/** @brief Append the normalization of str to output */
+		inline void normalizeAppend( std::string_view str, NormalizationForm form, std::string& output )
+		{
+			const std::uint8_t unstable = unstableFlags( form );
+			std::u32string buffer;
+			std::size_t pos = 0;
+
+			while ( pos < str.size() )
+			{
+				const std::size_t segment = firstUnstableSegment( str.substr( pos ), unstable );
+				if ( segment == std::string_view::npos )
+				{
+					output.append( str.substr( pos ) );
+					return;
+				}
+
+				const std::size_t start = pos + segment;
+				output.append( str.substr( pos, segment ) );
+				pos = segmentEnd( str, start, unstable );
+				normalizeSegment( str.substr( start, pos - start ), form, buffer, output );
+			}
+		}
+
+		//----------------------------------------------
+		// Display width
+		//----------------------------------------------
+
+		inline std::uint8_t widthProperties( char32_t codepoint ) noexcept
+		{
+			if ( codepoint >= kWidthLimit )
+			{
+				return 0;
+			}
+
+			constexpr char32_t blockMask = ( char32_t{ 1 } << kWidthShift ) - 1;
+			const std::size_t block = static_cast<std::size_t>( kWidthIndex[codepoint >> kWidthShift] ) << kWidthShift;
+			return kWidthBlocks[block | ( codepoint & blockMask )];
+		}
+
+		inline constexpr GraphemeBreak asciiGraphemeBreak( char c ) noexcept
+		{
+			if ( c == '\r' )
+			{
+				return GraphemeBreak::CR;
+			}
+			if ( c == '\n' )
+			{
+				return GraphemeBreak::LF;
+			}
+			return static_cast<unsigned char>( c ) < 0x20u || c == 0x7F ? GraphemeBreak::Control : GraphemeBreak::Other;
+		}
+
+		inline constexpr bool isAsciiPrintable( char c ) noexcept
+		{
+			return c >= 0x20 && c != 0x7F;
+		}
+
+		/** @brief Number of printable bytes (0x20-0x7E) in a run of ASCII */
+		inline std::size_t asciiPrintableCount( const char* data, std::size_t size ) noexcept
+		{
+			std::size_t count = 0;
+			std::size_t pos = 0;
+
+#if defined( NFX_STRINGUTILS_HAS_SSE2 )
+			const __m128i control = _mm_set1_epi8( 0x1F );
+			const __m128i del = _mm_set1_epi8( 0x7F );
+			for ( ; pos + 16 <= size; pos += 16 )
+			{
+				const __m128i bytes = _mm_loadu_si128( reinterpret_cast<const __m128i*>( data + pos ) );
+				const __m128i printable = _mm_andnot_si128( _mm_cmpeq_epi8( bytes, del ), _mm_cmpgt_epi8( bytes, control ) );
+				count += static_cast<std::size_t>( std::popcount( static_cast<unsigned>( _mm_movemask_epi8( printable ) ) ) );
+			}
+#endif
+
+			// Bytes are below 0x80, so neither sum carries into the next byte
+			for ( ; pos + 8 <= size; pos += 8 )
+			{
+				const std::uint64_t word = simd::loadU64( data + pos );
+				const std::uint64_t printable = ( word + 0x60 * simd::kLowBits ) & ~( word + simd::kLowBits ) & simd::kHighBits;
+				count += static_cast<std::size_t>( std::popcount( printable ) );
+			}
+
+			for ( ; pos < size; ++pos )
+			{
+				count += isAsciiPrintable( data[pos] ) ? 1 : 0;
+			}
+
+			return count;
+		}
+
+		/** @brief Extended grapheme cluster segmentation state */
+		struct GraphemeState
+		{
+			/** @brief Break property of the previous codepoint; Control forces a break at the start (GB1) */
+			GraphemeBreak previous{ GraphemeBreak::Control };
+
+			/** @brief The text so far ends with Extended_Pictographic Extend* */
+			bool pictographic{ false };
+
+			/** @brief The text so far ends with Extended_Pictographic Extend* ZWJ */
+			bool pictographicZwj{ false };
+
+			/** @brief The text so far ends with an odd number of regional indicators */
+			bool oddRegional{ false };
+		};
+
+		/** @brief Apply the UAX #29 rules GB3-GB999 before a codepoint and advance the state */
+		inline bool isGraphemeBoundary( GraphemeState& state, std::uint8_t properties ) noexcept
+		{
+			// Most text: a plain codepoint after another one always starts a cluster
+			if ( properties == 0 && state.previous == GraphemeBreak::Other )
+			{
+				state = GraphemeState{ GraphemeBreak::Other };
+				return true;
+			}
+
+			const GraphemeBreak previous = state.previous;
+			const GraphemeBreak next = static_cast<GraphemeBreak>( properties & kGraphemeBreakMask );
+			const bool pictographic = ( properties & kExtendedPictographic ) != 0;
+			const auto isControl = []( GraphemeBreak value ) {
+				return value == GraphemeBreak::CR || value == GraphemeBreak::LF || value == GraphemeBreak::Control;
+			};
+
+			bool boundary = true;
+			if ( previous == GraphemeBreak::CR && next == GraphemeBreak::LF )
+			{
+				boundary = false;
+			}
+			else if ( isControl( previous ) || isControl( next ) )
+			{
+				boundary = true;
+			}
+			else if ( previous == GraphemeBreak::L )
+			{
+				boundary = next != GraphemeBreak::L && next != GraphemeBreak::V && next != GraphemeBreak::LV && next != GraphemeBreak::LVT &&
+						   next != GraphemeBreak::Extend && next != GraphemeBreak::ZWJ && next != GraphemeBreak::SpacingMark;
+			}
+			else if ( ( previous == GraphemeBreak::LV || previous == GraphemeBreak::V ) && ( next == GraphemeBreak::V || next == GraphemeBreak::T ) )
+			{
+				boundary = false;
+			}
+			else if ( ( previous == GraphemeBreak::LVT || previous == GraphemeBreak::T ) && next == GraphemeBreak::T )
+			{
+				boundary = false;
+			}
+			else if ( next == GraphemeBreak::Extend || next == GraphemeBreak::ZWJ || next == GraphemeBreak::SpacingMark || previous == GraphemeBreak::Prepend )
+			{
+				boundary = false;
+			}
+			else if ( pictographic && state.pictographicZwj )
+			{
+				boundary = false;
+			}
+			else if ( next == GraphemeBreak::RegionalIndicator )
+			{
+				boundary = !state.oddRegional;
+			}
+
+			state.pictographicZwj = next == GraphemeBreak::ZWJ && state.pictographic;
+			state.pictographic = pictographic || ( state.pictographic && next == GraphemeBreak::Extend );
+			state.oddRegional = next == GraphemeBreak::RegionalIndicator && !state.oddRegional;
+			state.previous = next;
+			return boundary;
+		}
+
+		/**
+		 * @brief Longest prefix of whole grapheme clusters that fits in a display width
+		 * @param str UTF-8 string to measure
+		 * @param limit Maximum width in columns
+		 * @param[out] width Width of the returned prefix
+		 * @return Byte length of the prefix; str.size() if all of str fits
+		 */
+		inline std::size_t displayPrefix( std::string_view str, std::size_t limit, std::size_t& width ) noexcept
+		{
+			const char* const in = str.data();
+			const std::size_t size = str.size();
+			GraphemeState state;
+			std::size_t clusterWidth = 0;
+			bool pictographicBase = false;
+			std::size_t total = 0;
+			std::size_t cut = 0;
+			std::size_t cutWidth = 0;
+			std::size_t pos = 0;
+
+			while ( pos < size )
+			{
+				// All but the last byte of an ASCII run are whole clusters; the last byte may
+				// take combining marks. CR and Prepend may join the first byte, so skip the bulk.
+				const std::size_t run = simd::asciiPrefixLength( in + pos, size - pos );
+				if ( run > 1 && state.previous != GraphemeBreak::CR && state.previous != GraphemeBreak::Prepend )
+				{
+					if ( total > limit )
+					{
+						break;
+					}
+
+					const std::size_t bulk = run - 1;
+					const std::size_t printable = asciiPrintableCount( in + pos, bulk );
+					if ( total + printable > limit )
+					{
+						// Stop before the first printable byte past the limit
+						std::size_t remaining = limit - total;
+						for ( ;; ++pos )
+						{
+							if ( isAsciiPrintable( in[pos] ) && remaining-- == 0 )
+							{
+								width = limit;
+								return pos;
+							}
+						}
+					}
+
+					total += printable;
+					const char last = in[pos + bulk - 1];
+					cut = pos + bulk - 1;
+					if ( last == '\n' && bulk > 1 && in[cut - 1] == '\r' )
+					{
+						--cut;
+					}
+					cutWidth = total - ( isAsciiPrintable( last ) ? 1 : 0 );
+
+					state = GraphemeState{};
+					state.previous = asciiGraphemeBreak( last );
+					clusterWidth = isAsciiPrintable( last ) ? 1 : 0;
+					pictographicBase = false;
+					pos += bulk;
+				}
+
+				char32_t codepoint = 0;
+				const std::size_t length = utf8DecodeLenient( in + pos, size - pos, codepoint );
+				const std::uint8_t properties = codepoint >= 0xDC80u && codepoint <= 0xDCFFu ? 0 : widthProperties( codepoint );
+				const std::size_t codepointWidth = ( properties & kZeroWidth ) != 0 ? 0 : ( properties & kWide ) != 0 ? 2 : 1;
+
+				if ( isGraphemeBoundary( state, properties ) )
+				{
+					if ( total > limit )
+					{
+						break;
+					}
+					cut = pos;
+					cutWidth = total;
+					clusterWidth = codepointWidth;
+					pictographicBase = ( properties & kExtendedPictographic ) != 0;
+					total += codepointWidth;
+				}
+				else
+				{
+					// A cluster is as wide as its widest codepoint; emoji presentation and flags take two
+					std::size_t widened = std::max( clusterWidth, codepointWidth );
+					if ( ( codepoint == 0xFE0F && pictographicBase ) || static_cast<GraphemeBreak>( properties & kGraphemeBreakMask ) == GraphemeBreak::RegionalIndicator )
+					{
+						widened = 2;
+					}
+					total += widened - clusterWidth;
+					clusterWidth = widened;
+				}
+				pos += length;
+			}
+
+			if ( pos >= size && total <= limit )
+			{
+				width = total;
+				return size;
+			}
+			width = cutWidth;
+			return cut;
+		}
+	} // namespace detail
+
+	//=====================================================================
+	// Unicode text processing
+	//=====================================================================
+
+	//----------------------------------------------
+	// Codepoint case mapping
+	//----------------------------------------------
+
+	inline constexpr char32_t caseFoldCodepoint( char32_t codepoint ) noexcept
+	{
+		return detail::mapCase<detail::CaseMapping::Fold>( codepoint );
+	}
+
+	inline constexpr char32_t toLowerCodepoint( char32_t codepoint ) noexcept
+	{
+		return detail::mapCase<detail::CaseMapping::Lower>( codepoint );
+	}
+
+	inline constexpr char32_t toUpperCodepoint( char32_t codepoint ) noexcept
+	{
+		return detail::mapCase<detail::CaseMapping::Upper>( codepoint );
+	}
+
+	//----------------------------------------------
+	// String case mapping
+	//----------------------------------------------
+
+	inline std::string utf8CaseFold( std::string_view str )
+	{
+		return detail::utf8MapCase<detail::CaseMapping::Fold>( str );
+	}
+
+	inline std::string utf8ToLower( std::string_view str )
+	{
+		return detail::utf8MapCase<detail::CaseMapping::Lower>( str );
+	}
+
+	inline std::string utf8ToUpper( std::string_view str )
+	{
+		return detail::utf8MapCase<detail::CaseMapping::Upper>( str );
+	}
+
+	//----------------------------------------------
+	// Case-insensitive comparison
+	//----------------------------------------------
+
+	inline bool iequalsUtf8( std::string_view lhs, std::string_view rhs ) noexcept
+	{
+		return detail::utf8CompareFolded( lhs, rhs ) == 0;
+	}
+
+	inline int icompareUtf8( std::string_view lhs, std::string_view rhs ) noexcept
+	{
+		return detail::utf8CompareFolded( lhs, rhs );
+	}
+
+	//----------------------------------------------
+	// Normalization
+	//----------------------------------------------
+
+	inline NormalizationCheck utf8QuickCheck( std::string_view str, NormalizationForm form ) noexcept
+	{
+		return detail::quickCheck( str, detail::quickCheckFlags( form ) );
+	}
+
+	inline bool utf8IsNormalized( std::string_view str, NormalizationForm form )
+	{
+		switch ( utf8QuickCheck( str, form ) )
+		{
+			case NormalizationCheck::Yes:
+				return true;
+			case NormalizationCheck::No:
+				return false;
+			default:
+				return utf8Normalize( str, form ) == str;
+		}
+	}
+
+	inline std::string utf8Normalize( std::string_view str, NormalizationForm form )
+	{
+		std::string result;
+		result.reserve( str.size() );
+		detail::normalizeAppend( str, form, result );
+		return result;
+	}
+
+	inline bool utf8NormalizeInPlace( std::string& str, NormalizationForm form )
+	{
+		if ( detail::firstUnstableSegment( str, detail::unstableFlags( form ) ) == std::string_view::npos )
+		{
+			return false;
+		}
+
+		std::string result = utf8Normalize( str, form );
+		if ( result == str )
+		{
+			return false;
+		}
+		str.swap( result );
+		return true;
+	}
+
+	//=====================================================================
+	// Utf8Normalizer class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	inline Utf8Normalizer::Utf8Normalizer( NormalizationForm form ) noexcept
+		: m_form{ form }
+	{
+	}
+
+	//----------------------------------------------
+	// Streaming
+	//----------------------------------------------
+
+	inline void Utf8Normalizer::append( std::string_view chunk, std::string& output )
+	{
+		m_pending.append( chunk );
+
+		// Text before the last stable starter can no longer interact with later input
+		const std::string_view pending{ m_pending };
+		const std::size_t complete = pending.size() - detail::incompleteSuffixLength( pending );
+		const std::size_t boundary = detail::lastStableStarter( pending.substr( 0, complete ), detail::unstableFlags( m_form ) );
+		if ( boundary == 0 )
+		{
+			return;
+		}
+
+		detail::normalizeAppend( pending.substr( 0, boundary ), m_form, output );
+		m_pending.erase( 0, boundary );
+	}
+
+	inline void Utf8Normalizer::finish( std::string& output )
+	{
+		detail::normalizeAppend( m_pending, m_form, output );
+		m_pending.clear();
+	}
+
+	inline NormalizationForm Utf8Normalizer::form() const noexcept
+	{
+		return m_form;
+	}
+
+	//=====================================================================
+	// Display width
+	//=====================================================================
+
+	inline std::size_t displayWidth( std::string_view str ) noexcept
+	{
+		std::size_t width = 0;
+		detail::displayPrefix( str, static_cast<std::size_t>( -1 ), width );
+		return width;
+	}
+
+	inline std::string padDisplay( std::string_view str, std::size_t width, TextAlignment alignment, char fillChar )
+	{
+		const std::size_t current = displayWidth( str );
+		if ( current >= width )
+		{
+			return std::string{ str };
+		}
+
+		const std::size_t totalPadding = width - current;
+		const std::size_t leftPadding = alignment == TextAlignment::Left	 ? 0
+										: alignment == TextAlignment::Right ? totalPadding
+																			: totalPadding / 2;
+
+		std::string result;
+		result.reserve( str.size() + totalPadding );
+		result.append( leftPadding, fillChar );
+		result.append( str );
+		result.append( totalPadding - leftPadding, fillChar );
+
+		return result;
+	}
+
+	inline std::string truncateDisplay( std::string_view str, std::size_t width, std::string_view ellipsis )
+	{
+		std::size_t prefixWidth = 0;
+		const std::size_t fits = detail::displayPrefix( str, width, prefixWidth );
+		if ( fits == str.size() )
+		{
+			return std::string{ str };
+		}
+
+		const std::size_t ellipsisWidth = displayWidth( ellipsis );
+		if ( ellipsisWidth > width )
+		{
+			return std::string{ str.substr( 0, fits ) };
+		}
+
+		const std::size_t length = detail::displayPrefix( str, width - ellipsisWidth, prefixWidth );
+		std::string result;
+		result.reserve( length + ellipsis.size() );
+		result.append( str.substr( 0, length ) );
+		result.append( ellipsis );
+
+		return result;
+	}
+} // namespace nfx::string
@@ -0,0 +1,1523 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Utf8.inl
+ * @brief Implementation of UTF-8 validation, codepoint counting and transcoding
+ * @details The vector validator follows the lookup-table approach of Keiser & Lemire
+ *          ("Validating UTF-8 In Less Than One Instruction Per Byte"): three 16-entry tables
+ *          indexed by the high and low nibble of the previous byte and the high nibble of the
+ *          current byte classify every two-byte window in a single pass. When a block fails,
+ *          the scalar decoder resumes from the last sequence boundary to report an exact offset.
+ *          Transcoders widen or narrow pure-ASCII blocks directly and handle blocks made of
+ *          1-3 byte sequences with pshufb gather/compaction tables generated at compile time.
+ *          Validating UTF-8 conversions run the vector validator first and then the unchecked
+ *          kernel over the well-formed prefix.
+ */
+
+#include <algorithm>
+#include <bit>
+
+#include "nfx/detail/string/Simd.h"
+
+namespace nfx::string
+{
+	namespace detail
+	{
+		//=====================================================================
+		// UTF-8 internals
+		//=====================================================================
+
+		//----------------------------------------------
+		// Scalar decoder
+		//----------------------------------------------
+
+		inline constexpr bool isUtf8Continuation( unsigned char byte ) noexcept
+		{
+			return ( byte & 0xC0u ) == 0x80u;
+		}
+
+		/**
+		 * @brief Validate UTF-8 from a sequence boundary
+		 * @param data Bytes to validate
+		 * @param size Number of bytes
+		 * @param pos Offset to start from; must be the first byte of a sequence
+		 * @return Offset of the first ill-formed sequence, or std::string_view::npos
+		 */
+		inline std::size_t utf8ValidateScalar( const char* data, std::size_t size, std::size_t pos ) noexcept
+		{
+			const auto* bytes = reinterpret_cast<const unsigned char*>( data );
+
+			while ( pos < size )
+			{
+				const unsigned char lead = bytes[pos];
+
+				if ( lead < 0x80u )
+				{
+					pos += simd::asciiPrefixLength( data + pos, size - pos );
+					continue;
+				}
+
+				if ( lead < 0xC2u ) // Stray continuation byte or overlong 2-byte lead (C0, C1)
+				{
+					return pos;
+				}
+
+				if ( lead < 0xE0u )
+				{
+					if ( pos + 1 >= size || !isUtf8Continuation( bytes[pos + 1] ) )
+					{
+						return pos;
+					}
+					pos += 2;
+					continue;
+				}
+
+				if ( lead < 0xF0u )
+				{
+					if ( pos + 2 >= size )
+					{
+						return pos;
+					}
+					const unsigned char second = bytes[pos + 1];
+					if ( ( lead == 0xE0u && second < 0xA0u ) || // Overlong
+						 ( lead == 0xEDu && second > 0x9Fu ) || // Surrogate
+						 !isUtf8Continuation( second ) || !isUtf8Continuation( bytes[pos + 2] ) )
+					{
+						return pos;
+					}
+					pos += 3;
+					continue;
+				}
+
+				if ( lead < 0xF5u )
+				{
+					if ( pos + 3 >= size )
+					{
+						return pos;
+					}
+					const unsigned char second = bytes[pos + 1];
+					if ( ( lead == 0xF0u && second < 0x90u ) || // Overlong
+						 ( lead == 0xF4u && second > 0x8Fu ) || // Above U+10FFFF
+						 !isUtf8Continuation( second ) || !isUtf8Continuation( bytes[pos + 2] ) ||
+						 !isUtf8Continuation( bytes[pos + 3] ) )
+					{
+						return pos;
+					}
+					pos += 4;
+					continue;
+				}
+
+				return pos; // F5-FF never appear in UTF-8
+			}
+
+			return std::string_view::npos;
+		}
+
+		/**
+		 * @brief Find a sequence boundary at or before pos
+		 * @details Assumes data[0, pos) is valid UTF-8 except for a possibly truncated final sequence,
+		 *          and returns the start of that sequence (or pos when the prefix ends cleanly).
+		 */
+		inline std::size_t utf8SequenceBoundary( const char* data, std::size_t pos ) noexcept
+		{
+			const auto* bytes = reinterpret_cast<const unsigned char*>( data );
+
+			std::size_t start = pos >= 3 ? pos - 3 : 0;
+			while ( start < pos && isUtf8Continuation( bytes[start] ) )
+			{
+				++start;
+			}
+			return start;
+		}
+
+		//----------------------------------------------
+		// Vector classifier
+		//----------------------------------------------
+
+#if defined( NFX_STRINGUTILS_HAS_SSSE3 )
+		// Error classes; a byte pair is invalid when all three nibble lookups share a bit
+		inline constexpr std::uint8_t kTooShort{ 1 << 0 };
+		inline constexpr std::uint8_t kTooLong{ 1 << 1 };
+		inline constexpr std::uint8_t kOverlong3{ 1 << 2 };
+		inline constexpr std::uint8_t kTooLarge{ 1 << 3 };
+		inline constexpr std::uint8_t kSurrogate{ 1 << 4 };
+		inline constexpr std::uint8_t kOverlong2{ 1 << 5 };
+		inline constexpr std::uint8_t kTooLarge1000{ 1 << 6 };
+		inline constexpr std::uint8_t kOverlong4{ 1 << 6 };
+		inline constexpr std::uint8_t kTwoConts{ 1 << 7 };
+		inline constexpr std::uint8_t kCarry{ kTooShort | kTooLong | kTwoConts };
+
+		alignas( 16 ) inline constexpr std::uint8_t kByte1High[16]{
+			// 0xxx____ ________ : ASCII in byte 1
+			kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong,
+			// 10xx____ ________ : continuation in byte 1
+			kTwoConts, kTwoConts, kTwoConts, kTwoConts,
+			// 1100____ ________ : 2-byte lead
+			kTooShort | kOverlong2,
+			// 1101____ ________ : 2-byte lead
+			kTooShort,
+			// 1110____ ________ : 3-byte lead
+			kTooShort | kOverlong3 | kSurrogate,
+			// 1111____ ________ : 4-byte lead
+			kTooShort | kTooLarge | kTooLarge1000 | kOverlong4 };
+
+		alignas( 16 ) inline constexpr std::uint8_t kByte1Low[16]{
+			// ____0000 ________
+			kCarry | kOverlong3 | kOverlong2 | kOverlong4,
+			// ____0001 ________
+			kCarry | kOverlong2,
+			// ____001x ________
+			kCarry,
+			kCarry,
+			// ____0100 ________
+			kCarry | kTooLarge,
+			// ____0101 ________ and above
+			kCarry | kTooLarge | kTooLarge1000,
+			kCarry | kTooLarge | kTooLarge1000,
+			kCarry | kTooLarge | kTooLarge1000,
+			kCarry | kTooLarge | kTooLarge1000,
+			kCarry | kTooLarge | kTooLarge1000,
+			kCarry | kTooLarge | kTooLarge1000,
+			kCarry | kTooLarge | kTooLarge1000,
+			kCarry | kTooLarge | kTooLarge1000,
+			// ____1101 ________
+			kCarry | kTooLarge | kTooLarge1000 | kSurrogate,
+			kCarry | kTooLarge | kTooLarge1000,
+			kCarry | kTooLarge | kTooLarge1000 };
+
+		alignas( 16 ) inline constexpr std::uint8_t kByte2High[16]{
+			// ________ 0xxx____ : ASCII in byte 2
+			kTooShort, kTooShort, kTooShort, kTooShort, kTooShort, kTooShort, kTooShort, kTooShort,
+			// ________ 1000____
+			kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge1000 | kOverlong4,
+			// ________ 1001____
+			kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge,
+			// ________ 101x____
+			kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,
+			kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,
+			// ________ 11xx____ : lead in byte 2
+			kTooShort, kTooShort, kTooShort, kTooShort };
+
+		/**
+		 * @brief Classify one vector of input against the tail of the previous one
+		 * @return Non-zero lanes where the byte stream is ill-formed
+		 */
+		template <typename V>
+		inline typename V::Vector utf8CheckBlock( typename V::Vector input, typename V::Vector previous ) noexcept
+		{
+			const auto prev1 = V::template prev<1>( input, previous );
+			const auto byte1High = V::lookup( V::table( kByte1High ), V::highNibbles( prev1 ) );
+			const auto byte1Low = V::lookup( V::table( kByte1Low ), V::lowNibbles( prev1 ) );
+			const auto byte2High = V::lookup( V::table( kByte2High ), V::highNibbles( input ) );
+			const auto special = V::and_( V::and_( byte1High, byte1Low ), byte2High );
+
+			// Bytes two or three positions after a 3/4-byte lead must be continuations
+			const auto prev2 = V::template prev<2>( input, previous );
+			const auto prev3 = V::template prev<3>( input, previous );
+			const auto isThird = V::subSaturate( prev2, V::splat( 0xE0u - 0x80u ) );
+			const auto isFourth = V::subSaturate( prev3, V::splat( 0xF0u - 0x80u ) );
+			const auto mustBeContinuation = V::and_( V::or_( isThird, isFourth ), V::splat( 0x80u ) );
+
+			return V::xor_( mustBeContinuation, special );
+		}
+
+		/**
+		 * @brief Flags a vector whose last sequence continues into the next block
+		 */
+		template <typename V>
+		inline typename V::Vector utf8IncompleteTail( typename V::Vector input ) noexcept
+		{
+			alignas( 32 ) static constexpr std::uint8_t maxValues[32]{
+				0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+				0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+				0xF0u - 1, 0xE0u - 1, 0xC0u - 1 };
+
+			return V::subSaturate( input, V::load( reinterpret_cast<const char*>( maxValues ) + 32 - V::width ) );
+		}
+
+		/**
+		 * @brief Run the vector classifier over whole blocks
+		 * @return Offset up to which the input is known to be valid, except for a possibly
+		 *         truncated final sequence; the scalar decoder finishes from there
+		 */
+		template <typename V>
+		inline std::size_t utf8ValidateBlocks( const char* data, std::size_t size ) noexcept
+		{
+			std::size_t pos = 0;
+			auto previous = V::zero();
+			auto incomplete = V::zero();
+
+			while ( pos + 2 * V::width <= size )
+			{
+				const auto first = V::load( data + pos );
+				const auto second = V::load( data + pos + V::width );
+
+				if ( V::isAscii( V::or_( first, second ) ) )
+				{
+					if ( V::any( incomplete ) )
+					{
+						return pos;
+					}
+					previous = second;
+					pos += 2 * V::width;
+					continue;
+				}
+
+				const auto errors = V::or_( utf8CheckBlock<V>( first, previous ), utf8CheckBlock<V>( second, first ) );
+				if ( V::any( errors ) )
+				{
+					return pos;
+				}
+				previous = second;
+				incomplete = utf8IncompleteTail<V>( second );
+				pos += 2 * V::width;
+			}
+
+			while ( pos + V::width <= size )
+			{
+				const auto input = V::load( data + pos );
+
+				if ( V::isAscii( input ) )
+				{
+					if ( V::any( incomplete ) )
+					{
+						return pos;
+					}
+					incomplete = V::zero();
+				}
+				else
+				{
+					if ( V::any( utf8CheckBlock<V>( input, previous ) ) )
+					{
+						return pos;
+					}
+					incomplete = utf8IncompleteTail<V>( input );
+				}
+				previous = input;
+				pos += V::width;
+			}
+
+			return pos;
+		}
+#endif
+
+		inline std::size_t utf8FindError( std::string_view str ) noexcept
+		{
+			std::size_t start = 0;
+
+#if defined( NFX_STRINGUTILS_HAS_AVX2 )
+			start = utf8SequenceBoundary( str.data(), utf8ValidateBlocks<simd::Avx2>( str.data(), str.size() ) );
+#elif defined( NFX_STRINGUTILS_HAS_SSSE3 )
+			start = utf8SequenceBoundary( str.data(), utf8ValidateBlocks<simd::Sse>( str.data(), str.size() ) );
+#endif
+
+			return utf8ValidateScalar( str.data(), str.size(), start );
+		}
+
+		//----------------------------------------------
+		// Transcoding internals
+		//----------------------------------------------
+
+		/**
+		 * @brief Decode one UTF-8 sequence without validating it
+		 * @return Sequence length, or 0 if the sequence is truncated by the end of input
+		 */
+		inline std::size_t utf8DecodeOne( const char* data, std::size_t remaining, char32_t& codepoint ) noexcept
+		{
+			const auto* bytes = reinterpret_cast<const unsigned char*>( data );
+			const unsigned char lead = bytes[0];
+
+			if ( lead < 0x80u )
+			{
+				codepoint = lead;
+				return 1;
+			}
+
+			if ( lead < 0xE0u )
+			{
+				if ( remaining < 2 )
+				{
+					return 0;
+				}
+				codepoint = ( static_cast<char32_t>( lead & 0x1Fu ) << 6 ) | ( bytes[1] & 0x3Fu );
+				return 2;
+			}
+			if ( lead < 0xF0u )
+			{
+				if ( remaining < 3 )
+				{
+					return 0;
+				}
+				codepoint = ( static_cast<char32_t>( lead & 0x0Fu ) << 12 ) |
+							( static_cast<char32_t>( bytes[1] & 0x3Fu ) << 6 ) | ( bytes[2] & 0x3Fu );
+				return 3;
+			}
+			if ( remaining < 4 )
+			{
+				return 0;
+			}
+			codepoint = ( static_cast<char32_t>( lead & 0x07u ) << 18 ) |
+						( static_cast<char32_t>( bytes[1] & 0x3Fu ) << 12 ) |
+						( static_cast<char32_t>( bytes[2] & 0x3Fu ) << 6 ) | ( bytes[3] & 0x3Fu );
+			return 4;
+		}
+
+		/**
+		 * @brief Decode one UTF-8 sequence, escaping ill-formed bytes
+		 * @param codepoint Output codepoint, or U+DC80-U+DCFF holding the byte of an ill-formed
+		 *                  sequence (these lone surrogates never come out of valid UTF-8)
+		 * @return Number of bytes consumed, at least 1
+		 */
+		inline std::size_t utf8DecodeLenient( const char* data, std::size_t remaining, char32_t& codepoint ) noexcept
+		{
+			const auto* bytes = reinterpret_cast<const unsigned char*>( data );
+			const unsigned char lead = bytes[0];
+			if ( lead < 0x80u )
+			{
+				codepoint = lead;
+				return 1;
+			}
+
+			// Second-byte bounds from RFC 3629 exclude overlongs, surrogates and values above U+10FFFF
+			std::size_t length = 0;
+			unsigned char low = 0x80u;
+			unsigned char high = 0xBFu;
+			if ( lead >= 0xC2u && lead <= 0xDFu )
+			{
+				length = 2;
+			}
+			else if ( lead >= 0xE0u && lead <= 0xEFu )
+			{
+				length = 3;
+				low = lead == 0xE0u ? 0xA0u : 0x80u;
+				high = lead == 0xEDu ? 0x9Fu : 0xBFu;
+			}
+			else if ( lead >= 0xF0u && lead <= 0xF4u )
+			{
+				length = 4;
+				low = lead == 0xF0u ? 0x90u : 0x80u;
+				high = lead == 0xF4u ? 0x8Fu : 0xBFu;
+			}
+
+			bool wellFormed = length != 0 && remaining >= length && bytes[1] >= low && bytes[1] <= high;
+			for ( std::size_t i = 2; wellFormed && i < length; ++i )
+			{
+				wellFormed = isUtf8Continuation( bytes[i] );
+			}
+			if ( !wellFormed )
+			{
+				codepoint = 0xDC00u | lead;
+				return 1;
+			}
+			return utf8DecodeOne( data, remaining, codepoint );
+		}
+
+		/**
+		 * @brief Decode one UTF-16 codepoint
+		 * @tparam Validate Reject unpaired surrogates when true
+		 * @return Number of units consumed, or 0 if ill-formed
+		 */
+		template <bool Validate>
+		inline std::size_t utf16DecodeOne( const char16_t* data, std::size_t remaining, char32_t& codepoint ) noexcept
+		{
+			const char16_t unit = data[0];
+			if ( unit < 0xD800u || unit > 0xDFFFu )
+			{
+				codepoint = unit;
+				return 1;
+			}
+
+			if ( remaining < 2 )
+			{
+				return 0;
+			}
+			if constexpr ( Validate )
+			{
+				if ( unit > 0xDBFFu || data[1] < 0xDC00u || data[1] > 0xDFFFu )
+				{
+					return 0;
+				}
+			}
+
+			codepoint = 0x10000u + ( ( static_cast<char32_t>( unit ) - 0xD800u ) << 10 ) + ( static_cast<char32_t>( data[1] ) - 0xDC00u );
+			return 2;
+		}
+
+		inline constexpr std::size_t utf8EncodedLength( char32_t codepoint ) noexcept
+		{
+			return codepoint < 0x80u ? 1 : codepoint < 0x800u ? 2
+									   : codepoint < 0x10000u ? 3
+															  : 4;
+		}
+
+		/**
+		 * @brief Encode one codepoint as UTF-8
+		 * @return Number of bytes written (1-4)
+		 */
+		inline std::size_t utf8EncodeOne( char32_t codepoint, char* output ) noexcept
+		{
+			if ( codepoint < 0x80u )
+			{
+				output[0] = static_cast<char>( codepoint );
+				return 1;
+			}
+			if ( codepoint < 0x800u )
+			{
+				output[0] = static_cast<char>( 0xC0u | ( codepoint >> 6 ) );
+				output[1] = static_cast<char>( 0x80u | ( codepoint & 0x3Fu ) );
+				return 2;
+			}
+			if ( codepoint < 0x10000u )
+			{
+				output[0] = static_cast<char>( 0xE0u | ( codepoint >> 12 ) );
+				output[1] = static_cast<char>( 0x80u | ( ( codepoint >> 6 ) & 0x3Fu ) );
+				output[2] = static_cast<char>( 0x80u | ( codepoint & 0x3Fu ) );
+				return 3;
+			}
+			output[0] = static_cast<char>( 0xF0u | ( codepoint >> 18 ) );
+			output[1] = static_cast<char>( 0x80u | ( ( codepoint >> 12 ) & 0x3Fu ) );
+			output[2] = static_cast<char>( 0x80u | ( ( codepoint >> 6 ) & 0x3Fu ) );
+			output[3] = static_cast<char>( 0x80u | ( codepoint & 0x3Fu ) );
+			return 4;
+		}
+
+		inline constexpr bool isUnicodeScalar( char32_t codepoint ) noexcept
+		{
+			return codepoint <= 0x10FFFFu && ( codepoint < 0xD800u || codepoint > 0xDFFFu );
+		}
+
+#if defined( NFX_STRINGUTILS_HAS_SSSE3 )
+		/** @brief pshufb masks, one 16-byte entry per 8-bit lane mask */
+		struct ShuffleTable
+		{
+			std::uint8_t entries[256][16];
+		};
+
+		/**
+		 * @brief Compaction of UTF-16 lanes: drops the lanes flagged in the mask (lead bytes)
+		 */
+		inline constexpr ShuffleTable makeDropLanesTable() noexcept
+		{
+			ShuffleTable table{};
+			for ( unsigned mask = 0; mask < 256; ++mask )
+			{
+				unsigned out = 0;
+				for ( unsigned lane = 0; lane < 8; ++lane )
+				{
+					if ( ( mask & ( 1u << lane ) ) == 0 )
+					{
+						table.entries[mask][out++] = static_cast<std::uint8_t>( 2 * lane );
+						table.entries[mask][out++] = static_cast<std::uint8_t>( 2 * lane + 1 );
+					}
+				}
+				while ( out < 16 )
+				{
+					table.entries[mask][out++] = 0x80;
+				}
+			}
+			return table;
+		}
+
+		/**
+		 * @brief Compaction of 2-byte UTF-8 pairs: drops the second byte of lanes flagged in the mask (ASCII)
+		 */
+		inline constexpr ShuffleTable makeDropSecondByteTable() noexcept
+		{
+			ShuffleTable table{};
+			for ( unsigned mask = 0; mask < 256; ++mask )
+			{
+				unsigned out = 0;
+				for ( unsigned lane = 0; lane < 8; ++lane )
+				{
+					table.entries[mask][out++] = static_cast<std::uint8_t>( 2 * lane );
+					if ( ( mask & ( 1u << lane ) ) == 0 )
+					{
+						table.entries[mask][out++] = static_cast<std::uint8_t>( 2 * lane + 1 );
+					}
+				}
+				while ( out < 16 )
+				{
+					table.entries[mask][out++] = 0x80;
+				}
+			}
+			return table;
+		}
+
+		alignas( 16 ) inline constexpr ShuffleTable kDropLanes{ makeDropLanesTable() };
+		alignas( 16 ) inline constexpr ShuffleTable kDropSecondByte{ makeDropSecondByteTable() };
+
+		/**
+		 * @brief Decode 8 bytes made only of ASCII and 2-byte sequences into UTF-16 lanes
+		 * @param data Pointer to 8 readable bytes starting on a sequence boundary
+		 * @param values Output decoded lanes, compacted to the front
+		 * @param consumed Output bytes consumed (7 when the block ends with a lead byte)
+		 * @param produced Output number of valid lanes in values
+		 * @return False if the block holds other sequence lengths
+		 * @details The input must already be validated; only the block structure is checked here.
+		 */
+		inline bool utf8TwoByteBlock( const char* data, __m128i& values, std::size_t& consumed, std::size_t& produced ) noexcept
+		{
+			const __m128i bytes = _mm_loadl_epi64( reinterpret_cast<const __m128i*>( data ) );
+			const __m128i limit = _mm_set1_epi8( static_cast<char>( 0xDF ) );
+			if ( ( _mm_movemask_epi8( _mm_cmpeq_epi8( _mm_max_epu8( bytes, limit ), limit ) ) & 0xFF ) != 0xFF )
+			{
+				return false; // 3 or 4 byte sequences present
+			}
+
+			const unsigned high = static_cast<unsigned>( _mm_movemask_epi8( bytes ) ) & 0xFFu;
+			const unsigned leads = static_cast<unsigned>( _mm_movemask_epi8( _mm_cmpgt_epi8( bytes, _mm_set1_epi8( -65 ) ) ) ) & high;
+			const unsigned continuations = high & ~leads;
+			if ( continuations != ( ( leads << 1 ) & 0xFFu ) )
+			{
+				return false;
+			}
+			const __m128i wide = _mm_unpacklo_epi8( bytes, _mm_setzero_si128() );
+			const __m128i previous = _mm_slli_si128( wide, 2 );
+			const __m128i combined = _mm_or_si128( _mm_slli_epi16( _mm_and_si128( previous, _mm_set1_epi16( 0x1F ) ), 6 ),
+				_mm_and_si128( wide, _mm_set1_epi16( 0x3F ) ) );
+			const __m128i isContinuation = _mm_cmpeq_epi16( _mm_and_si128( wide, _mm_set1_epi16( 0xC0 ) ), _mm_set1_epi16( 0x80 ) );
+			const __m128i merged = _mm_or_si128( _mm_and_si128( isContinuation, combined ), _mm_andnot_si128( isContinuation, wide ) );
+
+			values = _mm_shuffle_epi8( merged, _mm_load_si128( reinterpret_cast<const __m128i*>( kDropLanes.entries[leads] ) ) );
+			consumed = 8 - ( leads >> 7 );
+			produced = 8 - static_cast<std::size_t>( std::popcount( leads ) );
+			return true;
+		}
+
+		/**
+		 * @brief Encode 8 UTF-16 lanes below U+0800 as UTF-8
+		 * @param units Lanes to encode; every value must be below 0x800
+		 * @param produced Output number of valid bytes in the result
+		 * @return Encoded bytes, compacted to the front
+		 */
+		inline __m128i utf16TwoByteBlock( __m128i units, std::size_t& produced ) noexcept
+		{
+			const __m128i isAscii = _mm_cmpeq_epi16( _mm_and_si128( units, _mm_set1_epi16( static_cast<short>( 0xFF80 ) ) ), _mm_setzero_si128() );
+			const unsigned asciiMask = static_cast<unsigned>( _mm_movemask_epi8( _mm_packs_epi16( isAscii, _mm_setzero_si128() ) ) ) & 0xFFu;
+
+			const __m128i lead = _mm_or_si128( _mm_srli_epi16( units, 6 ), _mm_set1_epi16( 0xC0 ) );
+			const __m128i continuation = _mm_or_si128( _mm_and_si128( units, _mm_set1_epi16( 0x3F ) ), _mm_set1_epi16( 0x80 ) );
+			const __m128i first = _mm_or_si128( _mm_and_si128( isAscii, units ), _mm_andnot_si128( isAscii, lead ) );
+			const __m128i pairs = _mm_or_si128( first, _mm_slli_epi16( continuation, 8 ) );
+
+			produced = 16 - static_cast<std::size_t>( std::popcount( asciiMask ) );
+			return _mm_shuffle_epi8( pairs, _mm_load_si128( reinterpret_cast<const __m128i*>( kDropSecondByte.entries[asciiMask] ) ) );
+		}
+
+		/** @brief True when all 8 UTF-16 lanes are below U+0800 */
+		inline bool fitsTwoBytes( __m128i units ) noexcept
+		{
+			return _mm_movemask_epi8( _mm_cmpeq_epi16( _mm_and_si128( units, _mm_set1_epi16( static_cast<short>( 0xF800 ) ) ), _mm_setzero_si128() ) ) == 0xFFFF;
+		}
+
+		/** @brief One decoding step: pattern index (or kNoDecodeStep) and bytes consumed */
+		struct Utf8DecodeStep
+		{
+			std::uint8_t pattern;
+			std::uint8_t consumed;
+		};
+
+		/** @brief Patterns below this index gather six 1-2 byte sequences into 16-bit lanes */
+		inline constexpr std::uint8_t kTwoByteSteps = 64;
+		inline constexpr std::uint8_t kNoDecodeStep = 0xFF;
+
+		/** @brief Gather patterns for the next sequences, indexed by their 12-bit end-of-sequence mask */
+		struct Utf8DecodeTables
+		{
+			Utf8DecodeStep steps[4096];
+			std::uint8_t patterns[kTwoByteSteps + 81][16];
+		};
+
+		/**
+		 * @brief Build the tables used by the windowed UTF-8 decoder
+		 * @details Six 1-2 byte sequences are identified by a 6-bit length mask and land in 16-bit lanes
+		 *          as [last, lead]. Otherwise four 1-3 byte sequences are identified by their lengths
+		 *          in base 3 and land in 32-bit lanes as [last, middle, lead, 0]. Either way the
+		 *          payload bits line up for shifting.
+		 */
+		inline constexpr Utf8DecodeTables makeUtf8DecodeTables() noexcept
+		{
+			Utf8DecodeTables tables{};
+			for ( unsigned index = 0; index < kTwoByteSteps; ++index )
+			{
+				unsigned offset = 0;
+				for ( unsigned lane = 0; lane < 8; ++lane )
+				{
+					if ( lane >= 6 )
+					{
+						tables.patterns[index][2 * lane] = 0x80;
+						tables.patterns[index][2 * lane + 1] = 0x80;
+						continue;
+					}
+					const unsigned length = 1 + ( ( index >> lane ) & 1u );
+					tables.patterns[index][2 * lane] = static_cast<std::uint8_t>( offset + length - 1 );
+					tables.patterns[index][2 * lane + 1] = static_cast<std::uint8_t>( length == 2 ? offset : 0x80 );
+					offset += length;
+				}
+			}
+			for ( unsigned index = 0; index < 81; ++index )
+			{
+				auto& pattern = tables.patterns[kTwoByteSteps + index];
+				unsigned digits = index;
+				unsigned offset = 0;
+				for ( unsigned lane = 0; lane < 4; ++lane )
+				{
+					const unsigned length = digits % 3 + 1;
+					digits /= 3;
+					pattern[4 * lane] = static_cast<std::uint8_t>( offset + length - 1 );
+					pattern[4 * lane + 1] = static_cast<std::uint8_t>( length >= 2 ? offset + length - 2 : 0x80 );
+					pattern[4 * lane + 2] = static_cast<std::uint8_t>( length == 3 ? offset : 0x80 );
+					pattern[4 * lane + 3] = 0x80;
+					offset += length;
+				}
+			}
+
+			for ( unsigned mask = 0; mask < 4096; ++mask )
+			{
+				unsigned lengths[12]{};
+				unsigned sequences = 0;
+				unsigned start = 0;
+				for ( unsigned end = 0; end < 12; ++end )
+				{
+					if ( ( mask & ( 1u << end ) ) != 0 )
+					{
+						lengths[sequences++] = end - start + 1;
+						start = end + 1;
+					}
+				}
+
+				tables.steps[mask] = Utf8DecodeStep{ kNoDecodeStep, 0 };
+				if ( sequences >= 6 && lengths[0] <= 2 && lengths[1] <= 2 && lengths[2] <= 2 && lengths[3] <= 2 && lengths[4] <= 2 && lengths[5] <= 2 )
+				{
+					unsigned pattern = 0;
+					unsigned consumed = 0;
+					for ( unsigned i = 0; i < 6; ++i )
+					{
+						pattern |= ( lengths[i] - 1 ) << i;
+						consumed += lengths[i];
+					}
+					tables.steps[mask] = Utf8DecodeStep{ static_cast<std::uint8_t>( pattern ), static_cast<std::uint8_t>( consumed ) };
+				}
+				else if ( sequences >= 4 && lengths[0] <= 3 && lengths[1] <= 3 && lengths[2] <= 3 && lengths[3] <= 3 )
+				{
+					unsigned pattern = 0;
+					unsigned consumed = 0;
+					for ( unsigned i = 4; i-- > 0; )
+					{
+						pattern = pattern * 3 + lengths[i] - 1;
+						consumed += lengths[i];
+					}
+					tables.steps[mask] = Utf8DecodeStep{ static_cast<std::uint8_t>( kTwoByteSteps + pattern ), static_cast<std::uint8_t>( consumed ) };
+				}
+			}
+			return tables;
+		}
+
+		/**
+		 * @brief Compaction of four 32-bit lanes holding 1-3 UTF-8 bytes each
+		 * @details Bit i of the mask flags lane i as at least two bytes, bit i + 4 as three bytes.
+		 */
+		inline constexpr ShuffleTable makeUtf8EncodeTable() noexcept
+		{
+			ShuffleTable table{};
+			for ( unsigned mask = 0; mask < 256; ++mask )
+			{
+				unsigned out = 0;
+				for ( unsigned lane = 0; lane < 4; ++lane )
+				{
+					const unsigned length = 1 + ( ( mask >> lane ) & 1u ) + ( ( mask >> ( lane + 4 ) ) & 1u );
+					for ( unsigned byte = 0; byte < length; ++byte )
+					{
+						table.entries[mask][out++] = static_cast<std::uint8_t>( 4 * lane + byte );
+					}
+				}
+				while ( out < 16 )
+				{
+					table.entries[mask][out++] = 0x80;
+				}
+			}
+			return table;
+		}
+
+		alignas( 16 ) inline constexpr Utf8DecodeTables kUtf8Decode{ makeUtf8DecodeTables() };
+		alignas( 16 ) inline constexpr ShuffleTable kUtf8Encode{ makeUtf8EncodeTable() };
+
+		/**
+		 * @brief Encode four codepoints below U+10000 as UTF-8
+		 * @param codepoints One codepoint per 32-bit lane; surrogates are not allowed
+		 * @param output Destination with 16 writable bytes
+		 * @return Number of bytes produced (4-12)
+		 */
+		inline std::size_t utf8EncodeThreeByteBlock( __m128i codepoints, char* output ) noexcept
+		{
+			const __m128i twoBytes = _mm_cmpgt_epi32( codepoints, _mm_set1_epi32( 0x7F ) );
+			const __m128i threeBytes = _mm_cmpgt_epi32( codepoints, _mm_set1_epi32( 0x7FF ) );
+
+			// Lanes laid out as [lead, second, third, unused]
+			const __m128i last = _mm_or_si128( _mm_and_si128( codepoints, _mm_set1_epi32( 0x3F ) ), _mm_set1_epi32( 0x80 ) );
+			const __m128i middle = _mm_or_si128( _mm_and_si128( _mm_srli_epi32( codepoints, 6 ), _mm_set1_epi32( 0x3F ) ), _mm_set1_epi32( 0x80 ) );
+			const __m128i three = _mm_or_si128( _mm_or_si128( _mm_srli_epi32( codepoints, 12 ), _mm_set1_epi32( 0xE0 ) ),
+				_mm_or_si128( _mm_slli_epi32( middle, 8 ), _mm_slli_epi32( last, 16 ) ) );
+			const __m128i two = _mm_or_si128( _mm_or_si128( _mm_srli_epi32( codepoints, 6 ), _mm_set1_epi32( 0xC0 ) ), _mm_slli_epi32( last, 8 ) );
+			const __m128i upToTwo = _mm_or_si128( _mm_and_si128( twoBytes, two ), _mm_andnot_si128( twoBytes, codepoints ) );
+			const __m128i lanes = _mm_or_si128( _mm_and_si128( threeBytes, three ), _mm_andnot_si128( threeBytes, upToTwo ) );
+
+			const unsigned mask = static_cast<unsigned>( _mm_movemask_ps( _mm_castsi128_ps( twoBytes ) ) ) |
+								  ( static_cast<unsigned>( _mm_movemask_ps( _mm_castsi128_ps( threeBytes ) ) ) << 4 );
+			_mm_storeu_si128( reinterpret_cast<__m128i*>( output ),
+				_mm_shuffle_epi8( lanes, _mm_load_si128( reinterpret_cast<const __m128i*>( kUtf8Encode.entries[mask] ) ) ) );
+			return 4 + static_cast<std::size_t>( std::popcount( mask ) );
+		}
+
+		/** @brief True when no UTF-16 lane is a surrogate */
+		inline bool hasNoSurrogates( __m128i units ) noexcept
+		{
+			return _mm_movemask_epi8( _mm_cmpeq_epi16( _mm_and_si128( units, _mm_set1_epi16( static_cast<short>( 0xF800 ) ) ), _mm_set1_epi16( static_cast<short>( 0xD800 ) ) ) ) == 0;
+		}
+
+		/** @brief True when all four UTF-32 lanes are below U+10000 and none is a surrogate */
+		inline bool isBmpBlock( __m128i codepoints ) noexcept
+		{
+			const __m128i bmp = _mm_cmpeq_epi32( _mm_and_si128( codepoints, _mm_set1_epi32( static_cast<int>( 0xFFFF0000u ) ) ), _mm_setzero_si128() );
+			const __m128i surrogate = _mm_cmpeq_epi32( _mm_and_si128( codepoints, _mm_set1_epi32( 0xF800 ) ), _mm_set1_epi32( 0xD800 ) );
+			return _mm_movemask_epi8( _mm_andnot_si128( surrogate, bmp ) ) == 0xFFFF;
+		}
+#endif
+
+		//----------------------------
+		// Transcoding loops
+		//----------------------------
+
+		/**
+		 * @brief Run a UTF-8 decoding loop after a vector validation pass
+		 * @details Converts the well-formed prefix so written reflects the output up to the first error.
+		 */
+		template <typename Convert>
+		inline bool validateThenConvert( std::string_view input, std::size_t& written, Convert&& convert ) noexcept
+		{
+			const std::size_t error = utf8FindError( input );
+			const bool converted = convert( input.substr( 0, error ), written );
+			return converted && error == std::string_view::npos;
+		}
+
+		template <bool Validate>
+		inline bool utf16ToUtf8( std::u16string_view input, std::span<char> output, std::size_t& written ) noexcept
+		{
+			const char16_t* const in = input.data();
+			const std::size_t size = input.size();
+			char* const out = output.data();
+			const std::size_t capacity = output.size();
+
+			std::size_t pos = 0;
+			std::size_t count = 0;
+
+			while ( pos < size )
+			{
+#if defined( NFX_STRINGUTILS_HAS_SSE2 )
+				if ( pos + 8 <= size && count + 16 <= capacity )
+				{
+					const __m128i units = _mm_loadu_si128( reinterpret_cast<const __m128i*>( in + pos ) );
+					if ( _mm_movemask_epi8( _mm_cmpeq_epi16( _mm_and_si128( units, _mm_set1_epi16( static_cast<short>( 0xFF80 ) ) ), _mm_setzero_si128() ) ) == 0xFFFF )
+					{
+						_mm_storel_epi64( reinterpret_cast<__m128i*>( out + count ), _mm_packus_epi16( units, units ) );
+						pos += 8;
+						count += 8;
+						continue;
+					}
+#	if defined( NFX_STRINGUTILS_HAS_SSSE3 )
+					if ( fitsTwoBytes( units ) )
+					{
+						std::size_t produced = 0;
+						_mm_storeu_si128( reinterpret_cast<__m128i*>( out + count ), utf16TwoByteBlock( units, produced ) );
+						pos += 8;
+						count += produced;
+						continue;
+					}
+					if ( count + 32 <= capacity && hasNoSurrogates( units ) )
+					{
+						const std::size_t low = utf8EncodeThreeByteBlock( _mm_unpacklo_epi16( units, _mm_setzero_si128() ), out + count );
+						const std::size_t high = utf8EncodeThreeByteBlock( _mm_unpackhi_epi16( units, _mm_setzero_si128() ), out + count + low );
+						pos += 8;
+						count += low + high;
+						continue;
+					}
+#	endif
+				}
+#endif
+				const std::size_t stop = std::min( size, pos + 8 );
+				do
+				{
+					char32_t codepoint;
+					const std::size_t length = utf16DecodeOne<Validate>( in + pos, size - pos, codepoint );
+					if ( length == 0 || count + utf8EncodedLength( codepoint ) > capacity )
+					{
+						written = count;
+						return false;
+					}
+					count += utf8EncodeOne( codepoint, out + count );
+					pos += length;
+				} while ( pos < stop );
+			}
+
+			written = count;
+			return true;
+		}
+
+		/** @brief Store one codepoint as UTF-16 or UTF-32, returning the number of units */
+		template <typename Char>
+		inline std::size_t storeCodepoint( char32_t codepoint, Char* output ) noexcept
+		{
+			if constexpr ( sizeof( Char ) == 2 )
+			{
+				if ( codepoint >= 0x10000u )
+				{
+					codepoint -= 0x10000u;
+					output[0] = static_cast<char16_t>( 0xD800u + ( codepoint >> 10 ) );
+					output[1] = static_cast<char16_t>( 0xDC00u + ( codepoint & 0x3FFu ) );
+					return 2;
+				}
+			}
+			output[0] = static_cast<Char>( codepoint );
+			return 1;
+		}
+
+#if defined( NFX_STRINGUTILS_HAS_SSE2 )
+		/** @brief Widen 16 ASCII bytes to UTF-16 or UTF-32 */
+		template <typename Char>
+		inline void storeAscii( __m128i bytes, Char* output ) noexcept
+		{
+			const __m128i low = _mm_unpacklo_epi8( bytes, _mm_setzero_si128() );
+			const __m128i high = _mm_unpackhi_epi8( bytes, _mm_setzero_si128() );
+			if constexpr ( sizeof( Char ) == 2 )
+			{
+				_mm_storeu_si128( reinterpret_cast<__m128i*>( output ), low );
+				_mm_storeu_si128( reinterpret_cast<__m128i*>( output + 8 ), high );
+			}
+			else
+			{
+				_mm_storeu_si128( reinterpret_cast<__m128i*>( output ), _mm_unpacklo_epi16( low, _mm_setzero_si128() ) );
+				_mm_storeu_si128( reinterpret_cast<__m128i*>( output + 4 ), _mm_unpackhi_epi16( low, _mm_setzero_si128() ) );
+				_mm_storeu_si128( reinterpret_cast<__m128i*>( output + 8 ), _mm_unpacklo_epi16( high, _mm_setzero_si128() ) );
+				_mm_storeu_si128( reinterpret_cast<__m128i*>( output + 12 ), _mm_unpackhi_epi16( high, _mm_setzero_si128() ) );
+			}
+		}
+#endif
+
+		/**
+		 * @brief UTF-8 to UTF-16 or UTF-32 over input that is already known to be well-formed
+		 * @return False only if output is too small (or the input ends in a truncated sequence)
+		 * @details With SSSE3, each 64-byte window is classified once into a mask of sequence ends.
+		 *          Every step then decodes six 1-2 byte or four 1-3 byte sequences from a table
+		 *          lookup on that mask, so the loop-carried dependency is a shift and a load.
+		 */
+		template <typename Char>
+		inline bool utf8Decode( std::string_view input, std::span<Char> output, std::size_t& written ) noexcept
+		{
+			const char* const in = input.data();
+			const std::size_t size = input.size();
+			Char* const out = output.data();
+			const std::size_t capacity = output.size();
+
+			std::size_t pos = 0;
+			std::size_t count = 0;
+
+			while ( pos < size )
+			{
+#if defined( NFX_STRINGUTILS_HAS_SSE2 )
+				if ( pos + 64 <= size && count + 64 <= capacity )
+				{
+					std::uint64_t high = 0;
+					std::uint64_t continuations = 0;
+					for ( unsigned block = 0; block < 4; ++block )
+					{
+						const __m128i bytes = _mm_loadu_si128( reinterpret_cast<const __m128i*>( in + pos + 16 * block ) );
+						high |= static_cast<std::uint64_t>( static_cast<unsigned>( _mm_movemask_epi8( bytes ) ) ) << ( 16 * block );
+						continuations |= static_cast<std::uint64_t>( static_cast<unsigned>( _mm_movemask_epi8( _mm_cmplt_epi8( bytes, _mm_set1_epi8( -64 ) ) ) ) ) << ( 16 * block );
+					}
+					if ( high == 0 )
+					{
+						for ( unsigned block = 0; block < 4; ++block )
+						{
+							storeAscii( _mm_loadu_si128( reinterpret_cast<const __m128i*>( in + pos + 16 * block ) ), out + count + 16 * block );
+						}
+						pos += 64;
+						count += 64;
+						continue;
+					}
+#	if defined( NFX_STRINGUTILS_HAS_SSSE3 )
+					// Bit i is set when byte i ends a sequence
+					const std::uint64_t ends = ~continuations >> 1;
+					std::size_t offset = 0;
+					while ( offset <= 48 )
+					{
+						const char* const block = in + pos + offset;
+						const __m128i bytes = _mm_loadu_si128( reinterpret_cast<const __m128i*>( block ) );
+						if ( ( ( high >> offset ) & 0xFFFFu ) == 0 )
+						{
+							storeAscii( bytes, out + count );
+							offset += 16;
+							count += 16;
+							continue;
+						}
+
+						const Utf8DecodeStep step = kUtf8Decode.steps[( ends >> offset ) & 0xFFFu];
+						if ( step.pattern == kNoDecodeStep )
+						{
+							char32_t codepoint;
+							offset += utf8DecodeOne( block, 16, codepoint );
+							count += storeCodepoint( codepoint, out + count );
+							continue;
+						}
+
+						const __m128i gathered = _mm_shuffle_epi8( bytes, _mm_load_si128( reinterpret_cast<const __m128i*>( kUtf8Decode.patterns[step.pattern] ) ) );
+						if ( step.pattern < kTwoByteSteps )
+						{
+							const __m128i values = _mm_or_si128( _mm_and_si128( gathered, _mm_set1_epi16( 0x7F ) ),
+								_mm_and_si128( _mm_srli_epi16( gathered, 2 ), _mm_set1_epi16( 0x7C0 ) ) );
+							if constexpr ( sizeof( Char ) == 2 )
+							{
+								_mm_storeu_si128( reinterpret_cast<__m128i*>( out + count ), values );
+							}
+							else
+							{
+								_mm_storeu_si128( reinterpret_cast<__m128i*>( out + count ), _mm_unpacklo_epi16( values, _mm_setzero_si128() ) );
+								_mm_storeu_si128( reinterpret_cast<__m128i*>( out + count + 4 ), _mm_unpackhi_epi16( values, _mm_setzero_si128() ) );
+							}
+							count += 6;
+						}
+						else
+						{
+							const __m128i values = _mm_or_si128( _mm_and_si128( gathered, _mm_set1_epi32( 0x7F ) ),
+								_mm_or_si128( _mm_and_si128( _mm_srli_epi32( gathered, 2 ), _mm_set1_epi32( 0xFC0 ) ),
+									_mm_and_si128( _mm_srli_epi32( gathered, 4 ), _mm_set1_epi32( 0xF000 ) ) ) );
+							if constexpr ( sizeof( Char ) == 2 )
+							{
+								const __m128i narrow = _mm_setr_epi8( 0, 1, 4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1 );
+								_mm_storeu_si128( reinterpret_cast<__m128i*>( out + count ), _mm_shuffle_epi8( values, narrow ) );
+							}
+							else
+							{
+								_mm_storeu_si128( reinterpret_cast<__m128i*>( out + count ), values );
+							}
+							count += 4;
+						}
+						offset += step.consumed;
+					}
+					pos += offset;
+					continue;
+#	endif
+				}
+#endif
+				const std::size_t stop = std::min( size, pos + 16 );
+				do
+				{
+					char32_t codepoint;
+					const std::size_t length = utf8DecodeOne( in + pos, size - pos, codepoint );
+					const std::size_t units = sizeof( Char ) == 2 && codepoint >= 0x10000u ? 2 : 1;
+					if ( length == 0 || count + units > capacity )
+					{
+						written = count;
+						return false;
+					}
+					count += storeCodepoint( codepoint, out + count );
+					pos += length;
+				} while ( pos < stop );
+			}
+
+			written = count;
+			return true;
+		}
+
+		template <bool Validate>
+		inline bool utf32ToUtf8( std::u32string_view input, std::span<char> output, std::size_t& written ) noexcept
+		{
+			const char32_t* const in = input.data();
+			const std::size_t size = input.size();
+			char* const out = output.data();
+			const std::size_t capacity = output.size();
+
+			std::size_t pos = 0;
+			std::size_t count = 0;
+
+			while ( pos < size )
+			{
+#if defined( NFX_STRINGUTILS_HAS_SSE2 )
+				if ( pos + 8 <= size && count + 16 <= capacity )
+				{
+					const __m128i first = _mm_loadu_si128( reinterpret_cast<const __m128i*>( in + pos ) );
+					const __m128i second = _mm_loadu_si128( reinterpret_cast<const __m128i*>( in + pos + 4 ) );
+					const __m128i wide = _mm_or_si128( first, second );
+					// Any bit at or above 0x800 rules out the fast paths
+					if ( _mm_movemask_epi8( _mm_cmpeq_epi32( _mm_and_si128( wide, _mm_set1_epi32( ~0x7FF ) ), _mm_setzero_si128() ) ) == 0xFFFF )
+					{
+						const __m128i units = _mm_packs_epi32( first, second );
+						if ( _mm_movemask_epi8( _mm_cmpeq_epi32( _mm_and_si128( wide, _mm_set1_epi32( ~0x7F ) ), _mm_setzero_si128() ) ) == 0xFFFF )
+						{
+							_mm_storel_epi64( reinterpret_cast<__m128i*>( out + count ), _mm_packus_epi16( units, units ) );
+							pos += 8;
+							count += 8;
+							continue;
+						}
+#	if defined( NFX_STRINGUTILS_HAS_SSSE3 )
+						std::size_t produced = 0;
+						_mm_storeu_si128( reinterpret_cast<__m128i*>( out + count ), utf16TwoByteBlock( units, produced ) );
+						pos += 8;
+						count += produced;
+						continue;
+#	endif
+					}
+#	if defined( NFX_STRINGUTILS_HAS_SSSE3 )
+					if ( count + 32 <= capacity && isBmpBlock( first ) && isBmpBlock( second ) )
+					{
+						const std::size_t low = utf8EncodeThreeByteBlock( first, out + count );
+						const std::size_t high = utf8EncodeThreeByteBlock( second, out + count + low );
+						pos += 8;
+						count += low + high;
+						continue;
+					}
+#	endif
+				}
+#endif
+				const std::size_t stop = std::min( size, pos + 8 );
+				do
+				{
+					const char32_t codepoint = in[pos];
+					if constexpr ( Validate )
+					{
+						if ( !isUnicodeScalar( codepoint ) )
+						{
+							written = count;
+							return false;
+						}
+					}
+					if ( count + utf8EncodedLength( codepoint ) > capacity )
+					{
+						written = count;
+						return false;
+					}
+					count += utf8EncodeOne( codepoint, out + count );
+					++pos;
+				} while ( pos < stop );
+			}
+
+			written = count;
+			return true;
+		}
+
+		inline std::size_t latin1ToUtf8( std::string_view input, std::span<char> output ) noexcept
+		{
+			const char* const in = input.data();
+			const std::size_t size = input.size();
+			char* const out = output.data();
+			const std::size_t capacity = output.size();
+
+			std::size_t pos = 0;
+			std::size_t count = 0;
+
+			while ( pos < size )
+			{
+#if defined( NFX_STRINGUTILS_HAS_SSE2 )
+				if ( pos + 16 <= size && count + 16 <= capacity )
+				{
+					const __m128i bytes = _mm_loadu_si128( reinterpret_cast<const __m128i*>( in + pos ) );
+					if ( _mm_movemask_epi8( bytes ) == 0 )
+					{
+						_mm_storeu_si128( reinterpret_cast<__m128i*>( out + count ), bytes );
+						pos += 16;
+						count += 16;
+						continue;
+					}
+#	if defined( NFX_STRINGUTILS_HAS_SSSE3 )
+					std::size_t produced = 0;
+					_mm_storeu_si128( reinterpret_cast<__m128i*>( out + count ), utf16TwoByteBlock( _mm_unpacklo_epi8( bytes, _mm_setzero_si128() ), produced ) );
+					pos += 8;
+					count += produced;
+					continue;
+#	endif
+				}
+#endif
+				const std::size_t stop = std::min( size, pos + 8 );
+				do
+				{
+					const auto byte = static_cast<unsigned char>( in[pos] );
+					if ( count + ( byte < 0x80u ? 1 : 2 ) > capacity )
+					{
+						return count;
+					}
+					count += utf8EncodeOne( byte, out + count );
+					++pos;
+				} while ( pos < stop );
+			}
+
+			return count;
+		}
+
+		/**
+		 * @brief UTF-8 to Latin-1 over input that is already known to be well-formed
+		 * @tparam Validate Reject codepoints above U+00FF when true
+		 */
+		template <bool Validate>
+		inline bool utf8ToLatin1( std::string_view input, std::span<char> output, std::size_t& written ) noexcept
+		{
+			const char* const in = input.data();
+			const std::size_t size = input.size();
+			char* const out = output.data();
+			const std::size_t capacity = output.size();
+
+			std::size_t pos = 0;
+			std::size_t count = 0;
+
+			while ( pos < size )
+			{
+#if defined( NFX_STRINGUTILS_HAS_SSE2 )
+				if ( pos + 16 <= size && count + 16 <= capacity )
+				{
+					const __m128i bytes = _mm_loadu_si128( reinterpret_cast<const __m128i*>( in + pos ) );
+					if ( _mm_movemask_epi8( bytes ) == 0 )
+					{
+						_mm_storeu_si128( reinterpret_cast<__m128i*>( out + count ), bytes );
+						pos += 16;
+						count += 16;
+						continue;
+					}
+#	if defined( NFX_STRINGUTILS_HAS_SSSE3 )
+					__m128i values;
+					std::size_t consumed = 0;
+					std::size_t produced = 0;
+					if ( utf8TwoByteBlock( in + pos, values, consumed, produced ) &&
+						 _mm_movemask_epi8( _mm_cmpeq_epi16( _mm_srli_epi16( values, 8 ), _mm_setzero_si128() ) ) == 0xFFFF )
+					{
+						_mm_storel_epi64( reinterpret_cast<__m128i*>( out + count ), _mm_packus_epi16( values, values ) );
+						pos += consumed;
+						count += produced;
+						continue;
+					}
+#	endif
+				}
+#endif
+				const std::size_t stop = std::min( size, pos + 8 );
+				do
+				{
+					char32_t codepoint;
+					const std::size_t length = utf8DecodeOne( in + pos, size - pos, codepoint );
+					if ( length == 0 || count >= capacity || ( Validate && codepoint > 0xFFu ) )
+					{
+						written = count;
+						return false;
+					}
+					out[count++] = static_cast<char>( codepoint );
+					pos += length;
+				} while ( pos < stop );
+			}
+
+			written = count;
+			return true;
+		}
+	} // namespace detail
+
+	//=====================================================================
+	// UTF-8 utilities
+	//=====================================================================
+
+	//----------------------------------------------
+	// Validation
+	//----------------------------------------------
+
+	inline bool utf8Valid( std::string_view str ) noexcept
+	{
+		return detail::utf8FindError( str ) == std::string_view::npos;
+	}
+
+	inline bool utf8Valid( std::string_view str, std::size_t& errorOffset ) noexcept
+	{
+		errorOffset = detail::utf8FindError( str );
+		return errorOffset == std::string_view::npos;
+	}
+
+	//----------------------------------------------
+	// Codepoint counting
+	//----------------------------------------------
+
+	inline std::size_t utf8Length( std::string_view str ) noexcept
+	{
+		const char* const data = str.data();
+		const std::size_t size = str.size();
+
+		std::size_t continuations = 0;
+		std::size_t pos = 0;
+
+		// Continuation bytes are exactly those below -64 as signed chars. Matches are accumulated
+		// per byte lane (at most 255 blocks) and summed horizontally with SAD against zero.
+#if defined( NFX_STRINGUTILS_HAS_AVX2 )
+		const __m256i threshold = _mm256_set1_epi8( -64 );
+		while ( pos + 32 <= size )
+		{
+			const std::size_t blocks = std::min<std::size_t>( ( size - pos ) / 32, 255 );
+			__m256i counts = _mm256_setzero_si256();
+			for ( std::size_t i = 0; i < blocks; ++i, pos += 32 )
+			{
+				counts = _mm256_sub_epi8( counts, _mm256_cmpgt_epi8( threshold, detail::simd::Avx2::load( data + pos ) ) );
+			}
+			const __m256i sums = _mm256_sad_epu8( counts, _mm256_setzero_si256() );
+			const __m128i halves = _mm_add_epi64( _mm256_castsi256_si128( sums ), _mm256_extracti128_si256( sums, 1 ) );
+			continuations += static_cast<std::size_t>( _mm_cvtsi128_si32( halves ) ) +
+							 static_cast<std::size_t>( _mm_cvtsi128_si32( _mm_srli_si128( halves, 8 ) ) );
+		}
+#endif
+
+#if defined( NFX_STRINGUTILS_HAS_SSE2 )
+		const __m128i threshold128 = _mm_set1_epi8( -64 );
+		while ( pos + 16 <= size )
+		{
+			const std::size_t blocks = std::min<std::size_t>( ( size - pos ) / 16, 255 );
+			__m128i counts = _mm_setzero_si128();
+			for ( std::size_t i = 0; i < blocks; ++i, pos += 16 )
+			{
+				counts = _mm_sub_epi8( counts, _mm_cmplt_epi8( _mm_loadu_si128( reinterpret_cast<const __m128i*>( data + pos ) ), threshold128 ) );
+			}
+			const __m128i sums = _mm_sad_epu8( counts, _mm_setzero_si128() );
+			continuations += static_cast<std::size_t>( _mm_cvtsi128_si32( sums ) ) +
+							 static_cast<std::size_t>( _mm_cvtsi128_si32( _mm_srli_si128( sums, 8 ) ) );
+		}
+#endif
+
+		for ( ; pos + 8 <= size; pos += 8 )
+		{
+			// 10xxxxxx: high bit set and bit 6 clear
+			const std::uint64_t word = detail::simd::loadU64( data + pos );
+			continuations += static_cast<std::size_t>( std::popcount( word & ~( word << 1 ) & detail::simd::kHighBits ) );
+		}
+
+		for ( ; pos < size; ++pos )
+		{
+			continuations += detail::isUtf8Continuation( static_cast<unsigned char>( data[pos] ) ) ? 1 : 0;
+		}
+
+		return size - continuations;
+	}
+
+	//----------------------------------------------
+	// Output size prediction
+	//----------------------------------------------
+
+	inline std::size_t utf16LengthFromUtf8( std::string_view utf8 ) noexcept
+	{
+		// Every 4-byte lead (F0-F7) adds the second unit of a surrogate pair
+		std::size_t fourByteLeads = 0;
+		std::size_t pos = 0;
+		for ( ; pos + 8 <= utf8.size(); pos += 8 )
+		{
+			const std::uint64_t word = detail::simd::loadU64( utf8.data() + pos );
+			fourByteLeads += static_cast<std::size_t>( std::popcount( word & ( word << 1 ) & ( word << 2 ) & ( word << 3 ) & detail::simd::kHighBits ) );
+		}
+		for ( ; pos < utf8.size(); ++pos )
+		{
+			fourByteLeads += static_cast<unsigned char>( utf8[pos] ) >= 0xF0u ? 1 : 0;
+		}
+
+		return utf8Length( utf8 ) + fourByteLeads;
+	}
+
+	inline std::size_t utf8LengthFromUtf16( std::u16string_view utf16 ) noexcept
+	{
+		std::size_t length = 0;
+		for ( const char16_t unit : utf16 )
+		{
+			// Each half of a surrogate pair contributes 2 of the 4 bytes
+			const bool surrogate = unit >= 0xD800u && unit <= 0xDFFFu;
+			length += 1 + ( unit >= 0x80u ) + ( unit >= 0x800u ) - surrogate;
+		}
+		return length;
+	}
+
+	inline std::size_t utf8LengthFromUtf32( std::u32string_view utf32 ) noexcept
+	{
+		std::size_t length = 0;
+		for ( const char32_t codepoint : utf32 )
+		{
+			length += 1 + ( codepoint >= 0x80u ) + ( codepoint >= 0x800u ) + ( codepoint >= 0x10000u );
+		}
+		return length;
+	}
+
+	inline std::size_t utf8LengthFromLatin1( std::string_view latin1 ) noexcept
+	{
+		std::size_t high = 0;
+		std::size_t pos = 0;
+		for ( ; pos + 8 <= latin1.size(); pos += 8 )
+		{
+			high += static_cast<std::size_t>( std::popcount( detail::simd::loadU64( latin1.data() + pos ) & detail::simd::kHighBits ) );
+		}
+		for ( ; pos < latin1.size(); ++pos )
+		{
+			high += static_cast<unsigned char>( latin1[pos] ) >= 0x80u ? 1 : 0;
+		}
+		return latin1.size() + high;
+	}
+
+	//----------------------------------------------
+	// Transcoding
+	//----------------------------------------------
+
+	//-----------------------------
+	// UTF-8 to UTF-16
+	//-----------------------------
+
+	inline bool tryUtf8ToUtf16( std::string_view utf8, std::span<char16_t> output, std::size_t& written ) noexcept
+	{
+		return detail::validateThenConvert( utf8, written,
+			[output]( std::string_view valid, std::size_t& count ) noexcept { return detail::utf8Decode( valid, output, count ); } );
+	}
+
+	inline bool tryUtf8ToUtf16( std::string_view utf8, std::u16string& result )
+	{
+		result.resize( utf16LengthFromUtf8( utf8 ) );
+		std::size_t written = 0;
+		const bool success = tryUtf8ToUtf16( utf8, std::span<char16_t>{ result }, written );
+		result.resize( written );
+		return success;
+	}
+
+	inline std::size_t utf8ToUtf16Unchecked( std::string_view utf8, std::span<char16_t> output ) noexcept
+	{
+		std::size_t written = 0;
+		static_cast<void>( detail::utf8Decode( utf8, output, written ) );
+		return written;
+	}
+
+	//-----------------------------
+	// UTF-16 to UTF-8
+	//-----------------------------
+
+	inline bool tryUtf16ToUtf8( std::u16string_view utf16, std::span<char> output, std::size_t& written ) noexcept
+	{
+		return detail::utf16ToUtf8<true>( utf16, output, written );
+	}
+
+	inline bool tryUtf16ToUtf8( std::u16string_view utf16, std::string& result )
+	{
+		result.resize( utf8LengthFromUtf16( utf16 ) );
+		std::size_t written = 0;
+		const bool success = detail::utf16ToUtf8<true>( utf16, result, written );
+		result.resize( written );
+		return success;
+	}
+
+	inline std::size_t utf16ToUtf8Unchecked( std::u16string_view utf16, std::span<char> output ) noexcept
+	{
+		std::size_t written = 0;
+		static_cast<void>( detail::utf16ToUtf8<false>( utf16, output, written ) );
+		return written;
+	}
+
+	//-----------------------------
+	// UTF-8 to UTF-32
+	//-----------------------------
+
+	inline bool tryUtf8ToUtf32( std::string_view utf8, std::span<char32_t> output, std::size_t& written ) noexcept
+	{
+		return detail::validateThenConvert( utf8, written,
+			[output]( std::string_view valid, std::size_t& count ) noexcept { return detail::utf8Decode( valid, output, count ); } );
+	}
+
+	inline bool tryUtf8ToUtf32( std::string_view utf8, std::u32string& result )
+	{
+		result.resize( utf8Length( utf8 ) );
+		std::size_t written = 0;
+		const bool success = tryUtf8ToUtf32( utf8, std::span<char32_t>{ result }, written );
+		result.resize( written );
+		return success;
+	}
+
+	inline std::size_t utf8ToUtf32Unchecked( std::string_view utf8, std::span<char32_t> output ) noexcept
+	{
+		std::size_t written = 0;
+		static_cast<void>( detail::utf8Decode( utf8, output, written ) );
+		return written;
+	}
+
+	//-----------------------------
+	// UTF-32 to UTF-8
+	//-----------------------------
+
+	inline bool tryUtf32ToUtf8( std::u32string_view utf32, std::span<char> output, std::size_t& written ) noexcept
+	{
+		return detail::utf32ToUtf8<true>( utf32, output, written );
+	}
+
+	inline bool tryUtf32ToUtf8( std::u32string_view utf32, std::string& result )
+	{
+		result.resize( utf8LengthFromUtf32( utf32 ) );
+		std::size_t written = 0;
+		const bool success = detail::utf32ToUtf8<true>( utf32, result, written );
+		result.resize( written );
+		return success;
+	}
+
+	inline std::size_t utf32ToUtf8Unchecked( std::u32string_view utf32, std::span<char> output ) noexcept
+	{
+		std::size_t written = 0;
+		static_cast<void>( detail::utf32ToUtf8<false>( utf32, output, written ) );
+		return written;
+	}
+
+	//-----------------------------
+	// Latin-1
+	//-----------------------------
+
+	inline std::size_t latin1ToUtf8( std::string_view latin1, std::span<char> output ) noexcept
+	{
+		return detail::latin1ToUtf8( latin1, output );
+	}
+
+	inline std::string latin1ToUtf8( std::string_view latin1 )
+	{
+		std::string result( utf8LengthFromLatin1( latin1 ), '\0' );
+		static_cast<void>( detail::latin1ToUtf8( latin1, result ) );
+		return result;
+	}
+
+	inline bool tryUtf8ToLatin1( std::string_view utf8, std::span<char> output, std::size_t& written ) noexcept
+	{
+		return detail::validateThenConvert( utf8, written,
+			[output]( std::string_view valid, std::size_t& count ) noexcept { return detail::utf8ToLatin1<true>( valid, output, count ); } );
+	}
+
+	inline bool tryUtf8ToLatin1( std::string_view utf8, std::string& result )
+	{
+		result.resize( utf8Length( utf8 ) );
+		std::size_t written = 0;
+		const bool success = tryUtf8ToLatin1( utf8, std::span<char>{ result }, written );
+		result.resize( written );
+		return success;
+	}
+
+	inline std::size_t utf8ToLatin1Unchecked( std::string_view utf8, std::span<char> output ) noexcept
+	{
+		std::size_t written = 0;
+		static_cast<void>( detail::utf8ToLatin1<false>( utf8, output, written ) );
+		return written;
+	}
+} // namespace nfx::string
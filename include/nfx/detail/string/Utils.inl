@@ -33,9 +33,290 @@
 #include <cctype>
 #include <cmath>
 #include <charconv>
+#include <cstring>
+#include <type_traits>
+
+#include "nfx/detail/string/Simd.h"
+#include "nfx/string/Instrumentation.h"
 
 namespace nfx::string
 {
+	namespace detail
+	{
+		//=====================================================================
+		// Substring counting internals
+		//=====================================================================
+
+		/** @brief Longest pattern whose failure table is kept on the stack */
+		inline constexpr std::size_t kCountStackPatternSize{ 256 };
+
+		/**
+		 * @brief Knuth-Morris-Pratt count of a pattern of any length
+		 * @param str String to search in
+		 * @param pattern Non-empty pattern
+		 * @param overlapping Resume after each hit at the pattern's longest border instead of past it
+		 * @param failure Table of pattern.size() entries to fill
+		 * @return Number of occurrences
+		 * @details Linear in str.size() whatever the input, where a find() loop restarting one byte
+		 *          after each hit is quadratic on periodic text. While nothing is matched, the next
+		 *          candidate is located with memchr().
+		 */
+		inline std::size_t countKmp( std::string_view str, std::string_view pattern, bool overlapping, std::uint32_t* failure ) noexcept
+		{
+			// failure[i]: length of the longest proper prefix of pattern[0..i] that is also its suffix
+			const std::size_t length = pattern.size();
+			failure[0] = 0;
+			for ( std::size_t i = 1, border = 0; i < length; ++i )
+			{
+				while ( border > 0 && pattern[i] != pattern[border] )
+				{
+					border = failure[border - 1];
+				}
+				if ( pattern[i] == pattern[border] )
+				{
+					++border;
+				}
+				failure[i] = static_cast<std::uint32_t>( border );
+			}
+
+			const char* const data = str.data();
+			const std::size_t size = str.size();
+			std::size_t occurrences = 0;
+			std::size_t matched = 0;
+			for ( std::size_t pos = 0; pos < size; ++pos )
+			{
+				if ( matched == 0 )
+				{
+					const void* const next = std::memchr( data + pos, pattern[0], size - pos );
+					if ( next == nullptr )
+					{
+						break;
+					}
+					pos = static_cast<std::size_t>( static_cast<const char*>( next ) - data );
+				}
+
+				while ( matched > 0 && data[pos] != pattern[matched] )
+				{
+					matched = failure[matched - 1];
+				}
+				if ( data[pos] == pattern[matched] && ++matched == length )
+				{
+					++occurrences;
+					matched = overlapping ? failure[length - 1] : 0;
+				}
+			}
+
+			return occurrences;
+		}
+
+		/**
+		 * @brief Critical factorization of a pattern for the Two-Way algorithm
+		 * @param pattern Non-empty pattern
+		 * @param period Set to the period of the suffix starting at the returned position
+		 * @return Position of the critical factorization, the larger of the two maximal suffix
+		 *         starts under opposite byte orders
+		 */
+		inline std::size_t criticalFactorization( std::string_view pattern, std::size_t& period ) noexcept
+		{
+			const auto maximalSuffix = [pattern]( bool reversed, std::size_t& suffixPeriod ) noexcept {
+				// Positions wrap around from SIZE_MAX: start + k is k - 1 before the first reset
+				std::size_t start = static_cast<std::size_t>( -1 );
+				std::size_t j = 0;
+				std::size_t k = 1;
+				std::size_t p = 1;
+				while ( j + k < pattern.size() )
+				{
+					const auto a = static_cast<unsigned char>( pattern[j + k] );
+					const auto b = static_cast<unsigned char>( pattern[start + k] );
+					if ( reversed ? b < a : a < b )
+					{
+						j += k;
+						k = 1;
+						p = j - start;
+					}
+					else if ( a == b )
+					{
+						if ( k != p )
+						{
+							++k;
+						}
+						else
+						{
+							j += p;
+							k = 1;
+						}
+					}
+					else
+					{
+						start = j++;
+						k = p = 1;
+					}
+				}
+				suffixPeriod = p;
+
+				return start + 1;
+			};
+
+			std::size_t reversedPeriod = 0;
+			const std::size_t suffix = maximalSuffix( false, period );
+			const std::size_t reversedSuffix = maximalSuffix( true, reversedPeriod );
+			if ( reversedSuffix <= suffix )
+			{
+				return suffix;
+			}
+			period = reversedPeriod;
+
+			return reversedSuffix;
+		}
+
+		/**
+		 * @brief Two-Way (Crochemore-Perrin) count of a pattern of any length
+		 * @param str String to search in
+		 * @param pattern Non-empty pattern
+		 * @param overlapping Resume after each hit one period further instead of past it
+		 * @return Number of occurrences
+		 * @details Linear in str.size() with constant extra space: patterns longer than
+		 *          kCountStackPatternSize are counted without a failure table, so count() and
+		 *          countOverlapping() never allocate.
+		 */
+		inline std::size_t countTwoWay( std::string_view str, std::string_view pattern, bool overlapping ) noexcept
+		{
+			const char* const data = str.data();
+			const std::size_t length = pattern.size();
+			if ( length > str.size() )
+			{
+				return 0;
+			}
+			const std::size_t last = str.size() - length;
+
+			std::size_t period = 0;
+			const std::size_t suffix = criticalFactorization( pattern, period );
+			std::size_t occurrences = 0;
+			std::size_t pos = 0;
+
+			if ( period + suffix <= length && std::memcmp( pattern.data(), pattern.data() + period, suffix ) == 0 )
+			{
+				// Periodic pattern: remember how much of its prefix the last shift by period kept matched
+				std::size_t memory = 0;
+				while ( pos <= last )
+				{
+					std::size_t i = std::max( suffix, memory );
+					while ( i < length && pattern[i] == data[pos + i] )
+					{
+						++i;
+					}
+					if ( i < length )
+					{
+						pos += i - suffix + 1;
+						memory = 0;
+						continue;
+					}
+
+					i = suffix;
+					while ( i > memory && pattern[i - 1] == data[pos + i - 1] )
+					{
+						--i;
+					}
+					if ( i <= memory )
+					{
+						++occurrences;
+						if ( !overlapping )
+						{
+							pos += length;
+							memory = 0;
+							continue;
+						}
+					}
+					pos += period;
+					memory = length - period;
+				}
+
+				return occurrences;
+			}
+
+			// Both halves are shorter than the period: a mismatch left of the factorization shifts past the longer one
+			const std::size_t shift = std::max( suffix, length - suffix ) + 1;
+			while ( pos <= last )
+			{
+				std::size_t i = suffix;
+				while ( i < length && pattern[i] == data[pos + i] )
+				{
+					++i;
+				}
+				if ( i < length )
+				{
+					pos += i - suffix + 1;
+					continue;
+				}
+
+				i = suffix;
+				while ( i > 0 && pattern[i - 1] == data[pos + i - 1] )
+				{
+					--i;
+				}
+				if ( i == 0 )
+				{
+					++occurrences;
+					pos += overlapping ? shift : length;
+					continue;
+				}
+				pos += shift;
+			}
+
+			return occurrences;
+		}
+
+		/**
+		 * @brief Count of a non-empty pattern not longer than str
+		 * @param str String to search in
+		 * @param pattern Pattern to count
+		 * @param overlapping Count overlapping occurrences too
+		 * @return Number of occurrences
+		 * @details Single bytes are counted with countByte(), 2 to 4 byte patterns with a vector
+		 *          compare of every shift. Longer ones are filtered on their first and last byte,
+		 *          and Knuth-Morris-Pratt takes over where that degrades on periodic input, or
+		 *          Two-Way for patterns longer than kCountStackPatternSize.
+		 */
+		inline std::size_t countSubstring( std::string_view str, std::string_view pattern, bool overlapping ) noexcept
+		{
+			switch ( pattern.size() )
+			{
+				case 1:
+					return simd::countByte( str.data(), str.size(), pattern[0] );
+#if defined( NFX_STRINGUTILS_HAS_SSE2 )
+				case 2:
+					return simd::countShortPattern<2>( str.data(), str.size(), pattern.data(), overlapping );
+				case 3:
+					return simd::countShortPattern<3>( str.data(), str.size(), pattern.data(), overlapping );
+				case 4:
+					return simd::countShortPattern<4>( str.data(), str.size(), pattern.data(), overlapping );
+#endif
+				default:
+					break;
+			}
+
+			std::size_t occurrences = 0;
+#if defined( NFX_STRINGUTILS_HAS_SSE2 )
+			std::size_t pos = 0;
+			std::size_t nextStart = 0;
+			occurrences = simd::countPatternCandidates( str.data(), str.size(), pattern.data(), pattern.size(), overlapping, pos, nextStart );
+			if ( pos + pattern.size() > str.size() )
+			{
+				return occurrences;
+			}
+			str.remove_prefix( std::max( pos, nextStart ) );
+#endif
+
+			if ( pattern.size() <= kCountStackPatternSize )
+			{
+				std::uint32_t failure[kCountStackPatternSize];
+				return occurrences + countKmp( str, pattern, overlapping, failure );
+			}
+
+			return occurrences + countTwoWay( str, pattern, overlapping );
+		}
+	} // namespace detail
+
 	//=====================================================================
 	// String utilities
 	//=====================================================================
@@ -105,6 +386,112 @@ namespace nfx::string
 		return isAlpha( c ) || isDigit( c );
 	}
 
+	//----------------------------------------------
+	// CharClass class
+	//----------------------------------------------
+
+	inline constexpr CharClass::CharClass( std::string_view chars ) noexcept
+	{
+		for ( char c : chars )
+		{
+			const auto value = static_cast<unsigned char>( c );
+			m_members[value >> 6] |= std::uint64_t{ 1 } << ( value & 63 );
+		}
+		buildTables();
+	}
+
+	inline constexpr CharClass CharClass::whitespace() noexcept
+	{
+		return CharClass{ " \t\n\r\f\v" };
+	}
+
+	inline constexpr CharClass CharClass::digits() noexcept
+	{
+		return CharClass{ "0123456789" };
+	}
+
+	inline constexpr CharClass CharClass::alpha() noexcept
+	{
+		return CharClass{ "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ" };
+	}
+
+	inline constexpr CharClass CharClass::alphaNumeric() noexcept
+	{
+		return alpha() | digits();
+	}
+
+	inline constexpr bool CharClass::contains( char c ) const noexcept
+	{
+		const auto value = static_cast<unsigned char>( c );
+		return ( ( m_members[value >> 6] >> ( value & 63 ) ) & 1u ) != 0;
+	}
+
+	inline constexpr CharClass CharClass::operator|( const CharClass& other ) const noexcept
+	{
+		CharClass merged;
+		for ( std::size_t i = 0; i < 4; ++i )
+		{
+			merged.m_members[i] = m_members[i] | other.m_members[i];
+		}
+		merged.buildTables();
+		return merged;
+	}
+
+	inline constexpr void CharClass::buildTables() noexcept
+	{
+		// Row of a high nibble: the set of low nibbles that complete a member byte
+		std::uint16_t rows[16]{};
+		for ( unsigned value = 0; value < 256; ++value )
+		{
+			if ( ( ( m_members[value >> 6] >> ( value & 63 ) ) & 1u ) != 0 )
+			{
+				rows[value >> 4] = static_cast<std::uint16_t>( rows[value >> 4] | ( 1u << ( value & 15 ) ) );
+				m_lookup[value] = 1;
+				if ( m_memberCount < 8 )
+				{
+					m_bytes[m_memberCount] = static_cast<char>( value );
+				}
+				++m_memberCount;
+			}
+		}
+
+		// Equal rows share one of 8 bucket bits: a byte is a member when the bucket of its
+		// high nibble is among the buckets of its low nibble
+		std::uint16_t buckets[8]{};
+		std::size_t bucketCount = 0;
+		for ( std::size_t high = 0; high < 16; ++high )
+		{
+			if ( rows[high] == 0 )
+			{
+				continue;
+			}
+
+			std::size_t bucket = 0;
+			while ( bucket < bucketCount && buckets[bucket] != rows[high] )
+			{
+				++bucket;
+			}
+			if ( bucket == bucketCount )
+			{
+				if ( bucketCount == 8 )
+				{
+					m_vectorizable = false;
+					return;
+				}
+				buckets[bucketCount++] = rows[high];
+				for ( std::size_t low = 0; low < 16; ++low )
+				{
+					if ( ( ( rows[high] >> low ) & 1u ) != 0 )
+					{
+						m_lowNibbles[low] = static_cast<std::uint8_t>( m_lowNibbles[low] | ( 1u << bucket ) );
+					}
+				}
+			}
+			m_highNibbles[high] = static_cast<std::uint8_t>( 1u << bucket );
+		}
+		m_vectorizable = true;
+	}
+
 	//----------------------------------------------
 	// String operations
 	//----------------------------------------------
@@ -149,16 +536,7 @@ namespace nfx::string
 			return 0;
 		}
 
-		std::size_t occurrences = 0;
-		std::size_t pos = 0;
-
-		while ( ( pos = str.find( substr, pos ) ) != std::string_view::npos )
-		{
-			++occurrences;
-			pos += substr.size(); // Move past this occurrence (non-overlapping)
-		}
-
-		return occurrences;
+		return detail::countSubstring( str, substr, false );
 	}
 
 	inline std::size_t countOverlapping( std::string_view str, std::string_view substr ) noexcept
@@ -168,29 +546,88 @@ namespace nfx::string
 			return 0;
 		}
 
-		std::size_t occurrences = 0;
-		std::size_t pos = 0;
+		return detail::countSubstring( str, substr, true );
+	}
 
-		while ( ( pos = str.find( substr, pos ) ) != std::string_view::npos )
+	inline constexpr std::size_t count( std::string_view str, char ch ) noexcept
+	{
+		if ( std::is_constant_evaluated() )
 		{
-			++occurrences;
-			++pos; // Move by 1 to find overlapping occurrences
+			std::size_t occurrences = 0;
+			for ( char c : str )
+			{
+				if ( c == ch )
+				{
+					++occurrences;
+				}
+			}
+			return occurrences;
 		}
-
-		return occurrences;
+		return detail::simd::countByte( str.data(), str.size(), ch );
 	}
 
-	inline constexpr std::size_t count( std::string_view str, char ch ) noexcept
+	inline constexpr std::size_t countAny( std::string_view str, const CharClass& charClass ) noexcept
 	{
-		std::size_t occurrences = 0;
-		for ( char c : str )
+		if ( std::is_constant_evaluated() )
 		{
-			if ( c == ch )
+			std::size_t occurrences = 0;
+			for ( char c : str )
 			{
-				++occurrences;
+				occurrences += charClass.contains( c );
 			}
+			return occurrences;
+		}
+
+#if defined( NFX_STRINGUTILS_HAS_SSSE3 )
+		if ( charClass.m_vectorizable )
+		{
+			return detail::simd::countClass( str.data(), str.size(), charClass.m_lowNibbles, charClass.m_highNibbles );
+		}
+#endif
+
+		const char* const data = str.data();
+		const char* const bytes = charClass.m_bytes;
+		switch ( charClass.m_memberCount )
+		{
+			case 0:
+				return 0;
+			case 1:
+				return detail::simd::countByte( data, str.size(), bytes[0] );
+#if defined( NFX_STRINGUTILS_HAS_SSE2 )
+			case 2:
+				return detail::simd::countAnyByte<2>( data, str.size(), bytes );
+			case 3:
+				return detail::simd::countAnyByte<3>( data, str.size(), bytes );
+			case 4:
+				return detail::simd::countAnyByte<4>( data, str.size(), bytes );
+			case 5:
+				return detail::simd::countAnyByte<5>( data, str.size(), bytes );
+			case 6:
+				return detail::simd::countAnyByte<6>( data, str.size(), bytes );
+			case 7:
+				return detail::simd::countAnyByte<7>( data, str.size(), bytes );
+			case 8:
+				return detail::simd::countAnyByte<8>( data, str.size(), bytes );
+#endif
+			default:
+				break;
+		}
+
+		// Four independent sums, so consecutive table reads do not wait on one another
+		std::size_t sums[4]{};
+		std::size_t pos = 0;
+		for ( ; pos + 4 <= str.size(); pos += 4 )
+		{
+			sums[0] += charClass.m_lookup[static_cast<unsigned char>( data[pos] )];
+			sums[1] += charClass.m_lookup[static_cast<unsigned char>( data[pos + 1] )];
+			sums[2] += charClass.m_lookup[static_cast<unsigned char>( data[pos + 2] )];
+			sums[3] += charClass.m_lookup[static_cast<unsigned char>( data[pos + 3] )];
+		}
+		for ( ; pos < str.size(); ++pos )
+		{
+			sums[0] += charClass.m_lookup[static_cast<unsigned char>( data[pos] )];
 		}
-		return occurrences;
+		return sums[0] + sums[1] + sums[2] + sums[3];
 	}
 
 	inline std::string replace( std::string_view str, std::string_view oldStr, std::string_view newStr )
@@ -217,6 +654,8 @@ namespace nfx::string
 
 	inline std::string replaceAll( std::string_view str, std::string_view oldStr, std::string_view newStr )
 	{
+		NFX_STRINGUTILS_PROBE( ReplaceAll, str.size() );
+
 		if ( oldStr.empty() || str.empty() )
 		{
 			return std::string{ str };
@@ -290,6 +729,48 @@ namespace nfx::string
 		return str.rfind( substr );
 	}
 
+	inline std::string_view commonPrefix( std::string_view lhs, std::string_view rhs ) noexcept
+	{
+		return lhs.substr( 0, detail::simd::commonPrefixLength( lhs.data(), rhs.data(), std::min( lhs.size(), rhs.size() ) ) );
+	}
+
+	inline std::string_view commonSuffix( std::string_view lhs, std::string_view rhs ) noexcept
+	{
+		const std::size_t length = detail::simd::commonSuffixLength(
+			lhs.data() + lhs.size(), rhs.data() + rhs.size(), std::min( lhs.size(), rhs.size() ) );
+		return lhs.substr( lhs.size() - length );
+	}
+
+	inline std::string_view commonPrefix( std::span<const std::string_view> strings ) noexcept
+	{
+		if ( strings.empty() )
+		{
+			return {};
+		}
+
+		std::string_view prefix = strings.front();
+		for ( std::size_t i = 1; i < strings.size() && !prefix.empty(); ++i )
+		{
+			prefix = commonPrefix( prefix, strings[i] );
+		}
+		return prefix;
+	}
+
+	inline std::string_view commonSuffix( std::span<const std::string_view> strings ) noexcept
+	{
+		if ( strings.empty() )
+		{
+			return {};
+		}
+
+		std::string_view suffix = strings.front();
+		for ( std::size_t i = 1; i < strings.size() && !suffix.empty(); ++i )
+		{
+			suffix = commonSuffix( suffix, strings[i] );
+		}
+		return suffix;
+	}
+
 	//----------------------------------------------
 	// String formatting and padding
 	//----------------------------------------------
@@ -450,6 +931,8 @@ namespace nfx::string
 
 	inline bool tryParseBool( std::string_view str, bool& result ) noexcept
 	{
+		NFX_STRINGUTILS_PROBE( TryParseBool, str.size() );
+
 		if ( str.empty() )
 		{
 			result = false;
@@ -525,6 +1008,8 @@ namespace nfx::string
 
 	inline bool tryParseInt( std::string_view str, int& result ) noexcept
 	{
+		NFX_STRINGUTILS_PROBE( TryParseInt, str.size() );
+
 		if ( str.empty() )
 		{
 			result = 0;
@@ -539,6 +1024,8 @@ namespace nfx::string
 
 	inline bool tryParseUInt( std::string_view str, std::uint32_t& result ) noexcept
 	{
+		NFX_STRINGUTILS_PROBE( TryParseUInt, str.size() );
+
 		if ( str.empty() )
 		{
 			result = 0u;
@@ -553,6 +1040,8 @@ namespace nfx::string
 
 	inline bool tryParseLong( std::string_view str, std::int64_t& result ) noexcept
 	{
+		NFX_STRINGUTILS_PROBE( TryParseLong, str.size() );
+
 		if ( str.empty() )
 		{
 			result = 0LL;
@@ -567,6 +1056,8 @@ namespace nfx::string
 
 	inline bool tryParseFloat( std::string_view str, float& result ) noexcept
 	{
+		NFX_STRINGUTILS_PROBE( TryParseFloat, str.size() );
+
 		if ( str.empty() )
 		{
 			result = 0.f;
@@ -581,6 +1072,8 @@ namespace nfx::string
 
 	inline bool tryParseDouble( std::string_view str, double& result ) noexcept
 	{
+		NFX_STRINGUTILS_PROBE( TryParseDouble, str.size() );
+
 		if ( str.empty() )
 		{
 			result = 0.0;
@@ -642,6 +1135,8 @@ namespace nfx::string
 
 	inline constexpr bool isIPv4Address( std::string_view str ) noexcept
 	{
+		NFX_STRINGUTILS_PROBE( IsIPv4Address, str.size() );
+
 		if ( str.empty() || str.size() > 15 ) // Max: "255.255.255.255"
 		{
 			return false;
@@ -692,6 +1187,8 @@ namespace nfx::string
 
 	inline constexpr bool isIPv6Address( std::string_view str ) noexcept
 	{
+		NFX_STRINGUTILS_PROBE( IsIPv6Address, str.size() );
+
 		if ( str.empty() || str.size() > 45 ) // Max with zone: "[ffff:ffff:ffff:ffff:ffff:ffff:255.255.255.255%interface]"
 		{
 			return false;
@@ -784,6 +1281,8 @@ namespace nfx::string
 
 	inline constexpr bool isValidHostname( std::string_view str ) noexcept
 	{
+		NFX_STRINGUTILS_PROBE( IsValidHostname, str.size() );
+
 		// RFC 1123: max 253 chars, labels max 63 chars, alphanumeric + hyphen
 		if ( str.empty() || str.size() > 253 )
 		{
@@ -835,6 +1334,8 @@ namespace nfx::string
 
 	inline constexpr bool isDomainName( std::string_view str ) noexcept
 	{
+		NFX_STRINGUTILS_PROBE( IsDomainName, str.size() );
+
 		// Must be valid hostname AND contain at least one dot
 		if ( !isValidHostname( str ) )
 		{
@@ -859,6 +1360,8 @@ namespace nfx::string
 
 	inline constexpr bool isValidPort( std::string_view str ) noexcept
 	{
+		NFX_STRINGUTILS_PROBE( IsValidPort, str.size() );
+
 		if ( str.empty() || str.size() > 5 ) // Max: "65535"
 		{
 			return false;
@@ -895,6 +1398,8 @@ namespace nfx::string
 
 	inline bool tryParseEndpoint( std::string_view endpoint, std::string_view& host, uint16_t& port ) noexcept
 	{
+		NFX_STRINGUTILS_PROBE( TryParseEndpoint, endpoint.size() );
+
 		if ( endpoint.empty() )
 		{
 			return false;
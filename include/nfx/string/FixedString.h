@@ -0,0 +1,384 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file FixedString.h
+ * @brief Fixed-capacity string with inline storage
+ * @details FixedString<N> holds up to N characters and a null terminator inside the object,
+ *          so it never allocates and is trivially copyable. It is meant for short, bounded
+ *          fields such as hostnames, ports and codes that would otherwise allocate a
+ *          std::string once they exceed the small-string buffer. Construction, comparison
+ *          and the string operations declared here are constexpr.
+ */
+
+#pragma once
+
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string_view>
+#include <type_traits>
+
+#include "nfx/string/Utils.h"
+
+namespace nfx::string
+{
+	//=====================================================================
+	// FixedString class
+	//=====================================================================
+
+	/**
+	 * @brief String of at most N characters stored inline
+	 * @tparam N Capacity in characters, excluding the null terminator
+	 * @details The characters are always null-terminated. The length is stored in the smallest
+	 *          unsigned type that can hold N, so FixedString<15> occupies 17 bytes.
+	 *          Operations that would exceed the capacity either truncate (construction from a
+	 *          std::string_view) or fail and leave the string unchanged (the try*() members and
+	 *          the free function overloads below).
+	 */
+	template <std::size_t N>
+	class FixedString
+	{
+	public:
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Constructs an empty string
+		 */
+		constexpr FixedString() noexcept = default;
+
+		/**
+		 * @brief Constructs from a string literal
+		 * @tparam M Size of the literal, including its null terminator
+		 * @param str Literal of at most N characters, checked at compile time
+		 */
+		template <std::size_t M>
+		inline constexpr FixedString( const char ( &str )[M] ) noexcept;
+
+		/**
+		 * @brief Constructs from a string view, truncating to N characters
+		 * @param str Characters to copy
+		 * @details Use tryAssign() when truncation must be detected.
+		 */
+		inline explicit constexpr FixedString( std::string_view str ) noexcept;
+
+		//----------------------------------------------
+		// Modification
+		//----------------------------------------------
+
+		/**
+		 * @brief Replace the contents
+		 * @param str New contents
+		 * @return True on success, false if str is longer than N (the string is unchanged)
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr bool tryAssign( std::string_view str ) noexcept;
+
+		/**
+		 * @brief Append characters
+		 * @param str Characters to append
+		 * @return True on success, false if the result would exceed N (the string is unchanged)
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr bool tryAppend( std::string_view str ) noexcept;
+
+		/**
+		 * @brief Append a character repeatedly
+		 * @param count Number of characters to append
+		 * @param ch Character to append
+		 * @return True on success, false if the result would exceed N (the string is unchanged)
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr bool tryAppend( std::size_t count, char ch ) noexcept;
+
+		/**
+		 * @brief Append one character
+		 * @param ch Character to append
+		 * @return True on success, false if the string is full
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr bool tryPushBack( char ch ) noexcept;
+
+		/**
+		 * @brief Remove all characters
+		 */
+		inline constexpr void clear() noexcept;
+
+		//----------------------------------------------
+		// Access
+		//----------------------------------------------
+
+		/**
+		 * @brief View of the characters
+		 * @return std::string_view of size() characters
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr std::string_view view() const noexcept;
+
+		/**
+		 * @brief Implicit conversion to std::string_view
+		 * @return Same as view()
+		 */
+		inline constexpr operator std::string_view() const noexcept;
+
+		/**
+		 * @brief Null-terminated character data
+		 * @return Pointer to the first character
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr const char* c_str() const noexcept;
+
+		/**
+		 * @brief Character data
+		 * @return Pointer to the first character
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr const char* data() const noexcept;
+
+		/**
+		 * @brief Mutable character data; the length cannot be changed through it
+		 * @return Pointer to the first character
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr char* data() noexcept;
+
+		/**
+		 * @brief Character at a position
+		 * @param index Position, must be less than size()
+		 * @return Reference to the character
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr const char& operator[]( std::size_t index ) const noexcept;
+
+		/**
+		 * @brief Mutable character at a position
+		 * @param index Position, must be less than size()
+		 * @return Reference to the character
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr char& operator[]( std::size_t index ) noexcept;
+
+		/**
+		 * @brief Iterator to the first character
+		 * @return Pointer to the first character
+		 */
+		inline constexpr const char* begin() const noexcept;
+
+		/**
+		 * @brief Iterator past the last character
+		 * @return Pointer to the null terminator
+		 */
+		inline constexpr const char* end() const noexcept;
+
+		//----------------------------------------------
+		// Capacity
+		//----------------------------------------------
+
+		/**
+		 * @brief Number of characters
+		 * @return Length of the string
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr std::size_t size() const noexcept;
+
+		/**
+		 * @brief Check for the empty string
+		 * @return True if size() is 0
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr bool empty() const noexcept;
+
+		/**
+		 * @brief Maximum number of characters
+		 * @return N
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] static inline constexpr std::size_t capacity() noexcept;
+
+		//----------------------------------------------
+		// Comparison
+		//----------------------------------------------
+
+		/**
+		 * @brief Compares the characters with another fixed string of any capacity
+		 * @param other String to compare with
+		 * @return True if both hold the same characters
+		 */
+		template <std::size_t M>
+		inline constexpr bool operator==( const FixedString<M>& other ) const noexcept;
+
+		/**
+		 * @brief Compares the characters with a string view
+		 * @param other String to compare with
+		 * @return True if both hold the same characters
+		 */
+		inline constexpr bool operator==( std::string_view other ) const noexcept;
+
+		/**
+		 * @brief Lexicographic ordering against another fixed string of any capacity
+		 * @param other String to compare with
+		 * @return Ordering of view() relative to other.view()
+		 */
+		template <std::size_t M>
+		inline constexpr std::strong_ordering operator<=>( const FixedString<M>& other ) const noexcept;
+
+		/**
+		 * @brief Lexicographic ordering against a string view
+		 * @param other String to compare with
+		 * @return Ordering of view() relative to other
+		 */
+		inline constexpr std::strong_ordering operator<=>( std::string_view other ) const noexcept;
+
+	private:
+		using SizeType = std::conditional_t<N <= UINT8_MAX, std::uint8_t,
+			std::conditional_t<N <= UINT16_MAX, std::uint16_t, std::size_t>>;
+
+		char m_data[N + 1]{};
+		SizeType m_size{ 0 };
+	};
+
+	//----------------------------------------------
+	// Deduction guide
+	//----------------------------------------------
+
+	/** @brief FixedString{ "abc" } deduces FixedString<3> */
+	template <std::size_t M>
+	FixedString( const char ( & )[M] ) -> FixedString<M - 1>;
+
+	//=====================================================================
+	// Non-allocating string operations
+	//=====================================================================
+
+	/**
+	 * @brief Trim leading and trailing whitespace into a fixed string
+	 * @tparam N Capacity of the result
+	 * @param str String to trim
+	 * @param result Receives the trimmed string; may be the same object as str
+	 * @return True on success, false if the trimmed string is longer than N (result is unchanged)
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	template <std::size_t N>
+	[[nodiscard]] inline constexpr bool trim( std::string_view str, FixedString<N>& result ) noexcept;
+
+	/**
+	 * @brief Convert ASCII letters to lowercase into a fixed string
+	 * @tparam N Capacity of the result
+	 * @param str String to convert
+	 * @param result Receives the converted string; may be the same object as str
+	 * @return True on success, false if str is longer than N (result is unchanged)
+	 * @details Non-ASCII bytes are preserved unchanged, as in toLower( std::string_view ).
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	template <std::size_t N>
+	[[nodiscard]] inline constexpr bool toLower( std::string_view str, FixedString<N>& result ) noexcept;
+
+	/**
+	 * @brief Convert ASCII letters to uppercase into a fixed string
+	 * @tparam N Capacity of the result
+	 * @param str String to convert
+	 * @param result Receives the converted string; may be the same object as str
+	 * @return True on success, false if str is longer than N (result is unchanged)
+	 * @details Non-ASCII bytes are preserved unchanged, as in toUpper( std::string_view ).
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	template <std::size_t N>
+	[[nodiscard]] inline constexpr bool toUpper( std::string_view str, FixedString<N>& result ) noexcept;
+
+	/**
+	 * @brief Pad on the left into a fixed string
+	 * @tparam N Capacity of the result
+	 * @param str String to pad
+	 * @param width Target width
+	 * @param result Receives the padded string; may be the same object as str
+	 * @param fillChar Character to use for padding (default: space)
+	 * @return True on success, false if the padded string is longer than N (result is unchanged)
+	 * @details Same result as padLeft( str, width, fillChar ).
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	template <std::size_t N>
+	[[nodiscard]] inline constexpr bool padLeft( std::string_view str, std::size_t width, FixedString<N>& result, char fillChar = ' ' ) noexcept;
+
+	/**
+	 * @brief Pad on the right into a fixed string
+	 * @tparam N Capacity of the result
+	 * @param str String to pad
+	 * @param width Target width
+	 * @param result Receives the padded string; may be the same object as str
+	 * @param fillChar Character to use for padding (default: space)
+	 * @return True on success, false if the padded string is longer than N (result is unchanged)
+	 * @details Same result as padRight( str, width, fillChar ).
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	template <std::size_t N>
+	[[nodiscard]] inline constexpr bool padRight( std::string_view str, std::size_t width, FixedString<N>& result, char fillChar = ' ' ) noexcept;
+
+	/**
+	 * @brief Replace the first occurrence of a substring into a fixed string
+	 * @tparam N Capacity of the result
+	 * @param str String to search in
+	 * @param oldStr Substring to replace
+	 * @param newStr Replacement string
+	 * @param result Receives the new string; may be the same object as any input
+	 * @return True on success, false if the new string is longer than N (result is unchanged)
+	 * @details Same result as replace( str, oldStr, newStr ).
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	template <std::size_t N>
+	[[nodiscard]] inline constexpr bool replace( std::string_view str, std::string_view oldStr, std::string_view newStr, FixedString<N>& result ) noexcept;
+
+	/**
+	 * @brief Replace all occurrences of a substring into a fixed string
+	 * @tparam N Capacity of the result
+	 * @param str String to search in
+	 * @param oldStr Substring to replace
+	 * @param newStr Replacement string
+	 * @param result Receives the new string; may be the same object as any input
+	 * @return True on success, false if the new string is longer than N (result is unchanged)
+	 * @details Same result as replaceAll( str, oldStr, newStr ).
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	template <std::size_t N>
+	[[nodiscard]] inline constexpr bool replaceAll( std::string_view str, std::string_view oldStr, std::string_view newStr, FixedString<N>& result ) noexcept;
+} // namespace nfx::string
+
+//=====================================================================
+// std::hash specialization
+//=====================================================================
+
+/**
+ * @brief Hashes a FixedString like the equal std::string_view
+ */
+template <std::size_t N>
+struct std::hash<nfx::string::FixedString<N>>
+{
+	std::size_t operator()( const nfx::string::FixedString<N>& str ) const noexcept
+	{
+		return std::hash<std::string_view>{}( str.view() );
+	}
+};
+
+#include "nfx/detail/string/FixedString.inl"
@@ -0,0 +1,154 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file FuzzyIndex.h
+ * @brief Approximate dictionary lookup by Levenshtein distance
+ * @details FuzzyIndex answers "which entries are within distance k of this query" without
+ *          comparing the query against every entry. Entries are stored contiguously, ordered by
+ *          length, with padded trigram posting lists; a query only counts shared trigrams among
+ *          entries of compatible length, and verifies the survivors of the q-gram count filter
+ *          with the bit-parallel distance of Levenshtein.h.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "nfx/string/Levenshtein.h"
+
+namespace nfx::string
+{
+	//=====================================================================
+	// FuzzyIndex class
+	//=====================================================================
+
+	/**
+	 * @brief Result of a FuzzyIndex lookup
+	 */
+	struct FuzzyMatch
+	{
+		/** @brief Position of the entry in the container the index was built from */
+		std::size_t index;
+
+		/** @brief Levenshtein distance from the query to the entry */
+		std::size_t distance;
+
+		/** @brief The entry, stored in the index */
+		std::string_view value;
+	};
+
+	/**
+	 * @brief Immutable index for approximate lookup of strings by edit distance
+	 * @details Each entry contributes the distinct trigrams of the entry padded with two boundary
+	 *          symbols at each end. An edit changes at most three of them, so an entry within
+	 *          distance k of the query shares at least max(|Gq|, |Ge|) - 3k trigrams with it,
+	 *          where G are the distinct trigram sets. Entries are renumbered by length so the
+	 *          candidates of a query form one contiguous range of every posting list.
+	 *          When that bound is not positive (short queries, large k), every entry of
+	 *          compatible length is verified. find() may be called concurrently.
+	 *          Up to 2^32 - 1 entries are supported.
+	 */
+	class FuzzyIndex
+	{
+	public:
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Constructs an empty index
+		 */
+		FuzzyIndex() = default;
+
+		/**
+		 * @brief Builds an index over the entries of a container
+		 * @tparam Container Container type (must support begin()/end() and value_type convertible to string_view)
+		 * @param entries Strings to index; they are copied into the index
+		 */
+		template <typename Container>
+		inline explicit FuzzyIndex( const Container& entries );
+
+		//----------------------------------------------
+		// Lookup
+		//----------------------------------------------
+
+		/**
+		 * @brief Find every entry within an edit distance of the query
+		 * @param query String to look up
+		 * @param maxDistance Largest Levenshtein distance to report
+		 * @return Matching entries ordered by distance, then by index
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::vector<FuzzyMatch> find( std::string_view query, std::size_t maxDistance ) const;
+
+		//----------------------------------------------
+		// Access
+		//----------------------------------------------
+
+		/**
+		 * @brief Number of indexed entries
+		 * @return Entry count
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::size_t size() const noexcept;
+
+		/**
+		 * @brief Check for an empty index
+		 * @return True if the index holds no entries
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline bool empty() const noexcept;
+
+	private:
+		inline void build( const std::vector<std::string_view>& entries );
+
+		inline std::string_view entry( std::uint32_t id ) const noexcept;
+
+		/** @brief Entry bytes, concatenated in length order */
+		std::string m_text;
+
+		/** @brief Start of each entry in m_text, plus the end of the last one */
+		std::vector<std::size_t> m_offsets;
+
+		/** @brief Position in the source container of each entry */
+		std::vector<std::uint32_t> m_indices;
+
+		/** @brief Number of distinct trigrams of each entry */
+		std::vector<std::uint32_t> m_gramCounts;
+
+		/** @brief Sorted distinct trigram keys, with the start of each posting list in m_postings */
+		std::vector<std::uint32_t> m_gramKeys;
+		std::vector<std::size_t> m_gramStarts;
+
+		/** @brief Entry ids per trigram, ascending within each list */
+		std::vector<std::uint32_t> m_postings;
+	};
+} // namespace nfx::string
+
+#include "nfx/detail/string/FuzzyIndex.inl"
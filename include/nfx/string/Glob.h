@@ -0,0 +1,281 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Glob.h
+ * @brief Precompiled wildcard (glob) patterns and pattern sets
+ * @details Supports '*' (any run of bytes, including none), '?' (exactly one byte),
+ *          bracket classes "[a-z]", "[!0-9]" or "[^0-9]", and '\' escapes. Patterns are compiled
+ *          once into literal-or-token segments separated by stars. Matching anchors the first and
+ *          last segments and then locates each middle segment at its leftmost position, which is
+ *          always sufficient for globs, so no state is ever revisited and pathological patterns
+ *          such as "a*a*a*a*b" cannot blow up. Bytes are matched individually; '*' also matches
+ *          '/' and '.'.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace nfx::string
+{
+	//=====================================================================
+	// Glob options
+	//=====================================================================
+
+	/**
+	 * @brief Letter case handling of a glob pattern
+	 */
+	enum class GlobCase : std::uint8_t
+	{
+		/** @brief Bytes must match exactly */
+		Sensitive,
+
+		/** @brief ASCII letters match regardless of case, in literals and classes alike */
+		Insensitive
+	};
+
+	class GlobSet;
+
+	namespace detail
+	{
+		/** @brief Transparent hash of exact glob literals, optionally ignoring ASCII case */
+		template <bool FoldCase>
+		struct GlobLiteralHash
+		{
+			using is_transparent = void;
+
+			inline std::size_t operator()( std::string_view str ) const noexcept;
+		};
+
+		/** @brief Transparent equality of exact glob literals, optionally ignoring ASCII case */
+		template <bool FoldCase>
+		struct GlobLiteralEqual
+		{
+			using is_transparent = void;
+
+			inline bool operator()( std::string_view lhs, std::string_view rhs ) const noexcept;
+		};
+
+		/** @brief Pattern ids keyed by a literal of one fixed length */
+		template <bool FoldCase>
+		struct GlobAffixTable
+		{
+			std::size_t length;
+			std::unordered_map<std::string, std::vector<std::size_t>, GlobLiteralHash<FoldCase>, GlobLiteralEqual<FoldCase>> ids;
+		};
+	} // namespace detail
+
+	//=====================================================================
+	// GlobPattern class
+	//=====================================================================
+
+	/**
+	 * @brief Compiled glob pattern
+	 * @details An unterminated '[' and a trailing '\' are matched literally, so every pattern
+	 *          compiles. Matching never allocates; literal segments are located with
+	 *          std::string_view::find.
+	 */
+	class GlobPattern
+	{
+		friend class GlobSet;
+
+	public:
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Constructs a pattern matching only the empty string
+		 */
+		GlobPattern() = default;
+
+		/**
+		 * @brief Compiles a glob pattern
+		 * @param pattern Pattern text
+		 * @param caseMode Letter case handling
+		 */
+		inline explicit GlobPattern( std::string_view pattern, GlobCase caseMode = GlobCase::Sensitive );
+
+		//----------------------------------------------
+		// Matching
+		//----------------------------------------------
+
+		/**
+		 * @brief Check whether a whole string matches the pattern
+		 * @param str String to test
+		 * @return True if the pattern matches all of str
+		 * @details Example: GlobPattern{ "*.example.com" }.matches( "api.example.com" ) returns true
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline bool matches( std::string_view str ) const noexcept;
+
+		//----------------------------------------------
+		// Access
+		//----------------------------------------------
+
+		/**
+		 * @brief Source text of the pattern
+		 * @return The pattern as passed to the constructor
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::string_view pattern() const noexcept;
+
+		/**
+		 * @brief Letter case handling of the pattern
+		 * @return The case mode passed to the constructor
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline GlobCase caseMode() const noexcept;
+
+	private:
+		/** @brief Tokens between two stars; literal segments also have their bytes in m_literals */
+		struct Segment
+		{
+			std::size_t begin;
+			std::size_t size;
+			bool literal;
+		};
+
+		inline bool tokenMatches( std::uint16_t token, char c ) const noexcept;
+		inline bool matchesAt( const Segment& segment, std::string_view str, std::size_t pos ) const noexcept;
+		inline std::size_t findSegment( const Segment& segment, std::string_view str, std::size_t pos ) const noexcept;
+
+		std::string m_pattern;
+		std::vector<std::uint16_t> m_tokens;
+		std::string m_literals;
+		std::vector<std::array<std::uint64_t, 4>> m_classes;
+		std::vector<Segment> m_segments{ Segment{ 0, 0, true } };
+		std::size_t m_minSize = 0;
+		bool m_hasStar = false;
+		GlobCase m_case = GlobCase::Sensitive;
+	};
+
+	//=====================================================================
+	// GlobSet class
+	//=====================================================================
+
+	/**
+	 * @brief Collection of glob patterns matched against a string at once
+	 * @details Patterns without wildcards are looked up in a hash table. The others are keyed by
+	 *          their longer anchored literal, the run of literal bytes that starts the pattern or
+	 *          ends it, in one hash table per literal length; a query hashes its own prefix or
+	 *          suffix of each length and runs only the patterns found. Patterns anchored by neither,
+	 *          such as "*foo*", are always run. Pattern ids are their insertion indices.
+	 */
+	class GlobSet
+	{
+	public:
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Constructs an empty set
+		 */
+		GlobSet() = default;
+
+		//----------------------------------------------
+		// Modifiers
+		//----------------------------------------------
+
+		/**
+		 * @brief Compile and add a pattern
+		 * @param pattern Pattern text
+		 * @param caseMode Letter case handling
+		 * @return Id of the pattern, equal to the number of patterns added before it
+		 */
+		inline std::size_t add( std::string_view pattern, GlobCase caseMode = GlobCase::Sensitive );
+
+		//----------------------------------------------
+		// Matching
+		//----------------------------------------------
+
+		/**
+		 * @brief Check whether any pattern matches a string
+		 * @param str String to test
+		 * @return True if at least one pattern matches all of str
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline bool matchesAny( std::string_view str ) const;
+
+		/**
+		 * @brief Ids of every pattern matching a string
+		 * @param str String to test
+		 * @return Matching pattern ids in ascending order
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::vector<std::size_t> matches( std::string_view str ) const;
+
+		//----------------------------------------------
+		// Access
+		//----------------------------------------------
+
+		/**
+		 * @brief Number of patterns in the set
+		 * @return Pattern count
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::size_t size() const noexcept;
+
+		/**
+		 * @brief Check for an empty set
+		 * @return True if no pattern was added
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline bool empty() const noexcept;
+
+		/**
+		 * @brief Pattern by id
+		 * @param id Id returned by add()
+		 * @return The compiled pattern
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline const GlobPattern& operator[]( std::size_t id ) const noexcept;
+
+	private:
+		template <typename Visitor>
+		inline bool forEachMatch( std::string_view str, const Visitor& visitor ) const;
+
+		template <bool FoldCase>
+		static inline void addKeyed( std::vector<detail::GlobAffixTable<FoldCase>>& tables, std::string_view literal, std::size_t id );
+
+		std::vector<GlobPattern> m_patterns;
+		std::unordered_map<std::string, std::vector<std::size_t>, detail::GlobLiteralHash<false>, detail::GlobLiteralEqual<false>> m_exact;
+		std::unordered_map<std::string, std::vector<std::size_t>, detail::GlobLiteralHash<true>, detail::GlobLiteralEqual<true>> m_exactIgnoreCase;
+		std::vector<detail::GlobAffixTable<false>> m_prefixes;
+		std::vector<detail::GlobAffixTable<false>> m_suffixes;
+		std::vector<detail::GlobAffixTable<true>> m_prefixesIgnoreCase;
+		std::vector<detail::GlobAffixTable<true>> m_suffixesIgnoreCase;
+		std::vector<std::size_t> m_unkeyed;
+	};
+} // namespace nfx::string
+
+#include "nfx/detail/string/Glob.inl"
@@ -0,0 +1,163 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Instrumentation.h
+ * @brief Opt-in call, byte and time counters of the hot-path functions
+ * @details Compiled only when NFX_STRINGUTILS_INSTRUMENT is defined; otherwise every probe expands
+ *          to nothing and instrumentationSnapshot() returns zeros. Each thread counts into its own
+ *          counters without locking or allocating; a snapshot sums the live threads and the
+ *          totals of the threads that have exited. Define the macro for the whole program (the
+ *          CMake option NFX_STRINGUTILS_INSTRUMENT does), never for a single translation unit.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+//=====================================================================
+// Probe macro
+//=====================================================================
+
+#if defined( NFX_STRINGUTILS_INSTRUMENT )
+/** @brief Counts the enclosing scope as calls of `function` over a number of bytes (internal) */
+#	define NFX_STRINGUTILS_PROBE( function, ... ) \
+		const ::nfx::string::detail::InstrumentationProbe nfxInstrumentationProbe{ ::nfx::string::InstrumentedFunction::function, __VA_ARGS__ }
+#else
+#	define NFX_STRINGUTILS_PROBE( function, ... ) static_cast<void>( 0 )
+#endif
+
+namespace nfx::string
+{
+	//=====================================================================
+	// Instrumented functions
+	//=====================================================================
+
+	/**
+	 * @brief Functions that record calls, input bytes and time when instrumentation is enabled
+	 * @details Calls made by other library functions are counted too (tryParseEndpoint validates
+	 *          its host with isIPv4Address, for example), and times include those nested calls.
+	 *          Splitter counts one call and the whole input per begin(); its time covers begin()
+	 *          and every iterator increment.
+	 */
+	enum class InstrumentedFunction : std::uint8_t
+	{
+		ReplaceAll,
+		Splitter,
+		TryParseBool,
+		TryParseInt,
+		TryParseUInt,
+		TryParseLong,
+		TryParseFloat,
+		TryParseDouble,
+		IsIPv4Address,
+		IsIPv6Address,
+		IsValidHostname,
+		IsDomainName,
+		IsValidPort,
+		TryParseEndpoint
+	};
+
+	/** @brief Number of InstrumentedFunction values */
+	inline constexpr std::size_t kInstrumentedFunctionCount{ 14 };
+
+	/** @brief True when the library was compiled with NFX_STRINGUTILS_INSTRUMENT */
+#if defined( NFX_STRINGUTILS_INSTRUMENT )
+	inline constexpr bool kInstrumentationEnabled{ true };
+#else
+	inline constexpr bool kInstrumentationEnabled{ false };
+#endif
+
+	//=====================================================================
+	// Counters
+	//=====================================================================
+
+	/**
+	 * @brief Totals of one instrumented function
+	 */
+	struct InstrumentationCounters
+	{
+		/** @brief Number of calls */
+		std::uint64_t calls{ 0 };
+
+		/** @brief Input bytes over all calls */
+		std::uint64_t bytes{ 0 };
+
+		/** @brief Wall-clock time spent in the calls, from std::chrono::steady_clock */
+		std::uint64_t nanoseconds{ 0 };
+	};
+
+	/**
+	 * @brief Totals of every instrumented function since the program started
+	 * @details Counters only grow; subtract an earlier snapshot to measure an interval.
+	 */
+	struct InstrumentationSnapshot
+	{
+		/** @brief Totals indexed by InstrumentedFunction */
+		std::array<InstrumentationCounters, kInstrumentedFunctionCount> counters{};
+
+		/**
+		 * @brief Totals of one function
+		 * @param function Function to look up
+		 * @return Its counters
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr const InstrumentationCounters& operator[]( InstrumentedFunction function ) const noexcept;
+
+		/**
+		 * @brief Activity between an earlier snapshot and this one
+		 * @param earlier Snapshot taken before this one
+		 * @return Per-function differences
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr InstrumentationSnapshot operator-( const InstrumentationSnapshot& earlier ) const noexcept;
+	};
+
+	//=====================================================================
+	// Export
+	//=====================================================================
+
+	/**
+	 * @brief Name of an instrumented function as spelled in the API
+	 * @param function Function to name
+	 * @return "replaceAll", "Splitter", "tryParseInt", ...
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline constexpr std::string_view instrumentedFunctionName( InstrumentedFunction function ) noexcept;
+
+	/**
+	 * @brief Current totals of all threads
+	 * @return Counters of the live threads plus those of the threads that have exited, or zeros
+	 *         when instrumentation is disabled
+	 * @details Takes a lock shared with thread start and exit, never with the counting itself.
+	 *          A thread counting concurrently is read at some point during the call.
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline InstrumentationSnapshot instrumentationSnapshot();
+} // namespace nfx::string
+
+#include "nfx/detail/string/Instrumentation.inl"
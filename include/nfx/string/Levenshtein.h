@@ -0,0 +1,142 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Levenshtein.h
+ * @brief Bit-parallel Levenshtein edit distance
+ * @details Implements Myers' bit-vector algorithm in Hyyroe's formulation for the Levenshtein
+ *          distance: one 64-bit word holds a whole DP column of a pattern of up to 64 bytes, and
+ *          longer patterns are split into blocks of 64 rows. Each text byte then costs a few
+ *          word operations per block instead of one DP cell per pattern byte.
+ *          Distances count single-byte insertions, deletions and substitutions.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+#include <vector>
+
+namespace nfx::string
+{
+	//=====================================================================
+	// Edit distance
+	//=====================================================================
+
+	/**
+	 * @brief Levenshtein distance between two strings
+	 * @param lhs First string
+	 * @param rhs Second string
+	 * @return Minimum number of byte insertions, deletions and substitutions turning lhs into rhs
+	 * @details Common prefixes and suffixes are skipped first. Allocates only when the shorter
+	 *          remaining string is longer than 64 bytes.
+	 *          Example: levenshteinDistance("kitten", "sitting") returns 3
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline std::size_t levenshteinDistance( std::string_view lhs, std::string_view rhs );
+
+	/**
+	 * @brief Levenshtein distance with an upper bound
+	 * @param lhs First string
+	 * @param rhs Second string
+	 * @param maxDistance Largest distance of interest
+	 * @return The distance if it is at most maxDistance, otherwise maxDistance + 1
+	 * @details Returns immediately when the length difference exceeds maxDistance, and stops as
+	 *          soon as the remaining bytes cannot bring the distance back within the bound.
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline std::size_t levenshteinDistance( std::string_view lhs, std::string_view rhs, std::size_t maxDistance );
+
+	//=====================================================================
+	// LevenshteinMatcher class
+	//=====================================================================
+
+	/**
+	 * @brief Levenshtein distance from one query to many candidates
+	 * @details The per-byte match masks of the query are built once at construction, so each
+	 *          candidate costs only the bit-parallel scan. The matcher does not own the query
+	 *          bytes after construction. distance() may be called concurrently.
+	 */
+	class LevenshteinMatcher
+	{
+	public:
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Prepares a query for repeated comparison
+		 * @param query String to compare candidates against
+		 */
+		inline explicit LevenshteinMatcher( std::string_view query );
+
+		//----------------------------------------------
+		// Distance
+		//----------------------------------------------
+
+		/**
+		 * @brief Distance from the query to one candidate
+		 * @param candidate String to compare
+		 * @param maxDistance Largest distance of interest (default: unbounded)
+		 * @return The distance if it is at most maxDistance, otherwise maxDistance + 1
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::size_t distance(
+			std::string_view candidate, std::size_t maxDistance = std::numeric_limits<std::size_t>::max() ) const;
+
+		/**
+		 * @brief Distances from the query to every candidate of a container
+		 * @tparam Container Container type (must support begin()/end() and value_type convertible to string_view)
+		 * @param candidates Strings to compare
+		 * @param maxDistance Largest distance of interest (default: unbounded)
+		 * @return One result per candidate, in order, as returned by distance()
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		template <typename Container>
+		[[nodiscard]] inline std::vector<std::size_t> distances(
+			const Container& candidates, std::size_t maxDistance = std::numeric_limits<std::size_t>::max() ) const;
+
+		//----------------------------------------------
+		// Access
+		//----------------------------------------------
+
+		/**
+		 * @brief Length of the query
+		 * @return Number of bytes
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::size_t size() const noexcept;
+
+	private:
+		std::size_t m_size;
+		std::size_t m_blocks;
+
+		/** @brief Match masks, m_blocks words per byte value */
+		std::vector<std::uint64_t> m_masks;
+	};
+} // namespace nfx::string
+
+#include "nfx/detail/string/Levenshtein.inl"
@@ -0,0 +1,84 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file NaturalOrder.h
+ * @brief Natural-order string comparison and sorting
+ * @details Natural order compares runs of ASCII digits by numeric value instead of byte by byte,
+ *          so "file9" sorts before "file10" and "v1.2.10" after "v1.2.9". Digit runs of any
+ *          length are compared in place by significant length, then digit by digit, so no
+ *          number is ever converted and nothing overflows. All other bytes compare as unsigned
+ *          characters.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <string_view>
+
+#include "nfx/string/Utils.h"
+
+namespace nfx::string
+{
+	//=====================================================================
+	// Natural order
+	//=====================================================================
+
+	/**
+	 * @brief Three-way natural-order comparison
+	 * @param lhs First string
+	 * @param rhs Second string
+	 * @return Negative if lhs sorts first, positive if rhs sorts first, zero if both are equal
+	 * @details Numbers that differ only in leading zeros compare equal as numbers; if the strings
+	 *          are otherwise equal, the first such run decides, fewer zeros first ("a1" < "a01"),
+	 *          so the order is total and only identical strings compare equal. Never allocates.
+	 *          Example: naturalCompare("img12.png", "img2.png") returns a positive value
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline constexpr int naturalCompare( std::string_view lhs, std::string_view rhs ) noexcept;
+
+	/**
+	 * @brief Check whether lhs sorts before rhs in natural order
+	 * @param lhs First string
+	 * @param rhs Second string
+	 * @return True if naturalCompare(lhs, rhs) is negative
+	 * @details Usable directly as the comparator of std::sort and ordered containers.
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline constexpr bool naturalLess( std::string_view lhs, std::string_view rhs ) noexcept;
+
+	/**
+	 * @brief Sort strings in natural order
+	 * @param strings Views to reorder in place; the viewed characters are not modified
+	 * @details Tokenizes every string once into a binary sort key whose byte-wise order equals
+	 *          naturalCompare(), then sorts the keys with radixSort's cached-key quicksort. This
+	 *          avoids re-parsing digit runs on each of the O(n log n) comparisons that std::sort
+	 *          with naturalLess would make.
+	 *          Allocates one buffer for all keys and one index array.
+	 */
+	inline void naturalSort( std::span<std::string_view> strings );
+} // namespace nfx::string
+
+#include "nfx/detail/string/NaturalOrder.inl"
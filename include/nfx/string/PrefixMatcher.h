@@ -0,0 +1,184 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file PrefixMatcher.h
+ * @brief Multi-prefix matching with a compacted radix tree
+ * @details PrefixMatcher answers "which of these prefixes does the string start with" in one
+ *          pass over the string, instead of calling startsWith() once per prefix. It suits
+ *          request routing, where a path is compared against hundreds of route prefixes.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace nfx::string
+{
+	//=====================================================================
+	// PrefixMatcher class
+	//=====================================================================
+
+	/**
+	 * @brief Result of a PrefixMatcher lookup
+	 */
+	struct PrefixMatch
+	{
+		/** @brief Position of the prefix in the container the matcher was built from */
+		std::size_t index;
+
+		/** @brief Length of the matching prefix */
+		std::size_t length;
+	};
+
+	/**
+	 * @brief Immutable set of prefixes matched against strings in O(string length)
+	 * @details The prefixes form a compacted radix tree: every edge carries a run of bytes, and
+	 *          the children of a node are stored next to each other in one node array, with
+	 *          their first bytes in a parallel array that a lookup scans with memchr. Nodes are
+	 *          laid out breadth-first, so the nodes of each level are contiguous as well.
+	 *          A prefix given more than once is reported with the index of its first occurrence.
+	 *          Lookups may be called concurrently. Up to 2^32 - 1 prefixes of at most
+	 *          2^32 - 1 bytes in total are supported.
+	 */
+	class PrefixMatcher
+	{
+	public:
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Constructs an empty matcher
+		 */
+		PrefixMatcher() = default;
+
+		/**
+		 * @brief Builds a matcher over the prefixes of a container
+		 * @tparam Container Container type (must support begin()/end() and value_type convertible to string_view)
+		 * @param prefixes Prefixes to match; they are copied into the matcher
+		 */
+		template <typename Container>
+		inline explicit PrefixMatcher( const Container& prefixes );
+
+		//----------------------------------------------
+		// Matching
+		//----------------------------------------------
+
+		/**
+		 * @brief Find the longest prefix that a string starts with
+		 * @param str String to test
+		 * @param match Receives the longest matching prefix; unchanged when there is none
+		 * @return True if str starts with at least one prefix
+		 * @details Example: with prefixes {"/api/", "/api/users/"}, "/api/users/42" matches "/api/users/"
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline bool longestMatch( std::string_view str, PrefixMatch& match ) const noexcept;
+
+		/**
+		 * @brief Find every prefix that a string starts with
+		 * @param str String to test
+		 * @return Matching prefixes ordered from shortest to longest
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::vector<PrefixMatch> allMatches( std::string_view str ) const;
+
+		/**
+		 * @brief Check whether a string starts with any prefix
+		 * @param str String to test
+		 * @return True if str starts with at least one prefix
+		 * @details Stops at the shortest match, so it never walks further than the first hit.
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline bool matchesAny( std::string_view str ) const noexcept;
+
+		//----------------------------------------------
+		// Access
+		//----------------------------------------------
+
+		/**
+		 * @brief Number of prefixes the matcher was built from, duplicates included
+		 * @return Prefix count
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::size_t size() const noexcept;
+
+		/**
+		 * @brief Check for an empty matcher
+		 * @return True if the matcher holds no prefixes
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline bool empty() const noexcept;
+
+		/**
+		 * @brief Access a prefix by its position in the source container
+		 * @param index Prefix position, less than size()
+		 * @return The prefix, stored in the matcher
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::string_view prefix( std::size_t index ) const noexcept;
+
+	private:
+		/** @brief Radix tree node; the edge label leads from the parent to this node */
+		struct Node
+		{
+			std::uint32_t labelOffset;
+			std::uint32_t labelSize;
+			std::uint32_t firstChild;
+			std::uint32_t childCount;
+			std::uint32_t value;
+		};
+
+		/** @brief Node value of nodes that end no prefix */
+		static constexpr std::uint32_t kNoValue{ std::numeric_limits<std::uint32_t>::max() };
+
+		inline void build( const std::vector<std::string_view>& prefixes );
+
+		/**
+		 * @brief Walk the tree along str, reporting every prefix node passed
+		 * @param visit Called with (value, length) per match, shortest first; returns false to stop
+		 */
+		template <typename Visitor>
+		inline void walk( std::string_view str, Visitor&& visit ) const;
+
+		/** @brief Prefix bytes, concatenated in source order; edge labels point into it */
+		std::string m_text;
+
+		/** @brief Start of each prefix in m_text, plus the end of the last one */
+		std::vector<std::size_t> m_offsets;
+
+		/** @brief Tree nodes, breadth-first; the root is node 0 */
+		std::vector<Node> m_nodes;
+
+		/** @brief First edge byte of each node, parallel to m_nodes */
+		std::string m_firstBytes;
+	};
+} // namespace nfx::string
+
+#include "nfx/detail/string/PrefixMatcher.inl"
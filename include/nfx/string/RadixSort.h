@@ -0,0 +1,66 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file RadixSort.h
+ * @brief Cache-friendly in-place sorting of string views
+ * @details Multikey quicksort over 64-bit "characters": the next 8 bytes of every string are
+ *          cached in a big-endian integer next to its view, so partitioning compares integers
+ *          in a contiguous array instead of chasing pointers into memcmp. Only strings that
+ *          share all cached bytes are reloaded 8 bytes deeper. The result is the same order as
+ *          std::sort on std::string_view.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <string_view>
+
+namespace nfx::string
+{
+	//=====================================================================
+	// String sorting
+	//=====================================================================
+
+	/**
+	 * @brief Sort strings in byte-wise lexicographic order
+	 * @param strings Views to reorder in place; the viewed characters are not modified
+	 * @details Produces the same order as std::sort( strings.begin(), strings.end() ).
+	 *          Not stable; equal views are indistinguishable anyway.
+	 *          Allocates one 32-byte record per string.
+	 */
+	inline void radixSort( std::span<std::string_view> strings );
+
+	/**
+	 * @brief Sort strings in ASCII case-insensitive order
+	 * @param strings Views to reorder in place; the viewed characters are not modified
+	 * @details Compares the strings with 'A'-'Z' folded to lowercase, as iequals() does; strings
+	 *          equal under folding are ordered byte-wise, so "ABC" precedes "abc" and the result
+	 *          is deterministic. Allocates one 32-byte record per string.
+	 */
+	inline void radixSortIgnoreCase( std::span<std::string_view> strings );
+} // namespace nfx::string
+
+#include "nfx/detail/string/RadixSort.inl"
@@ -0,0 +1,562 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Regex.h
+ * @brief Backtracking-free compiled regular expressions
+ * @details Supports literals, '.', bracket classes "[a-z]" and "[^0-9]", the escapes \d \w \s
+ *          (and their negations \D \W \S), \t \n \r \f \v and \xHH, grouping with "(...)" or
+ *          "(?:...)", alternation '|', the quantifiers '*', '+', '?', "{m}", "{m,}" and "{m,n}",
+ *          and the anchors '^' at the very start and '$' at the very end of the pattern. A pattern
+ *          is compiled to a Thompson NFA from which DFA states are built lazily while matching and
+ *          kept in a bounded cache, so no pattern can backtrack exponentially: matching a whole
+ *          string or testing for any match runs in time linear in the input. Matches follow
+ *          leftmost-longest (POSIX) semantics, and the longest match from a start is only known once
+ *          the DFA dies or the input ends; a pattern such as "a+b|a" over a run of n 'a' reads to
+ *          the end of the run for each of its n matches, so finding, replacing or splitting at every
+ *          match takes O(n^2) steps in that worst case. There are no capture groups or backreferences. Bytes are matched individually, so UTF-8 text is
+ *          handled byte-wise.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace nfx::string
+{
+	//=====================================================================
+	// Regex options
+	//=====================================================================
+
+	/**
+	 * @brief Letter case handling of a regular expression
+	 */
+	enum class RegexCase : std::uint8_t
+	{
+		/** @brief Bytes must match exactly */
+		Sensitive,
+
+		/** @brief ASCII letters match regardless of case, in literals and classes alike */
+		Insensitive
+	};
+
+	namespace detail
+	{
+		/** @brief Thompson NFA whose transitions consume one byte from a set */
+		struct RegexNfa
+		{
+			/** @brief Kind of an NFA state */
+			enum class Kind : std::uint8_t
+			{
+				/** @brief Consumes one byte of sets[set], then continues at out */
+				Byte,
+
+				/** @brief Continues at both out and out1 without consuming */
+				Split,
+
+				/** @brief Accepts */
+				Match
+			};
+
+			/** @brief One NFA state */
+			struct State
+			{
+				Kind kind;
+				std::uint32_t set;
+				std::uint32_t out;
+				std::uint32_t out1;
+			};
+
+			std::vector<State> states;
+			std::uint32_t start = 0;
+		};
+
+		/**
+		 * @brief DFA built lazily from a RegexNfa
+		 * @details A DFA state is the epsilon closure of a set of NFA states. Transitions are
+		 *          computed on first use and stored per byte class; when the cache holds too many
+		 *          states it is flushed and rebuilt from the state in use. An unanchored DFA adds the
+		 *          NFA start state back after every byte, so it finds matches starting anywhere.
+		 *          A state is named by the offset of its transition row, so a step is a single
+		 *          table load. The dead state comes first and the start state second.
+		 */
+		class RegexDfa
+		{
+		public:
+			/** @brief State from which no match is reachable */
+			static constexpr std::int32_t dead = 0;
+
+			inline void reset( const RegexNfa& nfa, std::size_t classCount, bool unanchored );
+
+			inline std::int32_t start() const noexcept;
+
+			inline std::int32_t step( const RegexNfa& nfa, const std::vector<std::array<std::uint64_t, 4>>& sets,
+				const std::array<std::uint8_t, 256>& classes, std::int32_t state, unsigned char byte );
+
+			inline bool isAccepting( std::int32_t state ) const noexcept;
+
+			inline std::int32_t adopt( const RegexNfa& nfa, const RegexDfa& other, std::int32_t state );
+
+		private:
+			inline std::int32_t computeStep( const RegexNfa& nfa, const std::vector<std::array<std::uint64_t, 4>>& sets,
+				std::int32_t state, unsigned char byte, std::size_t index );
+			inline void addClosure( const RegexNfa& nfa, std::uint32_t state, std::vector<std::uint32_t>& members );
+			inline std::int32_t intern( const RegexNfa& nfa, std::vector<std::uint32_t>& members );
+			inline void clear( const RegexNfa& nfa );
+			inline void nextGeneration() noexcept;
+
+			std::vector<std::int32_t> m_transitions;
+			std::vector<std::vector<std::uint32_t>> m_members;
+			std::vector<std::uint8_t> m_accepting;
+			std::unordered_map<std::string, std::int32_t> m_ids;
+			std::vector<std::uint32_t> m_startMembers;
+			std::vector<std::uint32_t> m_marks;
+			std::vector<std::uint32_t> m_stack;
+			std::uint32_t m_generation = 0;
+			std::size_t m_classCount = 1;
+			bool m_unanchored = false;
+		};
+
+		/**
+		 * @brief Pool of lazy DFA caches shared by the const matching methods of a Regex
+		 * @details Every matching call leases a set of caches for its duration, so threads sharing
+		 *          one Regex never grow the same DFA. A lease takes the most recently returned set,
+		 *          or copies the freshly reset prototype when all are in use; returned sets are kept
+		 *          on an intrusive list, so giving one back never allocates. Copying a pool copies
+		 *          the prototype only.
+		 */
+		class RegexCachePool
+		{
+		public:
+			/** @brief The DFAs one matching call steps through */
+			struct Caches
+			{
+				RegexDfa anchored;
+				RegexDfa search;
+				RegexDfa reverse;
+				std::unique_ptr<Caches> next;
+			};
+
+			/** @brief Exclusive use of one set of caches, returned to the pool on destruction */
+			class Lease
+			{
+			public:
+				inline Lease( const RegexCachePool& pool, std::unique_ptr<Caches> caches ) noexcept;
+				Lease( const Lease& ) = delete;
+				Lease& operator=( const Lease& ) = delete;
+				inline ~Lease();
+
+				inline Caches& operator*() const noexcept;
+				inline Caches* operator->() const noexcept;
+
+			private:
+				const RegexCachePool& m_pool;
+				std::unique_ptr<Caches> m_caches;
+			};
+
+			RegexCachePool() = default;
+			inline RegexCachePool( const RegexCachePool& other );
+			inline RegexCachePool& operator=( const RegexCachePool& other );
+
+			inline Caches& prototype() noexcept;
+
+			inline Lease acquire() const;
+
+		private:
+			Caches m_prototype;
+			mutable std::mutex m_mutex;
+			mutable std::unique_ptr<Caches> m_free;
+		};
+	} // namespace detail
+
+	class RegexSplitter;
+
+	//=====================================================================
+	// Regex class
+	//=====================================================================
+
+	/**
+	 * @brief Compiled regular expression
+	 * @details Construction never throws on a malformed pattern; the result is invalid (see
+	 *          isValid()) and matches nothing. Matching grows internal DFA caches leased from a pool
+	 *          for each call, so one const Regex may be shared by several threads; each thread
+	 *          that matches concurrently warms up a cache of its own.
+	 *          A literal that every match must start with is located with std::string_view::find
+	 *          before the DFA runs, and likewise a literal every match must end with.
+	 */
+	class Regex
+	{
+		friend class RegexSplitter;
+
+	public:
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Constructs an invalid expression that matches nothing
+		 */
+		Regex() = default;
+
+		/**
+		 * @brief Compiles a regular expression
+		 * @param pattern Pattern text
+		 * @param caseMode Letter case handling
+		 * @details '^' and '$' are only accepted as the first and last character of the pattern,
+		 *          and not together with a top-level '|' (write "^(a|b)$" instead). Bounded
+		 *          repetitions are limited to 1000 and the compiled program to a fixed size.
+		 */
+		inline explicit Regex( std::string_view pattern, RegexCase caseMode = RegexCase::Sensitive );
+
+		//----------------------------------------------
+		// Matching
+		//----------------------------------------------
+
+		/**
+		 * @brief Check whether a whole string matches the expression
+		 * @param str String to test
+		 * @return True if the expression matches all of str
+		 * @details Example: Regex{ "[a-z]+-\\d+" }.matches( "build-42" ) returns true
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline bool matches( std::string_view str ) const;
+
+		/**
+		 * @brief Check whether any part of a string matches the expression
+		 * @param str String to search
+		 * @return True if some substring of str matches (respecting '^' and '$')
+		 * @details Stops at the first byte where a match is known to exist.
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline bool search( std::string_view str ) const;
+
+		/**
+		 * @brief Find the leftmost-longest match at or after a position
+		 * @param str String to search
+		 * @param pos Position where the search starts
+		 * @param match Receives the matched part of str on success
+		 * @return True if a match was found
+		 * @details Reads from pos up to the earliest match end and back, then past the match as
+		 *          far as a longer one could extend, so iterating over the matches of typical input
+		 *          is linear; see the file description for the worst case.
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline bool find( std::string_view str, std::size_t pos, std::string_view& match ) const;
+
+		//----------------------------------------------
+		// Access
+		//----------------------------------------------
+
+		/**
+		 * @brief Check whether the pattern compiled
+		 * @return False for a malformed pattern or a default-constructed expression
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline bool isValid() const noexcept;
+
+		/**
+		 * @brief Source text of the expression
+		 * @return The pattern as passed to the constructor
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::string_view pattern() const noexcept;
+
+		/**
+		 * @brief Letter case handling of the expression
+		 * @return The case mode passed to the constructor
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline RegexCase caseMode() const noexcept;
+
+	private:
+		using Caches = detail::RegexCachePool::Caches;
+
+		inline std::int32_t step( detail::RegexDfa& dfa, const detail::RegexNfa& nfa, std::int32_t state, char c ) const;
+		inline bool matches( Caches& caches, std::string_view str ) const;
+		inline std::size_t earliestEnd( Caches& caches, std::string_view str, std::size_t pos ) const;
+		inline std::size_t leftmostStart( Caches& caches, std::string_view str, std::size_t pos ) const;
+		inline std::size_t endBefore( Caches& caches, std::string_view str, std::size_t pos, std::size_t limit ) const;
+		inline void scanStarts( Caches& caches, std::string_view str, std::size_t pos, std::size_t end,
+			std::vector<std::uint64_t>* starts, std::size_t& first ) const;
+		inline std::size_t longestEnd( Caches& caches, std::string_view str, std::size_t pos ) const;
+		inline bool nextMatch( std::string_view str, const std::vector<std::uint64_t>& starts, std::size_t pos,
+			std::size_t& begin, std::size_t& end ) const;
+
+		std::string m_pattern;
+		detail::RegexNfa m_forward;
+		detail::RegexNfa m_reverse;
+		std::vector<std::array<std::uint64_t, 4>> m_sets;
+		std::array<std::uint8_t, 256> m_classes{};
+		std::string m_prefix;
+		std::string m_suffix;
+		detail::RegexCachePool m_caches;
+		RegexCase m_case = RegexCase::Sensitive;
+		bool m_anchoredStart = false;
+		bool m_anchoredEnd = false;
+		bool m_valid = false;
+	};
+
+	//=====================================================================
+	// RegexSplitter class
+	//=====================================================================
+
+	/**
+	 * @brief Zero-copy splitting of a string at every match of a regular expression
+	 * @details Yields the std::string_view pieces between non-empty matches, like Splitter does
+	 *          for a single character; empty matches never split. Match starts are located by
+	 *          one backward DFA pass at construction, which allocates one bit per input byte; the
+	 *          end of each match is found forwards from its start, which is quadratic in the worst
+	 *          case described for Regex.h.
+	 *          The string must outlive the splitter, and so must an expression passed by lvalue.
+	 */
+	class RegexSplitter
+	{
+	public:
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Construct splitter for the given string and expression
+		 * @param str String to split
+		 * @param regex Separator expression
+		 */
+		inline RegexSplitter( std::string_view str, const Regex& regex );
+
+		/**
+		 * @brief Construct splitter that keeps its expression alive
+		 * @param str String to split
+		 * @param regex Separator expression, owned by the splitter and its copies
+		 */
+		inline RegexSplitter( std::string_view str, Regex&& regex );
+
+		//----------------------------------------------
+		// RegexSplitter::Iterator class
+		//----------------------------------------------
+
+		/**
+		 * @brief Forward iterator over the pieces of the string
+		 */
+		class Iterator
+		{
+		public:
+			//-----------------------------
+			// Iterator traits
+			//-----------------------------
+
+			using iterator_category = std::forward_iterator_tag;
+			using value_type = std::string_view;
+			using difference_type = std::ptrdiff_t;
+			using pointer = const std::string_view*;
+			using reference = const std::string_view&;
+
+			//-----------------------------
+			// Construction
+			//-----------------------------
+
+			/**
+			 * @brief Construct iterator for the given splitter
+			 * @param splitter Splitter to iterate over
+			 * @param atEnd True to construct the end iterator
+			 */
+			inline Iterator( const RegexSplitter& splitter, bool atEnd = false );
+
+			//-----------------------------
+			// Iterator operators
+			//-----------------------------
+
+			/**
+			 * @brief Get current piece
+			 * @return The part of the string between the previous and the next separator match
+			 */
+			[[nodiscard]] inline std::string_view operator*() const noexcept;
+
+			/**
+			 * @brief Advance to next piece
+			 * @return Reference to this iterator
+			 */
+			inline Iterator& operator++();
+
+			/**
+			 * @brief Advance to next piece (post-increment)
+			 * @return Copy of iterator before advancing
+			 */
+			inline Iterator operator++( int );
+
+			//-----------------------------
+			// Comparison operators
+			//-----------------------------
+
+			/**
+			 * @brief Compare iterators for equality
+			 * @param other Iterator to compare with
+			 * @return True if both iterators are at the same position
+			 */
+			[[nodiscard]] inline bool operator==( const Iterator& other ) const noexcept;
+
+			/**
+			 * @brief Compare iterators for inequality
+			 * @param other Iterator to compare with
+			 * @return True if iterators are at different positions
+			 */
+			[[nodiscard]] inline bool operator!=( const Iterator& other ) const noexcept;
+
+		private:
+			inline void findSeparator( std::size_t pos );
+
+			const RegexSplitter* m_splitter;
+			std::size_t m_start;
+			std::size_t m_end;
+			std::size_t m_next;
+			bool m_isLast;
+			bool m_isAtEnd;
+		};
+
+		//----------------------------------------------
+		// Iteration
+		//----------------------------------------------
+
+		/**
+		 * @brief Get iterator to first piece
+		 * @return Iterator to the first piece, or end() for an empty string
+		 */
+		[[nodiscard]] inline Iterator begin() const;
+
+		/**
+		 * @brief Get end iterator
+		 * @return Iterator representing end of iteration
+		 */
+		[[nodiscard]] inline Iterator end() const;
+
+	private:
+		inline void locateStarts();
+
+		std::string_view m_str;
+		std::shared_ptr<const Regex> m_owned;
+		const Regex* m_regex;
+		std::vector<std::uint64_t> m_starts;
+	};
+
+	//=====================================================================
+	// Regular expression functions
+	//=====================================================================
+
+	/**
+	 * @brief Check whether a whole string matches a regular expression
+	 * @param str String to test
+	 * @param regex Compiled expression
+	 * @return True if regex matches all of str
+	 * @details Example: regexMatch( "ERROR 42", Regex{ "(ERROR|WARN) \\d+" } ) returns true
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline bool regexMatch( std::string_view str, const Regex& regex );
+
+	/**
+	 * @brief Check whether a whole string matches a pattern
+	 * @param str String to test
+	 * @param pattern Pattern text, compiled for this call only
+	 * @return True if the pattern is valid and matches all of str
+	 * @details Parses the pattern, builds its NFA and starts an empty DFA on every call, so no
+	 *          transition is reused between calls and a loop over this overload never reaches the
+	 *          cached fast path. Construct a Regex once and call regexMatch( str, regex ) instead.
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline bool regexMatch( std::string_view str, std::string_view pattern );
+
+	/**
+	 * @brief Check whether any part of a string matches a regular expression
+	 * @param str String to search
+	 * @param regex Compiled expression
+	 * @return True if some substring of str matches
+	 * @details Example: regexSearch( "disk /dev/sda1 failed", Regex{ "sd[a-z]\\d" } ) returns true
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline bool regexSearch( std::string_view str, const Regex& regex );
+
+	/**
+	 * @brief Check whether any part of a string matches a pattern
+	 * @param str String to search
+	 * @param pattern Pattern text, compiled for this call only
+	 * @return True if the pattern is valid and some substring of str matches
+	 * @details Recompiles the pattern on every call, like regexMatch( str, pattern ); use a
+	 *          Regex for repeated searches.
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline bool regexSearch( std::string_view str, std::string_view pattern );
+
+	/**
+	 * @brief Replace every non-empty match of a regular expression
+	 * @param str Source string
+	 * @param regex Compiled expression
+	 * @param replacement Text inserted in place of each match, copied literally
+	 * @return Copy of str with the leftmost-longest non-overlapping matches replaced
+	 * @details Example: regexReplace( "id=123 id=45", Regex{ "\\d+" }, "#" ) returns "id=# id=#"
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline std::string regexReplace( std::string_view str, const Regex& regex, std::string_view replacement );
+
+	/**
+	 * @brief Replace every non-empty match of a pattern
+	 * @param str Source string
+	 * @param pattern Pattern text, compiled for this call only
+	 * @param replacement Text inserted in place of each match, copied literally
+	 * @return Copy of str with the matches replaced; str unchanged if the pattern is invalid
+	 * @details Recompiles the pattern on every call, like regexMatch( str, pattern ); use a
+	 *          Regex for repeated replacements.
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline std::string regexReplace( std::string_view str, std::string_view pattern, std::string_view replacement );
+
+	/**
+	 * @brief Split a string at every non-empty match of a regular expression
+	 * @param str String to split
+	 * @param regex Separator expression; must outlive the returned splitter
+	 * @return RegexSplitter yielding std::string_view pieces
+	 * @details Example: regexSplit( "a, b;c", Regex{ "[,;] *" } ) yields "a", "b", "c"
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline RegexSplitter regexSplit( std::string_view str, const Regex& regex );
+
+	/**
+	 * @brief Split a string at every non-empty match of a pattern
+	 * @param str String to split; must outlive the returned splitter
+	 * @param pattern Pattern text, compiled for this call only and owned by the splitter
+	 * @return RegexSplitter yielding std::string_view pieces; the whole of str if the pattern is invalid
+	 * @details Recompiles the pattern on every call, like regexMatch( str, pattern ); use a
+	 *          Regex for repeated splits.
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline RegexSplitter regexSplit( std::string_view str, std::string_view pattern );
+} // namespace nfx::string
+
+#include "nfx/detail/string/Regex.inl"
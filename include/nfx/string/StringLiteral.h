@@ -0,0 +1,159 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file StringLiteral.h
+ * @brief Compile-time string literals as template arguments, and searches specialized on them
+ * @details StringLiteral is a structural type, so a string literal can be passed as a non-type
+ *          template parameter: containsLit<"ERROR">( line ). Everything that depends only on
+ *          the pattern - its length, the bytes broadcast into SIMD registers and the skip table
+ *          of the scalar search - is then computed at compile time instead of on every call.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace nfx::string
+{
+	//=====================================================================
+	// StringLiteral class
+	//=====================================================================
+
+	/**
+	 * @brief String literal usable as a non-type template parameter
+	 * @tparam N Size of the literal, including its null terminator
+	 * @details All members are public as required of a structural type. Two template arguments
+	 *          are the same when their characters are equal.
+	 */
+	template <std::size_t N>
+	struct StringLiteral
+	{
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Constructs from a string literal
+		 * @param str Literal to copy
+		 */
+		inline constexpr StringLiteral( const char ( &str )[N] ) noexcept;
+
+		//----------------------------------------------
+		// Access
+		//----------------------------------------------
+
+		/**
+		 * @brief Number of characters, excluding the null terminator
+		 * @return N - 1
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] static inline constexpr std::size_t size() noexcept;
+
+		/**
+		 * @brief View of the characters
+		 * @return std::string_view of size() characters
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr std::string_view view() const noexcept;
+
+		/** @brief Characters followed by a null terminator */
+		char value[N]{};
+	};
+
+	//=====================================================================
+	// Literal pattern operations
+	//=====================================================================
+
+	/**
+	 * @brief Check if string contains a literal substring
+	 * @tparam Needle Substring to find
+	 * @param str String to search in
+	 * @return True if Needle occurs in str; always true for an empty Needle
+	 * @details Same result as contains( str, Needle ), with the search set up at compile time.
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	template <StringLiteral Needle>
+	[[nodiscard]] inline constexpr bool containsLit( std::string_view str ) noexcept;
+
+	/**
+	 * @brief Check if string starts with a literal prefix
+	 * @tparam Prefix Prefix to check for
+	 * @param str String to check
+	 * @return True if str starts with Prefix
+	 * @details Compiles to a fixed-size comparison.
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	template <StringLiteral Prefix>
+	[[nodiscard]] inline constexpr bool startsWithLit( std::string_view str ) noexcept;
+
+	/**
+	 * @brief Check if string ends with a literal suffix
+	 * @tparam Suffix Suffix to check for
+	 * @param str String to check
+	 * @return True if str ends with Suffix
+	 * @details Compiles to a fixed-size comparison.
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	template <StringLiteral Suffix>
+	[[nodiscard]] inline constexpr bool endsWithLit( std::string_view str ) noexcept;
+
+	/**
+	 * @brief Find first occurrence of a literal substring
+	 * @tparam Needle Substring to find
+	 * @param str String to search in
+	 * @return Index of first occurrence, or std::string_view::npos if not found
+	 * @details Same result as indexOf( str, Needle ).
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	template <StringLiteral Needle>
+	[[nodiscard]] inline constexpr std::size_t indexOfLit( std::string_view str ) noexcept;
+
+	/**
+	 * @brief Count non-overlapping occurrences of a literal substring
+	 * @tparam Needle Substring to count
+	 * @param str String to search in
+	 * @return Number of non-overlapping occurrences; 0 for an empty Needle
+	 * @details Same result as count( str, Needle ).
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	template <StringLiteral Needle>
+	[[nodiscard]] inline constexpr std::size_t countLit( std::string_view str ) noexcept;
+
+	/**
+	 * @brief Replace all occurrences of a literal substring with a literal replacement
+	 * @tparam OldStr Substring to replace
+	 * @tparam NewStr Replacement string
+	 * @param str String to search in
+	 * @return New string with all non-overlapping occurrences replaced
+	 * @details Same result as replaceAll( str, OldStr, NewStr ).
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	template <StringLiteral OldStr, StringLiteral NewStr>
+	[[nodiscard]] inline std::string replaceAllLit( std::string_view str );
+} // namespace nfx::string
+
+#include "nfx/detail/string/StringLiteral.inl"
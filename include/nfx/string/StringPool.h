@@ -0,0 +1,227 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file StringPool.h
+ * @brief Thread-safe string interning with stable handles
+ * @details Interned strings are stored once in an append-only arena and identified by a
+ *          pointer-sized handle, so equality of interned strings is a pointer compare and the
+ *          bytes stay valid for the lifetime of the pool. Lookups are lock-free; insertions
+ *          lock one of several shards selected by hash.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string_view>
+
+namespace nfx::string
+{
+	namespace detail
+	{
+		struct StringPoolEntry;
+	} // namespace detail
+
+	//=====================================================================
+	// InternedString class
+	//=====================================================================
+
+	/**
+	 * @brief Handle to a string stored in a StringPool
+	 * @details Trivially copyable and pointer-sized. Two handles from the same pool are equal
+	 *          exactly when their strings are equal. The default handle is the empty string,
+	 *          which is also what interning "" returns.
+	 */
+	class InternedString
+	{
+	public:
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Constructs the empty string handle
+		 */
+		constexpr InternedString() noexcept = default;
+
+		//----------------------------------------------
+		// Access
+		//----------------------------------------------
+
+		/**
+		 * @brief Interned bytes
+		 * @return View valid for the lifetime of the owning pool
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::string_view view() const noexcept;
+
+		/**
+		 * @brief Pointer to the interned bytes, followed by a null terminator
+		 * @return Null-terminated character data
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline const char* c_str() const noexcept;
+
+		/**
+		 * @brief Length of the interned string
+		 * @return Number of bytes
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::size_t size() const noexcept;
+
+		/**
+		 * @brief Check for the empty string
+		 * @return True if the handle refers to ""
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline bool empty() const noexcept;
+
+		/**
+		 * @brief Hash computed when the string was interned
+		 * @return Hash value; no bytes are read
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::size_t hash() const noexcept;
+
+		/**
+		 * @brief Implicit conversion to std::string_view
+		 * @return Same as view()
+		 */
+		inline operator std::string_view() const noexcept;
+
+		//----------------------------------------------
+		// Comparison
+		//----------------------------------------------
+
+		/**
+		 * @brief Compares handles of the same pool
+		 * @param other Handle to compare with
+		 * @return True if both refer to the same interned string
+		 */
+		inline bool operator==( const InternedString& other ) const noexcept;
+
+	private:
+		friend class StringPool;
+
+		inline explicit InternedString( const detail::StringPoolEntry* entry ) noexcept;
+
+		const detail::StringPoolEntry* m_entry{ nullptr };
+	};
+
+	//=====================================================================
+	// StringPool class
+	//=====================================================================
+
+	/**
+	 * @brief Thread-safe pool of interned strings
+	 * @details Each string is stored once, with its length and hash, in an append-only arena
+	 *          of 64 KiB blocks. Lookups probe an open-addressing table with acquire loads and
+	 *          never lock. Insertions lock one of 16 shards; a shard grows by publishing a
+	 *          doubled table and keeps the old one alive, so concurrent readers never see freed
+	 *          memory. Nothing is released before the pool is destroyed.
+	 *          intern(), tryFind() and size() may be called concurrently from any thread.
+	 */
+	class StringPool
+	{
+	public:
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Constructs an empty pool
+		 */
+		inline StringPool();
+
+		/**
+		 * @brief Destroys the pool and every string it holds
+		 * @details All handles and views obtained from the pool become dangling.
+		 */
+		inline ~StringPool();
+
+		StringPool( const StringPool& ) = delete;
+		StringPool& operator=( const StringPool& ) = delete;
+
+		//----------------------------------------------
+		// Interning
+		//----------------------------------------------
+
+		/**
+		 * @brief Intern a string
+		 * @param str Bytes to intern; may contain null characters
+		 * @return Handle to the pooled copy of str
+		 * @details Strings already in the pool are found without locking or allocating.
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline InternedString intern( std::string_view str );
+
+		/**
+		 * @brief Look up a string without adding it
+		 * @param str Bytes to look up
+		 * @param result Receives the handle if str is in the pool
+		 * @return True if str has been interned
+		 * @details Lock-free; useful for untrusted keys that must not grow the pool. The empty
+		 *          string is always found.
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline bool tryFind( std::string_view str, InternedString& result ) const noexcept;
+
+		//----------------------------------------------
+		// Statistics
+		//----------------------------------------------
+
+		/**
+		 * @brief Number of distinct non-empty strings in the pool
+		 * @return String count
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::size_t size() const noexcept;
+
+	private:
+		struct Shard;
+
+		std::unique_ptr<Shard[]> m_shards;
+	};
+} // namespace nfx::string
+
+//=====================================================================
+// std::hash specialization
+//=====================================================================
+
+/**
+ * @brief Hashes an InternedString by its stored hash, without reading the bytes
+ */
+template <>
+struct std::hash<nfx::string::InternedString>
+{
+	std::size_t operator()( const nfx::string::InternedString& str ) const noexcept
+	{
+		return str.hash();
+	}
+};
+
+#include "nfx/detail/string/StringPool.inl"
@@ -0,0 +1,339 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Unicode.h
+ * @brief Unicode-aware text processing over UTF-8
+ * @details Case mapping, case-insensitive comparison, normalization and terminal display width
+ *          driven by Unicode Character Database tables generated at build-maintenance time
+ *          (scripts/generate_unicode_tables.pl).
+ *          Pure-ASCII runs take SIMD fast paths; other codepoints go through compact two-stage
+ *          tables. Ill-formed UTF-8 is never rejected: each offending byte is passed through
+ *          unchanged and compares as a distinct value.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "nfx/string/Utf8.h"
+
+namespace nfx::string
+{
+	//=====================================================================
+	// Unicode text processing
+	//=====================================================================
+
+	//----------------------------------------------
+	// Codepoint case mapping
+	//----------------------------------------------
+
+	/**
+	 * @brief Simple case folding of a codepoint
+	 * @param codepoint Unicode codepoint
+	 * @return The folded codepoint (CaseFolding.txt status C and S), or codepoint if it has none
+	 * @details Folding maps every case variant to one representative for caseless matching:
+	 *          U+212A KELVIN SIGN and 'K' both fold to 'k', final sigma folds to sigma.
+	 *          Mappings that expand (U+00DF to "ss") are not applied.
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline constexpr char32_t caseFoldCodepoint( char32_t codepoint ) noexcept;
+
+	/**
+	 * @brief Simple lowercase mapping of a codepoint
+	 * @param codepoint Unicode codepoint
+	 * @return The lowercase codepoint from UnicodeData.txt, or codepoint if it has none
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline constexpr char32_t toLowerCodepoint( char32_t codepoint ) noexcept;
+
+	/**
+	 * @brief Simple uppercase mapping of a codepoint
+	 * @param codepoint Unicode codepoint
+	 * @return The uppercase codepoint from UnicodeData.txt, or codepoint if it has none
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline constexpr char32_t toUpperCodepoint( char32_t codepoint ) noexcept;
+
+	//----------------------------------------------
+	// String case mapping
+	//----------------------------------------------
+
+	/**
+	 * @brief Apply simple case folding to a UTF-8 string
+	 * @param str UTF-8 string to fold
+	 * @return New string with every codepoint folded
+	 * @details ASCII runs are folded 16 bytes at a time. The byte length can change, for example
+	 *          U+212A KELVIN SIGN (3 bytes) folds to 'k'. Ill-formed bytes are copied unchanged.
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline std::string utf8CaseFold( std::string_view str );
+
+	/**
+	 * @brief Convert a UTF-8 string to lowercase using simple case mappings
+	 * @param str UTF-8 string to convert
+	 * @return New string with every codepoint lowercased
+	 * @details Unicode counterpart of toLower(std::string_view), which only maps ASCII letters.
+	 *          Example: utf8ToLower("\xC3\x89COLE") returns "\xC3\xA9cole" (E with acute accent)
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline std::string utf8ToLower( std::string_view str );
+
+	/**
+	 * @brief Convert a UTF-8 string to uppercase using simple case mappings
+	 * @param str UTF-8 string to convert
+	 * @return New string with every codepoint uppercased
+	 * @details Mappings that expand (U+00DF to "SS") are not applied.
+	 *          Example: utf8ToUpper("na\xC3\xAFve") returns "NA\xC3\x8FVE"
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline std::string utf8ToUpper( std::string_view str );
+
+	//----------------------------------------------
+	// Case-insensitive comparison
+	//----------------------------------------------
+
+	/**
+	 * @brief Case-insensitive equality of UTF-8 strings
+	 * @param lhs First string
+	 * @param rhs Second string
+	 * @return True if both strings are equal after simple case folding
+	 * @details Folds incrementally without allocating; equal ASCII runs are compared 16 bytes at
+	 *          a time. Strings of different byte length can match: U+212A KELVIN SIGN equals "k".
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline bool iequalsUtf8( std::string_view lhs, std::string_view rhs ) noexcept;
+
+	/**
+	 * @brief Case-insensitive three-way comparison of UTF-8 strings
+	 * @param lhs First string
+	 * @param rhs Second string
+	 * @return Negative if lhs orders before rhs, zero if equal, positive otherwise
+	 * @details Compares the simple case-folded codepoint sequences in codepoint order, so a
+	 *          proper prefix orders first. This is not locale collation.
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline int icompareUtf8( std::string_view lhs, std::string_view rhs ) noexcept;
+
+	//----------------------------------------------
+	// Normalization
+	//----------------------------------------------
+
+	/**
+	 * @brief Unicode normalization forms (UAX #15)
+	 */
+	enum class NormalizationForm : std::uint8_t
+	{
+		/** @brief Canonical decomposition followed by canonical composition */
+		NFC,
+
+		/** @brief Canonical decomposition */
+		NFD,
+
+		/** @brief Compatibility decomposition followed by canonical composition */
+		NFKC,
+
+		/** @brief Compatibility decomposition */
+		NFKD
+	};
+
+	/**
+	 * @brief Result of a normalization quick check
+	 */
+	enum class NormalizationCheck : std::uint8_t
+	{
+		/** @brief The string is normalized */
+		Yes,
+
+		/** @brief The string is not normalized */
+		No,
+
+		/** @brief The quick check cannot decide; only NFC and NFKC answer Maybe */
+		Maybe
+	};
+
+	/**
+	 * @brief Quick check whether a UTF-8 string is in a normalization form
+	 * @param str UTF-8 string to check
+	 * @param form Normalization form to check against
+	 * @return Yes, No, or Maybe when a full normalization is needed to decide
+	 * @details Single pass over the quick-check property and combining classes, without
+	 *          allocating. ASCII runs are skipped with vector instructions.
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline NormalizationCheck utf8QuickCheck( std::string_view str, NormalizationForm form = NormalizationForm::NFC ) noexcept;
+
+	/**
+	 * @brief Check whether a UTF-8 string is in a normalization form
+	 * @param str UTF-8 string to check
+	 * @param form Normalization form to check against
+	 * @return True if normalizing str would leave it unchanged
+	 * @details Runs utf8QuickCheck() and only normalizes when it answers Maybe.
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline bool utf8IsNormalized( std::string_view str, NormalizationForm form = NormalizationForm::NFC );
+
+	/**
+	 * @brief Normalize a UTF-8 string
+	 * @param str UTF-8 string to normalize
+	 * @param form Target normalization form
+	 * @return New string in the requested form
+	 * @details Text that passes the quick check is copied verbatim; only the segments around
+	 *          codepoints that may change are decomposed, reordered and recomposed. Ill-formed
+	 *          bytes are copied unchanged and act as starters.
+	 *          Example: utf8Normalize("e\xCC\x81") returns "\xC3\xA9" (e with acute accent)
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline std::string utf8Normalize( std::string_view str, NormalizationForm form = NormalizationForm::NFC );
+
+	/**
+	 * @brief Normalize a UTF-8 string in place
+	 * @param str UTF-8 string to normalize
+	 * @param form Target normalization form
+	 * @return True if str was modified
+	 * @details Does not allocate when str already passes the quick check, which makes it the
+	 *          cheapest way to canonicalize identifiers that are almost always normalized.
+	 */
+	inline bool utf8NormalizeInPlace( std::string& str, NormalizationForm form = NormalizationForm::NFC );
+
+	//=====================================================================
+	// Utf8Normalizer class
+	//=====================================================================
+
+	/**
+	 * @brief Streaming UTF-8 normalizer for documents processed in chunks
+	 * @details Chunks may split codepoints and combining sequences anywhere; the output of
+	 *          append() calls followed by finish() equals utf8Normalize() of the concatenated
+	 *          input. Only the text after the last stable boundary is buffered.
+	 */
+	class Utf8Normalizer
+	{
+	public:
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Constructs a normalizer for the given form
+		 * @param form Target normalization form
+		 */
+		inline explicit Utf8Normalizer( NormalizationForm form = NormalizationForm::NFC ) noexcept;
+
+		//----------------------------------------------
+		// Streaming
+		//----------------------------------------------
+
+		/**
+		 * @brief Normalize the next chunk of input
+		 * @param chunk Next bytes of the UTF-8 input
+		 * @param output String the normalized text is appended to
+		 * @details Appends everything up to the last stable boundary seen so far and keeps the
+		 *          remainder, which later input could still combine with.
+		 */
+		inline void append( std::string_view chunk, std::string& output );
+
+		/**
+		 * @brief Flush the buffered input at the end of the document
+		 * @param output String the normalized text is appended to
+		 * @details The normalizer is reset and can be reused for another document.
+		 */
+		inline void finish( std::string& output );
+
+		/**
+		 * @brief Target normalization form
+		 * @return The form passed at construction
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline NormalizationForm form() const noexcept;
+
+	private:
+		NormalizationForm m_form;
+		std::string m_pending;
+	};
+
+	//=====================================================================
+	// Display width
+	//=====================================================================
+
+	/**
+	 * @brief Placement of text padded to a display width
+	 */
+	enum class TextAlignment : std::uint8_t
+	{
+		/** @brief Text first, padding on the right */
+		Left,
+
+		/** @brief Padding first, text on the right */
+		Right,
+
+		/** @brief Padding split on both sides; the extra column goes right */
+		Center
+	};
+
+	/**
+	 * @brief Number of terminal columns a UTF-8 string occupies
+	 * @param str UTF-8 string to measure
+	 * @return Sum of the widths of its extended grapheme clusters (UAX #29)
+	 * @details A cluster is as wide as its widest codepoint: two columns for East_Asian_Width
+	 *          Wide and Fullwidth, zero for combining marks, format and control characters, one
+	 *          otherwise. Emoji sequences joined by ZWJ, flags, and pictographs followed by
+	 *          U+FE0F VARIATION SELECTOR-16 take two columns. Control characters, including tab,
+	 *          count as zero. Ill-formed bytes count one column each. Printable ASCII is counted
+	 *          16 bytes at a time.
+	 *          Example: displayWidth("\xE4\xB8\xAD\xE6\x96\x87 ok") returns 7
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline std::size_t displayWidth( std::string_view str ) noexcept;
+
+	/**
+	 * @brief Pad a UTF-8 string to a display width
+	 * @param str UTF-8 string to pad
+	 * @param width Target width in terminal columns
+	 * @param alignment Where the text goes within the padded width
+	 * @param fillChar Character to use for padding (one column per character)
+	 * @return Padded string. Returns original if it is already at least width columns wide.
+	 * @details Column-aware counterpart of padRight(), padLeft() and center(), which count bytes.
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline std::string padDisplay( std::string_view str, std::size_t width, TextAlignment alignment = TextAlignment::Left, char fillChar = ' ' );
+
+	/**
+	 * @brief Truncate a UTF-8 string to a display width
+	 * @param str UTF-8 string to truncate
+	 * @param width Maximum width in terminal columns
+	 * @param ellipsis Marker appended when text is cut (default: U+2026 HORIZONTAL ELLIPSIS)
+	 * @return str if it fits, otherwise the longest prefix of whole grapheme clusters that fits
+	 *         together with the ellipsis, followed by the ellipsis
+	 * @details Never splits a codepoint or a grapheme cluster; a wide character that does not fit
+	 *          is dropped whole, so the result can be one column narrower than width. If the
+	 *          ellipsis itself is wider than width it is omitted.
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline std::string truncateDisplay( std::string_view str, std::size_t width, std::string_view ellipsis = "\xE2\x80\xA6" );
+} // namespace nfx::string
+
+#include "nfx/detail/string/Unicode.inl"
@@ -0,0 +1,314 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Utf8.h
+ * @brief UTF-8 validation, codepoint counting and transcoding
+ * @details Provides validation of UTF-8 encoded text (RFC 3629), codepoint counting, and
+ *          conversion between UTF-8, UTF-16, UTF-32 and Latin-1 (ISO-8859-1) that run at memory
+ *          bandwidth using SIMD kernels when available. UTF-16 and UTF-32 use native byte order.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace nfx::string
+{
+	//=====================================================================
+	// UTF-8 utilities
+	//=====================================================================
+
+	//----------------------------------------------
+	// Validation
+	//----------------------------------------------
+
+	/**
+	 * @brief Check if string is well-formed UTF-8
+	 * @param str String to validate
+	 * @return True if str is valid UTF-8 (RFC 3629), false otherwise
+	 * @details Rejects overlong encodings, surrogates (U+D800-U+DFFF), codepoints above U+10FFFF
+	 *          and truncated sequences. Empty strings are valid. Pure-ASCII blocks are skipped
+	 *          32/64 bytes at a time; mixed blocks use the three-nibble lookup-table classifier
+	 *          with SSSE3/AVX2, or a scalar decoder otherwise.
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline bool utf8Valid( std::string_view str ) noexcept;
+
+	/**
+	 * @brief Check if string is well-formed UTF-8 and locate the first error
+	 * @param str String to validate
+	 * @param errorOffset Output offset of the first byte of the first ill-formed sequence,
+	 *                    or std::string_view::npos if the string is valid
+	 * @return True if str is valid UTF-8 (RFC 3629), false otherwise
+	 * @details Example: utf8Valid("ab\xC3", offset) returns false with offset == 2
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline bool utf8Valid( std::string_view str, std::size_t& errorOffset ) noexcept;
+
+	//----------------------------------------------
+	// Codepoint counting
+	//----------------------------------------------
+
+	/**
+	 * @brief Count Unicode codepoints in UTF-8 string
+	 * @param str UTF-8 string to measure
+	 * @return Number of codepoints in str
+	 * @details Counts every byte that is not a continuation byte (10xxxxxx) using vector compares
+	 *          with per-lane accumulation, or SWAR popcount without SIMD. The input is not
+	 *          validated: for ill-formed input the result is the number of non-continuation
+	 *          bytes. Example: utf8Length("h\xC3\xA9llo") returns 5
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline std::size_t utf8Length( std::string_view str ) noexcept;
+
+	//----------------------------------------------
+	// Output size prediction
+	//----------------------------------------------
+
+	/**
+	 * @brief Exact number of UTF-16 code units needed to hold UTF-8 input
+	 * @param utf8 Valid UTF-8 string
+	 * @return Number of char16_t units produced by transcoding utf8
+	 * @details Codepoints above U+FFFF take two units (surrogate pair). The result for UTF-32 or
+	 *          Latin-1 output is utf8Length(utf8).
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline std::size_t utf16LengthFromUtf8( std::string_view utf8 ) noexcept;
+
+	/**
+	 * @brief Exact number of UTF-8 bytes needed to hold UTF-16 input
+	 * @param utf16 Valid UTF-16 string
+	 * @return Number of bytes produced by transcoding utf16
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline std::size_t utf8LengthFromUtf16( std::u16string_view utf16 ) noexcept;
+
+	/**
+	 * @brief Exact number of UTF-8 bytes needed to hold UTF-32 input
+	 * @param utf32 Valid UTF-32 string
+	 * @return Number of bytes produced by transcoding utf32
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline std::size_t utf8LengthFromUtf32( std::u32string_view utf32 ) noexcept;
+
+	/**
+	 * @brief Exact number of UTF-8 bytes needed to hold Latin-1 input
+	 * @param latin1 Latin-1 (ISO-8859-1) string
+	 * @return Number of bytes produced by transcoding latin1 (bytes >= 0x80 take two)
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline std::size_t utf8LengthFromLatin1( std::string_view latin1 ) noexcept;
+
+	//----------------------------------------------
+	// Transcoding
+	//----------------------------------------------
+
+	//-----------------------------
+	// UTF-8 to UTF-16
+	//-----------------------------
+
+	/**
+	 * @brief Validating UTF-8 to UTF-16 conversion into a caller-provided buffer
+	 * @param utf8 UTF-8 input
+	 * @param output Destination buffer; utf16LengthFromUtf8(utf8) units are always enough
+	 * @param written Output number of units written (up to the first error on failure)
+	 * @return True on success, false if utf8 is ill-formed or output is too small
+	 * @details ASCII blocks are widened 16 bytes at a time; blocks of 1-2 byte sequences are
+	 *          decoded 8 bytes at a time with SSSE3.
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline bool tryUtf8ToUtf16( std::string_view utf8, std::span<char16_t> output, std::size_t& written ) noexcept;
+
+	/**
+	 * @brief Validating UTF-8 to UTF-16 conversion
+	 * @param utf8 UTF-8 input
+	 * @param result Output UTF-16 string, sized exactly
+	 * @return True on success, false if utf8 is ill-formed
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline bool tryUtf8ToUtf16( std::string_view utf8, std::u16string& result );
+
+	/**
+	 * @brief Non-validating UTF-8 to UTF-16 conversion into a caller-provided buffer
+	 * @param utf8 Input that must be valid UTF-8
+	 * @param output Destination buffer; never written past its end
+	 * @return Number of units written
+	 * @details Skips encoding checks for input already known to be valid (see utf8Valid()).
+	 *          Ill-formed input produces unspecified but bounded output.
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline std::size_t utf8ToUtf16Unchecked( std::string_view utf8, std::span<char16_t> output ) noexcept;
+
+	//-----------------------------
+	// UTF-16 to UTF-8
+	//-----------------------------
+
+	/**
+	 * @brief Validating UTF-16 to UTF-8 conversion into a caller-provided buffer
+	 * @param utf16 UTF-16 input
+	 * @param output Destination buffer; utf8LengthFromUtf16(utf16) bytes are always enough
+	 * @param written Output number of bytes written (up to the first error on failure)
+	 * @return True on success, false on unpaired surrogates or if output is too small
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline bool tryUtf16ToUtf8( std::u16string_view utf16, std::span<char> output, std::size_t& written ) noexcept;
+
+	/**
+	 * @brief Validating UTF-16 to UTF-8 conversion
+	 * @param utf16 UTF-16 input
+	 * @param result Output UTF-8 string, sized exactly
+	 * @return True on success, false on unpaired surrogates
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline bool tryUtf16ToUtf8( std::u16string_view utf16, std::string& result );
+
+	/**
+	 * @brief Non-validating UTF-16 to UTF-8 conversion into a caller-provided buffer
+	 * @param utf16 Input that must be valid UTF-16
+	 * @param output Destination buffer; never written past its end
+	 * @return Number of bytes written
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline std::size_t utf16ToUtf8Unchecked( std::u16string_view utf16, std::span<char> output ) noexcept;
+
+	//-----------------------------
+	// UTF-8 to UTF-32
+	//-----------------------------
+
+	/**
+	 * @brief Validating UTF-8 to UTF-32 conversion into a caller-provided buffer
+	 * @param utf8 UTF-8 input
+	 * @param output Destination buffer; utf8Length(utf8) units are always enough
+	 * @param written Output number of codepoints written (up to the first error on failure)
+	 * @return True on success, false if utf8 is ill-formed or output is too small
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline bool tryUtf8ToUtf32( std::string_view utf8, std::span<char32_t> output, std::size_t& written ) noexcept;
+
+	/**
+	 * @brief Validating UTF-8 to UTF-32 conversion
+	 * @param utf8 UTF-8 input
+	 * @param result Output UTF-32 string, sized exactly
+	 * @return True on success, false if utf8 is ill-formed
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline bool tryUtf8ToUtf32( std::string_view utf8, std::u32string& result );
+
+	/**
+	 * @brief Non-validating UTF-8 to UTF-32 conversion into a caller-provided buffer
+	 * @param utf8 Input that must be valid UTF-8
+	 * @param output Destination buffer; never written past its end
+	 * @return Number of codepoints written
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline std::size_t utf8ToUtf32Unchecked( std::string_view utf8, std::span<char32_t> output ) noexcept;
+
+	//-----------------------------
+	// UTF-32 to UTF-8
+	//-----------------------------
+
+	/**
+	 * @brief Validating UTF-32 to UTF-8 conversion into a caller-provided buffer
+	 * @param utf32 UTF-32 input
+	 * @param output Destination buffer; utf8LengthFromUtf32(utf32) bytes are always enough
+	 * @param written Output number of bytes written (up to the first error on failure)
+	 * @return True on success, false on surrogates, values above U+10FFFF, or if output is too small
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline bool tryUtf32ToUtf8( std::u32string_view utf32, std::span<char> output, std::size_t& written ) noexcept;
+
+	/**
+	 * @brief Validating UTF-32 to UTF-8 conversion
+	 * @param utf32 UTF-32 input
+	 * @param result Output UTF-8 string, sized exactly
+	 * @return True on success, false on surrogates or values above U+10FFFF
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline bool tryUtf32ToUtf8( std::u32string_view utf32, std::string& result );
+
+	/**
+	 * @brief Non-validating UTF-32 to UTF-8 conversion into a caller-provided buffer
+	 * @param utf32 Input that must contain only Unicode scalar values
+	 * @param output Destination buffer; never written past its end
+	 * @return Number of bytes written
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline std::size_t utf32ToUtf8Unchecked( std::u32string_view utf32, std::span<char> output ) noexcept;
+
+	//-----------------------------
+	// Latin-1
+	//-----------------------------
+
+	/**
+	 * @brief Latin-1 to UTF-8 conversion into a caller-provided buffer
+	 * @param latin1 Latin-1 (ISO-8859-1) input; every byte is a valid codepoint
+	 * @param output Destination buffer; utf8LengthFromLatin1(latin1) bytes are always enough
+	 * @return Number of bytes written; never written past the end of output
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline std::size_t latin1ToUtf8( std::string_view latin1, std::span<char> output ) noexcept;
+
+	/**
+	 * @brief Latin-1 to UTF-8 conversion
+	 * @param latin1 Latin-1 (ISO-8859-1) input
+	 * @return UTF-8 encoded string
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline std::string latin1ToUtf8( std::string_view latin1 );
+
+	/**
+	 * @brief Validating UTF-8 to Latin-1 conversion into a caller-provided buffer
+	 * @param utf8 UTF-8 input
+	 * @param output Destination buffer; utf8Length(utf8) bytes are always enough
+	 * @param written Output number of bytes written (up to the first error on failure)
+	 * @return True on success, false if utf8 is ill-formed, contains codepoints above U+00FF,
+	 *         or output is too small
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline bool tryUtf8ToLatin1( std::string_view utf8, std::span<char> output, std::size_t& written ) noexcept;
+
+	/**
+	 * @brief Validating UTF-8 to Latin-1 conversion
+	 * @param utf8 UTF-8 input
+	 * @param result Output Latin-1 string, sized exactly
+	 * @return True on success, false if utf8 is ill-formed or contains codepoints above U+00FF
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline bool tryUtf8ToLatin1( std::string_view utf8, std::string& result );
+
+	/**
+	 * @brief Non-validating UTF-8 to Latin-1 conversion into a caller-provided buffer
+	 * @param utf8 Input that must be valid UTF-8 with codepoints up to U+00FF only
+	 * @param output Destination buffer; never written past its end
+	 * @return Number of bytes written
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline std::size_t utf8ToLatin1Unchecked( std::string_view utf8, std::span<char> output ) noexcept;
+} // namespace nfx::string
+
+#include "nfx/detail/string/Utf8.inl"
@@ -3,7 +3,7 @@
  * @brief Demonstrates zero-allocation string splitting with Splitter
  * @details This sample shows how to use Splitter for high-performance
  *          string processing in real-world scenarios like CSV parsing, configuration
- *          files, log analysis, and path manipulation
+ *          files, log analysis, path manipulation and request routing
  */
 
 #include <array>
@@ -13,6 +13,7 @@
 #include <string>
 #include <vector>
 
+#include <nfx/string/PrefixMatcher.h>
 #include <nfx/string/Splitter.h>
 
 int main()
@@ -180,6 +181,40 @@ int main()
 
 	std::cout << std::endl;
 
+	//=========================================================================
+	// Request routing - longest route prefix, then split the remainder
+	//=========================================================================
+
+	std::cout << "--- Request Routing ---" << std::endl;
+
+	const std::vector<std::string> routes{ "/api/", "/api/users/", "/api/users/admin/", "/static/" };
+	const nfx::string::PrefixMatcher router{ routes };
+
+	const std::string_view requests[]{
+		"/api/users/42/orders",
+		"/api/health",
+		"/static/css/site.css",
+		"/favicon.ico" };
+
+	for ( const auto request : requests )
+	{
+		nfx::string::PrefixMatch match{ 0, 0 };
+		if ( !router.longestMatch( request, match ) )
+		{
+			std::cout << request << " -> [no route]" << std::endl;
+			continue;
+		}
+
+		std::cout << request << " -> " << routes[match.index] << "  params: ";
+		for ( const auto segment : nfx::string::splitView( request.substr( match.length ), '/' ) )
+		{
+			std::cout << "[" << segment << "]";
+		}
+		std::cout << std::endl;
+	}
+
+	std::cout << std::endl;
+
 	//=========================================================================
 	// Performance demonstration - Zero allocation
 	//=========================================================================
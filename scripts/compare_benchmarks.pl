@@ -0,0 +1,327 @@
+#!/usr/bin/env perl
+#==============================================================================
+# nfx-stringutils - Benchmark baseline recording and regression comparison
+#==============================================================================
+#
+# Records the JSON output of the benchmark executables for the current commit
+# and compares a later run against it. Only core Perl modules are used, so the
+# script works offline:
+#
+#   perl scripts/compare_benchmarks.pl run [options] --out <dir> <executable>...
+#   perl scripts/compare_benchmarks.pl compare [options] <baseline> <results>
+#
+# run options:
+#   --out <dir>          Directory receiving one <executable>.json per benchmark executable
+#   --repetitions <n>    Repetitions of every benchmark (default 10)
+#   --filter <regex>     Only run the matching benchmarks
+#   --min-time <s>       Minimum seconds per repetition, as "0.5" or "0.5s"; passed to
+#                        --benchmark_min_time with the "s" suffix when the executable's
+#                        Google Benchmark accepts it (1.8 and later), as a plain number otherwise
+#
+# compare options:
+#   --threshold <pct>    Median slowdown tolerated before a benchmark fails (default 5)
+#   --metric <name>      real_time or cpu_time (default real_time)
+#   --confidence <p>     Confidence level of the interval of each change (default 0.95)
+#
+# <baseline> and <results> are directories written by "run" or single JSON files
+# from --benchmark_out. Every benchmark present on both sides is compared on the
+# median of its repetitions, with a bootstrap confidence interval of the change.
+# A benchmark is a regression when its median is slower by more than the
+# threshold and the interval lies entirely above zero; the script then exits
+# with status 1, so a build target or a CI step running it fails.
+#
+
+use strict;
+use warnings;
+
+use File::Basename qw(fileparse);
+use File::Path qw(make_path);
+use File::Spec;
+use FindBin;
+use Getopt::Long qw(GetOptionsFromArray);
+use JSON::PP;
+
+# Resamples per bootstrap interval; the generator is seeded so reports are reproducible
+my $bootstrapSamples = 1000;
+my $bootstrapSeed = 20251108;
+
+my %timeUnits = ( ns => 1, us => 1e3, ms => 1e6, s => 1e9 );
+
+#----------------------------------------------
+# Recording
+#----------------------------------------------
+
+# Abbreviated commit of the source tree, or 'unknown' outside a git checkout
+sub sourceCommit
+{
+	my $root = File::Spec->catdir( $FindBin::Bin, '..' );
+	my $commit = `git -C "$root" rev-parse --short HEAD 2>&1`;
+	return $? == 0 ? ( $commit =~ s/\s+$//r ) : 'unknown';
+}
+
+# --benchmark_min_time value for an executable: Google Benchmark 1.8 wants a unit suffix,
+# earlier versions reject one and only parse a plain number of seconds
+sub minTimeFlag
+{
+	my ( $executable, $seconds ) = @_;
+	`"$executable" --benchmark_min_time=${seconds}s --benchmark_list_tests=true 2>&1`;
+	return $? == 0 ? "--benchmark_min_time=${seconds}s" : "--benchmark_min_time=$seconds";
+}
+
+sub run
+{
+	my @args = @_;
+	my %options = ( repetitions => 10 );
+	GetOptionsFromArray( \@args, \%options, 'out=s', 'repetitions=i', 'filter=s', 'min-time=s' )
+		or usage();
+	usage() if !defined $options{out} || !@args;
+	die "--repetitions must be at least 1\n" if $options{repetitions} < 1;
+	if ( defined $options{'min-time'} )
+	{
+		$options{'min-time'} =~ s/s$//;
+		die "--min-time must be a number of seconds, such as 0.5 or 0.5s\n"
+			if $options{'min-time'} !~ /^(?:\d+(?:\.\d*)?|\.\d+)(?:[eE][-+]?\d+)?$/;
+	}
+
+	make_path( $options{out} );
+	die "$options{out}: not a directory\n" if !-d $options{out};
+	my $commit = sourceCommit();
+	for my $executable (@args)
+	{
+		my ($name) = fileparse( $executable, qr/\.[^.]*/ );
+		my $output = File::Spec->catfile( $options{out}, "$name.json" );
+		my @command = (
+			$executable,
+			"--benchmark_repetitions=$options{repetitions}",
+			'--benchmark_enable_random_interleaving=true',
+			'--benchmark_display_aggregates_only=true',
+			"--benchmark_out=$output",
+			'--benchmark_out_format=json',
+			"--benchmark_context=commit=$commit",
+		);
+		push @command, "--benchmark_filter=$options{filter}" if defined $options{filter} && length $options{filter};
+		push @command, minTimeFlag( $executable, $options{'min-time'} ) if defined $options{'min-time'};
+
+		print "==> $name ($commit, $options{repetitions} repetitions)\n";
+		unlink($output);
+		system(@command) == 0 or die "$executable failed\n";
+
+		# No output when the filter matched nothing in this executable
+		unlink($output) if -z $output;
+	}
+	return 0;
+}
+
+#----------------------------------------------
+# Loading
+#----------------------------------------------
+
+# JSON files of a run: the file itself, or every *.json of a directory
+sub resultFiles
+{
+	my ($path) = @_;
+	return ($path) if -f $path;
+	die "$path: no such file or directory\n" if !-d $path;
+
+	opendir( my $directory, $path ) or die "$path: $!\n";
+	my @files = map { File::Spec->catfile( $path, $_ ) } sort grep { /\.json$/ } readdir($directory);
+	closedir($directory);
+	die "$path: no benchmark results\n" if !@files;
+	return @files;
+}
+
+# Per-repetition times in nanoseconds, keyed by executable then benchmark, and the run contexts
+sub loadResults
+{
+	my ( $path, $metric ) = @_;
+	my ( %suites, @order, %contexts );
+	for my $file ( resultFiles($path) )
+	{
+		open( my $handle, '<', $file ) or die "$file: $!\n";
+		my $json = do { local $/; <$handle> };
+		close($handle);
+
+		my $data = eval { decode_json($json) } or die "$file: not a benchmark JSON file\n";
+		# Suites are named after the executable, so files of any name can be compared
+		my ($suite) = fileparse( $data->{context}{executable} // $file, qr/\.[^.\/\\]*$/ );
+		$contexts{$suite} = $data->{context} // {};
+		for my $benchmark ( @{ $data->{benchmarks} // [] } )
+		{
+			# Aggregates (mean, median, stddev) are recomputed from the repetitions
+			next if ( $benchmark->{run_type} // 'iteration' ) ne 'iteration';
+			next if $benchmark->{error_occurred};
+
+			my $name = $benchmark->{run_name} // $benchmark->{name};
+			my $scale = $timeUnits{ $benchmark->{time_unit} // 'ns' } // die "$file: unknown time unit\n";
+			push @order, [ $suite, $name ] if !exists $suites{$suite}{$name};
+			push @{ $suites{$suite}{$name} }, $benchmark->{$metric} * $scale;
+		}
+	}
+	return ( \%suites, \@order, \%contexts );
+}
+
+#----------------------------------------------
+# Statistics
+#----------------------------------------------
+
+sub median
+{
+	my @sorted = sort { $a <=> $b } @_;
+	my $middle = int( @sorted / 2 );
+	return @sorted % 2 ? $sorted[$middle] : ( $sorted[ $middle - 1 ] + $sorted[$middle] ) / 2;
+}
+
+sub resample
+{
+	my ($values) = @_;
+	return map { $values->[ int( rand( scalar @$values ) ) ] } 1 .. @$values;
+}
+
+# Percentile bootstrap interval of median(results) / median(baseline) - 1
+sub changeInterval
+{
+	my ( $baseline, $results, $confidence ) = @_;
+	my @changes;
+	for ( 1 .. $bootstrapSamples )
+	{
+		my $base = median( resample($baseline) );
+		push @changes, $base > 0 ? median( resample($results) ) / $base - 1 : 0;
+	}
+	@changes = sort { $a <=> $b } @changes;
+	my $tail = ( 1 - $confidence ) / 2;
+	return ( $changes[ int( $tail * $#changes ) ], $changes[ int( ( 1 - $tail ) * $#changes + 0.5 ) ] );
+}
+
+#----------------------------------------------
+# Comparison
+#----------------------------------------------
+
+sub formatTime
+{
+	my ($nanoseconds) = @_;
+	for my $unit (qw(s ms us))
+	{
+		return sprintf( '%.3g %s', $nanoseconds / $timeUnits{$unit}, $unit ) if $nanoseconds >= $timeUnits{$unit};
+	}
+	return sprintf( '%.3g ns', $nanoseconds );
+}
+
+sub formatPercent
+{
+	my ($change) = @_;
+	return sprintf( '%+.1f%%', 100 * $change );
+}
+
+# Context differences that make a comparison unreliable
+sub contextWarnings
+{
+	my ( $baseline, $results ) = @_;
+	my @warnings;
+	for my $suite ( sort keys %$results )
+	{
+		my $base = $baseline->{$suite} or next;
+		my $new = $results->{$suite};
+		for my $key (qw(host_name num_cpus library_build_type))
+		{
+			my ( $old, $now ) = ( $base->{$key} // '?', $new->{$key} // '?' );
+			push @warnings, "$suite: $key differs ($old -> $now)" if $old ne $now;
+		}
+		for my $context ( $base, $new )
+		{
+			push @warnings, "$suite: benchmark library built as debug" if ( $context->{library_build_type} // '' ) eq 'debug';
+			push @warnings, "$suite: CPU frequency scaling was enabled" if $context->{cpu_scaling_enabled};
+		}
+	}
+	my %seen;
+	return grep { !$seen{$_}++ } @warnings;
+}
+
+sub compare
+{
+	my @args = @_;
+	my %options = ( threshold => 5, metric => 'real_time', confidence => 0.95 );
+	GetOptionsFromArray( \@args, \%options, 'threshold=f', 'metric=s', 'confidence=f' ) or usage();
+	usage() if @args != 2;
+	die "--metric must be real_time or cpu_time\n" if $options{metric} !~ /^(real_time|cpu_time)$/;
+	die "--confidence must be between 0 and 1\n" if $options{confidence} <= 0 || $options{confidence} >= 1;
+
+	my ( $baseline, undef, $baselineContexts ) = loadResults( $args[0], $options{metric} );
+	my ( $results, $order, $resultContexts ) = loadResults( $args[1], $options{metric} );
+	my $threshold = $options{threshold} / 100;
+	srand($bootstrapSeed);
+
+	my $commitOf = sub {
+		my ($contexts) = @_;
+		my %commits = map { ( $_->{commit} // 'unknown' ) => 1 } values %$contexts;
+		return join( ',', sort keys %commits );
+	};
+	printf( "Baseline %s (%s), results %s (%s)\n", $args[0], $commitOf->($baselineContexts), $args[1], $commitOf->($resultContexts) );
+	printf( "%s medians, threshold %s, %g%% confidence intervals\n\n", $options{metric}, formatPercent($threshold), 100 * $options{confidence} );
+	print "warning: $_\n" for contextWarnings( $baselineContexts, $resultContexts );
+
+	my ( %counts, $currentSuite, @regressions );
+	for my $entry (@$order)
+	{
+		my ( $suite, $name ) = @$entry;
+		my $new = $results->{$suite}{$name};
+		my $base = $baseline->{$suite}{$name};
+		if ( !defined $currentSuite || $suite ne $currentSuite )
+		{
+			print "\n[$suite]\n";
+			$currentSuite = $suite;
+		}
+		if ( !$base )
+		{
+			printf( "  %-70s %12s %12s  %s\n", $name, '-', formatTime( median(@$new) ), 'new' );
+			++$counts{new};
+			next;
+		}
+
+		my ( $baseMedian, $newMedian ) = ( median(@$base), median(@$new) );
+		my $change = $baseMedian > 0 ? $newMedian / $baseMedian - 1 : 0;
+
+		# A single repetition has no spread; the threshold alone decides
+		my ( $low, $high ) = @$base > 1 && @$new > 1 ? changeInterval( $base, $new, $options{confidence} ) : ( $change, $change );
+		my $verdict = $change > $threshold && $low > 0 ? 'SLOWER'
+			: $change < -$threshold && $high < 0       ? 'faster'
+			:                                            'same';
+		++$counts{$verdict};
+		push @regressions, "$suite: $name" if $verdict eq 'SLOWER';
+
+		printf( "  %-70s %12s %12s %8s [%s, %s]  %s\n", $name, formatTime($baseMedian), formatTime($newMedian),
+			formatPercent($change), formatPercent($low), formatPercent($high), $verdict );
+	}
+
+	my $missing = 0;
+	for my $suite ( sort keys %$baseline )
+	{
+		$missing += grep { !exists $results->{$suite}{$_} } keys %{ $baseline->{$suite} };
+	}
+
+	printf( "\n%d compared: %d slower, %d faster, %d unchanged; %d new, %d missing\n",
+		( $counts{SLOWER} // 0 ) + ( $counts{faster} // 0 ) + ( $counts{same} // 0 ),
+		$counts{SLOWER} // 0, $counts{faster} // 0, $counts{same} // 0, $counts{new} // 0, $missing );
+	if (@regressions)
+	{
+		print "\nRegressions:\n";
+		print "  $_\n" for @regressions;
+		return 1;
+	}
+	return 0;
+}
+
+#----------------------------------------------
+# Entry point
+#----------------------------------------------
+
+sub usage
+{
+	print STDERR "usage: $0 run [--repetitions n] [--filter regex] [--min-time s] --out <dir> <executable>...\n";
+	print STDERR "       $0 compare [--threshold pct] [--metric real_time|cpu_time] [--confidence p] <baseline> <results>\n";
+	exit 2;
+}
+
+my $command = shift @ARGV // '';
+exit run(@ARGV) if $command eq 'run';
+exit compare(@ARGV) if $command eq 'compare';
+usage();
@@ -0,0 +1,459 @@
+#!/usr/bin/env perl
+#==============================================================================
+# nfx-stringutils - Unicode table generator
+#==============================================================================
+#
+# Generates the Unicode property tables in include/nfx/detail/string/ from the
+# Unicode Character Database bundled with Perl (Unicode::UCD is a core module,
+# so no download is needed). The tables follow the Unicode version of the Perl
+# running the script:
+#
+#   perl scripts/generate_unicode_tables.pl [include-dir]
+#
+# Every table is a two-stage lookup: an index maps each block of codepoints to
+# a deduplicated block of entries, which keeps the tables a few kilobytes.
+#
+
+use strict;
+use warnings;
+
+use File::Spec;
+use FindBin;
+use Unicode::UCD qw(prop_invlist prop_invmap);
+
+my $includeDir = $ARGV[0] // File::Spec->catdir( $FindBin::Bin, '..', 'include' );
+my $outputDir = File::Spec->catdir( $includeDir, 'nfx', 'detail', 'string' );
+my $unicodeVersion = Unicode::UCD::UnicodeVersion();
+
+#----------------------------------------------
+# Property access
+#----------------------------------------------
+
+# Per-codepoint targets of an adjusted ('a' format) codepoint mapping, below $limit
+sub codepointMapping
+{
+	my ( $property, $limit ) = @_;
+	my ( $ranges, $maps, $format ) = prop_invmap($property);
+	die "$property: unexpected format $format\n" unless $format eq 'a';
+
+	my @targets = ( 0 .. $limit - 1 );
+	for my $i ( 0 .. $#$ranges )
+	{
+		next if $maps->[$i] == 0;
+		my $end = $i < $#$ranges ? $ranges->[ $i + 1 ] : $limit;
+		for ( my $cp = $ranges->[$i]; $cp < $end && $cp < $limit; ++$cp )
+		{
+			$targets[$cp] = $maps->[$i] + $cp - $ranges->[$i];
+		}
+	}
+	return \@targets;
+}
+
+# Per-codepoint values of a string ('s' format) property, below $limit
+sub codepointProperty
+{
+	my ( $property, $limit ) = @_;
+	my ( $ranges, $maps, $format ) = prop_invmap($property);
+	die "$property: unexpected format $format\n" unless $format eq 's';
+
+	my @values;
+	for my $i ( 0 .. $#$ranges )
+	{
+		my $end = $i < $#$ranges ? $ranges->[ $i + 1 ] : $limit;
+		for ( my $cp = $ranges->[$i]; $cp < $end && $cp < $limit; ++$cp )
+		{
+			$values[$cp] = $maps->[$i];
+		}
+	}
+	return \@values;
+}
+
+# Set of codepoints with a binary property
+sub codepointSet
+{
+	my ($property) = @_;
+	my @list = prop_invlist($property);
+	my %set;
+	for ( my $i = 0; $i < @list; $i += 2 )
+	{
+		my $end = $i + 1 < @list ? $list[ $i + 1 ] : 0x110000;
+		$set{$_} = 1 for $list[$i] .. $end - 1;
+	}
+	return \%set;
+}
+
+#----------------------------------------------
+# Table layout
+#----------------------------------------------
+
+# Split values into blocks of 2^shift entries; returns the block index and the deduplicated blocks
+sub twoStage
+{
+	my ( $values, $shift ) = @_;
+	my $blockSize = 1 << $shift;
+	die "table size is not a multiple of the block size\n" if @$values % $blockSize;
+
+	my ( @index, @blocks, %seen );
+	for ( my $start = 0; $start < @$values; $start += $blockSize )
+	{
+		my @block = @{$values}[ $start .. $start + $blockSize - 1 ];
+		my $key = join( ',', @block );
+		if ( !exists $seen{$key} )
+		{
+			$seen{$key} = @blocks / $blockSize;
+			push @blocks, @block;
+		}
+		push @index, $seen{$key};
+	}
+	return ( \@index, \@blocks );
+}
+
+# Smallest unsigned type holding every value
+sub indexType
+{
+	my ($values) = @_;
+	my $max = 0;
+	$max < $_ and $max = $_ for @$values;
+	return $max < 256 ? 'std::uint8_t' : $max < 65536 ? 'std::uint16_t' : 'std::uint32_t';
+}
+
+sub roundUp
+{
+	my ( $value, $shift ) = @_;
+	my $blockSize = 1 << $shift;
+	return ( ( $value + $blockSize - 1 ) >> $shift ) << $shift;
+}
+
+# Block size (as a shift) giving the smallest two-stage table
+sub bestShift
+{
+	my ( $values, $entryBytes ) = @_;
+	my ( $bestShift, $bestSize );
+	for my $shift ( 4 .. 8 )
+	{
+		my @padded = @$values;
+		push @padded, (0) x ( roundUp( scalar @padded, $shift ) - @padded );
+		my ( $index, $blocks ) = twoStage( \@padded, $shift );
+		my $size = @$index * ( @$blocks >> $shift < 256 ? 1 : 2 ) + @$blocks * $entryBytes;
+		( $bestShift, $bestSize ) = ( $shift, $size ) if !defined $bestSize || $size < $bestSize;
+	}
+	return $bestShift;
+}
+
+#----------------------------------------------
+# C++ emission
+#----------------------------------------------
+
+sub formatArray
+{
+	my ( $type, $name, $values, $brief, $perLine ) = @_;
+	$perLine //= 24;
+	my $out = "\t/** \@brief $brief */\n";
+	$out .= "\tinline constexpr $type ${name}[]{\n";
+	for ( my $i = 0; $i < @$values; $i += $perLine )
+	{
+		my $last = $i + $perLine - 1 < $#$values ? $i + $perLine - 1 : $#$values;
+		$out .= "\t\t" . join( ', ', @{$values}[ $i .. $last ] ) . ",\n";
+	}
+	$out .= "\t};\n";
+	return $out;
+}
+
+sub writeHeader
+{
+	my ( $fileName, $brief, $details, $body ) = @_;
+	my $path = File::Spec->catfile( $outputDir, $fileName );
+	open( my $fh, '>', $path ) or die "$path: $!\n";
+	print $fh <<"END";
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * \@file $fileName
+ * \@brief $brief
+ * \@details Generated by scripts/generate_unicode_tables.pl from Unicode $unicodeVersion - do not edit.
+$details */
+
+#pragma once
+
+#include <cstdint>
+
+namespace nfx::string::detail
+{
+$body} // namespace nfx::string::detail
+END
+	close($fh);
+	print "Wrote $path\n";
+}
+
+#----------------------------------------------
+# Case mapping
+#----------------------------------------------
+
+sub generateCaseTables
+{
+	my $shift = 7;
+	my $fold = codepointMapping( 'Simple_Case_Folding', 0x110000 );
+	my $lower = codepointMapping( 'Simple_Lowercase_Mapping', 0x110000 );
+	my $upper = codepointMapping( 'Simple_Uppercase_Mapping', 0x110000 );
+
+	my $limit = 0;
+	for my $cp ( 0 .. 0x10FFFF )
+	{
+		$limit = $cp + 1 if $fold->[$cp] != $cp || $lower->[$cp] != $cp || $upper->[$cp] != $cp;
+	}
+	$limit = roundUp( $limit, $shift );
+
+	# Record 0 is the identity so unmapped blocks stay zero-filled
+	my @records = ('{ 0, 0, 0 }');
+	my %recordIds = ( '{ 0, 0, 0 }' => 0 );
+	my @entries;
+	for my $cp ( 0 .. $limit - 1 )
+	{
+		my $record = sprintf( '{ %d, %d, %d }', $fold->[$cp] - $cp, $lower->[$cp] - $cp, $upper->[$cp] - $cp );
+		if ( !exists $recordIds{$record} )
+		{
+			$recordIds{$record} = @records;
+			push @records, $record;
+		}
+		push @entries, $recordIds{$record};
+	}
+	my ( $index, $blocks ) = twoStage( \@entries, $shift );
+
+	my $body = sprintf( "\t/** \@brief Codepoints at or above this limit have no case mapping */\n\tinline constexpr char32_t kCaseLimit{ 0x%X };\n\n", $limit );
+	$body .= "\t/** \@brief log2 of the number of codepoints per block */\n\tinline constexpr unsigned kCaseShift{ $shift };\n\n";
+	$body .= "\t/** \@brief Signed distance from a codepoint to its mappings */\n";
+	$body .= "\tstruct CaseRecord\n\t{\n\t\tstd::int32_t fold;\n\t\tstd::int32_t lower;\n\t\tstd::int32_t upper;\n\t};\n\n";
+	$body .= formatArray( 'CaseRecord', 'kCaseRecords', \@records, 'Distinct mapping records; record 0 leaves the codepoint unchanged', 4 ) . "\n";
+	$body .= formatArray( indexType($index), 'kCaseIndex', $index, 'Block number for each run of 2^kCaseShift codepoints' ) . "\n";
+	$body .= formatArray( indexType($blocks), 'kCaseBlocks', $blocks, 'Record number for each codepoint of every distinct block' );
+
+	writeHeader( 'CaseTables.h', 'Unicode simple case mapping tables',
+		" *          Simple case folding (CaseFolding.txt status C and S) and the simple lowercase and\n" .
+		" *          uppercase mappings of UnicodeData.txt, stored as deltas from the codepoint.\n",
+		$body );
+}
+
+#----------------------------------------------
+# Normalization
+#----------------------------------------------
+
+sub generateNormalizationTables
+{
+	my $ccc = codepointProperty( 'Canonical_Combining_Class', 0x110000 );
+	my $type = codepointProperty( 'Decomposition_Type', 0x110000 );
+	my %quickCheck = (
+		NFD => codepointProperty( 'NFD_Quick_Check', 0x110000 ),
+		NFKD => codepointProperty( 'NFKD_Quick_Check', 0x110000 ),
+		NFC => codepointProperty( 'NFC_Quick_Check', 0x110000 ),
+		NFKC => codepointProperty( 'NFKC_Quick_Check', 0x110000 ) );
+	my $exclusions = codepointSet('Full_Composition_Exclusion');
+
+	# Single-level mappings; Hangul syllables are decomposed algorithmically
+	my %mapping;
+	my ( $ranges, $maps ) = prop_invmap('Decomposition_Mapping');
+	for my $i ( 0 .. $#$ranges )
+	{
+		my $map = $maps->[$i];
+		next if !ref($map) && ( $map eq '0' || $map =~ /hangul/i );
+		my $end = $i < $#$ranges ? $ranges->[ $i + 1 ] : 0x110000;
+		for my $cp ( $ranges->[$i] .. $end - 1 )
+		{
+			$mapping{$cp} = ref($map) ? [@$map] : [ $map + $cp - $ranges->[$i] ];
+		}
+	}
+
+	my $expand;
+	$expand = sub {
+		my ( $cp, $compat ) = @_;
+		return ($cp) if !exists $mapping{$cp} || ( !$compat && $type->[$cp] ne 'Canonical' );
+		return map { $expand->( $_, $compat ) } @{ $mapping{$cp} };
+	};
+
+	# Per-codepoint properties: combining class and quick-check answers
+	my %flagBits = ( NFD_No => 1, NFKD_No => 2, NFC_No => 4, NFC_Maybe => 8, NFKC_No => 16, NFKC_Maybe => 32 );
+	my @records = ('{ 0, 0 }');
+	my %recordIds = ( '{ 0, 0 }' => 0 );
+	my @properties;
+	my $limit = 0;
+	for my $cp ( 0 .. 0x10FFFF )
+	{
+		my $flags = 0;
+		for my $form (qw(NFD NFKD NFC NFKC))
+		{
+			my $value = $quickCheck{$form}->[$cp];
+			$flags |= $flagBits{"${form}_No"} if $value =~ /^N/;
+			$flags |= $flagBits{"${form}_Maybe"} if $value =~ /^M/;
+		}
+		my $record = sprintf( '{ %d, %d }', $ccc->[$cp], $flags );
+		if ( !exists $recordIds{$record} )
+		{
+			$recordIds{$record} = @records;
+			push @records, $record;
+		}
+		push @properties, $recordIds{$record};
+		$limit = $cp + 1 if $recordIds{$record} != 0;
+	}
+
+	# Full decompositions: [canonical length | compatibility length << 8, canonical..., compatibility...]
+	# A compatibility length of 0 means the compatibility decomposition equals the canonical one.
+	my @data = (0);
+	my @offsets;
+	for my $cp ( 0 .. 0x10FFFF )
+	{
+		next unless exists $mapping{$cp};
+		my @canonical = $type->[$cp] eq 'Canonical' ? $expand->( $cp, 0 ) : ();
+		my @compat = $expand->( $cp, 1 );
+		@compat = () if "@compat" eq "@canonical";
+		$offsets[$cp] = @data;
+		push @data, scalar(@canonical) | ( scalar(@compat) << 8 ), @canonical, @compat;
+	}
+
+	# Primary composites: canonical pairs not excluded from composition, grouped by first codepoint
+	my %pairs;
+	for my $cp ( sort { $a <=> $b } keys %mapping )
+	{
+		my $map = $mapping{$cp};
+		next if $type->[$cp] ne 'Canonical' || @$map != 2 || $exclusions->{$cp};
+		push @{ $pairs{ $map->[0] } }, [ $map->[1], $cp ];
+	}
+	my @compositions = (0);
+	my @compositionOffsets;
+	for my $first ( sort { $a <=> $b } keys %pairs )
+	{
+		$compositionOffsets[$first] = @compositions;
+		push @compositions, scalar @{ $pairs{$first} }, map { @$_ } @{ $pairs{$first} };
+	}
+
+	# Both per-codepoint tables cover [0, kNormalizationLimit); 2^8 is a multiple of every block size
+	my $paddedLimit = roundUp( $limit, 8 );
+	my $body = sprintf( "\t/** \@brief Codepoints at or above this limit are starters that never change under normalization */\n\tinline constexpr char32_t kNormalizationLimit{ 0x%X };\n\n", $paddedLimit );
+
+	# Properties
+	my $shift = bestShift( [ @properties[ 0 .. $limit - 1 ] ], 1 );
+	my @values = @properties[ 0 .. $paddedLimit - 1 ];
+	my ( $index, $blocks ) = twoStage( \@values, $shift );
+	$body .= "\t/** \@brief Quick-check flags of NormalizationRecord::quickCheck */\n";
+	$body .= "\tinline constexpr std::uint8_t kNfdNo{ 1 };\n\tinline constexpr std::uint8_t kNfkdNo{ 2 };\n";
+	$body .= "\tinline constexpr std::uint8_t kNfcNo{ 4 };\n\tinline constexpr std::uint8_t kNfcMaybe{ 8 };\n";
+	$body .= "\tinline constexpr std::uint8_t kNfkcNo{ 16 };\n\tinline constexpr std::uint8_t kNfkcMaybe{ 32 };\n\n";
+	$body .= "\t/** \@brief Canonical combining class and quick-check answers of a codepoint */\n";
+	$body .= "\tstruct NormalizationRecord\n\t{\n\t\tstd::uint8_t ccc;\n\t\tstd::uint8_t quickCheck;\n\t};\n\n";
+	$body .= formatArray( 'NormalizationRecord', 'kNormalizationRecords', \@records, 'Distinct property records; record 0 is a starter that is always normalized', 8 ) . "\n";
+	$body .= "\t/** \@brief log2 of the number of codepoints per property block */\n\tinline constexpr unsigned kNormalizationShift{ $shift };\n\n";
+	$body .= formatArray( indexType($index), 'kNormalizationIndex', $index, 'Block number for each run of 2^kNormalizationShift codepoints' ) . "\n";
+	$body .= formatArray( indexType($blocks), 'kNormalizationBlocks', $blocks, 'Record number for each codepoint of every distinct block' ) . "\n";
+
+	# Decompositions
+	@values = map { $offsets[$_] // 0 } 0 .. $limit - 1;
+	$shift = bestShift( \@values, 2 );
+	@values = map { $offsets[$_] // 0 } 0 .. $paddedLimit - 1;
+	( $index, $blocks ) = twoStage( \@values, $shift );
+	$body .= "\t/** \@brief log2 of the number of codepoints per decomposition block */\n\tinline constexpr unsigned kDecompositionShift{ $shift };\n\n";
+	$body .= formatArray( indexType($index), 'kDecompositionIndex', $index, 'Block number for each run of 2^kDecompositionShift codepoints' ) . "\n";
+	$body .= formatArray( indexType($blocks), 'kDecompositionBlocks', $blocks, 'Offset into kDecompositionData for each codepoint, 0 if it does not decompose', 16 ) . "\n";
+	$body .= formatArray( 'char32_t', 'kDecompositionData', [ map { sprintf( '0x%X', $_ ) } @data ],
+		'Full decompositions as [canonical length | compatibility length << 8, codepoints...]', 12 ) . "\n";
+
+	# Compositions
+	my $compositionLimit = roundUp( $#compositionOffsets + 1, 8 );
+	@values = map { $compositionOffsets[$_] // 0 } 0 .. $compositionLimit - 1;
+	$shift = bestShift( \@values, 2 );
+	( $index, $blocks ) = twoStage( \@values, $shift );
+	$body .= sprintf( "\t/** \@brief Codepoints at or above this limit never start a primary composite */\n\tinline constexpr char32_t kCompositionLimit{ 0x%X };\n\n", $compositionLimit );
+	$body .= "\t/** \@brief log2 of the number of codepoints per composition block */\n\tinline constexpr unsigned kCompositionShift{ $shift };\n\n";
+	$body .= formatArray( indexType($index), 'kCompositionIndex', $index, 'Block number for each run of 2^kCompositionShift codepoints' ) . "\n";
+	$body .= formatArray( indexType($blocks), 'kCompositionBlocks', $blocks, 'Offset into kCompositionData for each first codepoint, 0 if it starts no composite', 16 ) . "\n";
+	$body .= formatArray( 'char32_t', 'kCompositionData', [ map { sprintf( '0x%X', $_ ) } @compositions ],
+		'Composites as [count, second, composite, second, composite...] per first codepoint', 12 );
+
+	writeHeader( 'NormalizationTables.h', 'Unicode normalization tables',
+		" *          Canonical combining classes, NFC/NFD/NFKC/NFKD quick-check values, fully expanded\n" .
+		" *          canonical and compatibility decompositions, and primary composites (canonical pairs\n" .
+		" *          minus Full_Composition_Exclusion). Hangul syllables are handled algorithmically.\n",
+		$body );
+}
+
+#----------------------------------------------
+# Display width and grapheme clusters
+#----------------------------------------------
+
+sub generateWidthTables
+{
+	my $graphemeBreak = codepointProperty( 'Grapheme_Cluster_Break', 0x110000 );
+	my $eastAsianWidth = codepointProperty( 'East_Asian_Width', 0x110000 );
+	my $category = codepointProperty( 'General_Category', 0x110000 );
+	my $pictographic = codepointSet('Extended_Pictographic');
+
+	# Perl folds Extended_Pictographic into its Grapheme_Cluster_Break values as ExtPict_XX
+	my @breaks = qw(Other CR LF Control Extend ZWJ Regional_Indicator Prepend SpacingMark L V T LV LVT);
+	my %breakIds = map { $breaks[$_] => $_ } 0 .. $#breaks;
+	$breakIds{ExtPict_XX} = $breakIds{Other};
+
+	# Property byte: Grapheme_Cluster_Break | Extended_Pictographic << 4 | wide << 5 | zero width << 6
+	my @values;
+	my $limit = 0;
+	for my $cp ( 0 .. 0x10FFFF )
+	{
+		my $break = $breakIds{ $graphemeBreak->[$cp] } // die sprintf( "U+%04X: unknown break %s\n", $cp, $graphemeBreak->[$cp] );
+		# SOFT HYPHEN is a format control that terminals still render as a visible hyphen
+		my $zero = $cp != 0xAD && ( $category->[$cp] =~ /^(Mn|Me|Cf)$/ || $break =~ /^(1|2|3|10|11)$/ );
+		my $wide = !$zero && $eastAsianWidth->[$cp] =~ /^(W|F)$/;
+		my $value = $break | ( $pictographic->{$cp} ? 0x10 : 0 ) | ( $wide ? 0x20 : 0 ) | ( $zero ? 0x40 : 0 );
+		push @values, $value;
+		$limit = $cp + 1 if $value != 0;
+	}
+
+	my $paddedLimit = roundUp( $limit, 8 );
+	my $shift = bestShift( [ @values[ 0 .. $limit - 1 ] ], 1 );
+	my ( $index, $blocks ) = twoStage( [ @values[ 0 .. $paddedLimit - 1 ] ], $shift );
+
+	my $body = "	/** \@brief Grapheme_Cluster_Break property values (UAX #29) */\n";
+	$body .= "	enum class GraphemeBreak : std::uint8_t\n\t{\n";
+	$body .= join( '', map { ( my $name = $_ ) =~ s/_//g; "\t\t$name,\n" } @breaks );
+	$body .= "	};\n\n";
+	$body .= "	/** \@brief Bits of a width property byte; the low four bits hold the GraphemeBreak value */\n";
+	$body .= "	inline constexpr std::uint8_t kGraphemeBreakMask{ 0x0F };\n";
+	$body .= "	inline constexpr std::uint8_t kExtendedPictographic{ 0x10 };\n";
+	$body .= "	inline constexpr std::uint8_t kWide{ 0x20 };\n";
+	$body .= "	inline constexpr std::uint8_t kZeroWidth{ 0x40 };\n\n";
+	$body .= sprintf( "	/** \@brief Codepoints at or above this limit are narrow and break as Other */\n\tinline constexpr char32_t kWidthLimit{ 0x%X };\n\n", $paddedLimit );
+	$body .= "	/** \@brief log2 of the number of codepoints per block */\n\tinline constexpr unsigned kWidthShift{ $shift };\n\n";
+	$body .= formatArray( indexType($index), 'kWidthIndex', $index, 'Block number for each run of 2^kWidthShift codepoints' ) . "\n";
+	$body .= formatArray( 'std::uint8_t', 'kWidthBlocks', [ map { sprintf( '0x%02X', $_ ) } @$blocks ], 'Property byte for each codepoint of every distinct block', 16 );
+
+	writeHeader( 'WidthTables.h', 'Display width and grapheme cluster tables',
+		" *          Grapheme_Cluster_Break and Extended_Pictographic for extended grapheme clusters,\n" .
+		" *          and the terminal column width of each codepoint: two for East_Asian_Width W and F,\n" .
+		" *          zero for marks, format and control characters and Hangul medial jamo, one otherwise.\n",
+		$body );
+}
+
+#----------------------------------------------
+# Entry point
+#----------------------------------------------
+
+generateCaseTables();
+generateNormalizationTables();
+generateWidthTables();
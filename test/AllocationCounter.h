@@ -0,0 +1,269 @@
+/**
+ * @file AllocationCounter.h
+ * @brief Heap allocation counting through replaced global operator new, for tests and benchmarks
+ * @details Including this header replaces the global allocation and deallocation functions of the
+ *          executable, so it must be included by exactly one translation unit per executable.
+ *          Counts are kept per thread: allocations made by test framework or benchmark reporter
+ *          threads are never attributed to the code being measured.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#if defined( _WIN32 )
+#	include <malloc.h>
+#endif
+
+namespace nfx::string::test
+{
+	//=====================================================================
+	// Allocation counting
+	//=====================================================================
+
+	/**
+	 * @brief Heap allocations made by one thread
+	 */
+	struct AllocationStats
+	{
+		/** @brief Number of successful calls to operator new */
+		std::size_t count;
+
+		/** @brief Bytes requested by those calls */
+		std::size_t bytes;
+	};
+
+	namespace detail
+	{
+		/** @brief Running totals of the current thread, updated by the replaced operator new */
+		inline thread_local AllocationStats allocationTotals{ 0, 0 };
+
+		inline void* countedAllocate( std::size_t size )
+		{
+			void* memory = std::malloc( size == 0 ? 1 : size );
+			if ( memory == nullptr )
+			{
+				throw std::bad_alloc{};
+			}
+			++allocationTotals.count;
+			allocationTotals.bytes += size;
+			return memory;
+		}
+
+		inline void* countedAllocateAligned( std::size_t size, std::align_val_t alignment )
+		{
+			const std::size_t align = static_cast<std::size_t>( alignment );
+#if defined( _WIN32 )
+			void* memory = _aligned_malloc( size == 0 ? 1 : size, align );
+#else
+			// aligned_alloc requires the size to be a multiple of the alignment
+			void* memory = std::aligned_alloc( align, ( ( size == 0 ? 1 : size ) + align - 1 ) / align * align );
+#endif
+			if ( memory == nullptr )
+			{
+				throw std::bad_alloc{};
+			}
+			++allocationTotals.count;
+			allocationTotals.bytes += size;
+			return memory;
+		}
+
+		inline void freeAligned( void* memory ) noexcept
+		{
+#if defined( _WIN32 )
+			_aligned_free( memory );
+#else
+			std::free( memory );
+#endif
+		}
+	} // namespace detail
+
+	/**
+	 * @brief Counts the heap allocations of the current thread from construction onward
+	 */
+	class AllocationCounter
+	{
+	public:
+		/**
+		 * @brief Starts counting at the current totals of this thread
+		 */
+		AllocationCounter() noexcept
+			: m_start{ detail::allocationTotals }
+		{
+		}
+
+		/**
+		 * @brief Allocations made by this thread since construction
+		 * @return Allocation count and requested bytes
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] AllocationStats stats() const noexcept
+		{
+			return AllocationStats{ detail::allocationTotals.count - m_start.count, detail::allocationTotals.bytes - m_start.bytes };
+		}
+
+		/**
+		 * @brief Number of allocations made by this thread since construction
+		 * @return Allocation count
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] std::size_t count() const noexcept
+		{
+			return stats().count;
+		}
+
+	private:
+		AllocationStats m_start;
+	};
+} // namespace nfx::string::test
+
+//=====================================================================
+// Test assertion
+//=====================================================================
+
+/**
+ * @brief GoogleTest check that a statement performs no heap allocation on the calling thread
+ * @details Example: EXPECT_NO_ALLOC( auto piece = nfx::string::trim( text ) );
+ *          The statement runs in its own scope; commas are allowed.
+ */
+#define EXPECT_NO_ALLOC( ... )                                                          \
+	do                                                                                  \
+	{                                                                                   \
+		const ::nfx::string::test::AllocationCounter nfxAllocationCounter_;             \
+		__VA_ARGS__;                                                                    \
+		EXPECT_EQ( nfxAllocationCounter_.count(), 0u ) << "Allocated in: " #__VA_ARGS__; \
+	} while ( false )
+
+//=====================================================================
+// Replaced global allocation functions
+//=====================================================================
+
+void* operator new( std::size_t size )
+{
+	return nfx::string::test::detail::countedAllocate( size );
+}
+
+void* operator new[]( std::size_t size )
+{
+	return nfx::string::test::detail::countedAllocate( size );
+}
+
+void* operator new( std::size_t size, std::align_val_t alignment )
+{
+	return nfx::string::test::detail::countedAllocateAligned( size, alignment );
+}
+
+void* operator new[]( std::size_t size, std::align_val_t alignment )
+{
+	return nfx::string::test::detail::countedAllocateAligned( size, alignment );
+}
+
+void* operator new( std::size_t size, const std::nothrow_t& ) noexcept
+{
+	try
+	{
+		return nfx::string::test::detail::countedAllocate( size );
+	}
+	catch ( const std::bad_alloc& )
+	{
+		return nullptr;
+	}
+}
+
+void* operator new[]( std::size_t size, const std::nothrow_t& ) noexcept
+{
+	try
+	{
+		return nfx::string::test::detail::countedAllocate( size );
+	}
+	catch ( const std::bad_alloc& )
+	{
+		return nullptr;
+	}
+}
+
+void* operator new( std::size_t size, std::align_val_t alignment, const std::nothrow_t& ) noexcept
+{
+	try
+	{
+		return nfx::string::test::detail::countedAllocateAligned( size, alignment );
+	}
+	catch ( const std::bad_alloc& )
+	{
+		return nullptr;
+	}
+}
+
+void* operator new[]( std::size_t size, std::align_val_t alignment, const std::nothrow_t& ) noexcept
+{
+	try
+	{
+		return nfx::string::test::detail::countedAllocateAligned( size, alignment );
+	}
+	catch ( const std::bad_alloc& )
+	{
+		return nullptr;
+	}
+}
+
+void operator delete( void* memory ) noexcept
+{
+	std::free( memory );
+}
+
+void operator delete[]( void* memory ) noexcept
+{
+	std::free( memory );
+}
+
+void operator delete( void* memory, std::size_t ) noexcept
+{
+	std::free( memory );
+}
+
+void operator delete[]( void* memory, std::size_t ) noexcept
+{
+	std::free( memory );
+}
+
+void operator delete( void* memory, std::align_val_t ) noexcept
+{
+	nfx::string::test::detail::freeAligned( memory );
+}
+
+void operator delete[]( void* memory, std::align_val_t ) noexcept
+{
+	nfx::string::test::detail::freeAligned( memory );
+}
+
+void operator delete( void* memory, std::size_t, std::align_val_t ) noexcept
+{
+	nfx::string::test::detail::freeAligned( memory );
+}
+
+void operator delete[]( void* memory, std::size_t, std::align_val_t ) noexcept
+{
+	nfx::string::test::detail::freeAligned( memory );
+}
+
+void operator delete( void* memory, const std::nothrow_t& ) noexcept
+{
+	std::free( memory );
+}
+
+void operator delete[]( void* memory, const std::nothrow_t& ) noexcept
+{
+	std::free( memory );
+}
+
+void operator delete( void* memory, std::align_val_t, const std::nothrow_t& ) noexcept
+{
+	nfx::string::test::detail::freeAligned( memory );
+}
+
+void operator delete[]( void* memory, std::align_val_t, const std::nothrow_t& ) noexcept
+{
+	nfx::string::test::detail::freeAligned( memory );
+}
@@ -0,0 +1,204 @@
+/**
+ * @file TESTS_FixedString.cpp
+ * @brief Tests for the FixedString inline-storage string
+ * @details Tests covering compile-time construction and comparison, capacity limits,
+ *          trivial copyability, and the non-allocating trim, case, padding and replace
+ *          overloads including aliasing of input and result
+ */
+
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_set>
+
+#include <nfx/string/FixedString.h>
+
+namespace nfx::string::test
+{
+	//=====================================================================
+	// FixedString tests
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	TEST( FixedStringConstruction, CompileTime )
+	{
+		constexpr FixedString<8> port{ "8080" };
+		static_assert( port.size() == 4 );
+		static_assert( port == "8080" );
+		static_assert( port != std::string_view{ "80" } );
+		static_assert( port < FixedString<16>{ "9" } );
+		static_assert( FixedString<8>::capacity() == 8 );
+
+		constexpr FixedString deduced{ "GBP" };
+		static_assert( std::is_same_v<decltype( deduced ), const FixedString<3>> );
+		static_assert( deduced.view() == "GBP" );
+
+		static_assert( std::is_trivially_copyable_v<FixedString<253>> );
+		static_assert( sizeof( FixedString<15> ) == 17 );
+		static_assert( sizeof( FixedString<253> ) == 255 );
+
+		EXPECT_STREQ( port.c_str(), "8080" );
+	}
+
+	TEST( FixedStringConstruction, FromStringViewTruncates )
+	{
+		const std::string longer = "example.com";
+		const FixedString<7> host{ std::string_view{ longer } };
+
+		EXPECT_EQ( host.view(), "example" );
+		EXPECT_STREQ( host.c_str(), "example" );
+		EXPECT_TRUE( FixedString<4>{}.empty() );
+	}
+
+	//----------------------------------------------
+	// Modification
+	//----------------------------------------------
+
+	TEST( FixedStringModification, FailedOperationsLeaveStringUnchanged )
+	{
+		FixedString<6> str;
+		EXPECT_TRUE( str.tryAssign( "abc" ) );
+		EXPECT_FALSE( str.tryAssign( "abcdefg" ) );
+		EXPECT_EQ( str, "abc" );
+
+		EXPECT_TRUE( str.tryAppend( "de" ) );
+		EXPECT_FALSE( str.tryAppend( "fg" ) );
+		EXPECT_EQ( str, "abcde" );
+
+		EXPECT_FALSE( str.tryAppend( 2, '!' ) );
+		EXPECT_TRUE( str.tryPushBack( 'f' ) );
+		EXPECT_FALSE( str.tryPushBack( 'g' ) );
+		EXPECT_EQ( str, "abcdef" );
+		EXPECT_STREQ( str.c_str(), "abcdef" );
+
+		str[0] = 'A';
+		EXPECT_EQ( std::string( str.begin(), str.end() ), "Abcdef" );
+
+		str.clear();
+		EXPECT_TRUE( str.empty() );
+		EXPECT_STREQ( str.c_str(), "" );
+	}
+
+	TEST( FixedStringModification, EmbeddedNullAndSelfAssignment )
+	{
+		FixedString<8> str{ std::string_view{ "a\0b", 3 } };
+		EXPECT_EQ( str.size(), 3u );
+
+		EXPECT_TRUE( str.tryAssign( str.view().substr( 1 ) ) );
+		EXPECT_EQ( str.view(), std::string_view( "\0b", 2 ) );
+	}
+
+	//----------------------------------------------
+	// Comparison and hashing
+	//----------------------------------------------
+
+	TEST( FixedStringComparison, MatchesStringView )
+	{
+		const FixedString<16> a{ "alpha" };
+		const FixedString<32> b{ "alpha" };
+		const FixedString<16> c{ "beta" };
+
+		EXPECT_EQ( a, b );
+		EXPECT_NE( a, c );
+		EXPECT_LT( a, c );
+		EXPECT_GT( c, std::string_view{ "alp" } );
+		EXPECT_EQ( std::hash<FixedString<16>>{}( a ), std::hash<std::string_view>{}( "alpha" ) );
+
+		std::unordered_set<FixedString<16>> set{ a, c };
+		EXPECT_EQ( set.count( FixedString<16>{ "beta" } ), 1u );
+	}
+
+	//=====================================================================
+	// Non-allocating string operations
+	//=====================================================================
+
+	TEST( FixedStringOperations, MatchAllocatingVersions )
+	{
+		FixedString<16> result;
+
+		EXPECT_TRUE( trim( "  host  ", result ) );
+		EXPECT_EQ( result, trim( "  host  " ) );
+
+		EXPECT_TRUE( toLower( "MiXeD\xC3\x89", result ) );
+		EXPECT_EQ( result, toLower( std::string_view{ "MiXeD\xC3\x89" } ) );
+
+		EXPECT_TRUE( toUpper( "MiXeD", result ) );
+		EXPECT_EQ( result, toUpper( std::string_view{ "MiXeD" } ) );
+
+		EXPECT_TRUE( padLeft( "42", 5, result, '0' ) );
+		EXPECT_EQ( result, padLeft( "42", 5, '0' ) );
+
+		EXPECT_TRUE( padRight( "42", 5, result ) );
+		EXPECT_EQ( result, padRight( "42", 5 ) );
+
+		EXPECT_TRUE( padLeft( "toolong", 3, result ) );
+		EXPECT_EQ( result, "toolong" );
+
+		EXPECT_TRUE( replace( "a-b-c", "-", "+", result ) );
+		EXPECT_EQ( result, replace( "a-b-c", "-", "+" ) );
+
+		EXPECT_TRUE( replace( "a-b-c", "", "+", result ) );
+		EXPECT_EQ( result, "a-b-c" );
+
+		EXPECT_TRUE( replaceAll( "a-b-c", "-", "::", result ) );
+		EXPECT_EQ( result, replaceAll( "a-b-c", "-", "::" ) );
+
+		EXPECT_TRUE( replaceAll( "aaa", "a", "", result ) );
+		EXPECT_TRUE( result.empty() );
+	}
+
+	TEST( FixedStringOperations, OverflowLeavesResultUnchanged )
+	{
+		FixedString<4> result{ "keep" };
+
+		EXPECT_FALSE( trim( " toolong ", result ) );
+		EXPECT_FALSE( toLower( "TOOLONG", result ) );
+		EXPECT_FALSE( padLeft( "x", 5, result ) );
+		EXPECT_FALSE( padRight( "x", 5, result ) );
+		EXPECT_FALSE( replace( "ab", "b", "bcde", result ) );
+		EXPECT_FALSE( replaceAll( "a.b.c", ".", "::", result ) );
+		EXPECT_EQ( result, "keep" );
+	}
+
+	TEST( FixedStringOperations, ResultMayAliasInput )
+	{
+		FixedString<20> str{ "  Host.Name  " };
+
+		EXPECT_TRUE( trim( str, str ) );
+		EXPECT_EQ( str, "Host.Name" );
+
+		EXPECT_TRUE( toLower( str, str ) );
+		EXPECT_EQ( str, "host.name" );
+
+		EXPECT_TRUE( padLeft( str, 12, str, '*' ) );
+		EXPECT_EQ( str, "***host.name" );
+
+		EXPECT_TRUE( replaceAll( str, "*", "", str ) );
+		EXPECT_TRUE( replace( str, ".", str, str ) );
+		EXPECT_EQ( str, "hosthost.namename" );
+	}
+
+	TEST( FixedStringOperations, ConstantEvaluation )
+	{
+		constexpr auto lowered = [] {
+			FixedString<8> result;
+			(void)toLower( "HTTP", result );
+			return result;
+		}();
+		static_assert( lowered == "http" );
+
+		constexpr auto padded = [] {
+			FixedString<8> result;
+			(void)padLeft( "7", 3, result, '0' );
+			(void)replaceAll( result, "0", "1", result );
+			return result;
+		}();
+		static_assert( padded == "117" );
+	}
+} // namespace nfx::string::test
@@ -0,0 +1,183 @@
+/**
+ * @file TESTS_FuzzyIndex.cpp
+ * @brief Tests for the trigram-filtered approximate lookup index
+ * @details Tests covering exact and approximate hits, result ordering, duplicates, short queries
+ *          whose trigram filter is disabled, and agreement with a brute-force scan over random
+ *          and host-name-like dictionaries
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nfx/string/FuzzyIndex.h>
+
+namespace nfx::string::test
+{
+	//=====================================================================
+	// FuzzyIndex tests
+	//=====================================================================
+
+	//----------------------------------------------
+	// Helpers
+	//----------------------------------------------
+
+	/** @brief Every entry within maxDistance, in the order FuzzyIndex::find reports them */
+	std::vector<FuzzyMatch> bruteForce( const std::vector<std::string>& entries, std::string_view query, std::size_t maxDistance )
+	{
+		std::vector<FuzzyMatch> expected;
+		for ( std::size_t i = 0; i < entries.size(); ++i )
+		{
+			const std::size_t distance = levenshteinDistance( query, entries[i] );
+			if ( distance <= maxDistance )
+			{
+				expected.push_back( FuzzyMatch{ i, distance, entries[i] } );
+			}
+		}
+		std::stable_sort( expected.begin(), expected.end(), []( const FuzzyMatch& a, const FuzzyMatch& b ) {
+			return a.distance < b.distance;
+		} );
+		return expected;
+	}
+
+	void expectSameMatches( const std::vector<FuzzyMatch>& actual, const std::vector<FuzzyMatch>& expected )
+	{
+		ASSERT_EQ( actual.size(), expected.size() );
+		for ( std::size_t i = 0; i < actual.size(); ++i )
+		{
+			EXPECT_EQ( actual[i].index, expected[i].index );
+			EXPECT_EQ( actual[i].distance, expected[i].distance );
+			EXPECT_EQ( actual[i].value, expected[i].value );
+		}
+	}
+
+	//----------------------------------------------
+	// Basic lookups
+	//----------------------------------------------
+
+	TEST( FuzzyIndex, EmptyIndex )
+	{
+		const FuzzyIndex index;
+		EXPECT_TRUE( index.empty() );
+		EXPECT_EQ( index.size(), 0 );
+		EXPECT_TRUE( index.find( "anything", 3 ).empty() );
+		EXPECT_TRUE( index.find( "", 0 ).empty() );
+	}
+
+	TEST( FuzzyIndex, ExactAndApproximateHits )
+	{
+		const std::vector<std::string> entries{ "kitten", "sitting", "mitten", "bitten", "kitchen", "written" };
+		const FuzzyIndex index{ entries };
+		EXPECT_EQ( index.size(), entries.size() );
+
+		const auto exact = index.find( "kitten", 0 );
+		ASSERT_EQ( exact.size(), 1 );
+		EXPECT_EQ( exact[0].index, 0 );
+		EXPECT_EQ( exact[0].distance, 0 );
+		EXPECT_EQ( exact[0].value, "kitten" );
+
+		const auto near = index.find( "kitten", 1 );
+		ASSERT_EQ( near.size(), 3 );
+		EXPECT_EQ( near[0].value, "kitten" );
+		EXPECT_EQ( near[1].value, "mitten" );
+		EXPECT_EQ( near[2].value, "bitten" );
+
+		EXPECT_TRUE( index.find( "xyzzy", 1 ).empty() );
+	}
+
+	TEST( FuzzyIndex, ResultsOrderedByDistanceThenIndex )
+	{
+		const std::vector<std::string> entries{ "abcd", "abce", "abc", "abcd", "xbcd" };
+		const FuzzyIndex index{ entries };
+		const auto matches = index.find( "abcd", 1 );
+		ASSERT_EQ( matches.size(), 5 );
+		EXPECT_EQ( matches[0].index, 0 );
+		EXPECT_EQ( matches[1].index, 3 );
+		EXPECT_EQ( matches[2].index, 1 );
+		EXPECT_EQ( matches[3].index, 2 );
+		EXPECT_EQ( matches[4].index, 4 );
+		EXPECT_EQ( matches[0].distance, 0 );
+		EXPECT_EQ( matches[4].distance, 1 );
+	}
+
+	TEST( FuzzyIndex, ShortQueriesAndEmptyEntries )
+	{
+		const std::vector<std::string> entries{ "", "a", "ab", "abc", "b" };
+		const FuzzyIndex index{ entries };
+		expectSameMatches( index.find( "", 1 ), bruteForce( entries, "", 1 ) );
+		expectSameMatches( index.find( "a", 0 ), bruteForce( entries, "a", 0 ) );
+		expectSameMatches( index.find( "a", 1 ), bruteForce( entries, "a", 1 ) );
+		expectSameMatches( index.find( "ac", 1 ), bruteForce( entries, "ac", 1 ) );
+		expectSameMatches( index.find( "abc", std::string_view::npos ), bruteForce( entries, "abc", std::string_view::npos ) );
+	}
+
+	TEST( FuzzyIndex, AcceptsStringViewContainers )
+	{
+		const std::vector<std::string_view> entries{ "alpha", "alpina", "beta" };
+		const FuzzyIndex index{ entries };
+		const auto matches = index.find( "alpha", 2 );
+		ASSERT_EQ( matches.size(), 2 );
+		EXPECT_EQ( matches[0].value, "alpha" );
+		EXPECT_EQ( matches[1].value, "alpina" );
+	}
+
+	//----------------------------------------------
+	// Agreement with brute force
+	//----------------------------------------------
+
+	TEST( FuzzyIndex, MatchesBruteForceOnRandomStrings )
+	{
+		std::mt19937 rng{ 7 };
+		std::vector<std::string> entries;
+		for ( std::size_t i = 0; i < 2000; ++i )
+		{
+			std::string entry( rng() % 12, ' ' );
+			for ( char& c : entry )
+			{
+				c = static_cast<char>( 'a' + rng() % 4 );
+			}
+			entries.push_back( std::move( entry ) );
+		}
+		const FuzzyIndex index{ entries };
+
+		for ( std::size_t q = 0; q < 100; ++q )
+		{
+			std::string query = entries[rng() % entries.size()];
+			if ( !query.empty() && q % 2 )
+			{
+				query[rng() % query.size()] = 'e';
+			}
+			for ( std::size_t k = 0; k <= 3; ++k )
+			{
+				expectSameMatches( index.find( query, k ), bruteForce( entries, query, k ) );
+			}
+		}
+	}
+
+	TEST( FuzzyIndex, MatchesBruteForceOnHostNames )
+	{
+		std::mt19937 rng{ 11 };
+		const std::vector<std::string> regions{ "eu-west", "eu-central", "us-east", "ap-south" };
+		std::vector<std::string> entries;
+		for ( std::size_t i = 0; i < 3000; ++i )
+		{
+			entries.push_back( "node-" + std::to_string( rng() % 5000 ) + "." + regions[rng() % regions.size()] + ".example.com" );
+		}
+		const FuzzyIndex index{ entries };
+
+		for ( std::size_t q = 0; q < 50; ++q )
+		{
+			std::string query = entries[rng() % entries.size()];
+			query.erase( rng() % query.size(), 1 );
+			query[rng() % query.size()] = 'x';
+			for ( std::size_t k : { 0, 1, 2, 4 } )
+			{
+				expectSameMatches( index.find( query, k ), bruteForce( entries, query, k ) );
+			}
+		}
+	}
+} // namespace nfx::string::test
@@ -0,0 +1,222 @@
+/**
+ * @file TESTS_Glob.cpp
+ * @brief Tests for compiled glob patterns and pattern sets
+ * @details Tests covering stars, question marks, bracket classes, escapes, case-insensitive
+ *          matching, pathological patterns, agreement with a reference backtracking matcher,
+ *          and multi-pattern lookup through GlobSet
+ */
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nfx/string/Glob.h>
+
+namespace nfx::string::test
+{
+	//=====================================================================
+	// Glob tests
+	//=====================================================================
+
+	//----------------------------------------------
+	// Helpers
+	//----------------------------------------------
+
+	/** @brief Reference matcher for patterns made of literals, '?' and '*' only */
+	bool referenceMatch( std::string_view pattern, std::string_view str )
+	{
+		if ( pattern.empty() )
+		{
+			return str.empty();
+		}
+		if ( pattern.front() == '*' )
+		{
+			for ( std::size_t skip = 0; skip <= str.size(); ++skip )
+			{
+				if ( referenceMatch( pattern.substr( 1 ), str.substr( skip ) ) )
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+		return !str.empty() && ( pattern.front() == '?' || pattern.front() == str.front() ) &&
+			   referenceMatch( pattern.substr( 1 ), str.substr( 1 ) );
+	}
+
+	//----------------------------------------------
+	// GlobPattern
+	//----------------------------------------------
+
+	TEST( GlobPattern, LiteralsAndStars )
+	{
+		EXPECT_TRUE( GlobPattern{ "*.example.com" }.matches( "api.example.com" ) );
+		EXPECT_TRUE( GlobPattern{ "*.example.com" }.matches( ".example.com" ) );
+		EXPECT_FALSE( GlobPattern{ "*.example.com" }.matches( "example.com" ) );
+		EXPECT_TRUE( GlobPattern{ "api.*" }.matches( "api.v2" ) );
+		EXPECT_TRUE( GlobPattern{ "*log*" }.matches( "/var/log/syslog" ) );
+		EXPECT_TRUE( GlobPattern{ "/var/*/*.log" }.matches( "/var/log/app/x.log" ) );
+		EXPECT_TRUE( GlobPattern{ "exact" }.matches( "exact" ) );
+		EXPECT_FALSE( GlobPattern{ "exact" }.matches( "exactly" ) );
+		EXPECT_TRUE( GlobPattern{ "*" }.matches( "" ) );
+		EXPECT_TRUE( GlobPattern{ "**" }.matches( "anything" ) );
+		EXPECT_TRUE( GlobPattern{ "" }.matches( "" ) );
+		EXPECT_FALSE( GlobPattern{ "" }.matches( "x" ) );
+		EXPECT_TRUE( GlobPattern{}.matches( "" ) );
+		EXPECT_FALSE( GlobPattern{}.matches( "x" ) );
+	}
+
+	TEST( GlobPattern, QuestionMarksAndOverlap )
+	{
+		EXPECT_TRUE( GlobPattern{ "node-??" }.matches( "node-42" ) );
+		EXPECT_FALSE( GlobPattern{ "node-??" }.matches( "node-4" ) );
+		EXPECT_TRUE( GlobPattern{ "a*ab" }.matches( "aab" ) );
+		EXPECT_FALSE( GlobPattern{ "ab*ba" }.matches( "aba" ) );
+		EXPECT_TRUE( GlobPattern{ "*a?c*" }.matches( "xxabcxx" ) );
+		EXPECT_TRUE( GlobPattern{ "*aa*aa" }.matches( "aaaa" ) );
+		EXPECT_FALSE( GlobPattern{ "*aa*aa" }.matches( "aaa" ) );
+	}
+
+	TEST( GlobPattern, BracketClasses )
+	{
+		const GlobPattern shard{ "shard-[0-9][0-9]" };
+		EXPECT_TRUE( shard.matches( "shard-07" ) );
+		EXPECT_FALSE( shard.matches( "shard-7a" ) );
+
+		EXPECT_TRUE( GlobPattern{ "[!a-c]x" }.matches( "dx" ) );
+		EXPECT_FALSE( GlobPattern{ "[!a-c]x" }.matches( "bx" ) );
+		EXPECT_TRUE( GlobPattern{ "[^a-c]x" }.matches( "dx" ) );
+		EXPECT_TRUE( GlobPattern{ "[]]" }.matches( "]" ) );
+		EXPECT_TRUE( GlobPattern{ "[a-]" }.matches( "-" ) );
+		EXPECT_TRUE( GlobPattern{ "[\\]x]" }.matches( "]" ) );
+		EXPECT_TRUE( GlobPattern{ "*.[ch]" }.matches( "main.c" ) );
+		EXPECT_FALSE( GlobPattern{ "*.[ch]" }.matches( "main.cc" ) );
+	}
+
+	TEST( GlobPattern, EscapesAndUnterminatedClasses )
+	{
+		EXPECT_TRUE( GlobPattern{ "what\\?" }.matches( "what?" ) );
+		EXPECT_FALSE( GlobPattern{ "what\\?" }.matches( "whatx" ) );
+		EXPECT_TRUE( GlobPattern{ "\\*star" }.matches( "*star" ) );
+		EXPECT_FALSE( GlobPattern{ "\\*star" }.matches( "xstar" ) );
+		EXPECT_TRUE( GlobPattern{ "a[b" }.matches( "a[b" ) );
+		EXPECT_TRUE( GlobPattern{ "tail\\" }.matches( "tail\\" ) );
+	}
+
+	TEST( GlobPattern, CaseInsensitive )
+	{
+		const GlobPattern host{ "*.Example.COM", GlobCase::Insensitive };
+		EXPECT_TRUE( host.matches( "API.example.com" ) );
+		EXPECT_TRUE( host.matches( "api.EXAMPLE.Com" ) );
+		EXPECT_FALSE( GlobPattern{ "*.Example.COM" }.matches( "api.example.com" ) );
+		EXPECT_EQ( host.caseMode(), GlobCase::Insensitive );
+		EXPECT_EQ( host.pattern(), "*.Example.COM" );
+
+		const GlobPattern letters{ "[a-c]*[!X]", GlobCase::Insensitive };
+		EXPECT_TRUE( letters.matches( "B12y" ) );
+		EXPECT_FALSE( letters.matches( "B12x" ) );
+		EXPECT_TRUE( GlobPattern( "*mid*", GlobCase::Insensitive ).matches( "xxMIDxx" ) );
+	}
+
+	TEST( GlobPattern, PathologicalPatternsStayFast )
+	{
+		const GlobPattern pattern{ "a*a*a*a*a*a*a*a*a*a*b" };
+		const std::string haystack( 100000, 'a' );
+		EXPECT_FALSE( pattern.matches( haystack ) );
+		EXPECT_TRUE( pattern.matches( haystack + "b" ) );
+	}
+
+	TEST( GlobPattern, MatchesReference )
+	{
+		std::mt19937 rng{ 9 };
+		const std::string patternAlphabet = "ab?**";
+		for ( std::size_t round = 0; round < 3000; ++round )
+		{
+			std::string pattern( rng() % 7, ' ' );
+			for ( char& c : pattern )
+			{
+				c = patternAlphabet[rng() % patternAlphabet.size()];
+			}
+			std::string str( rng() % 9, ' ' );
+			for ( char& c : str )
+			{
+				c = "ab"[rng() % 2];
+			}
+			EXPECT_EQ( GlobPattern{ pattern }.matches( str ), referenceMatch( pattern, str ) ) << pattern << " / " << str;
+		}
+	}
+
+	//----------------------------------------------
+	// GlobSet
+	//----------------------------------------------
+
+	TEST( GlobSet, MatchesManyPatterns )
+	{
+		GlobSet rules;
+		EXPECT_TRUE( rules.empty() );
+		EXPECT_EQ( rules.add( "*.example.com" ), 0 );
+		EXPECT_EQ( rules.add( "api.example.com" ), 1 );
+		EXPECT_EQ( rules.add( "API.*", GlobCase::Insensitive ), 2 );
+		EXPECT_EQ( rules.add( "*internal*" ), 3 );
+		EXPECT_EQ( rules.add( "LOCALHOST", GlobCase::Insensitive ), 4 );
+		EXPECT_EQ( rules.add( "?" ), 5 );
+		EXPECT_EQ( rules.add( "*" ), 6 );
+		EXPECT_EQ( rules.size(), 7 );
+		EXPECT_EQ( rules[1].pattern(), "api.example.com" );
+
+		EXPECT_EQ( rules.matches( "api.example.com" ), ( std::vector<std::size_t>{ 0, 1, 2, 6 } ) );
+		EXPECT_EQ( rules.matches( "Api.internal.net" ), ( std::vector<std::size_t>{ 2, 3, 6 } ) );
+		EXPECT_EQ( rules.matches( "localhost" ), ( std::vector<std::size_t>{ 4, 6 } ) );
+		EXPECT_EQ( rules.matches( "x" ), ( std::vector<std::size_t>{ 5, 6 } ) );
+		EXPECT_EQ( rules.matches( "" ), ( std::vector<std::size_t>{ 6 } ) );
+		EXPECT_TRUE( rules.matchesAny( "other.org" ) );
+	}
+
+	TEST( GlobSet, AgreesWithIndividualPatterns )
+	{
+		GlobSet set;
+		std::vector<GlobPattern> patterns;
+		std::mt19937 rng{ 4 };
+		const std::string alphabet = "aB.?*[]b-";
+		for ( std::size_t i = 0; i < 300; ++i )
+		{
+			std::string pattern( 1 + rng() % 6, ' ' );
+			for ( char& c : pattern )
+			{
+				c = alphabet[rng() % alphabet.size()];
+			}
+			const GlobCase caseMode = i % 3 == 0 ? GlobCase::Insensitive : GlobCase::Sensitive;
+			set.add( pattern, caseMode );
+			patterns.emplace_back( pattern, caseMode );
+		}
+
+		for ( std::size_t round = 0; round < 500; ++round )
+		{
+			std::string str( rng() % 8, ' ' );
+			for ( char& c : str )
+			{
+				c = "aAbB.-"[rng() % 6];
+			}
+			std::vector<std::size_t> expected;
+			for ( std::size_t id = 0; id < patterns.size(); ++id )
+			{
+				if ( patterns[id].matches( str ) )
+				{
+					expected.push_back( id );
+				}
+			}
+			EXPECT_EQ( set.matches( str ), expected ) << str;
+			EXPECT_EQ( set.matchesAny( str ), !expected.empty() );
+		}
+	}
+
+	TEST( GlobSet, EmptySet )
+	{
+		const GlobSet set;
+		EXPECT_FALSE( set.matchesAny( "x" ) );
+		EXPECT_TRUE( set.matches( "x" ).empty() );
+	}
+} // namespace nfx::string::test
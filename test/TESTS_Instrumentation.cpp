@@ -0,0 +1,202 @@
+/**
+ * @file TESTS_Instrumentation.cpp
+ * @brief Tests for the opt-in hot-path instrumentation
+ * @details Tests covering call and byte counts of the instrumented functions, Splitter
+ *          accounting, aggregation across live and exited threads, snapshot differences and
+ *          constant evaluation of the instrumented validators. The macro is defined here so
+ *          the suite runs whether or not NFX_STRINGUTILS_INSTRUMENT is enabled for the build.
+ */
+
+#if !defined( NFX_STRINGUTILS_INSTRUMENT )
+#	define NFX_STRINGUTILS_INSTRUMENT
+#endif
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <nfx/string/Instrumentation.h>
+#include <nfx/string/Splitter.h>
+#include <nfx/string/Utils.h>
+
+namespace nfx::string::test
+{
+	//=====================================================================
+	// Instrumentation tests
+	//=====================================================================
+
+	//----------------------------------------------
+	// Configuration
+	//----------------------------------------------
+
+	TEST( InstrumentationConfiguration, EnabledAndNamed )
+	{
+		EXPECT_TRUE( kInstrumentationEnabled );
+		EXPECT_EQ( instrumentedFunctionName( InstrumentedFunction::ReplaceAll ), "replaceAll" );
+		EXPECT_EQ( instrumentedFunctionName( InstrumentedFunction::Splitter ), "Splitter" );
+		EXPECT_EQ( instrumentedFunctionName( InstrumentedFunction::TryParseUInt ), "tryParseUInt" );
+		EXPECT_EQ( instrumentedFunctionName( InstrumentedFunction::TryParseEndpoint ), "tryParseEndpoint" );
+
+		for ( std::size_t i = 0; i < kInstrumentedFunctionCount; ++i )
+		{
+			EXPECT_FALSE( instrumentedFunctionName( static_cast<InstrumentedFunction>( i ) ).empty() ) << i;
+		}
+	}
+
+	TEST( InstrumentationConfiguration, ValidatorsStayConstexpr )
+	{
+		static_assert( isIPv4Address( "192.168.1.1" ) );
+		static_assert( !isIPv6Address( "::g" ) );
+		static_assert( isDomainName( "example.com" ) );
+		static_assert( isValidPort( std::string_view{ "8080" } ) );
+
+		const InstrumentationSnapshot before = instrumentationSnapshot();
+		constexpr bool valid = isValidHostname( "api.example.com" );
+		const InstrumentationSnapshot after = instrumentationSnapshot();
+
+		EXPECT_TRUE( valid );
+		EXPECT_EQ( ( after - before )[InstrumentedFunction::IsValidHostname].calls, 0u );
+	}
+
+	//----------------------------------------------
+	// Counting
+	//----------------------------------------------
+
+	TEST( InstrumentationCounting, CallsAndBytes )
+	{
+		const InstrumentationSnapshot before = instrumentationSnapshot();
+
+		const std::string replaced = replaceAll( "a-b-c-d", "-", "+" );
+		int intValue = 0;
+		std::int64_t longValue = 0;
+		bool boolValue = false;
+		EXPECT_TRUE( tryParseInt( "12345", intValue ) );
+		EXPECT_FALSE( tryParseInt( "12x", intValue ) );
+		EXPECT_TRUE( tryParseLong( "-9000000000", longValue ) );
+		EXPECT_TRUE( tryParseBool( "true", boolValue ) );
+		EXPECT_TRUE( isIPv4Address( "10.0.0.1" ) );
+		EXPECT_FALSE( isIPv6Address( "1::2::3" ) );
+
+		const InstrumentationSnapshot delta = instrumentationSnapshot() - before;
+
+		EXPECT_EQ( replaced, "a+b+c+d" );
+		EXPECT_EQ( delta[InstrumentedFunction::ReplaceAll].calls, 1u );
+		EXPECT_EQ( delta[InstrumentedFunction::ReplaceAll].bytes, 7u );
+		EXPECT_EQ( delta[InstrumentedFunction::TryParseInt].calls, 2u );
+		EXPECT_EQ( delta[InstrumentedFunction::TryParseInt].bytes, 8u );
+		EXPECT_EQ( delta[InstrumentedFunction::TryParseLong].calls, 1u );
+		EXPECT_EQ( delta[InstrumentedFunction::TryParseLong].bytes, 11u );
+		EXPECT_EQ( delta[InstrumentedFunction::TryParseBool].calls, 1u );
+		EXPECT_EQ( delta[InstrumentedFunction::IsIPv4Address].bytes, 8u );
+		EXPECT_EQ( delta[InstrumentedFunction::IsIPv6Address].calls, 1u );
+		EXPECT_EQ( delta[InstrumentedFunction::TryParseDouble].calls, 0u );
+		EXPECT_EQ( delta[InstrumentedFunction::Splitter].calls, 0u );
+	}
+
+	TEST( InstrumentationCounting, NestedCallsAreCounted )
+	{
+		const InstrumentationSnapshot before = instrumentationSnapshot();
+
+		std::string_view host;
+		std::uint16_t port = 0;
+		EXPECT_TRUE( tryParseEndpoint( "api.example.com:443", host, port ) );
+
+		const InstrumentationSnapshot delta = instrumentationSnapshot() - before;
+
+		EXPECT_EQ( delta[InstrumentedFunction::TryParseEndpoint].calls, 1u );
+		EXPECT_EQ( delta[InstrumentedFunction::TryParseEndpoint].bytes, 19u );
+		EXPECT_EQ( delta[InstrumentedFunction::IsValidHostname].calls, 1u );
+		EXPECT_EQ( delta[InstrumentedFunction::IsValidHostname].bytes, 15u );
+		EXPECT_GE( delta[InstrumentedFunction::TryParseEndpoint].nanoseconds,
+			delta[InstrumentedFunction::IsValidHostname].nanoseconds );
+	}
+
+	TEST( InstrumentationCounting, SplitterCountsOncePerPass )
+	{
+		const InstrumentationSnapshot before = instrumentationSnapshot();
+
+		std::vector<std::string_view> segments;
+		for ( std::string_view segment : splitView( "a,b,,c", ',' ) )
+		{
+			segments.push_back( segment );
+		}
+
+		const InstrumentationSnapshot delta = instrumentationSnapshot() - before;
+
+		EXPECT_EQ( segments.size(), 4u );
+		EXPECT_EQ( delta[InstrumentedFunction::Splitter].calls, 1u );
+		EXPECT_EQ( delta[InstrumentedFunction::Splitter].bytes, 6u );
+	}
+
+	//----------------------------------------------
+	// Threads
+	//----------------------------------------------
+
+	TEST( InstrumentationThreads, AggregatesLiveAndExitedThreads )
+	{
+		constexpr int threadCount = 4;
+		constexpr int callsPerThread = 1000;
+
+		const InstrumentationSnapshot before = instrumentationSnapshot();
+
+		// Half the threads exit before the snapshot, half are still alive while it is taken
+		std::vector<std::thread> exited;
+		for ( int t = 0; t < threadCount; ++t )
+		{
+			exited.emplace_back( [] {
+				for ( int i = 0; i < callsPerThread; ++i )
+				{
+					std::uint32_t value = 0;
+					static_cast<void>( tryParseUInt( "65535", value ) );
+				}
+			} );
+		}
+		for ( std::thread& thread : exited )
+		{
+			thread.join();
+		}
+
+		std::atomic<int> ready{ 0 };
+		std::atomic<bool> release{ false };
+		std::vector<std::thread> live;
+		for ( int t = 0; t < threadCount; ++t )
+		{
+			live.emplace_back( [&ready, &release] {
+				for ( int i = 0; i < callsPerThread; ++i )
+				{
+					std::uint32_t value = 0;
+					static_cast<void>( tryParseUInt( "8080", value ) );
+				}
+				ready.fetch_add( 1 );
+				while ( !release.load() )
+				{
+					std::this_thread::yield();
+				}
+			} );
+		}
+		while ( ready.load() != threadCount )
+		{
+			std::this_thread::yield();
+		}
+
+		const InstrumentationSnapshot during = instrumentationSnapshot() - before;
+		release.store( true );
+		for ( std::thread& thread : live )
+		{
+			thread.join();
+		}
+		const InstrumentationSnapshot after = instrumentationSnapshot() - before;
+
+		const std::uint64_t expectedCalls = 2u * threadCount * callsPerThread;
+		const std::uint64_t expectedBytes = std::uint64_t{ threadCount } * callsPerThread * ( 5u + 4u );
+		EXPECT_EQ( during[InstrumentedFunction::TryParseUInt].calls, expectedCalls );
+		EXPECT_EQ( during[InstrumentedFunction::TryParseUInt].bytes, expectedBytes );
+		EXPECT_EQ( after[InstrumentedFunction::TryParseUInt].calls, expectedCalls );
+		EXPECT_EQ( after[InstrumentedFunction::TryParseUInt].bytes, expectedBytes );
+	}
+} // namespace nfx::string::test
@@ -0,0 +1,185 @@
+/**
+ * @file TESTS_Levenshtein.cpp
+ * @brief Tests for the bit-parallel Levenshtein distance
+ * @details Tests covering known distances, agreement with the textbook dynamic programming
+ *          table for single-word and multi-block patterns, the bounded early-exit variant, and
+ *          the one-query-many-candidates matcher
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nfx/string/Levenshtein.h>
+
+namespace nfx::string::test
+{
+	//=====================================================================
+	// Levenshtein tests
+	//=====================================================================
+
+	//----------------------------------------------
+	// Helpers
+	//----------------------------------------------
+
+	/** @brief Textbook O(n*m) dynamic programming distance */
+	std::size_t referenceDistance( std::string_view lhs, std::string_view rhs )
+	{
+		std::vector<std::size_t> row( rhs.size() + 1 );
+		for ( std::size_t j = 0; j <= rhs.size(); ++j )
+		{
+			row[j] = j;
+		}
+		for ( std::size_t i = 1; i <= lhs.size(); ++i )
+		{
+			std::size_t diagonal = row[0];
+			row[0] = i;
+			for ( std::size_t j = 1; j <= rhs.size(); ++j )
+			{
+				const std::size_t above = row[j];
+				row[j] = std::min( { above + 1, row[j - 1] + 1, diagonal + ( lhs[i - 1] == rhs[j - 1] ? 0 : 1 ) } );
+				diagonal = above;
+			}
+		}
+		return row[rhs.size()];
+	}
+
+	/** @brief Random string over the first alphabetSize lowercase letters */
+	std::string randomString( std::mt19937& rng, std::size_t size, unsigned alphabetSize )
+	{
+		std::string str( size, ' ' );
+		for ( char& c : str )
+		{
+			c = static_cast<char>( 'a' + rng() % alphabetSize );
+		}
+		return str;
+	}
+
+	/** @brief Copy of str with count random single-byte edits */
+	std::string mutate( std::mt19937& rng, std::string str, std::size_t count )
+	{
+		for ( std::size_t i = 0; i < count; ++i )
+		{
+			const std::size_t pos = str.empty() ? 0 : rng() % str.size();
+			switch ( rng() % 3 )
+			{
+				case 0:
+					str.insert( str.begin() + static_cast<std::ptrdiff_t>( pos ), static_cast<char>( 'a' + rng() % 4 ) );
+					break;
+				case 1:
+					if ( !str.empty() )
+					{
+						str.erase( pos, 1 );
+					}
+					break;
+				default:
+					if ( !str.empty() )
+					{
+						str[pos] = static_cast<char>( 'a' + rng() % 4 );
+					}
+					break;
+			}
+		}
+		return str;
+	}
+
+	//----------------------------------------------
+	// Distance
+	//----------------------------------------------
+
+	TEST( LevenshteinDistance, KnownValues )
+	{
+		EXPECT_EQ( levenshteinDistance( "kitten", "sitting" ), 3u );
+		EXPECT_EQ( levenshteinDistance( "sitting", "kitten" ), 3u );
+		EXPECT_EQ( levenshteinDistance( "flaw", "lawn" ), 2u );
+		EXPECT_EQ( levenshteinDistance( "", "" ), 0u );
+		EXPECT_EQ( levenshteinDistance( "", "abc" ), 3u );
+		EXPECT_EQ( levenshteinDistance( "abc", "" ), 3u );
+		EXPECT_EQ( levenshteinDistance( "same", "same" ), 0u );
+		EXPECT_EQ( levenshteinDistance( std::string_view{ "a\0b", 3 }, std::string_view{ "a\0c", 3 } ), 1u );
+		EXPECT_EQ( levenshteinDistance( "\xFF\x80", "\x80\xFF" ), 2u );
+	}
+
+	TEST( LevenshteinDistance, MatchesDynamicProgramming )
+	{
+		std::mt19937 rng{ 59 };
+		for ( int round = 0; round < 3000; ++round )
+		{
+			const std::size_t lhsSize = rng() % 200;
+			const std::size_t rhsSize = rng() % 3 == 0 ? lhsSize : rng() % 200;
+			const unsigned alphabet = 2 + rng() % 20;
+			const std::string lhs = randomString( rng, lhsSize, alphabet );
+			const std::string rhs = rng() % 2 == 0 ? randomString( rng, rhsSize, alphabet ) : mutate( rng, lhs, rng() % 20 );
+
+			ASSERT_EQ( levenshteinDistance( lhs, rhs ), referenceDistance( lhs, rhs ) ) << lhs << " / " << rhs;
+		}
+	}
+
+	TEST( LevenshteinDistance, BlockBoundaries )
+	{
+		std::mt19937 rng{ 64 };
+		for ( std::size_t size : { 63u, 64u, 65u, 127u, 128u, 129u, 200u, 300u } )
+		{
+			for ( int round = 0; round < 20; ++round )
+			{
+				const std::string lhs = randomString( rng, size, 4 );
+				const std::string rhs = randomString( rng, size + rng() % 5, 4 );
+				ASSERT_EQ( levenshteinDistance( lhs, rhs ), referenceDistance( lhs, rhs ) ) << "size " << size;
+			}
+		}
+	}
+
+	TEST( LevenshteinDistance, BoundedVariant )
+	{
+		std::mt19937 rng{ 5 };
+		for ( int round = 0; round < 2000; ++round )
+		{
+			const std::string lhs = randomString( rng, rng() % 150, 3 + rng() % 10 );
+			const std::string rhs = mutate( rng, lhs, rng() % 12 );
+			const std::size_t maxDistance = rng() % 10;
+			const std::size_t expected = referenceDistance( lhs, rhs );
+
+			ASSERT_EQ( levenshteinDistance( lhs, rhs, maxDistance ), std::min( expected, maxDistance + 1 ) );
+		}
+
+		EXPECT_EQ( levenshteinDistance( "short", "much longer string", 3 ), 4u );
+		EXPECT_EQ( levenshteinDistance( "abc", "abd", 0 ), 1u );
+		EXPECT_EQ( levenshteinDistance( "abc", "abc", 0 ), 0u );
+	}
+
+	//----------------------------------------------
+	// LevenshteinMatcher
+	//----------------------------------------------
+
+	TEST( LevenshteinMatcher, MatchesFreeFunction )
+	{
+		std::mt19937 rng{ 11 };
+		for ( std::size_t querySize : { 0u, 1u, 10u, 64u, 65u, 150u } )
+		{
+			const std::string query = randomString( rng, querySize, 5 );
+			const LevenshteinMatcher matcher{ query };
+			EXPECT_EQ( matcher.size(), querySize );
+
+			std::vector<std::string> candidates;
+			for ( int i = 0; i < 50; ++i )
+			{
+				candidates.push_back( i % 2 == 0 ? mutate( rng, query, rng() % 8 ) : randomString( rng, rng() % 160, 5 ) );
+			}
+
+			const std::vector<std::size_t> all = matcher.distances( candidates );
+			const std::vector<std::size_t> bounded = matcher.distances( candidates, 3 );
+			ASSERT_EQ( all.size(), candidates.size() );
+			for ( std::size_t i = 0; i < candidates.size(); ++i )
+			{
+				const std::size_t expected = referenceDistance( query, candidates[i] );
+				EXPECT_EQ( all[i], expected );
+				EXPECT_EQ( bounded[i], std::min<std::size_t>( expected, 4 ) );
+				EXPECT_EQ( matcher.distance( candidates[i], 3 ), bounded[i] );
+			}
+		}
+	}
+} // namespace nfx::string::test
@@ -0,0 +1,132 @@
+/**
+ * @file TESTS_NaturalOrder.cpp
+ * @brief Tests for natural-order comparison and sorting
+ * @details Tests covering numeric runs, leading zeros, numbers longer than any integer type,
+ *          mixed digit and non-digit bytes, compile-time evaluation, and agreement between
+ *          naturalSort and std::sort with naturalLess
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nfx/string/NaturalOrder.h>
+
+namespace nfx::string::test
+{
+	//=====================================================================
+	// Natural order tests
+	//=====================================================================
+
+	//----------------------------------------------
+	// naturalCompare
+	//----------------------------------------------
+
+	static_assert( naturalCompare( "file9", "file10" ) < 0 );
+	static_assert( naturalCompare( "file10", "file9" ) > 0 );
+	static_assert( naturalCompare( "abc", "abc" ) == 0 );
+	static_assert( naturalLess( "v1.2.9", "v1.2.10" ) );
+
+	TEST( NaturalOrder, ComparesDigitRunsNumerically )
+	{
+		EXPECT_LT( naturalCompare( "img2.png", "img12.png" ), 0 );
+		EXPECT_GT( naturalCompare( "img12.png", "img2.png" ), 0 );
+		EXPECT_LT( naturalCompare( "shard-99", "shard-100" ), 0 );
+		EXPECT_LT( naturalCompare( "1.9.0", "1.10.0" ), 0 );
+		EXPECT_LT( naturalCompare( "a1b2", "a1b10" ), 0 );
+		EXPECT_EQ( naturalCompare( "42", "42" ), 0 );
+		EXPECT_EQ( naturalCompare( "", "" ), 0 );
+	}
+
+	TEST( NaturalOrder, ComparesNonDigitsByteWise )
+	{
+		EXPECT_LT( naturalCompare( "abc", "abd" ), 0 );
+		EXPECT_LT( naturalCompare( "ab", "abc" ), 0 );
+		EXPECT_GT( naturalCompare( "b", "a100" ), 0 );
+		EXPECT_LT( naturalCompare( "", "a" ), 0 );
+		EXPECT_LT( naturalCompare( "x-1", "x1" ), 0 );
+		EXPECT_LT( naturalCompare( "x1", "xa" ), 0 );
+		EXPECT_LT( naturalCompare( "a", "\xC3\xA9" ), 0 );
+	}
+
+	TEST( NaturalOrder, LeadingZerosBreakTiesOnly )
+	{
+		EXPECT_LT( naturalCompare( "a1", "a01" ), 0 );
+		EXPECT_GT( naturalCompare( "a001", "a01" ), 0 );
+		EXPECT_LT( naturalCompare( "a01", "a2" ), 0 );
+		EXPECT_LT( naturalCompare( "0", "00" ), 0 );
+		EXPECT_LT( naturalCompare( "a01b", "a1c" ), 0 );
+		EXPECT_LT( naturalCompare( "1-02", "01-2" ), 0 );
+	}
+
+	TEST( NaturalOrder, ArbitraryLengthNumbers )
+	{
+		const std::string small = "id-" + std::string( 300, '9' );
+		const std::string large = "id-1" + std::string( 300, '0' );
+		EXPECT_LT( naturalCompare( small, large ), 0 );
+		EXPECT_LT( naturalCompare( "n18446744073709551615", "n18446744073709551616" ), 0 );
+		EXPECT_LT( naturalCompare( "n99999999999999999999999", "n100000000000000000000000" ), 0 );
+	}
+
+	//----------------------------------------------
+	// naturalSort
+	//----------------------------------------------
+
+	TEST( NaturalOrder, SortsArtifactNames )
+	{
+		std::vector<std::string_view> names{ "build-10.tar", "build-9.tar", "build-010.tar", "build-1.tar", "build.tar", "Build-2.tar" };
+		naturalSort( names );
+		const std::vector<std::string_view> expected{ "Build-2.tar", "build-1.tar", "build-9.tar", "build-10.tar", "build-010.tar", "build.tar" };
+		EXPECT_EQ( names, expected );
+	}
+
+	TEST( NaturalOrder, SortHandlesEmptyInput )
+	{
+		std::vector<std::string_view> none;
+		naturalSort( none );
+		EXPECT_TRUE( none.empty() );
+
+		std::vector<std::string_view> blanks{ "", "0", "", "a" };
+		naturalSort( blanks );
+		const std::vector<std::string_view> expected{ "", "", "0", "a" };
+		EXPECT_EQ( blanks, expected );
+	}
+
+	TEST( NaturalOrder, SortMatchesComparator )
+	{
+		std::mt19937 rng{ 5 };
+		const std::string alphabet = "00019ab.-\xFF";
+		std::vector<std::string> storage;
+		for ( std::size_t i = 0; i < 5000; ++i )
+		{
+			std::string str( rng() % 10, ' ' );
+			for ( char& c : str )
+			{
+				c = alphabet[rng() % alphabet.size()];
+			}
+			if ( i % 50 == 0 )
+			{
+				str += std::string( 260 + rng() % 3, '0' ) + "7";
+			}
+			storage.push_back( std::move( str ) );
+		}
+
+		std::vector<std::string_view> sorted( storage.begin(), storage.end() );
+		naturalSort( sorted );
+		std::vector<std::string_view> expected( storage.begin(), storage.end() );
+		std::sort( expected.begin(), expected.end(), naturalLess );
+		EXPECT_EQ( sorted, expected );
+
+		// Only identical strings compare equal, and the order is antisymmetric
+		for ( std::size_t i = 0; i + 1 < storage.size(); ++i )
+		{
+			const int forward = naturalCompare( storage[i], storage[i + 1] );
+			EXPECT_EQ( forward, -naturalCompare( storage[i + 1], storage[i] ) );
+			EXPECT_EQ( forward == 0, storage[i] == storage[i + 1] );
+		}
+	}
+} // namespace nfx::string::test
@@ -0,0 +1,233 @@
+/**
+ * @file TESTS_PrefixMatcher.cpp
+ * @brief Tests for the compacted radix tree prefix matcher
+ * @details Tests covering longest and all-match lookups, the empty prefix, duplicates, edge
+ *          labels that end inside the string, and agreement with a startsWith() scan over
+ *          random and route-like prefix sets
+ */
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nfx/string/PrefixMatcher.h>
+#include <nfx/string/Utils.h>
+
+#include "AllocationCounter.h"
+
+namespace nfx::string::test
+{
+	//=====================================================================
+	// PrefixMatcher tests
+	//=====================================================================
+
+	//----------------------------------------------
+	// Helpers
+	//----------------------------------------------
+
+	/** @brief Every distinct prefix of str, shortest first, with the index of its first occurrence */
+	std::vector<PrefixMatch> bruteForce( const std::vector<std::string>& prefixes, std::string_view str )
+	{
+		std::vector<PrefixMatch> expected;
+		for ( std::size_t length = 0; length <= str.size(); ++length )
+		{
+			for ( std::size_t i = 0; i < prefixes.size(); ++i )
+			{
+				if ( prefixes[i].size() == length && startsWith( str, prefixes[i] ) )
+				{
+					expected.push_back( PrefixMatch{ i, length } );
+					break;
+				}
+			}
+		}
+		return expected;
+	}
+
+	void expectSameMatches( const PrefixMatcher& matcher, const std::vector<std::string>& prefixes, std::string_view str )
+	{
+		const auto expected = bruteForce( prefixes, str );
+		const auto actual = matcher.allMatches( str );
+		ASSERT_EQ( actual.size(), expected.size() ) << str;
+		for ( std::size_t i = 0; i < actual.size(); ++i )
+		{
+			EXPECT_EQ( actual[i].index, expected[i].index ) << str;
+			EXPECT_EQ( actual[i].length, expected[i].length ) << str;
+		}
+
+		PrefixMatch longest{ 0, 0 };
+		ASSERT_EQ( matcher.longestMatch( str, longest ), !expected.empty() ) << str;
+		EXPECT_EQ( matcher.matchesAny( str ), !expected.empty() ) << str;
+		if ( !expected.empty() )
+		{
+			EXPECT_EQ( longest.index, expected.back().index ) << str;
+			EXPECT_EQ( longest.length, expected.back().length ) << str;
+		}
+	}
+
+	//----------------------------------------------
+	// Basic lookups
+	//----------------------------------------------
+
+	TEST( PrefixMatcher, EmptyMatcher )
+	{
+		const PrefixMatcher matcher;
+		EXPECT_TRUE( matcher.empty() );
+		EXPECT_EQ( matcher.size(), 0 );
+
+		PrefixMatch match{ 7, 7 };
+		EXPECT_FALSE( matcher.longestMatch( "/api", match ) );
+		EXPECT_EQ( match.index, 7 );
+		EXPECT_TRUE( matcher.allMatches( "/api" ).empty() );
+		EXPECT_FALSE( matcher.matchesAny( "" ) );
+
+		const PrefixMatcher none{ std::vector<std::string>{} };
+		EXPECT_TRUE( none.empty() );
+		EXPECT_FALSE( none.matchesAny( "/api" ) );
+	}
+
+	TEST( PrefixMatcher, LongestAndAllMatches )
+	{
+		const std::vector<std::string> routes{ "/api/", "/api/users/", "/static/", "/api/users/admin", "/" };
+		const PrefixMatcher matcher{ routes };
+		EXPECT_EQ( matcher.size(), routes.size() );
+		EXPECT_EQ( matcher.prefix( 2 ), "/static/" );
+
+		PrefixMatch match{ 0, 0 };
+		ASSERT_TRUE( matcher.longestMatch( "/api/users/42", match ) );
+		EXPECT_EQ( match.index, 1 );
+		EXPECT_EQ( match.length, 11 );
+
+		ASSERT_TRUE( matcher.longestMatch( "/api/orders", match ) );
+		EXPECT_EQ( match.index, 0 );
+
+		ASSERT_TRUE( matcher.longestMatch( "/index.html", match ) );
+		EXPECT_EQ( match.index, 4 );
+		EXPECT_EQ( match.length, 1 );
+
+		EXPECT_FALSE( matcher.longestMatch( "api/", match ) );
+		EXPECT_FALSE( matcher.matchesAny( "" ) );
+
+		const auto all = matcher.allMatches( "/api/users/admin/settings" );
+		ASSERT_EQ( all.size(), 4 );
+		EXPECT_EQ( all[0].index, 4 );
+		EXPECT_EQ( all[1].index, 0 );
+		EXPECT_EQ( all[2].index, 1 );
+		EXPECT_EQ( all[3].index, 3 );
+	}
+
+	TEST( PrefixMatcher, PartialEdgeLabels )
+	{
+		// "/api/v1/" and "/api/v2/" share the edge "/api/v"; strings ending inside it match nothing
+		const PrefixMatcher matcher{ std::vector<std::string_view>{ "/api/v1/", "/api/v2/" } };
+		EXPECT_FALSE( matcher.matchesAny( "/api" ) );
+		EXPECT_FALSE( matcher.matchesAny( "/api/v" ) );
+		EXPECT_FALSE( matcher.matchesAny( "/api/v1" ) );
+		EXPECT_FALSE( matcher.matchesAny( "/api/x1/" ) );
+		EXPECT_FALSE( matcher.matchesAny( "/api/v3/" ) );
+		EXPECT_TRUE( matcher.matchesAny( "/api/v2/" ) );
+	}
+
+	TEST( PrefixMatcher, EmptyPrefixAndDuplicates )
+	{
+		const std::vector<std::string> prefixes{ "ab", "", "ab", "abc", "" };
+		const PrefixMatcher matcher{ prefixes };
+		EXPECT_EQ( matcher.size(), 5 );
+		EXPECT_TRUE( matcher.matchesAny( "" ) );
+		EXPECT_TRUE( matcher.matchesAny( "xyz" ) );
+
+		const auto all = matcher.allMatches( "abcd" );
+		ASSERT_EQ( all.size(), 3 );
+		EXPECT_EQ( all[0].index, 1 );
+		EXPECT_EQ( all[0].length, 0 );
+		EXPECT_EQ( all[1].index, 0 );
+		EXPECT_EQ( all[2].index, 3 );
+	}
+
+	TEST( PrefixMatcher, BinaryBytes )
+	{
+		const std::vector<std::string> prefixes{ std::string{ "\0\xff", 2 }, std::string{ "\0", 1 }, "\x80" };
+		const PrefixMatcher matcher{ prefixes };
+		PrefixMatch match{ 0, 0 };
+		ASSERT_TRUE( matcher.longestMatch( std::string_view{ "\0\xff\x01", 3 }, match ) );
+		EXPECT_EQ( match.index, 0 );
+		ASSERT_TRUE( matcher.longestMatch( std::string_view{ "\0\xfe", 2 }, match ) );
+		EXPECT_EQ( match.index, 1 );
+		EXPECT_TRUE( matcher.matchesAny( "\x80\x80" ) );
+	}
+
+	//----------------------------------------------
+	// Agreement with startsWith
+	//----------------------------------------------
+
+	TEST( PrefixMatcher, MatchesStartsWithOnRandomPrefixes )
+	{
+		std::mt19937 rng{ 5 };
+		std::vector<std::string> prefixes;
+		for ( std::size_t i = 0; i < 500; ++i )
+		{
+			std::string prefix( rng() % 9, ' ' );
+			for ( char& c : prefix )
+			{
+				c = static_cast<char>( 'a' + rng() % 3 );
+			}
+			prefixes.push_back( std::move( prefix ) );
+		}
+		const PrefixMatcher matcher{ prefixes };
+
+		for ( std::size_t q = 0; q < 1000; ++q )
+		{
+			std::string str( rng() % 12, ' ' );
+			for ( char& c : str )
+			{
+				c = static_cast<char>( 'a' + rng() % 4 );
+			}
+			expectSameMatches( matcher, prefixes, str );
+		}
+	}
+
+	TEST( PrefixMatcher, MatchesStartsWithOnRoutes )
+	{
+		const std::vector<std::string> segments{ "api", "v1", "v2", "users", "orders", "static", "img", "admin", "" };
+		std::mt19937 rng{ 13 };
+		const auto randomPath = [&]( std::size_t depth ) {
+			std::string path;
+			for ( std::size_t i = 0; i < depth; ++i )
+			{
+				path.push_back( '/' );
+				path.append( segments[rng() % segments.size()] );
+			}
+			return path;
+		};
+
+		std::vector<std::string> prefixes;
+		for ( std::size_t i = 0; i < 300; ++i )
+		{
+			prefixes.push_back( randomPath( 1 + rng() % 4 ) );
+		}
+		const PrefixMatcher matcher{ prefixes };
+
+		for ( std::size_t q = 0; q < 1000; ++q )
+		{
+			expectSameMatches( matcher, prefixes, randomPath( rng() % 7 ) );
+		}
+	}
+
+	//----------------------------------------------
+	// Allocation guarantees
+	//----------------------------------------------
+
+	TEST( PrefixMatcher, LookupsDoNotAllocate )
+	{
+		const PrefixMatcher matcher{ std::vector<std::string>{ "/api/", "/api/users/", "/static/" } };
+		PrefixMatch match{ 0, 0 };
+		bool found = false;
+		EXPECT_NO_ALLOC( found = matcher.longestMatch( "/api/users/42/orders/7/items", match ) );
+		EXPECT_TRUE( found );
+		EXPECT_EQ( match.index, 1 );
+		EXPECT_NO_ALLOC( found = matcher.matchesAny( "/static/css/site.css" ) );
+		EXPECT_TRUE( found );
+	}
+} // namespace nfx::string::test
@@ -0,0 +1,129 @@
+/**
+ * @file TESTS_RadixSort.cpp
+ * @brief Tests for the cached-key string sorts
+ * @details Tests covering agreement with std::sort on random bytes, embedded NUL and high bytes,
+ *          long shared prefixes, heavy duplication, and the case-insensitive ordering
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nfx/string/RadixSort.h>
+#include <nfx/string/Utils.h>
+
+namespace nfx::string::test
+{
+	//=====================================================================
+	// Radix sort tests
+	//=====================================================================
+
+	//----------------------------------------------
+	// Helpers
+	//----------------------------------------------
+
+	/** @brief Seeded strings over a small alphabet, so that prefixes and duplicates are common */
+	std::vector<std::string> randomStrings( std::size_t count, std::size_t maxLength, std::string_view alphabet, unsigned seed )
+	{
+		std::mt19937 rng{ seed };
+		std::vector<std::string> strings;
+		for ( std::size_t i = 0; i < count; ++i )
+		{
+			std::string str( rng() % ( maxLength + 1 ), ' ' );
+			for ( char& c : str )
+			{
+				c = alphabet[rng() % alphabet.size()];
+			}
+			strings.push_back( std::move( str ) );
+		}
+		return strings;
+	}
+
+	/** @brief Reference case-insensitive order with byte-wise tie-break */
+	bool ignoreCaseLess( std::string_view lhs, std::string_view rhs )
+	{
+		const std::string left = toLower( lhs );
+		const std::string right = toLower( rhs );
+		return left != right ? left < right : lhs < rhs;
+	}
+
+	//----------------------------------------------
+	// radixSort
+	//----------------------------------------------
+
+	TEST( RadixSort, EmptyAndSingle )
+	{
+		std::vector<std::string_view> none;
+		radixSort( none );
+		EXPECT_TRUE( none.empty() );
+
+		std::vector<std::string_view> one{ "only" };
+		radixSort( one );
+		EXPECT_EQ( one.front(), "only" );
+	}
+
+	TEST( RadixSort, SortsSplitFields )
+	{
+		std::vector<std::string_view> fields{ "retry", "GET", "", "error", "GET", "errors", "err", "POST", "ok" };
+		radixSort( fields );
+		const std::vector<std::string_view> expected{ "", "GET", "GET", "POST", "err", "error", "errors", "ok", "retry" };
+		EXPECT_EQ( fields, expected );
+	}
+
+	TEST( RadixSort, MatchesStdSortOnRandomBytes )
+	{
+		using namespace std::string_view_literals;
+		const std::string_view alphabet = "ab\0\x01\x7F\x80\xFFz"sv;
+		for ( unsigned seed = 0; seed < 20; ++seed )
+		{
+			const auto storage = randomStrings( 1 + seed * 300, 24, alphabet, seed );
+			std::vector<std::string_view> sorted( storage.begin(), storage.end() );
+			std::vector<std::string_view> expected = sorted;
+			radixSort( sorted );
+			std::sort( expected.begin(), expected.end() );
+			EXPECT_EQ( sorted, expected );
+		}
+	}
+
+	TEST( RadixSort, LongSharedPrefixesAndDuplicates )
+	{
+		const std::string prefix( 100, 'p' );
+		std::vector<std::string> storage;
+		for ( std::size_t i = 0; i < 2000; ++i )
+		{
+			storage.push_back( prefix + std::to_string( ( i * 7919 ) % 300 ) );
+			storage.push_back( prefix.substr( 0, i % 101 ) );
+		}
+		std::vector<std::string_view> sorted( storage.begin(), storage.end() );
+		std::vector<std::string_view> expected = sorted;
+		radixSort( sorted );
+		std::sort( expected.begin(), expected.end() );
+		EXPECT_EQ( sorted, expected );
+	}
+
+	//----------------------------------------------
+	// radixSortIgnoreCase
+	//----------------------------------------------
+
+	TEST( RadixSort, IgnoreCaseOrdersFoldedThenByteWise )
+	{
+		std::vector<std::string_view> words{ "beta", "Alpha", "alpha", "ALPHA", "Beta", "alphabet", "_x", "[" };
+		radixSortIgnoreCase( words );
+		const std::vector<std::string_view> expected{ "[", "_x", "ALPHA", "Alpha", "alpha", "alphabet", "Beta", "beta" };
+		EXPECT_EQ( words, expected );
+	}
+
+	TEST( RadixSort, IgnoreCaseMatchesReference )
+	{
+		const auto storage = randomStrings( 5000, 20, "aAbBzZ@[`{0\xC3", 3 );
+		std::vector<std::string_view> sorted( storage.begin(), storage.end() );
+		std::vector<std::string_view> expected = sorted;
+		radixSortIgnoreCase( sorted );
+		std::sort( expected.begin(), expected.end(), ignoreCaseLess );
+		EXPECT_EQ( sorted, expected );
+	}
+} // namespace nfx::string::test
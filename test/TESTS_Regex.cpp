@@ -0,0 +1,432 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file TESTS_Regex.cpp
+ * @brief Tests for the lazy-DFA regular expression engine
+ * @details Tests covering syntax, anchors, case-insensitive matching, invalid patterns,
+ *          leftmost-longest match positions, replacement, splitting, pathological patterns,
+ *          and agreement with std::regex on random patterns
+ */
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <regex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <nfx/string/Regex.h>
+
+namespace nfx::string::test
+{
+	//----------------------------------------------
+	// Helpers
+	//----------------------------------------------
+
+	/** @brief Collects the pieces of a regexSplit */
+	std::vector<std::string_view> splitAll( std::string_view str, const Regex& regex )
+	{
+		std::vector<std::string_view> pieces;
+		for ( std::string_view piece : regexSplit( str, regex ) )
+		{
+			pieces.push_back( piece );
+		}
+		return pieces;
+	}
+
+	/** @brief Random pattern over 'a' and 'b' in the syntax shared with ECMAScript std::regex */
+	std::string randomPattern( std::mt19937& rng, int depth )
+	{
+		switch ( depth > 2 ? rng() % 4 : rng() % 9 )
+		{
+			case 0:
+			{
+				return "a";
+			}
+			case 1:
+			{
+				return "b";
+			}
+			case 2:
+			{
+				return rng() % 2 == 0 ? "." : "[ab]";
+			}
+			case 3:
+			{
+				return "[^a]";
+			}
+			case 4:
+			case 5:
+			{
+				return randomPattern( rng, depth + 1 ) + randomPattern( rng, depth + 1 );
+			}
+			case 6:
+			{
+				std::string pattern{ "(" };
+				pattern.append( randomPattern( rng, depth + 1 ) ).append( "|" ).append( randomPattern( rng, depth + 1 ) );
+				return pattern.append( ")" );
+			}
+			case 7:
+			{
+				const char* quantifiers[] = { "*", "+", "?", "{2}", "{1,3}", "{0,}" };
+				std::string pattern{ "(" };
+				pattern.append( randomPattern( rng, depth + 1 ) ).append( ")" );
+				return pattern.append( quantifiers[rng() % 6] );
+			}
+			default:
+			{
+				std::string pattern = randomPattern( rng, depth + 1 );
+				pattern.push_back( 'b' );
+				return pattern;
+			}
+		}
+	}
+
+	//----------------------------------------------
+	// Regex
+	//----------------------------------------------
+
+	TEST( Regex, LiteralsClassesAndEscapes )
+	{
+		EXPECT_TRUE( Regex{ "abc" }.matches( "abc" ) );
+		EXPECT_FALSE( Regex{ "abc" }.matches( "abcd" ) );
+		EXPECT_TRUE( Regex{ "a.c" }.matches( "a-c" ) );
+		EXPECT_FALSE( Regex{ "a.c" }.matches( "a\nc" ) );
+		EXPECT_TRUE( Regex{ "[a-c]+[^0-9]" }.matches( "cabx" ) );
+		EXPECT_FALSE( Regex{ "[a-c]+[^0-9]" }.matches( "cab7" ) );
+		EXPECT_TRUE( Regex{ "[]a]+" }.matches( "]a]" ) );
+		EXPECT_TRUE( Regex{ "[a-]+" }.matches( "-a-" ) );
+		EXPECT_TRUE( Regex{ "\\d{3}-\\d{4}" }.matches( "555-0199" ) );
+		EXPECT_TRUE( Regex{ "\\w+\\s\\S+" }.matches( "user_1 x@y" ) );
+		EXPECT_FALSE( Regex{ "\\D" }.matches( "7" ) );
+		EXPECT_TRUE( Regex{ "[\\d.]+" }.matches( "10.0.0.1" ) );
+		EXPECT_TRUE( Regex{ "\\x41\\t\\." }.matches( "A\t." ) );
+		EXPECT_TRUE( Regex{ "a\\*\\(\\)" }.matches( "a*()" ) );
+		EXPECT_TRUE( Regex{ "" }.matches( "" ) );
+		EXPECT_FALSE( Regex{ "" }.matches( "x" ) );
+	}
+
+	TEST( Regex, QuantifiersAndAlternation )
+	{
+		EXPECT_TRUE( Regex{ "(ERROR|WARN(ING)?) \\d+" }.matches( "WARNING 42" ) );
+		EXPECT_TRUE( Regex{ "(?:ab)*c" }.matches( "ababc" ) );
+		EXPECT_FALSE( Regex{ "(ab)*c" }.matches( "abac" ) );
+		EXPECT_TRUE( Regex{ "a{2,3}" }.matches( "aaa" ) );
+		EXPECT_FALSE( Regex{ "a{2,3}" }.matches( "aaaa" ) );
+		EXPECT_TRUE( Regex{ "a{2,}" }.matches( "aaaaaa" ) );
+		EXPECT_FALSE( Regex{ "a{2}" }.matches( "a" ) );
+		EXPECT_TRUE( Regex{ "a+?b" }.matches( "aab" ) );
+		EXPECT_TRUE( Regex{ "(|x)y" }.matches( "y" ) );
+		EXPECT_TRUE( Regex{ "(a*)*b" }.matches( "aaab" ) );
+	}
+
+	TEST( Regex, Anchors )
+	{
+		EXPECT_TRUE( Regex{ "^GET " }.search( "GET /index.html" ) );
+		EXPECT_FALSE( Regex{ "^GET " }.search( "X GET /" ) );
+		EXPECT_TRUE( Regex{ "\\.log$" }.search( "app.log" ) );
+		EXPECT_FALSE( Regex{ "\\.log$" }.search( "app.log.1" ) );
+		EXPECT_TRUE( Regex{ "^(a|b)+$" }.search( "abba" ) );
+		EXPECT_FALSE( Regex{ "^(a|b)+$" }.search( "abca" ) );
+		EXPECT_TRUE( Regex{ "cost\\$" }.search( "cost$" ) );
+		EXPECT_TRUE( Regex{ "^$" }.search( "" ) );
+		EXPECT_FALSE( Regex{ "^$" }.search( "x" ) );
+	}
+
+	TEST( Regex, CaseInsensitive )
+	{
+		const Regex regex{ "error: [a-z]+", RegexCase::Insensitive };
+		EXPECT_TRUE( regex.matches( "ERROR: Disk" ) );
+		EXPECT_TRUE( regex.search( "[Error: timeout]" ) );
+		EXPECT_FALSE( Regex( "[^a]", RegexCase::Insensitive ).matches( "A" ) );
+		EXPECT_FALSE( Regex{ "error" }.matches( "ERROR" ) );
+		EXPECT_EQ( regex.caseMode(), RegexCase::Insensitive );
+	}
+
+	TEST( Regex, InvalidPatterns )
+	{
+		for ( const char* pattern : { "(", "a)", "[a", "*a", "a{2", "a{3,1}", "a{1001}", "\\", "\\q", "a^b", "a$b", "^a|b", "\\x4" } )
+		{
+			const Regex regex{ pattern };
+			EXPECT_FALSE( regex.isValid() ) << pattern;
+			EXPECT_FALSE( regex.matches( pattern ) ) << pattern;
+			EXPECT_FALSE( regex.search( pattern ) ) << pattern;
+		}
+		EXPECT_FALSE( Regex{}.isValid() );
+		EXPECT_FALSE( Regex{}.search( "" ) );
+		EXPECT_FALSE( Regex{ "(a{1000}){1000}" }.isValid() );
+		EXPECT_TRUE( Regex{ "^(a|b)$" }.isValid() );
+		EXPECT_EQ( Regex{ "a+" }.pattern(), "a+" );
+	}
+
+	TEST( Regex, FindsLeftmostLongest )
+	{
+		std::string_view match;
+		ASSERT_TRUE( Regex{ "abcd|c" }.find( "xabcd", 0, match ) );
+		EXPECT_EQ( match, "abcd" );
+		ASSERT_TRUE( Regex{ "a|ab|abc" }.find( "zabcz", 0, match ) );
+		EXPECT_EQ( match, "abc" );
+		ASSERT_TRUE( Regex{ "\\d+" }.find( "id=123 id=45", 7, match ) );
+		EXPECT_EQ( match, "45" );
+		ASSERT_TRUE( Regex{ "x*" }.find( "abc", 1, match ) );
+		EXPECT_EQ( match, "" );
+		EXPECT_FALSE( Regex{ "q" }.find( "abc", 0, match ) );
+		EXPECT_FALSE( Regex{ "a" }.find( "abc", 4, match ) );
+		ASSERT_TRUE( Regex{ "b+$" }.find( "abb abbb", 0, match ) );
+		EXPECT_EQ( match, "bbb" );
+		EXPECT_FALSE( Regex{ "^b" }.find( "bb", 1, match ) );
+	}
+
+	TEST( Regex, PathologicalPatternsStayFast )
+	{
+		const std::string str( 20000, 'a' );
+		EXPECT_FALSE( Regex{ "(a*)*b" }.matches( str ) );
+		EXPECT_FALSE( Regex{ "(a|aa)+c" }.search( str ) );
+		EXPECT_TRUE( Regex{ "(a|a)*" }.matches( str ) );
+		EXPECT_EQ( regexReplace( str, Regex{ "a{3}" }, "" ), "aa" );
+	}
+
+	TEST( Regex, LargeStateSpaceFlushesCache )
+	{
+		// Remembering the last 12 bytes needs 4096 DFA states, more than the cache holds
+		const Regex regex{ "[ab]*a[ab]{11}" };
+		std::mt19937 rng{ 2 };
+		std::string str( 50000, 'a' );
+		for ( char& c : str )
+		{
+			c = "ab"[rng() % 2];
+		}
+		EXPECT_TRUE( regex.search( str ) );
+		EXPECT_EQ( regex.matches( str ), str[str.size() - 12] == 'a' );
+	}
+
+	TEST( Regex, AgreesWithStdRegex )
+	{
+		std::mt19937 rng{ 11 };
+		for ( std::size_t i = 0; i < 300; ++i )
+		{
+			const std::string pattern = randomPattern( rng, 0 );
+			const Regex regex{ pattern };
+			ASSERT_TRUE( regex.isValid() ) << pattern;
+			const std::regex reference{ pattern };
+
+			for ( std::size_t round = 0; round < 20; ++round )
+			{
+				std::string str( rng() % 9, ' ' );
+				for ( char& c : str )
+				{
+					c = "abc"[rng() % 3];
+				}
+				EXPECT_EQ( regex.matches( str ), std::regex_match( str, reference ) ) << pattern << " " << str;
+				EXPECT_EQ( regex.search( str ), std::regex_search( str, reference ) ) << pattern << " " << str;
+
+				// Leftmost-longest: the first start with any match, then its longest end
+				std::string_view expected;
+				bool found = false;
+				for ( std::size_t begin = 0; begin <= str.size() && !found; ++begin )
+				{
+					for ( std::size_t end = str.size() + 1; end-- > begin; )
+					{
+						if ( std::regex_match( str.begin() + static_cast<std::ptrdiff_t>( begin ),
+								 str.begin() + static_cast<std::ptrdiff_t>( end ), reference ) )
+						{
+							expected = std::string_view{ str }.substr( begin, end - begin );
+							found = true;
+							break;
+						}
+					}
+				}
+				std::string_view match;
+				ASSERT_EQ( regex.find( str, 0, match ), found ) << pattern << " " << str;
+				if ( found )
+				{
+					EXPECT_EQ( match.data(), expected.data() ) << pattern << " " << str;
+					EXPECT_EQ( match, expected ) << pattern << " " << str;
+				}
+			}
+		}
+	}
+
+	TEST( Regex, FindIteratesLargeInputs )
+	{
+		// Each find() reads around its match only, so iterating 40000 matches stays linear
+		std::mt19937 rng{ 7 };
+		std::string str;
+		std::size_t expected = 0;
+		while ( expected < 40000 )
+		{
+			str += "id=" + std::to_string( rng() % 100000 ) + ( rng() % 2 ? " ok; " : " code abcd, " );
+			++expected;
+		}
+
+		const Regex regex{ "\\d+" };
+		std::size_t found = 0;
+		std::string_view match;
+		for ( std::size_t pos = 0; regex.find( str, pos, match ); ++found )
+		{
+			pos = static_cast<std::size_t>( match.data() - str.data() ) + match.size();
+			ASSERT_EQ( match, std::string_view{ str }.substr( static_cast<std::size_t>( match.data() - str.data() ), match.size() ) );
+		}
+		EXPECT_EQ( found, expected );
+		EXPECT_EQ( found + 1, splitAll( str, regex ).size() );
+
+		// A leftmost start whose matches all end after an earlier match further right
+		ASSERT_TRUE( Regex{ "abcd|c" }.find( "xabcd", 0, match ) );
+		EXPECT_EQ( match, "abcd" );
+		ASSERT_TRUE( Regex{ "a[^x]*z|b" }.find( std::string( 1, 'a' ) + std::string( 1000, 'b' ) + "z", 0, match ) );
+		EXPECT_EQ( match.size(), 1002u );
+	}
+
+	TEST( Regex, SharedAcrossThreads )
+	{
+		// Classification rules shared by workers; the last one flushes its cache over and over
+		const std::vector<Regex> rules{ Regex{ "(ERROR|WARN) \\d+" }, Regex{ "disk /dev/sd[a-z]\\d" },
+			Regex{ "[ab]*a[ab]{11}" } };
+		std::mt19937 rng{ 5 };
+		std::vector<std::string> lines;
+		for ( std::size_t i = 0; i < 200; ++i )
+		{
+			std::string line( 200 + rng() % 400, ' ' );
+			for ( char& c : line )
+			{
+				c = "ab ERROR 42 disk /dev/sdb1"[rng() % 26];
+			}
+			lines.push_back( std::move( line ) );
+		}
+
+		const auto classify = [&]( const std::string& line ) {
+			std::string result;
+			for ( const Regex& rule : rules )
+			{
+				std::string_view match;
+				result += rule.search( line ) ? 's' : '-';
+				result += rule.matches( line ) ? 'm' : '-';
+				result += rule.find( line, 0, match ) ? std::to_string( match.data() - line.data() ) : "-";
+				result += regexReplace( line, rule, "#" );
+			}
+			return result;
+		};
+		std::vector<std::string> expected;
+		for ( const std::string& line : lines )
+		{
+			expected.push_back( classify( line ) );
+		}
+
+		constexpr int threadCount = 8;
+		std::vector<std::vector<std::string>> results( threadCount );
+		std::vector<std::thread> threads;
+		for ( int t = 0; t < threadCount; ++t )
+		{
+			threads.emplace_back( [&, t] {
+				for ( const std::string& line : lines )
+				{
+					results[t].push_back( classify( line ) );
+				}
+			} );
+		}
+		for ( std::thread& thread : threads )
+		{
+			thread.join();
+		}
+		for ( int t = 0; t < threadCount; ++t )
+		{
+			EXPECT_EQ( results[t], expected ) << "thread " << t;
+		}
+	}
+
+	TEST( Regex, CopiesMatchIndependently )
+	{
+		const Regex original{ "[a-z]+-\\d+" };
+		EXPECT_TRUE( original.matches( "build-42" ) );
+		Regex copy{ original };
+		EXPECT_TRUE( copy.matches( "deploy-7" ) );
+		copy = Regex{ "x+" };
+		EXPECT_TRUE( copy.matches( "xxx" ) );
+		EXPECT_FALSE( copy.matches( "build-42" ) );
+		EXPECT_TRUE( original.matches( "build-42" ) );
+	}
+
+	//----------------------------------------------
+	// Regular expression functions
+	//----------------------------------------------
+
+	TEST( RegexFunctions, MatchAndSearch )
+	{
+		EXPECT_TRUE( regexMatch( "ERROR 42", Regex{ "(ERROR|WARN) \\d+" } ) );
+		EXPECT_FALSE( regexMatch( "ERROR 42 extra", "(ERROR|WARN) \\d+" ) );
+		EXPECT_TRUE( regexSearch( "disk /dev/sda1 failed", Regex{ "sd[a-z]\\d" } ) );
+		EXPECT_TRUE( regexSearch( "ERROR 42 extra", "(ERROR|WARN) \\d+" ) );
+		EXPECT_FALSE( regexMatch( "(", "(" ) );
+	}
+
+	TEST( RegexFunctions, Replace )
+	{
+		EXPECT_EQ( regexReplace( "id=123 id=45", Regex{ "\\d+" }, "#" ), "id=# id=#" );
+		EXPECT_EQ( regexReplace( "a  b   c", "\\s+", " " ), "a b c" );
+		EXPECT_EQ( regexReplace( "abc", "x*", "-" ), "abc" );
+		EXPECT_EQ( regexReplace( "aaa", "a", "" ), "" );
+		EXPECT_EQ( regexReplace( "", "a", "b" ), "" );
+		EXPECT_EQ( regexReplace( "keep", "(", "x" ), "keep" );
+		EXPECT_EQ( regexReplace( "user=bob token=abc123", Regex{ "token=\\w+" }, "token=***" ), "user=bob token=***" );
+	}
+
+	TEST( RegexFunctions, Split )
+	{
+		const Regex separator{ "[,;] *" };
+		EXPECT_EQ( splitAll( "a, b;c", separator ), ( std::vector<std::string_view>{ "a", "b", "c" } ) );
+		EXPECT_EQ( splitAll( ",a,", separator ), ( std::vector<std::string_view>{ "", "a", "" } ) );
+		EXPECT_EQ( splitAll( "abc", separator ), ( std::vector<std::string_view>{ "abc" } ) );
+		EXPECT_TRUE( splitAll( "", separator ).empty() );
+		EXPECT_EQ( splitAll( "abc", Regex{ "x*" } ), ( std::vector<std::string_view>{ "abc" } ) );
+		EXPECT_EQ( splitAll( "a1b22c", Regex{ "\\d+" } ), ( std::vector<std::string_view>{ "a", "b", "c" } ) );
+
+		const std::string text = "k1=v1&k2=v2";
+		const Regex pairs{ "[=&]" };
+		for ( std::string_view piece : regexSplit( text, pairs ) )
+		{
+			EXPECT_GE( piece.data(), text.data() );
+			EXPECT_LE( piece.data() + piece.size(), text.data() + text.size() );
+		}
+
+		const Regex space{ " " };
+		RegexSplitter splitter = regexSplit( "x y", space );
+		auto it = splitter.begin();
+		EXPECT_EQ( *it++, "x" );
+		EXPECT_EQ( *it, "y" );
+		EXPECT_EQ( ++it, splitter.end() );
+
+		// The pattern overload and a temporary Regex keep their expression alive
+		RegexSplitter owning = regexSplit( "a1b22c", "\\d+" );
+		EXPECT_EQ( std::vector<std::string_view>( owning.begin(), owning.end() ), ( std::vector<std::string_view>{ "a", "b", "c" } ) );
+		const RegexSplitter copy = owning;
+		owning = regexSplit( "x", "y" );
+		EXPECT_EQ( std::vector<std::string_view>( copy.begin(), copy.end() ), ( std::vector<std::string_view>{ "a", "b", "c" } ) );
+		const RegexSplitter temporary{ "k=v", Regex{ "=" } };
+		EXPECT_EQ( std::vector<std::string_view>( temporary.begin(), temporary.end() ), ( std::vector<std::string_view>{ "k", "v" } ) );
+		EXPECT_EQ( splitAll( "abc", Regex{ "(" } ), ( std::vector<std::string_view>{ "abc" } ) );
+	}
+} // namespace nfx::string::test
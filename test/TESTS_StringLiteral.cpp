@@ -0,0 +1,148 @@
+/**
+ * @file TESTS_StringLiteral.cpp
+ * @brief Tests for StringLiteral template arguments and literal pattern operations
+ * @details Tests covering constant evaluation, agreement with the runtime-pattern functions on
+ *          random text for every pattern length class, and matches at vector block boundaries
+ */
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include <nfx/string/StringLiteral.h>
+#include <nfx/string/Utils.h>
+
+namespace nfx::string::test
+{
+	//=====================================================================
+	// StringLiteral tests
+	//=====================================================================
+
+	//----------------------------------------------
+	// Helpers
+	//----------------------------------------------
+
+	/** @brief Checks every literal operation against its runtime-pattern equivalent */
+	template <StringLiteral Needle>
+	void expectMatchesRuntime( std::string_view text )
+	{
+		const std::string_view needle = Needle.view();
+		ASSERT_EQ( indexOfLit<Needle>( text ), indexOf( text, needle ) ) << "needle: " << needle << " text: " << text;
+		ASSERT_EQ( containsLit<Needle>( text ), contains( text, needle ) );
+		ASSERT_EQ( countLit<Needle>( text ), count( text, needle ) );
+		ASSERT_EQ( startsWithLit<Needle>( text ), startsWith( text, needle ) );
+		ASSERT_EQ( endsWithLit<Needle>( text ), endsWith( text, needle ) );
+		ASSERT_EQ( ( replaceAllLit<Needle, "<>">( text ) ), replaceAll( text, needle, "<>" ) );
+	}
+
+	/** @brief Random text over a small alphabet so that partial matches are frequent */
+	std::string randomText( std::mt19937& rng, std::size_t size )
+	{
+		static constexpr std::string_view alphabet = "abcab";
+		std::string text( size, ' ' );
+		for ( char& c : text )
+		{
+			c = alphabet[rng() % alphabet.size()];
+		}
+		return text;
+	}
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	TEST( StringLiteralConstruction, StructuralTemplateArgument )
+	{
+		constexpr StringLiteral literal{ "needle" };
+		static_assert( literal.size() == 6 );
+		static_assert( literal.view() == "needle" );
+
+		static_assert( containsLit<"ERROR">( "[ERROR] disk full" ) );
+		static_assert( !containsLit<"WARN">( "[ERROR] disk full" ) );
+		static_assert( startsWithLit<"[ERROR]">( "[ERROR] disk full" ) );
+		static_assert( endsWithLit<"full">( "[ERROR] disk full" ) );
+		static_assert( indexOfLit<"disk">( "[ERROR] disk full" ) == 8 );
+		static_assert( countLit<"ab">( "abababa" ) == 3 );
+		static_assert( countLit<"">( "abc" ) == 0 );
+
+		EXPECT_EQ( ( replaceAllLit<"\r\n", "\n">( "a\r\nb\r\n" ) ), "a\nb\n" );
+		EXPECT_EQ( ( replaceAllLit<"", "x">( "abc" ) ), "abc" );
+	}
+
+	//----------------------------------------------
+	// Search
+	//----------------------------------------------
+
+	TEST( StringLiteralSearch, MatchesRuntimePatterns )
+	{
+		std::mt19937 rng{ 7 };
+		for ( std::size_t size = 0; size < 160; ++size )
+		{
+			for ( int round = 0; round < 8; ++round )
+			{
+				const std::string text = randomText( rng, size );
+				expectMatchesRuntime<"">( text );
+				expectMatchesRuntime<"c">( text );
+				expectMatchesRuntime<"ca">( text );
+				expectMatchesRuntime<"abc">( text );
+				expectMatchesRuntime<"cabca">( text );
+				expectMatchesRuntime<"abcabcab">( text );
+				expectMatchesRuntime<"aabbccaabbccaabbcc">( text );
+			}
+		}
+	}
+
+	TEST( StringLiteralSearch, MatchesAtBlockBoundaries )
+	{
+		for ( std::size_t size = 1; size <= 100; ++size )
+		{
+			for ( std::size_t pos = 0; pos + 5 <= size; ++pos )
+			{
+				std::string text( size, '.' );
+				text.replace( pos, 5, "x\0y-z", 5 );
+				EXPECT_EQ( indexOfLit<"x\0y-z">( text ), pos );
+				EXPECT_EQ( indexOfLit<"x\0y-">( text ), pos );
+				EXPECT_EQ( indexOfLit<"-z">( text ), pos + 3 );
+				EXPECT_EQ( indexOfLit<"z">( text ), pos + 4 );
+				EXPECT_EQ( indexOfLit<"y-zz">( text ), std::string_view::npos );
+			}
+		}
+	}
+
+	TEST( StringLiteralSearch, LongPattern )
+	{
+		std::string text( 1000, 'a' );
+		std::string needle( 300, 'a' );
+		needle.back() = 'b';
+		text.replace( 600, needle.size(), needle );
+
+		constexpr auto literal = [] {
+			char value[301]{};
+			for ( int i = 0; i < 299; ++i )
+			{
+				value[i] = 'a';
+			}
+			value[299] = 'b';
+			return StringLiteral<301>{ value };
+		}();
+		EXPECT_EQ( indexOfLit<literal>( text ), 600u );
+		EXPECT_EQ( countLit<literal>( text ), 1u );
+	}
+
+	TEST( StringLiteralSearch, CallbackExceptionsPropagate )
+	{
+		// replaceAllLit appends from the match callback; its std::bad_alloc must not terminate
+		const auto noThrow = []( std::size_t ) noexcept { return false; };
+		const auto mayThrow = []( std::size_t ) -> bool { throw std::runtime_error{ "match" }; };
+		static_assert( noexcept( detail::LiteralSearcher<"ab">::forEachMatch( "", 0, noThrow ) ) );
+		static_assert( !noexcept( detail::LiteralSearcher<"ab">::forEachMatch( "", 0, mayThrow ) ) );
+
+		const std::string text = std::string( 100, 'x' ) + "ab";
+		EXPECT_THROW( detail::LiteralSearcher<"ab">::forEachMatch( text, 0, mayThrow ), std::runtime_error );
+		EXPECT_THROW( detail::LiteralSearcher<"a">::forEachMatch( text, 0, mayThrow ), std::runtime_error );
+		EXPECT_THROW( detail::LiteralSearcher<"xab">::forEachMatch( "xab", 0, mayThrow ), std::runtime_error );
+	}
+} // namespace nfx::string::test
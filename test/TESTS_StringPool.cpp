@@ -0,0 +1,168 @@
+/**
+ * @file TESTS_StringPool.cpp
+ * @brief Tests for StringPool string interning
+ * @details Tests covering handle identity, view stability across table growth and arena
+ *          blocks, embedded null bytes, lock-free lookup, and concurrent interning
+ */
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+
+#include <nfx/string/StringPool.h>
+
+namespace nfx::string::test
+{
+	//=====================================================================
+	// StringPool tests
+	//=====================================================================
+
+	//----------------------------------------------
+	// Interning
+	//----------------------------------------------
+
+	TEST( StringPoolInterning, SameStringSameHandle )
+	{
+		StringPool pool;
+		const std::string host = "api.example.com";
+
+		const InternedString a = pool.intern( host );
+		const InternedString b = pool.intern( std::string_view{ "api.example.com" } );
+		const InternedString c = pool.intern( "www.example.com" );
+
+		EXPECT_EQ( a, b );
+		EXPECT_NE( a, c );
+		EXPECT_EQ( a.view().data(), b.view().data() );
+		EXPECT_NE( a.view().data(), host.data() );
+		EXPECT_EQ( a.view(), "api.example.com" );
+		EXPECT_EQ( a.size(), 15u );
+		EXPECT_STREQ( c.c_str(), "www.example.com" );
+		EXPECT_EQ( a.hash(), b.hash() );
+		EXPECT_EQ( pool.size(), 2u );
+
+		static_assert( std::is_trivially_copyable_v<InternedString> );
+		static_assert( sizeof( InternedString ) == sizeof( void* ) );
+	}
+
+	TEST( StringPoolInterning, EmptyAndBinaryStrings )
+	{
+		StringPool pool;
+
+		const InternedString empty = pool.intern( "" );
+		EXPECT_EQ( empty, InternedString{} );
+		EXPECT_TRUE( empty.empty() );
+		EXPECT_STREQ( empty.c_str(), "" );
+		EXPECT_EQ( pool.size(), 0u );
+
+		const std::string withNull{ "a\0b", 3 };
+		const InternedString binary = pool.intern( withNull );
+		EXPECT_EQ( binary.size(), 3u );
+		EXPECT_EQ( binary.view(), withNull );
+		EXPECT_NE( binary, pool.intern( "a" ) );
+	}
+
+	TEST( StringPoolInterning, ViewsStayValidWhilePoolGrows )
+	{
+		StringPool pool;
+		std::vector<InternedString> handles;
+		std::vector<std::string_view> views;
+		for ( int i = 0; i < 20000; ++i )
+		{
+			handles.push_back( pool.intern( "field_" + std::to_string( i ) ) );
+			views.push_back( handles.back().view() );
+		}
+
+		// Strings longer than a quarter block get their own allocation
+		const std::string large( 100000, 'x' );
+		const InternedString largeHandle = pool.intern( large );
+		EXPECT_EQ( largeHandle.view(), large );
+		EXPECT_EQ( pool.intern( large ), largeHandle );
+
+		EXPECT_EQ( pool.size(), 20001u );
+		for ( int i = 0; i < 20000; ++i )
+		{
+			const std::string expected = "field_" + std::to_string( i );
+			ASSERT_EQ( views[i], expected );
+			ASSERT_EQ( pool.intern( expected ), handles[i] );
+		}
+	}
+
+	//----------------------------------------------
+	// Lookup
+	//----------------------------------------------
+
+	TEST( StringPoolLookup, TryFindDoesNotInsert )
+	{
+		StringPool pool;
+		InternedString found;
+
+		EXPECT_FALSE( pool.tryFind( "GET", found ) );
+		EXPECT_EQ( pool.size(), 0u );
+
+		const InternedString get = pool.intern( "GET" );
+		EXPECT_TRUE( pool.tryFind( "GET", found ) );
+		EXPECT_EQ( found, get );
+		EXPECT_FALSE( pool.tryFind( "POST", found ) );
+		EXPECT_TRUE( pool.tryFind( "", found ) );
+		EXPECT_TRUE( found.empty() );
+	}
+
+	TEST( StringPoolLookup, StdHash )
+	{
+		StringPool pool;
+		std::unordered_set<InternedString> set;
+		set.insert( pool.intern( "GET" ) );
+		set.insert( pool.intern( "POST" ) );
+		set.insert( pool.intern( "GET" ) );
+
+		EXPECT_EQ( set.size(), 2u );
+		EXPECT_TRUE( set.contains( pool.intern( "POST" ) ) );
+		EXPECT_EQ( std::hash<InternedString>{}( pool.intern( "GET" ) ), pool.intern( "GET" ).hash() );
+	}
+
+	//----------------------------------------------
+	// Concurrency
+	//----------------------------------------------
+
+	TEST( StringPoolConcurrency, ThreadsAgreeOnHandles )
+	{
+		constexpr int threadCount = 8;
+		constexpr int stringCount = 5000;
+
+		StringPool pool;
+		std::vector<std::vector<InternedString>> results( threadCount );
+		std::vector<std::thread> threads;
+		for ( int t = 0; t < threadCount; ++t )
+		{
+			threads.emplace_back( [&pool, &results, t] {
+				// Each thread walks the keys in a different order
+				for ( int i = 0; i < stringCount; ++i )
+				{
+					const int key = ( i * ( 2 * t + 1 ) ) % stringCount;
+					results[t].push_back( pool.intern( "host-" + std::to_string( key ) + ".example.com" ) );
+				}
+			} );
+		}
+		for ( std::thread& thread : threads )
+		{
+			thread.join();
+		}
+
+		EXPECT_EQ( pool.size(), static_cast<std::size_t>( stringCount ) );
+		for ( int t = 0; t < threadCount; ++t )
+		{
+			for ( int i = 0; i < stringCount; ++i )
+			{
+				const int key = ( i * ( 2 * t + 1 ) ) % stringCount;
+				InternedString expected;
+				ASSERT_TRUE( pool.tryFind( "host-" + std::to_string( key ) + ".example.com", expected ) );
+				ASSERT_EQ( results[t][i], expected ) << "thread " << t << ", key " << key;
+			}
+		}
+	}
+} // namespace nfx::string::test
@@ -16,6 +16,8 @@
 #include <nfx/string/Splitter.h>
 #include <nfx/string/Utils.h>
 
+#include "AllocationCounter.h"
+
 namespace nfx::string::test
 {
 	//=====================================================================
@@ -713,4 +715,31 @@ namespace nfx::string::test
 		EXPECT_EQ( firstSegment.data(), original.data() );
 		EXPECT_EQ( firstSegment, "hello" );
 	}
+
+	//----------------------------------------------
+	// Allocation guarantees
+	//----------------------------------------------
+
+	TEST( SplitterAllocations, IterationDoesNotAllocate )
+	{
+		const std::string data{ "John,Doe,30,Engineer,NewYork,75000,Active,2023-01-15,EU,remote,full-time" };
+		std::size_t fields = 0;
+		std::size_t bytes = 0;
+
+		EXPECT_NO_ALLOC( {
+			for ( const auto segment : Splitter{ data, ',' } )
+			{
+				++fields;
+				bytes += segment.size();
+			}
+		} );
+		EXPECT_EQ( fields, 11 );
+
+		EXPECT_NO_ALLOC( {
+			auto splitter = splitView( std::string_view{ data }, ',' );
+			fields = static_cast<std::size_t>( std::distance( splitter.begin(), splitter.end() ) );
+		} );
+		EXPECT_EQ( fields, 11 );
+		EXPECT_EQ( bytes, data.size() - 10 );
+	}
 } // namespace nfx::string::test
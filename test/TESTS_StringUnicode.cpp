@@ -0,0 +1,503 @@
+/**
+ * @file TESTS_StringUnicode.cpp
+ * @brief Tests for Unicode case mapping, comparison, normalization and display width
+ * @details Tests covering codepoint mappings from the generated tables, length-changing
+ *          mappings, ill-formed input pass-through, SIMD ASCII runs compared against a
+ *          codepoint-at-a-time reference, normalization in one shot, in place and streamed, and
+ *          grapheme-aware display width, padding and truncation
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <nfx/string/Unicode.h>
+#include <nfx/string/Utils.h>
+
+namespace nfx::string::test
+{
+	//=====================================================================
+	// Unicode tests
+	//=====================================================================
+
+	//----------------------------------------------
+	// Reference implementation
+	//----------------------------------------------
+
+	/** @brief Codepoint-at-a-time case folding of valid UTF-8 */
+	static std::string referenceCaseFold( std::string_view str )
+	{
+		std::u32string codepoints;
+		EXPECT_TRUE( tryUtf8ToUtf32( str, codepoints ) );
+		for ( char32_t& cp : codepoints )
+		{
+			cp = caseFoldCodepoint( cp );
+		}
+		std::string result;
+		EXPECT_TRUE( tryUtf32ToUtf8( codepoints, result ) );
+		return result;
+	}
+
+	/** @brief Mixed-case text with ASCII runs and Latin, Greek, Cyrillic and Deseret letters */
+	static std::string randomMixedCase( std::mt19937& rng, std::size_t words )
+	{
+		static constexpr std::string_view pieces[]{
+			"Hello ", "WORLD ", "MiXeD ", "caf\xC3\x89 ", "\xCE\xA3\xCE\xB1\xCF\x82 ", "\xD0\x9C\xD0\xB8\xD1\x80 ",
+			"\xF0\x90\x90\x80 ", "\xE2\x84\xAA" "elvin ", "The quick brown fox jumps over ", "\xE4\xB8\xAD\xE6\x96\x87 " };
+
+		std::string result;
+		for ( std::size_t i = 0; i < words; ++i )
+		{
+			result += pieces[rng() % std::size( pieces )];
+		}
+		return result;
+	}
+
+	//----------------------------------------------
+	// Codepoint case mapping
+	//----------------------------------------------
+
+	TEST( UnicodeCaseMapping, CodepointFolding )
+	{
+		EXPECT_EQ( caseFoldCodepoint( U'A' ), U'a' );
+		EXPECT_EQ( caseFoldCodepoint( U'a' ), U'a' );
+		EXPECT_EQ( caseFoldCodepoint( U'1' ), U'1' );
+		EXPECT_EQ( caseFoldCodepoint( 0x00C9 ), 0x00E9u );	 // É -> é
+		EXPECT_EQ( caseFoldCodepoint( 0x212A ), U'k' );		 // KELVIN SIGN
+		EXPECT_EQ( caseFoldCodepoint( 0x017F ), U's' );		 // LATIN SMALL LETTER LONG S
+		EXPECT_EQ( caseFoldCodepoint( 0x03A3 ), 0x03C3u );	 // Σ -> σ
+		EXPECT_EQ( caseFoldCodepoint( 0x03C2 ), 0x03C3u );	 // final ς -> σ
+		EXPECT_EQ( caseFoldCodepoint( 0x1E9E ), 0x00DFu );	 // CAPITAL SHARP S (status S)
+		EXPECT_EQ( caseFoldCodepoint( 0x00DF ), 0x00DFu );	 // full folding only
+		EXPECT_EQ( caseFoldCodepoint( 0x0130 ), 0x0130u );	 // Turkic mapping is not applied
+		EXPECT_EQ( caseFoldCodepoint( 0xAB70 ), 0x13A0u );	 // Cherokee folds to uppercase
+		EXPECT_EQ( caseFoldCodepoint( 0x10400 ), 0x10428u ); // Deseret
+		EXPECT_EQ( caseFoldCodepoint( 0x1E900 ), 0x1E922u ); // Adlam, last cased block
+		EXPECT_EQ( caseFoldCodepoint( 0x4E2D ), 0x4E2Du );	 // uncased
+		EXPECT_EQ( caseFoldCodepoint( 0x10FFFF ), 0x10FFFFu );
+
+		static_assert( caseFoldCodepoint( U'Q' ) == U'q' );
+	}
+
+	TEST( UnicodeCaseMapping, CodepointLowerUpper )
+	{
+		EXPECT_EQ( toLowerCodepoint( U'Z' ), U'z' );
+		EXPECT_EQ( toUpperCodepoint( U'z' ), U'Z' );
+		EXPECT_EQ( toLowerCodepoint( 0x0130 ), U'i' );		// İ -> i
+		EXPECT_EQ( toUpperCodepoint( 0x0131 ), U'I' );		// ı -> I
+		EXPECT_EQ( toUpperCodepoint( 0x00FF ), 0x0178u );	// ÿ -> Ÿ
+		EXPECT_EQ( toUpperCodepoint( 0x00DF ), 0x00DFu );	// no single-codepoint uppercase
+		EXPECT_EQ( toLowerCodepoint( 0x212A ), U'k' );		// KELVIN SIGN
+		EXPECT_EQ( toUpperCodepoint( 0x01C5 ), 0x01C4u );	// titlecase Dž -> DŽ
+		EXPECT_EQ( toLowerCodepoint( 0x01C5 ), 0x01C6u );	// titlecase Dž -> dž
+		EXPECT_EQ( toLowerCodepoint( 0x10400 ), 0x10428u ); // Deseret
+	}
+
+	//----------------------------------------------
+	// String case mapping
+	//----------------------------------------------
+
+	TEST( UnicodeCaseMapping, StringMapping )
+	{
+		EXPECT_EQ( utf8CaseFold( "" ), "" );
+		EXPECT_EQ( utf8CaseFold( "Hello World" ), "hello world" );
+		EXPECT_EQ( utf8ToLower( "\xC3\x89" "COLE" ), "\xC3\xA9" "cole" );
+		EXPECT_EQ( utf8ToUpper( "na\xC3\xAFve" ), "NA\xC3\x8FVE" );
+		EXPECT_EQ( utf8ToUpper( "stra\xC3\x9F" "e" ), "STRA\xC3\x9F" "E" );
+		EXPECT_EQ( utf8CaseFold( "\xCE\xA3\xCE\xB1\xCF\x82" ), "\xCF\x83\xCE\xB1\xCF\x83" ); // Σας -> σασ
+	}
+
+	TEST( UnicodeCaseMapping, LengthChangingMappings )
+	{
+		EXPECT_EQ( utf8CaseFold( "\xE2\x84\xAA" ), "k" );				  // 3 bytes -> 1
+		EXPECT_EQ( utf8ToUpper( "\xC4\xB1" ), "I" );					  // 2 bytes -> 1
+		EXPECT_EQ( utf8ToLower( "\xC8\xBA" ), "\xE2\xB1\xA5" );			  // U+023A -> U+2C65, 2 bytes -> 3
+
+		// Growth in the middle of long ASCII runs
+		std::string input;
+		std::string expected;
+		for ( int i = 0; i < 50; ++i )
+		{
+			input += "ABCDEFGHIJKLMNOPQRSTU\xC8\xBA";
+			expected += "abcdefghijklmnopqrstu\xE2\xB1\xA5";
+		}
+		EXPECT_EQ( utf8ToLower( input ), expected );
+	}
+
+	TEST( UnicodeCaseMapping, IllFormedBytesPassThrough )
+	{
+		EXPECT_EQ( utf8ToLower( "A\xFF" "B" ), "a\xFF" "b" );
+		EXPECT_EQ( utf8ToUpper( "a\xC3" ), "A\xC3" );						  // truncated
+		EXPECT_EQ( utf8CaseFold( "\xED\xA0\x80Z" ), "\xED\xA0\x80z" );	  // surrogate
+		EXPECT_EQ( utf8CaseFold( "\xC0\x81Q" ), "\xC0\x81q" );			  // overlong
+		EXPECT_EQ( utf8CaseFold( std::string( 20, 'X' ) + "\x80" ), std::string( 20, 'x' ) + "\x80" );
+	}
+
+	TEST( UnicodeCaseMapping, AsciiMatchesByteFunctions )
+	{
+		std::string ascii;
+		for ( int i = 0; i < 1000; ++i )
+		{
+			ascii += static_cast<char>( i % 128 );
+		}
+		EXPECT_EQ( utf8ToLower( ascii ), toLower( ascii ) );
+		EXPECT_EQ( utf8ToUpper( ascii ), toUpper( ascii ) );
+		EXPECT_EQ( utf8CaseFold( ascii ), toLower( ascii ) );
+	}
+
+	TEST( UnicodeCaseMapping, RandomTextMatchesReference )
+	{
+		std::mt19937 rng{ 7 };
+		for ( int iteration = 0; iteration < 200; ++iteration )
+		{
+			const std::string text = randomMixedCase( rng, rng() % 40 );
+			EXPECT_EQ( utf8CaseFold( text ), referenceCaseFold( text ) ) << "iteration " << iteration;
+		}
+	}
+
+	//----------------------------------------------
+	// Case-insensitive comparison
+	//----------------------------------------------
+
+	TEST( UnicodeCaseInsensitiveComparison, Equality )
+	{
+		EXPECT_TRUE( iequalsUtf8( "", "" ) );
+		EXPECT_TRUE( iequalsUtf8( "HELLO", "hello" ) );
+		EXPECT_TRUE( iequalsUtf8( "\xC3\x89t\xC3\xA9", "\xC3\xA9T\xC3\x89" ) );						  // Été / éTÉ
+		EXPECT_TRUE( iequalsUtf8( "\xCE\xA3\xCE\x91\xCE\xA3", "\xCF\x83\xCE\xB1\xCF\x82" ) );			  // ΣΑΣ / σας
+		EXPECT_TRUE( iequalsUtf8( "\xE2\x84\xAA", "k" ) );												  // different byte lengths
+		EXPECT_TRUE( iequalsUtf8( "\xD0\x9C\xD0\x98\xD0\xA0", "\xD0\xBC\xD0\xB8\xD1\x80" ) );			  // МИР / мир
+		EXPECT_FALSE( iequalsUtf8( "stra\xC3\x9F" "e", "STRASSE" ) );									  // simple folding only
+		EXPECT_FALSE( iequalsUtf8( "abc", "abd" ) );
+		EXPECT_FALSE( iequalsUtf8( "abc", "abcd" ) );
+		EXPECT_FALSE( iequalsUtf8( "a\xFF", "a\xFE" ) );
+		EXPECT_TRUE( iequalsUtf8( "A\xFF", "a\xFF" ) );
+	}
+
+	TEST( UnicodeCaseInsensitiveComparison, Ordering )
+	{
+		EXPECT_EQ( icompareUtf8( "a", "A" ), 0 );
+		EXPECT_LT( icompareUtf8( "apple", "Banana" ), 0 );
+		EXPECT_GT( icompareUtf8( "Cherry", "banana" ), 0 );
+		EXPECT_LT( icompareUtf8( "abc", "ABCD" ), 0 );
+		EXPECT_GT( icompareUtf8( "ABCD", "abc" ), 0 );
+		EXPECT_LT( icompareUtf8( "z", "\xC3\xA9" ), 0 ); // codepoint order, not collation
+	}
+
+	TEST( UnicodeCaseInsensitiveComparison, LongStrings )
+	{
+		const std::string lower( 100, 'q' );
+		std::string upper( 100, 'Q' );
+		EXPECT_TRUE( iequalsUtf8( lower, upper ) );
+
+		for ( std::size_t at : { 0u, 15u, 16u, 17u, 63u, 99u } )
+		{
+			std::string changed = upper;
+			changed[at] = 'R';
+			EXPECT_FALSE( iequalsUtf8( lower, changed ) ) << at;
+			EXPECT_LT( icompareUtf8( lower, changed ), 0 ) << at;
+		}
+
+		// Non-ASCII codepoints at different byte offsets on each side
+		EXPECT_TRUE( iequalsUtf8( std::string( 30, 'a' ) + "\xE2\x84\xAA" + std::string( 30, 'b' ),
+			std::string( 30, 'A' ) + "K" + std::string( 30, 'B' ) ) );
+	}
+
+	TEST( UnicodeCaseInsensitiveComparison, RandomTextMatchesFolding )
+	{
+		std::mt19937 rng{ 11 };
+		for ( int iteration = 0; iteration < 200; ++iteration )
+		{
+			const std::string a = randomMixedCase( rng, rng() % 20 );
+			const std::string b = rng() % 2 ? utf8ToUpper( a ) : randomMixedCase( rng, rng() % 20 );
+
+			const std::string foldedA = utf8CaseFold( a );
+			const std::string foldedB = utf8CaseFold( b );
+			const int expected = foldedA < foldedB ? -1 : foldedA == foldedB ? 0
+																			  : 1;
+			const int actual = icompareUtf8( a, b );
+			EXPECT_EQ( ( actual > 0 ) - ( actual < 0 ), expected ) << "iteration " << iteration;
+			EXPECT_EQ( iequalsUtf8( a, b ), expected == 0 );
+		}
+	}
+
+	//----------------------------------------------
+	// Normalization
+	//----------------------------------------------
+
+	TEST( UnicodeNormalization, ComposeAndDecompose )
+	{
+		const std::string composed = "caf\xC3\xA9";	 // café
+		const std::string decomposed = "cafe\xCC\x81"; // e + COMBINING ACUTE ACCENT
+
+		EXPECT_EQ( utf8Normalize( decomposed ), composed );
+		EXPECT_EQ( utf8Normalize( composed ), composed );
+		EXPECT_EQ( utf8Normalize( composed, NormalizationForm::NFD ), decomposed );
+		EXPECT_EQ( utf8Normalize( decomposed, NormalizationForm::NFD ), decomposed );
+
+		// Multi-level decomposition: ǖ (U+01D6) -> u + diaeresis + macron
+		EXPECT_EQ( utf8Normalize( "\xC7\x96", NormalizationForm::NFD ), "u\xCC\x88\xCC\x84" );
+		EXPECT_EQ( utf8Normalize( "u\xCC\x88\xCC\x84" ), "\xC7\x96" );
+
+		// Singletons and composition exclusions never come back
+		EXPECT_EQ( utf8Normalize( "\xE2\x84\xAB" ), "\xC3\x85" );						 // ANGSTROM SIGN -> Å
+		EXPECT_EQ( utf8Normalize( "\xE0\xA5\x98" ), "\xE0\xA4\x95\xE0\xA4\xBC" ); // U+0958 is excluded
+
+		// Supplementary plane
+		EXPECT_EQ( utf8Normalize( "\xF0\x91\x82\x99\xF0\x91\x82\xBA" ), "\xF0\x91\x82\x9A" ); // Kaithi U+1109A
+
+		EXPECT_EQ( utf8Normalize( "" ), "" );
+		EXPECT_EQ( utf8Normalize( "plain ASCII text" ), "plain ASCII text" );
+	}
+
+	TEST( UnicodeNormalization, CanonicalOrdering )
+	{
+		// q + dot below (ccc 220) + dot above (ccc 230) in either order
+		const std::string ordered = "q\xCC\xA3\xCC\x87";
+		const std::string reversed = "q\xCC\x87\xCC\xA3";
+		EXPECT_EQ( utf8Normalize( reversed, NormalizationForm::NFD ), ordered );
+		EXPECT_EQ( utf8Normalize( reversed ), ordered );
+
+		// a + dot below composes first, then the blocked-free circumflex: ậ (U+1EAD)
+		EXPECT_EQ( utf8Normalize( "a\xCC\x82\xCC\xA3" ), "\xE1\xBA\xAD" );
+
+		// Two marks of the same class: only the first may compose
+		EXPECT_EQ( utf8Normalize( "a\xCC\x81\xCC\x81" ), "\xC3\xA1\xCC\x81" );
+
+		// A leading combining mark has no starter to attach to
+		EXPECT_EQ( utf8Normalize( "\xCC\x81" "a" ), "\xCC\x81" "a" );
+	}
+
+	TEST( UnicodeNormalization, Hangul )
+	{
+		const std::string syllable = "\xEA\xB0\x81";				   // 각 U+AC01
+		const std::string jamo = "\xE1\x84\x80\xE1\x85\xA1\xE1\x86\xA8"; // L + V + T
+
+		EXPECT_EQ( utf8Normalize( syllable, NormalizationForm::NFD ), jamo );
+		EXPECT_EQ( utf8Normalize( jamo ), syllable );
+
+		// LV syllable followed by a trailing consonant composes to LVT
+		EXPECT_EQ( utf8Normalize( "\xEA\xB0\x80\xE1\x86\xA8" ), syllable );
+
+		// An LVT syllable takes no further trailing consonant
+		EXPECT_EQ( utf8Normalize( syllable + "\xE1\x86\xA8" ), syllable + "\xE1\x86\xA8" );
+	}
+
+	TEST( UnicodeNormalization, CompatibilityForms )
+	{
+		EXPECT_EQ( utf8Normalize( "\xEF\xAC\x81", NormalizationForm::NFKC ), "fi" );		   // LATIN SMALL LIGATURE FI
+		EXPECT_EQ( utf8Normalize( "\xEF\xAC\x81", NormalizationForm::NFC ), "\xEF\xAC\x81" ); // canonical forms keep it
+		EXPECT_EQ( utf8Normalize( "x\xC2\xB2", NormalizationForm::NFKD ), "x2" );			   // SUPERSCRIPT TWO
+		EXPECT_EQ( utf8Normalize( "\xEF\xBC\xA1\xEF\xBD\x82", NormalizationForm::NFKC ), "Ab" );	   // fullwidth
+		EXPECT_EQ( utf8Normalize( "\xE2\x84\xAB", NormalizationForm::NFKD ), "A\xCC\x8A" );
+
+		// Compatibility decompositions that contain composable sequences: U+1E9B -> ṡ
+		EXPECT_EQ( utf8Normalize( "\xE1\xBA\x9B\xCC\xA3", NormalizationForm::NFKC ), "\xE1\xB9\xA9" );
+		EXPECT_EQ( utf8Normalize( "\xE1\xBA\x9B\xCC\xA3", NormalizationForm::NFC ), "\xE1\xBA\x9B\xCC\xA3" );
+
+		// Halfwidth katakana with voiced mark composes under NFKC
+		EXPECT_EQ( utf8Normalize( "\xEF\xBD\xB6\xEF\xBE\x9E", NormalizationForm::NFKC ), "\xE3\x82\xAC" );
+	}
+
+	TEST( UnicodeNormalization, QuickCheck )
+	{
+		EXPECT_EQ( utf8QuickCheck( "ASCII only" ), NormalizationCheck::Yes );
+		EXPECT_EQ( utf8QuickCheck( "caf\xC3\xA9" ), NormalizationCheck::Yes );
+		EXPECT_EQ( utf8QuickCheck( "caf\xC3\xA9", NormalizationForm::NFD ), NormalizationCheck::No );
+		EXPECT_EQ( utf8QuickCheck( "cafe\xCC\x81" ), NormalizationCheck::Maybe );
+		EXPECT_EQ( utf8QuickCheck( "cafe\xCC\x81", NormalizationForm::NFD ), NormalizationCheck::Yes );
+		EXPECT_EQ( utf8QuickCheck( "\xE2\x84\xAB" ), NormalizationCheck::No );
+		EXPECT_EQ( utf8QuickCheck( "q\xCC\x87\xCC\xA3", NormalizationForm::NFD ), NormalizationCheck::No );
+		EXPECT_EQ( utf8QuickCheck( "\xEF\xAC\x81", NormalizationForm::NFKC ), NormalizationCheck::No );
+
+		EXPECT_TRUE( utf8IsNormalized( "caf\xC3\xA9" ) );
+		EXPECT_FALSE( utf8IsNormalized( "cafe\xCC\x81" ) );
+		EXPECT_TRUE( utf8IsNormalized( "\xCC\x81" ) ); // Maybe, but nothing to compose with
+		EXPECT_TRUE( utf8IsNormalized( "cafe\xCC\x81", NormalizationForm::NFD ) );
+	}
+
+	TEST( UnicodeNormalization, InPlace )
+	{
+		std::string str = "Na\xC3\xAFve caf\xC3\xA9";
+		const char* const data = str.data();
+		EXPECT_FALSE( utf8NormalizeInPlace( str ) );
+		EXPECT_EQ( str.data(), data );
+		EXPECT_EQ( str, "Na\xC3\xAFve caf\xC3\xA9" );
+
+		// Maybe that turns out to be normalized
+		str = "\xCC\x81";
+		EXPECT_FALSE( utf8NormalizeInPlace( str ) );
+
+		str = "Nai\xCC\x88ve";
+		EXPECT_TRUE( utf8NormalizeInPlace( str ) );
+		EXPECT_EQ( str, "Na\xC3\xAFve" );
+		EXPECT_TRUE( utf8NormalizeInPlace( str, NormalizationForm::NFD ) );
+		EXPECT_EQ( str, "Nai\xCC\x88ve" );
+	}
+
+	TEST( UnicodeNormalization, IllFormedPassThrough )
+	{
+		// Stray bytes act as starters and are copied unchanged
+		EXPECT_EQ( utf8Normalize( "e\xFF\xCC\x81" ), "e\xFF\xCC\x81" );
+		EXPECT_EQ( utf8Normalize( "\xC3\xA9\x80", NormalizationForm::NFD ), "e\xCC\x81\x80" );
+		EXPECT_EQ( utf8Normalize( "e\xCC\x81\xE2\x82" ), "\xC3\xA9\xE2\x82" );
+	}
+
+	TEST( UnicodeNormalization, StreamingMatchesOneShot )
+	{
+		static constexpr std::string_view pieces[]{
+			"plain ", "caf\xC3\xA9 ", "cafe\xCC\x81 ", "q\xCC\x87\xCC\xA3", "\xEA\xB0\x81", "\xE1\x84\x80\xE1\x85\xA1",
+			"\xE1\x86\xA8", "\xEF\xAC\x81", "\xCC\x81\xCC\xA3", "\xE2\x84\xAB", "\xF0\x9F\x98\x80", "\xFF" };
+
+		std::mt19937 rng{ 5 };
+		for ( const NormalizationForm form : { NormalizationForm::NFC, NormalizationForm::NFD, NormalizationForm::NFKC, NormalizationForm::NFKD } )
+		{
+			for ( int iteration = 0; iteration < 50; ++iteration )
+			{
+				std::string input;
+				for ( std::size_t i = rng() % 200; i > 0; --i )
+				{
+					input += pieces[rng() % std::size( pieces )];
+				}
+				const std::string expected = utf8Normalize( input, form );
+
+				Utf8Normalizer normalizer{ form };
+				std::string streamed;
+				for ( std::size_t pos = 0; pos < input.size(); )
+				{
+					const std::size_t chunk = std::min<std::size_t>( rng() % 8, input.size() - pos );
+					normalizer.append( std::string_view{ input }.substr( pos, chunk ), streamed );
+					pos += chunk;
+				}
+				normalizer.finish( streamed );
+				EXPECT_EQ( streamed, expected ) << "iteration " << iteration;
+
+				// Reusable after finish()
+				std::string again;
+				normalizer.append( input, again );
+				normalizer.finish( again );
+				EXPECT_EQ( again, expected );
+			}
+		}
+	}
+
+	//----------------------------------------------
+	// Display width
+	//----------------------------------------------
+
+	TEST( UnicodeDisplayWidth, Codepoints )
+	{
+		EXPECT_EQ( displayWidth( "" ), 0u );
+		EXPECT_EQ( displayWidth( "hello" ), 5u );
+		EXPECT_EQ( displayWidth( "a\tb\r\n" ), 2u ); // controls are zero width
+		EXPECT_EQ( displayWidth( "caf\xC3\xA9" ), 4u );
+		EXPECT_EQ( displayWidth( "\xE4\xB8\xAD\xE6\x96\x87 ok" ), 7u );	 // 中文 ok
+		EXPECT_EQ( displayWidth( "\xEF\xBC\xA1" ), 2u );					 // FULLWIDTH LATIN CAPITAL LETTER A
+		EXPECT_EQ( displayWidth( "\xEF\xBD\xB6" ), 1u );					 // HALFWIDTH KATAKANA LETTER KA
+		EXPECT_EQ( displayWidth( "\xF0\xA0\x80\x80" ), 2u );				 // CJK Extension B
+		EXPECT_EQ( displayWidth( "a\xE2\x80\x8B" "b" ), 2u );					 // ZERO WIDTH SPACE
+		EXPECT_EQ( displayWidth( "\xC2\xAD" ), 1u );							 // SOFT HYPHEN
+		EXPECT_EQ( displayWidth( "\xFF\xFE" ), 2u );							 // ill-formed bytes
+	}
+
+	TEST( UnicodeDisplayWidth, GraphemeClusters )
+	{
+		EXPECT_EQ( displayWidth( "e\xCC\x81" ), 1u );										 // e + COMBINING ACUTE ACCENT
+		EXPECT_EQ( displayWidth( "\xCC\x81" ), 0u );										 // lone combining mark
+		EXPECT_EQ( displayWidth( "\xE1\x84\x80\xE1\x85\xA1\xE1\x86\xA8" ), 2u );		 // conjoining Hangul jamo
+		EXPECT_EQ( displayWidth( "\xF0\x9F\x98\x80" ), 2u );								 // emoji
+		EXPECT_EQ( displayWidth( "\xF0\x9F\x91\x8D\xF0\x9F\x8F\xBD" ), 2u );			 // emoji + skin tone
+		EXPECT_EQ( displayWidth( "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA7" ), 2u ); // ZWJ family
+		EXPECT_EQ( displayWidth( "\xF0\x9F\x87\xAB\xF0\x9F\x87\xB7" ), 2u );			 // flag
+		EXPECT_EQ( displayWidth( "\xF0\x9F\x87\xAB\xF0\x9F\x87\xB7\xF0\x9F\x87\xAB" ), 3u ); // flag + lone indicator
+		EXPECT_EQ( displayWidth( "\xE2\x9D\xA4" ), 1u );									 // text-style heart
+		EXPECT_EQ( displayWidth( "\xE2\x9D\xA4\xEF\xB8\x8F" ), 2u );					 // heart + VS16
+
+		// The last byte of an ASCII run takes the marks that follow it
+		const std::string longRun = std::string( 40, 'x' ) + "\xCC\x81" + std::string( 40, 'y' );
+		EXPECT_EQ( displayWidth( longRun ), 80u );
+		EXPECT_EQ( displayWidth( std::string( 100, 'a' ) + "\x07" + std::string( 27, 'b' ) ), 127u );
+	}
+
+	TEST( UnicodeDisplayWidth, Padding )
+	{
+		EXPECT_EQ( padDisplay( "\xE4\xB8\xAD", 5 ), "\xE4\xB8\xAD   " );
+		EXPECT_EQ( padDisplay( "\xE4\xB8\xAD", 5, TextAlignment::Right ), "   \xE4\xB8\xAD" );
+		EXPECT_EQ( padDisplay( "\xE4\xB8\xAD", 5, TextAlignment::Center, '*' ), "*\xE4\xB8\xAD**" );
+		EXPECT_EQ( padDisplay( "caf\xC3\xA9", 6 ), "caf\xC3\xA9  " );
+		EXPECT_EQ( padDisplay( "\xE4\xB8\xAD\xE6\x96\x87", 3 ), "\xE4\xB8\xAD\xE6\x96\x87" );
+
+		// Matches the byte-based functions on ASCII
+		EXPECT_EQ( padDisplay( "42", 5, TextAlignment::Right, '0' ), padLeft( "42", 5, '0' ) );
+		EXPECT_EQ( padDisplay( "Hi", 7, TextAlignment::Center, '*' ), center( "Hi", 7, '*' ) );
+	}
+
+	TEST( UnicodeDisplayWidth, Truncation )
+	{
+		EXPECT_EQ( truncateDisplay( "hello", 5 ), "hello" );
+		EXPECT_EQ( truncateDisplay( "hello world", 8 ), "hello w\xE2\x80\xA6" );
+		EXPECT_EQ( truncateDisplay( "hello world", 8, "..." ), "hello..." );
+		EXPECT_EQ( truncateDisplay( "hello world", 2, "..." ), "he" ); // ellipsis does not fit
+		EXPECT_EQ( truncateDisplay( "hello", 0 ), "" );
+
+		// Wide characters are dropped whole
+		EXPECT_EQ( truncateDisplay( "\xE4\xB8\xAD\xE6\x96\x87\xE5\xAD\x97", 5 ), "\xE4\xB8\xAD\xE6\x96\x87\xE2\x80\xA6" );
+		EXPECT_EQ( truncateDisplay( "\xE4\xB8\xAD\xE6\x96\x87\xE5\xAD\x97", 4 ), "\xE4\xB8\xAD\xE2\x80\xA6" );
+
+		// Clusters are never split
+		EXPECT_EQ( truncateDisplay( "abe\xCC\x81" "cd", 4, "" ), "abe\xCC\x81" "c" );
+		EXPECT_EQ( truncateDisplay( "ab\xF0\x9F\x87\xAB\xF0\x9F\x87\xB7" "cd", 3, "" ), "ab" );
+		EXPECT_EQ( truncateDisplay( "ab\r\ncd", 2, "" ), "ab\r\n" );
+	}
+
+	TEST( UnicodeDisplayWidth, TruncationKeepsWholeClusters )
+	{
+		// Pieces that never merge with their neighbours, with their widths. Printable ASCII
+		// pieces are one cluster per byte and long enough to take the bulk path.
+		static constexpr std::pair<std::string_view, std::size_t> clusters[]{
+			{ "a", 1 }, { "Zz", 2 }, { "\t", 0 }, { "\x7F", 0 }, { "\r\n", 0 }, { "e\xCC\x81", 1 }, { "\xE4\xB8\xAD", 2 },
+			{ "\xF0\x9F\x91\x8D\xF0\x9F\x8F\xBD", 2 }, { "\xE2\x9D\xA4\xEF\xB8\x8F", 2 },
+			{ "\xE1\x84\x80\xE1\x85\xA1", 2 }, { "The quick brown fox ", 20 },
+			{ "jumps over the lazy dog, again and again ", 41 } };
+
+		std::mt19937 rng{ 3 };
+		for ( int iteration = 0; iteration < 100; ++iteration )
+		{
+			std::string text;
+			std::vector<std::pair<std::size_t, std::size_t>> boundaries{ { 0, 0 } }; // byte offset, width
+			for ( std::size_t i = rng() % 30; i > 0; --i )
+			{
+				const auto& [cluster, width] = clusters[rng() % std::size( clusters )];
+				if ( width == cluster.size() )
+				{
+					// Printable ASCII: every byte is a cluster
+					for ( const char c : cluster )
+					{
+						text += c;
+						boundaries.emplace_back( text.size(), boundaries.back().second + 1 );
+					}
+					continue;
+				}
+				text += cluster;
+				boundaries.emplace_back( text.size(), boundaries.back().second + width );
+			}
+			ASSERT_EQ( displayWidth( text ), boundaries.back().second );
+
+			for ( std::size_t width = 0; width <= boundaries.back().second + 1; ++width )
+			{
+				const std::string truncated = truncateDisplay( text, width, "" );
+				std::size_t expected = 0;
+				for ( const auto& [offset, prefixWidth] : boundaries )
+				{
+					expected = prefixWidth <= width ? offset : expected;
+				}
+				EXPECT_EQ( truncated, text.substr( 0, expected ) ) << "iteration " << iteration << ", width " << width;
+			}
+		}
+	}
+} // namespace nfx::string::test
@@ -0,0 +1,461 @@
+/**
+ * @file TESTS_StringUtf8.cpp
+ * @brief Tests for UTF-8 validation, codepoint counting and transcoding
+ * @details Tests covering well-formed and ill-formed sequences, error offsets across SIMD block
+ *          boundaries, codepoint counting compared against a reference decoder, and
+ *          UTF-8/UTF-16/UTF-32/Latin-1 round trips including buffer capacity limits
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nfx/string/Utf8.h>
+
+namespace nfx::string::test
+{
+	//=====================================================================
+	// UTF-8 tests
+	//=====================================================================
+
+	//----------------------------------------------
+	// Reference implementation
+	//----------------------------------------------
+
+	/** @brief Byte-at-a-time RFC 3629 decoder returning the first error offset or npos */
+	static std::size_t referenceFindError( std::string_view str )
+	{
+		std::size_t pos = 0;
+		while ( pos < str.size() )
+		{
+			const auto lead = static_cast<unsigned char>( str[pos] );
+			std::size_t length = 0;
+			std::uint32_t cp = 0;
+			if ( lead < 0x80 )
+			{
+				++pos;
+				continue;
+			}
+			else if ( ( lead & 0xE0 ) == 0xC0 )
+			{
+				length = 2;
+				cp = lead & 0x1F;
+			}
+			else if ( ( lead & 0xF0 ) == 0xE0 )
+			{
+				length = 3;
+				cp = lead & 0x0F;
+			}
+			else if ( ( lead & 0xF8 ) == 0xF0 )
+			{
+				length = 4;
+				cp = lead & 0x07;
+			}
+			else
+			{
+				return pos;
+			}
+
+			if ( pos + length > str.size() )
+			{
+				return pos;
+			}
+			for ( std::size_t i = 1; i < length; ++i )
+			{
+				const auto byte = static_cast<unsigned char>( str[pos + i] );
+				if ( ( byte & 0xC0 ) != 0x80 )
+				{
+					return pos;
+				}
+				cp = ( cp << 6 ) | ( byte & 0x3F );
+			}
+
+			const std::uint32_t minimum = length == 2 ? 0x80 : length == 3 ? 0x800
+																		   : 0x10000;
+			if ( cp < minimum || cp > 0x10FFFF || ( cp >= 0xD800 && cp <= 0xDFFF ) )
+			{
+				return pos;
+			}
+			pos += length;
+		}
+		return std::string_view::npos;
+	}
+
+	/** @brief Straightforward encoders used to build expected transcoder output */
+	static std::string referenceUtf8( const std::u32string& codepoints )
+	{
+		std::string result;
+		for ( const char32_t cp : codepoints )
+		{
+			if ( cp < 0x80 )
+			{
+				result += static_cast<char>( cp );
+			}
+			else if ( cp < 0x800 )
+			{
+				result += static_cast<char>( 0xC0 | ( cp >> 6 ) );
+				result += static_cast<char>( 0x80 | ( cp & 0x3F ) );
+			}
+			else if ( cp < 0x10000 )
+			{
+				result += static_cast<char>( 0xE0 | ( cp >> 12 ) );
+				result += static_cast<char>( 0x80 | ( ( cp >> 6 ) & 0x3F ) );
+				result += static_cast<char>( 0x80 | ( cp & 0x3F ) );
+			}
+			else
+			{
+				result += static_cast<char>( 0xF0 | ( cp >> 18 ) );
+				result += static_cast<char>( 0x80 | ( ( cp >> 12 ) & 0x3F ) );
+				result += static_cast<char>( 0x80 | ( ( cp >> 6 ) & 0x3F ) );
+				result += static_cast<char>( 0x80 | ( cp & 0x3F ) );
+			}
+		}
+		return result;
+	}
+
+	static std::u16string referenceUtf16( const std::u32string& codepoints )
+	{
+		std::u16string result;
+		for ( const char32_t cp : codepoints )
+		{
+			if ( cp < 0x10000 )
+			{
+				result += static_cast<char16_t>( cp );
+			}
+			else
+			{
+				result += static_cast<char16_t>( 0xD800 + ( ( cp - 0x10000 ) >> 10 ) );
+				result += static_cast<char16_t>( 0xDC00 + ( ( cp - 0x10000 ) & 0x3FF ) );
+			}
+		}
+		return result;
+	}
+
+	/** @brief Random scalar values drawn from the given ranges */
+	static std::u32string randomCodepoints( std::mt19937& rng, std::size_t count, char32_t maxCodepoint )
+	{
+		std::u32string result;
+		while ( result.size() < count )
+		{
+			// Runs of varying length, some pure ASCII, so both fast and slow paths are exercised
+			const char32_t limit = rng() % 3 == 0 ? 0x80 : maxCodepoint + 1;
+			const std::size_t run = 1 + rng() % 24;
+			for ( std::size_t i = 0; i < run && result.size() < count; ++i )
+			{
+				const char32_t cp = static_cast<char32_t>( rng() % limit );
+				if ( cp < 0xD800 || cp > 0xDFFF )
+				{
+					result += cp;
+				}
+			}
+		}
+		return result;
+	}
+
+	//----------------------------------------------
+	// Validation
+	//----------------------------------------------
+
+	TEST( Utf8Validation, WellFormed )
+	{
+		EXPECT_TRUE( utf8Valid( "" ) );
+		EXPECT_TRUE( utf8Valid( "hello world" ) );
+		EXPECT_TRUE( utf8Valid( "caf\xC3\xA9" ) );				 // é
+		EXPECT_TRUE( utf8Valid( "\xE2\x82\xAC" ) );				 // €
+		EXPECT_TRUE( utf8Valid( "\xF0\x9F\x98\x80" ) );			 // 😀
+		EXPECT_TRUE( utf8Valid( "\xED\x9F\xBF" ) );				 // U+D7FF, last before surrogates
+		EXPECT_TRUE( utf8Valid( "\xEE\x80\x80" ) );				 // U+E000, first after surrogates
+		EXPECT_TRUE( utf8Valid( "\xF4\x8F\xBF\xBF" ) );			 // U+10FFFF
+		EXPECT_TRUE( utf8Valid( std::string_view{ "\0", 1 } ) ); // NUL is valid
+	}
+
+	TEST( Utf8Validation, IllFormed )
+	{
+		EXPECT_FALSE( utf8Valid( "\x80" ) );			 // Stray continuation
+		EXPECT_FALSE( utf8Valid( "\xC0\xAF" ) );		 // Overlong '/'
+		EXPECT_FALSE( utf8Valid( "\xC1\xBF" ) );		 // Overlong 2-byte
+		EXPECT_FALSE( utf8Valid( "\xE0\x9F\xBF" ) );	 // Overlong 3-byte
+		EXPECT_FALSE( utf8Valid( "\xF0\x8F\xBF\xBF" ) ); // Overlong 4-byte
+		EXPECT_FALSE( utf8Valid( "\xED\xA0\x80" ) );	 // Surrogate U+D800
+		EXPECT_FALSE( utf8Valid( "\xF4\x90\x80\x80" ) ); // U+110000
+		EXPECT_FALSE( utf8Valid( "\xF5\x80\x80\x80" ) ); // Invalid lead
+		EXPECT_FALSE( utf8Valid( "\xFF" ) );
+		EXPECT_FALSE( utf8Valid( "\xC3" ) );			 // Truncated
+		EXPECT_FALSE( utf8Valid( "\xE2\x82" ) );		 // Truncated
+		EXPECT_FALSE( utf8Valid( "\xC3\xA9\xA9" ) );	 // Too many continuations
+	}
+
+	TEST( Utf8Validation, ErrorOffset )
+	{
+		std::size_t offset = 0;
+
+		EXPECT_TRUE( utf8Valid( "abc", offset ) );
+		EXPECT_EQ( offset, std::string_view::npos );
+
+		EXPECT_FALSE( utf8Valid( "ab\xC3", offset ) );
+		EXPECT_EQ( offset, 2 );
+
+		EXPECT_FALSE( utf8Valid( "\xC3\xA9x\x80y", offset ) );
+		EXPECT_EQ( offset, 3 );
+
+		EXPECT_FALSE( utf8Valid( "ok\xE2\x82z", offset ) );
+		EXPECT_EQ( offset, 2 );
+	}
+
+	TEST( Utf8Validation, ErrorOffsetAcrossBlocks )
+	{
+		// Place errors at every position around 16/32/64-byte block boundaries
+		const std::string euro{ "\xE2\x82\xAC" };
+		for ( std::size_t prefix = 0; prefix < 140; ++prefix )
+		{
+			std::string ascii( prefix, 'a' );
+
+			std::string truncated = ascii + euro.substr( 0, 2 ) + std::string( 70, 'b' );
+			std::size_t offset = 0;
+			EXPECT_FALSE( utf8Valid( truncated, offset ) );
+			EXPECT_EQ( offset, prefix ) << "prefix " << prefix;
+
+			std::string trailingLead = ascii + "\xF0\x9F\x98";
+			EXPECT_FALSE( utf8Valid( trailingLead, offset ) );
+			EXPECT_EQ( offset, prefix ) << "prefix " << prefix;
+
+			std::string valid = ascii + euro + std::string( 70, 'c' ) + euro;
+			EXPECT_TRUE( utf8Valid( valid, offset ) ) << "prefix " << prefix;
+		}
+	}
+
+	TEST( Utf8Validation, MatchesReferenceDecoder )
+	{
+		// Random mixes of valid codepoints with occasional corrupted bytes
+		std::mt19937 rng{ 12345 };
+		const std::string_view pieces[]{ "a", "Z", " ", "\xC3\xA9", "\xD0\x96", "\xE2\x82\xAC", "\xE4\xB8\xAD",
+			"\xF0\x9F\x98\x80", "\xEF\xBF\xBD" };
+
+		for ( int iteration = 0; iteration < 2000; ++iteration )
+		{
+			std::string text;
+			const std::size_t count = rng() % 200;
+			for ( std::size_t i = 0; i < count; ++i )
+			{
+				text.append( pieces[rng() % std::size( pieces )] );
+			}
+			if ( !text.empty() && iteration % 2 == 0 )
+			{
+				text[rng() % text.size()] = static_cast<char>( rng() % 256 );
+			}
+
+			std::size_t offset = 0;
+			const std::size_t expected = referenceFindError( text );
+			EXPECT_EQ( utf8Valid( text, offset ), expected == std::string_view::npos );
+			EXPECT_EQ( offset, expected ) << "iteration " << iteration;
+		}
+	}
+
+	//----------------------------------------------
+	// Codepoint counting
+	//----------------------------------------------
+
+	TEST( Utf8Length, Basic )
+	{
+		EXPECT_EQ( utf8Length( "" ), 0 );
+		EXPECT_EQ( utf8Length( "hello" ), 5 );
+		EXPECT_EQ( utf8Length( "h\xC3\xA9llo" ), 5 );
+		EXPECT_EQ( utf8Length( "\xE2\x82\xAC" ), 1 );
+		EXPECT_EQ( utf8Length( "\xF0\x9F\x98\x80!" ), 2 );
+	}
+
+	TEST( Utf8Length, LongMixedInput )
+	{
+		std::string text;
+		std::size_t expected = 0;
+		for ( int i = 0; i < 1000; ++i )
+		{
+			text.append( "ab\xC3\xA9\xE4\xB8\xAD\xF0\x9F\x98\x80" );
+			expected += 5;
+			EXPECT_EQ( utf8Length( text ), expected );
+		}
+		EXPECT_EQ( utf8Length( std::string_view{ text }.substr( 1 ) ), expected - 1 );
+	}
+
+	//----------------------------------------------
+	// Output size prediction
+	//----------------------------------------------
+
+	TEST( Utf8Transcoding, LengthPrediction )
+	{
+		EXPECT_EQ( utf16LengthFromUtf8( "" ), 0 );
+		EXPECT_EQ( utf16LengthFromUtf8( "abc" ), 3 );
+		EXPECT_EQ( utf16LengthFromUtf8( "\xC3\xA9\xE2\x82\xAC" ), 2 );
+		EXPECT_EQ( utf16LengthFromUtf8( "\xF0\x9F\x98\x80" ), 2 );
+
+		EXPECT_EQ( utf8LengthFromUtf16( u"abc" ), 3 );
+		EXPECT_EQ( utf8LengthFromUtf16( u"\u00E9\u20AC" ), 5 );
+		EXPECT_EQ( utf8LengthFromUtf16( u"\U0001F600" ), 4 );
+
+		EXPECT_EQ( utf8LengthFromUtf32( U"a\u00E9\u20AC\U0001F600" ), 10 );
+
+		EXPECT_EQ( utf8LengthFromLatin1( "abc" ), 3 );
+		EXPECT_EQ( utf8LengthFromLatin1( "caf\xE9" ), 5 );
+	}
+
+	//----------------------------------------------
+	// Transcoding
+	//----------------------------------------------
+
+	TEST( Utf8Transcoding, KnownValues )
+	{
+		std::u16string utf16;
+		EXPECT_TRUE( tryUtf8ToUtf16( "h\xC3\xA9 \xE2\x82\xAC \xF0\x9F\x98\x80", utf16 ) );
+		EXPECT_EQ( utf16, u"h\u00E9 \u20AC \U0001F600" );
+
+		std::string utf8;
+		EXPECT_TRUE( tryUtf16ToUtf8( u"h\u00E9 \u20AC \U0001F600", utf8 ) );
+		EXPECT_EQ( utf8, "h\xC3\xA9 \xE2\x82\xAC \xF0\x9F\x98\x80" );
+
+		std::u32string utf32;
+		EXPECT_TRUE( tryUtf8ToUtf32( "h\xC3\xA9\xF0\x9F\x98\x80", utf32 ) );
+		EXPECT_EQ( utf32, U"h\u00E9\U0001F600" );
+
+		EXPECT_TRUE( tryUtf32ToUtf8( U"h\u00E9\U0001F600", utf8 ) );
+		EXPECT_EQ( utf8, "h\xC3\xA9\xF0\x9F\x98\x80" );
+
+		EXPECT_EQ( latin1ToUtf8( "caf\xE9 \xFF" ), "caf\xC3\xA9 \xC3\xBF" );
+
+		std::string latin1;
+		EXPECT_TRUE( tryUtf8ToLatin1( "caf\xC3\xA9 \xC3\xBF", latin1 ) );
+		EXPECT_EQ( latin1, "caf\xE9 \xFF" );
+	}
+
+	TEST( Utf8Transcoding, RandomRoundTrips )
+	{
+		std::mt19937 rng{ 2024 };
+		const char32_t ranges[]{ 0x7F, 0xFF, 0x7FF, 0xFFFF, 0x10FFFF };
+
+		for ( int iteration = 0; iteration < 500; ++iteration )
+		{
+			const char32_t maxCodepoint = ranges[iteration % std::size( ranges )];
+			const std::u32string codepoints = randomCodepoints( rng, rng() % 300, maxCodepoint );
+			const std::string utf8 = referenceUtf8( codepoints );
+			const std::u16string utf16 = referenceUtf16( codepoints );
+
+			EXPECT_EQ( utf16LengthFromUtf8( utf8 ), utf16.size() );
+			EXPECT_EQ( utf8LengthFromUtf16( utf16 ), utf8.size() );
+			EXPECT_EQ( utf8LengthFromUtf32( codepoints ), utf8.size() );
+
+			std::u16string toUtf16;
+			EXPECT_TRUE( tryUtf8ToUtf16( utf8, toUtf16 ) );
+			EXPECT_EQ( toUtf16, utf16 ) << "iteration " << iteration;
+
+			std::string fromUtf16;
+			EXPECT_TRUE( tryUtf16ToUtf8( utf16, fromUtf16 ) );
+			EXPECT_EQ( fromUtf16, utf8 ) << "iteration " << iteration;
+
+			std::u32string toUtf32;
+			EXPECT_TRUE( tryUtf8ToUtf32( utf8, toUtf32 ) );
+			EXPECT_EQ( toUtf32, codepoints ) << "iteration " << iteration;
+
+			std::string fromUtf32;
+			EXPECT_TRUE( tryUtf32ToUtf8( codepoints, fromUtf32 ) );
+			EXPECT_EQ( fromUtf32, utf8 ) << "iteration " << iteration;
+
+			// Non-validating variants produce the same output on valid input
+			std::u16string unchecked16( utf16.size(), u'\0' );
+			EXPECT_EQ( utf8ToUtf16Unchecked( utf8, unchecked16 ), utf16.size() );
+			EXPECT_EQ( unchecked16, utf16 );
+
+			std::string unchecked8( utf8.size(), '\0' );
+			EXPECT_EQ( utf16ToUtf8Unchecked( utf16, unchecked8 ), utf8.size() );
+			EXPECT_EQ( unchecked8, utf8 );
+
+			std::u32string unchecked32( codepoints.size(), U'\0' );
+			EXPECT_EQ( utf8ToUtf32Unchecked( utf8, unchecked32 ), codepoints.size() );
+			EXPECT_EQ( unchecked32, codepoints );
+
+			EXPECT_EQ( utf32ToUtf8Unchecked( codepoints, unchecked8 ), utf8.size() );
+			EXPECT_EQ( unchecked8, utf8 );
+
+			if ( maxCodepoint <= 0xFF )
+			{
+				std::string latin1;
+				for ( const char32_t cp : codepoints )
+				{
+					latin1 += static_cast<char>( cp );
+				}
+				EXPECT_EQ( utf8LengthFromLatin1( latin1 ), utf8.size() );
+				EXPECT_EQ( latin1ToUtf8( latin1 ), utf8 );
+
+				std::string backToLatin1;
+				EXPECT_TRUE( tryUtf8ToLatin1( utf8, backToLatin1 ) );
+				EXPECT_EQ( backToLatin1, latin1 );
+
+				std::string uncheckedLatin1( latin1.size(), '\0' );
+				EXPECT_EQ( utf8ToLatin1Unchecked( utf8, uncheckedLatin1 ), latin1.size() );
+				EXPECT_EQ( uncheckedLatin1, latin1 );
+			}
+		}
+	}
+
+	TEST( Utf8Transcoding, RejectsIllFormedInput )
+	{
+		std::u16string utf16;
+		EXPECT_FALSE( tryUtf8ToUtf16( "abc\xC0\xAF", utf16 ) );
+		EXPECT_EQ( utf16, u"abc" );
+		EXPECT_FALSE( tryUtf8ToUtf16( std::string( 40, 'a' ) + "\xED\xA0\x80", utf16 ) );
+		EXPECT_EQ( utf16.size(), 40 );
+
+		// Overlong 2-byte sequence inside a block the 2-byte kernel would take
+		std::u32string utf32;
+		EXPECT_FALSE( tryUtf8ToUtf32( "\xC3\xA9\xC1\xBF\xC3\xA9\xC3\xA9" "abcdefgh", utf32 ) );
+		EXPECT_EQ( utf32, U"\u00E9" );
+
+		std::string utf8;
+		EXPECT_FALSE( tryUtf16ToUtf8( std::u16string{ u"ab" } + char16_t( 0xD800 ) + u"cd", utf8 ) );
+		EXPECT_EQ( utf8, "ab" );
+		EXPECT_FALSE( tryUtf16ToUtf8( std::u16string{ char16_t( 0xDC00 ), char16_t( 0xD800 ) }, utf8 ) );
+		EXPECT_FALSE( tryUtf16ToUtf8( std::u16string{ char16_t( 0xD83D ) }, utf8 ) );
+
+		EXPECT_FALSE( tryUtf32ToUtf8( std::u32string{ U'a', char32_t( 0xD800 ) }, utf8 ) );
+		EXPECT_FALSE( tryUtf32ToUtf8( std::u32string{ char32_t( 0x110000 ) }, utf8 ) );
+
+		std::string latin1;
+		EXPECT_FALSE( tryUtf8ToLatin1( "caf\xC3\xA9 \xE2\x82\xAC", latin1 ) );
+		EXPECT_EQ( latin1, "caf\xE9 " );
+		EXPECT_FALSE( tryUtf8ToLatin1( "\xC3\xA9\xC4\x80\xC3\xA9\xC3\xA9" "abcdefghijkl", latin1 ) );
+		EXPECT_EQ( latin1, "\xE9" );
+	}
+
+	TEST( Utf8Transcoding, RespectsOutputCapacity )
+	{
+		const std::string utf8 = std::string( 64, 'x' ) + "\xC3\xA9\xC3\xA9\xC3\xA9\xC3\xA9" + std::string( 64, 'y' );
+		const std::size_t needed = utf16LengthFromUtf8( utf8 );
+
+		for ( std::size_t capacity = 0; capacity < needed; ++capacity )
+		{
+			std::vector<char16_t> buffer( capacity + 16, u'#' );
+			std::size_t written = 0;
+			EXPECT_FALSE( tryUtf8ToUtf16( utf8, std::span<char16_t>{ buffer.data(), capacity }, written ) );
+			EXPECT_LE( written, capacity );
+			for ( std::size_t i = capacity; i < buffer.size(); ++i )
+			{
+				EXPECT_EQ( buffer[i], u'#' ) << "capacity " << capacity;
+			}
+			EXPECT_LE( utf8ToUtf16Unchecked( utf8, std::span<char16_t>{ buffer.data(), capacity } ), capacity );
+		}
+
+		const std::u16string utf16 = u"\u00E9\u00E9\u00E9\u00E9\u00E9\u00E9\u00E9\u00E9abcdefgh\u20AC";
+		for ( std::size_t capacity = 0; capacity < utf8LengthFromUtf16( utf16 ); ++capacity )
+		{
+			std::vector<char> buffer( capacity + 16, '#' );
+			std::size_t written = 0;
+			EXPECT_FALSE( tryUtf16ToUtf8( utf16, std::span<char>{ buffer.data(), capacity }, written ) );
+			for ( std::size_t i = capacity; i < buffer.size(); ++i )
+			{
+				EXPECT_EQ( buffer[i], '#' ) << "capacity " << capacity;
+			}
+		}
+	}
+} // namespace nfx::string::test
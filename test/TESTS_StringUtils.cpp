@@ -3,18 +3,23 @@
  * @brief Comprehensive tests for StringUtils high-performance string library
  * @details Tests covering validation, parsing, string operations, character classification,
  *          trimming, case conversion, edge cases, and performance validation for both
- *          zero-allocation (string_view) and allocating (std::string) functions
+ *          zero-allocation (string_view) and allocating (std::string) functions, with heap
+ *          allocations checked through AllocationCounter.h
  */
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <limits>
 #include <string>
 #include <string_view>
+#include <vector>
 
 #include <nfx/string/Utils.h>
 
+#include "AllocationCounter.h"
+
 namespace nfx::string::test
 {
 	//=====================================================================
@@ -1124,6 +1129,120 @@ namespace nfx::string::test
 		EXPECT_EQ( countOverlapping( "aaaaaa", "aaa" ), 4 ); // Positions 0, 1, 2, 3
 	}
 
+	TEST( StringUtilsOperations, Count_Substring_PeriodicAndLongPatterns )
+	{
+		// Periodic text against long patterns, where restarting a search after each hit is quadratic
+		const std::string run( 100000, 'a' );
+		const std::string pattern( 1000, 'a' );
+		EXPECT_EQ( countOverlapping( run, pattern ), run.size() - pattern.size() + 1 );
+		EXPECT_EQ( count( run, pattern ), run.size() / pattern.size() );
+		EXPECT_EQ( countOverlapping( run, pattern + "b" ), 0u );
+
+		// Patterns that overlap themselves, non-overlapping resumes after each hit
+		EXPECT_EQ( count( "aaaaa", "aa" ), 2u );
+		EXPECT_EQ( count( "abababa", "aba" ), 2u );
+		EXPECT_EQ( count( "abababab", "abab" ), 2u );
+		EXPECT_EQ( countOverlapping( "abababab", "abab" ), 3u );
+		EXPECT_EQ( count( "abaababaab", "abaab" ), 2u );
+		EXPECT_EQ( countOverlapping( "abaabaabaab", "abaab" ), 3u );
+
+		// Short motifs in a sequence longer than the vector widths, and high bytes
+		std::string sequence;
+		for ( int i = 0; i < 40; ++i )
+		{
+			sequence += "TATAAGC";
+		}
+		EXPECT_EQ( countOverlapping( sequence, "TATA" ), 40u );
+		EXPECT_EQ( countOverlapping( sequence, "AT" ), 40u );
+		EXPECT_EQ( count( sequence, "GCT" ), 39u );
+		EXPECT_EQ( count( std::string( 100, '\xFF' ), "\xFF\xFF\xFF" ), 33u );
+		EXPECT_EQ( countOverlapping( std::string( 100, '\xFF' ), "\xFF\xFF\xFF" ), 98u );
+	}
+
+	TEST( StringUtilsOperations, Count_Substring_MatchesNaiveSearch )
+	{
+		// Naive position-by-position reference, resuming one byte or one pattern past each hit
+		const auto naive = []( std::string_view str, std::string_view pattern, bool overlapping ) {
+			std::size_t occurrences = 0;
+			for ( std::size_t pos = 0; pos + pattern.size() <= str.size(); )
+			{
+				if ( str.substr( pos, pattern.size() ) == pattern )
+				{
+					++occurrences;
+					pos += overlapping ? 1 : pattern.size();
+				}
+				else
+				{
+					++pos;
+				}
+			}
+			return occurrences;
+		};
+
+		// Small alphabet, so every pattern length from 2 to 8 occurs often and in runs
+		std::string text;
+		std::uint32_t state = 12345;
+		for ( std::size_t i = 0; i < 700; ++i )
+		{
+			state = state * 1103515245u + 12345u;
+			text.push_back( "aab\xE9"[( state >> 16 ) % 4] );
+		}
+
+		for ( std::size_t length = 2; length <= 8; ++length )
+		{
+			for ( std::size_t start = 0; start < 40; start += 3 )
+			{
+				const std::string_view pattern = std::string_view{ text }.substr( 300 + start, length );
+				for ( std::size_t offset = 0; offset < 40; offset += 7 )
+				{
+					const std::string_view slice = std::string_view{ text }.substr( offset, 100 + offset * 11 );
+					EXPECT_EQ( count( slice, pattern ), naive( slice, pattern, false ) ) << pattern << " @" << offset;
+					EXPECT_EQ( countOverlapping( slice, pattern ), naive( slice, pattern, true ) ) << pattern << " @" << offset;
+				}
+			}
+		}
+
+		// A long periodic run, where verifying every candidate would be quadratic, followed by varied text
+		const std::string periodic = std::string( 10000, 'a' ) + text;
+		for ( std::size_t length = 5; length <= 40; length += 5 )
+		{
+			for ( const std::size_t start : { std::size_t{ 9000 }, 10000 - length / 2, std::size_t{ 10100 } } )
+			{
+				const std::string_view pattern = std::string_view{ periodic }.substr( start, length );
+				EXPECT_EQ( count( periodic, pattern ), naive( periodic, pattern, false ) ) << length << " @" << start;
+				EXPECT_EQ( countOverlapping( periodic, pattern ), naive( periodic, pattern, true ) ) << length << " @" << start;
+			}
+		}
+
+		// Pattern longer than the stack failure table
+		const std::string_view longPattern = std::string_view{ text }.substr( 100, 300 );
+		EXPECT_EQ( count( text, longPattern ), 1u );
+		EXPECT_EQ( countOverlapping( text + text, longPattern ), 2u );
+
+		// Long patterns over repeated blocks with a few mutations, periodic and not
+		for ( const std::string_view block : { std::string_view{ "abaab" }, std::string_view{ "a" }, std::string_view{ "abcabd" } } )
+		{
+			std::string repeated;
+			while ( repeated.size() < 3000 )
+			{
+				repeated += block;
+			}
+			for ( std::size_t pos = 700; pos < repeated.size(); pos += 977 )
+			{
+				repeated[pos] = 'x';
+			}
+			for ( const std::size_t length : { std::size_t{ 257 }, std::size_t{ 300 }, std::size_t{ 640 } } )
+			{
+				for ( const std::size_t start : { std::size_t{ 0 }, std::size_t{ 500 }, std::size_t{ 650 } } )
+				{
+					const std::string_view pattern = std::string_view{ repeated }.substr( start, length );
+					EXPECT_EQ( count( repeated, pattern ), naive( repeated, pattern, false ) ) << block << " " << length << " @" << start;
+					EXPECT_EQ( countOverlapping( repeated, pattern ), naive( repeated, pattern, true ) ) << block << " " << length << " @" << start;
+				}
+			}
+		}
+	}
+
 	TEST( StringUtilsOperations, Count_Character )
 	{
 		// Basic counting
@@ -1145,6 +1264,104 @@ namespace nfx::string::test
 		// Special characters
 		EXPECT_EQ( count( "a,b,c,d", ',' ), 3 );
 		EXPECT_EQ( count( "one two three", ' ' ), 2 );
+
+		// Compile-time evaluation
+		static_assert( count( "a\nb\nc\n", '\n' ) == 3 );
+	}
+
+	TEST( StringUtilsOperations, Count_Character_LargeBuffers )
+	{
+		// Every byte matching overflows 8-bit lane counters unless they are summed in time
+		const std::string newlines( 100000, '\n' );
+		EXPECT_EQ( count( newlines, '\n' ), newlines.size() );
+		EXPECT_EQ( count( newlines, '\r' ), 0u );
+
+		// Bytes with the high bit set, where a signed compare or a SWAR carry would go wrong
+		const std::string high( 1000, '\xFF' );
+		EXPECT_EQ( count( high, '\xFF' ), 1000u );
+		EXPECT_EQ( count( high, '\x7F' ), 0u );
+
+		// Every offset and length around the vector and word boundaries
+		std::string text;
+		for ( std::size_t i = 0; i < 600; ++i )
+		{
+			text.push_back( "ab\ncd\n\xE9" "f"[( i * 7 + i / 5 ) % 8] );
+		}
+		for ( std::size_t offset = 0; offset < 40; ++offset )
+		{
+			for ( std::size_t length = 0; offset + length <= text.size(); length += 13 )
+			{
+				const std::string_view slice = std::string_view{ text }.substr( offset, length );
+				EXPECT_EQ( count( slice, '\n' ), static_cast<std::size_t>( std::count( slice.begin(), slice.end(), '\n' ) ) )
+					<< offset << "+" << length;
+				EXPECT_EQ( count( slice, '\xE9' ), static_cast<std::size_t>( std::count( slice.begin(), slice.end(), '\xE9' ) ) )
+					<< offset << "+" << length;
+			}
+		}
+	}
+
+	TEST( StringUtilsOperations, CountAny )
+	{
+		// Basic counting
+		EXPECT_EQ( countAny( "a,b;c d", CharClass{ ",; " } ), 3u );
+		EXPECT_EQ( countAny( "line1\r\nline2\nline3", CharClass{ "\r\n" } ), 3u );
+		EXPECT_EQ( countAny( "hello", CharClass{ "xyz" } ), 0u );
+		EXPECT_EQ( countAny( "", CharClass{ "abc" } ), 0u );
+		EXPECT_EQ( countAny( "abc", CharClass{} ), 0u );
+
+		// Predefined classes agree with the character classification functions
+		const std::string mixed{ "Order #42: 3 items, total $17.50\t(paid)\n" };
+		const auto expected = [&mixed]( bool ( *predicate )( char ) ) {
+			return static_cast<std::size_t>( std::count_if( mixed.begin(), mixed.end(), predicate ) );
+		};
+		EXPECT_EQ( countAny( mixed, CharClass::whitespace() ), expected( isWhitespace ) );
+		EXPECT_EQ( countAny( mixed, CharClass::digits() ), expected( isDigit ) );
+		EXPECT_EQ( countAny( mixed, CharClass::alpha() ), expected( isAlpha ) );
+		EXPECT_EQ( countAny( mixed, CharClass::alphaNumeric() ), expected( isAlphaNumeric ) );
+
+		// Membership and union
+		constexpr CharClass separators = CharClass{ "," } | CharClass{ ";" };
+		static_assert( separators.contains( ',' ) && separators.contains( ';' ) && !separators.contains( ' ' ) );
+		static_assert( countAny( "a,b;c", separators ) == 2 );
+	}
+
+	TEST( StringUtilsOperations, CountAny_AllByteClasses )
+	{
+		// Every byte value once, repeated past the vector widths, at every offset
+		std::string bytes;
+		for ( int repeat = 0; repeat < 3; ++repeat )
+		{
+			for ( int value = 0; value < 256; ++value )
+			{
+				bytes.push_back( static_cast<char>( ( value * 37 + repeat ) & 0xFF ) );
+			}
+		}
+
+		// Classes with few and with more than 8 distinct high-nibble rows or members, and high bytes
+		std::string diagonal;
+		for ( int high = 0; high < 16; ++high )
+		{
+			diagonal.push_back( static_cast<char>( high * 16 + high ) );
+		}
+		const CharClass classes[] = { CharClass{ "\n" }, CharClass::alphaNumeric(), CharClass{ "\x80\xBF\xC3\xFF" },
+			CharClass{ diagonal }, CharClass{ diagonal } | CharClass::whitespace(), CharClass{ diagonal.substr( 0, 8 ) },
+			CharClass{ diagonal.substr( 0, 9 ) }, CharClass{ ",;: " }, CharClass{} };
+
+		for ( const CharClass& charClass : classes )
+		{
+			for ( std::size_t offset = 0; offset < 48; ++offset )
+			{
+				const std::string_view slice = std::string_view{ bytes }.substr( offset );
+				const auto expected = static_cast<std::size_t>(
+					std::count_if( slice.begin(), slice.end(), [&charClass]( char c ) { return charClass.contains( c ); } ) );
+				EXPECT_EQ( countAny( slice, charClass ), expected ) << offset;
+			}
+		}
+
+		// Every byte matching overflows 8-bit lane counters unless they are summed in time
+		const std::string separators( 100000, ';' );
+		EXPECT_EQ( countAny( separators, CharClass{ ",;" } ), separators.size() );
+		EXPECT_EQ( countAny( separators, CharClass{ diagonal } | CharClass{ ";" } ), separators.size() );
 	}
 
 	TEST( StringUtilsOperations, Replace )
@@ -1471,6 +1688,72 @@ namespace nfx::string::test
 		EXPECT_EQ( lastIndexOf( "192.168.1.1", "." ), 9 );			  // IP last octet
 	}
 
+	TEST( StringUtilsOperations, CommonPrefix )
+	{
+		// Basic functionality
+		EXPECT_EQ( commonPrefix( "/api/users", "/api/orders" ), "/api/" );
+		EXPECT_EQ( commonPrefix( "abc", "abc" ), "abc" );
+		EXPECT_EQ( commonPrefix( "abc", "abcdef" ), "abc" );
+		EXPECT_EQ( commonPrefix( "abc", "xyz" ), "" );
+		EXPECT_EQ( commonPrefix( "", "abc" ), "" );
+
+		// Result views the first argument
+		const std::string_view lhs = "prefix-one";
+		EXPECT_EQ( commonPrefix( lhs, "prefix-two" ).data(), lhs.data() );
+
+		// Every mismatch position across vector and scalar blocks
+		for ( std::size_t size : { 7u, 16u, 31u, 32u, 33u, 64u, 100u } )
+		{
+			const std::string base( size, 'k' );
+			for ( std::size_t mismatch = 0; mismatch < size; ++mismatch )
+			{
+				std::string other = base;
+				other[mismatch] = 'z';
+				EXPECT_EQ( commonPrefix( base, other ).size(), mismatch );
+			}
+			EXPECT_EQ( commonPrefix( base, base ).size(), size );
+		}
+	}
+
+	TEST( StringUtilsOperations, CommonSuffix )
+	{
+		// Basic functionality
+		EXPECT_EQ( commonSuffix( "report.tar.gz", "backup.tar.gz" ), ".tar.gz" );
+		EXPECT_EQ( commonSuffix( "abc", "xbc" ), "bc" );
+		EXPECT_EQ( commonSuffix( "bc", "abc" ), "bc" );
+		EXPECT_EQ( commonSuffix( "abc", "abd" ), "" );
+		EXPECT_EQ( commonSuffix( "abc", "" ), "" );
+
+		// Every mismatch position across vector and scalar blocks
+		for ( std::size_t size : { 7u, 16u, 31u, 32u, 33u, 64u, 100u } )
+		{
+			const std::string base( size, 'k' );
+			for ( std::size_t mismatch = 0; mismatch < size; ++mismatch )
+			{
+				std::string other = base;
+				other[mismatch] = 'z';
+				EXPECT_EQ( commonSuffix( base, other ).size(), size - mismatch - 1 );
+			}
+			EXPECT_EQ( commonSuffix( "x" + base, base ).size(), size );
+		}
+	}
+
+	TEST( StringUtilsOperations, CommonPrefixOfSet )
+	{
+		const std::vector<std::string_view> routes{ "/api/v2/users/list", "/api/v2/users/42", "/api/v2/orders", "/api/v2/users" };
+		EXPECT_EQ( commonPrefix( routes ), "/api/v2/" );
+		EXPECT_EQ( commonSuffix( std::vector<std::string_view>{ "a.log", "bb.log", "access.log" } ), ".log" );
+		EXPECT_EQ( commonPrefix( std::span<const std::string_view>{} ), "" );
+		EXPECT_EQ( commonSuffix( std::span<const std::string_view>{} ), "" );
+		EXPECT_EQ( commonPrefix( std::vector<std::string_view>{ "only" } ), "only" );
+		EXPECT_EQ( commonPrefix( std::vector<std::string_view>{ "ab", "", "ab" } ), "" );
+
+		// Sorted sets: the first and last keys decide
+		std::vector<std::string_view> sorted = routes;
+		std::sort( sorted.begin(), sorted.end() );
+		EXPECT_EQ( commonPrefix( sorted ), commonPrefix( sorted.front(), sorted.back() ) );
+	}
+
 	//----------------------------------------------
 	// String trimming
 	//----------------------------------------------
@@ -2301,4 +2584,58 @@ namespace nfx::string::test
 		EXPECT_EQ( '\n', toUpper( '\n' ) );
 		EXPECT_EQ( '\r', toUpper( '\r' ) );
 	}
+
+	//----------------------------------------------
+	// Allocation guarantees
+	//----------------------------------------------
+
+	TEST( StringUtilsAllocations, ViewFunctionsDoNotAllocate )
+	{
+		// Longer than any small-string buffer, so an accidental copy would reach the heap
+		const std::string text{ "   The quick brown fox jumps over the lazy dog, well past the small-string limit   " };
+		std::string_view view;
+		bool flag = false;
+		std::size_t position = 0;
+
+		EXPECT_NO_ALLOC( view = trim( text ) );
+		EXPECT_EQ( view.front(), 'T' );
+		EXPECT_NO_ALLOC( view = commonPrefix( text, "   The quick red fox" ) );
+		EXPECT_EQ( view, "   The quick " );
+		EXPECT_NO_ALLOC( flag = startsWith( text, "   The" ) && contains( text, "lazy dog" ) && iequals( text, text ) );
+		EXPECT_TRUE( flag );
+		EXPECT_NO_ALLOC( position = indexOf( text, "fox" ) + count( text, ' ' ) + countOverlapping( text, "o" ) );
+		EXPECT_GT( position, 0u );
+		EXPECT_NO_ALLOC( position = countAny( text, CharClass::whitespace() ) );
+		EXPECT_GT( position, 0u );
+		EXPECT_NO_ALLOC( position = count( text, "o" ) + count( text, "fox" ) + countOverlapping( text, "quick brown" ) );
+		EXPECT_EQ( position, 6u );
+
+		// Patterns longer than the stack failure table are counted in constant space too
+		const std::string run( 4096, 'a' );
+		const std::string_view longPattern = std::string_view{ run }.substr( 0, 300 );
+		EXPECT_NO_ALLOC( position = count( run, longPattern ) + countOverlapping( run, longPattern ) );
+		EXPECT_EQ( position, 13u + 3797u );
+
+		int number = 0;
+		double real = 0.0;
+		EXPECT_NO_ALLOC( flag = tryParseInt( "-12345", number ) && tryParseDouble( "2.5e3", real ) );
+		EXPECT_TRUE( flag );
+
+		std::string_view host;
+		std::uint16_t port = 0;
+		EXPECT_NO_ALLOC( flag = isIPv4Address( "192.168.1.1" ) && isIPv6Address( "2001:db8::1" ) &&
+								tryParseEndpoint( "[2001:db8::1]:443", host, port ) );
+		EXPECT_TRUE( flag );
+		EXPECT_EQ( port, 443 );
+	}
+
+	TEST( StringUtilsAllocations, CounterSeesAllocatingFunctions )
+	{
+		const std::string text( 1000, 'A' );
+		const AllocationCounter allocations;
+		const std::string lower = toLower( text );
+		EXPECT_GE( allocations.count(), 1u );
+		EXPECT_GE( allocations.stats().bytes, text.size() );
+		EXPECT_EQ( lower, std::string( 1000, 'a' ) );
+	}
 } // namespace nfx::string::test